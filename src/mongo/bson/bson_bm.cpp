@@ -28,12 +28,14 @@
  */
 
 
+#include <algorithm>
 #include <benchmark/benchmark.h>
 #include <cstddef>
 #include <cstdint>
 #include <fmt/format.h>
 #include <string>
 #include <utility>
+#include <vector>
 
 
 #include "mongo/base/status.h"
@@ -89,6 +91,51 @@ void BM_arrayBuilder(benchmark::State& state) {
     state.SetBytesProcessed(totalBytes);
 }
 
+template <typename Builder, typename... Args>
+void buildObject(benchmark::State& state, Args&&... args) {
+    size_t totalBytes = 0;
+    for (auto _ : state) {
+        benchmark::ClobberMemory();
+        Builder bob(std::forward<Args>(args)...);
+        for (auto j = 0; j < state.range(0); j++)
+            bob.append("field"_sd, j);
+        totalBytes += bob.len();
+        benchmark::DoNotOptimize(bob.obj());
+    }
+    state.SetBytesProcessed(totalBytes);
+}
+
+void BM_objBuilder(benchmark::State& state) {
+    buildObject<BSONObjBuilder>(state);
+}
+
+void BM_objBuilderSizeHint(benchmark::State& state) {
+    // Each element is a type byte, a 6 byte field name and a 4 byte int.
+    buildObject<BSONObjBuilder>(state, static_cast<int>(state.range(0) * 11 + 5));
+}
+
+void BM_objBuilderSizeTracker(benchmark::State& state) {
+    BSONSizeTracker tracker;
+    buildObject<BSONObjBuilder>(state, tracker);
+}
+
+void BM_stackObjBuilder(benchmark::State& state) {
+    buildObject<StackBSONObjBuilder>(state);
+}
+
+void BM_stackObjBuilderDone(benchmark::State& state) {
+    size_t totalBytes = 0;
+    for (auto _ : state) {
+        benchmark::ClobberMemory();
+        StackBSONObjBuilder bob;
+        for (auto j = 0; j < state.range(0); j++)
+            bob.append("field"_sd, j);
+        totalBytes += bob.len();
+        benchmark::DoNotOptimize(bob.done());
+    }
+    state.SetBytesProcessed(totalBytes);
+}
+
 void BM_arrayLookup(benchmark::State& state) {
     BSONArrayBuilder builder;
     auto len = state.range(0);
@@ -121,6 +168,45 @@ void BM_bsonIteratorSortedConstruction(benchmark::State& state) {
     state.SetBytesProcessed(totalBytes);
 }
 
+// Sorts 'len' single-field documents. If 'mixed' is set the field alternates between ints, longs
+// and doubles so most comparisons are between different numeric types.
+void sortNumbers(benchmark::State& state, bool mixed) {
+    const auto len = state.range(0);
+    std::vector<BSONObj> objs;
+    objs.reserve(len);
+    uint64_t x = 0x9E3779B97F4A7C15ULL;
+    for (auto j = 0; j < len; j++) {
+        x ^= x << 13;
+        x ^= x >> 7;
+        x ^= x << 17;
+        const int v = static_cast<int>(x % 100'000);
+        if (!mixed || j % 3 == 0) {
+            objs.push_back(BSON("a" << v));
+        } else if (j % 3 == 1) {
+            objs.push_back(BSON("a" << static_cast<long long>(v)));
+        } else {
+            objs.push_back(BSON("a" << v + 0.5));
+        }
+    }
+
+    for (auto _ : state) {
+        auto sorted = objs;
+        std::sort(sorted.begin(), sorted.end(), [](const BSONObj& l, const BSONObj& r) {
+            return l.woCompare(r) < 0;
+        });
+        benchmark::DoNotOptimize(sorted.data());
+    }
+    state.SetItemsProcessed(state.iterations() * len);
+}
+
+void BM_sortInts(benchmark::State& state) {
+    sortNumbers(state, false);
+}
+
+void BM_sortMixedNumbers(benchmark::State& state) {
+    sortNumbers(state, true);
+}
+
 void BM_validate(benchmark::State& state) {
     BSONArrayBuilder builder;
     auto len = state.range(0);
@@ -168,7 +254,14 @@ void BM_validate_contents(benchmark::State& state) {
 
 BENCHMARK(BM_arrayBuilder)->Ranges({{{1}, {100'000}}});
 BENCHMARK(BM_arrayLookup)->Ranges({{{1}, {100'000}}});
+BENCHMARK(BM_objBuilder)->Ranges({{{1}, {1'000}}});
+BENCHMARK(BM_objBuilderSizeHint)->Ranges({{{1}, {1'000}}});
+BENCHMARK(BM_objBuilderSizeTracker)->Ranges({{{1}, {1'000}}});
+BENCHMARK(BM_stackObjBuilder)->Ranges({{{1}, {1'000}}});
+BENCHMARK(BM_stackObjBuilderDone)->Ranges({{{1}, {1'000}}});
 BENCHMARK(BM_bsonIteratorSortedConstruction)->Ranges({{{1}, {100'000}}});
+BENCHMARK(BM_sortInts)->Ranges({{{1'000}, {100'000}}});
+BENCHMARK(BM_sortMixedNumbers)->Ranges({{{1'000}, {100'000}}});
 BENCHMARK(BM_validate)->Ranges({{{1}, {1'000}}});
 BENCHMARK(BM_validate_contents)->Ranges({{{1}, {1'000}}});
 
@@ -55,6 +55,7 @@
 #include "mongo/bson/util/bsoncolumn_util.h"
 #include "mongo/crypto/encryption_fields_util.h"
 #include "mongo/crypto/fle_field_schema_gen.h"
+#include "mongo/platform/bits.h"
 #include "mongo/platform/compiler.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/decimal_counter.h"
@@ -531,9 +532,20 @@ private:
         }
 
         size_t strlen() const {
-            // This is actually by far the hottest code in all of BSON validation.
+            // This is actually by far the hottest code in all of BSON validation, so look for the
+            // terminating NUL a word at a time while a whole word is left in the buffer.
+            constexpr uint64_t kLowBits = 0x0101010101010101ULL;
+            constexpr uint64_t kHighBits = 0x8080808080808080ULL;
             dassert(ptr < end);
             size_t len = 0;
+            while (static_cast<size_t>(end - ptr) - len >= sizeof(uint64_t)) {
+                auto word = ConstDataView(ptr + len).read<LittleEndian<uint64_t>>();
+                // The lowest set bit is the high bit of the first zero byte; later bytes may give
+                // false positives, but those are never looked at.
+                if (auto zeros = (word - kLowBits) & ~word & kHighBits)
+                    return len + countTrailingZeros64(zeros) / 8;
+                len += sizeof(uint64_t);
+            }
             while (ptr[len])
                 ++len;
             return len;
@@ -419,6 +419,45 @@ TEST(BSONValidateExtended, BSONUTF8) {
     ASSERT_EQ(status, ErrorCodes::NonConformantBSON);
 }
 
+TEST(BSONValidateExtended, BSONUTF8InLongStrings) {
+    // Place an invalid byte, and a valid multi-byte sequence, at every offset of a string long
+    // enough to span several words.
+    for (size_t offset = 0; offset < 40; ++offset) {
+        std::string str(40, 'a');
+        str[offset] = '\x80';
+        auto x1 = BSON("str" << str);
+        ASSERT_EQ(validateBSON(x1.objdata(), x1.objsize(), mongo::BSONValidateModeEnum::kFull),
+                  ErrorCodes::NonConformantBSON);
+
+        str = std::string(40, 'a');
+        str.replace(offset, 2, "\xC3\xA9");
+        str.resize(40);
+        x1 = BSON("str" << str);
+        auto status =
+            validateBSON(x1.objdata(), x1.objsize(), mongo::BSONValidateModeEnum::kFull);
+        // The sequence is truncated when it starts on the last byte.
+        if (offset == 39) {
+            ASSERT_EQ(status, ErrorCodes::NonConformantBSON);
+        } else {
+            ASSERT_OK(status);
+        }
+    }
+}
+
+TEST(BSONValidateFast, FieldNamesOfEveryLength) {
+    for (size_t len = 0; len < 40; ++len) {
+        auto x1 = BSON(std::string(len, 'f') << 1);
+        ASSERT_OK(validateBSON(x1));
+
+        // A field name ending on the last byte of the buffer leaves no room for its value.
+        BufBuilder bb;
+        bb.appendNum(static_cast<int32_t>(len + 6));
+        bb.appendChar(BSONType::NumberInt);
+        bb.appendStr(std::string(len, 'f'));
+        ASSERT_NOT_OK(validateBSON(bb.buf(), bb.len()));
+    }
+}
+
 TEST(BSONValidateFast, Empty) {
     BSONObj x;
     ASSERT_OK(validateBSON(x));
@@ -457,9 +457,9 @@ std::vector<BSONElement> BSONElement::Array() const {
     return v;
 }
 
-int BSONElement::woCompare(const BSONElement& elem,
-                           ComparisonRulesSet rules,
-                           const StringDataComparator* comparator) const {
+int BSONElement::_woCompareGeneral(const BSONElement& elem,
+                                   ComparisonRulesSet rules,
+                                   const StringDataComparator* comparator) const {
     if (type() != elem.type()) {
         int lt = (int)canonicalType();
         int rt = (int)elem.canonicalType();
@@ -41,6 +41,7 @@
 #include <utility>
 #include <vector>
 
+#include "mongo/base/compare_numbers.h"
 #include "mongo/base/data_range.h"
 #include "mongo/base/data_type_endian.h"
 #include "mongo/base/data_view.h"
@@ -949,6 +950,14 @@ public:
     static int computeSize(int8_t type, const char* data, int fieldNameSize, int bufSize = 0);
 
 private:
+    /**
+     * The general case of woCompare(), for everything but elements that are both NumberInt,
+     * NumberLong or NumberDouble.
+     */
+    int _woCompareGeneral(const BSONElement& elem,
+                          ComparisonRulesSet rules,
+                          const StringDataComparator* comparator) const;
+
     /**
      * This is to enable structured bindings for BSONElement, it should not be used explicitly.
      * When used in a structed binding, BSONElement behaves as-if it is a
@@ -1007,6 +1016,30 @@ private:
     }
 };
 
+inline int BSONElement::woCompare(const BSONElement& elem,
+                                  ComparisonRulesSet rules,
+                                  const StringDataComparator* comparator) const {
+    // Same-typed numbers dominate sorts and equality checks, so they are compared inline without
+    // going through the canonical type lookup and the per-type dispatch of compareElements().
+    const auto lType = type();
+    if (lType == elem.type() &&
+        (lType == NumberInt || lType == NumberLong || lType == NumberDouble)) {
+        if (rules & ComparisonRules::kConsiderFieldName) {
+            if (int diff = fieldNameStringData().compare(elem.fieldNameStringData()))
+                return diff;
+        }
+        switch (lType) {
+            case NumberInt:
+                return compareInts(_numberInt(), elem._numberInt());
+            case NumberLong:
+                return compareLongs(_numberLong(), elem._numberLong());
+            default:
+                return compareDoubles(_numberDouble(), elem._numberDouble());
+        }
+    }
+    return _woCompareGeneral(elem, rules, comparator);
+}
+
 inline bool BSONElement::trueValue() const {
     // NOTE Behavior changes must be replicated in Value::coerceToBool().
     switch (type()) {
@@ -133,6 +133,7 @@ public:
 
     // Move constructible, but not assignable due to reference member.
     BSONObjBuilderBase(BSONObjBuilderBase<Derived, B>&& other)
+    requires std::is_move_constructible_v<B>
         : _b(&other._b == &other._buf ? _buf : other._b),
           _buf(std::move(other._buf)),
           _offset(std::move(other._offset)),
@@ -912,6 +913,63 @@ private:
     }
 };
 
+// The following forward declaration exists to enable the extern
+// declaration, which must come before the use of the matching
+// instantiation of the base class of StackBSONObjBuilder. Do not
+// remove or re-order these lines w.r.t BSONObjBuilderBase or
+// StackBSONObjBuilder without being sure that you are not undoing
+// the advantages of the extern template declaration.
+class StackBSONObjBuilder;
+extern template class BSONObjBuilderBase<StackBSONObjBuilder, StackBufBuilder>;
+
+/**
+ * Alternative to BSONObjBuilder for small objects on hot paths. The object is built in a buffer on
+ * the stack, and only moves to the heap if it outgrows it. An object that is consumed before the
+ * builder goes out of scope, through done(), never touches the heap. obj() copies it out into a
+ * single heap allocation of exactly its size.
+ *
+ * Large objects pay for that copy, so prefer a BSONObjBuilder constructed with a size hint or a
+ * BSONSizeTracker for them. This builder is not movable, and cannot have sub-builders: nested
+ * objects must be built separately and appended.
+ */
+class StackBSONObjBuilder : public BSONObjBuilderBase<StackBSONObjBuilder, StackBufBuilder> {
+private:
+    using Super = BSONObjBuilderBase<StackBSONObjBuilder, StackBufBuilder>;
+    friend Super;
+
+public:
+    StackBSONObjBuilder() : Super(StackSizeDefault) {}
+
+    /** @param initsize this is just a hint as to the final size of the object */
+    explicit StackBSONObjBuilder(int initsize) : Super(initsize) {}
+
+    StackBSONObjBuilder(const StackBSONObjBuilder&) = delete;
+    StackBSONObjBuilder& operator=(const StackBSONObjBuilder&) = delete;
+
+    ~StackBSONObjBuilder() {
+        Super::_destruct();
+    }
+
+    /**
+     * destructive
+     * @return owned BSONObj in a heap buffer sized to fit it exactly
+     */
+    template <typename BSONTraits = BSONObj::DefaultSizeTrait>
+    BSONObj obj() {
+        return done<BSONTraits>().copy();
+    }
+
+private:
+    // Compile-time "virtual" which must be provided to satisfy the base class.
+    void doDone() {
+        // Intentionally left empty.
+    }
+
+    void doResetToEmpty() {
+        // Intentionally left empty.
+    }
+};
+
 /**
  * Base class for building BSON arrays. Similar to BSONObjBuilderBase.
  */
@@ -629,5 +629,36 @@ TEST(BSONObjBuilderTest, UniqueArrayBuilderReleaseToBuffer) {
         auto tmp = UniqueBuffer::reclaim(rawData);
     }
 }
+
+TEST(BSONObjBuilderTest, StackBuilderObjIsExactlySized) {
+    StackBSONObjBuilder bob;
+    bob.append("a", 1);
+    bob.append("b", "hello");
+    auto obj = bob.obj();
+
+    ASSERT_BSONOBJ_EQ(obj, BSON("a" << 1 << "b"
+                                    << "hello"));
+    ASSERT(obj.isOwned());
+    ASSERT_EQ(obj.sharedBuffer().capacity(), static_cast<size_t>(obj.objsize()));
+}
+
+TEST(BSONObjBuilderTest, StackBuilderSpillsToHeap) {
+    StackBSONObjBuilder bob;
+    BSONObjBuilder expected;
+    for (int i = 0; i < 1000; ++i) {
+        bob.append(std::to_string(i), i);
+        expected.append(std::to_string(i), i);
+    }
+    ASSERT_GT(bob.len(), static_cast<int>(StackSizeDefault));
+    ASSERT_BSONOBJ_EQ(bob.obj(), expected.obj());
+}
+
+TEST(BSONObjBuilderTest, StackBuilderSizeHintAndReset) {
+    StackBSONObjBuilder bob(4 * StackSizeDefault);
+    bob.append("a", 1);
+    bob.resetToEmpty();
+    bob.append("b", 2);
+    ASSERT_BSONOBJ_EQ(bob.done(), BSON("b" << 2));
+}
 }  // namespace
 }  // namespace mongo
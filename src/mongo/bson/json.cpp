@@ -105,6 +105,31 @@ enum {
     DATE_RESERVE_SIZE = 64
 };
 
+// Returns the first position in [p, end) that holds 'terminal', a backslash or a control character,
+// or 'end' if there is none. Most string content needs no unescaping, so it is scanned a word at a
+// time and copied in bulk by the caller.
+const char* scanPlainChars(const char* p, const char* end, char terminal) {
+    constexpr uint64_t kOnes = 0x0101010101010101ULL;
+    constexpr uint64_t kHighBits = 0x8080808080808080ULL;
+    auto hasZeroByte = [](uint64_t x) {
+        return (x - kOnes) & ~x & kHighBits;
+    };
+    const uint64_t terminalBytes = kOnes * static_cast<uint8_t>(terminal);
+    while (end - p >= static_cast<std::ptrdiff_t>(sizeof(uint64_t))) {
+        uint64_t word;
+        std::memcpy(&word, p, sizeof(word));
+        if (hasZeroByte(word ^ terminalBytes) | hasZeroByte(word ^ (kOnes * '\\')) |
+            ((word - kOnes * 0x20) & ~word & kHighBits)) {
+            break;
+        }
+        p += sizeof(uint64_t);
+    }
+    while (p < end && *p != terminal && *p != '\\' && !(0x00 <= *p && *p <= 0x1F)) {
+        ++p;
+    }
+    return p;
+}
+
 static const char *LBRACE = "{", *RBRACE = "}", *LBRACKET = "[", *RBRACKET = "]", *LPAREN = "(",
                   *RPAREN = ")", *COLON = ":", *COMMA = ",", *FORWARDSLASH = "/",
                   *SINGLEQUOTE = "'", *DOUBLEQUOTE = "\"";
@@ -1350,7 +1375,21 @@ Status JParse::chars(std::string* result, const char* terminalSet, const char* a
         return parseError("Unexpected end of input");
     }
     const char* q = _input;
-    while (q < _input_end && !match(*q, terminalSet)) {
+    // Quoted strings end at a single terminal character and allow everything else, so runs of
+    // bytes that need no unescaping can be copied at once.
+    const bool bulkCopy = allowedSet == nullptr && terminalSet[0] != '\0' && terminalSet[1] == '\0';
+    while (q < _input_end) {
+        if (bulkCopy) {
+            const char* run = q;
+            q = scanPlainChars(q, _input_end, terminalSet[0]);
+            result->append(run, q);
+            if (q >= _input_end) {
+                break;
+            }
+        }
+        if (match(*q, terminalSet)) {
+            break;
+        }
         MONGO_JSON_DEBUG("q: " << q);
         if (allowedSet != nullptr) {
             if (!match(*q, allowedSet)) {
@@ -1402,10 +1441,7 @@ Status JParse::chars(std::string* result, const char* terminalSet, const char* a
                     }
                     unsigned char first = hexblob::decodePair(StringData(q, 2));
                     unsigned char second = hexblob::decodePair(StringData(q += 2, 2));
-                    const std::string& utf8str = encodeUTF8(first, second);
-                    for (unsigned int i = 0; i < utf8str.size(); i++) {
-                        result->push_back(utf8str[i]);
-                    }
+                    result->append(encodeUTF8(first, second));
                     ++q;
                     break;
                 }
@@ -1445,18 +1481,15 @@ Status JParse::chars(std::string* result, const char* terminalSet, const char* a
 }
 
 std::string JParse::encodeUTF8(unsigned char first, unsigned char second) const {
-    std::ostringstream oss;
     if (first == 0 && second < 0x80) {
-        oss << second;
+        return std::string(1, char(second));
     } else if (first < 0x08) {
-        oss << char(0xc0 | (first << 2 | second >> 6));
-        oss << char(0x80 | (~0xc0 & second));
+        return {char(0xc0 | (first << 2 | second >> 6)), char(0x80 | (~0xc0 & second))};
     } else {
-        oss << char(0xe0 | (first >> 4));
-        oss << char(0x80 | (~0xc0 & (first << 2 | second >> 6)));
-        oss << char(0x80 | (~0xc0 & second));
+        return {char(0xe0 | (first >> 4)),
+                char(0x80 | (~0xc0 & (first << 2 | second >> 6))),
+                char(0x80 | (~0xc0 & second))};
     }
-    return oss.str();
 }
 
 inline bool JParse::peekToken(const char* token) {
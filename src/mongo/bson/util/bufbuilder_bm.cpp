@@ -29,6 +29,7 @@
 
 #include "mongo/bson/util/builder.h"
 #include <benchmark/benchmark.h>
+#include <cstring>
 
 namespace mongo {
 
@@ -61,4 +62,28 @@ BENCHMARK_TEMPLATE(BM_growBuffer, StackBufBuilder)
     ->Ranges({{0, 1}, {1, 256}})
     ->Iterations(BufferMaxSize / 256);
 
+// Fills a BufBuilder the way a large reply batch does. The first argument selects whether each
+// iteration builds into the buffer released by the previous one, as the reply buffer cache does,
+// or into a fresh BufBuilder that grows by doubling. The second argument is the reply size.
+void BM_buildLargeBuffer(benchmark::State& state) {
+    constexpr size_t kChunkSize = 4096;
+    const bool recycle = state.range(0) == 1;
+    const size_t size = state.range(1);
+    SharedBuffer recycled;
+    for (auto _ : state) {
+        BufBuilder buf = recycled ? BufBuilder(std::move(recycled)) : BufBuilder();
+        for (size_t written = 0; written < size; written += kChunkSize) {
+            memset(buf.skip(kChunkSize), 'x', kChunkSize);
+        }
+        benchmark::DoNotOptimize(buf.buf());
+        if (recycle) {
+            buf.reset();
+            recycled = buf.release();
+        }
+    }
+    state.SetBytesProcessed(state.iterations() * size);
+}
+
+BENCHMARK(BM_buildLargeBuffer)->ArgsProduct({{0, 1}, {1 << 20, 16 << 20}});
+
 }  // namespace mongo
@@ -582,6 +582,11 @@ public:
     static constexpr size_t kDefaultInitSizeBytes = 512;
     BufBuilder(size_t initsize = kDefaultInitSizeBytes) : BasicBufBuilder(initsize) {}
 
+    /**
+     * Builds into an existing buffer, keeping its capacity. 'buf' must not be shared.
+     */
+    explicit BufBuilder(SharedBuffer buf) : BasicBufBuilder(std::move(buf)) {}
+
     /**
      * Assume ownership of the buffer.
      * Note: There should not be any other method calls on this object after a call to 'release'.
@@ -641,6 +646,17 @@ template <size_t SZ>
 class StackBufBuilderBase : public BasicBufBuilder<StackAllocator<SZ>> {
 public:
     StackBufBuilderBase() : BasicBufBuilder<StackAllocator<SZ>>() {}
+
+    /**
+     * Builds on the stack if 'initsize' fits in SZ bytes, otherwise starts with a single heap
+     * allocation of 'initsize' bytes.
+     */
+    explicit StackBufBuilderBase(size_t initsize) : StackBufBuilderBase() {
+        if (initsize > SZ) {
+            this->_buf.malloc(initsize);
+            this->reset();
+        }
+    }
     StackBufBuilderBase(const StackBufBuilderBase&) = delete;
     StackBufBuilderBase(StackBufBuilderBase&&) = delete;
 };
@@ -47,6 +47,33 @@ static constexpr int128_t add(int128_t lhs, int128_t rhs) {
     return static_cast<int128_t>(static_cast<uint128_t>(lhs) + static_cast<uint128_t>(rhs));
 }
 
+// Unpacks the 'iters' slots of a basic simple8b block into 'out', writing 'kMissing' for missing
+// slots. Every slot is extracted with its own shift and the loop has a constant trip count and no
+// branches, so the compiler turns it into SIMD shifts, masks and compares instead of a serial
+// shift-and-test chain. Callers then consume the decoded values from 'out' in order.
+template <int bits, int iters>
+inline void unpackSlots(uint64_t encoded, int64_t* out) {
+    constexpr uint64_t mask = (1ull << bits) - 1;
+    for (int i = 0; i < iters; ++i) {
+        uint64_t slot = (encoded >> (i * bits)) & mask;
+        int64_t decoded = Simple8bTypeUtil::decodeInt64(slot);
+        out[i] = slot == mask ? kMissing : decoded;
+    }
+}
+
+// Visits values previously unpacked with 'unpackSlots'.
+template <int iters, typename Visit, typename VisitMissing>
+inline void visitUnpacked(const int64_t* values,
+                          const Visit& visit,
+                          const VisitMissing& visitMissing) {
+    for (int i = 0; i < iters; ++i) {
+        if (values[i] != kMissing)
+            visit(values[i]);
+        else
+            visitMissing();
+    }
+}
+
 // Simple Simple8b decoder for decoding any basic simple8b block where all bits are used for the
 // value, decodes signed integer at runtime. Suitable for selectors with many bits per slot. Encoded
 // should be be machine endian and first slot should start at least significant bit.
@@ -67,14 +94,9 @@ struct SimpleDecoder {
                   const Visit& visit,
                   const VisitZero& visitZero,
                   const VisitMissing& visitMissing) const {
-        for (int i = iters; i; --i) {
-            uint64_t slot = encoded & mask;
-            if (slot != mask)
-                visit(Simple8bTypeUtil::decodeInt64(slot));
-            else
-                visitMissing();
-            encoded >>= bits;
-        };
+        int64_t values[iters];
+        unpackSlots<bits, iters>(encoded, values);
+        visitUnpacked<iters>(values, visit, visitMissing);
         return iters;
     }
 
@@ -186,14 +208,10 @@ struct TableDecoder {
                   const Visit& visit,
                   const VisitZero& visitZero,
                   const VisitMissing& visitMissing) const {
-        for (int i = iters; i; --i) {
-            const auto& entry = table[encoded % entries];
-            if (entry.num)
-                visit(entry.decoded);
-            else
-                visitMissing();
-            encoded >>= shift;
-        };
+        // The lookup table is a gather that does not vectorize, decode the slots arithmetically.
+        int64_t values[iters];
+        unpackSlots<bits, iters>(encoded, values);
+        visitUnpacked<iters>(values, visit, visitMissing);
         return iters;
     }
 
@@ -282,6 +282,35 @@ void BM_prefixSumUnoptimized(benchmark::State& state) {
     state.SetBytesProcessed(totalBytes);
 }
 
+void BM_visitAll(benchmark::State& state) {
+    BufBuilder buffer = generateIntegers();
+    auto size = buffer.len();
+    auto buf = buffer.release();
+
+    size_t totalBytes = 0;
+
+    for (auto _ : state) {
+        benchmark::ClobberMemory();
+        uint64_t prev = simple8b::kSingleSkip;
+        int64_t last = 0;
+        int64_t lastlast = 0;
+        // Reconstruct the values as delta-of-delta, the way BSONColumn decompresses timestamps.
+        simple8b::visitAll<int64_t>(
+            buf.get(),
+            size,
+            prev,
+            [&](int64_t v) {
+                lastlast += v;
+                last += lastlast;
+                benchmark::DoNotOptimize(last);
+            },
+            [] {});
+        totalBytes += size;
+    }
+
+    state.SetBytesProcessed(totalBytes);
+}
+
 BENCHMARK(BM_increasingValues)->Arg(100);
 BENCHMARK(BM_rle)->Arg(100);
 BENCHMARK(BM_changingSmallValues)->Arg(100);
@@ -292,5 +321,6 @@ BENCHMARK(BM_sum);
 BENCHMARK(BM_sumUnoptimized);
 BENCHMARK(BM_prefixSum);
 BENCHMARK(BM_prefixSumUnoptimized);
+BENCHMARK(BM_visitAll);
 
 }  // namespace mongo
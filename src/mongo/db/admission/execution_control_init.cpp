@@ -40,6 +40,7 @@
 #include "mongo/db/feature_flag.h"
 #include "mongo/util/concurrency/priority_ticketholder.h"
 #include "mongo/util/concurrency/semaphore_ticketholder.h"  // IWYU pragma: keep
+#include "mongo/util/concurrency/sharded_ticketholder.h"
 
 namespace mongo {
 namespace admission {
@@ -63,6 +64,16 @@ void initializeExecutionControl(ServiceContext* svcCtx) {
             gStorageEngineConcurrencyAdjustmentAlgorithm) ==
         StorageEngineConcurrencyAdjustmentAlgorithmEnum::kThroughputProbing;
 
+    // Splitting the semaphore into several pools only pays off on hosts with many cores, so it is
+    // opt-in.
+    auto makeSemaphoreTicketHolder = [&](int numTickets) -> std::unique_ptr<TicketHolder> {
+        if (gStorageEngineTicketPoolShards > 1) {
+            return std::make_unique<ShardedTicketHolder>(
+                svcCtx, numTickets, gStorageEngineTicketPoolShards, usingThroughputProbing);
+        }
+        return std::make_unique<SemaphoreTicketHolder>(svcCtx, numTickets, usingThroughputProbing);
+    };
+
     // If the user manually set concurrency limits, then disable execution control implicitly.
     auto makeTicketHolderManager =
         [&](auto readTicketHolder, auto writeTicketHolder) -> std::unique_ptr<TicketHolderManager> {
@@ -99,19 +110,14 @@ void initializeExecutionControl(ServiceContext* svcCtx) {
         //
         // TODO SERVER-72616: Remove the ifdefs once TicketPool is implemented with atomic
         // wait.
-        ticketHolderManager =
-            makeTicketHolderManager(std::make_unique<SemaphoreTicketHolder>(
-                                        svcCtx, readTransactions, usingThroughputProbing),
-                                    std::make_unique<SemaphoreTicketHolder>(
-                                        svcCtx, writeTransactions, usingThroughputProbing));
+        ticketHolderManager = makeTicketHolderManager(makeSemaphoreTicketHolder(readTransactions),
+                                                      makeSemaphoreTicketHolder(writeTransactions));
 #endif
         TicketHolderManager::use(svcCtx, std::move(ticketHolderManager));
     } else {
         auto ticketHolderManager =
-            makeTicketHolderManager(std::make_unique<SemaphoreTicketHolder>(
-                                        svcCtx, readTransactions, usingThroughputProbing),
-                                    std::make_unique<SemaphoreTicketHolder>(
-                                        svcCtx, writeTransactions, usingThroughputProbing));
+            makeTicketHolderManager(makeSemaphoreTicketHolder(readTransactions),
+                                    makeSemaphoreTicketHolder(writeTransactions));
         TicketHolderManager::use(svcCtx, std::move(ticketHolderManager));
     }
 }
@@ -33,8 +33,13 @@
 
 #include "mongo/db/admission/ingress_admission_context.h"
 #include "mongo/db/admission/ingress_admission_control_gen.h"
+#include "mongo/base/parse_number.h"
+#include "mongo/db/multitenancy.h"
 #include "mongo/db/service_context.h"
+#include "mongo/rpc/metadata/client_metadata.h"
 #include "mongo/util/decorable.h"
+#include "mongo/util/str.h"
+#include "mongo/util/string_map.h"
 
 namespace mongo {
 
@@ -46,15 +51,68 @@ const ConstructorActionRegistererType<ServiceContext> onServiceContextCreate{
     "InitIngressAdmissionController", [](ServiceContext* ctx) {
         getIngressAdmissionController(ctx).init();
     }};
+
+// Group of the operations that have no tenant or application name.
+constexpr auto kDefaultQueueGroup = "default"_sd;
+
+boost::optional<IngressAdmissionController::FairQueueGroupBy> parseFairQueueGroupBy(
+    StringData value) {
+    using GroupBy = IngressAdmissionController::FairQueueGroupBy;
+    if (value == "none"_sd) {
+        return GroupBy::kNone;
+    }
+    if (value == "tenant"_sd) {
+        return GroupBy::kTenant;
+    }
+    if (value == "application"_sd) {
+        return GroupBy::kApplication;
+    }
+    return boost::none;
+}
+
+StatusWith<StringMap<int32_t>> parseFairQueueWeights(StringData value) {
+    StringMap<int32_t> weights;
+    while (!value.empty()) {
+        auto entry = value.substr(0, value.find(','));
+        value = entry.size() < value.size() ? value.substr(entry.size() + 1) : StringData{};
+
+        auto colon = entry.rfind(':');
+        if (colon == std::string::npos || colon == 0) {
+            return Status(ErrorCodes::BadValue,
+                          str::stream() << "Invalid fair queue weight '" << entry
+                                        << "', expected 'group:weight'");
+        }
+
+        int32_t weight;
+        if (auto status = NumberParser{}(entry.substr(colon + 1), &weight);
+            !status.isOK() || weight <= 0) {
+            return Status(ErrorCodes::BadValue,
+                          str::stream() << "Invalid fair queue weight '" << entry
+                                        << "', the weight must be a positive integer");
+        }
+        weights[std::string{entry.substr(0, colon)}] = weight;
+    }
+    return weights;
+}
 }  // namespace
 
 IngressAdmissionController::IngressAdmissionController() {}
 
 void IngressAdmissionController::init() {
-    _ticketHolder =
-        std::make_unique<SemaphoreTicketHolder>(&getIngressAdmissionController.owner(*this),
-                                                gIngressAdmissionControllerTicketPoolSize.load(),
-                                                false);
+    auto* svcCtx = &getIngressAdmissionController.owner(*this);
+    auto numTickets = gIngressAdmissionControllerTicketPoolSize.load();
+
+    _groupBy = *parseFairQueueGroupBy(gIngressAdmissionControllerFairQueueGroupBy);
+    if (_groupBy == FairQueueGroupBy::kNone) {
+        _ticketHolder = std::make_unique<SemaphoreTicketHolder>(svcCtx, numTickets, false);
+        return;
+    }
+
+    auto ticketHolder = std::make_unique<FairQueueTicketHolder>(svcCtx, numTickets, false);
+    ticketHolder->setWeights(
+        uassertStatusOK(parseFairQueueWeights(gIngressAdmissionControllerFairQueueWeights.get())));
+    _fairQueueTicketHolder = ticketHolder.get();
+    _ticketHolder = std::move(ticketHolder);
 }
 
 IngressAdmissionController& IngressAdmissionController::get(OperationContext* opCtx) {
@@ -63,6 +121,9 @@ IngressAdmissionController& IngressAdmissionController::get(OperationContext* op
 
 Ticket IngressAdmissionController::admitOperation(OperationContext* opCtx) {
     auto& admCtx = IngressAdmissionContext::get(opCtx);
+    if (_fairQueueTicketHolder) {
+        admCtx.setQueueGroup(_getQueueGroup(opCtx));
+    }
 
     // Try to get the ticket without waiting
     if (auto ticket = _ticketHolder->tryAcquire(&admCtx)) {
@@ -72,6 +133,25 @@ Ticket IngressAdmissionController::admitOperation(OperationContext* opCtx) {
     return _ticketHolder->waitForTicket(*opCtx, &admCtx);
 }
 
+std::string IngressAdmissionController::_getQueueGroup(OperationContext* opCtx) const {
+    switch (_groupBy) {
+        case FairQueueGroupBy::kNone:
+            break;
+        case FairQueueGroupBy::kTenant:
+            if (auto tenantId = getActiveTenant(opCtx)) {
+                return tenantId->toString();
+            }
+            break;
+        case FairQueueGroupBy::kApplication:
+            if (auto clientMetadata = ClientMetadata::get(opCtx->getClient());
+                clientMetadata && !clientMetadata->getApplicationName().empty()) {
+                return std::string{clientMetadata->getApplicationName()};
+            }
+            break;
+    }
+    return std::string{kDefaultQueueGroup};
+}
+
 void IngressAdmissionController::resizeTicketPool(int32_t newSize) {
     uassert(8611200, "Failed to resize ticket pool", _ticketHolder->resize(newSize));
 }
@@ -90,4 +170,35 @@ Status IngressAdmissionController::onUpdateTicketPoolSize(int32_t newValue) try
     return ex.toStatus();
 }
 
+Status IngressAdmissionController::validateFairQueueGroupBy(const std::string& value,
+                                                           const boost::optional<TenantId>&) {
+    if (!parseFairQueueGroupBy(value)) {
+        return Status(ErrorCodes::BadValue,
+                      str::stream() << "Invalid fair queue grouping '" << value
+                                    << "', expected one of 'none', 'tenant' or 'application'");
+    }
+    return Status::OK();
+}
+
+Status IngressAdmissionController::validateFairQueueWeights(const std::string& value,
+                                                           const boost::optional<TenantId>&) {
+    return parseFairQueueWeights(value).getStatus();
+}
+
+Status IngressAdmissionController::onUpdateFairQueueWeights(const std::string& value) {
+    auto swWeights = parseFairQueueWeights(value);
+    if (!swWeights.isOK()) {
+        return swWeights.getStatus();
+    }
+
+    auto* svcCtx = getCurrentServiceContext();
+    if (svcCtx == nullptr) {
+        return Status::OK();
+    }
+    if (auto* ticketHolder = getIngressAdmissionController(svcCtx)._fairQueueTicketHolder) {
+        ticketHolder->setWeights(std::move(swWeights.getValue()));
+    }
+    return Status::OK();
+}
+
 }  // namespace mongo
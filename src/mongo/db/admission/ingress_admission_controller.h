@@ -29,16 +29,26 @@
 
 #pragma once
 
+#include <boost/optional/optional.hpp>
 #include <memory>
+#include <string>
 
 #include "mongo/db/operation_context.h"
 #include "mongo/db/service_context.h"
+#include "mongo/db/tenant_id.h"
 #include "mongo/util/concurrency/admission_context.h"
+#include "mongo/util/concurrency/fair_queue_ticketholder.h"
 #include "mongo/util/concurrency/semaphore_ticketholder.h"
 
 namespace mongo {
 class IngressAdmissionController {
 public:
+    /**
+     * How operations are grouped when waiting for a ticket, see the
+     * ingressAdmissionControllerFairQueueGroupBy server parameter.
+     */
+    enum class FairQueueGroupBy { kNone, kTenant, kApplication };
+
     explicit IngressAdmissionController();
 
     /**
@@ -71,6 +81,20 @@ public:
      */
     static Status onUpdateTicketPoolSize(int newValue);
 
+    /**
+     * Validates the server parameter that selects how operations are grouped for fair queuing.
+     */
+    static Status validateFairQueueGroupBy(const std::string& value,
+                                           const boost::optional<TenantId>&);
+
+    /**
+     * Validates and applies the server parameter that holds the weights of the fair queuing
+     * groups.
+     */
+    static Status validateFairQueueWeights(const std::string& value,
+                                           const boost::optional<TenantId>&);
+    static Status onUpdateFairQueueWeights(const std::string& value);
+
     /**
      * Initialize the IngressAdmissionController after the ServiceContext is constructed. This will
      * be called automatically during static initialization.
@@ -78,7 +102,16 @@ public:
     void init();
 
 private:
-    std::unique_ptr<SemaphoreTicketHolder> _ticketHolder{nullptr};
+    /**
+     * Returns the fair queuing group of the operation.
+     */
+    std::string _getQueueGroup(OperationContext* opCtx) const;
+
+    std::unique_ptr<TicketHolder> _ticketHolder{nullptr};
+
+    // Set when the tickets are shared between groups of operations, aliases '_ticketHolder'.
+    FairQueueTicketHolder* _fairQueueTicketHolder{nullptr};
+    FairQueueGroupBy _groupBy{FairQueueGroupBy::kNone};
 };
 
 }  // namespace mongo
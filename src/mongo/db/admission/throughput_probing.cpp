@@ -38,6 +38,8 @@
 #include "mongo/base/error_codes.h"
 #include "mongo/db/admission/throughput_probing_gen.h"
 #include "mongo/db/dump_lock_manager.h"
+#include "mongo/db/storage/kv/kv_engine.h"
+#include "mongo/db/storage/storage_engine.h"
 #include "mongo/logv2/log.h"
 #include "mongo/logv2/log_attr.h"
 #include "mongo/logv2/log_component.h"
@@ -95,11 +97,53 @@ Status validateMaxConcurrency(int32_t concurrency, const boost::optional<TenantI
 
 using namespace throughput_probing;
 
+namespace {
+std::vector<int64_t> combinedLatencyCounts(const TicketHolder* read, const TicketHolder* write) {
+    auto counts = read->getProcessingLatencyCounts();
+    auto writeCounts = write->getProcessingLatencyCounts();
+    invariant(counts.size() == writeCounts.size());
+    for (size_t i = 0; i < counts.size(); ++i) {
+        counts[i] += writeCounts[i];
+    }
+    return counts;
+}
+
+// Returns the upper bound of the latency bucket holding the given percentile of the tickets
+// released between the 'prev' and 'current' snapshots, or boost::none if none were released.
+boost::optional<int64_t> latencyPercentile(const std::vector<int64_t>& prev,
+                                           const std::vector<int64_t>& current,
+                                           double percentile) {
+    const auto& partitions = TicketHolder::processingLatencyPartitions();
+    invariant(prev.size() == current.size());
+
+    int64_t total = 0;
+    for (size_t i = 0; i < current.size(); ++i) {
+        total += current[i] - prev[i];
+    }
+    if (total <= 0) {
+        return boost::none;
+    }
+
+    const auto target = static_cast<int64_t>(std::ceil(total * percentile));
+    int64_t seen = 0;
+    for (size_t i = 0; i < partitions.size(); ++i) {
+        seen += current[i] - prev[i];
+        if (seen >= target) {
+            return partitions[i];
+        }
+    }
+
+    // The last bucket is unbounded, so report its lower bound.
+    return partitions.back();
+}
+}  // namespace
+
 ThroughputProbing::ThroughputProbing(ServiceContext* svcCtx,
                                      TicketHolder* readTicketHolder,
                                      TicketHolder* writeTicketHolder,
                                      Milliseconds interval)
-    : _readTicketHolder(readTicketHolder),
+    : _svcCtx(svcCtx),
+      _readTicketHolder(readTicketHolder),
       _writeTicketHolder(writeTicketHolder),
       _stableConcurrency(
           gInitialConcurrency
@@ -127,6 +171,11 @@ void ThroughputProbing::appendStats(BSONObjBuilder& builder) const {
 
 
 void ThroughputProbing::_run(Client* client) {
+    // The ticket hold times are only needed to check the latency target.
+    const bool trackLatency = gLatencySLOMicros.load() > 0;
+    _readTicketHolder->setTrackProcessingLatency(trackLatency);
+    _writeTicketHolder->setTrackProcessingLatency(trackLatency);
+
     auto numFinishedProcessing =
         _readTicketHolder->numFinishedProcessing() + _writeTicketHolder->numFinishedProcessing();
     invariant(numFinishedProcessing >= _prevNumFinishedProcessing);
@@ -134,6 +183,7 @@ void ThroughputProbing::_run(Client* client) {
     // Initialize on first iteration.
     if (_prevNumFinishedProcessing < 0) {
         _prevNumFinishedProcessing = numFinishedProcessing;
+        _prevLatencyCounts = combinedLatencyCounts(_readTicketHolder, _writeTicketHolder);
         _timer.reset();
         return;
     }
@@ -149,6 +199,8 @@ void ThroughputProbing::_run(Client* client) {
     auto throughput =
         (numFinishedProcessing - _prevNumFinishedProcessing) / static_cast<double>(elapsed.count());
 
+    _measureLatencyAndCachePressure();
+
     switch (_state) {
         case ProbingState::kStable:
             _probeStable(throughput);
@@ -165,6 +217,7 @@ void ThroughputProbing::_run(Client* client) {
     // cause-effect relationship.
     _prevNumFinishedProcessing =
         _readTicketHolder->numFinishedProcessing() + _writeTicketHolder->numFinishedProcessing();
+    _prevLatencyCounts = combinedLatencyCounts(_readTicketHolder, _writeTicketHolder);
     _timer.reset();
 }
 
@@ -197,14 +250,25 @@ void ThroughputProbing::_probeStable(double throughput) {
 
     // Record the baseline reading.
     _stableThroughput = throughput;
+    _stableLatencyMicros = _latencyMicros;
+    _stableCacheDirtyRatio = _cacheDirtyRatio;
+    _stableLimitsBreached = _limitsBreached();
 
     auto readTotal = _readTicketHolder->outof();
     auto writeTotal = _writeTicketHolder->outof();
     auto readPeak = _readTicketHolder->getAndResetPeakUsed();
     auto writePeak = _writeTicketHolder->getAndResetPeakUsed();
 
-    if ((readTotal < gMaxConcurrency.load() && readPeak >= readTotal) ||
-        (writeTotal < gMaxConcurrency.load() && writePeak >= writeTotal)) {
+    if (_stableLimitsBreached) {
+        // The current level of concurrency breaches the latency target or puts too much pressure
+        // on the storage engine cache, so try decreasing concurrency even if tickets are
+        // exhausted.
+        if (readTotal > gMinConcurrency || writeTotal > gMinConcurrency) {
+            _state = ProbingState::kDown;
+            _decreaseConcurrency();
+        }
+    } else if ((readTotal < gMaxConcurrency.load() && readPeak >= readTotal) ||
+               (writeTotal < gMaxConcurrency.load() && writePeak >= writeTotal)) {
         // At least one of the ticket pools is exhausted, so try increasing concurrency.
         _state = ProbingState::kUp;
         _increaseConcurrency();
@@ -219,9 +283,20 @@ void ThroughputProbing::_probeStable(double throughput) {
 void ThroughputProbing::_probeUp(double throughput) {
     invariant(_state == ProbingState::kUp);
 
-    LOGV2_DEBUG(7346001, 3, "Throughput Probing: up", "throughput"_attr = throughput);
-
-    if (throughput > _stableThroughput) {
+    LOGV2_DEBUG(7346001,
+                3,
+                "Throughput Probing: up",
+                "throughput"_attr = throughput,
+                "latencyMicros"_attr = _latencyMicros,
+                "cacheDirtyRatio"_attr = _cacheDirtyRatio);
+
+    if (throughput > _stableThroughput && _limitsBreached()) {
+        // Increasing concurrency helped throughput, but at the cost of breaching the latency
+        // target or the cache dirty limit, so don't keep it.
+        _recordLimitedDecision();
+        _state = ProbingState::kStable;
+        _resetConcurrency();
+    } else if (throughput > _stableThroughput) {
         // Increasing concurrency caused throughput to increase, so use this information to
         // adjust our stable concurrency. We don't want to leave this at the current level.
         // Instead, we use this to update the moving average to avoid over-correcting on recent
@@ -250,7 +325,36 @@ void ThroughputProbing::_probeUp(double throughput) {
 void ThroughputProbing::_probeDown(double throughput) {
     invariant(_state == ProbingState::kDown);
 
-    LOGV2_DEBUG(7346002, 3, "Throughput Probing: down", "throughput"_attr = throughput);
+    LOGV2_DEBUG(7346002,
+                3,
+                "Throughput Probing: down",
+                "throughput"_attr = throughput,
+                "latencyMicros"_attr = _latencyMicros,
+                "cacheDirtyRatio"_attr = _cacheDirtyRatio);
+
+    // When the stable level breached the limits, a decrease is kept as long as it brought the
+    // measurements back within the limits or at least reduced latency, even at the cost of some
+    // throughput.
+    const bool limitsImproved = _stableLimitsBreached &&
+        (!_limitsBreached() ||
+         (_latencyMicros && _stableLatencyMicros && *_latencyMicros < *_stableLatencyMicros));
+    if (limitsImproved && throughput <= _stableThroughput) {
+        auto concurrency = _readTicketHolder->outof() + _writeTicketHolder->outof();
+        auto newConcurrency = expMovingAverage(
+            _stableConcurrency, concurrency, gConcurrencyMovingAverageWeight.load());
+        auto oldStableConcurrency = _stableConcurrency;
+
+        _recordLimitedDecision();
+        _state = ProbingState::kStable;
+        _stableThroughput = throughput;
+        _stableConcurrency = newConcurrency;
+        _resetConcurrency();
+
+        _stats.timesDecreased.fetchAndAdd(1);
+        _stats.totalAmountDecreased.fetchAndAdd(oldStableConcurrency - _readTicketHolder->outof() -
+                                                _writeTicketHolder->outof());
+        return;
+    }
 
     if (throughput > _stableThroughput) {
         // Decreasing concurrency caused throughput to increase, so use this information to
@@ -278,6 +382,47 @@ void ThroughputProbing::_probeDown(double throughput) {
     }
 }
 
+void ThroughputProbing::_measureLatencyAndCachePressure() {
+    auto latencyCounts = combinedLatencyCounts(_readTicketHolder, _writeTicketHolder);
+    _latencyMicros =
+        latencyPercentile(_prevLatencyCounts, latencyCounts, gLatencyPercentile.load());
+
+    _cacheDirtyRatio = boost::none;
+    if (auto storageEngine = _svcCtx->getStorageEngine()) {
+        _cacheDirtyRatio = storageEngine->getEngine()->getCacheDirtyRatio();
+    }
+
+    _stats.latencyMicros.store(_latencyMicros.value_or(-1));
+    _stats.cacheDirtyRatio.store(_cacheDirtyRatio.value_or(-1));
+}
+
+namespace {
+bool latencyBreached(const boost::optional<int64_t>& latencyMicros) {
+    auto slo = gLatencySLOMicros.load();
+    return slo > 0 && latencyMicros && *latencyMicros > slo;
+}
+
+bool cachePressureBreached(const boost::optional<double>& cacheDirtyRatio) {
+    return gLatencySLOMicros.load() > 0 && cacheDirtyRatio &&
+        *cacheDirtyRatio > gMaxCacheDirtyRatio.load();
+}
+}  // namespace
+
+bool ThroughputProbing::_limitsBreached() const {
+    return latencyBreached(_latencyMicros) || cachePressureBreached(_cacheDirtyRatio);
+}
+
+void ThroughputProbing::_recordLimitedDecision() {
+    // Attribute the decision to whichever limit was breached, either by the probe or by the stable
+    // baseline it was compared against.
+    if (latencyBreached(_latencyMicros) || latencyBreached(_stableLatencyMicros)) {
+        _stats.timesLimitedByLatency.fetchAndAdd(1);
+    }
+    if (cachePressureBreached(_cacheDirtyRatio) || cachePressureBreached(_stableCacheDirtyRatio)) {
+        _stats.timesLimitedByCachePressure.fetchAndAdd(1);
+    }
+}
+
 void ThroughputProbing::_resize(TicketHolder* ticketholder, int newTickets) {
     Timer timer;
     auto finishedBefore = ticketholder->numFinishedProcessing();
@@ -374,6 +519,15 @@ void ThroughputProbing::Stats::serialize(BSONObjBuilder& builder) const {
     builder.append("totalAmountDecreased", static_cast<long long>(totalAmountDecreased.load()));
     builder.append("totalAmountIncreased", static_cast<long long>(totalAmountIncreased.load()));
     builder.append("resizeDurationMicros", static_cast<long long>(resizeDurationMicros.load()));
+
+    // The latency limit inputs are always reported, with -1 when there is no measurement, so that
+    // the shape of the section stays the same over time.
+    builder.append("latencySLOMicros", gLatencySLOMicros.load());
+    builder.append("latencyMicros", static_cast<long long>(latencyMicros.load()));
+    builder.append("cacheDirtyRatio", cacheDirtyRatio.load());
+    builder.append("timesLimitedByLatency", static_cast<long long>(timesLimitedByLatency.load()));
+    builder.append("timesLimitedByCachePressure",
+                   static_cast<long long>(timesLimitedByCachePressure.load()));
 }
 
 ThroughputProbingTicketHolderManager::ThroughputProbingTicketHolderManager(
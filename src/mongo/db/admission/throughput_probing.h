@@ -30,6 +30,7 @@
 #pragma once
 
 #include <cstdint>
+#include <vector>
 
 #include <boost/optional/optional.hpp>
 
@@ -59,6 +60,10 @@ Status validateMaxConcurrency(int32_t concurrency, const boost::optional<TenantI
  * Adjusts the level of concurrency on the read and write ticket holders by probing up/down and
  * attempting to maximize throughput. Assumes both ticket holders have the same starting
  * concurrency level and always keeps the same concurrency level for both.
+ *
+ * When a latency target is configured, the ticket hold time percentile and the storage engine
+ * cache dirty ratio are measured on each iteration as well. Probes which breach either limit are
+ * rejected, and concurrency is probed down for as long as the stable level breaches them.
  */
 class ThroughputProbing {
 public:
@@ -84,12 +89,30 @@ private:
     void _probeUp(double throughput);
     void _probeDown(double throughput);
 
+    /**
+     * Measures the ticket hold time percentile over the iteration and the cache dirty ratio.
+     */
+    void _measureLatencyAndCachePressure();
+
+    /**
+     * Whether the latest measurements breach the latency target or the cache dirty limit. Always
+     * false when no latency target is configured.
+     */
+    bool _limitsBreached() const;
+
+    /**
+     * Counts a probing decision which was changed because of the latency target or the cache
+     * dirty limit.
+     */
+    void _recordLimitedDecision();
+
     void _resetConcurrency();
     void _increaseConcurrency();
     void _decreaseConcurrency();
 
     void _resize(TicketHolder* ticketholder, int newTickets);
 
+    ServiceContext* _svcCtx;
     TicketHolder* _readTicketHolder;
     TicketHolder* _writeTicketHolder;
 
@@ -101,6 +124,15 @@ private:
 
     int64_t _prevNumFinishedProcessing = -1;
 
+    std::vector<int64_t> _prevLatencyCounts;
+    boost::optional<int64_t> _latencyMicros;
+    boost::optional<double> _cacheDirtyRatio;
+
+    // Measurements taken when the stable baseline was recorded.
+    boost::optional<int64_t> _stableLatencyMicros;
+    boost::optional<double> _stableCacheDirtyRatio;
+    bool _stableLimitsBreached = false;
+
     struct Stats {
         void serialize(BSONObjBuilder& builder) const;
 
@@ -109,6 +141,10 @@ private:
         AtomicWord<int64_t> totalAmountDecreased;
         AtomicWord<int64_t> totalAmountIncreased;
         AtomicWord<int64_t> resizeDurationMicros;
+        AtomicWord<int64_t> timesLimitedByLatency;
+        AtomicWord<int64_t> timesLimitedByCachePressure;
+        AtomicWord<int64_t> latencyMicros{-1};
+        AtomicWord<double> cacheDirtyRatio{-1};
     } _stats;
 
     PeriodicJobAnchor _job;
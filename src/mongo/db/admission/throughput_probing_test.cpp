@@ -31,8 +31,10 @@
 
 #include <cmath>
 #include <functional>
+#include <initializer_list>
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include <boost/move/utility_core.hpp>
 
@@ -431,6 +433,80 @@ TEST_F(ThroughputProbingTest, FixedTicketsStuckIsNotFatal) {
     }
 }
 
+// Returns cumulative ticket hold time counts with 'count' tickets in each of the given buckets.
+std::vector<int64_t> latencyCounts(std::initializer_list<std::pair<size_t, int64_t>> buckets) {
+    std::vector<int64_t> counts(TicketHolder::processingLatencyPartitions().size() + 1);
+    for (auto [bucket, count] : buckets) {
+        counts[bucket] = count;
+    }
+    return counts;
+}
+
+TEST_F(ThroughputProbingTest, ProbeUpRejectedByLatencySLO) {
+    const auto slo = TicketHolder::processingLatencyPartitions()[4];
+    gLatencySLOMicros.store(slo);
+    ON_BLOCK_EXIT([] { gLatencySLOMicros.store(0); });
+
+    // Tickets are exhausted and latency is within the target.
+    auto size = _readTicketHolder.outof();
+    _readTicketHolder.setPeakUsed(size);
+    _readTicketHolder.setNumFinishedProcessing(1);
+    _readTicketHolder.setProcessingLatencyCounts(latencyCounts({{2, 1}}));
+    _tick();
+
+    // Stable. Probe up next since tickets are exhausted.
+    _run();
+    ASSERT_GT(_readTicketHolder.outof(), size);
+    ASSERT_GT(_writeTicketHolder.outof(), size);
+
+    // Throughput increases, but the probed operations breach the latency target.
+    _readTicketHolder.setNumFinishedProcessing(3);
+    _readTicketHolder.setProcessingLatencyCounts(latencyCounts({{2, 1}, {8, 2}}));
+    _tick();
+
+    // Probing up is rejected and concurrency goes back to stable.
+    _run();
+    ASSERT_EQ(_readTicketHolder.outof(), size);
+    ASSERT_EQ(_writeTicketHolder.outof(), size);
+    ASSERT(_statsTester.concurrencyKept()) << _statsTester.toString();
+
+    BSONObjBuilder stats;
+    _throughputProbing.appendStats(stats);
+    ASSERT_EQ(stats.obj()["timesLimitedByLatency"].Long(), 1);
+}
+
+TEST_F(ThroughputProbingTest, LatencySLOBreachProbesDown) {
+    const auto slo = TicketHolder::processingLatencyPartitions()[4];
+    gLatencySLOMicros.store(slo);
+    ON_BLOCK_EXIT([] { gLatencySLOMicros.store(0); });
+
+    // Tickets are exhausted, but latency breaches the target.
+    auto initialSize = _readTicketHolder.outof();
+    auto size = initialSize;
+    _readTicketHolder.setPeakUsed(size);
+    _readTicketHolder.setNumFinishedProcessing(1);
+    _readTicketHolder.setProcessingLatencyCounts(latencyCounts({{8, 1}}));
+    _tick();
+
+    // Stable. Probe down next since the latency target is breached.
+    _run();
+    ASSERT_LT(_readTicketHolder.outof(), size);
+    ASSERT_LT(_writeTicketHolder.outof(), size);
+
+    // Throughput stays the same, but latency is back within the target.
+    size = _readTicketHolder.outof();
+    _readTicketHolder.setNumFinishedProcessing(2);
+    _readTicketHolder.setProcessingLatencyCounts(latencyCounts({{8, 1}, {2, 1}}));
+    _tick();
+
+    // Probing down is kept; the new value is somewhere between the initial value and the
+    // probed-down value.
+    _run();
+    ASSERT_LT(_readTicketHolder.outof(), initialSize);
+    ASSERT_GT(_readTicketHolder.outof(), size);
+    ASSERT(_statsTester.concurrencyDecreased()) << _statsTester.toString();
+}
+
 TEST_F(ThroughputProbingReadHeavyTest, StepSizeNonZeroIncreasing) {
     auto reads = _readTicketHolder.outof();
     auto writes = _writeTicketHolder.outof();
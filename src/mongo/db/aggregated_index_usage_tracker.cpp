@@ -120,7 +120,7 @@ AggregatedIndexUsageTracker* AggregatedIndexUsageTracker::get(ServiceContext* sv
 
 void AggregatedIndexUsageTracker::onAccess(const IndexFeatures& features) const {
     if (!features.internal) {
-        _updateStatsForEachFeature(features, [](auto stats) { stats->accesses.fetchAndAdd(1); });
+        _updateStatsForEachFeature(features, [](auto stats) { stats->accesses.increment(); });
     }
 }
 
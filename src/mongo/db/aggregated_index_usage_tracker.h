@@ -29,12 +29,17 @@
 
 #pragma once
 
+#include <array>
 #include <functional>
 #include <map>
+#include <memory>
 #include <string>
+#include <thread>
 
 #include "mongo/db/index_names.h"
 #include "mongo/platform/atomic_word.h"
+#include "mongo/stdx/thread.h"
+#include "mongo/util/aligned.h"
 
 namespace mongo {
 class IndexDescriptor;
@@ -65,14 +70,79 @@ struct IndexFeatures {
 };
 
 /**
- * IndexFeatureStats holds statistics about a specific index feature. Its data members are mutable
- * atomics to allow itself to be used in a const map safely.
+ * IndexAccessCounter counts the operations that used an index. Every query on a hot index
+ * increments the same counter, so increments are spread over cache-line-sized stripes picked by
+ * thread, and reads sum the stripes. The stripes are only allocated on the first increment, so
+ * indexes that are never used do not pay for them.
+ */
+class IndexAccessCounter {
+public:
+    IndexAccessCounter() = default;
+
+    IndexAccessCounter(const IndexAccessCounter& other) : _base(other.load()) {}
+
+    IndexAccessCounter& operator=(const IndexAccessCounter& other) {
+        const auto value = other.load();
+        if (auto stripes = _stripes.load()) {
+            for (auto& stripe : *stripes) {
+                stripe->store(0);
+            }
+        }
+        _base.store(value);
+        return *this;
+    }
+
+    ~IndexAccessCounter() {
+        delete _stripes.load();
+    }
+
+    void increment() const {
+        auto stripes = _stripes.load();
+        if (!stripes) {
+            stripes = _allocateStripes();
+        }
+        (*stripes)[std::hash<std::thread::id>{}(stdx::this_thread::get_id()) % kNumStripes]
+            ->fetchAndAddRelaxed(1);
+    }
+
+    long long load() const {
+        auto sum = _base.load();
+        if (auto stripes = _stripes.load()) {
+            for (const auto& stripe : *stripes) {
+                sum += stripe->loadRelaxed();
+            }
+        }
+        return sum;
+    }
+
+private:
+    static constexpr size_t kNumStripes = 16;
+    using Stripes = std::array<CacheExclusive<AtomicWord<long long>>, kNumStripes>;
+
+    Stripes* _allocateStripes() const {
+        auto stripes = std::make_unique<Stripes>();
+        Stripes* expected = nullptr;
+        if (_stripes.compareAndSwap(&expected, stripes.get())) {
+            return stripes.release();
+        }
+        // Another thread installed its stripes first.
+        return expected;
+    }
+
+    // Holds the value a counter was copied or assigned from.
+    AtomicWord<long long> _base{0};
+    mutable AtomicWord<Stripes*> _stripes{nullptr};
+};
+
+/**
+ * IndexFeatureStats holds statistics about a specific index feature. Its data members can be updated
+ * through a const reference to allow itself to be used in a const map safely.
  */
 struct IndexFeatureStats {
     // Number of indexes that have this feature.
     mutable AtomicWord<long long> count{0};
     // Number of operations that have used indexes with this feature.
-    mutable AtomicWord<long long> accesses{0};
+    IndexAccessCounter accesses;
 };
 
 /**
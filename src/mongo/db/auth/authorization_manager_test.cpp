@@ -56,6 +56,7 @@
 #include "mongo/db/client.h"
 #include "mongo/db/namespace_string.h"
 #include "mongo/db/service_context_test_fixture.h"
+#include "mongo/idl/server_parameter_test_util.h"
 #include "mongo/platform/atomic_word.h"
 #include "mongo/transport/session.h"
 #include "mongo/transport/transport_layer_mock.h"
@@ -400,5 +401,120 @@ TEST_F(AuthorizationManagerTest, testRefreshExternalV2User) {
     }
 }
 
+class AuthorizationManagerResolvedRolesTest : public AuthorizationManagerTest {
+public:
+    // Inserts a user on db test granted the role 'role' on db test.
+    void insertUser(StringData user, StringData role) {
+        ASSERT_OK(externalState->insertPrivilegeDocument(
+            opCtx.get(),
+            BSON("_id" << "test." + user << "user" << user << "db"
+                       << "test"
+                       << "credentials" << credentials << "roles"
+                       << BSON_ARRAY(BSON("role" << role << "db"
+                                                 << "test"))),
+            BSONObj()));
+    }
+
+    // Inserts a role on db test granting 'actions' on db test.
+    void insertRole(StringData role, const BSONArray& actions) {
+        ASSERT_OK(externalState->insert(opCtx.get(),
+                                        NamespaceString::kAdminRolesNamespace,
+                                        BSON("_id" << "test." + role << "role" << role << "db"
+                                                   << "test"
+                                                   << "roles" << BSONArray() << "privileges"
+                                                   << makePrivileges(actions)),
+                                        BSONObj()));
+    }
+
+    void setRoleActions(StringData role, const BSONArray& actions) {
+        ASSERT_OK(externalState->updateOne(
+            opCtx.get(),
+            NamespaceString::kAdminRolesNamespace,
+            BSON("_id" << "test." + role),
+            BSON("$set" << BSON("privileges" << makePrivileges(actions))),
+            false,
+            BSONObj()));
+    }
+
+    // Acquires the user on db test and returns the actions it is granted on db test.
+    ActionSet acquireUserActions(StringData user) {
+        auto swu = authzManager->acquireUser(opCtx.get(), {{user, "test"}, boost::none});
+        ASSERT_OK(swu.getStatus());
+        auto privileges = swu.getValue()->getPrivileges();
+        return privileges[kTestRsrc].getActions();
+    }
+
+private:
+    static BSONArray makePrivileges(const BSONArray& actions) {
+        return BSON_ARRAY(BSON("resource" << BSON("db"
+                                                  << "test"
+                                                  << "collection"
+                                                  << "")
+                                          << "actions" << actions));
+    }
+};
+
+TEST_F(AuthorizationManagerResolvedRolesTest, UsersWithTheSameRolesShareTheResolvedRoles) {
+    insertRole("r1", BSON_ARRAY("find"));
+    insertUser("u1", "r1");
+    insertUser("u2", "r1");
+    ASSERT_FALSE(acquireUserActions("u1").contains(ActionType::insert));
+
+    // The role document is changed without reporting the write, so only a user whose roles are
+    // resolved again can see the change.
+    setRoleActions("r1", BSON_ARRAY("find" << "insert"));
+    ASSERT_FALSE(acquireUserActions("u2").contains(ActionType::insert));
+
+    authzManager->invalidateUserCache();
+    ASSERT_TRUE(acquireUserActions("u2").contains(ActionType::insert));
+}
+
+TEST_F(AuthorizationManagerResolvedRolesTest, RoleChangesInvalidateTheResolvedRoles) {
+    externalState->setAuthorizationManager(authzManager);
+    insertRole("r1", BSON_ARRAY("find"));
+    insertUser("u1", "r1");
+    ASSERT_FALSE(acquireUserActions("u1").contains(ActionType::insert));
+
+    // Grant.
+    setRoleActions("r1", BSON_ARRAY("find" << "insert"));
+    ASSERT_TRUE(acquireUserActions("u1").contains(ActionType::insert));
+
+    // Revoke.
+    setRoleActions("r1", BSON_ARRAY("find"));
+    auto actions = acquireUserActions("u1");
+    ASSERT_TRUE(actions.contains(ActionType::find));
+    ASSERT_FALSE(actions.contains(ActionType::insert));
+
+    // Drop.
+    int numRemoved;
+    ASSERT_OK(externalState->remove(opCtx.get(),
+                                    NamespaceString::kAdminRolesNamespace,
+                                    BSON("_id" << "test.r1"),
+                                    BSONObj(),
+                                    &numRemoved));
+    ASSERT_EQ(1, numRemoved);
+    ASSERT_TRUE(acquireUserActions("u1").empty());
+}
+
+TEST_F(AuthorizationManagerResolvedRolesTest, LeastRecentlyUsedResolvedRolesAreEvicted) {
+    RAIIServerParameterControllerForTest cacheSize("authorizationManagerResolvedRolesCacheSize",
+                                                   1);
+    insertRole("r1", BSON_ARRAY("find"));
+    insertRole("r2", BSON_ARRAY("find"));
+    insertUser("u1", "r1");
+    insertUser("u2", "r2");
+    insertUser("u3", "r1");
+    insertUser("u4", "r2");
+    ASSERT_FALSE(acquireUserActions("u1").contains(ActionType::insert));
+    ASSERT_FALSE(acquireUserActions("u2").contains(ActionType::insert));
+
+    // The role documents are changed without reporting the writes. The graph of r2 is still
+    // cached, while the graph of r1 made room for it and is resolved again.
+    setRoleActions("r1", BSON_ARRAY("find" << "insert"));
+    setRoleActions("r2", BSON_ARRAY("find" << "insert"));
+    ASSERT_FALSE(acquireUserActions("u4").contains(ActionType::insert));
+    ASSERT_TRUE(acquireUserActions("u3").contains(ActionType::insert));
+}
+
 }  // namespace
 }  // namespace mongo
@@ -48,6 +48,7 @@
 #include "mongo/db/auth/address_restriction.h"
 #include "mongo/db/auth/auth_name.h"
 #include "mongo/db/auth/auth_types_gen.h"
+#include "mongo/db/auth/authorization_manager_impl_parameters_gen.h"
 #include "mongo/db/auth/authz_manager_external_state_local.h"
 #include "mongo/db/auth/builtin_roles.h"
 #include "mongo/db/auth/parsed_privilege_gen.h"
@@ -78,6 +79,7 @@ using namespace fmt::literals;
 
 using std::vector;
 using ResolveRoleOption = AuthzManagerExternalStateLocal::ResolveRoleOption;
+using ResolvedRoleData = AuthzManagerExternalState::ResolvedRoleData;
 
 Status AuthzManagerExternalStateLocal::hasValidStoredAuthorizationVersion(
     OperationContext* opCtx, BSONObj* foundVersionDoc) {
@@ -335,6 +337,9 @@ StatusWith<User> AuthzManagerExternalStateLocal::getUserObject(
     std::vector<RoleName> directRoles;
     User user(userReq);
 
+    // Read before taking the roles lock or opening the read snapshot, see _resolveRolesForUser().
+    const auto generation = AuthorizationManager::get(opCtx->getService())->getCacheGeneration();
+
     auto rolesLock = _lockRoles(opCtx, userName.getTenant());
 
     if (!userReq.roles) {
@@ -378,7 +383,7 @@ StatusWith<User> AuthzManagerExternalStateLocal::getUserObject(
 
     handleAuthLocalGetUserFailPoint(directRoles);
 
-    auto data = uassertStatusOK(resolveRoles(opCtx, directRoles, ResolveRoleOption::kAll));
+    auto data = _resolveRolesForUser(opCtx, directRoles, generation);
     data.roles->insert(directRoles.cbegin(), directRoles.cend());
     user.setIndirectRoles(makeRoleNameIteratorForContainer(data.roles.value()));
     user.addPrivileges(data.privileges.value());
@@ -395,6 +400,42 @@ StatusWith<User> AuthzManagerExternalStateLocal::getUserObject(
     return ex.toStatus();
 }
 
+ResolvedRoleData AuthzManagerExternalStateLocal::_resolveRolesForUser(
+    OperationContext* opCtx, const std::vector<RoleName>& directRoles, const OID& generation) {
+    const auto maxEntries = static_cast<size_t>(gAuthorizationManagerResolvedRolesCacheSize);
+    if (maxEntries == 0) {
+        return uassertStatusOK(resolveRoles(opCtx, directRoles, ResolveRoleOption::kAll));
+    }
+
+    std::set<RoleName> key(directRoles.cbegin(), directRoles.cend());
+    {
+        stdx::lock_guard lk(_resolvedRolesCache.mutex);
+        if (_resolvedRolesCache.generation == generation) {
+            if (auto it = _resolvedRolesCache.entries.find(key);
+                it != _resolvedRolesCache.entries.end()) {
+                return it->second;
+            }
+        }
+    }
+
+    auto data = uassertStatusOK(resolveRoles(opCtx, directRoles, ResolveRoleOption::kAll));
+
+    // The data was read no earlier than 'generation' was current. If the generation has moved on
+    // since, the data may already be stale and must not be cached.
+    if (AuthorizationManager::get(opCtx->getService())->getCacheGeneration() != generation) {
+        return data;
+    }
+
+    stdx::lock_guard lk(_resolvedRolesCache.mutex);
+    if (_resolvedRolesCache.generation != generation) {
+        _resolvedRolesCache.entries = ResolvedRolesCache::Entries(maxEntries);
+        _resolvedRolesCache.generation = generation;
+    }
+    // Once full, the least recently used graph makes room for the new one.
+    _resolvedRolesCache.entries.add(std::move(key), data);
+    return data;
+}
+
 Status AuthzManagerExternalStateLocal::getUserDescription(
     OperationContext* opCtx,
     const UserRequest& userReq,
@@ -478,7 +519,6 @@ Status AuthzManagerExternalStateLocal::rolesExist(OperationContext* opCtx,
     return Status::OK();
 }
 
-using ResolvedRoleData = AuthzManagerExternalState::ResolvedRoleData;
 StatusWith<ResolvedRoleData> AuthzManagerExternalStateLocal::resolveRoles(
     OperationContext* opCtx, const std::vector<RoleName>& roleNames, ResolveRoleOption option) try {
     using RoleNameSet = typename decltype(ResolvedRoleData::roles)::value_type;
@@ -32,6 +32,7 @@
 #include <boost/optional/optional.hpp>
 #include <functional>
 #include <memory>
+#include <set>
 #include <string>
 #include <vector>
 
@@ -55,6 +56,7 @@
 #include "mongo/db/tenant_id.h"
 #include "mongo/platform/atomic_word.h"
 #include "mongo/platform/mutex.h"
+#include "mongo/util/lru_cache.h"
 
 namespace mongo {
 
@@ -178,6 +180,31 @@ protected:
     virtual RolesLocks _lockRoles(OperationContext* opCtx, const boost::optional<TenantId>&);
 
 private:
+    /**
+     * Resolves the full role graph for a user's direct roles, consulting '_resolvedRolesCache'
+     * first. 'generation' must be the AuthorizationManager cache generation read before any data
+     * for this acquisition was read, so that a cached graph is never newer than its generation.
+     */
+    ResolvedRoleData _resolveRolesForUser(OperationContext* opCtx,
+                                          const std::vector<RoleName>& directRoles,
+                                          const OID& generation);
+
+    /**
+     * Role graphs resolved by getUserObject(), keyed on the set of direct roles they were resolved
+     * from. Entries are only valid for the AuthorizationManager cache generation they were
+     * resolved under, which changes whenever users or roles are invalidated. The entries are
+     * recreated, with the configured capacity, each time the generation changes.
+     */
+    struct ResolvedRolesCache {
+        using Entries = LRUCache<std::set<RoleName>, ResolvedRoleData>;
+
+        Mutex mutex =
+            MONGO_MAKE_LATCH("AuthzManagerExternalStateLocal::ResolvedRolesCache::mutex");
+        OID generation;
+        Entries entries{0};
+    };
+    ResolvedRolesCache _resolvedRolesCache;
+
     /**
      * Once *any* privilege document is observed we cache the state forever,
      * even if these collections are emptied/dropped.
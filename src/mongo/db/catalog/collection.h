@@ -226,6 +226,14 @@ public:
          * Note: this is shared state across cloned Collection instances
          */
         StatusWith<std::shared_ptr<MatchExpression>> filter = {nullptr};
+
+        /**
+         * An optimized copy of 'filter', used to decide whether a document passes validation.
+         * It is null if 'filter' is null or could not be optimized, in which case 'filter' is
+         * used. Errors are always generated from 'filter', as optimization can drop the
+         * annotations needed to explain a validation failure.
+         */
+        std::shared_ptr<MatchExpression> optimizedFilter;
     };
 
     Collection() = default;
@@ -110,6 +110,10 @@ constexpr auto kNumDurableCatalogScansDueToMissingMapping = "numScansDueToMissin
 
 struct LatestCollectionCatalog {
     std::shared_ptr<CollectionCatalog> catalog = std::make_shared<CollectionCatalog>();
+
+    // Incremented after every publication of a new 'catalog', so readers can tell whether the
+    // instance they cached is still the latest one without loading 'catalog'.
+    AtomicWord<uint64_t> version;
 };
 const ServiceContext::Decoration<LatestCollectionCatalog> getCatalog =
     ServiceContext::declareDecoration<LatestCollectionCatalog>();
@@ -128,6 +132,20 @@ CollectionCatalog::BatchedCollectionWrite* ongoingBatchedWOUWCollectionWrite = n
 const RecoveryUnit::Snapshot::Decoration<std::shared_ptr<const CollectionCatalog>> stashedCatalog =
     RecoveryUnit::Snapshot::declareDecoration<std::shared_ptr<const CollectionCatalog>>();
 
+/**
+ * Latest catalog instance handed out to the operation owning the storage snapshot. Every call to
+ * 'CollectionCatalog::get' would otherwise do an 'atomic_load' of the shared instance and bump its
+ * reference count, a cache line that all the operations in the system fight over. The cached
+ * pointer has a control block of its own that only this operation touches, and is dropped together
+ * with the snapshot so it doesn't hold on to old catalog instances.
+ */
+struct CachedLatestCatalog {
+    uint64_t version = 0;
+    std::shared_ptr<const CollectionCatalog> catalog;
+};
+const RecoveryUnit::Snapshot::Decoration<CachedLatestCatalog> cachedLatestCatalog =
+    RecoveryUnit::Snapshot::declareDecoration<CachedLatestCatalog>();
+
 /**
  * Returns true if the collection is compatible with the read timestamp.
  */
@@ -658,7 +676,18 @@ std::shared_ptr<const CollectionCatalog> CollectionCatalog::latest(OperationCont
         return batchedCatalogWriteInstance;
     }
 
-    return latest(opCtx->getServiceContext());
+    // Loading the version before the instance can only pair an older version with a newer
+    // instance, which is re-validated on the next call.
+    auto& storage = getCatalog(opCtx->getServiceContext());
+    auto version = storage.version.load();
+    auto& cached = cachedLatestCatalog(shard_role_details::getRecoveryUnit(opCtx)->getSnapshot());
+    if (!cached.catalog || cached.version != version) {
+        auto shared = std::make_shared<std::shared_ptr<const CollectionCatalog>>(
+            atomic_load(&storage.catalog));
+        cached.catalog = std::shared_ptr<const CollectionCatalog>(shared, shared->get());
+        cached.version = version;
+    }
+    return cached.catalog;
 }
 
 void CollectionCatalog::stash(OperationContext* opCtx,
@@ -769,6 +798,7 @@ void CollectionCatalog::write(ServiceContext* svcCtx, CatalogWriteFn job) {
         if (queue.empty()) {
             // Queue is empty, store catalog and relinquish responsibility of being worker thread
             atomic_store(&storage.catalog, std::move(clone));
+            storage.version.fetchAndAdd(1);
             workerExists = false;
             break;
         }
@@ -2520,6 +2550,7 @@ BatchedCollectionCatalogWriter::~BatchedCollectionCatalogWriter() {
     auto& storage = getCatalog(_opCtx->getServiceContext());
     invariant(
         atomic_compare_exchange_strong(&storage.catalog, &_base, batchedCatalogWriteInstance));
+    storage.version.fetchAndAdd(1);
 
     // Clear out batched pointer so no more attempts of batching are made
     ongoingBatchedWrite.store(false);
@@ -144,6 +144,9 @@ public:
      * Returns a CollectionCatalog instance that reflects the latest state of the server.
      *
      * Used to confirm whether Collection instances are write eligiable.
+     *
+     * The instance is cached on the RecoveryUnit snapshot, so repeated calls by the same operation
+     * don't contend on the reference count of the instance shared by all operations.
      */
     static std::shared_ptr<const CollectionCatalog> latest(OperationContext* opCtx);
 
@@ -33,6 +33,7 @@
 #include <mutex>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include <boost/move/utility_core.hpp>
 #include <boost/none.hpp>
@@ -48,7 +49,11 @@
 #include "mongo/db/namespace_string.h"
 #include "mongo/db/operation_context.h"
 #include "mongo/db/service_context.h"
+#include "mongo/db/storage/recovery_unit.h"
 #include "mongo/db/tenant_id.h"
+#include "mongo/db/transaction_resources.h"
+#include "mongo/platform/atomic_word.h"
+#include "mongo/stdx/thread.h"
 #include "mongo/util/assert_util_core.h"
 #include "mongo/util/uuid.h"
 
@@ -217,6 +222,82 @@ void BM_CollectionCatalogLookupCollectionByUUID(benchmark::State& state) {
     }
 }
 
+void BM_CollectionCatalogGetWithConcurrentReaders(benchmark::State& state) {
+    auto serviceContext = setupServiceContext();
+    ThreadClient threadClient(serviceContext->getService());
+    ServiceContext::UniqueOperationContext opCtx = threadClient->makeOperationContext();
+
+    createCollections(opCtx.get(), 1000);
+
+    // Each iteration models an operation that acquires the catalog a few times within a single
+    // storage snapshot, while other threads do the same in the background.
+    constexpr int kGetsPerOperation = 4;
+    auto runOperation = [](OperationContext* opCtx) {
+        shard_role_details::getRecoveryUnit(opCtx)->abandonSnapshot();
+        for (int i = 0; i < kGetsPerOperation; ++i) {
+            benchmark::DoNotOptimize(CollectionCatalog::get(opCtx));
+        }
+    };
+
+    AtomicWord<bool> done{false};
+    std::vector<stdx::thread> readers;
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        readers.emplace_back([&] {
+            ThreadClient readerClient(serviceContext->getService());
+            auto readerOpCtx = readerClient->makeOperationContext();
+            while (!done.load()) {
+                runOperation(readerOpCtx.get());
+            }
+        });
+    }
+
+    for (auto _ : state) {
+        benchmark::ClobberMemory();
+        runOperation(opCtx.get());
+    }
+
+    done.store(true);
+    for (auto& reader : readers) {
+        reader.join();
+    }
+}
+
+void BM_CollectionCatalogCreateDropCollectionWhileReading(benchmark::State& state) {
+    auto serviceContext = setupServiceContext();
+    ThreadClient threadClient(serviceContext->getService());
+    ServiceContext::UniqueOperationContext opCtx = threadClient->makeOperationContext();
+
+    createCollections(opCtx.get(), state.range(0));
+
+    // Readers keep older catalog instances alive, so a DDL only pays for the parts of the catalog
+    // that it modifies as long as the copy is structurally shared with the instance it replaces.
+    AtomicWord<bool> done{false};
+    stdx::thread reader([&] {
+        ThreadClient readerClient(serviceContext->getService());
+        auto readerOpCtx = readerClient->makeOperationContext();
+        while (!done.load()) {
+            shard_role_details::getRecoveryUnit(readerOpCtx.get())->abandonSnapshot();
+            benchmark::DoNotOptimize(CollectionCatalog::get(readerOpCtx.get()));
+        }
+    });
+
+    Lock::GlobalLock globalLk(opCtx.get(), MODE_X);
+    for (auto _ : state) {
+        benchmark::ClobberMemory();
+        CollectionCatalog::write(opCtx.get(), [&](CollectionCatalog& catalog) {
+            const NamespaceString nss = NamespaceString::createNamespaceString_forTest(
+                "collection_catalog_bm", std::to_string(state.range(0)));
+            const UUID uuid = UUID::gen();
+            catalog.registerCollection(
+                opCtx.get(), std::make_shared<CollectionMock>(uuid, nss), boost::none);
+            catalog.deregisterCollection(opCtx.get(), uuid, false, boost::none);
+        });
+    }
+
+    done.store(true);
+    reader.join();
+}
+
 void BM_CollectionCatalogIterateCollections(benchmark::State& state) {
     auto serviceContext = setupServiceContext();
     ThreadClient threadClient(serviceContext->getService());
@@ -243,5 +324,7 @@ BENCHMARK(BM_CollectionCatalogCreateNCollections)->Ranges({{{1}, {32'768}}});
 BENCHMARK(BM_CollectionCatalogLookupCollectionByNamespace)->Ranges({{{1}, {100'000}}});
 BENCHMARK(BM_CollectionCatalogLookupCollectionByUUID)->Ranges({{{1}, {100'000}}});
 BENCHMARK(BM_CollectionCatalogIterateCollections)->Ranges({{{1}, {100'000}}});
+BENCHMARK(BM_CollectionCatalogGetWithConcurrentReaders)->DenseRange(0, 8, 4);
+BENCHMARK(BM_CollectionCatalogCreateDropCollectionWhileReading)->Ranges({{{1}, {150'000}}});
 
 }  // namespace mongo
@@ -558,6 +558,24 @@ TEST_F(CollectionCatalogTest, CollectionCatalogEpoch) {
     ASSERT_EQ(originalEpoch + 1, incrementedEpoch);
 }
 
+TEST_F(CollectionCatalogTest, LatestIsCachedUntilTheCatalogChanges) {
+    auto first = CollectionCatalog::latest(opCtx.get());
+    ASSERT_EQ(first.get(), CollectionCatalog::latest(opCtx.get()).get());
+    ASSERT_EQ(first.get(), CollectionCatalog::latest(getServiceContext()).get());
+
+    // A write publishes a new instance, which is picked up without opening a new snapshot.
+    CollectionCatalog::write(opCtx.get(), [](CollectionCatalog&) {});
+    auto second = CollectionCatalog::latest(opCtx.get());
+    ASSERT_NE(first.get(), second.get());
+    ASSERT_EQ(second.get(), CollectionCatalog::latest(getServiceContext()).get());
+
+    // The cached instance goes away with the snapshot.
+    std::weak_ptr<const CollectionCatalog> weakFirst = first;
+    first.reset();
+    shard_role_details::getRecoveryUnit(opCtx.get())->abandonSnapshot();
+    ASSERT_TRUE(weakFirst.expired());
+}
+
 TEST_F(CollectionCatalogTest, GetAllCollectionNamesAndGetAllDbNames) {
     NamespaceString aColl = NamespaceString::createNamespaceString_forTest("dbA", "collA");
     NamespaceString b1Coll = NamespaceString::createNamespaceString_forTest("dbB", "collB1");
@@ -618,7 +618,9 @@ std::pair<Collection::SchemaValidationResult, Status> CollectionImpl::checkValid
     }
 
     try {
-        if (validatorMatchExpr->matchesBSON(document))
+        const auto* const matchExprToEvaluate =
+            _validator.optimizedFilter ? _validator.optimizedFilter.get() : validatorMatchExpr;
+        if (matchExprToEvaluate->matchesBSON(document))
             return {SchemaValidationResult::kPass, Status::OK()};
     } catch (DBException&) {
     };
@@ -754,7 +756,22 @@ Collection::Validator CollectionImpl::parseValidator(
                 "Combined match expression",
                 "expression"_attr = combinedMatchExpr->serialize());
 
-    return Collection::Validator{validator, std::move(expCtx), std::move(combinedMatchExpr)};
+    // Validators are evaluated on every write to the collection, so evaluate an optimized copy of
+    // the validator instead of the tree as parsed. The parsed tree is kept to generate errors.
+    std::unique_ptr<MatchExpression> optimizedMatchExpr;
+    try {
+        optimizedMatchExpr = MatchExpression::optimize(combinedMatchExpr->clone(),
+                                                       /* enableSimplification */ false);
+    } catch (const DBException& ex) {
+        LOGV2_DEBUG(9156653,
+                    2,
+                    "Failed to optimize collection validator, using it as parsed",
+                    logAttrs(ns()),
+                    "error"_attr = ex.toStatus());
+    }
+
+    return Collection::Validator{
+        validator, std::move(expCtx), std::move(combinedMatchExpr), std::move(optimizedMatchExpr)};
 }
 
 bool CollectionImpl::needsCappedLock() const {
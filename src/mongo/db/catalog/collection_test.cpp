@@ -432,6 +432,47 @@ TEST_F(CollectionTest, VerifyIndexIsUpdatedWithDamages) {
     ASSERT_EQ(indexRecordId, oldRecordId);
 }
 
+TEST_F(CollectionTest, VerifyIndexIsUpdatedForBatchInsert) {
+    NamespaceString nss = NamespaceString::createNamespaceString_forTest("test.t");
+    auto indexName = "myindex"_sd;
+    makeCollectionForMultikey(nss, indexName);
+
+    auto opCtx = operationContext();
+    AutoGetCollection autoColl(opCtx, nss, MODE_IX);
+    const auto& coll = autoColl.getCollection();
+
+    // Insert in descending key order so that the keys for the batch arrive out of order. Only the
+    // last document is multikey.
+    const int numDocs = 10;
+    std::vector<InsertStatement> inserts;
+    for (int i = 0; i < numDocs - 1; ++i) {
+        inserts.emplace_back(BSON("_id" << i << "a" << numDocs - i));
+    }
+    inserts.emplace_back(BSON("_id" << numDocs - 1 << "a" << BSON_ARRAY(1 << 100)));
+    {
+        WriteUnitOfWork wuow(opCtx);
+        ASSERT_OK(collection_internal::insertDocuments(
+            opCtx, coll, inserts.begin(), inserts.end(), nullptr));
+        wuow.commit();
+    }
+
+    auto idxCatalog = coll->getIndexCatalog();
+    auto idIndex = idxCatalog->findIdIndex(opCtx);
+    auto userIdx = idxCatalog->findIndexByName(opCtx, indexName);
+    for (int i = 0; i < numDocs; ++i) {
+        auto recordId = idIndex->getEntry()->accessMethod()->asSortedData()->findSingle(
+            opCtx, coll, idIndex->getEntry(), BSON("_id" << i));
+        ASSERT_FALSE(recordId.isNull());
+        auto indexRecordId = userIdx->getEntry()->accessMethod()->asSortedData()->findSingle(
+            opCtx, coll, userIdx->getEntry(), BSON("a" << (i == numDocs - 1 ? 100 : numDocs - i)));
+        ASSERT_EQ(recordId, indexRecordId);
+    }
+
+    MultikeyPaths paths;
+    ASSERT_TRUE(coll->isIndexMultikey(opCtx, indexName, &paths));
+    ASSERT(paths == MultikeyPaths{{0}});
+}
+
 TEST_F(CollectionTest, SetIndexIsMultikey) {
     NamespaceString nss = NamespaceString::createNamespaceString_forTest("test.t");
     auto indexName = "myindex"_sd;
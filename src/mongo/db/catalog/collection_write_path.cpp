@@ -57,6 +57,7 @@
 #include "mongo/db/concurrency/d_concurrency.h"
 #include "mongo/db/concurrency/exception_util.h"
 #include "mongo/db/concurrency/lock_manager_defs.h"
+#include "mongo/db/concurrency/write_conflict_hot_records.h"
 #include "mongo/db/exec/document_value/document.h"
 #include "mongo/db/exec/write_stage_common.h"
 #include "mongo/db/feature_flag.h"
@@ -132,6 +133,20 @@ bool compareSafeContentElem(const BSONObj& oldDoc, const BSONObj& newDoc) {
     return newDoc.getField(kSafeContent).binaryEqual(oldDoc.getField(kSafeContent));
 }
 
+/**
+ * Runs 'f', which writes the record 'recordId' of 'collection', and samples the record into the
+ * write conflict hot records report if the write fails with a write conflict.
+ */
+template <typename F>
+auto sampleWriteConflicts(const CollectionPtr& collection, const RecordId& recordId, F&& f) {
+    try {
+        return f();
+    } catch (const ExceptionFor<ErrorCodes::WriteConflict>&) {
+        WriteConflictHotRecords::get().onWriteConflict(collection->ns(), recordId);
+        throw;
+    }
+}
+
 std::vector<OplogSlot> reserveOplogSlotsForRetryableFindAndModify(OperationContext* opCtx) {
     // For retryable findAndModify running in a multi-document transaction, we will reserve the
     // oplog entries when the transaction prepares or commits without prepare.
@@ -679,8 +694,10 @@ void updateDocument(OperationContext* opCtx,
         invariant(!(args->retryableWrite && setNeedsRetryImageOplogField));
     }
 
-    uassertStatusOK(collection->getRecordStore()->updateRecord(
-        opCtx, oldLocation, newDoc.objdata(), newDoc.objsize()));
+    uassertStatusOK(sampleWriteConflicts(collection, oldLocation, [&] {
+        return collection->getRecordStore()->updateRecord(
+            opCtx, oldLocation, newDoc.objdata(), newDoc.objsize());
+    }));
 
     // don't update the indexes if kUpdateNoIndexes has been specified.
     if (opDiff != kUpdateNoIndexes) {
@@ -760,8 +777,10 @@ StatusWith<BSONObj> updateDocumentWithDamages(OperationContext* opCtx,
     }
 
     RecordData oldRecordData(oldDoc.value().objdata(), oldDoc.value().objsize());
-    StatusWith<RecordData> recordData = collection->getRecordStore()->updateWithDamages(
-        opCtx, loc, oldRecordData, damageSource, damages);
+    StatusWith<RecordData> recordData = sampleWriteConflicts(collection, loc, [&] {
+        return collection->getRecordStore()->updateWithDamages(
+            opCtx, loc, oldRecordData, damageSource, damages);
+    });
     if (!recordData.isOK())
         return recordData.getStatus();
     BSONObj newDoc = std::move(recordData.getValue()).releaseToBson().getOwned();
@@ -886,7 +905,8 @@ void deleteDocument(OperationContext* opCtx,
                     "recordId"_attr = loc,
                     "doc"_attr = doc.value().toString());
     } else {
-        collection->getRecordStore()->deleteRecord(opCtx, loc);
+        sampleWriteConflicts(
+            collection, loc, [&] { collection->getRecordStore()->deleteRecord(opCtx, loc); });
     }
 
     opCtx->getServiceContext()->getOpObserver()->onDelete(
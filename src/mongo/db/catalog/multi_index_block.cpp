@@ -72,6 +72,7 @@
 #include "mongo/db/repl/tenant_migration_conflict_info.h"
 #include "mongo/db/server_options.h"
 #include "mongo/db/service_context.h"
+#include "mongo/db/sorter/sorter_worker_pool.h"
 #include "mongo/db/storage/ident.h"
 #include "mongo/db/storage/key_format.h"
 #include "mongo/db/storage/key_string.h"
@@ -91,6 +92,8 @@
 #include "mongo/logv2/redaction.h"
 #include "mongo/platform/atomic_word.h"
 #include "mongo/platform/compiler.h"
+#include "mongo/platform/mutex.h"
+#include "mongo/stdx/condition_variable.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/concurrency/with_lock.h"
 #include "mongo/util/decorable.h"
@@ -118,6 +121,10 @@ MONGO_FAIL_POINT_DEFINE(leaveIndexBuildUnfinishedForShutdown);
 
 namespace {
 
+// The number of documents whose keys each thread generates at once when key generation is spread
+// among several threads by 'indexBuildKeyGenerationThreads'.
+constexpr size_t kKeyGenerationDocsPerThread = 256;
+
 size_t getEachIndexBuildMaxMemoryUsageBytes(size_t numIndexSpecs) {
     if (numIndexSpecs == 0) {
         return 0;
@@ -738,6 +745,64 @@ void MultiIndexBlock::_doCollectionScan(OperationContext* opCtx,
     const auto onSuppressedError =
         makeOnSuppressedErrorFn(saveCursorBeforeWrite, restoreCursorAfterWrite);
 
+    auto insertDocument =
+        [&](const BSONObj& doc,
+            const RecordId& docLoc,
+            std::vector<boost::optional<IndexAccessMethod::BulkBuilder::GeneratedKeys>>*
+                generatedKeys) {
+            uassertStatusOK(
+                _failPointHangDuringBuild(opCtx,
+                                          &hangIndexBuildDuringCollectionScanPhaseBeforeInsertion,
+                                          "before",
+                                          doc,
+                                          progress->get(WithLock::withoutLock())->hits()));
+
+            // The external sorter is not part of the storage engine and therefore does not need
+            // a WriteUnitOfWork to write keys. In case there are constraint violations being
+            // suppressed, resulting in a write to the side table, all WUOW and write conflict
+            // exception handling for the side table write is handled internally.
+
+            // If kRelaxConstraints, shouldRelaxConstraints will simply be ignored and all errors
+            // suppressed. If kRelaxContraintsCallback, shouldRelaxConstraints is used to determine
+            // whether the error is suppressed or an exception is thrown.
+            uassertStatusOK(_insert(opCtx,
+                                    collection,
+                                    doc,
+                                    docLoc,
+                                    onSuppressedError,
+                                    shouldRelaxConstraints,
+                                    generatedKeys));
+
+            _failPointHangDuringBuild(opCtx,
+                                      &hangIndexBuildDuringCollectionScanPhaseAfterInsertion,
+                                      "after",
+                                      doc,
+                                      progress->get(WithLock::withoutLock())->hits())
+                .ignore();
+
+            {
+                stdx::unique_lock<Client> lk(*opCtx->getClient());
+                // Go to the next document.
+                progress->get(lk)->hit();
+            }
+        };
+
+    // When key generation is spread among several threads, the scanned documents are collected
+    // into batches. The keys of a whole batch are generated before any of them is inserted into the
+    // bulk builders, which keeps the insertion order, and so the resume point of the build, that of
+    // the collection scan.
+    const size_t numKeyGenerationThreads = indexBuildKeyGenerationThreads.load();
+    const size_t batchSize =
+        numKeyGenerationThreads > 1 ? numKeyGenerationThreads * kKeyGenerationDocsPerThread : 0;
+    std::vector<ScannedDocument> batch;
+    auto insertBatch = [&] {
+        _generateKeysConcurrently(opCtx, collection, batch, numKeyGenerationThreads);
+        for (auto& doc : batch) {
+            insertDocument(doc.obj, doc.loc, &doc.keys);
+        }
+        batch.clear();
+    };
+
     RecordId loc;
     PlanExecutor::ExecState state;
     while (PlanExecutor::ADVANCED == (state = exec->getNext(&objToIndex, &loc)) ||
@@ -753,37 +818,90 @@ void MultiIndexBlock::_doCollectionScan(OperationContext* opCtx,
             progress->get(lk)->setTotalWhileRunning(collection->numRecords(opCtx));
         }
 
-        uassertStatusOK(
-            _failPointHangDuringBuild(opCtx,
-                                      &hangIndexBuildDuringCollectionScanPhaseBeforeInsertion,
-                                      "before",
-                                      objToIndex,
-                                      progress->get(WithLock::withoutLock())->hits()));
-
-        // The external sorter is not part of the storage engine and therefore does not need
-        // a WriteUnitOfWork to write keys. In case there are constraint violations being
-        // suppressed, resulting in a write to the side table, all WUOW and write conflict exception
-        // handling for the side table write is handled internally.
-
-        // If kRelaxConstraints, shouldRelaxConstraints will simply be ignored and all errors
-        // suppressed. If kRelaxContraintsCallback, shouldRelaxConstraints is used to determine
-        // whether the error is suppressed or an exception is thrown.
-        uassertStatusOK(
-            _insert(opCtx, collection, objToIndex, loc, onSuppressedError, shouldRelaxConstraints));
-
-        _failPointHangDuringBuild(opCtx,
-                                  &hangIndexBuildDuringCollectionScanPhaseAfterInsertion,
-                                  "after",
-                                  objToIndex,
-                                  progress->get(WithLock::withoutLock())->hits())
-            .ignore();
+        if (batchSize == 0) {
+            insertDocument(objToIndex, loc, nullptr);
+            continue;
+        }
 
-        {
-            stdx::unique_lock<Client> lk(*opCtx->getClient());
-            // Go to the next document.
-            progress->get(lk)->hit();
+        // The document must outlive the position of the executor.
+        batch.push_back({objToIndex.getOwned(), loc, {}});
+        if (batch.size() >= batchSize) {
+            insertBatch();
+        }
+    }
+
+    if (!batch.empty()) {
+        insertBatch();
+    }
+}
+
+void MultiIndexBlock::_generateKeysConcurrently(OperationContext* opCtx,
+                                                const CollectionPtr& collection,
+                                                std::vector<ScannedDocument>& batch,
+                                                size_t numThreads) {
+    _cacheEntriesForScan(opCtx, collection);
+
+    auto generateKeys = [&](size_t begin, size_t end) {
+        SharedBufferFragmentBuilder pooledBuilder(
+            key_string::HeapBuilder::kHeapAllocatorDefaultBytes);
+        for (size_t docIdx = begin; docIdx < end; ++docIdx) {
+            auto& doc = batch[docIdx];
+            doc.keys.resize(_indexes.size());
+            for (size_t i = 0; i < _indexes.size(); i++) {
+                // Documents which are filtered out, or whose keys cannot be generated here, are
+                // left to the bulk builder's insert().
+                if (_indexes[i].filterExpression &&
+                    !_indexes[i].filterExpression->matchesBSON(doc.obj)) {
+                    continue;
+                }
+
+                IndexAccessMethod::BulkBuilder::GeneratedKeys generated;
+                if (_indexes[i].bulk->generateKeys(opCtx,
+                                                   collection,
+                                                   _indexes[i].entryForScan,
+                                                   pooledBuilder,
+                                                   doc.obj,
+                                                   doc.loc,
+                                                   &generated)) {
+                    doc.keys[i] = std::move(generated);
+                }
+            }
+        }
+    };
+
+    Mutex mutex = MONGO_MAKE_LATCH("MultiIndexBlock::generateKeysConcurrently");
+    stdx::condition_variable cv;
+    size_t remaining = 0;
+    Status status = Status::OK();
+    auto runSlice = [&](size_t begin, size_t end) {
+        Status sliceStatus = Status::OK();
+        try {
+            generateKeys(begin, end);
+        } catch (...) {
+            sliceStatus = exceptionToStatus();
+        }
+
+        stdx::lock_guard<Latch> lk(mutex);
+        if (status.isOK()) {
+            status = std::move(sliceStatus);
         }
+        if (--remaining == 0) {
+            cv.notify_one();
+        }
+    };
+
+    // The first slice is handled by this thread, the others by the sorter worker pool.
+    const size_t sliceSize = (batch.size() + numThreads - 1) / numThreads;
+    remaining = (batch.size() + sliceSize - 1) / sliceSize;
+    for (size_t begin = sliceSize; begin < batch.size(); begin += sliceSize) {
+        sorter::scheduleSorterTask(
+            [&, begin] { runSlice(begin, std::min(begin + sliceSize, batch.size())); });
     }
+    runSlice(0, std::min(sliceSize, batch.size()));
+
+    stdx::unique_lock<Latch> lk(mutex);
+    cv.wait(lk, [&] { return remaining == 0; });
+    uassertStatusOK(status);
 }
 
 Status MultiIndexBlock::insertSingleDocumentForInitialSyncOrRecovery(
@@ -804,7 +922,8 @@ Status MultiIndexBlock::_insert(
     const BSONObj& doc,
     const RecordId& loc,
     const IndexAccessMethod::OnSuppressedErrorFn& onSuppressedError,
-    const IndexAccessMethod::ShouldRelaxConstraintsFn& shouldRelaxConstraints) {
+    const IndexAccessMethod::ShouldRelaxConstraintsFn& shouldRelaxConstraints,
+    std::vector<boost::optional<IndexAccessMethod::BulkBuilder::GeneratedKeys>>* generatedKeys) {
     invariant(!_buildIsCleanedUp);
 
     // The detection of mixed-schema data needs to be done before applying the partial filter
@@ -827,19 +946,19 @@ Status MultiIndexBlock::_insert(
         }
     }
 
-    // Cache the collection and index catalog entry pointers during the collection scan phase. This
-    // is necessary for index build performance to avoid looking up the index catalog entry for each
-    // insertion into the index table.
-    if (_collForScan != collection.get()) {
-        _collForScan = collection.get();
+    _cacheEntriesForScan(opCtx, collection);
 
-        // Reset cached index catalog entry pointers.
-        for (size_t i = 0; i < _indexes.size(); i++) {
-            _indexes[i].entryForScan = _indexes[i].block->getEntry(opCtx, collection);
+    for (size_t i = 0; i < _indexes.size(); i++) {
+        if (generatedKeys && (*generatedKeys)[i]) {
+            // The filter was already applied when generating the keys.
+            try {
+                _indexes[i].bulk->insertGeneratedKeys(*(*generatedKeys)[i]);
+            } catch (...) {
+                return exceptionToStatus();
+            }
+            continue;
         }
-    }
 
-    for (size_t i = 0; i < _indexes.size(); i++) {
         if (_indexes[i].filterExpression && !_indexes[i].filterExpression->matchesBSON(doc)) {
             continue;
         }
@@ -870,6 +989,21 @@ Status MultiIndexBlock::_insert(
     return Status::OK();
 }
 
+void MultiIndexBlock::_cacheEntriesForScan(OperationContext* opCtx,
+                                           const CollectionPtr& collection) {
+    // Cache the collection and index catalog entry pointers during the collection scan phase. This
+    // is necessary for index build performance to avoid looking up the index catalog entry for each
+    // insertion into the index table.
+    if (_collForScan != collection.get()) {
+        _collForScan = collection.get();
+
+        // Reset cached index catalog entry pointers.
+        for (size_t i = 0; i < _indexes.size(); i++) {
+            _indexes[i].entryForScan = _indexes[i].block->getEntry(opCtx, collection);
+        }
+    }
+}
+
 Status MultiIndexBlock::dumpInsertsFromBulk(OperationContext* opCtx,
                                             const CollectionPtr& collection) {
     return dumpInsertsFromBulk(opCtx, collection, nullptr);
@@ -352,13 +352,43 @@ private:
                                      const BSONObj& doc,
                                      unsigned long long iteration) const;
 
+    /**
+     * A document read by the collection scan, along with the keys generated for it ahead of time,
+     * if any. 'keys' holds one entry per index being built.
+     */
+    struct ScannedDocument {
+        BSONObj obj;
+        RecordId loc;
+        std::vector<boost::optional<IndexAccessMethod::BulkBuilder::GeneratedKeys>> keys;
+    };
+
+    /**
+     * Inserts the keys of 'wholeDocument' into the bulk builders. When 'generatedKeys' is given,
+     * the keys it holds for an index are inserted instead of generating them again.
+     */
     Status _insert(
         OperationContext* opCtx,
         const CollectionPtr& collection,
         const BSONObj& wholeDocument,
         const RecordId& loc,
         const IndexAccessMethod::OnSuppressedErrorFn& onSuppressedError,
-        const IndexAccessMethod::ShouldRelaxConstraintsFn& shouldRelaxConstraints = nullptr);
+        const IndexAccessMethod::ShouldRelaxConstraintsFn& shouldRelaxConstraints = nullptr,
+        std::vector<boost::optional<IndexAccessMethod::BulkBuilder::GeneratedKeys>>*
+            generatedKeys = nullptr);
+
+    /**
+     * Refreshes the index catalog entries cached for the collection scan if 'collection' changed.
+     */
+    void _cacheEntriesForScan(OperationContext* opCtx, const CollectionPtr& collection);
+
+    /**
+     * Generates the keys of every document in 'batch' for every index, spreading the work among
+     * 'numThreads' threads. The caller must not yield until this returns.
+     */
+    void _generateKeysConcurrently(OperationContext* opCtx,
+                                   const CollectionPtr& collection,
+                                   std::vector<ScannedDocument>& batch,
+                                   size_t numThreads);
 
     /**
      * Performs a collection scan on the given collection and inserts the relevant index keys into
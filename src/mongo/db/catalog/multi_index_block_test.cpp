@@ -41,10 +41,12 @@
 #include "mongo/db/concurrency/lock_manager_defs.h"
 #include "mongo/db/index/index_descriptor.h"
 #include "mongo/db/namespace_string.h"
+#include "mongo/db/repl/oplog.h"
 #include "mongo/db/repl/replication_coordinator.h"
 #include "mongo/db/repl/replication_coordinator_mock.h"
 #include "mongo/db/repl/storage_interface.h"
 #include "mongo/db/storage/write_unit_of_work.h"
+#include "mongo/idl/server_parameter_test_util.h"
 #include "mongo/unittest/assert.h"
 #include "mongo/unittest/framework.h"
 #include "mongo/util/assert_util.h"
@@ -181,6 +183,60 @@ TEST_F(MultiIndexBlockTest, AbortWithoutCleanupAfterInsertingSingleDocument) {
     indexer->abortWithoutCleanup(operationContext(), coll.get(), isResumable);
 }
 
+TEST_F(MultiIndexBlockTest, InsertAllDocumentsWithConcurrentKeyGeneration) {
+    RAIIServerParameterControllerForTest keyGenerationThreads{"indexBuildKeyGenerationThreads", 4};
+
+    // Enough documents for several batches, the last of which is not full. Every other document
+    // contributes two keys to the index on 'b', making it multikey.
+    const int kNumDocs = 3000;
+    std::vector<InsertStatement> inserts;
+    for (int i = 0; i < kNumDocs; ++i) {
+        inserts.emplace_back(i % 2 ? BSON("_id" << i << "a" << i << "b" << BSON_ARRAY(i << -i))
+                                   : BSON("_id" << i << "a" << i << "b" << i));
+    }
+    ASSERT_OK(storageInterface()->insertDocuments(operationContext(), getNSS(), inserts));
+
+    auto indexer = getIndexer();
+    indexer->setIndexBuildMethod(IndexBuildMethod::kForeground);
+
+    AutoGetCollection autoColl(operationContext(), getNSS(), MODE_X);
+    CollectionWriter coll(operationContext(), autoColl);
+
+    auto makeSpec = [](StringData field) {
+        return BSON("key" << BSON(field << 1) << "name" << field.toString() + "_1"
+                          << "v" << static_cast<int>(IndexDescriptor::kLatestIndexVersion));
+    };
+    auto specs = unittest::assertGet(indexer->init(operationContext(),
+                                                   coll,
+                                                   {makeSpec("a"), makeSpec("b")},
+                                                   MultiIndexBlock::kNoopOnInitFn,
+                                                   MultiIndexBlock::InitMode::SteadyState));
+    ASSERT_EQUALS(2U, specs.size());
+
+    ASSERT_OK(indexer->insertAllDocumentsInCollection(operationContext(), coll.get()));
+    ASSERT_OK(indexer->checkConstraints(operationContext(), coll.get()));
+
+    {
+        WriteUnitOfWork wunit(operationContext());
+        ASSERT_OK(indexer->commit(operationContext(),
+                                  coll.getWritableCollection(operationContext()),
+                                  MultiIndexBlock::kNoopOnCreateEachFn,
+                                  MultiIndexBlock::kNoopOnCommitFn));
+        wunit.commit();
+    }
+
+    auto indexCatalog = coll->getIndexCatalog();
+    auto getEntry = [&](StringData name) {
+        auto desc = indexCatalog->findIndexByName(operationContext(), name);
+        ASSERT(desc);
+        return indexCatalog->getEntry(desc);
+    };
+    ASSERT_EQ(kNumDocs, getEntry("a_1")->accessMethod()->numKeys(operationContext()));
+    ASSERT_EQ(kNumDocs * 3 / 2, getEntry("b_1")->accessMethod()->numKeys(operationContext()));
+    ASSERT_FALSE(getEntry("a_1")->isMultikey(operationContext(), coll.get()));
+    ASSERT_TRUE(getEntry("b_1")->isMultikey(operationContext(), coll.get()));
+}
+
 TEST_F(MultiIndexBlockTest, InitWriteConflictException) {
     auto indexer = getIndexer();
 
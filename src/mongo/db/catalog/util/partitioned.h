@@ -31,6 +31,7 @@
 
 #include <algorithm>
 #include <boost/align/aligned_allocator.hpp>
+#include <boost/optional/optional.hpp>
 #include <cstdlib>
 #include <iterator>
 #include <memory>
@@ -284,6 +285,19 @@ public:
               _partitioned(&partitioned),
               _id(partitionId) {}
 
+        /**
+         * Attempts to acquire the lock for the ith partition without blocking. The caller must
+         * check 'ownsLock()' before accessing the partition.
+         */
+        OnePartition(Partitioned& partitioned, PartitionId partitionId, stdx::try_to_lock_t)
+            : _partitionLock(*partitioned._mutexes[partitionId], stdx::try_to_lock),
+              _partitioned(&partitioned),
+              _id(partitionId) {}
+
+        bool ownsLock() const {
+            return _partitionLock.owns_lock();
+        }
+
         stdx::unique_lock<stdx::mutex> _partitionLock;
         Partitioned* _partitioned;
         PartitionId _id;
@@ -382,6 +396,18 @@ public:
         return OnePartition{*this, id};
     }
 
+    /**
+     * Locks the partition determined by 'key' only if it is not currently held by another thread.
+     * Returns boost::none rather than blocking when the partition is contended.
+     */
+    boost::optional<OnePartition> tryLockOnePartition(const key_type& key) {
+        OnePartition partition{*this, KeyPartitioner()(key, _partitions.size()), stdx::try_to_lock};
+        if (!partition.ownsLock()) {
+            return boost::none;
+        }
+        return {std::move(partition)};
+    }
+
 private:
     using CacheExclusiveAssociativeContainer = CacheExclusive<AssociativeContainer>;
 
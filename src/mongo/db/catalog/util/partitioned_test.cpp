@@ -194,6 +194,26 @@ TEST(PartitionedConcurrency, ShouldBeAbleToGuardSeparatePartitionsSimultaneously
     }
 }
 
+TEST(PartitionedConcurrency, TryLockShouldFailOnlyWhenPartitionIsHeld) {
+    auto test = makePartitionedIntSet();
+    {
+        // A mutex must not be try-locked by the thread which already owns it.
+        auto zeroth = test.lockOnePartition(0);
+        bool lockedZeroth = true;
+        bool lockedFirst = false;
+        stdx::thread([&] {
+            lockedZeroth = test.tryLockOnePartition(0).has_value();
+            lockedFirst = test.tryLockOnePartition(1).has_value();
+        }).join();
+        ASSERT_FALSE(lockedZeroth);
+        ASSERT_TRUE(lockedFirst);
+    }
+    auto zeroth = test.tryLockOnePartition(0);
+    ASSERT_TRUE(zeroth);
+    (*zeroth)->insert(0);
+    ASSERT_EQ(1UL, (*zeroth)->count(0));
+}
+
 TEST(PartitionedConcurrency, ModificationsFromOnePartitionShouldBeVisible) {
     auto test = makePartitionedIntSet();
     {
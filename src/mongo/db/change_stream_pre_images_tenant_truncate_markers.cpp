@@ -344,7 +344,7 @@ void sampleToPopulate(
               "samples needed is 0",
               "tenantId"_attr = tenantId);
 
-        scanToPopulate(opCtx, tenantId, preImagesCollection, minBytesPerMarker, markersMap);
+        return scanToPopulate(opCtx, tenantId, preImagesCollection, minBytesPerMarker, markersMap);
     }
 
     ///////////////////////////////////////////////////////////////////////////////////////////
@@ -522,6 +522,11 @@ PreImagesTruncateStats PreImagesTenantMarkers::truncateExpiredPreImages(Operatio
     // there may be oplog holes or inconsistent data prior to it. Compute the value once, as it
     // requires making an additional call into the storage engine.
     Timestamp maxTSEligibleForTruncate = getMaxTSEligibleForTruncate(opCtx);
+
+    // The locks above prevent concurrent DDL on the pre-images collection, but a source collection
+    // may still be dropped during the pass. A stale catalog only delays removing its markers to the
+    // next pass, so a single catalog instance serves all of the nsUUIDs.
+    const auto catalog = CollectionCatalog::get(opCtx);
     PreImagesTruncateStats stats;
     for (auto& [nsUUID, truncateMarkersForNsUUID] : *markersMapSnapshot) {
         RecordId minRecordId =
@@ -565,7 +570,7 @@ PreImagesTruncateStats PreImagesTenantMarkers::truncateExpiredPreImages(Operatio
         // If the source collection doesn't exist and there's no more data to erase we can
         // safely remove the markers. Perform a final truncate to remove all elements just in
         // case.
-        if (CollectionCatalog::get(opCtx)->lookupCollectionByUUID(opCtx, nsUUID) == nullptr &&
+        if (catalog->lookupCollectionByUUID(opCtx, nsUUID) == nullptr &&
             truncateMarkersForNsUUID->isEmpty()) {
 
             RecordId maxRecordId =
@@ -258,6 +258,7 @@ int Client::getLocalPort() const {
 
 void Client::_setOperationContext(OperationContext* opCtx) {
     _opCtx = opCtx;
+    _hasOperationContext.storeRelaxed(opCtx != nullptr);
     if (_session) {
         _session->setInOperation(opCtx != nullptr);
     }
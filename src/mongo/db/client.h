@@ -310,6 +310,15 @@ public:
      */
     bool hasAnyActiveCurrentOp() const;
 
+    /**
+     * Returns false if this client had no OperationContext the last time one was attached or
+     * detached. Does not require the client lock, so the answer may already be stale; it lets
+     * callers skip idle clients cheaply before locking them to call hasAnyActiveCurrentOp().
+     */
+    bool mayHaveActiveCurrentOp() const {
+        return _hasOperationContext.loadRelaxed();
+    }
+
     /**
      * Signal the client's OperationContext that it has been killed.
      * Any future OperationContext on this client will also receive a kill signal.
@@ -425,6 +434,9 @@ private:
     // If != NULL, then contains the currently active OperationContext
     OperationContext* _opCtx = nullptr;
 
+    // Mirrors whether '_opCtx' is set, for readers that don't hold the client lock.
+    AtomicWord<bool> _hasOperationContext{false};
+
     // If the active system client operation is allowed to be killed.
     bool _systemOperationKillable = true;
 
@@ -68,8 +68,8 @@ void CollectionIndexUsageTracker::recordIndexAccess(StringData indexName) const
 
     _aggregatedIndexUsageTracker->onAccess(it->second->features);
 
-    // Increment the index usage atomic counter.
-    it->second->accesses.fetchAndAdd(1);
+    // Increment the index usage counter.
+    it->second->accesses.increment();
 }
 
 void CollectionIndexUsageTracker::recordCollectionScans(unsigned long long collectionScans) const {
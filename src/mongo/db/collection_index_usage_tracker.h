@@ -80,13 +80,13 @@ public:
             : trackerStartTime(now), indexKey(key.getOwned()), features(idxFeatures) {}
 
         IndexUsageStats(const IndexUsageStats& other)
-            : accesses(other.accesses.load()),
+            : accesses(other.accesses),
               trackerStartTime(other.trackerStartTime),
               indexKey(other.indexKey),
               features(other.features) {}
 
         IndexUsageStats& operator=(const IndexUsageStats& other) {
-            accesses.store(other.accesses.load());
+            accesses = other.accesses;
             trackerStartTime = other.trackerStartTime;
             indexKey = other.indexKey;
             features = other.features;
@@ -94,7 +94,7 @@ public:
         }
 
         // Number of operations that have used this index.
-        AtomicWord<long long> accesses;
+        IndexAccessCounter accesses;
 
         // Date/Time that we started tracking index usage.
         Date_t trackerStartTime;
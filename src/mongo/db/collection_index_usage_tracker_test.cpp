@@ -29,6 +29,7 @@
 
 #include <absl/container/flat_hash_map.h>
 #include <string>
+#include <vector>
 
 #include <boost/smart_ptr/intrusive_ptr.hpp>
 
@@ -36,6 +37,7 @@
 #include "mongo/bson/bsonobjbuilder.h"
 #include "mongo/db/collection_index_usage_tracker.h"
 #include "mongo/db/index/index_descriptor.h"
+#include "mongo/stdx/thread.h"
 #include "mongo/unittest/assert.h"
 #include "mongo/unittest/bson_test_util.h"
 #include "mongo/unittest/framework.h"
@@ -84,7 +86,7 @@ TEST_F(CollectionIndexUsageTrackerTest, SingleHit) {
     getTracker()->recordIndexAccess("foo");
     const auto& statsMap = getTracker()->getUsageStats();
     ASSERT(statsMap.find("foo") != statsMap.end());
-    ASSERT_EQUALS(1, statsMap.at("foo")->accesses.loadRelaxed());
+    ASSERT_EQUALS(1, statsMap.at("foo")->accesses.load());
 }
 
 // Test that recording of multiple index hits are reflected in stats map.
@@ -94,7 +96,36 @@ TEST_F(CollectionIndexUsageTrackerTest, MultipleHit) {
     getTracker()->recordIndexAccess("foo");
     const auto& statsMap = getTracker()->getUsageStats();
     ASSERT(statsMap.find("foo") != statsMap.end());
-    ASSERT_EQUALS(2, statsMap.at("foo")->accesses.loadRelaxed());
+    ASSERT_EQUALS(2, statsMap.at("foo")->accesses.load());
+}
+
+// Test that hits recorded from several threads are all counted, and that copies of the stats keep
+// the count.
+TEST_F(CollectionIndexUsageTrackerTest, ConcurrentHits) {
+    getTracker()->registerIndex("foo", BSON("foo" << 1), {});
+
+    const int kThreads = 4;
+    const int kHitsPerThread = 1000;
+    std::vector<stdx::thread> threads;
+    for (int i = 0; i < kThreads; ++i) {
+        threads.emplace_back([&] {
+            for (int j = 0; j < kHitsPerThread; ++j) {
+                getTracker()->recordIndexAccess("foo");
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    const auto& statsMap = getTracker()->getUsageStats();
+    ASSERT_EQUALS(kThreads * kHitsPerThread, statsMap.at("foo")->accesses.load());
+
+    CollectionIndexUsageTracker::IndexUsageStats copy(*statsMap.at("foo"));
+    ASSERT_EQUALS(kThreads * kHitsPerThread, copy.accesses.load());
+    copy.accesses.increment();
+    ASSERT_EQUALS(kThreads * kHitsPerThread + 1, copy.accesses.load());
+    ASSERT_EQUALS(kThreads * kHitsPerThread, statsMap.at("foo")->accesses.load());
 }
 
 // Test that an index is registered correctly with indexKey.
@@ -131,7 +162,7 @@ TEST_F(CollectionIndexUsageTrackerTest, HitAfterDeregister) {
     getTracker()->recordIndexAccess("foo");
     const auto& statsMap = getTracker()->getUsageStats();
     ASSERT(statsMap.find("foo") != statsMap.end());
-    ASSERT_EQUALS(2, statsMap.at("foo")->accesses.loadRelaxed());
+    ASSERT_EQUALS(2, statsMap.at("foo")->accesses.load());
 
     getTracker()->unregisterIndex("foo");
     ASSERT(statsMap.find("foo") == statsMap.end());
@@ -139,7 +170,7 @@ TEST_F(CollectionIndexUsageTrackerTest, HitAfterDeregister) {
     getTracker()->registerIndex("foo", BSON("foo" << 1), {});
     getTracker()->recordIndexAccess("foo");
     ASSERT(statsMap.find("foo") != statsMap.end());
-    ASSERT_EQUALS(1, statsMap.at("foo")->accesses.loadRelaxed());
+    ASSERT_EQUALS(1, statsMap.at("foo")->accesses.load());
 }
 
 // Test that index tracker start date/time is reset on index deregistration/registration.
@@ -54,6 +54,7 @@
 #include "mongo/db/commands/test_commands_enabled.h"
 #include "mongo/db/error_labels.h"
 #include "mongo/db/namespace_string.h"
+#include "mongo/db/stats/latency_percentile_histogram_gen.h"
 #include "mongo/db/tenant_id.h"
 #include "mongo/db/write_concern_options.h"
 #include "mongo/idl/command_generic_argument.h"
@@ -1055,9 +1056,18 @@ void Command::initializeClusterRole(ClusterRole role) {
              std::pair{&_commandsRejected, "rejected"},
          })
         *ptr = &*MetricBuilder<Counter64>{"commands.{}.{}"_format(_name, stat)}.setRole(role);
+    _latencyPercentiles =
+        &*MetricBuilder<LatencyPercentileHistogram>{"commands.{}.latencyPercentiles"_format(_name)}
+              .setRole(role)
+              .setPredicate([] { return gCommandLatencyPercentiles.load(); });
     doInitializeClusterRole(role);
 }
 
+void Command::recordLatency(Microseconds latency) const {
+    if (_latencyPercentiles && gCommandLatencyPercentiles.load())
+        _latencyPercentiles->record(latency);
+}
+
 const std::set<std::string>& Command::apiVersions() const {
     return kNoApiVersions;
 }
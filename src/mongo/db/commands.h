@@ -69,6 +69,7 @@
 #include "mongo/db/repl/read_concern_level.h"
 #include "mongo/db/request_execution_context.h"
 #include "mongo/db/service_context.h"
+#include "mongo/db/stats/latency_percentile_histogram.h"
 #include "mongo/db/write_concern.h"
 #include "mongo/db/write_concern_options.h"
 #include "mongo/idl/idl_parser.h"
@@ -654,6 +655,12 @@ public:
         _commandsRejected->increment();
     }
 
+    /**
+     * Records the latency of one execution of this command in its latency percentile histogram,
+     * if 'commandLatencyPercentiles' is enabled.
+     */
+    void recordLatency(Microseconds latency) const;
+
     /**
      * Generates a reply from the 'help' information associated with a command. The state of
      * the passed ReplyBuilder will be in kOutputDocs after calling this method.
@@ -749,6 +756,8 @@ private:
     Counter64* _commandsExecuted{};
     Counter64* _commandsFailed{};
     Counter64* _commandsRejected{};
+
+    LatencyPercentileHistogram* _latencyPercentiles{};
 };
 
 /**
@@ -35,6 +35,7 @@
 #include <chrono>
 #include <compare>
 #include <cstdint>
+#include <deque>
 #include <limits>
 #include <memory>
 #include <mutex>
@@ -1618,6 +1619,25 @@ void DbChecker::_dataConsistencyCheck(OperationContext* opCtx) {
     int64_t numRetries = 0;
     int64_t sleepMillis = initialSleepMillis;
 
+    // Optimes of the batches written so far whose writeConcern we have not waited for yet, oldest
+    // first.
+    std::deque<repl::OpTime> batchesAwaitingWriteConcern;
+    auto waitForBatchWriteConcern = [&](const repl::OpTime& batchTime) {
+        WriteConcernResult unused;
+        auto status = waitForWriteConcern(opCtx, batchTime, _info.writeConcern, &unused);
+        if (!status.isOK()) {
+            // TODO SERVER-79850: Investigate refactoring dbcheck code to only check for errors
+            // in one location.
+            auto entry = dbCheckWarningHealthLogEntry(_info.nss,
+                                                      _info.uuid,
+                                                      "dbCheck failed waiting for writeConcern",
+                                                      ScopeEnum::Collection,
+                                                      OplogEntriesEnum::Batch,
+                                                      status);
+            HealthLogInterface::get(opCtx)->log(*entry);
+        }
+    };
+
     do {
         auto result = _runBatch(opCtx, start);
         if (!result.isOK()) {
@@ -1713,18 +1733,14 @@ void DbChecker::_dataConsistencyCheck(OperationContext* opCtx) {
             HealthLogInterface::get(opCtx)->log(*entry);
         }
 
-        WriteConcernResult unused;
-        auto status = waitForWriteConcern(opCtx, stats.time, _info.writeConcern, &unused);
-        if (!status.isOK()) {
-            // TODO SERVER-79850: Investigate refactoring dbcheck code to only check for errors
-            // in one location.
-            auto entry = dbCheckWarningHealthLogEntry(_info.nss,
-                                                      _info.uuid,
-                                                      "dbCheck failed waiting for writeConcern",
-                                                      ScopeEnum::Collection,
-                                                      OplogEntriesEnum::Batch,
-                                                      status);
-            HealthLogInterface::get(opCtx)->log(*entry);
+        // Keep at most 'dbCheckMaxBatchesAwaitingWriteConcern' batches outstanding, so that the
+        // primary can hash the next batch while secondaries are still checking the earlier ones.
+        batchesAwaitingWriteConcern.push_back(stats.time);
+        const auto maxBatchesAwaitingWriteConcern =
+            static_cast<size_t>(repl::dbCheckMaxBatchesAwaitingWriteConcern.load());
+        while (batchesAwaitingWriteConcern.size() >= maxBatchesAwaitingWriteConcern) {
+            waitForBatchWriteConcern(batchesAwaitingWriteConcern.front());
+            batchesAwaitingWriteConcern.pop_front();
         }
 
         start = stats.lastKey;
@@ -1748,6 +1764,11 @@ void DbChecker::_dataConsistencyCheck(OperationContext* opCtx) {
         sleepMillis = initialSleepMillis;
     } while (!reachedEnd);
 
+    // Optimes are increasing, so waiting for the last batch covers all the earlier ones.
+    if (!batchesAwaitingWriteConcern.empty()) {
+        waitForBatchWriteConcern(batchesAwaitingWriteConcern.back());
+    }
+
     {
         stdx::unique_lock<Client> lk(*opCtx->getClient());
         progress.get(lk)->finished();
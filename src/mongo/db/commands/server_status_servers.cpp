@@ -39,6 +39,8 @@
 #include "mongo/db/operation_context.h"
 #include "mongo/db/service_context.h"
 #include "mongo/db/stats/counters.h"
+#include "mongo/logv2/log_domain_global.h"
+#include "mongo/logv2/log_manager.h"
 #include "mongo/platform/atomic_word.h"
 #include "mongo/transport/message_compressor_registry.h"
 #include "mongo/transport/service_executor.h"
@@ -139,6 +141,14 @@ public:
         builder.append("1.2", counts.tls12.load());
         builder.append("1.3", counts.tls13.load());
         builder.append("unknown", counts.tlsUnknown.load());
+
+        auto& resumption = TLSSessionResumptionCounts::get(opCtx->getServiceContext());
+        BSONObjBuilder resumptionBuilder(builder.subobjStart("sessionResumption"));
+        resumptionBuilder.append("ingressResumed", resumption.ingressResumed.load());
+        resumptionBuilder.append("ingressFull", resumption.ingressFull.load());
+        resumptionBuilder.append("egressResumed", resumption.egressResumed.load());
+        resumptionBuilder.append("egressFull", resumption.egressFull.load());
+        resumptionBuilder.done();
         return builder.obj();
     }
 };
@@ -166,5 +176,32 @@ public:
 };
 auto& advisoryHostFQDNs = *ServerStatusSectionBuilder<AdvisoryHostFQDNs>("advisoryHostFQDNs");
 
+/**
+ * Reports the counters of the async log file writer. Omitted unless asyncLogFileBufferSizeKB is
+ * set.
+ */
+class LogWriter final : public ServerStatusSection {
+public:
+    using ServerStatusSection::ServerStatusSection;
+
+    bool includeByDefault() const override {
+        return true;
+    }
+
+    void appendSection(OperationContext* opCtx,
+                       const BSONElement& configElement,
+                       BSONObjBuilder* out) const override {
+        auto stats = logv2::LogManager::global().getGlobalDomainInternal().asyncFileWriterStats();
+        if (!stats)
+            return;
+        BSONObjBuilder{out->subobjStart(getSectionName())}
+            .append("bufferedBytes", stats->bufferedBytes)
+            .append("written", stats->written)
+            .append("dropped", stats->dropped)
+            .append("waitedForSpace", stats->waitedForSpace);
+    }
+};
+auto& logWriter = *ServerStatusSectionBuilder<LogWriter>("logWriter").forShard().forRouter();
+
 }  // namespace
 }  // namespace mongo
@@ -0,0 +1,215 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/db/concurrency/contention_profiler.h"
+
+#include <absl/hash/hash.h>
+#include <algorithm>
+#include <utility>
+
+#include "mongo/base/init.h"  // IWYU pragma: keep
+#include "mongo/db/commands/server_status.h"
+#include "mongo/db/concurrency/contention_profiler_gen.h"
+#include "mongo/platform/mutex.h"
+#include "mongo/platform/random.h"
+#include "mongo/util/assert_util.h"
+#include "mongo/util/stacktrace.h"
+#include "mongo/util/time_support.h"
+
+namespace mongo {
+namespace {
+
+thread_local PseudoRandom threadPrng{SecureRandom().nextInt64()};
+
+/**
+ * Times contended Mutex acquisitions. Only called for latches built with diagnostic latches
+ * enabled.
+ */
+class ContentionProfilerLatchListener : public latch_detail::DiagnosticListener {
+public:
+    void onContendedLock(const Identity& id) override {
+        if (ContentionProfiler::isEnabled()) {
+            _contendedAtMicros = curTimeMicros64();
+        }
+    }
+
+    void onQuickLock(const Identity& id) override {}
+
+    void onSlowLock(const Identity& id) override {
+        if (_contendedAtMicros == 0) {
+            return;
+        }
+        const auto wait =
+            Microseconds(static_cast<long long>(curTimeMicros64() - _contendedAtMicros));
+        _contendedAtMicros = 0;
+        ContentionProfiler::get().onWait(ContentionProfiler::Source::kLatch, id.name(), wait);
+    }
+
+    void onUnlock(const Identity& id) override {}
+
+private:
+    static thread_local uint64_t _contendedAtMicros;
+};
+
+thread_local uint64_t ContentionProfilerLatchListener::_contendedAtMicros = 0;
+
+MONGO_INITIALIZER_GENERAL(ContentionProfiler, (/* NO PREREQS */), ("FinalizeDiagnosticListeners"))
+(InitializerContext* context) {
+    latch_detail::installDiagnosticListener<ContentionProfilerLatchListener>();
+}
+
+/**
+ * Reports the profiler's counters. The aggregated stacks are only available through
+ * $contentionStats, which keeps this section small enough for FTDC.
+ */
+class ContentionProfilerSSS : public ServerStatusSection {
+public:
+    using ServerStatusSection::ServerStatusSection;
+
+    bool includeByDefault() const override {
+        return true;
+    }
+
+    BSONObj generateSection(OperationContext* opCtx, const BSONElement& configElem) const override {
+        BSONObjBuilder bob;
+        ContentionProfiler::get().appendStats(&bob);
+        return bob.obj();
+    }
+};
+auto& contentionProfilerSSS =
+    *ServerStatusSectionBuilder<ContentionProfilerSSS>("contentionProfiler");
+
+}  // namespace
+
+ContentionProfiler& ContentionProfiler::get() {
+    // Latches may be contended after exit handlers run, so the profiler is never destroyed.
+    static auto* const profiler = new ContentionProfiler();  // Intentionally leaked!
+    return *profiler;
+}
+
+StringData ContentionProfiler::toString(Source source) {
+    switch (source) {
+        case Source::kLock:
+            return "lock"_sd;
+        case Source::kTicket:
+            return "ticket"_sd;
+        case Source::kLatch:
+            return "latch"_sd;
+    }
+    MONGO_UNREACHABLE;
+}
+
+bool ContentionProfiler::isEnabled() {
+    return gContentionProfilerSampleRate.loadRelaxed() > 0;
+}
+
+void ContentionProfiler::onWait(Source source, StringData resource, Microseconds wait) {
+    const double sampleRate = gContentionProfilerSampleRate.loadRelaxed();
+    if (sampleRate <= 0 || wait < Microseconds(gContentionProfilerThresholdMicros.loadRelaxed())) {
+        return;
+    }
+
+    auto& counters = _counters[static_cast<size_t>(source)];
+    counters.slowWaits.fetchAndAddRelaxed(1);
+    counters.slowWaitMicros.fetchAndAddRelaxed(durationCount<Microseconds>(wait));
+
+    if (sampleRate < 1 && threadPrng.nextCanonicalDouble() >= sampleRate) {
+        return;
+    }
+
+    std::vector<void*> frames;
+#ifndef _WIN32
+    std::array<void*, kMaxFrames> buffer;
+    frames.assign(buffer.begin(), buffer.begin() + rawBacktrace(buffer.data(), buffer.size()));
+#endif
+    record(source, resource, wait, std::move(frames));
+}
+
+void ContentionProfiler::record(Source source,
+                                StringData resource,
+                                Microseconds wait,
+                                std::vector<void*> frames) {
+    _counters[static_cast<size_t>(source)].samples.fetchAndAddRelaxed(1);
+
+    const long long waitMicros = durationCount<Microseconds>(wait);
+    Key key{source, resource.toString(), absl::HashOf(frames)};
+
+    stdx::lock_guard<stdx::mutex> lk(_mutex);  // NOLINT
+    auto it = _entries.find(key);
+    if (it == _entries.end()) {
+        if (_entries.size() >= _capacity) {
+            _droppedSamples.fetchAndAddRelaxed(1);
+            return;
+        }
+        Entry entry{source, key.resource, key.stackId, std::move(frames), 0, 0, 0};
+        it = _entries.emplace(std::move(key), std::move(entry)).first;
+    }
+
+    auto& entry = it->second;
+    ++entry.samples;
+    entry.totalWaitMicros += waitMicros;
+    entry.maxWaitMicros = std::max(entry.maxWaitMicros, waitMicros);
+}
+
+std::vector<ContentionProfiler::Entry> ContentionProfiler::getEntries() const {
+    std::vector<Entry> entries;
+    stdx::lock_guard<stdx::mutex> lk(_mutex);  // NOLINT
+    entries.reserve(_entries.size());
+    for (const auto& [key, entry] : _entries) {
+        entries.push_back(entry);
+    }
+    return entries;
+}
+
+void ContentionProfiler::appendStats(BSONObjBuilder* builder) const {
+    for (size_t i = 0; i < kNumSources; ++i) {
+        const auto& counters = _counters[i];
+        BSONObjBuilder sourceBuilder(builder->subobjStart(toString(static_cast<Source>(i))));
+        sourceBuilder.append("slowWaits", counters.slowWaits.loadRelaxed());
+        sourceBuilder.append("slowWaitMicros", counters.slowWaitMicros.loadRelaxed());
+        sourceBuilder.append("samples", counters.samples.loadRelaxed());
+    }
+    builder->append("droppedSamples", _droppedSamples.loadRelaxed());
+
+    stdx::lock_guard<stdx::mutex> lk(_mutex);  // NOLINT
+    builder->append("stacks", static_cast<long long>(_entries.size()));
+}
+
+void ContentionProfiler::clear() {
+    stdx::lock_guard<stdx::mutex> lk(_mutex);  // NOLINT
+    _entries.clear();
+    for (auto& counters : _counters) {
+        counters.slowWaits.store(0);
+        counters.slowWaitMicros.store(0);
+        counters.samples.store(0);
+    }
+    _droppedSamples.store(0);
+}
+
+}  // namespace mongo
@@ -0,0 +1,143 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "mongo/base/string_data.h"
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/platform/atomic_word.h"
+#include "mongo/stdx/mutex.h"
+#include "mongo/stdx/unordered_map.h"
+#include "mongo/util/duration.h"
+
+namespace mongo {
+
+/**
+ * Samples slow lock manager, ticket and latch waits and aggregates them by the stack trace of the
+ * waiting thread, so that contention can be attributed to code paths rather than only counted per
+ * resource type as in LockStats.
+ *
+ * Waits shorter than 'contentionProfilerThresholdMicros' are ignored. Of the remaining ones,
+ * every wait is counted per source, and a 'contentionProfilerSampleRate' fraction captures a raw
+ * backtrace which is aggregated into a table keyed by source, resource and stack. The table holds
+ * at most 'capacity' entries; samples for new stacks are dropped once it is full.
+ */
+class ContentionProfiler {
+public:
+    enum class Source { kLock, kTicket, kLatch };
+    static constexpr size_t kNumSources = 3;
+
+    static constexpr size_t kMaxFrames = 32;
+    static constexpr size_t kDefaultCapacity = 1000;
+
+    struct Entry {
+        Source source;
+        std::string resource;
+        uint64_t stackId;
+        std::vector<void*> frames;
+        long long samples;
+        long long totalWaitMicros;
+        long long maxWaitMicros;
+    };
+
+    explicit ContentionProfiler(size_t capacity = kDefaultCapacity) : _capacity(capacity) {}
+
+    static ContentionProfiler& get();
+
+    static StringData toString(Source source);
+
+    /**
+     * Returns false if the profiler is disabled, so that callers can avoid timing their waits.
+     */
+    static bool isEnabled();
+
+    /**
+     * Notes that the current thread waited 'wait' to acquire 'resource'. Waits under the threshold
+     * are ignored and only a sample of the others capture a stack trace.
+     */
+    void onWait(Source source, StringData resource, Microseconds wait);
+
+    /**
+     * Aggregates a wait with the given stack without thresholding or sampling.
+     */
+    void record(Source source, StringData resource, Microseconds wait, std::vector<void*> frames);
+
+    /**
+     * Returns a copy of the aggregated table in no particular order.
+     */
+    std::vector<Entry> getEntries() const;
+
+    /**
+     * Appends per-source counters and the size of the table. This is cheap enough to be collected
+     * by FTDC.
+     */
+    void appendStats(BSONObjBuilder* builder) const;
+
+    void clear();
+
+private:
+    struct Key {
+        Source source;
+        std::string resource;
+        uint64_t stackId;
+
+        bool operator==(const Key& other) const {
+            return source == other.source && stackId == other.stackId &&
+                resource == other.resource;
+        }
+
+        template <typename H>
+        friend H AbslHashValue(H h, const Key& key) {
+            return H::combine(std::move(h), key.source, key.resource, key.stackId);
+        }
+    };
+
+    struct SourceCounters {
+        AtomicWord<long long> slowWaits{0};
+        AtomicWord<long long> slowWaitMicros{0};
+        AtomicWord<long long> samples{0};
+    };
+
+    const size_t _capacity;
+
+    std::array<SourceCounters, kNumSources> _counters;
+    AtomicWord<long long> _droppedSamples{0};
+
+    // A raw mutex: the profiler is notified of contended Mutexes and must not recurse into itself.
+    mutable stdx::mutex _mutex;  // NOLINT
+    stdx::unordered_map<Key, Entry> _entries;
+};
+
+}  // namespace mongo
@@ -0,0 +1,144 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/db/concurrency/contention_profiler.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "mongo/bson/bsonobj.h"
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/idl/server_parameter_test_util.h"
+#include "mongo/unittest/assert.h"
+#include "mongo/unittest/framework.h"
+
+namespace mongo {
+namespace {
+
+using Source = ContentionProfiler::Source;
+
+const std::vector<void*> kStackA{reinterpret_cast<void*>(0x1000), reinterpret_cast<void*>(0x2000)};
+const std::vector<void*> kStackB{reinterpret_cast<void*>(0x3000)};
+
+BSONObj stats(const ContentionProfiler& profiler) {
+    BSONObjBuilder bob;
+    profiler.appendStats(&bob);
+    return bob.obj();
+}
+
+const ContentionProfiler::Entry& findEntry(const std::vector<ContentionProfiler::Entry>& entries,
+                                           Source source,
+                                           StringData resource,
+                                           const std::vector<void*>& frames) {
+    auto it = std::find_if(entries.begin(), entries.end(), [&](const auto& entry) {
+        return entry.source == source && entry.resource == resource && entry.frames == frames;
+    });
+    ASSERT(it != entries.end());
+    return *it;
+}
+
+TEST(ContentionProfilerTest, AggregatesWaitsBySourceResourceAndStack) {
+    ContentionProfiler profiler;
+    profiler.record(Source::kLock, "Collection", Microseconds(10), kStackA);
+    profiler.record(Source::kLock, "Collection", Microseconds(30), kStackA);
+    profiler.record(Source::kLock, "Collection", Microseconds(5), kStackB);
+    profiler.record(Source::kLock, "Database", Microseconds(7), kStackA);
+    profiler.record(Source::kTicket, "Collection", Microseconds(9), kStackA);
+
+    auto entries = profiler.getEntries();
+    ASSERT_EQ(4U, entries.size());
+
+    const auto& hot = findEntry(entries, Source::kLock, "Collection", kStackA);
+    ASSERT_EQ(2, hot.samples);
+    ASSERT_EQ(40, hot.totalWaitMicros);
+    ASSERT_EQ(30, hot.maxWaitMicros);
+
+    ASSERT_EQ(1, findEntry(entries, Source::kLock, "Collection", kStackB).samples);
+    ASSERT_EQ(1, findEntry(entries, Source::kLock, "Database", kStackA).samples);
+    ASSERT_EQ(1, findEntry(entries, Source::kTicket, "Collection", kStackA).samples);
+
+    auto obj = stats(profiler);
+    ASSERT_EQ(4, obj["lock"]["samples"].numberLong());
+    ASSERT_EQ(1, obj["ticket"]["samples"].numberLong());
+    ASSERT_EQ(0, obj["latch"]["samples"].numberLong());
+    ASSERT_EQ(4, obj["stacks"].numberLong());
+}
+
+TEST(ContentionProfilerTest, DropsSamplesForNewStacksWhenFull) {
+    ContentionProfiler profiler(1);
+    profiler.record(Source::kLatch, "mutex", Microseconds(1), kStackA);
+    profiler.record(Source::kLatch, "mutex", Microseconds(1), kStackB);
+    profiler.record(Source::kLatch, "mutex", Microseconds(1), kStackA);
+
+    auto entries = profiler.getEntries();
+    ASSERT_EQ(1U, entries.size());
+    ASSERT_EQ(2, entries[0].samples);
+    ASSERT_EQ(1, stats(profiler)["droppedSamples"].numberLong());
+}
+
+TEST(ContentionProfilerTest, OnWaitIsDisabledByDefault) {
+    ContentionProfiler profiler;
+    profiler.onWait(Source::kLock, "Global", Seconds(1));
+    ASSERT_TRUE(profiler.getEntries().empty());
+    ASSERT_EQ(0, stats(profiler)["lock"]["slowWaits"].numberLong());
+}
+
+TEST(ContentionProfilerTest, OnWaitIgnoresWaitsUnderTheThreshold) {
+    RAIIServerParameterControllerForTest sampleRate("contentionProfilerSampleRate", 1.0);
+    RAIIServerParameterControllerForTest threshold("contentionProfilerThresholdMicros", 100);
+    ASSERT_TRUE(ContentionProfiler::isEnabled());
+
+    ContentionProfiler profiler;
+    profiler.onWait(Source::kLock, "Global", Microseconds(99));
+    profiler.onWait(Source::kLock, "Global", Microseconds(100));
+    profiler.onWait(Source::kLock, "Global", Microseconds(150));
+
+    auto obj = stats(profiler);
+    ASSERT_EQ(2, obj["lock"]["slowWaits"].numberLong());
+    ASSERT_EQ(250, obj["lock"]["slowWaitMicros"].numberLong());
+    ASSERT_EQ(2, obj["lock"]["samples"].numberLong());
+
+    long long samples = 0;
+    for (const auto& entry : profiler.getEntries()) {
+        ASSERT_EQ("Global", entry.resource);
+        samples += entry.samples;
+    }
+    ASSERT_EQ(2, samples);
+}
+
+TEST(ContentionProfilerTest, ClearResetsTableAndCounters) {
+    ContentionProfiler profiler;
+    profiler.record(Source::kTicket, "read", Microseconds(1), kStackA);
+    profiler.clear();
+    ASSERT_TRUE(profiler.getEntries().empty());
+    ASSERT_EQ(0, stats(profiler)["ticket"]["samples"].numberLong());
+}
+
+}  // namespace
+}  // namespace mongo
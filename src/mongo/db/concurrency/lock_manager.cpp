@@ -205,9 +205,10 @@ struct LockHead {
 
     /**
      * Finish creation of request and put it on the LockHead's conflict or granted queues. Returns
-     * LOCK_WAITING for conflict case and LOCK_OK otherwise.
+     * LOCK_WAITING for conflict case and LOCK_OK otherwise. The 'fastPathModes' are the modes
+     * granted for this resource outside of the LockHead through the intent lock fast path.
      */
-    LockResult newRequest(LockRequest* request) {
+    LockResult newRequest(LockRequest* request, uint32_t fastPathModes = 0) {
         invariant(!request->partitionedLock);
         request->lock = this;
 
@@ -217,7 +218,7 @@ struct LockHead {
 
         // New lock request. Queue after all granted modes and after any already requested
         // conflicting modes
-        if (conflicts(request->mode, grantedModes) ||
+        if (conflicts(request->mode, grantedModes | fastPathModes) ||
             (!compatibleFirstCount && conflicts(request->mode, conflictModes))) {
             request->status = LockRequest::STATUS_WAITING;
 
@@ -461,9 +462,22 @@ LockResult LockManager::lock(ResourceId resId, LockRequest* request, LockMode mo
     // Sanity check that requests are not being reused without proper cleanup
     invariant(request->recursiveCount == 1);
 
-    request->partitioned = (mode == MODE_IX || mode == MODE_IS);
+    const bool isIntentMode = (mode == MODE_IX || mode == MODE_IS);
+    FastPathState* fastPathState = _getFastPathState(resId);
+
+    request->partitioned = isIntentMode && !fastPathState;
     request->mode = mode;
 
+    // For intent modes on global resources, try to grant without taking any mutex. Requests which
+    // change the fairness policy must be visible on the LockHead, so they always take the slow
+    // path.
+    if (isIntentMode && fastPathState && !request->enqueueAtFront && !request->compatibleFirst) {
+        invariant(request->status == LockRequest::STATUS_NEW);
+        if (_tryLockFastPath(resId, fastPathState, request)) {
+            return LOCK_OK;
+        }
+    }
+
     // For intent modes, try the PartitionedLockHead
     if (request->partitioned) {
         Partition* partition = _getPartition(request);
@@ -489,6 +503,18 @@ LockResult LockManager::lock(ResourceId resId, LockRequest* request, LockMode mo
 
     LockHead* lock = bucket->findOrInsert(resId);
 
+    // Non-intent requests on a fast path resource force all later intent requests onto the
+    // LockHead, and must then account for the intent modes still granted through the counters.
+    // The flag is set before reading the counters, which pairs with _tryLockFastPath incrementing
+    // its counter before checking the flag, so that at least one side observes the other.
+    uint32_t fastPathModes = 0;
+    if (fastPathState) {
+        if (!isIntentMode) {
+            fastPathState->slowPath.store(true);
+        }
+        fastPathModes = _fastPathGrantedModes(resId);
+    }
+
     // Start a partitioned lock if possible
     if (request->partitioned && !(lock->grantedModes & (~intentModes)) && !lock->conflictModes) {
         Partition* partition = _getPartition(request);
@@ -506,13 +532,30 @@ LockResult LockManager::lock(ResourceId resId, LockRequest* request, LockMode mo
     }
 
     request->partitioned = false;
-    return lock->newRequest(request);
+    return lock->newRequest(request, fastPathModes);
 }
 
 bool LockManager::unlock(LockRequest* request) {
     invariant(request->recursiveCount > 0);
     request->recursiveCount--;
 
+    if (request->fastPath) {
+        invariant(request->status == LockRequest::STATUS_GRANTED);
+        if (request->recursiveCount > 0)
+            return false;
+
+        const ResourceId resId(RESOURCE_GLOBAL, request->fastPathGlobalId);
+        FastPathState* state = _getFastPathState(resId);
+        state->slots[request->fastPathSlot].granted[request->mode - MODE_IS].subtractAndFetch(1);
+
+        // A conflicting request may be waiting on this grant, and it can only be woken up from
+        // under the bucket mutex.
+        if (state->slowPath.load()) {
+            _onFastPathRelease(resId, state);
+        }
+        return true;
+    }
+
     if (request->partitioned) {
         // Unlocking a lock that was acquired as partitioned. The lock request may since have
         // moved to the lock head, but there is no safe way to find out without synchronizing
@@ -586,11 +629,12 @@ bool LockManager::unlock(LockRequest* request) {
         MONGO_UNREACHABLE;
     }
 
+    _maybeResumeFastPath(lock);
+
     return (request->recursiveCount == 0);
 }
 
 void LockManager::downgrade(LockRequest* request, LockMode newMode) {
-    invariant(request->lock);
     invariant(request->recursiveCount > 0);
 
     // The conflict set of the newMode should be a subset of the conflict set of the old mode.
@@ -598,6 +642,25 @@ void LockManager::downgrade(LockRequest* request, LockMode newMode) {
     invariant((LockConflictsTable[request->mode] | LockConflictsTable[newMode]) ==
               LockConflictsTable[request->mode]);
 
+    if (request->fastPath) {
+        // Only IX -> IS is possible here. Counting the new mode before releasing the old one keeps
+        // the request visible to any concurrent conflicting request.
+        invariant(newMode == MODE_IS || newMode == MODE_IX);
+        const ResourceId resId(RESOURCE_GLOBAL, request->fastPathGlobalId);
+        FastPathState* state = _getFastPathState(resId);
+        auto& slot = state->slots[request->fastPathSlot];
+        slot.granted[newMode - MODE_IS].addAndFetch(1);
+        slot.granted[request->mode - MODE_IS].subtractAndFetch(1);
+        request->mode = newMode;
+
+        if (state->slowPath.load()) {
+            _onFastPathRelease(resId, state);
+        }
+        return;
+    }
+
+    invariant(request->lock);
+
     LockHead* lock = request->lock;
 
     LockBucket* bucket = _getBucket(lock->resourceId);
@@ -609,6 +672,7 @@ void LockManager::downgrade(LockRequest* request, LockMode newMode) {
     request->mode = newMode;
 
     _onLockModeChanged(lock, true);
+    _maybeResumeFastPath(lock);
 }
 
 void LockManager::cleanupUnusedLocks() {
@@ -628,7 +692,9 @@ void LockManager::_cleanupUnusedLocksInBucket(LockBucket* bucket) {
             lock->migratePartitionedLockHeads();
         }
 
-        if (lock->grantedModes == 0) {
+        // A request may be waiting only behind fast path grants, so the LockHead must not be
+        // reclaimed until its conflict queue is empty as well.
+        if (lock->grantedModes == 0 && lock->conflictModes == 0) {
             invariant(lock->grantedModes == 0);
             invariant(lock->grantedList._front == nullptr);
             invariant(lock->grantedList._back == nullptr);
@@ -647,6 +713,9 @@ void LockManager::_cleanupUnusedLocksInBucket(LockBucket* bucket) {
 }
 
 void LockManager::_onLockModeChanged(LockHead* lock, bool checkConflictQueue) {
+    // Intent modes granted through the fast path are not on the granted queue, but still conflict.
+    const uint32_t fastPathModes = _fastPathGrantedModes(lock->resourceId);
+
     // Unblock any converting requests (because conversions are still counted as granted and
     // are on the granted queue).
     for (LockRequest* iter = lock->grantedList._front;
@@ -658,7 +727,7 @@ void LockManager::_onLockModeChanged(LockHead* lock, bool checkConflictQueue) {
 
             // Construct granted mask without our current mode, so that it is not accounted as
             // a conflict
-            uint32_t grantedModesWithoutCurrentRequest = 0;
+            uint32_t grantedModesWithoutCurrentRequest = fastPathModes;
 
             // We start the counting at 1 below, because LockModesCount also includes
             // MODE_NONE at position 0, which can never be acquired/granted.
@@ -716,7 +785,7 @@ void LockManager::_onLockModeChanged(LockHead* lock, bool checkConflictQueue) {
         // the granted queue.
         iterNext = iter->next;
 
-        if (conflicts(iter->mode, lock->grantedModes)) {
+        if (conflicts(iter->mode, lock->grantedModes | fastPathModes)) {
             // If iter doesn't have a previous pointer, this means that it is at the front of the
             // queue. If we continue scanning the queue beyond this point, we will starve it by
             // granting more and more requests. However, if we newly transition to compatibleFirst
@@ -756,6 +825,81 @@ void LockManager::_onLockModeChanged(LockHead* lock, bool checkConflictQueue) {
     invariant((lock->conflictModes == 0) ^ (lock->conflictList._front != nullptr));
 }
 
+LockManager::FastPathState* LockManager::_getFastPathState(ResourceId resId) const {
+    if (resId.getType() != RESOURCE_GLOBAL || resId.getHashId() >= _fastPathStates.size()) {
+        return nullptr;
+    }
+    return &_fastPathStates[resId.getHashId()];
+}
+
+bool LockManager::_tryLockFastPath(ResourceId resId, FastPathState* state, LockRequest* request) {
+    if (state->slowPath.load()) {
+        return false;
+    }
+
+    const size_t slotIndex = request->locker->getId() % FastPathState::kNumSlots;
+    auto& counter = state->slots[slotIndex].granted[request->mode - MODE_IS];
+    counter.addAndFetch(1);
+
+    // A conflicting request may have switched the resource to the slow path after the check above
+    // and may have already read this counter, so it must be woken up after backing out.
+    if (MONGO_unlikely(state->slowPath.load())) {
+        counter.subtractAndFetch(1);
+        _onFastPathRelease(resId, state);
+        return false;
+    }
+
+    request->status = LockRequest::STATUS_GRANTED;
+    request->fastPath = true;
+    request->fastPathSlot = slotIndex;
+    request->fastPathGlobalId = resId.getHashId();
+    return true;
+}
+
+uint32_t LockManager::_fastPathGrantedModes(ResourceId resId) const {
+    const FastPathState* state = _getFastPathState(resId);
+    if (!state || !state->slowPath.load()) {
+        return 0;
+    }
+
+    uint32_t modes = 0;
+    for (const auto& slot : state->slots) {
+        if (slot.granted[0].load() > 0) {
+            modes |= modeMask(MODE_IS);
+        }
+        if (slot.granted[1].load() > 0) {
+            modes |= modeMask(MODE_IX);
+        }
+    }
+    return modes;
+}
+
+void LockManager::_onFastPathRelease(ResourceId resId, FastPathState* state) {
+    LockBucket* bucket = _getBucket(resId);
+    stdx::lock_guard<SimpleMutex> scopedLock(bucket->mutex);
+
+    const auto it = bucket->data.find(resId);
+    if (it == bucket->data.end()) {
+        // Without a LockHead there are no non-intent requests left to wait for.
+        state->slowPath.store(false);
+        return;
+    }
+
+    _onLockModeChanged(it->second, true);
+    _maybeResumeFastPath(it->second);
+}
+
+void LockManager::_maybeResumeFastPath(LockHead* lock) {
+    FastPathState* state = _getFastPathState(lock->resourceId);
+    if (!state || !state->slowPath.loadRelaxed()) {
+        return;
+    }
+
+    if (!((lock->grantedModes | lock->conflictModes) & ~intentModes)) {
+        state->slowPath.store(false);
+    }
+}
+
 LockManager::LockBucket* LockManager::_getBucket(ResourceId resId) const {
     return &_lockBuckets[resId % _numLockBuckets];
 }
@@ -765,7 +909,12 @@ LockManager::Partition* LockManager::_getPartition(LockRequest* request) const {
 }
 
 bool LockManager::hasConflictingRequests(ResourceId resId, const LockRequest* request) const {
-    stdx::lock_guard<SimpleMutex> lk(_getBucket(resId)->mutex);
+    LockBucket* bucket = _getBucket(resId);
+    stdx::lock_guard<SimpleMutex> lk(bucket->mutex);
+    if (request->fastPath) {
+        const auto it = bucket->data.find(resId);
+        return it != bucket->data.end() && !it->second->conflictList.empty();
+    }
     return request->lock ? !request->lock->conflictList.empty() : false;
 }
 
@@ -888,6 +1037,9 @@ void LockRequest::initNew(Locker* locker, LockGrantNotification* notify) {
     next = nullptr;
     status = STATUS_NEW;
     partitioned = false;
+    fastPath = false;
+    fastPathSlot = 0;
+    fastPathGlobalId = 0;
     mode = MODE_NONE;
     convertMode = MODE_NONE;
     unlockPending = 0;
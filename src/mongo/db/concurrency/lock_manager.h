@@ -29,6 +29,7 @@
 
 #pragma once
 
+#include <array>
 #include <cstdint>
 #include <deque>
 #include <map>
@@ -45,6 +46,7 @@
 #include "mongo/platform/compiler.h"
 #include "mongo/platform/mutex.h"
 #include "mongo/stdx/condition_variable.h"
+#include "mongo/stdx/new.h"
 #include "mongo/stdx/unordered_map.h"
 #include "mongo/util/concurrency/mutex.h"
 
@@ -180,6 +182,60 @@ private:
         Map data;
     };
 
+    // Global resources are requested in an intent mode by nearly every operation and almost never
+    // in S or X, so their IS and IX grants are tracked as plain counters instead of LockRequests on
+    // a LockHead. Each locker maps to one of the cache-line aligned slots, so uncontended intent
+    // acquisitions never take a mutex. The first non-intent request sets 'slowPath' under the
+    // bucket mutex, after which new intent requests are queued on the LockHead as usual and the
+    // counters only drain. The fast path resumes once the LockHead holds no S or X modes again.
+    struct FastPathState {
+        static constexpr size_t kNumSlots = 32;
+
+        struct alignas(stdx::hardware_destructive_interference_size) Slot {
+            // Number of requests granted through this slot, indexed by MODE_IS and MODE_IX
+            // relative to MODE_IS.
+            AtomicWord<int64_t> granted[2];
+        };
+
+        AtomicWord<bool> slowPath{false};
+        Slot slots[kNumSlots];
+    };
+
+    /**
+     * Returns the fast path state for the resource, or nullptr if the resource does not use the
+     * intent lock fast path.
+     */
+    FastPathState* _getFastPathState(ResourceId resId) const;
+
+    /**
+     * Attempts to grant an intent mode request without taking any mutex. Returns false if the
+     * resource is currently in slow path mode, in which case the request must go to the LockHead.
+     */
+    bool _tryLockFastPath(ResourceId resId, FastPathState* state, LockRequest* request);
+
+    /**
+     * Returns the mask of intent modes currently granted through the fast path counters for the
+     * resource. The counters are only consulted once 'slowPath' has been set, because until then
+     * no conflicting request can exist.
+     *
+     * Should be called under the lock bucket's mutex.
+     */
+    uint32_t _fastPathGrantedModes(ResourceId resId) const;
+
+    /**
+     * Called after a fast path grant has been released while the resource was in slow path mode,
+     * so that requests that were blocked on it may be granted.
+     */
+    void _onFastPathRelease(ResourceId resId, FastPathState* state);
+
+    /**
+     * Switches the resource back to the fast path if its LockHead no longer holds or waits for any
+     * non-intent modes.
+     *
+     * MUST be called under the lock bucket's mutex.
+     */
+    void _maybeResumeFastPath(LockHead* lock);
+
     /**
      * Retrieves the bucket in which the particular resource must reside. There is no need to
      * hold a lock when calling this function.
@@ -216,5 +272,9 @@ private:
 
     static const unsigned _numPartitions;
     Partition* _partitions;
+
+    // One entry per RESOURCE_GLOBAL resource, indexed by ResourceGlobalId.
+    mutable std::array<FastPathState, static_cast<size_t>(ResourceGlobalId::kNumIds)>
+        _fastPathStates;
 };
 }  // namespace mongo
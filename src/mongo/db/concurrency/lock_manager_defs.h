@@ -450,6 +450,17 @@ struct LockRequest {
     // No synchronization
     bool partitioned : 1;
 
+    // When set, this request was granted through the lock-free intent fast path and is not on any
+    // LockHead or PartitionedLockHead. It is only counted in the slot 'fastPathSlot' of the global
+    // resource 'fastPathGlobalId' and never migrates to a LockHead.
+    //
+    // Written by LockManager on Locker thread
+    // Read by LockManager on Locker thread
+    // No synchronization
+    bool fastPath : 1;
+    uint8_t fastPathSlot;
+    uint8_t fastPathGlobalId;
+
     // The current status of this request. Always starts at STATUS_NEW.
     //
     // Written by LockManager on any thread
@@ -785,6 +785,64 @@ TEST_F(LockManagerTest, HasConflictingRequests) {
     ASSERT(lockMgr.unlock(&requestX));
 }
 
+TEST_F(LockManagerTest, FastPathIntentLocksBlockExclusive) {
+    LockManager lockMgr;
+    const ResourceId resId(RESOURCE_GLOBAL, 0);
+
+    // Uncontended intent locks are granted through the fast path
+    Locker lockerIS(getServiceContext());
+    LockRequestCombo requestIS(&lockerIS);
+    ASSERT(LOCK_OK == lockMgr.lock(resId, &requestIS, MODE_IS));
+
+    Locker lockerIX(getServiceContext());
+    LockRequestCombo requestIX(&lockerIX);
+    ASSERT(LOCK_OK == lockMgr.lock(resId, &requestIX, MODE_IX));
+
+    // An S request must still see the IX grant, but not the IS one
+    Locker lockerS(getServiceContext());
+    LockRequestCombo requestS(&lockerS);
+    ASSERT(LOCK_WAITING == lockMgr.lock(resId, &requestS, MODE_S));
+    ASSERT_TRUE(lockMgr.hasConflictingRequests(resId, &requestIS));
+
+    // While the S request is pending, new intent requests queue behind it
+    Locker lockerIS1(getServiceContext());
+    LockRequestCombo requestIS1(&lockerIS1);
+    ASSERT(LOCK_OK == lockMgr.lock(resId, &requestIS1, MODE_IS));
+
+    Locker lockerIX1(getServiceContext());
+    LockRequestCombo requestIX1(&lockerIX1);
+    ASSERT(LOCK_WAITING == lockMgr.lock(resId, &requestIX1, MODE_IX));
+
+    // Releasing the fast path IX grant wakes up the S request
+    ASSERT(lockMgr.unlock(&requestIX));
+    ASSERT_EQ(LOCK_OK, requestS.lastResult);
+    ASSERT_EQ(1, requestS.numNotifies);
+    ASSERT_EQ(0, requestIX1.numNotifies);
+
+    ASSERT(lockMgr.unlock(&requestS));
+    ASSERT_EQ(LOCK_OK, requestIX1.lastResult);
+    ASSERT_EQ(1, requestIX1.numNotifies);
+
+    ASSERT(lockMgr.unlock(&requestIS));
+    ASSERT(lockMgr.unlock(&requestIS1));
+    ASSERT(lockMgr.unlock(&requestIX1));
+
+    // With no conflicting modes left, intent requests use the fast path again
+    Locker lockerIX2(getServiceContext());
+    LockRequestCombo requestIX2(&lockerIX2);
+    ASSERT(LOCK_OK == lockMgr.lock(resId, &requestIX2, MODE_IX));
+    ASSERT_FALSE(lockMgr.hasConflictingRequests(resId, &requestIX2));
+
+    Locker lockerX(getServiceContext());
+    LockRequestCombo requestX(&lockerX);
+    ASSERT(LOCK_WAITING == lockMgr.lock(resId, &requestX, MODE_X));
+    ASSERT_TRUE(lockMgr.hasConflictingRequests(resId, &requestIX2));
+
+    ASSERT(lockMgr.unlock(&requestIX2));
+    ASSERT_EQ(LOCK_OK, requestX.lastResult);
+    ASSERT(lockMgr.unlock(&requestX));
+}
+
 }  // namespace lock_manager_test
 
 }  // namespace
@@ -31,6 +31,7 @@
 
 #include "mongo/bson/json.h"
 #include "mongo/db/admission/ticketholder_manager.h"
+#include "mongo/db/concurrency/contention_profiler.h"
 #include "mongo/db/dump_lock_manager.h"
 #include "mongo/db/operation_context.h"
 #include "mongo/db/storage/recovery_unit.h"
@@ -980,6 +981,13 @@ void Locker::_lockComplete(OperationContext* opCtx,
     invariant(result == LOCK_OK);
     unlockOnErrorGuard.dismiss();
 
+    if (ContentionProfiler::isEnabled()) {
+        ContentionProfiler::get().onWait(
+            ContentionProfiler::Source::kLock,
+            resourceTypeName(resId.getType()),
+            Microseconds(static_cast<long long>(curTimeMicros64() - startOfTotalWaitTime)));
+    }
+
     _setWaitingResource(ResourceId());
 }
 
@@ -999,10 +1007,17 @@ bool Locker::_acquireTicket(OperationContext* opCtx, LockMode mode, Date_t deadl
         // hole.
         invariant(!shard_role_details::getRecoveryUnit(opCtx)->isTimestamped());
 
+        const uint64_t waitStartMicros = ContentionProfiler::isEnabled() ? curTimeMicros64() : 0;
         if (auto ticket = holder->waitForTicketUntil(
                 _uninterruptibleLocksRequested ? *Interruptible::notInterruptible() : *opCtx,
                 &ExecutionAdmissionContext::get(opCtx),
                 deadline)) {
+            if (waitStartMicros) {
+                ContentionProfiler::get().onWait(
+                    ContentionProfiler::Source::kTicket,
+                    reader ? "read"_sd : "write"_sd,
+                    Microseconds(static_cast<long long>(curTimeMicros64() - waitStartMicros)));
+            }
             // TODO(SERVER-88732): Remove `_timeQueuedForTicketMicros` when we only track admission
             // context for waiting metrics.
             _timeQueuedForTicketMicros =
@@ -0,0 +1,142 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/db/concurrency/write_conflict_hot_records.h"
+
+#include <algorithm>
+
+#include "mongo/db/commands/server_status.h"
+#include "mongo/db/concurrency/exception_util_gen.h"
+#include "mongo/util/namespace_string_util.h"
+
+namespace mongo {
+namespace {
+
+WriteConflictHotRecords globalWriteConflictHotRecords;
+
+/**
+ * Reports the most write-conflicted records. The section is not included by default as it exposes
+ * namespaces and record ids.
+ */
+class WriteConflictHotRecordsSSS : public ServerStatusSection {
+public:
+    using ServerStatusSection::ServerStatusSection;
+
+    static constexpr size_t kReportLimit = 10;
+
+    bool includeByDefault() const override {
+        return false;
+    }
+
+    BSONObj generateSection(OperationContext* opCtx, const BSONElement& configElem) const override {
+        const auto& hotRecords = WriteConflictHotRecords::get();
+        BSONObjBuilder bob;
+        bob.appendNumber("sampled", hotRecords.getSampledCount());
+        hotRecords.report("records", kReportLimit, &bob);
+        return bob.obj();
+    }
+};
+auto& writeConflictHotRecordsSSS =
+    *ServerStatusSectionBuilder<WriteConflictHotRecordsSSS>("writeConflictHotRecords");
+
+}  // namespace
+
+WriteConflictHotRecords& WriteConflictHotRecords::get() {
+    return globalWriteConflictHotRecords;
+}
+
+void WriteConflictHotRecords::onWriteConflict(const NamespaceString& nss,
+                                              const RecordId& recordId) {
+    const long long interval = gWriteConflictHotRecordsSamplingInterval.load();
+    if (interval <= 0 || _seen.fetchAndAddRelaxed(1) % interval != 0) {
+        return;
+    }
+    record(nss, recordId);
+}
+
+void WriteConflictHotRecords::record(const NamespaceString& nss, const RecordId& recordId) {
+    _sampled.fetchAndAddRelaxed(1);
+
+    stdx::lock_guard<Latch> lk(_mutex);
+    auto it = std::find_if(_entries.begin(), _entries.end(), [&](const Entry& entry) {
+        return entry.recordId == recordId && entry.nss == nss;
+    });
+    if (it != _entries.end()) {
+        ++it->conflicts;
+        return;
+    }
+
+    if (_entries.size() < _capacity) {
+        _entries.push_back({nss, recordId.getOwned(), 1});
+        return;
+    }
+
+    // Evict the coldest entry. The new entry inherits its count, which bounds the error of the
+    // count of any record which is tracked.
+    auto coldest =
+        std::min_element(_entries.begin(), _entries.end(), [](const Entry& a, const Entry& b) {
+            return a.conflicts < b.conflicts;
+        });
+    *coldest = {nss, recordId.getOwned(), coldest->conflicts + 1};
+}
+
+void WriteConflictHotRecords::report(StringData fieldName,
+                                     size_t limit,
+                                     BSONObjBuilder* builder) const {
+    std::vector<Entry> entries;
+    {
+        stdx::lock_guard<Latch> lk(_mutex);
+        entries = _entries;
+    }
+
+    std::stable_sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) {
+        return a.conflicts > b.conflicts;
+    });
+    if (entries.size() > limit) {
+        entries.resize(limit);
+    }
+
+    BSONArrayBuilder arr(builder->subarrayStart(fieldName));
+    for (const auto& entry : entries) {
+        BSONObjBuilder entryBuilder(arr.subobjStart());
+        entryBuilder.append(
+            "ns", NamespaceStringUtil::serialize(entry.nss, SerializationContext::stateDefault()));
+        entry.recordId.serializeToken("recordId", &entryBuilder);
+        entryBuilder.appendNumber("conflicts", entry.conflicts);
+    }
+}
+
+void WriteConflictHotRecords::clear() {
+    stdx::lock_guard<Latch> lk(_mutex);
+    _entries.clear();
+    _seen.store(0);
+    _sampled.store(0);
+}
+
+}  // namespace mongo
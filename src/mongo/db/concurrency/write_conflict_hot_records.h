@@ -0,0 +1,99 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/db/namespace_string.h"
+#include "mongo/db/record_id.h"
+#include "mongo/platform/atomic_word.h"
+#include "mongo/platform/mutex.h"
+
+namespace mongo {
+
+/**
+ * Tracks the records which most often fail to be written because of a write conflict, so that
+ * contended documents can be identified rather than only counted.
+ *
+ * Only every 'writeConflictHotRecordsSamplingInterval'th conflict is recorded. The tracker keeps a
+ * bounded number of entries using the space-saving algorithm: once full, a newly sampled record
+ * replaces the entry with the lowest count and inherits that count, so the reported counts are an
+ * upper bound on the number of sampled conflicts for a record.
+ */
+class WriteConflictHotRecords {
+public:
+    static constexpr size_t kDefaultCapacity = 32;
+
+    explicit WriteConflictHotRecords(size_t capacity = kDefaultCapacity) : _capacity(capacity) {}
+
+    static WriteConflictHotRecords& get();
+
+    /**
+     * Notes that writing 'recordId' in 'nss' failed with a write conflict. Only a sample of the
+     * calls is recorded.
+     */
+    void onWriteConflict(const NamespaceString& nss, const RecordId& recordId);
+
+    /**
+     * Records a write conflict on 'recordId' in 'nss' without sampling.
+     */
+    void record(const NamespaceString& nss, const RecordId& recordId);
+
+    /**
+     * Appends up to 'limit' of the hottest records, in descending order of conflicts, as an array
+     * named 'fieldName'.
+     */
+    void report(StringData fieldName, size_t limit, BSONObjBuilder* builder) const;
+
+    long long getSampledCount() const {
+        return _sampled.loadRelaxed();
+    }
+
+    void clear();
+
+private:
+    struct Entry {
+        NamespaceString nss;
+        RecordId recordId;
+        long long conflicts;
+    };
+
+    const size_t _capacity;
+
+    AtomicWord<long long> _seen{0};
+    AtomicWord<long long> _sampled{0};
+
+    mutable Mutex _mutex = MONGO_MAKE_LATCH("WriteConflictHotRecords::_mutex");
+    std::vector<Entry> _entries;
+};
+
+}  // namespace mongo
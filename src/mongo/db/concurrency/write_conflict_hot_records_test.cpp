@@ -0,0 +1,109 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/db/concurrency/write_conflict_hot_records.h"
+
+#include "mongo/bson/bsonobj.h"
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/unittest/assert.h"
+#include "mongo/unittest/framework.h"
+
+namespace mongo {
+namespace {
+
+const NamespaceString kNss = NamespaceString::createNamespaceString_forTest("test", "coll");
+const NamespaceString kOtherNss = NamespaceString::createNamespaceString_forTest("test", "other");
+
+BSONObj reportHotRecords(const WriteConflictHotRecords& hotRecords, size_t limit) {
+    BSONObjBuilder bob;
+    hotRecords.report("records", limit, &bob);
+    return bob.obj();
+}
+
+TEST(WriteConflictHotRecordsTest, ReportsRecordsInDescendingOrderOfConflicts) {
+    WriteConflictHotRecords hotRecords;
+    hotRecords.record(kNss, RecordId(1));
+    for (int i = 0; i < 3; ++i) {
+        hotRecords.record(kNss, RecordId(2));
+    }
+    hotRecords.record(kOtherNss, RecordId(2));
+    hotRecords.record(kOtherNss, RecordId(2));
+
+    ASSERT_EQ(6, hotRecords.getSampledCount());
+    auto records = reportHotRecords(hotRecords, 10)["records"].Array();
+    ASSERT_EQ(3U, records.size());
+
+    ASSERT_EQ("test.coll", records[0]["ns"].str());
+    ASSERT_EQ(RecordId(2), RecordId::deserializeToken(records[0]["recordId"]));
+    ASSERT_EQ(3, records[0]["conflicts"].numberLong());
+
+    ASSERT_EQ("test.other", records[1]["ns"].str());
+    ASSERT_EQ(RecordId(2), RecordId::deserializeToken(records[1]["recordId"]));
+    ASSERT_EQ(2, records[1]["conflicts"].numberLong());
+
+    ASSERT_EQ(RecordId(1), RecordId::deserializeToken(records[2]["recordId"]));
+    ASSERT_EQ(1, records[2]["conflicts"].numberLong());
+}
+
+TEST(WriteConflictHotRecordsTest, ReportIsLimited) {
+    WriteConflictHotRecords hotRecords;
+    for (int i = 0; i < 5; ++i) {
+        hotRecords.record(kNss, RecordId(i));
+    }
+    ASSERT_EQ(2U, reportHotRecords(hotRecords, 2)["records"].Array().size());
+}
+
+TEST(WriteConflictHotRecordsTest, EvictsColdestRecordWhenFull) {
+    WriteConflictHotRecords hotRecords(2);
+    hotRecords.record(kNss, RecordId(1));
+    hotRecords.record(kNss, RecordId(1));
+    hotRecords.record(kNss, RecordId(2));
+
+    // RecordId(3) replaces RecordId(2) and inherits its count.
+    hotRecords.record(kNss, RecordId(3));
+
+    auto records = reportHotRecords(hotRecords, 10)["records"].Array();
+    ASSERT_EQ(2U, records.size());
+    ASSERT_EQ(RecordId(1), RecordId::deserializeToken(records[0]["recordId"]));
+    ASSERT_EQ(2, records[0]["conflicts"].numberLong());
+    ASSERT_EQ(RecordId(3), RecordId::deserializeToken(records[1]["recordId"]));
+    ASSERT_EQ(2, records[1]["conflicts"].numberLong());
+}
+
+TEST(WriteConflictHotRecordsTest, ClearRemovesRecords) {
+    WriteConflictHotRecords hotRecords;
+    hotRecords.record(kNss, RecordId(1));
+    hotRecords.clear();
+
+    ASSERT_EQ(0, hotRecords.getSampledCount());
+    ASSERT_EQ(0U, reportHotRecords(hotRecords, 10)["records"].Array().size());
+}
+
+}  // namespace
+}  // namespace mongo
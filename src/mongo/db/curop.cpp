@@ -406,6 +406,21 @@ void CurOp::setEndOfOpMetrics(long long nreturned) {
     // set here will be overwritten later in completeAndLogOperation.
     if (_debug.queryStatsInfo.keyHash) {
         _debug.additiveMetrics.executionTime = elapsedTimeExcludingPauses();
+
+        if (_cpuTimer) {
+            _debug.additiveMetrics.cpuTime = _cpuTimer->getElapsed();
+        }
+
+        auto locker = shard_role_details::getLocker(opCtx());
+        _debug.additiveMetrics.ticketWaitTime =
+            locker->getTimeQueuedForTicketMicros() - _ticketWaitBase + _ticketWaitWhenStashed;
+
+        auto lockStats = locker->getLockerInfo(_lockStatsBase).stats;
+        if (_lockStatsOnceStashed) {
+            lockStats.append(_lockStatsOnceStashed.get());
+        }
+        _debug.additiveMetrics.lockWaitTime =
+            Microseconds(lockStats.getCumulativeWaitTimeMicros());
     }
 }
 
@@ -2148,6 +2163,9 @@ void OpDebug::AdditiveMetrics::add(const AdditiveMetrics& otherMetrics) {
     writeConflicts.fetchAndAdd(otherMetrics.writeConflicts.load());
     temporarilyUnavailableErrors.fetchAndAdd(otherMetrics.temporarilyUnavailableErrors.load());
     executionTime = addOptionals(executionTime, otherMetrics.executionTime);
+    cpuTime = addOptionals(cpuTime, otherMetrics.cpuTime);
+    lockWaitTime = addOptionals(lockWaitTime, otherMetrics.lockWaitTime);
+    ticketWaitTime = addOptionals(ticketWaitTime, otherMetrics.ticketWaitTime);
 
     hasSortStage = hasSortStage || otherMetrics.hasSortStage;
     usedDisk = usedDisk || otherMetrics.usedDisk;
@@ -2210,6 +2228,9 @@ void OpDebug::AdditiveMetrics::reset() {
     writeConflicts.store(0);
     temporarilyUnavailableErrors.store(0);
     executionTime = boost::none;
+    cpuTime = boost::none;
+    lockWaitTime = boost::none;
+    ticketWaitTime = boost::none;
 }
 
 bool OpDebug::AdditiveMetrics::equals(const AdditiveMetrics& otherMetrics) const {
@@ -2222,7 +2243,8 @@ bool OpDebug::AdditiveMetrics::equals(const AdditiveMetrics& otherMetrics) const
         prepareReadConflicts.load() == otherMetrics.prepareReadConflicts.load() &&
         writeConflicts.load() == otherMetrics.writeConflicts.load() &&
         temporarilyUnavailableErrors.load() == otherMetrics.temporarilyUnavailableErrors.load() &&
-        executionTime == otherMetrics.executionTime;
+        executionTime == otherMetrics.executionTime && cpuTime == otherMetrics.cpuTime &&
+        lockWaitTime == otherMetrics.lockWaitTime && ticketWaitTime == otherMetrics.ticketWaitTime;
 }
 
 void OpDebug::AdditiveMetrics::incrementWriteConflicts(long long n) {
@@ -241,6 +241,12 @@ public:
         // Amount of time spent executing a query.
         boost::optional<Microseconds> executionTime;
 
+        // Time spent on the CPU, waiting to acquire locks and queued for execution tickets. These
+        // are only recorded for operations tracked by query stats.
+        boost::optional<Nanoseconds> cpuTime;
+        boost::optional<Microseconds> lockWaitTime;
+        boost::optional<Microseconds> ticketWaitTime;
+
         // True if the query plan involves an in-memory sort.
         bool hasSortStage{false};
         // True if the given query used disk.
@@ -94,6 +94,12 @@ TEST(CurOpTest, AddingAdditiveMetricsObjectsTogetherShouldAddFieldsTogether) {
     additiveMetricsToAdd.keysDeleted = 2;
     currentAdditiveMetrics.executionTime = Microseconds{200};
     additiveMetricsToAdd.executionTime = Microseconds{80};
+    currentAdditiveMetrics.cpuTime = Nanoseconds{3000};
+    additiveMetricsToAdd.cpuTime = Nanoseconds{500};
+    currentAdditiveMetrics.lockWaitTime = Microseconds{40};
+    additiveMetricsToAdd.lockWaitTime = Microseconds{10};
+    currentAdditiveMetrics.ticketWaitTime = Microseconds{0};
+    additiveMetricsToAdd.ticketWaitTime = Microseconds{25};
     currentAdditiveMetrics.prepareReadConflicts.store(1);
     additiveMetricsToAdd.prepareReadConflicts.store(5);
     currentAdditiveMetrics.writeConflicts.store(7);
@@ -129,6 +135,12 @@ TEST(CurOpTest, AddingAdditiveMetricsObjectsTogetherShouldAddFieldsTogether) {
               *additiveMetricsBeforeAdd.keysDeleted + *additiveMetricsToAdd.keysDeleted);
     ASSERT_EQ(*currentAdditiveMetrics.executionTime,
               *additiveMetricsBeforeAdd.executionTime + *additiveMetricsToAdd.executionTime);
+    ASSERT_EQ(*currentAdditiveMetrics.cpuTime,
+              *additiveMetricsBeforeAdd.cpuTime + *additiveMetricsToAdd.cpuTime);
+    ASSERT_EQ(*currentAdditiveMetrics.lockWaitTime,
+              *additiveMetricsBeforeAdd.lockWaitTime + *additiveMetricsToAdd.lockWaitTime);
+    ASSERT_EQ(*currentAdditiveMetrics.ticketWaitTime,
+              *additiveMetricsBeforeAdd.ticketWaitTime + *additiveMetricsToAdd.ticketWaitTime);
     ASSERT_EQ(currentAdditiveMetrics.prepareReadConflicts.load(),
               additiveMetricsBeforeAdd.prepareReadConflicts.load() +
                   additiveMetricsToAdd.prepareReadConflicts.load());
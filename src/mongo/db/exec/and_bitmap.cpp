@@ -0,0 +1,286 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/db/exec/and_bitmap.h"
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+
+#include "mongo/base/error_codes.h"
+#include "mongo/bson/util/builder.h"
+#include "mongo/bson/util/builder_fwd.h"
+#include "mongo/db/exec/working_set.h"
+#include "mongo/util/assert_util.h"
+
+namespace {
+
+// Upper limit for the RecordId sets. Stage execution will fail once they exceed this threshold.
+// This is the same limit as AndHashStage's, which buffers whole WorkingSetMembers instead.
+const size_t kDefaultMaxMemUsageBytes = 32 * 1024 * 1024;
+
+}  // namespace
+
+namespace mongo {
+
+const size_t AndBitmapStage::kLookAheadWorks = 10;
+
+// static
+const char* AndBitmapStage::kStageType = "AND_BITMAP";
+
+void AndBitmapStage::RecordIdSet::add(const RecordId& recordId) {
+    if (recordId.isLong()) {
+        _bitmap.add(static_cast<uint64_t>(recordId.getLong()));
+    } else if (_others.insert(recordId).second) {
+        _othersMemUsage += recordId.memUsage();
+    }
+}
+
+bool AndBitmapStage::RecordIdSet::contains(const RecordId& recordId) const {
+    return recordId.isLong() ? _bitmap.contains(static_cast<uint64_t>(recordId.getLong()))
+                             : _others.contains(recordId);
+}
+
+bool AndBitmapStage::RecordIdSet::remove(const RecordId& recordId) {
+    if (recordId.isLong()) {
+        return _bitmap.removeChecked(static_cast<uint64_t>(recordId.getLong()));
+    }
+    if (_others.erase(recordId) == 0) {
+        return false;
+    }
+    _othersMemUsage -= recordId.memUsage();
+    return true;
+}
+
+bool AndBitmapStage::RecordIdSet::empty() const {
+    return _bitmap.empty() && _others.empty();
+}
+
+size_t AndBitmapStage::RecordIdSet::size() const {
+    return _bitmap.cardinality() + _others.size();
+}
+
+size_t AndBitmapStage::RecordIdSet::getMemUsage() const {
+    return _bitmap.getSizeInBytes() + _othersMemUsage;
+}
+
+AndBitmapStage::AndBitmapStage(ExpressionContext* expCtx, WorkingSet* ws)
+    : AndBitmapStage(expCtx, ws, kDefaultMaxMemUsageBytes) {}
+
+AndBitmapStage::AndBitmapStage(ExpressionContext* expCtx, WorkingSet* ws, size_t maxMemUsage)
+    : PlanStage(kStageType, expCtx),
+      _ws(ws),
+      _readingChildren(true),
+      _currentChild(0),
+      _maxMemUsage(maxMemUsage) {}
+
+void AndBitmapStage::addChild(std::unique_ptr<PlanStage> child) {
+    _children.emplace_back(std::move(child));
+}
+
+size_t AndBitmapStage::getMemUsage() const {
+    return _intersection.getMemUsage() + _seen.getMemUsage();
+}
+
+bool AndBitmapStage::isEOF() {
+    // This is empty before calling work() and not-empty after.
+    if (_lookAheadResults.empty()) {
+        return false;
+    }
+
+    // Either we're busy reading children, in which case we're not done yet.
+    if (_readingChildren) {
+        return false;
+    }
+
+    // Or we're streaming in results from the last child.
+
+    // If there's nothing to probe against, we're EOF.
+    if (_intersection.empty()) {
+        return true;
+    }
+
+    // Otherwise, we're done when the last child is done.
+    invariant(_children.size() >= 2);
+    return (WorkingSet::INVALID_ID == _lookAheadResults[_children.size() - 1]) &&
+        _children[_children.size() - 1]->isEOF();
+}
+
+PlanStage::StageState AndBitmapStage::doWork(WorkingSetID* out) {
+    if (isEOF()) {
+        return PlanStage::IS_EOF;
+    }
+
+    // Fast-path for one of our children being EOF immediately.  We work each child a few times.
+    // If it hits EOF, the AND cannot output anything.  If it produces a result, we stash that
+    // result in _lookAheadResults.
+    if (_lookAheadResults.empty()) {
+        _lookAheadResults.resize(_children.size(), WorkingSet::INVALID_ID);
+
+        for (size_t i = 0; i < _children.size(); ++i) {
+            auto& child = _children[i];
+            for (size_t j = 0; j < kLookAheadWorks; ++j) {
+                StageState childStatus = child->work(&_lookAheadResults[i]);
+
+                if (PlanStage::IS_EOF == childStatus) {
+                    // A child went right to EOF.  Bail out.
+                    _readingChildren = false;
+                    return PlanStage::IS_EOF;
+                } else if (PlanStage::ADVANCED == childStatus) {
+                    // Ensure that the data underlying the WorkingSetMember is owned in case we
+                    // yield.
+                    _ws->get(_lookAheadResults[i])->makeObjOwnedIfNeeded();
+                    break;  // Stop looking at this child.
+                }
+                // We ignore NEED_TIME. TODO: what do we want to do if we get NEED_YIELD here?
+            }
+        }
+
+        // We did a bunch of work above, return NEED_TIME to be fair.
+        return PlanStage::NEED_TIME;
+    }
+
+    if (_readingChildren) {
+        const size_t memUsage = getMemUsage();
+        if (memUsage > _maxMemUsage) {
+            StringBuilder sb;
+            sb << "bitmap AND stage buffered data usage of " << memUsage
+               << " bytes exceeds internal limit of " << _maxMemUsage << " bytes";
+            uasserted(ErrorCodes::QueryExceededMemoryLimitNoDiskUseAllowed, sb.str());
+        }
+
+        if (_currentChild < _children.size() - 1) {
+            return readChild(out);
+        }
+
+        // We don't read our last child into a set. Instead, we probe the intersection of the
+        // previous children, returning results in the order of the last child.
+        _readingChildren = false;
+    }
+
+    // We should be EOF if we're not reading children and the intersection is empty.
+    MONGO_verify(!_intersection.empty());
+    MONGO_verify(_currentChild == _children.size() - 1);
+
+    StageState childStatus = workChild(_children.size() - 1, out);
+    if (PlanStage::ADVANCED != childStatus) {
+        return childStatus;
+    }
+
+    // The child must give us a WorkingSetMember with a record id, since we intersect based on the
+    // record id. The planner ensures that the child stage can never produce an WSM with no record
+    // id.
+    WorkingSetMember* member = _ws->get(*out);
+    invariant(member->hasRecordId());
+
+    // Removing the RecordId also makes sure that we output each document at most once.
+    if (!_intersection.remove(member->recordId)) {
+        _ws->free(*out);
+        return PlanStage::NEED_TIME;
+    }
+    return PlanStage::ADVANCED;
+}
+
+PlanStage::StageState AndBitmapStage::workChild(size_t childNo, WorkingSetID* out) {
+    if (WorkingSet::INVALID_ID != _lookAheadResults[childNo]) {
+        *out = _lookAheadResults[childNo];
+        _lookAheadResults[childNo] = WorkingSet::INVALID_ID;
+        return PlanStage::ADVANCED;
+    } else {
+        return _children[childNo]->work(out);
+    }
+}
+
+PlanStage::StageState AndBitmapStage::readChild(WorkingSetID* out) {
+    WorkingSetID id = WorkingSet::INVALID_ID;
+    StageState childStatus = workChild(_currentChild, &id);
+
+    if (PlanStage::ADVANCED == childStatus) {
+        // The child must give us a WorkingSetMember with a record id, since we intersect based on
+        // the record id. The planner ensures that the child stage can never produce an WSM with no
+        // record id.
+        WorkingSetMember* member = _ws->get(id);
+        invariant(member->hasRecordId());
+
+        if (0 == _currentChild) {
+            _intersection.add(member->recordId);
+        } else if (_intersection.contains(member->recordId)) {
+            _seen.add(member->recordId);
+        }
+
+        // Only the RecordId is needed from the first children.
+        _ws->free(id);
+        return PlanStage::NEED_TIME;
+    } else if (PlanStage::IS_EOF == childStatus) {
+        if (_currentChild > 0) {
+            // Keep only the RecordIds which this child has also produced.
+            _intersection = std::move(_seen);
+            _seen = RecordIdSet{};
+        }
+        ++_currentChild;
+
+        _specificStats.mapAfterChild.push_back(_intersection.size());
+        _specificStats.memUsage = std::max(_specificStats.memUsage, getMemUsage());
+
+        // If we have nothing to AND with after finishing any child, stop.
+        if (_intersection.empty()) {
+            _readingChildren = false;
+            return PlanStage::IS_EOF;
+        }
+
+        return PlanStage::NEED_TIME;
+    } else {
+        if (PlanStage::NEED_YIELD == childStatus) {
+            *out = id;
+        }
+
+        return childStatus;
+    }
+}
+
+std::unique_ptr<PlanStageStats> AndBitmapStage::getStats() {
+    _commonStats.isEOF = isEOF();
+
+    _specificStats.memLimit = _maxMemUsage;
+    _specificStats.memUsage = std::max(_specificStats.memUsage, getMemUsage());
+
+    auto ret = std::make_unique<PlanStageStats>(_commonStats, STAGE_AND_BITMAP);
+    ret->specific = std::make_unique<AndHashStats>(_specificStats);
+    for (size_t i = 0; i < _children.size(); ++i) {
+        ret->children.emplace_back(_children[i]->getStats());
+    }
+
+    return ret;
+}
+
+const SpecificStats* AndBitmapStage::getSpecificStats() const {
+    return &_specificStats;
+}
+
+}  // namespace mongo
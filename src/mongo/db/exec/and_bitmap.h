@@ -0,0 +1,142 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "mongo/db/exec/plan_stage.h"
+#include "mongo/db/exec/plan_stats.h"
+#include "mongo/db/exec/working_set.h"
+#include "mongo/db/pipeline/expression_context.h"
+#include "mongo/db/query/stage_types.h"
+#include "mongo/db/record_id.h"
+#include "mongo/stdx/unordered_set.h"
+#include "mongo/util/roaring_bitmaps.h"
+
+namespace mongo {
+
+/**
+ * Reads from N children, each of which must have a valid RecordId, and outputs the results of the
+ * last child whose RecordId was produced by every other child.
+ *
+ * Unlike AndHashStage, the results of the first N-1 children are not kept around: only their
+ * RecordIds are, in a Roaring bitmap (non-integer RecordIds fall back to a hash set). The output
+ * therefore carries the data of the last child only, so this stage is only correct when the
+ * caller does not need index key data from the other children.
+ *
+ * Reports its stats as AndHashStats since it is an alternative implementation of AndHashNode.
+ *
+ * Preconditions: Valid RecordId. More than one child. None of the children provide fetched data.
+ */
+class AndBitmapStage final : public PlanStage {
+public:
+    AndBitmapStage(ExpressionContext* expCtx, WorkingSet* ws);
+
+    /**
+     * For testing only. Allows tests to set memory usage threshold.
+     */
+    AndBitmapStage(ExpressionContext* expCtx, WorkingSet* ws, size_t maxMemUsage);
+
+    void addChild(std::unique_ptr<PlanStage> child);
+
+    /**
+     * Returns memory usage.
+     * For testing only.
+     */
+    size_t getMemUsage() const;
+
+    StageState doWork(WorkingSetID* out) final;
+    bool isEOF() final;
+
+    StageType stageType() const final {
+        return STAGE_AND_BITMAP;
+    }
+
+    std::unique_ptr<PlanStageStats> getStats() final;
+
+    const SpecificStats* getSpecificStats() const final;
+
+    static const char* kStageType;
+
+private:
+    /**
+     * A set of RecordIds which stores integer RecordIds in a bitmap.
+     */
+    class RecordIdSet {
+    public:
+        void add(const RecordId& recordId);
+        bool contains(const RecordId& recordId) const;
+        bool remove(const RecordId& recordId);
+        bool empty() const;
+        size_t size() const;
+        size_t getMemUsage() const;
+
+    private:
+        Roaring64BTree _bitmap;
+        stdx::unordered_set<RecordId, RecordId::Hasher> _others;
+        size_t _othersMemUsage = 0;
+    };
+
+    static const size_t kLookAheadWorks;
+
+    StageState readChild(WorkingSetID* out);
+    StageState workChild(size_t childNo, WorkingSetID* out);
+
+    // Not owned by us.
+    WorkingSet* _ws;
+
+    // We want to see if any of our children are EOF immediately.  This requires working them a
+    // few times to see if they hit EOF or if they produce a result.  If they produce a result,
+    // we place that result here.
+    std::vector<WorkingSetID> _lookAheadResults;
+
+    // The intersection of the RecordIds of _children[0..._currentChild-1].
+    RecordIdSet _intersection;
+
+    // The RecordIds of _children[_currentChild] which are also in '_intersection'. Only used while
+    // _readingChildren.
+    RecordIdSet _seen;
+
+    // True if we're still intersecting _children[0..._children.size()-1].
+    bool _readingChildren;
+
+    // Which child are we currently working on?
+    size_t _currentChild;
+
+    // Stats
+    AndHashStats _specificStats;
+
+    // Upper limit for the memory used by the RecordId sets.
+    size_t _maxMemUsage;
+};
+
+}  // namespace mongo
@@ -0,0 +1,512 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include <cstdint>
+#include <utility>
+
+#include <boost/none.hpp>
+#include <boost/optional/optional.hpp>
+
+#include "mongo/base/error_codes.h"
+#include "mongo/bson/bsonelement.h"
+#include "mongo/bson/bsonobj.h"
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/db/catalog/collection.h"
+#include "mongo/db/commands/server_status.h"
+#include "mongo/db/concurrency/exception_util.h"
+#include "mongo/db/exec/batched_update_stage.h"
+#include "mongo/db/exec/write_stage_common.h"
+#include "mongo/db/namespace_string.h"
+#include "mongo/db/op_observer/batched_write_context.h"
+#include "mongo/db/operation_context.h"
+#include "mongo/db/query/plan_executor.h"
+#include "mongo/db/query/plan_executor_impl.h"
+#include "mongo/db/service_context.h"
+#include "mongo/db/storage/recovery_unit.h"
+#include "mongo/db/storage/snapshot.h"
+#include "mongo/db/storage/write_unit_of_work.h"
+#include "mongo/db/transaction/transaction_operations.h"
+#include "mongo/db/transaction_resources.h"
+#include "mongo/logv2/log.h"
+#include "mongo/logv2/log_component.h"
+#include "mongo/s/shard_version.h"
+#include "mongo/s/stale_exception.h"
+#include "mongo/util/assert_util.h"
+#include "mongo/util/fail_point.h"
+#include "mongo/util/future.h"
+#include "mongo/util/scopeguard.h"
+#include "mongo/util/str.h"
+#include "mongo/util/timer.h"
+
+#define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kWrite
+
+
+namespace mongo {
+
+MONGO_FAIL_POINT_DEFINE(throwWriteConflictExceptionInBatchedUpdateStage);
+
+namespace {
+
+// Size of an array member of an applyOps entry, excluding the update itself. Accounts for the
+// maximum size of the internal fields.
+static size_t kApplyOpsArrayEntryPaddingBytes = 256;
+
+void incrementSSSMetricNoOverflow(AtomicWord<long long>& metric, long long value) {
+    const int64_t MAX = 1ULL << 60;
+
+    if (metric.loadRelaxed() > MAX) {
+        metric.store(value);
+    } else {
+        metric.fetchAndAdd(value);
+    }
+}
+
+/**
+ * Reports globally-aggregated batch stats.
+ */
+struct BatchedUpdatesSSS : ServerStatusSection {
+    using ServerStatusSection::ServerStatusSection;
+
+    bool includeByDefault() const override {
+        return true;
+    }
+
+    BSONObj generateSection(OperationContext* opCtx, const BSONElement& configElem) const override {
+        BSONObjBuilder bob;
+        bob.appendNumber("batches", batches.loadRelaxed());
+        bob.appendNumber("docs", docs.loadRelaxed());
+        bob.appendNumber("stagedSizeBytes", stagedSizeBytes.loadRelaxed());
+        bob.appendNumber("timeInBatchMillis", timeInBatchMillis.loadRelaxed());
+        bob.appendNumber("refetchesDueToYield", refetchesDueToYield.loadRelaxed());
+
+        return bob.obj();
+    }
+
+    AtomicWord<long long> batches{0};
+    AtomicWord<long long> docs{0};
+    AtomicWord<long long> stagedSizeBytes{0};
+    AtomicWord<long long> timeInBatchMillis{0};
+    AtomicWord<long long> refetchesDueToYield{0};
+};
+auto& batchedUpdatesSSS = *ServerStatusSectionBuilder<BatchedUpdatesSSS>("batchedUpdates");
+
+// Wrapper for write_stage_common::ensureStillMatches() which also updates the 'refetchesDueToYield'
+// serverStatus metric. As with ensureStillMatches, if false is returned, the WorkingSetMember
+// referenced by 'id' is no longer valid, and must not be used except for freeing the WSM.
+bool ensureStillMatchesAndUpdateStats(const CollectionPtr& collection,
+                                      OperationContext* opCtx,
+                                      WorkingSet* ws,
+                                      WorkingSetID id,
+                                      const CanonicalQuery* cq) {
+    WorkingSetMember* member = ws->get(id);
+    if (shard_role_details::getRecoveryUnit(opCtx)->getSnapshotId() != member->doc.snapshotId()) {
+        incrementSSSMetricNoOverflow(batchedUpdatesSSS.refetchesDueToYield, 1);
+    }
+    return write_stage_common::ensureStillMatches(collection, opCtx, ws, id, cq);
+}
+}  // namespace
+
+BatchedUpdateStage::BatchedUpdateStage(
+    ExpressionContext* expCtx,
+    const UpdateStageParams& params,
+    std::unique_ptr<BatchedUpdateStageParams> batchedUpdateParams,
+    WorkingSet* ws,
+    CollectionAcquisition collection,
+    PlanStage* child)
+    : UpdateStage(kStageType.rawData(), expCtx, params, ws, collection, child),
+      _batchedUpdateParams(std::move(batchedUpdateParams)),
+      _stagedUpdatesBuffer(ws),
+      _stagedUpdatesWatermarkBytes(0),
+      _commitStagedUpdates(false),
+      _stagingComplete(false),
+      _commitDocumentsIndividually(false) {
+    tassert(9156646,
+            "batched updates only support multi-document updates (multi: true)",
+            _params.request->isMulti());
+    tassert(9156647,
+            "batched updates do not support returning documents",
+            !_params.request->shouldReturnAnyDocs());
+    tassert(9156648,
+            "batched updates do not support the 'sort' parameter",
+            _params.request->getSort().isEmpty());
+    tassert(9156649,
+            "batched updates do not support the 'numStatsForDoc' parameter",
+            !_params.numStatsForDoc);
+    tassert(9156650,
+            "batch size parameters must be greater than or equal to zero",
+            _batchedUpdateParams->targetStagedDocBytes >= 0 &&
+                _batchedUpdateParams->targetBatchDocs >= 0 &&
+                _batchedUpdateParams->targetBatchTimeMS >= Milliseconds(0));
+}
+
+BatchedUpdateStage::~BatchedUpdateStage() {}
+
+bool BatchedUpdateStage::isEOF() {
+    if (_params.request->explain()) {
+        return UpdateStage::isEOF();
+    }
+    return _stagedUpdatesBuffer.empty() && _stagingComplete;
+}
+
+std::unique_ptr<PlanStageStats> BatchedUpdateStage::getStats() {
+    _commonStats.isEOF = isEOF();
+    auto stats = std::make_unique<PlanStageStats>(_commonStats, stageType());
+    stats->specific = std::make_unique<UpdateStats>(_specificStats);
+    stats->children.emplace_back(child()->getStats());
+    return stats;
+}
+
+PlanStage::StageState BatchedUpdateStage::doWork(WorkingSetID* out) {
+    if (_params.request->explain()) {
+        // An explain doesn't write anything, so there is nothing to batch.
+        return UpdateStage::doWork(out);
+    }
+
+    WorkingSetID idToReturn = WorkingSet::INVALID_ID;
+    PlanStage::StageState planStageState = PlanStage::NEED_TIME;
+
+    if (!_commitStagedUpdates && !_stagingComplete) {
+        // It's okay to stage more documents.
+        planStageState = _doStaging(&idToReturn);
+
+        _stagingComplete = planStageState == PlanStage::IS_EOF;
+        _commitStagedUpdates = _stagingComplete || _batchTargetMet();
+    }
+
+    if (_commitStagedUpdates) {
+        // As for batched deletes, the result of staging is only discarded when it is NEED_TIME
+        // (a document was staged) or IS_EOF (there are no more documents to stage).
+        tassert(9156651,
+                "Fetched unexpected plan stage state before committing updates",
+                planStageState == PlanStage::NEED_TIME || planStageState == PlanStage::IS_EOF);
+
+        _stagedUpdatesWatermarkBytes = 0;
+        planStageState = _updateBatch(&idToReturn);
+
+        _commitStagedUpdates = _stagingComplete || !_stagedUpdatesBuffer.empty();
+    }
+
+    if (isEOF()) {
+        invariant(planStageState != PlanStage::NEED_YIELD);
+        return PlanStage::IS_EOF;
+    }
+
+    if (planStageState == PlanStage::NEED_YIELD) {
+        *out = idToReturn;
+    }
+
+    return planStageState;
+}
+
+PlanStage::StageState BatchedUpdateStage::_updateBatch(WorkingSetID* out) {
+    if (!_stagedUpdatesBuffer.size()) {
+        return PlanStage::NEED_TIME;
+    }
+
+    const auto saveRet = handlePlanStageYield(
+        expCtx(),
+        "BatchedUpdateStage saveState",
+        [&] {
+            child()->saveState();
+            return PlanStage::NEED_TIME;
+        },
+        [&] {
+            // yieldHandler
+            _prepareToRetryDrainAfterYield(out, {});
+        });
+    if (saveRet != PlanStage::NEED_TIME) {
+        return saveRet;
+    }
+
+    std::set<WorkingSetID> recordsToSkip;
+    RecordIdSet updatedRecordIds;
+    unsigned int docsUpdated = 0;
+    unsigned int bufferOffset = 0;
+    long long timeInBatch = 0;
+
+    // The stats and the "Halloween Problem" bookkeeping are updated as each document of the batch
+    // is written. Undo them if the batch doesn't commit, as its documents will be retried.
+    const UpdateStats statsBeforeBatch = _specificStats;
+    ScopeGuard undoUncommittedBatch([&] {
+        _specificStats = statsBeforeBatch;
+        for (const auto& recordId : updatedRecordIds) {
+            _updatedRecordIds->erase(recordId);
+        }
+    });
+
+    // A batch that is too large to replicate in a single oplog entry, or to fit in the storage
+    // engine cache, is retried one document at a time.
+    const auto retryIndividually = [&](const DBException& ex) {
+        if (_commitDocumentsIndividually) {
+            throw;
+        }
+        LOGV2_DEBUG(9156652,
+                    2,
+                    "Batched update is too large, committing documents individually",
+                    "error"_attr = redact(ex));
+        _commitDocumentsIndividually = true;
+        _prepareToRetryDrainAfterYield(out, recordsToSkip);
+        return PlanStage::NEED_YIELD;
+    };
+
+    try {
+        const auto ret = handlePlanStageYield(
+            expCtx(),
+            "BatchedUpdateStage::_updateBatch",
+            [&] {
+                timeInBatch =
+                    _commitBatch(&recordsToSkip, &updatedRecordIds, &docsUpdated, &bufferOffset);
+                return PlanStage::NEED_TIME;
+            },
+            [&] {
+                // yieldHandler
+                _prepareToRetryDrainAfterYield(out, recordsToSkip);
+            });
+
+        if (ret != PlanStage::NEED_TIME) {
+            return ret;
+        }
+    } catch (const ExceptionFor<ErrorCodes::StaleConfig>& ex) {
+        if (ShardVersion::isPlacementVersionIgnored(ex->getVersionReceived()) &&
+            ex->getCriticalSectionSignal()) {
+            // If the placement version is IGNORED and we encountered a critical section, then
+            // yield, wait for critical section to finish and then we'll resume the write from the
+            // point we had left. We do this to prevent large multi-writes from repeatedly failing
+            // due to StaleConfig and exhausting the mongos retry attempts.
+            planExecutorShardingCriticalSectionFuture(opCtx()) = ex->getCriticalSectionSignal();
+            _prepareToRetryDrainAfterYield(out, recordsToSkip);
+            return PlanStage::NEED_YIELD;
+        }
+        throw;
+    } catch (const ExceptionFor<ErrorCodes::TransactionTooLarge>& ex) {
+        return retryIndividually(ex);
+    } catch (const ExceptionFor<ErrorCodes::TransactionTooLargeForCache>& ex) {
+        return retryIndividually(ex);
+    }
+    undoUncommittedBatch.dismiss();
+
+    incrementSSSMetricNoOverflow(batchedUpdatesSSS.docs, docsUpdated);
+    incrementSSSMetricNoOverflow(batchedUpdatesSSS.batches, 1);
+    incrementSSSMetricNoOverflow(batchedUpdatesSSS.timeInBatchMillis, timeInBatch);
+
+    if (bufferOffset < _stagedUpdatesBuffer.size()) {
+        // A target was met before the whole buffer was evaluated. Remove staged updates that have
+        // been evaluated (executed or skipped because they no longer match the query) from the
+        // buffer. If any staged updates remain in the buffer, they will be retried in a subsequent
+        // batch.
+        _stagedUpdatesBuffer.eraseUpToOffsetInclusive(bufferOffset);
+    } else {
+        // The individual updates staged in the buffer are preserved until the batch is committed
+        // so they can be retried in case of a write conflict.
+        // No write conflict occurred, all staged updates were successfully evaluated/executed, it
+        // is safe to clear the buffer.
+        _stagedUpdatesBuffer.clear();
+    }
+
+    return _tryRestoreState(out);
+}
+
+long long BatchedUpdateStage::_commitBatch(std::set<WorkingSetID>* recordsToSkip,
+                                           RecordIdSet* updatedRecordIds,
+                                           unsigned int* docsUpdated,
+                                           unsigned int* bufferOffset) {
+    boost::optional<repl::UnreplicatedWritesBlock> unReplBlock;
+    if (collectionPtr()->ns().isImplicitlyReplicated() && !_isUserInitiatedWrite) {
+        // Implictly replicated collections do not replicate updates.
+        unReplBlock.emplace(opCtx());
+    }
+
+    Timer batchTimer(opCtx()->getServiceContext()->getTickSource());
+
+    // Start a WUOW with 'groupOplogEntries' which groups an update batch into a single timestamp
+    // and oplog entry.
+    const bool groupOplogEntries =
+        !_commitDocumentsIndividually && _stagedUpdatesBuffer.size() > 1U;
+    WriteUnitOfWork wuow(opCtx(),
+                         groupOplogEntries ? WriteUnitOfWork::kGroupForTransaction
+                                           : WriteUnitOfWork::kDontGroup);
+    for (; *bufferOffset < _stagedUpdatesBuffer.size(); ++*bufferOffset) {
+        if (MONGO_unlikely(throwWriteConflictExceptionInBatchedUpdateStage.shouldFail())) {
+            throwWriteConflictException(
+                str::stream() << "Hit failpoint '"
+                              << throwWriteConflictExceptionInBatchedUpdateStage.getName()
+                              << "'.");
+        }
+
+        auto workingSetMemberID = _stagedUpdatesBuffer.at(*bufferOffset);
+        WorkingSetMember* member = _ws->get(workingSetMemberID);
+
+        using write_stage_common::PreWriteFilter;
+        const PreWriteFilter::Action action = [&]() {
+            // The PlanExecutor YieldPolicy may change snapshots between calls to 'doWork()'.
+            // Different documents may have different snapshots.
+            const bool docStillMatches = ensureStillMatchesAndUpdateStats(
+                collectionPtr(), opCtx(), _ws, workingSetMemberID, _params.canonicalQuery);
+
+            // Warning: if docStillMatches is false, the WSM's underlying Document/BSONObj is no
+            // longer valid.
+            if (!docStillMatches) {
+                return PreWriteFilter::Action::kSkip;
+            }
+
+            if (!_isUserInitiatedWrite) {
+                return PreWriteFilter::Action::kWrite;
+            }
+
+            // Determine whether the document being updated is owned by this shard, and the action
+            // to undertake if it isn't.
+            return _preWriteFilter.computeActionAndLogSpecialCases(
+                member->doc.value(), "batched update"_sd, collectionPtr()->ns());
+        }();
+
+        // Skip the document, as it either no longer exists, or has been filtered by the
+        // PreWriteFilter.
+        if (action == PreWriteFilter::Action::kSkip) {
+            recordsToSkip->insert(workingSetMemberID);
+            continue;
+        }
+
+        const bool writeToOrphan = action == PreWriteFilter::Action::kWriteAsFromMigrate;
+
+        BSONObj oldObj = member->doc.value().toBson();
+        if (groupOplogEntries && *docsUpdated > 0) {
+            // Leave room in the applyOps entry for this update, which is assumed to be no larger
+            // than the document it modifies. An update larger than that is caught when the batch
+            // commits and retried on its own.
+            const auto batchedOpsBytes = BatchedWriteContext::get(opCtx())
+                                             .getBatchedOperations(opCtx())
+                                             ->getTotalOperationBytes();
+            if (batchedOpsBytes + kApplyOpsArrayEntryPaddingBytes + oldObj.objsize() >
+                BSONObjMaxUserSize) {
+                // Put this update back into the staging buffer and commit the batch.
+                invariant(*bufferOffset > 0);
+                (*bufferOffset)--;
+                wuow.commit();
+                return batchTimer.millis();
+            }
+        }
+
+        RecordId recordId = member->recordId;
+        transformAndUpdate({member->doc.snapshotId(), oldObj}, recordId, writeToOrphan);
+        if (_updatedRecordIds->count(recordId) > 0) {
+            updatedRecordIds->insert(recordId);
+        }
+        _specificStats.nMatched++;
+        (*docsUpdated)++;
+
+        if (_commitDocumentsIndividually) {
+            break;
+        }
+
+        const Milliseconds elapsedMillis(batchTimer.millis());
+        if (_batchedUpdateParams->targetBatchTimeMS != Milliseconds(0) &&
+            elapsedMillis >= _batchedUpdateParams->targetBatchTimeMS) {
+            // Met 'targetBatchTimeMS' after evaluating the staged update at '*bufferOffset'.
+            break;
+        }
+    }
+    wuow.commit();
+    return batchTimer.millis();
+}
+
+PlanStage::StageState BatchedUpdateStage::_doStaging(WorkingSetID* idToReturn) {
+    auto status = child()->work(idToReturn);
+
+    switch (status) {
+        case PlanStage::ADVANCED: {
+            _stageNewUpdate(idToReturn);
+            return PlanStage::NEED_TIME;
+        }
+        default:
+            return status;
+    }
+}
+
+void BatchedUpdateStage::_stageNewUpdate(WorkingSetID* workingSetMemberID) {
+    WorkingSetMember* member = _ws->get(*workingSetMemberID);
+
+    ScopeGuard memberFreer([&] { _ws->free(*workingSetMemberID); });
+    invariant(member->hasRecordId());
+
+    // Updates can't have projections. This means that covering analysis will always add a fetch.
+    // We should always get fetched data, and never just key data.
+    invariant(member->hasObj());
+
+    // Found a RecordId that refers to a document we had already updated. See the comment by the
+    // declaration of '_updatedRecordIds'.
+    if (_updatedRecordIds->count(member->recordId) > 0) {
+        return;
+    }
+
+    // Preserve the member until the update is committed. Once an update is staged in the buffer,
+    // its resources are freed when it is removed from the buffer.
+    memberFreer.dismiss();
+
+    // Ensure that the BSONObj underlying the WSM associated with 'id' is owned because saveState()
+    // is allowed to free the memory the BSONObj points to. Note that the call to
+    // makeObjOwnedIfNeeded() will leave the WSM in the RID_AND_OBJ state in case we need to retry
+    // updating it.
+    member->makeObjOwnedIfNeeded();
+
+    _stagedUpdatesBuffer.append(*workingSetMemberID);
+    const auto memberMemFootprintBytes = member->getMemUsage();
+    _stagedUpdatesWatermarkBytes += memberMemFootprintBytes;
+    incrementSSSMetricNoOverflow(batchedUpdatesSSS.stagedSizeBytes, memberMemFootprintBytes);
+}
+
+PlanStage::StageState BatchedUpdateStage::_tryRestoreState(WorkingSetID* out) {
+    return handlePlanStageYield(
+        expCtx(),
+        "BatchedUpdateStage::_tryRestoreState",
+        [&] {
+            child()->restoreState(&collectionPtr());
+            return PlanStage::NEED_TIME;
+        },
+        [&] {
+            // yieldHandler
+            *out = WorkingSet::INVALID_ID;
+        });
+}
+
+void BatchedUpdateStage::_prepareToRetryDrainAfterYield(
+    WorkingSetID* out, const std::set<WorkingSetID>& recordsToSkip) {
+    _stagedUpdatesBuffer.erase(recordsToSkip);
+    *out = WorkingSet::INVALID_ID;
+}
+
+bool BatchedUpdateStage::_batchTargetMet() {
+    return (_batchedUpdateParams->targetBatchDocs &&
+            _stagedUpdatesBuffer.size() >=
+                static_cast<size_t>(_batchedUpdateParams->targetBatchDocs)) ||
+        (_batchedUpdateParams->targetStagedDocBytes &&
+         _stagedUpdatesWatermarkBytes >=
+             static_cast<unsigned long long>(_batchedUpdateParams->targetStagedDocBytes));
+}
+
+}  // namespace mongo
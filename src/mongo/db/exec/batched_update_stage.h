@@ -0,0 +1,171 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <set>
+
+#include "mongo/base/string_data.h"
+#include "mongo/db/exec/batched_delete_stage_buffer.h"
+#include "mongo/db/exec/batched_update_stage_gen.h"
+#include "mongo/db/exec/plan_stage.h"
+#include "mongo/db/exec/plan_stats.h"
+#include "mongo/db/exec/update_stage.h"
+#include "mongo/db/exec/working_set.h"
+#include "mongo/db/pipeline/expression_context.h"
+#include "mongo/db/query/stage_types.h"
+#include "mongo/db/shard_role.h"
+#include "mongo/util/duration.h"
+
+namespace mongo {
+
+struct BatchedUpdateStageParams {
+    BatchedUpdateStageParams()
+        : targetBatchDocs(gBatchedUpdatesTargetBatchDocs.load()),
+          targetBatchTimeMS(Milliseconds(gBatchedUpdatesTargetBatchTimeMS.load())),
+          targetStagedDocBytes(gBatchedUpdatesTargetStagedDocBytes.load()) {}
+
+    //
+    // A 'batch' refers to the updates executed in a single WriteUnitOfWork. A batch of staged
+    // document updates is committed as soon as one of the batch targets is met, or upon reaching
+    // EOF.
+    //
+
+    // Documents staged for update are processed in a batch once this document count target is met.
+    // A value of zero means unlimited.
+    long long targetBatchDocs = 0;
+
+    // A batch is committed as soon as this target execution time is met. Zero means unlimited.
+    Milliseconds targetBatchTimeMS = Milliseconds(0);
+
+    // Documents staged for update are processed in a batch once this size target is met. Accounts
+    // for document size, not for indexes. A value of zero means unlimited.
+    long long targetStagedDocBytes = 0;
+};
+
+/**
+ * The BATCHED_UPDATE stage updates documents in batches. In comparison, the base class UpdateStage
+ * updates and commits documents one by one. Only multi-updates which don't upsert and don't return
+ * documents can be batched. The stage returns NEED_TIME after executing a batch of updates, or
+ * after staging an update for the next batch.
+ *
+ * Callers of work() must be holding a write lock (and, for replicated updates, callers must have
+ * had the replication coordinator approve the write).
+ */
+class BatchedUpdateStage final : public UpdateStage {
+    BatchedUpdateStage(const BatchedUpdateStage&) = delete;
+    BatchedUpdateStage& operator=(const BatchedUpdateStage&) = delete;
+
+public:
+    static constexpr StringData kStageType = "BATCHED_UPDATE"_sd;
+
+    BatchedUpdateStage(ExpressionContext* expCtx,
+                       const UpdateStageParams& params,
+                       std::unique_ptr<BatchedUpdateStageParams> batchedUpdateParams,
+                       WorkingSet* ws,
+                       CollectionAcquisition collection,
+                       PlanStage* child);
+    ~BatchedUpdateStage() override;
+
+    // Returns true when no more work can be done (there are no more updates to commit).
+    bool isEOF() final;
+
+    std::unique_ptr<mongo::PlanStageStats> getStats() final;
+
+    StageState doWork(WorkingSetID* out) final;
+
+    StageType stageType() const final {
+        return STAGE_BATCHED_UPDATE;
+    }
+
+private:
+    // Returns NEED_TIME when some, or all, of the documents staged in the _stagedUpdatesBuffer are
+    // successfully updated. Returns NEED_YIELD otherwise.
+    PlanStage::StageState _updateBatch(WorkingSetID* out);
+
+    // Attempts to update the documents staged for update in a WriteUnitOfWork. Updates
+    // recordsToSkip, docsUpdated and bufferOffset to reflect which document updates are skipped,
+    // executed, or remaining when the WriteUnitOfWork is committed. Record ids that the batch adds
+    // to '_updatedRecordIds' are also added to 'updatedRecordIds', so they can be forgotten if the
+    // WriteUnitOfWork rolls back.
+    //
+    // Returns the time spent (milliseconds) committing the batch.
+    long long _commitBatch(std::set<WorkingSetID>* recordsToSkip,
+                           RecordIdSet* updatedRecordIds,
+                           unsigned int* docsUpdated,
+                           unsigned int* bufferOffset);
+
+    // Attempts to stage a new update in the _stagedUpdatesBuffer. Returns the PlanStage::StageState
+    // fetched directly from the child except when there is a document to stage. Converts
+    // PlanStage::ADVANCED to PlanStage::NEED_TIME before returning when a document is staged for
+    // update - PlanStage:ADVANCED doesn't hold meaning in a batched update since nothing will ever
+    // be directly returned from this stage.
+    PlanStage::StageState _doStaging(WorkingSetID* out);
+
+    // Stages the document tied to workingSetMemberID into the _stagedUpdatesBuffer.
+    void _stageNewUpdate(WorkingSetID* workingSetMemberID);
+
+    // Tries to restore the child's state. Returns NEED_TIME if the restore succeeds, NEED_YIELD
+    // otherwise.
+    PlanStage::StageState _tryRestoreState(WorkingSetID* out);
+
+    // Prepares to retry draining the _stagedUpdatesBuffer after a WriteConflictException or a
+    // TemporarilyUnavailableException. Removes 'recordsThatNoLongerMatch' then yields.
+    void _prepareToRetryDrainAfterYield(WorkingSetID* out,
+                                        const std::set<WorkingSetID>& recordsThatNoLongerMatch);
+
+    // Returns true if one or more of the batch targets are met and it is time to update the batch.
+    bool _batchTargetMet();
+
+    // Batch targeting parameters.
+    std::unique_ptr<BatchedUpdateStageParams> _batchedUpdateParams;
+
+    // Holds information for each document staged for update.
+    BatchedDeleteStageBuffer _stagedUpdatesBuffer;
+
+    // Holds the maximum cumulative size of all documents staged for update. It is a watermark in
+    // that it resets to zero once the target is met and the staged documents start being processed,
+    // regardless of whether all staged updates have been committed yet.
+    size_t _stagedUpdatesWatermarkBytes;
+
+    // True when the updates in the buffer must be committed before more documents can be staged.
+    bool _commitStagedUpdates;
+
+    // True when the operation is done staging new documents. The only work left is to drain the
+    // remaining buffer.
+    bool _stagingComplete;
+
+    // Set when a batch was too large to be replicated in a single oplog entry. From then on every
+    // document is committed in its own WriteUnitOfWork, as UpdateStage does.
+    bool _commitDocumentsIndividually;
+};
+
+}  // namespace mongo
@@ -406,9 +406,15 @@ PlanStage::StageState CollectionScan::doWork(WorkingSetID* out) {
     WorkingSetID id = _workingSet->allocate();
     WorkingSetMember* member = _workingSet->get(id);
     member->recordId = std::move(record->id);
-    member->resetDocument(shard_role_details::getRecoveryUnit(opCtx())->getSnapshotId(),
-                          record->data.releaseToBson());
-    _workingSet->transitionToRecordIdAndObj(id);
+    if (_returnRecordIdsOnly && !_filter) {
+        // Nothing will look at the document, e.g. when counting a range of the cluster key, so
+        // there is no need to build one.
+        _workingSet->transitionToRecordIdAndIdx(id);
+    } else {
+        member->resetDocument(shard_role_details::getRecoveryUnit(opCtx())->getSnapshotId(),
+                              record->data.releaseToBson());
+        _workingSet->transitionToRecordIdAndObj(id);
+    }
 
     return returnIfMatches(member, id, out);
 }
@@ -96,6 +96,15 @@ public:
         return _params.direction;
     }
 
+    /**
+     * Indicates that the consumer of this stage only counts the results. While there is no filter
+     * to apply, the scan then returns working set members holding just the RecordId, without
+     * materializing a document for each record.
+     */
+    void setReturnRecordIdsOnly() {
+        _returnRecordIdsOnly = true;
+    }
+
 protected:
     void doSaveStateRequiresCollection() final;
 
@@ -149,6 +158,9 @@ private:
     CollectionScanStats _specificStats;
 
     bool _useSeek = false;
+
+    // See setReturnRecordIdsOnly().
+    bool _returnRecordIdsOnly = false;
 };
 
 }  // namespace mongo
@@ -97,10 +97,16 @@ CountScan::CountScan(ExpressionContext* expCtx,
       _workingSet(workingSet),
       _keyPattern(std::move(params.keyPattern)),
       _shouldDedup(params.isMultiKey || isCompoundWildcardIndex(params.indexDescriptor)),
-      _startKey(std::move(params.startKey)),
-      _startKeyInclusive(params.startKeyInclusive),
-      _endKey(std::move(params.endKey)),
-      _endKeyInclusive(params.endKeyInclusive) {
+      _intervals([&] {
+          std::vector<CountScanParams::Interval> intervals{{std::move(params.startKey),
+                                                            params.startKeyInclusive,
+                                                            std::move(params.endKey),
+                                                            params.endKeyInclusive}};
+          for (auto& interval : params.additionalIntervals) {
+              intervals.push_back(std::move(interval));
+          }
+          return intervals;
+      }()) {
     _specificStats.indexName = params.name;
     _specificStats.keyPattern = _keyPattern;
     _specificStats.isMultiKey = params.isMultiKey;
@@ -113,10 +119,32 @@ CountScan::CountScan(ExpressionContext* expCtx,
                                    .getObjectField(IndexDescriptor::kCollationFieldName)
                                    .getOwned();
 
-    // endKey must be after startKey in index order since we only do forward scans.
-    dassert(_startKey.woCompare(_endKey,
-                                Ordering::make(_keyPattern),
-                                /*compareFieldNames*/ false) <= 0);
+    // endKey must be after startKey in index order since we only do forward scans. For the same
+    // reason the intervals must be sorted in index order.
+    const auto ordering = Ordering::make(_keyPattern);
+    for (size_t i = 0; i < _intervals.size(); ++i) {
+        dassert(_intervals[i].startKey.woCompare(
+                    _intervals[i].endKey, ordering, /*compareFieldNames*/ false) <= 0);
+        dassert(i == 0 ||
+                _intervals[i - 1].endKey.woCompare(
+                    _intervals[i].startKey, ordering, /*compareFieldNames*/ false) <= 0);
+    }
+}
+
+boost::optional<IndexKeyEntry> CountScan::seekToCurrentInterval() {
+    const auto& interval = _intervals[_currentInterval];
+    _cursor->setEndPosition(interval.endKey, interval.endKeyInclusive);
+
+    auto keyStringForSeek = IndexEntryComparison::makeKeyStringFromBSONKeyForSeek(
+        interval.startKey,
+        indexAccessMethod()->getSortedDataInterface()->getKeyStringVersion(),
+        indexAccessMethod()->getSortedDataInterface()->getOrdering(),
+        true, /* forward */
+        interval.startKeyInclusive);
+    auto entry =
+        _cursor->seek(keyStringForSeek, SortedDataInterface::Cursor::KeyInclusion::kExclude);
+    _needSeek = false;
+    return entry;
 }
 
 PlanStage::StageState CountScan::doWork(WorkingSetID* out) {
@@ -133,19 +161,21 @@ PlanStage::StageState CountScan::doWork(WorkingSetID* out) {
             if (needInit) {
                 // First call to work().  Perform cursor init.
                 _cursor = indexAccessMethod()->newCursor(opCtx());
-                _cursor->setEndPosition(_endKey, _endKeyInclusive);
-
-                auto keyStringForSeek = IndexEntryComparison::makeKeyStringFromBSONKeyForSeek(
-                    _startKey,
-                    indexAccessMethod()->getSortedDataInterface()->getKeyStringVersion(),
-                    indexAccessMethod()->getSortedDataInterface()->getOrdering(),
-                    true, /* forward */
-                    _startKeyInclusive);
-                entry = _cursor->seek(keyStringForSeek,
-                                      SortedDataInterface::Cursor::KeyInclusion::kExclude);
+            }
+
+            if (_needSeek) {
+                entry = seekToCurrentInterval();
             } else {
                 entry = _cursor->next(SortedDataInterface::Cursor::KeyInclusion::kExclude);
             }
+
+            // Once an interval is exhausted, seek straight to the start of the next one.
+            while (!entry && _currentInterval + 1 < _intervals.size()) {
+                ++_specificStats.keysExamined;
+                ++_currentInterval;
+                _needSeek = true;
+                entry = seekToCurrentInterval();
+            }
             return PlanStage::ADVANCED;
         },
         [&] {
@@ -213,10 +243,12 @@ unique_ptr<PlanStageStats> CountScan::getStats() {
     unique_ptr<CountScanStats> countStats = std::make_unique<CountScanStats>(_specificStats);
     countStats->keyPattern = _specificStats.keyPattern.getOwned();
 
-    countStats->startKey = replaceBSONFieldNames(_startKey, countStats->keyPattern);
-    countStats->startKeyInclusive = _startKeyInclusive;
-    countStats->endKey = replaceBSONFieldNames(_endKey, countStats->keyPattern);
-    countStats->endKeyInclusive = _endKeyInclusive;
+    // Report the range spanned by all of the intervals.
+    countStats->startKey = replaceBSONFieldNames(_intervals.front().startKey, countStats->keyPattern);
+    countStats->startKeyInclusive = _intervals.front().startKeyInclusive;
+    countStats->endKey = replaceBSONFieldNames(_intervals.back().endKey, countStats->keyPattern);
+    countStats->endKeyInclusive = _intervals.back().endKeyInclusive;
+    countStats->numIntervals = _intervals.size();
 
     ret->specific = std::move(countStats);
 
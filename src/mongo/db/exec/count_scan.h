@@ -29,9 +29,12 @@
 
 #pragma once
 
+#include <boost/optional/optional.hpp>
+#include <cstddef>
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "mongo/bson/bsonobj.h"
 #include "mongo/db/catalog/collection.h"
@@ -48,6 +51,7 @@
 #include "mongo/db/query/plan_executor.h"
 #include "mongo/db/query/stage_types.h"
 #include "mongo/db/record_id.h"
+#include "mongo/db/storage/index_entry_comparison.h"
 #include "mongo/db/storage/sorted_data_interface.h"
 #include "mongo/stdx/unordered_set.h"
 #include "mongo/util/assert_util_core.h"
@@ -92,14 +96,29 @@ struct CountScanParams {
 
     BSONObj endKey;
     bool endKeyInclusive{true};
+
+    /**
+     * A range of index keys to count in addition to [startKey, endKey].
+     */
+    struct Interval {
+        BSONObj startKey;
+        bool startKeyInclusive{true};
+
+        BSONObj endKey;
+        bool endKeyInclusive{true};
+    };
+
+    // Disjoint ranges which follow [startKey, endKey] in increasing index order. The count scan
+    // seeks from the end of each range to the start of the next one.
+    std::vector<Interval> additionalIntervals;
 };
 
 /**
  * Used when don't need to return the actual records from the index or the collection (e.g. count
  * command and some cases of aggregation).
  *
- * Scans an index from a start key to an end key. Creates a WorkingSetMember for each matching index
- * key in RID_AND_OBJ state. It has a null record id and an empty object with a null snapshot id
+ * Scans an index from a start key to an end key, or through a sequence of such disjoint ranges.
+ * Creates a WorkingSetMember for each matching index key in RID_AND_OBJ state. It has a null record id and an empty object with a null snapshot id
  * rather than real data. Returning real data is unnecessary since all we need is the count.
  */
 class CountScan final : public RequiresIndexStage {
@@ -137,11 +156,19 @@ private:
 
     const bool _shouldDedup;
 
-    const BSONObj _startKey;
-    const bool _startKeyInclusive = true;
+    /**
+     * Positions '_cursor' at the first key of '_intervals[_currentInterval]'.
+     */
+    boost::optional<IndexKeyEntry> seekToCurrentInterval();
+
+    // The ranges of keys to count, in increasing index order. Never empty.
+    const std::vector<CountScanParams::Interval> _intervals;
+
+    // The interval which '_cursor' is positioned in.
+    size_t _currentInterval = 0;
 
-    const BSONObj _endKey;
-    const bool _endKeyInclusive = true;
+    // Whether '_cursor' needs to seek to the start of '_intervals[_currentInterval]'.
+    bool _needSeek = true;
 
     std::unique_ptr<SortedDataInterface::Cursor> _cursor;
 
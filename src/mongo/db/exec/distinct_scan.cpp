@@ -40,6 +40,7 @@
 #include "mongo/db/index/index_access_method.h"
 #include "mongo/db/index/index_descriptor.h"
 #include "mongo/db/query/plan_executor_impl.h"
+#include "mongo/db/query/query_knobs_gen.h"
 #include "mongo/db/record_id.h"
 #include "mongo/db/storage/recovery_unit.h"
 #include "mongo/db/transaction_resources.h"
@@ -63,6 +64,7 @@ DistinctScan::DistinctScan(ExpressionContext* expCtx,
       _scanDirection(params.scanDirection),
       _bounds(std::move(params.bounds)),
       _fieldNo(params.fieldNo),
+      _shouldDedup(params.shouldDedup),
       _checker(&_bounds, _keyPattern, _scanDirection) {
     _specificStats.keyPattern = _keyPattern;
     _specificStats.indexName = params.name;
@@ -76,6 +78,15 @@ DistinctScan::DistinctScan(ExpressionContext* expCtx,
     _specificStats.collation = params.indexDescriptor->infoObj()
                                    .getObjectField(IndexDescriptor::kCollationFieldName)
                                    .getOwned();
+    _specificStats.shouldDedup = _shouldDedup;
+    if (_shouldDedup && internalUseRoaringBitmapsForRecordIDDeduplication.load()) {
+        const size_t threshold = static_cast<size_t>(internalRoaringBitmapsThreshold.load());
+        const size_t batchSize = static_cast<size_t>(internalRoaringBitmapsBatchSize.load());
+        const uint64_t universeSize =
+            static_cast<uint64_t>(threshold / internalRoaringBitmapsMinimalDensity.load());
+        _recordIdDeduplicator =
+            std::make_unique<RecordIdDeduplicator>(threshold, batchSize, universeSize);
+    }
 
     // Set up our initial seek. If there is no valid data, just mark as EOF.
     _commonStats.isEOF = !_checker.getStartSeekPoint(&_seekPoint);
@@ -137,6 +148,19 @@ PlanStage::StageState DistinctScan::doWork(WorkingSetID* out) {
             _seekPoint.prefixLen = _fieldNo + 1;
             _seekPoint.firstExclusive = _fieldNo;
 
+            if (_shouldDedup) {
+                ++_specificStats.dupsTested;
+                const bool newRecordId = _recordIdDeduplicator
+                    ? _recordIdDeduplicator->insert(kv->loc)
+                    : _returned.insert(kv->loc).second;
+                if (!newRecordId) {
+                    // This document was already returned under a different element of the same
+                    // array, so it already contributed the current distinct value. Skip ahead.
+                    ++_specificStats.dupsDropped;
+                    return PlanStage::NEED_TIME;
+                }
+            }
+
             // Package up the result for the caller.
             WorkingSetID id = _workingSet->allocate();
             WorkingSetMember* member = _workingSet->get(id);
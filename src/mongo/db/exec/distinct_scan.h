@@ -37,6 +37,7 @@
 #include "mongo/bson/bsonobj.h"
 #include "mongo/db/catalog/collection.h"
 #include "mongo/db/catalog/index_catalog_entry.h"
+#include "mongo/db/exec/recordid_deduplicator.h"
 #include "mongo/db/exec/plan_stage.h"
 #include "mongo/db/exec/plan_stats.h"
 #include "mongo/db/exec/requires_index_stage.h"
@@ -53,6 +54,7 @@
 #include "mongo/db/record_id.h"
 #include "mongo/db/storage/index_entry_comparison.h"
 #include "mongo/db/storage/sorted_data_interface.h"
+#include "mongo/stdx/unordered_set.h"
 #include "mongo/util/assert_util_core.h"
 
 namespace mongo {
@@ -103,6 +105,11 @@ struct DistinctParams {
     // If we distinct over 'a' the position is 0.
     // If we distinct over 'b' the position is 1.
     int fieldNo{0};
+
+    // Set when the distinct field is multikey and the documents are fetched, in which case a single
+    // document may be keyed under several distinct values. Documents that were already returned
+    // are skipped, since fetching one yields all of its values for the distinct field.
+    bool shouldDedup{false};
 };
 
 /**
@@ -150,6 +157,13 @@ private:
 
     const int _fieldNo = 0;
 
+    const bool _shouldDedup;
+
+    // If the distinct field is multikey, we use _recordIdDeduplicator or _returned to avoid
+    // returning the same document once for each of its array elements.
+    std::unique_ptr<RecordIdDeduplicator> _recordIdDeduplicator;
+    stdx::unordered_set<RecordId, RecordId::Hasher> _returned;
+
     // The cursor we use to navigate the tree.
     std::unique_ptr<SortedDataInterface::Cursor> _cursor;
 
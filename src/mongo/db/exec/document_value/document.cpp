@@ -30,6 +30,7 @@
 #include "mongo/db/exec/document_value/document.h"
 
 #include <absl/container/node_hash_map.h>
+#include <array>
 #include <boost/container_hash/extensions.hpp>
 #include <boost/move/utility_core.hpp>
 #include <boost/none.hpp>
@@ -44,6 +45,7 @@
 #include "mongo/bson/bson_depth.h"
 #include "mongo/bson/util/builder_fwd.h"
 #include "mongo/db/pipeline/field_path.h"
+#include "mongo/platform/bits.h"
 #include "mongo/util/str.h"
 
 namespace mongo {
@@ -89,6 +91,75 @@ boost::optional<BSONElement> getNestedFieldHelperBSON(BSONElement elt,
     // The path continues "past" a scalar, and therefore does not exist.
     return BSONElement();
 }
+
+/**
+ * Per-thread cache of freed DocumentStorage buffers, with a few slots for each small power-of-two
+ * size. A pipeline materializes a new intermediate Document in every stage for every input, and
+ * most of them are released within the same getNext() call, so handing their buffers to the next
+ * document avoids a malloc/free pair each time. Documents which are retained, such as those in
+ * $group state or the $sort buffer, simply keep their buffer until they are destroyed.
+ */
+class StorageBufferCache {
+public:
+    ~StorageBufferCache() {
+        // Documents with static storage duration are destroyed after this thread's cache.
+        destroyed = true;
+    }
+
+    static char* take(size_t bytes);
+    static void give(char* buf, size_t bytes);
+
+private:
+    char* _take(size_t bytes) {
+        auto sizeClass = sizeClassFor(bytes);
+        if (sizeClass < kNumSizeClasses && _counts[sizeClass] > 0) {
+            return _buffers[sizeClass][--_counts[sizeClass]].release();
+        }
+        return new char[bytes];
+    }
+
+    void _give(char* buf, size_t bytes) {
+        std::unique_ptr<char[]> owned(buf);
+        auto sizeClass = sizeClassFor(bytes);
+        if (sizeClass < kNumSizeClasses && _counts[sizeClass] < kBuffersPerSizeClass) {
+            _buffers[sizeClass][_counts[sizeClass]++] = std::move(owned);
+        }
+    }
+
+    // Buffers from 128 bytes, the smallest DocumentStorage::alloc() hands out, up to 2KB are kept.
+    static constexpr size_t kMinBytesLog2 = 7;
+    static constexpr size_t kNumSizeClasses = 5;
+    static constexpr size_t kBuffersPerSizeClass = 4;
+
+    static size_t sizeClassFor(size_t bytes) {
+        if (bytes < (size_t{1} << kMinBytesLog2) || (bytes & (bytes - 1)))
+            return kNumSizeClasses;
+        return countTrailingZeros64(bytes) - kMinBytesLog2;
+    }
+
+    std::array<std::array<std::unique_ptr<char[]>, kBuffersPerSizeClass>, kNumSizeClasses>
+        _buffers;
+    std::array<size_t, kNumSizeClasses> _counts{};
+
+    static thread_local StorageBufferCache cache;
+    static thread_local bool destroyed;
+};
+
+thread_local StorageBufferCache StorageBufferCache::cache;
+thread_local bool StorageBufferCache::destroyed = false;
+
+char* StorageBufferCache::take(size_t bytes) {
+    return destroyed ? new char[bytes] : cache._take(bytes);
+}
+
+void StorageBufferCache::give(char* buf, size_t bytes) {
+    if (destroyed) {
+        delete[] buf;
+        return;
+    }
+    cache._give(buf, bytes);
+}
+
 }  // namespace
 
 const DocumentStorage DocumentStorage::kEmptyDoc{ConstructorTag::InitApproximateSize};
@@ -308,6 +379,7 @@ void DocumentStorage::alloc(unsigned newSize) {
     const bool firstAlloc = !_cache;
     const bool doingRehash = needRehash();
     const size_t oldCapacity = _cacheEnd - _cache;
+    const size_t oldAllocatedBytes = allocatedBytes();
 
     // make new bucket count big enough
     while (needRehash() || hashTabBuckets() < HASH_TAB_INIT_SIZE)
@@ -320,13 +392,13 @@ void DocumentStorage::alloc(unsigned newSize) {
 
     uassert(16490, "Tried to make oversized document", capacity <= size_t(BufferMaxSize));
 
-    std::unique_ptr<char[]> oldBuf(_cache);
-    _cache = new char[capacity];
+    char* oldBuf = _cache;
+    _cache = StorageBufferCache::take(capacity);
     _cacheEnd = _cache + capacity - hashTabBytes();
 
     if (!firstAlloc) {
         // This just copies the elements
-        memcpy(_cache, oldBuf.get(), _usedBytes);
+        memcpy(_cache, oldBuf, _usedBytes);
 
         if (_numFields >= HASH_TAB_MIN) {
             // if we were hashing, deal with the hash table
@@ -334,9 +406,11 @@ void DocumentStorage::alloc(unsigned newSize) {
                 rehash();
             } else {
                 // no rehash needed so just slide table down to new position
-                memcpy(_hashTab, oldBuf.get() + oldCapacity, hashTabBytes());
+                memcpy(_hashTab, oldBuf + oldCapacity, hashTabBytes());
             }
         }
+
+        StorageBufferCache::give(oldBuf, oldAllocatedBytes);
     }
 }
 
@@ -353,8 +427,13 @@ void DocumentStorage::reserveFields(size_t expectedFields) {
 
     uassert(16491, "Tried to make oversized document", newSize <= size_t(BufferMaxSize));
 
-    _cache = new char[newSize + hashTabBytes()];
-    _cacheEnd = _cache + newSize;
+    // Round up to a power of two like alloc() does, to make the buffer reusable once released.
+    size_t capacity = 128;
+    while (capacity < newSize + hashTabBytes())
+        capacity *= 2;
+
+    _cache = StorageBufferCache::take(capacity);
+    _cacheEnd = _cache + capacity - hashTabBytes();
 }
 
 intrusive_ptr<DocumentStorage> DocumentStorage::clone() const {
@@ -365,7 +444,7 @@ intrusive_ptr<DocumentStorage> DocumentStorage::clone() const {
         // Make a copy of the buffer with the fields.
         // It is very important that the positions of each field are the same after cloning.
         const size_t bufferBytes = allocatedBytes();
-        out->_cache = new char[bufferBytes];
+        out->_cache = StorageBufferCache::take(bufferBytes);
         out->_cacheEnd = out->_cache + (_cacheEnd - _cache);
         memcpy(out->_cache, _cache, bufferBytes);
 
@@ -398,11 +477,13 @@ size_t DocumentStorage::getMetadataApproximateSize() const {
 }
 
 DocumentStorage::~DocumentStorage() {
-    std::unique_ptr<char[]> deleteBufferAtScopeEnd(_cache);
-
     for (auto it = iteratorCacheOnly(); !it.atEnd(); it.advance()) {
         it->val.~Value();  // explicit destructor call
     }
+
+    if (_cache) {
+        StorageBufferCache::give(_cache, allocatedBytes());
+    }
 }
 
 void DocumentStorage::reset(const BSONObj& bson, bool bsonHasMetadata) {
@@ -417,7 +498,11 @@ void DocumentStorage::reset(const BSONObj& bson, bool bsonHasMetadata) {
         it->val.~Value();  // explicit destructor call
     }
 
-    _cacheEnd = _cache;
+    if (_cache) {
+        StorageBufferCache::give(_cache, allocatedBytes());
+    }
+    _cache = nullptr;
+    _cacheEnd = nullptr;
     _usedBytes = 0;
     _numFields = 0;
     _hashTabMask = 0;
@@ -642,10 +727,13 @@ MutableDocument::MutableDocument(size_t expectedFields)
 }
 
 MutableValue MutableDocument::getNestedFieldHelper(const FieldPath& dottedField, size_t level) {
+    const bool hashed = dottedField.hasPrecomputedHash(level);
     if (level == dottedField.getPathLength() - 1) {
-        return getField(dottedField.getFieldName(level));
+        return hashed ? getField(dottedField.getFieldNameHashed(level))
+                      : getField(dottedField.getFieldName(level));
     } else {
-        MutableDocument nested(getFieldNonLeaf(dottedField.getFieldName(level)));
+        MutableDocument nested(hashed ? getFieldNonLeaf(dottedField.getFieldNameHashed(level))
+                                      : getFieldNonLeaf(dottedField.getFieldName(level)));
         return nested.getNestedFieldHelper(dottedField, level + 1);
     }
 }
@@ -729,8 +817,9 @@ static Value getNestedFieldHelper(const Document& doc,
                                   const FieldPath& fieldNames,
                                   vector<Position>* positions,
                                   size_t level) {
-    const auto fieldName = fieldNames.getFieldName(level);
-    const Position pos = doc.positionOf(fieldName);
+    const Position pos = fieldNames.hasPrecomputedHash(level)
+        ? doc.positionOf(fieldNames.getFieldNameHashed(level))
+        : doc.positionOf(fieldNames.getFieldName(level));
 
     if (!pos.found())
         return Value();
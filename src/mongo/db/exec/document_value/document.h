@@ -350,6 +350,9 @@ public:
     Position positionOf(StringData fieldName) const {
         return storage().findField(fieldName, DocumentStorage::LookupPolicy::kCacheAndBSON);
     }
+    Position positionOf(HashedFieldName field) const {
+        return storage().findField(field, DocumentStorage::LookupPolicy::kCacheAndBSON);
+    }
 
     /** Clone a document.
      *
@@ -627,6 +630,21 @@ public:
         return MutableValue(storage().getField(key, DocumentStorage::LookupPolicy::kCacheAndBSON));
     }
 
+    /// Same as above, but with the hash of the field name already computed.
+    void setField(HashedFieldName field, const Value& val) {
+        getField(field) = val;
+    }
+    void setField(HashedFieldName field, Value&& val) {
+        getField(field) = std::move(val);
+    }
+    MutableValue getField(HashedFieldName field) {
+        return MutableValue(storage().getField(field, DocumentStorage::LookupPolicy::kCacheOnly));
+    }
+    MutableValue getFieldNonLeaf(HashedFieldName field) {
+        return MutableValue(
+            storage().getField(field, DocumentStorage::LookupPolicy::kCacheAndBSON));
+    }
+
     /// Update field by Position. Must already be a valid Position.
     MutableValue operator[](Position pos) {
         return getField(pos);
@@ -110,5 +110,29 @@ void BM_FieldNameHasher(benchmark::State& state) {
 
 BENCHMARK(BM_FieldNameHasher)->RangeMultiplier(2)->Range(1, 1 << 8);
 
+/**
+ * Benchmarks the churn of intermediate documents in a chain of $addFields-like stages: each stage
+ * materializes a new document from the previous one, adds a field, and releases its input.
+ */
+void BM_documentChurn(benchmark::State& state) {
+    BSONObjBuilder bob;
+    for (auto i = 0; i < state.range(0); i++) {
+        bob.append("f" + std::to_string(i), i);
+    }
+    const BSONObj input = bob.obj();
+
+    for (auto _ : state) {
+        Document doc{input};
+        for (auto stage = 0; stage < 5; stage++) {
+            MutableDocument md(doc);
+            md.addField("s" + std::to_string(stage), Value(stage));
+            doc = md.freeze();
+        }
+        benchmark::DoNotOptimize(doc);
+    }
+}
+
+BENCHMARK(BM_documentChurn)->RangeMultiplier(4)->Range(1, 64);
+
 
 }  // namespace mongo
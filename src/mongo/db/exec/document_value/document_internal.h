@@ -438,7 +438,8 @@ public:
         return *(_firstElement->plusBytes(pos.index));
     }
 
-    Value& getField(StringData name, LookupPolicy policy) {
+    template <typename T>
+    Value& getField(T name, LookupPolicy policy) {
         _modified = true;
         Position pos = findField(name, policy);
         if (!pos.found())
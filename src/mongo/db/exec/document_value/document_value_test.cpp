@@ -367,6 +367,22 @@ TEST(DocumentGetFieldNonCaching, TraverseArray) {
     checkBoostNoneIsReturned();
 }
 
+TEST(DocumentGetNestedField, PrecomputedHashesMatchPlainLookup) {
+    Document document = fromBson(BSON("a" << BSON("b" << BSON("c" << 1) << "d" << 2)));
+    const FieldPath plain("a.b.c");
+    const FieldPath hashed("a.b.c", true /* precomputeHashes */);
+    ASSERT_FALSE(plain.hasPrecomputedHash(0));
+    ASSERT_TRUE(hashed.hasPrecomputedHash(2));
+
+    ASSERT_VALUE_EQ(document.getNestedField(plain), document.getNestedField(hashed));
+    ASSERT_TRUE(document.getNestedField(FieldPath("a.x", true)).missing());
+
+    MutableDocument md(document);
+    md.setNestedField(FieldPath("a.b.c", true), Value(3));
+    md.setNestedField(FieldPath("a.e", true), Value(4));
+    ASSERT_DOCUMENT_EQ(md.freeze(), DOC("a" << DOC("b" << DOC("c" << 3) << "d" << 2 << "e" << 4)));
+}
+
 TEST(DocumentSize, ApproximateSizeIsSnapshotted) {
     const auto rawBson = BSON("field"
                               << "value");
@@ -672,7 +672,9 @@ inline static int cmp(const T& left, const T& right) {
     }
 }
 
-int Value::compare(const Value& rL, const Value& rR, const StringDataComparator* stringComparator) {
+int Value::compareGeneral(const Value& rL,
+                          const Value& rR,
+                          const StringDataComparator* stringComparator) {
     // Note, this function needs to behave identically to BSONElement::compareElements().
     // Additionally, any changes here must be replicated in hash_combine().
     BSONType lType = rL.getType();
@@ -37,6 +37,7 @@
 #include <utility>
 #include <vector>
 
+#include "mongo/base/compare_numbers.h"
 #include "mongo/base/data_range.h"
 #include "mongo/base/static_assert.h"
 #include "mongo/base/string_data.h"
@@ -430,6 +431,11 @@ private:
     // May contain embedded NUL bytes, does not check the type.
     StringData getRawData() const;
 
+    // The general case of compare(), for values that are not both ints, longs, doubles or dates.
+    static int compareGeneral(const Value& lhs,
+                              const Value& rhs,
+                              const StringDataComparator* stringComparator);
+
     ValueStorage _storage;
     friend class MutableValue;  // gets and sets _storage.genericRCPtr
 };
@@ -572,6 +578,28 @@ inline UUID Value::getUuid() const {
     return UUID::fromCDR({stringData.rawData(), stringData.size()});
 }
 
+inline int Value::compare(const Value& lhs,
+                          const Value& rhs,
+                          const StringDataComparator* stringComparator) {
+    // Same-typed numbers and dates dominate sorts and equality checks, so they are compared inline
+    // and everything else goes through the general comparison.
+    if (lhs.getType() == rhs.getType()) {
+        switch (lhs.getType()) {
+            case NumberInt:
+                return compareInts(lhs._storage.intValue, rhs._storage.intValue);
+            case NumberLong:
+                return compareLongs(lhs._storage.longValue, rhs._storage.longValue);
+            case NumberDouble:
+                return compareDoubles(lhs._storage.doubleValue, rhs._storage.doubleValue);
+            case Date:
+                return compareLongs(lhs._storage.dateValue, rhs._storage.dateValue);
+            default:
+                break;
+        }
+    }
+    return compareGeneral(lhs, rhs, stringComparator);
+}
+
 inline BSONBinData Value::getBinData() const {
     MONGO_verify(getType() == BinData);
     auto stringData = _storage.getString();
@@ -27,6 +27,7 @@
  *    it in the license file.
  */
 
+#include <algorithm>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -37,6 +38,7 @@
 #include "mongo/db/exec/filter.h"
 #include "mongo/db/exec/working_set_common.h"
 #include "mongo/db/query/plan_executor_impl.h"
+#include "mongo/db/query/query_knobs_gen.h"
 #include "mongo/util/assert_util.h"
 
 namespace mongo {
@@ -55,7 +57,8 @@ FetchStage::FetchStage(ExpressionContext* expCtx,
     : RequiresCollectionStage(kStageType, expCtx, collection),
       _ws(ws),
       _filter((filter && !filter->isTriviallyTrue()) ? filter : nullptr),
-      _idRetrying(WorkingSet::INVALID_ID) {
+      _idRetrying(WorkingSet::INVALID_ID),
+      _batchSize(std::max(internalQueryFetchStageSortedPrefetchBatchSize.load(), 0)) {
     _children.emplace_back(std::move(child));
 }
 
@@ -67,7 +70,7 @@ bool FetchStage::isEOF() {
         return false;
     }
 
-    return child()->isEOF();
+    return _batch.empty() && child()->isEOF();
 }
 
 PlanStage::StageState FetchStage::doWork(WorkingSetID* out) {
@@ -75,6 +78,10 @@ PlanStage::StageState FetchStage::doWork(WorkingSetID* out) {
         return PlanStage::IS_EOF;
     }
 
+    if (_batchSize > 0) {
+        return doWorkBatched(out);
+    }
+
     // Either retry the last WSM we worked on or get a new one from our child.
     WorkingSetID id;
     StageState status;
@@ -132,6 +139,109 @@ PlanStage::StageState FetchStage::doWork(WorkingSetID* out) {
     return status;
 }
 
+PlanStage::StageState FetchStage::doWorkBatched(WorkingSetID* out) {
+    if (_batchFetched) {
+        return returnNextFromBatch(out);
+    }
+
+    if (!_batchComplete) {
+        if (_batch.size() < _batchSize && !child()->isEOF()) {
+            WorkingSetID id;
+            const StageState status = child()->work(&id);
+            if (PlanStage::ADVANCED == status) {
+                WorkingSetMember* member = _ws->get(id);
+                if (member->hasObj()) {
+                    ++_specificStats.alreadyHasObj;
+                } else {
+                    // We need a valid RecordId to fetch from and this is the only state that has
+                    // one.
+                    MONGO_verify(WorkingSetMember::RID_AND_IDX == member->getState());
+                    MONGO_verify(member->hasRecordId());
+                }
+                _batch.push_back(id);
+            } else if (PlanStage::NEED_YIELD == status) {
+                *out = id;
+                return status;
+            } else if (PlanStage::IS_EOF != status) {
+                return status;
+            }
+
+            if (_batch.size() < _batchSize && !child()->isEOF()) {
+                return PlanStage::NEED_TIME;
+            }
+        }
+
+        if (_batch.empty()) {
+            return PlanStage::IS_EOF;
+        }
+
+        for (size_t i = 0; i < _batch.size(); ++i) {
+            if (!_ws->get(_batch[i])->hasObj()) {
+                _fetchOrder.push_back(i);
+            }
+        }
+        std::sort(_fetchOrder.begin(), _fetchOrder.end(), [&](size_t lhs, size_t rhs) {
+            return _ws->get(_batch[lhs])->recordId < _ws->get(_batch[rhs])->recordId;
+        });
+        _batchComplete = true;
+    }
+
+    return fetchBatch(out);
+}
+
+PlanStage::StageState FetchStage::fetchBatch(WorkingSetID* out) {
+    const auto ret = handlePlanStageYield(
+        expCtx(),
+        "FetchStage",
+        [&] {
+            const auto& coll = collectionPtr();
+            if (!_cursor)
+                _cursor = coll->getCursor(opCtx());
+
+            for (; _numFetched < _fetchOrder.size(); ++_numFetched) {
+                WorkingSetID& id = _batch[_fetchOrder[_numFetched]];
+                if (!WorkingSetCommon::fetch(opCtx(), _ws, id, _cursor.get(), coll, coll->ns())) {
+                    _ws->free(id);
+                    id = WorkingSet::INVALID_ID;
+                    continue;
+                }
+                // The next lookup repositions the cursor, so the fetched document must not keep
+                // pointing into it.
+                _ws->get(id)->makeObjOwnedIfNeeded();
+            }
+            return PlanStage::ADVANCED;
+        },
+        [&] {
+            // yieldHandler
+            // Members fetched so far are already owned, and the remaining ones will be fetched
+            // again once we resume.
+            *out = WorkingSet::INVALID_ID;
+        });
+    if (ret != PlanStage::ADVANCED) {
+        return ret;
+    }
+
+    _batchFetched = true;
+    return returnNextFromBatch(out);
+}
+
+PlanStage::StageState FetchStage::returnNextFromBatch(WorkingSetID* out) {
+    while (_nextReturned < _batch.size()) {
+        const WorkingSetID id = _batch[_nextReturned++];
+        if (id != WorkingSet::INVALID_ID) {
+            return returnIfMatches(_ws->get(id), id, out);
+        }
+    }
+
+    _batch.clear();
+    _fetchOrder.clear();
+    _numFetched = 0;
+    _batchComplete = false;
+    _batchFetched = false;
+    _nextReturned = 0;
+    return PlanStage::NEED_TIME;
+}
+
 void FetchStage::doSaveStateRequiresCollection() {
     if (_cursor) {
         _cursor->saveUnpositioned();
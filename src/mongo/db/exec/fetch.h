@@ -29,7 +29,9 @@
 
 #pragma once
 
+#include <cstddef>
 #include <memory>
+#include <vector>
 
 #include "mongo/db/exec/plan_stage.h"
 #include "mongo/db/exec/plan_stats.h"
@@ -53,6 +55,11 @@ class SeekableRecordCursor;
  * In WorkingSetMember terms, it transitions from RID_AND_IDX to RID_AND_OBJ by reading
  * the record at the provided RecordId.  Returns verbatim any data that already has an object.
  *
+ * If 'internalQueryFetchStageSortedPrefetchBatchSize' is positive, the stage buffers that many
+ * results from its child, fetches the records they refer to in RecordId order so that consecutive
+ * lookups touch neighbouring pages, and then returns the results in the order the child produced
+ * them.
+ *
  * Preconditions: Valid RecordId.
  */
 class FetchStage : public RequiresCollectionStage {
@@ -93,6 +100,23 @@ private:
      */
     StageState returnIfMatches(WorkingSetMember* member, WorkingSetID memberID, WorkingSetID* out);
 
+    /**
+     * Implementation of doWork() when fetching in sorted batches. Fills '_batch' from the child,
+     * fetches the whole batch, then hands its members out one per call.
+     */
+    StageState doWorkBatched(WorkingSetID* out);
+
+    /**
+     * Fetches the members of a complete '_batch' in RecordId order. Resumes where it stopped if a
+     * previous call had to yield.
+     */
+    StageState fetchBatch(WorkingSetID* out);
+
+    /**
+     * Returns the next member of a fetched '_batch', and resets the batch once it is exhausted.
+     */
+    StageState returnNextFromBatch(WorkingSetID* out);
+
     // Used to fetch Records from _collection.
     std::unique_ptr<SeekableRecordCursor> _cursor;
 
@@ -105,6 +129,26 @@ private:
     // If not Null, we use this rather than asking our child what to do next.
     WorkingSetID _idRetrying;
 
+    // Number of child results to fetch together, or 0 to fetch each one as it arrives.
+    const size_t _batchSize;
+
+    // Child results of the current batch, in the order the child returned them. Entries whose
+    // record no longer exists are set to WorkingSet::INVALID_ID once fetched.
+    std::vector<WorkingSetID> _batch;
+
+    // Positions in '_batch' of the members that need fetching, sorted by RecordId, and how many of
+    // them have been fetched so far.
+    std::vector<size_t> _fetchOrder;
+    size_t _numFetched = 0;
+
+    // True once '_batch' is full (or the child is exhausted) and '_fetchOrder' has been computed.
+    bool _batchComplete = false;
+
+    // True once every member of '_batch' has been fetched. '_nextReturned' is the position in
+    // '_batch' of the next member to return.
+    bool _batchFetched = false;
+    size_t _nextReturned = 0;
+
     // Stats
     FetchStats _specificStats;
 };
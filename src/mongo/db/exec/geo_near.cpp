@@ -32,6 +32,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <cstdlib>
 #include <limits>
 #include <memory>
@@ -74,8 +75,11 @@
 #include "mongo/db/query/interval.h"
 #include "mongo/db/query/stage_types.h"
 #include "mongo/db/storage/snapshot.h"
+#include "mongo/db/commands/server_status_metric.h"
 #include "mongo/platform/atomic_word.h"
+#include "mongo/platform/mutex.h"
 #include "mongo/util/assert_util.h"
+#include "mongo/util/lru_cache.h"
 
 
 #define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kQuery
@@ -735,6 +739,108 @@ S2Region* buildS2Region(const R2Annulus& sphereBounds) {
     // Takes ownership of caps
     return new S2RegionIntersection(&regions);
 }
+
+auto& geoNearCoveringCacheHits = *MetricBuilder<Counter64>{"query.geoNear.coveringCacheHits"};
+auto& geoNearCoveringCacheMisses = *MetricBuilder<Counter64>{"query.geoNear.coveringCacheMisses"};
+
+/**
+ * An LRU cache of the coverings of $geoNear annuli, shared by all queries, for workloads which
+ * repeatedly search around nearby centers.
+ *
+ * Entries are keyed by the annulus rounded outwards: the center is snapped to the center of its
+ * level 'kCenterLevel' cell, and the radii are widened by the distance this can move the center
+ * and rounded to a multiple of a power of two of at least 1/16th of the outer radius. The rounded
+ * annulus contains the original one, so its covering covers the original annulus as well; the
+ * caller still drops the cells which do not intersect the original annulus.
+ */
+class GeoNearCoveringCache {
+public:
+    static constexpr int kCenterLevel = 20;
+    static constexpr double kRadiusQuantumFraction = 1.0 / 16;
+
+    explicit GeoNearCoveringCache(size_t size) : _cache(size) {}
+
+    static GeoNearCoveringCache* get() {
+        static auto* const cache = gInternalGeoNearCoveringCacheSize > 0
+            ? new GeoNearCoveringCache(gInternalGeoNearCoveringCacheSize)
+            : nullptr;
+        return cache;
+    }
+
+    std::shared_ptr<const std::vector<S2CellId>> getCovering(const R2Annulus& bounds) {
+        const auto centerCell =
+            S2CellId::FromLatLng(S2LatLng::FromDegrees(bounds.center().y, bounds.center().x))
+                .parent(kCenterLevel);
+        const double centerError = S2::kMaxDiag.GetValue(kCenterLevel) * kRadiusOfEarthInMeters;
+        const int quantumExp = static_cast<int>(std::ceil(
+            std::log2(std::max(bounds.getOuter() * kRadiusQuantumFraction, centerError))));
+        const double quantum = std::ldexp(1.0, quantumExp);
+
+        Key key{centerCell.id(),
+                quantumExp,
+                static_cast<long long>(
+                    std::floor(std::max(bounds.getInner() - centerError, 0.0) / quantum)),
+                static_cast<long long>(std::ceil((bounds.getOuter() + centerError) / quantum)),
+                gInternalQueryS2GeoCoarsestLevel.load(),
+                gInternalQueryS2GeoFinestLevel.load(),
+                gInternalQueryS2GeoMaxCells.load()};
+
+        {
+            stdx::lock_guard<Latch> lk(_mutex);
+            if (auto it = _cache.promote(key); it != _cache.end()) {
+                geoNearCoveringCacheHits.increment();
+                return it->second;
+            }
+        }
+        geoNearCoveringCacheMisses.increment();
+
+        const auto centerLatLng = centerCell.ToLatLng();
+        R2Annulus roundedBounds(
+            Point(centerLatLng.lng().degrees(), centerLatLng.lat().degrees()),
+            key.innerQuanta * quantum,
+            key.outerQuanta * quantum);
+        std::unique_ptr<S2Region> region(buildS2Region(roundedBounds));
+        auto covering = std::make_shared<const std::vector<S2CellId>>(
+            ExpressionMapping::get2dsphereCovering(*region));
+
+        stdx::lock_guard<Latch> lk(_mutex);
+        _cache.add(key, covering);
+        return covering;
+    }
+
+private:
+    struct Key {
+        uint64_t centerCellId;
+        int quantumExp;
+        long long innerQuanta;
+        long long outerQuanta;
+        int coarsestLevel;
+        int finestLevel;
+        int maxCells;
+
+        bool operator==(const Key& other) const {
+            return centerCellId == other.centerCellId && quantumExp == other.quantumExp &&
+                innerQuanta == other.innerQuanta && outerQuanta == other.outerQuanta &&
+                coarsestLevel == other.coarsestLevel && finestLevel == other.finestLevel &&
+                maxCells == other.maxCells;
+        }
+
+        template <typename H>
+        friend H AbslHashValue(H h, const Key& key) {
+            return H::combine(std::move(h),
+                              key.centerCellId,
+                              key.quantumExp,
+                              key.innerQuanta,
+                              key.outerQuanta,
+                              key.coarsestLevel,
+                              key.finestLevel,
+                              key.maxCells);
+        }
+    };
+
+    Mutex _mutex = MONGO_MAKE_LATCH("GeoNearCoveringCache::_mutex");
+    LRUCache<Key, std::shared_ptr<const std::vector<S2CellId>>> _cache;
+};
 }  // namespace
 
 GeoNear2DSphereStage::DensityEstimator::DensityEstimator(
@@ -940,7 +1046,12 @@ std::unique_ptr<NearStage::CoveredInterval> GeoNear2DSphereStage::nextInterval(
     scanParams.bounds.fields[s2FieldPosition].intervals.clear();
     std::unique_ptr<S2Region> region(buildS2Region(_currBounds));
 
-    std::vector<S2CellId> cover = ExpressionMapping::get2dsphereCovering(*region);
+    std::vector<S2CellId> cover;
+    if (auto cache = GeoNearCoveringCache::get()) {
+        cover = *cache->getCovering(_currBounds);
+    } else {
+        cover = ExpressionMapping::get2dsphereCovering(*region);
+    }
 
     // Generate a covering that does not intersect with any previous coverings
     S2CellUnion coverUnion;
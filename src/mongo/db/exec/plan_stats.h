@@ -390,6 +390,9 @@ struct CountScanStats : public SpecificStats {
     bool isUnique;
 
     size_t keysExamined;
+
+    // The number of disjoint key ranges counted between 'startKey' and 'endKey'.
+    size_t numIntervals = 1;
 };
 
 struct DeleteStats : public SpecificStats {
@@ -463,6 +466,12 @@ struct DistinctScanStats : public SpecificStats {
     // How many keys did we look at while distinct-ing?
     size_t keysExamined = 0;
 
+    // Whether the scan skips documents it has already returned, and if so how many RecordIds it
+    // checked for duplicates and how many it skipped.
+    bool shouldDedup = false;
+    size_t dupsTested = 0;
+    size_t dupsDropped = 0;
+
     BSONObj keyPattern;
 
     BSONObj collation;
@@ -1126,6 +1135,11 @@ struct DocumentSourceLookupStats : public SpecificStats {
 
     // Tracks the summary stats in aggregate across all executions of the subpipeline.
     PlanSummaryStats planSummaryStats;
+
+    // The number of input documents whose results were served from, or missing from, the cache of
+    // sub-pipeline results keyed by the values of the 'let' variables.
+    long long resultCacheHits = 0;
+    long long resultCacheMisses = 0;
 };
 
 struct UnionWithStats final : public SpecificStats {
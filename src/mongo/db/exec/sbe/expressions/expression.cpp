@@ -91,6 +91,33 @@ vm::Instruction::Parameter appendParameter(vm::CodeFragment& code,
     return getParam(var);
 }
 
+/**
+ * If 'e' is a 'getField' call whose field name is a constant that fits in an instruction, returns
+ * that field name.
+ */
+boost::optional<StringData> getImmediateFieldName(const EExpression* e) {
+    auto fn = e->as<EFunction>();
+    if (!fn || fn->getName() != "getField"_sd || fn->getArgs().size() != 2) {
+        return boost::none;
+    }
+
+    auto fieldConst = fn->getArgs()[1]->as<EConstant>();
+    if (!fieldConst) {
+        return boost::none;
+    }
+
+    auto [tag, val] = fieldConst->getConstant();
+    if (!value::isString(tag)) {
+        return boost::none;
+    }
+
+    auto fieldName = value::getStringView(tag, val);
+    if (fieldName.size() >= vm::Instruction::kMaxInlineStringSize) {
+        return boost::none;
+    }
+    return fieldName;
+}
+
 /**
  * Set of functions that allocate one or two labels, constructs code using 'f', and cleans up the
  * labels before returning the constructed code. These functions should be used when working with
@@ -126,6 +153,9 @@ std::string EExpression::toString() const {
 }
 
 std::unique_ptr<EExpression> EConstant::clone() const {
+    if (_sharedOwner) {
+        return std::unique_ptr<EConstant>(new EConstant(*this));
+    }
     auto [tag, val] = value::copyValue(_tag, _val);
     return std::make_unique<EConstant>(tag, val);
 }
@@ -296,15 +326,25 @@ vm::CodeFragment EPrimBinary::compileDirect(CompileCtx& ctx) const {
         if (EConstant* rhsConst = _nodes[1]->as<EConstant>()) {
             vm::CodeFragment code;
             auto [tag, val] = rhsConst->getConstant();
+            boost::optional<vm::Instruction::Constants> k;
             if (tag == value::TypeTags::Null) {
-                code.append(_nodes[0]->compileDirect(ctx));
-                code.appendFillEmpty(vm::Instruction::Null);
-                return code;
+                k = vm::Instruction::Null;
+            } else if (tag == value::TypeTags::Boolean) {
+                k = value::bitcastTo<bool>(val) ? vm::Instruction::True : vm::Instruction::False;
             }
-            if (tag == value::TypeTags::Boolean) {
+
+            if (k) {
+                // 'fillEmpty(getField(x, "f"), k)' is very common in generated plans, so emit it
+                // as a single instruction to save a dispatch and a stack round-trip.
+                if (auto fieldName = getImmediateFieldName(_nodes[0].get())) {
+                    auto param = appendParameter(
+                        code, ctx, _nodes[0]->as<EFunction>()->getArgs()[0].get());
+                    code.appendGetFieldFillEmpty(param, *fieldName, *k);
+                    return code;
+                }
+
                 code.append(_nodes[0]->compileDirect(ctx));
-                code.appendFillEmpty(value::bitcastTo<bool>(val) ? vm::Instruction::True
-                                                                 : vm::Instruction::False);
+                code.appendFillEmpty(*k);
                 return code;
             }
         }
@@ -933,6 +973,15 @@ static stdx::unordered_map<std::string, BuiltinFn> kBuiltinFunctions = {
      BuiltinFn{[](size_t n) { return n == 2; }, vm::Builtin::aggRemovableBottomNRemove, true}},
     {"aggRemovableBottomNFinalize",
      BuiltinFn{[](size_t n) { return n == 1; }, vm::Builtin::aggRemovableBottomNFinalize, false}},
+    {"aggRemovablePercentileAdd",
+     BuiltinFn{[](size_t n) { return n == 1; }, vm::Builtin::aggRemovablePercentileAdd, true}},
+    {"aggRemovablePercentileRemove",
+     BuiltinFn{[](size_t n) { return n == 1; }, vm::Builtin::aggRemovablePercentileRemove, true}},
+    {"aggRemovablePercentileFinalize",
+     BuiltinFn{
+         [](size_t n) { return n == 2; }, vm::Builtin::aggRemovablePercentileFinalize, false}},
+    {"aggRemovableMedianFinalize",
+     BuiltinFn{[](size_t n) { return n == 1; }, vm::Builtin::aggRemovableMedianFinalize, false}},
     {"valueBlockExists",
      BuiltinFn{[](size_t n) { return n == 1; }, vm::Builtin::valueBlockExists, false}},
     {"valueBlockTypeMatch",
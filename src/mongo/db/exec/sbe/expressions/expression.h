@@ -251,14 +251,19 @@ auto makeAggExprVector(Ts&&... pack) {
  */
 class EConstant final : public EExpression {
 public:
-    EConstant(value::TypeTags tag, value::Value val) : _tag(tag), _val(val) {}
+    EConstant(value::TypeTags tag, value::Value val) : _tag(tag), _val(val) {
+        takeOwnership();
+    }
     EConstant(StringData str) {
         // Views are non-owning so we have to make a copy.
         std::tie(_tag, _val) = value::makeNewString(str);
+        takeOwnership();
     }
 
     ~EConstant() override {
-        value::releaseValue(_tag, _val);
+        if (!_sharedOwner) {
+            value::releaseValue(_tag, _val);
+        }
     }
 
     std::unique_ptr<EExpression> clone() const override;
@@ -272,8 +277,32 @@ public:
     }
 
 private:
+    /**
+     * Constants of deep types that are never modified once built are held through a shared owner,
+     * so cloning the expression (e.g. when recovering a plan from the SBE plan cache) shares the
+     * value instead of deep-copying it. Other deep types, like sort specs, keep mutable scratch
+     * state and are owned by each clone.
+     */
+    static bool isShareable(value::TypeTags tag) {
+        return value::isString(tag) || value::isBsonRegex(tag) ||
+            tag == value::TypeTags::NumberDecimal || tag == value::TypeTags::ObjectId ||
+            tag == value::TypeTags::bsonObject || tag == value::TypeTags::bsonArray ||
+            tag == value::TypeTags::bsonObjectId || tag == value::TypeTags::bsonBinData ||
+            tag == value::TypeTags::bsonJavascript || tag == value::TypeTags::bsonSymbol;
+    }
+
+    EConstant(const EConstant& other)
+        : _tag(other._tag), _val(other._val), _sharedOwner(other._sharedOwner) {}
+
+    void takeOwnership() {
+        if (!value::isShallowType(_tag) && isShareable(_tag)) {
+            _sharedOwner = std::make_shared<const value::ValueGuard>(_tag, _val);
+        }
+    }
+
     value::TypeTags _tag;
     value::Value _val;
+    std::shared_ptr<const value::ValueGuard> _sharedOwner;
 };
 
 /**
@@ -423,6 +452,14 @@ public:
         validateNodes();
     }
 
+    StringData getName() const {
+        return _name;
+    }
+
+    const EExpression::Vector& getArgs() const {
+        return _nodes;
+    }
+
     std::unique_ptr<EExpression> clone() const override;
 
     vm::CodeFragment compileDirect(CompileCtx& ctx) const override;
@@ -28,6 +28,7 @@
  */
 
 #include <cstdint>
+#include <limits>
 #include <memory>
 #include <string>
 
@@ -88,6 +89,11 @@ public:
                       std::vector<bool> bitsetData,
                       TypedValue expectedResult);
 
+    void testBlockSum(sbe::value::OwnedValueAccessor& aggAccessor,
+                      value::ValueBlock* block,
+                      std::vector<bool> bitsetData,
+                      TypedValue expectedResult);
+
     enum class BlockType { HETEROGENEOUS = 0, MONOBLOCK, BOOLBLOCK };
 
     void testBlockLogicalOp(EPrimBinary::Op scalarOp,
@@ -1057,6 +1063,64 @@ TEST_F(SBEBlockExpressionTest, BlockAggSumTest) {
                  makeDecimal("250"));
 }  // BlockAggSumTest
 
+TEST_F(SBEBlockExpressionTest, BlockAggSumHomogeneousTest) {
+    sbe::value::OwnedValueAccessor aggAccessor;
+    bindAccessor(&aggAccessor);
+
+    {
+        value::Int32Block block;
+        for (int32_t i : {1, 2, 3, 4}) {
+            block.push_back(i);
+        }
+        testBlockSum(aggAccessor,
+                     &block,
+                     {true, false, true, true},
+                     {value::TypeTags::NumberInt32, value::bitcastFrom<int32_t>(8)});
+        testBlockSum(aggAccessor, &block, {false, false, false, false}, makeNothing());
+    }
+    {
+        // A partial sum which leaves the int32 range promotes the result to int64, even if the
+        // final value would fit.
+        value::Int32Block block;
+        for (int32_t i : {std::numeric_limits<int32_t>::max(), 1, -2}) {
+            block.push_back(i);
+        }
+        testBlockSum(aggAccessor,
+                     &block,
+                     {true, true, true},
+                     {value::TypeTags::NumberInt64,
+                      value::bitcastFrom<int64_t>(std::numeric_limits<int32_t>::max() - 1)});
+    }
+    {
+        // An int64 overflow falls back to the generic path, which produces a double.
+        value::Int64Block block;
+        block.push_back(std::numeric_limits<int64_t>::max());
+        block.push_back(int64_t{1});
+        testBlockSum(aggAccessor,
+                     &block,
+                     {true, true},
+                     makeDouble(static_cast<double>(std::numeric_limits<int64_t>::max()) + 1));
+    }
+    {
+        value::DoubleBlock block;
+        for (double d : {0.5, 1.5, 2.5}) {
+            block.push_back(d);
+        }
+        testBlockSum(aggAccessor, &block, {true, true, false}, makeDouble(2.0));
+    }
+    {
+        // Non-dense blocks still go through the generic path.
+        value::Int64Block block;
+        block.push_back(int64_t{5});
+        block.pushNothing();
+        block.push_back(int64_t{7});
+        testBlockSum(aggAccessor,
+                     &block,
+                     {true, true, true},
+                     {value::TypeTags::NumberInt64, value::bitcastFrom<int64_t>(12)});
+    }
+}  // BlockAggSumHomogeneousTest
+
 TEST_F(SBEBlockExpressionTest, BlockAggDoubleDoubleSumTest) {
     sbe::value::OwnedValueAccessor aggAccessor;
     bindAccessor(&aggAccessor);
@@ -2420,6 +2484,19 @@ void SBEBlockExpressionTest::testBlockSum(sbe::value::OwnedValueAccessor& aggAcc
                                           std::vector<bool> bitsetData,
                                           TypedValue expectedResult) {
     ASSERT_EQ(blockData.size(), bitsetData.size());
+
+    value::HeterogeneousBlock block;
+    for (auto&& p : blockData) {
+        block.push_back(p);
+    }
+    testBlockSum(aggAccessor, &block, std::move(bitsetData), expectedResult);
+}
+
+void SBEBlockExpressionTest::testBlockSum(sbe::value::OwnedValueAccessor& aggAccessor,
+                                          value::ValueBlock* block,
+                                          std::vector<bool> bitsetData,
+                                          TypedValue expectedResult) {
+    ASSERT_EQ(*block->tryCount(), bitsetData.size());
     value::ValueGuard expectedResultGuard(expectedResult);
 
     value::ViewOfValueAccessor blockAccessor;
@@ -2427,12 +2504,8 @@ void SBEBlockExpressionTest::testBlockSum(sbe::value::OwnedValueAccessor& aggAcc
     auto blockSlot = bindAccessor(&blockAccessor);
     auto bitsetSlot = bindAccessor(&bitsetAccessor);
 
-    value::HeterogeneousBlock block;
-    for (auto&& p : blockData) {
-        block.push_back(p);
-    }
     blockAccessor.reset(sbe::value::TypeTags::valueBlock,
-                        value::bitcastFrom<value::ValueBlock*>(&block));
+                        value::bitcastFrom<value::ValueBlock*>(block));
 
     auto bitset = makeHeterogeneousBoolBlock(bitsetData);
     bitsetAccessor.reset(sbe::value::TypeTags::valueBlock,
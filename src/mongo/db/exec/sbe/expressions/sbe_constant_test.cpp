@@ -93,4 +93,32 @@ TEST_F(SBEConstantTest, SbeConstants) {
     verifyConstantExpression(os, makeObject(BSON("a"_sd << 1 << "b"_sd << 2)));
 }
 
+TEST(SBEConstantCloneTest, CloneSharesImmutableDeepValues) {
+    constexpr auto kStr = "a string which is too long to be stored inline"_sd;
+    auto [tag, val] = value::makeNewString(kStr);
+    auto expr = makeE<EConstant>(tag, val);
+
+    auto clone = expr->clone();
+    auto [cloneTag, cloneVal] = clone->as<EConstant>()->getConstant();
+    ASSERT_EQ(cloneTag, tag);
+    ASSERT_EQ(cloneVal, val);
+
+    // The clone keeps the shared value alive after the original is destroyed.
+    expr.reset();
+    ASSERT_EQ(value::getStringView(cloneTag, cloneVal), kStr);
+}
+
+TEST(SBEConstantCloneTest, CloneCopiesMutableDeepValues) {
+    auto [tag, val] = value::makeNewArray();
+    value::getArrayView(val)->push_back(value::TypeTags::NumberInt32,
+                                        value::bitcastFrom<int32_t>(1));
+    auto expr = makeE<EConstant>(tag, val);
+
+    auto clone = expr->clone();
+    auto [cloneTag, cloneVal] = clone->as<EConstant>()->getConstant();
+    ASSERT_EQ(cloneTag, tag);
+    ASSERT_NE(cloneVal, val);
+    ASSERT_EQ(value::getArrayView(cloneVal)->size(), 1);
+}
+
 }  // namespace mongo::sbe
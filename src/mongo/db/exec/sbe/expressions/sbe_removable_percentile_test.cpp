@@ -0,0 +1,188 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "mongo/db/exec/docval_to_sbeval.h"
+#include "mongo/db/exec/sbe/expression_test_base.h"
+#include "mongo/db/exec/sbe/expressions/expression.h"
+#include "mongo/db/exec/sbe/values/slot.h"
+#include "mongo/db/exec/sbe/values/value.h"
+#include "mongo/unittest/assert.h"
+#include "mongo/unittest/framework.h"
+
+namespace mongo::sbe {
+
+enum class RemovablePercentileOp { kAdd, kRemove };
+
+class SBERemovablePercentileTest : public EExpressionTestFixture {
+public:
+    using MakeFinalizeFn = std::function<std::unique_ptr<EExpression>(value::SlotId)>;
+
+    void runAndAssertExpression(std::vector<std::pair<value::TypeTags, value::Value>>& inputValues,
+                                std::vector<RemovablePercentileOp>& operations,
+                                const MakeFinalizeFn& makeFinalize,
+                                std::vector<std::pair<value::TypeTags, value::Value>>& expValues) {
+        value::ViewOfValueAccessor inputAccessor;
+        auto inputSlot = bindAccessor(&inputAccessor);
+
+        value::OwnedValueAccessor aggAccessor;
+        auto aggSlot = bindAccessor(&aggAccessor);
+
+        auto aggRemovablePercentileAdd = sbe::makeE<sbe::EFunction>(
+            "aggRemovablePercentileAdd", sbe::makeEs(makeE<EVariable>(inputSlot)));
+        auto compiledAdd = compileAggExpression(*aggRemovablePercentileAdd, &aggAccessor);
+
+        auto aggRemovablePercentileRemove = sbe::makeE<sbe::EFunction>(
+            "aggRemovablePercentileRemove", sbe::makeEs(makeE<EVariable>(inputSlot)));
+        auto compiledRemove = compileAggExpression(*aggRemovablePercentileRemove, &aggAccessor);
+
+        auto finalize = makeFinalize(aggSlot);
+        auto compiledFinalize = compileExpression(*finalize);
+
+        // Apply each operation to the next input for that operation, and finalize after each one.
+        size_t addIdx = 0, removeIdx = 0;
+        for (size_t i = 0; i < operations.size(); ++i) {
+            vm::CodeFragment* compiledExpr;
+            size_t idx;
+            if (operations[i] == RemovablePercentileOp::kAdd) {
+                compiledExpr = compiledAdd.get();
+                idx = addIdx++;
+            } else {
+                compiledExpr = compiledRemove.get();
+                idx = removeIdx++;
+            }
+            inputAccessor.reset(inputValues[idx].first, inputValues[idx].second);
+            auto [runTag, runVal] = runCompiledExpression(compiledExpr);
+
+            aggAccessor.reset(runTag, runVal);
+            auto out = runCompiledExpression(compiledFinalize.get());
+
+            ASSERT_EQ(out.first, expValues[i].first);
+            ASSERT_THAT(out, ValueEq(expValues[i]));
+
+            value::releaseValue(out.first, out.second);
+            value::releaseValue(expValues[i].first, expValues[i].second);
+        }
+        for (size_t i = 0; i < inputValues.size(); ++i) {
+            value::releaseValue(inputValues[i].first, inputValues[i].second);
+        }
+    }
+};
+
+TEST_F(SBERemovablePercentileTest, MedianIgnoresNonNumericInputs) {
+    std::vector<std::pair<value::TypeTags, value::Value>> inputValues = {
+        {value::TypeTags::NumberInt32, value::bitcastFrom<int32_t>(5)},
+        {value::TypeTags::NumberInt64, value::bitcastFrom<int64_t>(1)},
+        value::makeNewString("str"),
+        {value::TypeTags::NumberDouble, value::bitcastFrom<double>(3.0)},
+        {value::TypeTags::NumberInt32, value::bitcastFrom<int32_t>(2)},
+    };
+
+    std::vector<RemovablePercentileOp> ops = {RemovablePercentileOp::kAdd,
+                                              RemovablePercentileOp::kAdd,
+                                              RemovablePercentileOp::kAdd,
+                                              RemovablePercentileOp::kAdd,
+                                              RemovablePercentileOp::kAdd,
+                                              RemovablePercentileOp::kRemove,
+                                              RemovablePercentileOp::kRemove,
+                                              RemovablePercentileOp::kRemove,
+                                              RemovablePercentileOp::kRemove,
+                                              RemovablePercentileOp::kRemove};
+
+    std::vector<std::pair<value::TypeTags, value::Value>> expValues = {
+        value::makeValue(Value(5.0)),
+        value::makeValue(Value(1.0)),
+        value::makeValue(Value(1.0)),
+        value::makeValue(Value(3.0)),
+        value::makeValue(Value(2.0)),
+        value::makeValue(Value(2.0)),
+        value::makeValue(Value(2.0)),
+        value::makeValue(Value(2.0)),
+        value::makeValue(Value(2.0)),
+        {value::TypeTags::Null, 0},
+    };
+
+    runAndAssertExpression(
+        inputValues,
+        ops,
+        [](value::SlotId aggSlot) {
+            return sbe::makeE<sbe::EFunction>("aggRemovableMedianFinalize",
+                                              sbe::makeEs(makeE<EVariable>(aggSlot)));
+        },
+        expValues);
+}
+
+TEST_F(SBERemovablePercentileTest, PercentilesOfSlidingWindow) {
+    std::vector<std::pair<value::TypeTags, value::Value>> inputValues = {
+        {value::TypeTags::NumberInt32, value::bitcastFrom<int32_t>(40)},
+        {value::TypeTags::NumberInt32, value::bitcastFrom<int32_t>(10)},
+        {value::TypeTags::NumberInt32, value::bitcastFrom<int32_t>(30)},
+        {value::TypeTags::NumberInt32, value::bitcastFrom<int32_t>(20)},
+    };
+
+    std::vector<RemovablePercentileOp> ops = {RemovablePercentileOp::kAdd,
+                                              RemovablePercentileOp::kAdd,
+                                              RemovablePercentileOp::kAdd,
+                                              RemovablePercentileOp::kAdd,
+                                              RemovablePercentileOp::kRemove,
+                                              RemovablePercentileOp::kRemove,
+                                              RemovablePercentileOp::kRemove,
+                                              RemovablePercentileOp::kRemove};
+
+    // The percentiles are 0, 0.5 and 0.9, which pick the values at ranks 0, ceil(n/2)-1 and
+    // ceil(0.9n)-1 of the sorted window.
+    std::vector<std::pair<value::TypeTags, value::Value>> expValues = {
+        value::makeValue(Value(BSON_ARRAY(40.0 << 40.0 << 40.0))),
+        value::makeValue(Value(BSON_ARRAY(10.0 << 10.0 << 40.0))),
+        value::makeValue(Value(BSON_ARRAY(10.0 << 30.0 << 40.0))),
+        value::makeValue(Value(BSON_ARRAY(10.0 << 20.0 << 40.0))),
+        value::makeValue(Value(BSON_ARRAY(10.0 << 20.0 << 30.0))),
+        value::makeValue(Value(BSON_ARRAY(20.0 << 20.0 << 30.0))),
+        value::makeValue(Value(BSON_ARRAY(20.0 << 20.0 << 20.0))),
+        value::makeValue(Value(BSON_ARRAY(BSONNULL << BSONNULL << BSONNULL))),
+    };
+
+    runAndAssertExpression(
+        inputValues,
+        ops,
+        [](value::SlotId aggSlot) {
+            auto [psTag, psVal] = value::makeValue(Value(BSON_ARRAY(0.0 << 0.5 << 0.9)));
+            return sbe::makeE<sbe::EFunction>(
+                "aggRemovablePercentileFinalize",
+                sbe::makeEs(makeE<EVariable>(aggSlot), makeE<EConstant>(psTag, psVal)));
+        },
+        expValues);
+}
+}  // namespace mongo::sbe
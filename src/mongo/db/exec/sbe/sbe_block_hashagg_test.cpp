@@ -41,6 +41,7 @@
 #include "mongo/db/exec/sbe/stages/block_hashagg.h"
 #include "mongo/db/exec/sbe/values/slot.h"
 #include "mongo/db/exec/sbe/values/value.h"
+#include "mongo/idl/server_parameter_test_util.h"
 
 namespace mongo::sbe {
 
@@ -181,7 +182,8 @@ public:
                                    AccNamesVector accNames,
                                    TestResultType expectedResultsMap,
                                    std::vector<size_t> expectedOutputBlockSizes,
-                                   bool spillToDisk) {
+                                   bool spillToDisk,
+                                   bool forceIncreasedSpilling = true) {
         // The user may specify a list of block IDs or a 'scalarId'.
         for (auto& bucket : inputData) {
             invariant(bucket.ids.empty() != /* XOR */
@@ -266,7 +268,7 @@ public:
                                                      nullptr /* yieldPolicy */,
                                                      kEmptyPlanNodeId,
                                                      true,
-                                                     spillToDisk /* forceIncreasedSpilling */);
+                                                     spillToDisk && forceIncreasedSpilling);
             return std::make_pair(outputSlots, std::move(outStage));
         };
 
@@ -777,6 +779,46 @@ TEST_F(BlockHashAggStageTest, BlockOutSizeTest) {
                          1});
 }
 
+TEST_F(BlockHashAggStageTest, SpillWhenHighCardinalityExceedsMemoryLimit) {
+    // Use a memory budget small enough that the hash table has to be spilled several times while
+    // consuming the input, rather than on every block as 'forceIncreasedSpilling' does.
+    RAIIServerParameterControllerForTest memoryLimit(
+        "internalQuerySlotBasedExecutionHashAggApproxMemoryUseInBytesBeforeSpill", 4 * 1024);
+
+    TestResultType expected;
+    std::vector<Bucket> buckets;
+    const size_t numKeys = BlockHashAggStage::kBlockOutSize * 4;
+    for (size_t blockIdx = 0; blockIdx < 4; ++blockIdx) {
+        // Every key appears in two different blocks, so partial aggregates for the same key end up
+        // in different spills and have to be merged.
+        std::vector<int32_t> ids;
+        std::vector<bool> bitmap;
+        std::vector<int32_t> data;
+        for (size_t i = 0; i < numKeys / 2; ++i) {
+            int32_t id = (blockIdx % 2) * (numKeys / 2) + i;
+            int32_t dataPoint = blockIdx + 1;
+            ids.push_back(id);
+            bitmap.push_back(true);
+            data.push_back(dataPoint);
+            expected.emplace(std::vector<int32_t>{id}, std::vector<int32_t>{0});
+            expected[std::vector<int32_t>{id}][0] += dataPoint;
+        }
+        buckets.push_back(Bucket{.ids = {makeInt32sBlock(ids)},
+                                 .bitset = bitmap,
+                                 .dataBlocks = {makeInt32sBlock(data)}});
+    }
+
+    runBlockHashAggTestHelper(buckets,
+                              {{"valueBlockAggSum", "sum", "sum"}},
+                              expected,
+                              {BlockHashAggStage::kBlockOutSize,
+                               BlockHashAggStage::kBlockOutSize,
+                               BlockHashAggStage::kBlockOutSize,
+                               BlockHashAggStage::kBlockOutSize},
+                              true /* spillToDisk */,
+                              false /* forceIncreasedSpilling */);
+}
+
 namespace {
 class MinFunctor {
 public:
@@ -28,7 +28,8 @@
  */
 
 /**
- * This file contains tests for sbe::TsBlockToCellBlockStage and sbe::BlockToRowStage.
+ * This file contains tests for sbe::TsBlockToCellBlockStage, sbe::BlockToRowStage and
+ * sbe::RowToBlockStage.
  */
 
 #include <cstdint>
@@ -42,6 +43,7 @@
 #include "mongo/db/exec/sbe/sbe_plan_stage_test.h"
 #include "mongo/db/exec/sbe/sbe_unittest.h"
 #include "mongo/db/exec/sbe/stages/block_to_row.h"
+#include "mongo/db/exec/sbe/stages/row_to_block.h"
 #include "mongo/db/exec/sbe/stages/stages.h"
 #include "mongo/db/exec/sbe/stages/ts_bucket_to_cell_block.h"
 #include "mongo/db/exec/sbe/values/slot.h"
@@ -870,4 +872,82 @@ TEST_F(BlockStagesTest, BlockToRowNoValuesFiltered) {
                       {std::vector<bool>{true, true, true, true, true, true}},
                       makeIntArray({1, 2, 3, 4, 5, 6}));
 }
+
+TEST_F(BlockStagesTest, RowToBlockBatchesRows) {
+    auto [scanSlot, scan] = generateVirtualScan(BSON_ARRAY(1 << 2 << 3 << 4 << 5 << 6 << 7));
+
+    auto blockSlot = generateSlotId();
+    auto bitmapSlot = generateSlotId();
+    auto rowToBlock = makeS<RowToBlockStage>(std::move(scan),
+                                             value::SlotVector{scanSlot},
+                                             value::SlotVector{blockSlot},
+                                             bitmapSlot,
+                                             3 /* blockSize */,
+                                             1 /* nodeId */,
+                                             getYieldPolicy());
+
+    auto ctx = makeCompileCtx();
+    prepareTree(ctx.get(), rowToBlock.get());
+    auto blockAccessor = rowToBlock->getAccessor(*ctx, blockSlot);
+    auto bitmapAccessor = rowToBlock->getAccessor(*ctx, bitmapSlot);
+
+    // The seven input rows are gathered into blocks of 3, 3 and 1 values.
+    std::vector<std::vector<int>> expectedBlocks{{1, 2, 3}, {4, 5, 6}, {7}};
+    size_t i = 0;
+    for (auto st = rowToBlock->getNext(); st == PlanState::ADVANCED;
+         st = rowToBlock->getNext(), ++i) {
+        ASSERT_LT(i, expectedBlocks.size());
+
+        auto [blockTag, blockVal] = blockAccessor->getViewOfValue();
+        ASSERT_EQ(blockTag, value::TypeTags::valueBlock);
+        auto extracted = value::getValueBlock(blockVal)->extract();
+        auto expected = makeIntArray(expectedBlocks[i]);
+        ASSERT_EQ(extracted.count(), expected.size());
+        for (size_t j = 0; j < extracted.count(); ++j) {
+            ASSERT_THAT(extracted[j], ValueEq(expected.getAt(j)));
+        }
+
+        auto [bitmapTag, bitmapVal] = bitmapAccessor->getViewOfValue();
+        ASSERT_EQ(bitmapTag, value::TypeTags::valueBlock);
+        auto bitmap = value::getValueBlock(bitmapVal)->extract();
+        ASSERT_EQ(bitmap.count(), expected.size());
+        for (size_t j = 0; j < bitmap.count(); ++j) {
+            ASSERT_EQ(bitmap[j].first, value::TypeTags::Boolean);
+            ASSERT_TRUE(value::bitcastTo<bool>(bitmap[j].second));
+        }
+    }
+    ASSERT_EQ(i, expectedBlocks.size());
+}
+
+TEST_F(BlockStagesTest, RowToBlockRoundTripsThroughBlockToRow) {
+    auto [scanSlot, scan] = generateVirtualScan(BSON_ARRAY(1 << 2 << 3 << 4 << 5));
+
+    auto blockSlot = generateSlotId();
+    auto bitmapSlot = generateSlotId();
+    auto rowToBlock = makeS<RowToBlockStage>(std::move(scan),
+                                             value::SlotVector{scanSlot},
+                                             value::SlotVector{blockSlot},
+                                             bitmapSlot,
+                                             2 /* blockSize */,
+                                             1 /* nodeId */,
+                                             getYieldPolicy());
+    auto [blockToRow, outSlots] =
+        makeBlockToRow(std::move(rowToBlock), value::SlotVector{blockSlot}, bitmapSlot);
+
+    auto ctx = makeCompileCtx();
+    prepareTree(ctx.get(), blockToRow.get());
+    auto accessor = blockToRow->getAccessor(*ctx, outSlots[0]);
+
+    auto expected = makeIntArray({1, 2, 3, 4, 5});
+    size_t i = 0;
+    for (auto st = blockToRow->getNext(); st == PlanState::ADVANCED;
+         st = blockToRow->getNext(), ++i) {
+        ASSERT_THAT(accessor->getViewOfValue(), ValueEq(expected.getAt(i)));
+
+        // Yielding in the middle of a block must not lose the remaining values.
+        blockToRow->saveState(false);
+        blockToRow->restoreState(false);
+    }
+    ASSERT_EQ(i, expected.size());
+}
 }  // namespace mongo::sbe
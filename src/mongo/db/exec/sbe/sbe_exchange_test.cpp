@@ -0,0 +1,91 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+/**
+ * This file contains tests for sbe::ExchangeConsumer.
+ */
+
+#include <memory>
+#include <utility>
+
+#include "mongo/base/error_codes.h"
+#include "mongo/db/client.h"
+#include "mongo/db/exec/sbe/expressions/expression.h"
+#include "mongo/db/exec/sbe/sbe_plan_stage_test.h"
+#include "mongo/db/exec/sbe/stages/co_scan.h"
+#include "mongo/db/exec/sbe/stages/exchange.h"
+#include "mongo/db/exec/sbe/stages/filter.h"
+#include "mongo/db/exec/sbe/stages/project.h"
+#include "mongo/db/exec/sbe/values/slot.h"
+#include "mongo/db/exec/sbe/values/value.h"
+#include "mongo/db/query/stage_types.h"
+#include "mongo/db/service_context.h"
+#include "mongo/unittest/assert.h"
+#include "mongo/unittest/framework.h"
+
+namespace mongo::sbe {
+
+using ExchangeStageTest = PlanStageTestFixture;
+
+TEST_F(ExchangeStageTest, KillingTheOperationStopsTheProducers) {
+    // Every producer reads an endless input without ever producing a row, so it only stops when
+    // it is interrupted.
+    auto outSlot = generateSlotId();
+    auto input = makeProjectStage(
+        makeS<CoScanStage>(kEmptyPlanNodeId),
+        kEmptyPlanNodeId,
+        outSlot,
+        makeE<EConstant>(value::TypeTags::NumberInt64, value::bitcastFrom<int64_t>(1)));
+    auto filter = makeS<FilterStage<false>>(
+        std::move(input),
+        makeE<EConstant>(value::TypeTags::Boolean, value::bitcastFrom<bool>(false)),
+        kEmptyPlanNodeId);
+    auto exchange = makeS<ExchangeConsumer>(std::move(filter),
+                                            2 /* numOfProducers */,
+                                            value::SlotVector{outSlot},
+                                            ExchangePolicy::roundrobin,
+                                            nullptr /* partition */,
+                                            nullptr /* orderLess */,
+                                            kEmptyPlanNodeId);
+
+    auto ctx = makeCompileCtx();
+    prepareTree(ctx.get(), exchange.get(), outSlot);
+
+    {
+        stdx::lock_guard<Client> lk(*operationContext()->getClient());
+        getServiceContext()->killOperation(lk, operationContext(), ErrorCodes::Interrupted);
+    }
+
+    // The consumer notices the kill while it waits for the producers and passes it on to them, so
+    // closing the stage does not hang and does not rethrow the producers' interruption.
+    ASSERT_THROWS_CODE(exchange->getNext(), DBException, ErrorCodes::Interrupted);
+    exchange->close();
+}
+
+}  // namespace mongo::sbe
@@ -69,6 +69,7 @@
 #include "mongo/db/query/sbe_stage_builder_helpers.h"
 #include "mongo/db/query/stage_types.h"
 #include "mongo/db/record_id.h"
+#include "mongo/idl/server_parameter_test_util.h"
 #include "mongo/platform/atomic_word.h"
 #include "mongo/stdx/unordered_map.h"
 #include "mongo/unittest/assert.h"
@@ -572,6 +573,83 @@ TEST_F(HashAggStageTest, HashAggBasicCountSpill) {
     stage->close();
 }
 
+TEST_F(HashAggStageTest, HashAggBasicCountSpillToSortedFiles) {
+    // We estimate the size of result row like {int64, int64} at 50B. Set the memory threshold to
+    // 64B so that exactly one row fits in memory.
+    auto defaultInternalQuerySBEAggApproxMemoryUseInBytesBeforeSpill =
+        internalQuerySBEAggApproxMemoryUseInBytesBeforeSpill.load();
+    internalQuerySBEAggApproxMemoryUseInBytesBeforeSpill.store(64);
+    ON_BLOCK_EXIT([&] {
+        internalQuerySBEAggApproxMemoryUseInBytesBeforeSpill.store(
+            defaultInternalQuerySBEAggApproxMemoryUseInBytesBeforeSpill);
+    });
+    // Spill to sorted-run files, writing out a run for every spilled record.
+    RAIIServerParameterControllerForTest spillToSortedFiles{
+        "internalQuerySlotBasedExecutionHashAggSpillToSortedFiles", true};
+    RAIIServerParameterControllerForTest sortedFileMemoryLimit{
+        "internalQuerySlotBasedExecutionSortedFileSpillingMaxMemoryUsageBytes", 1};
+
+    auto ctx = makeCompileCtx();
+
+    // Build a scan of the [5,6,7,5,6,7,6,7,7] input array.
+    auto [inputTag, inputVal] =
+        stage_builder::makeValue(BSON_ARRAY(5 << 6 << 7 << 5 << 6 << 7 << 6 << 7 << 7));
+    auto [scanSlot, scanStage] = generateVirtualScan(inputTag, inputVal);
+
+    // Build a HashAggStage, group by the scanSlot and compute a simple count.
+    auto countsSlot = generateSlotId();
+    auto spillSlot = generateSlotId();
+    auto stage = makeS<HashAggStage>(
+        std::move(scanStage),
+        makeSV(scanSlot),
+        makeAggExprVector(
+            countsSlot,
+            nullptr,
+            stage_builder::makeFunction(
+                "sum",
+                makeE<EConstant>(value::TypeTags::NumberInt64, value::bitcastFrom<int64_t>(1)))),
+        makeSV(),  // Seek slot
+        true,
+        boost::none,
+        true /* allowDiskUse */,
+        makeSlotExprPairVec(
+            spillSlot, stage_builder::makeFunction("sum", stage_builder::makeVariable(spillSlot))),
+        nullptr /* yieldPolicy */,
+        kEmptyPlanNodeId);
+
+    // Prepare the tree and get the 'SlotAccessor' for the output slot.
+    auto resultAccessor = prepareTree(ctx.get(), stage.get(), countsSlot);
+
+    // Read in all of the results.
+    std::set<int64_t> results;
+    while (stage->getNext() == PlanState::ADVANCED) {
+        auto [resTag, resVal] = resultAccessor->getViewOfValue();
+        ASSERT_EQ(value::TypeTags::NumberInt64, resTag);
+        ASSERT_TRUE(results.insert(value::bitcastFrom<int64_t>(resVal)).second);
+    }
+
+    // Check that the results match the expected.
+    ASSERT_EQ(3, results.size());
+    ASSERT_EQ(1, results.count(2));  // 2 of "5"s
+    ASSERT_EQ(1, results.count(3));  // 3 of "6"s
+    ASSERT_EQ(1, results.count(4));  // 4 of "7"s
+
+    // Check that the spilling behavior matches the expected.
+    auto stats = static_cast<const HashAggStats*>(stage->getSpecificStats());
+    ASSERT_TRUE(stats->usedDisk);
+    // Memory usage is estimated only every two rows at the most frequent. Also, we only start
+    // spilling after estimating that the memory budget is exceeded. These two factors result in
+    // fewer expected spills than there are input records, even though only one record fits in
+    // memory at a time.
+    ASSERT_EQ(stats->spills, 3);
+    // The input has one run of two consecutive values, so we expect to spill as many records as
+    // there are input values minus one.
+    ASSERT_EQ(stats->spilledRecords, 8);
+    ASSERT_GT(stats->spilledDataStorageSize, 0);
+
+    stage->close();
+}
+
 TEST_F(HashAggStageTest, HashAggBasicCountNoSpillIfNoMemCheck) {
     // We estimate the size of result row like {int64, int64} at 50B. Set the memory threshold to
     // 64B so that exactly one row fits in memory and spill would be required. At the same time, set
@@ -1002,6 +1080,53 @@ TEST_F(HashAggStageTest, HashAggSum10Groups) {
     stage->close();
 }
 
+TEST_F(HashAggStageTest, HashAggSumHighCardinality) {
+    auto ctx = makeCompileCtx();
+
+    // Every key appears twice, with the second occurrence arriving after many other keys have been
+    // inserted, so the hash table grows while groups are still being accumulated.
+    const int numKeys = 10000;
+    BSONArrayBuilder builder;
+    for (int round = 0; round < 2; ++round) {
+        for (int i = 0; i < numKeys; ++i) {
+            builder.append(i);
+        }
+    }
+
+    auto [inputTag, inputVal] = stage_builder::makeValue(BSONArray(builder.done()));
+    auto [scanSlot, scanStage] = generateVirtualScan(inputTag, inputVal);
+
+    auto sumsSlot = generateSlotId();
+    auto stage = makeS<HashAggStage>(
+        std::move(scanStage),
+        makeSV(scanSlot),
+        makeAggExprVector(
+            sumsSlot, nullptr, stage_builder::makeFunction("sum", makeE<EVariable>(scanSlot))),
+        makeSV(),  // Seek slot
+        true,
+        boost::none,
+        false,  // allowDiskUse=false
+        makeSlotExprPairVec() /* mergingExprs */,
+        nullptr /* yieldPolicy */,
+        kEmptyPlanNodeId);
+
+    auto resultAccessors = prepareTree(ctx.get(), stage.get(), makeSV(scanSlot, sumsSlot));
+
+    int numGroups = 0;
+    while (stage->getNext() == PlanState::ADVANCED) {
+        auto [resGroupByTag, resGroupByVal] = resultAccessors[0]->getViewOfValue();
+        auto [resSumTag, resSumVal] = resultAccessors[1]->getViewOfValue();
+        ASSERT_EQ(resGroupByTag, value::TypeTags::NumberInt32);
+        assertValuesEqual(resSumTag,
+                          resSumVal,
+                          value::TypeTags::NumberInt32,
+                          value::bitcastFrom<int>(2 * value::bitcastTo<int>(resGroupByVal)));
+        ++numGroups;
+    }
+    ASSERT_EQ(numGroups, numKeys);
+    stage->close();
+}
+
 TEST_F(HashAggStageTest, HashAggBasicCountWithRecordIds) {
     auto ctx = makeCompileCtx();
 
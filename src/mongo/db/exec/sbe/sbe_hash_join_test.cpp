@@ -159,4 +159,38 @@ TEST_F(HashJoinStageTest, HashJoinCollationTest) {
     }
 }
 
+TEST_F(HashJoinStageTest, HashJoinEmptyBuildSideSkipsProbeSide) {
+    auto [outerTag, outerVal] = stage_builder::makeValue(BSONArray());
+    auto [outerCondSlot, outerStage] = generateVirtualScan(outerTag, outerVal);
+
+    auto [innerTag, innerVal] = stage_builder::makeValue(BSON_ARRAY("a"
+                                                                    << "b"
+                                                                    << "c"));
+    auto [innerCondSlot, innerStage] = generateVirtualScan(innerTag, innerVal);
+
+    auto stage = makeS<HashJoinStage>(std::move(outerStage),
+                                      std::move(innerStage),
+                                      makeSV(outerCondSlot),
+                                      makeSV(),
+                                      makeSV(innerCondSlot),
+                                      makeSV(),
+                                      boost::none /* collatorSlot */,
+                                      nullptr /* yieldPolicy */,
+                                      kEmptyPlanNodeId);
+
+    auto ctx = makeCompileCtx();
+    auto resultAccessors =
+        prepareTree(ctx.get(), stage.get(), makeSV(innerCondSlot, outerCondSlot));
+
+    auto [resultsTag, resultsVal] = getAllResultsMulti(stage.get(), resultAccessors);
+    value::ValueGuard resultsGuard{resultsTag, resultsVal};
+    ASSERT_EQ(resultsTag, value::TypeTags::Array);
+    ASSERT_EQ(value::getArrayView(resultsVal)->size(), 0);
+
+    // The probe side was opened but never asked for a row.
+    auto stats = stage->getStats(false /* includeDebugInfo */);
+    ASSERT_EQ(stats->children.size(), 2);
+    ASSERT_EQ(stats->children[1]->common.advances, 0);
+}
+
 }  // namespace mongo::sbe
@@ -114,6 +114,24 @@ void HashLookupSharedTest::prepareAndEvalStageWithReopen(
 
     stage->close();
 
+    // Probing the spilled hash table one outer row at a time, or in batches smaller than the
+    // input, must not change the output. These runs are not part of the golden output.
+    auto defaultInternalQuerySBELookupSpilledProbeBatchSize =
+        internalQuerySBELookupSpilledProbeBatchSize.load();
+    ON_BLOCK_EXIT([&] {
+        internalQuerySBELookupSpilledProbeBatchSize.store(
+            defaultInternalQuerySBELookupSpilledProbeBatchSize);
+    });
+    for (long long batchSize : {0, 1, 2}) {
+        internalQuerySBELookupSpilledProbeBatchSize.store(batchSize);
+        stage->open(false);
+        std::stringstream batchStream;
+        StageResultsPrinters::make(batchStream, printOptions)
+            .printStageResults(ctx, slotNames, stage);
+        ASSERT_EQ(firstStr, batchStream.str()) << "batch size " << batchSize;
+        stage->close();
+    }
+
     stream << "-- OUTPUT ";
     stream << firstStr;
 }  // prepareAndEvalStageWithReopen
@@ -284,6 +284,66 @@ public:
         expectedGuard.reset();
         runTest(inputTag, inputVal, expectedTag, expectedVal, makeStageFn);
     }
+
+    // Tests that runs of unchanged fields are copied correctly around dropped and computed fields.
+    template <class MkObjStageType>
+    void testProjectAndDropBetweenKeptFields() {
+        auto objOutSlotId = generateSlotId();
+        auto slotVec = makeSV(generateSlotId());
+
+        SlotExprPairVector slotExprVec;
+        slotExprVec.emplace_back(slotVec[0], makeE<EConstant>("one"));
+
+        auto makeStageFn = [objOutSlotId, &slotVec, &slotExprVec](
+                               value::SlotId scanSlot, std::unique_ptr<PlanStage> scanStage) {
+            auto project =
+                makeS<ProjectStage>(std::move(scanStage), std::move(slotExprVec), kEmptyPlanNodeId);
+
+            auto mkobj = makeS<MkObjStageType>(std::move(project),
+                                               objOutSlotId,
+                                               scanSlot,
+                                               MkObjStageType::FieldBehavior::drop,
+                                               std::vector<std::string>{"e"},
+                                               std::vector<std::string>{"c"},
+                                               slotVec,
+                                               false,  // force new
+                                               false,  // return old
+                                               kEmptyPlanNodeId);
+
+            return std::make_pair(objOutSlotId, std::move(mkobj));
+        };
+
+        auto [inputTag, inputVal] = value::makeNewArray();
+        value::ValueGuard inputGuard{inputTag, inputVal};
+        {
+            auto inputView = value::getArrayView(inputVal);
+            addBsonObjToArray(inputView,
+                              BSON("a" << 1 << "b" << 2 << "c" << 3 << "d" << 4 << "e" << 5 << "f"
+                                       << 6 << "g" << 7));
+            addBsonObjToArray(inputView, BSON("e" << 1 << "f" << 2 << "g" << 3));
+            addObjectToArray(inputView,
+                             BSON("a" << 1 << "b" << 2 << "c" << 3 << "d" << 4 << "e" << 5 << "f"
+                                      << 6 << "g" << 7));
+            addObjectToArray(inputView, BSON("e" << 1 << "f" << 2 << "g" << 3));
+        }
+
+        auto [expectedTag, expectedVal] = stage_builder::makeValue(BSON_ARRAY(
+            BSON("a" << 1 << "b" << 2 << "c"
+                     << "one"
+                     << "d" << 4 << "f" << 6 << "g" << 7)
+            << BSON("f" << 2 << "g" << 3 << "c"
+                        << "one")
+            << BSON("a" << 1 << "b" << 2 << "c"
+                        << "one"
+                        << "d" << 4 << "f" << 6 << "g" << 7)
+            << BSON("f" << 2 << "g" << 3 << "c"
+                        << "one")));
+        value::ValueGuard expectedGuard{expectedTag, expectedVal};
+
+        inputGuard.reset();
+        expectedGuard.reset();
+        runTest(inputTag, inputVal, expectedTag, expectedVal, makeStageFn);
+    }
 };
 
 TEST_F(MkObjStageTest, MakeObjKeep) {
@@ -317,4 +377,12 @@ TEST_F(MkObjStageTest, MakeObjProjectWithRoot) {
 TEST_F(MkObjStageTest, MakeBsonObjProjectWithRoot) {
     testProjectWithRoot<MakeBsonObjStage>();
 }
+
+TEST_F(MkObjStageTest, MakeObjProjectAndDropBetweenKeptFields) {
+    testProjectAndDropBetweenKeptFields<MakeObjStage>();
+}
+
+TEST_F(MkObjStageTest, MakeBsonObjProjectAndDropBetweenKeptFields) {
+    testProjectAndDropBetweenKeptFields<MakeBsonObjStage>();
+}
 }  // namespace mongo::sbe
@@ -0,0 +1,508 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+/**
+ * Benchmarks getNext() throughput of individual sbe::PlanStages. Each benchmark feeds a stage from
+ * a virtual scan over generated int64 rows and drains it, varying the number of distinct keys and
+ * the row width. Spilling is disabled, since it needs a storage engine; these numbers are the
+ * in-memory baseline.
+ */
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/optional/optional.hpp>
+
+#include "mongo/db/exec/sbe/expressions/compile_ctx.h"
+#include "mongo/db/exec/sbe/expressions/expression.h"
+#include "mongo/db/exec/sbe/expressions/runtime_environment.h"
+#include "mongo/db/exec/sbe/stages/block_hashagg.h"
+#include "mongo/db/exec/sbe/stages/hash_agg.h"
+#include "mongo/db/exec/sbe/stages/hash_join.h"
+#include "mongo/db/exec/sbe/stages/hash_lookup.h"
+#include "mongo/db/exec/sbe/stages/makeobj.h"
+#include "mongo/db/exec/sbe/stages/sort.h"
+#include "mongo/db/exec/sbe/stages/stages.h"
+#include "mongo/db/exec/sbe/stages/unwind.h"
+#include "mongo/db/exec/sbe/values/block_interface.h"
+#include "mongo/db/exec/sbe/values/slot.h"
+#include "mongo/db/exec/sbe/values/value.h"
+#include "mongo/db/query/query_test_service_context.h"
+#include "mongo/db/query/sbe_stage_builder_helpers.h"
+#include "mongo/platform/random.h"
+#include "mongo/util/id_generator.h"
+
+namespace mongo::sbe {
+namespace {
+
+constexpr size_t kMemoryLimit = 100 * 1024 * 1024;
+constexpr size_t kBlockSize = 128;
+
+using StageTree = std::pair<value::SlotVector, std::unique_ptr<PlanStage>>;
+
+/**
+ * A minimal benchmark counterpart of PlanStageTestFixture: owns an OperationContext and a slot id
+ * generator, builds virtual scans over pre-generated rows, and drains a stage tree once per
+ * benchmark iteration. Building and preparing the tree is excluded from the timings.
+ */
+class PlanStageBenchmark {
+public:
+    PlanStageBenchmark() : _opCtx(_serviceContext.makeOperationContext()) {}
+
+    ~PlanStageBenchmark() {
+        for (auto& [tag, val] : _inputs) {
+            value::releaseValue(tag, val);
+        }
+    }
+
+    value::SlotId generateSlotId() {
+        return _slotIdGenerator.generate();
+    }
+
+    /**
+     * Generates 'numRows' rows of 'width' int64 columns. Column 0 is a key drawn from
+     * [0, 'cardinality'); the other columns are arbitrary payload. Returns an id to pass to scan().
+     */
+    size_t makeRows(size_t numRows, size_t width, size_t cardinality) {
+        return _addInput(numRows, [&](value::Array* row, size_t) {
+            row->push_back(value::TypeTags::NumberInt64,
+                           value::bitcastFrom<int64_t>(_random.nextInt64(cardinality)));
+            for (size_t col = 1; col < width; ++col) {
+                row->push_back(value::TypeTags::NumberInt64,
+                               value::bitcastFrom<int64_t>(_random.nextInt64()));
+            }
+        });
+    }
+
+    /**
+     * Generates one row per key in [0, 'cardinality'), each with 'width' int64 columns.
+     */
+    size_t makeKeyRows(size_t cardinality, size_t width) {
+        return _addInput(cardinality, [&](value::Array* row, size_t key) {
+            row->push_back(value::TypeTags::NumberInt64, value::bitcastFrom<int64_t>(key));
+            for (size_t col = 1; col < width; ++col) {
+                row->push_back(value::TypeTags::NumberInt64,
+                               value::bitcastFrom<int64_t>(_random.nextInt64()));
+            }
+        });
+    }
+
+    /**
+     * Generates 'numRows' rows with a single column holding an array of 'arrayLength' int64s.
+     */
+    size_t makeArrayRows(size_t numRows, size_t arrayLength) {
+        return _addInput(numRows, [&](value::Array* row, size_t) {
+            auto [arrTag, arrVal] = value::makeNewArray();
+            auto arr = value::getArrayView(arrVal);
+            arr->reserve(arrayLength);
+            for (size_t i = 0; i < arrayLength; ++i) {
+                arr->push_back(value::TypeTags::NumberInt64,
+                               value::bitcastFrom<int64_t>(_random.nextInt64()));
+            }
+            row->push_back(arrTag, arrVal);
+        });
+    }
+
+    /**
+     * Generates the block equivalent of makeRows(): each scanned row holds a block of kBlockSize
+     * keys, an all-true bitset block, and 'width' - 1 blocks of payload.
+     */
+    size_t makeBlockRows(size_t numRows, size_t width, size_t cardinality) {
+        return _addInput(numRows / kBlockSize, [&](value::Array* row, size_t) {
+            auto keys = std::make_unique<value::HeterogeneousBlock>();
+            for (size_t i = 0; i < kBlockSize; ++i) {
+                keys->push_back(value::TypeTags::NumberInt64,
+                                value::bitcastFrom<int64_t>(_random.nextInt64(cardinality)));
+            }
+            row->push_back(value::TypeTags::valueBlock,
+                           value::bitcastFrom<value::ValueBlock*>(keys.release()));
+
+            auto bitset = std::make_unique<value::BoolBlock>(std::vector<bool>(kBlockSize, true));
+            row->push_back(value::TypeTags::valueBlock,
+                           value::bitcastFrom<value::ValueBlock*>(bitset.release()));
+
+            for (size_t col = 1; col < width; ++col) {
+                auto data = std::make_unique<value::HeterogeneousBlock>();
+                for (size_t i = 0; i < kBlockSize; ++i) {
+                    data->push_back(value::TypeTags::NumberInt64,
+                                    value::bitcastFrom<int64_t>(_random.nextInt64(1000)));
+                }
+                row->push_back(value::TypeTags::valueBlock,
+                               value::bitcastFrom<value::ValueBlock*>(data.release()));
+            }
+        });
+    }
+
+    /**
+     * Returns a virtual scan over a copy of the rows generated as 'inputId', with one output slot
+     * per column.
+     */
+    StageTree scan(size_t inputId, size_t numColumns) {
+        auto [tag, val] = value::copyValue(_inputs[inputId].first, _inputs[inputId].second);
+        return stage_builder::generateVirtualScanMulti(&_slotIdGenerator, numColumns, tag, val);
+    }
+
+    /**
+     * Drains the tree returned by 'makeTree' once per iteration, reading every output slot, and
+     * reports 'numInputRows' items processed per iteration.
+     */
+    void run(benchmark::State& state,
+             const std::function<StageTree()>& makeTree,
+             size_t numInputRows) {
+        for (auto keepRunning : state) {
+            state.PauseTiming();
+            auto [outSlots, root] = makeTree();
+            CompileCtx ctx{std::make_unique<RuntimeEnvironment>()};
+            root->prepare(ctx);
+            std::vector<value::SlotAccessor*> accessors;
+            for (auto slot : outSlots) {
+                accessors.push_back(root->getAccessor(ctx, slot));
+            }
+            root->attachToOperationContext(_opCtx.get());
+            state.ResumeTiming();
+
+            root->open(false);
+            while (root->getNext() == PlanState::ADVANCED) {
+                for (auto accessor : accessors) {
+                    benchmark::DoNotOptimize(accessor->getViewOfValue());
+                }
+            }
+            root->close();
+
+            state.PauseTiming();
+            root.reset();
+            state.ResumeTiming();
+        }
+        state.SetItemsProcessed(state.iterations() * numInputRows);
+    }
+
+private:
+    template <typename FillRow>
+    size_t _addInput(size_t numRows, FillRow fillRow) {
+        auto [tag, val] = value::makeNewArray();
+        auto rows = value::getArrayView(val);
+        rows->reserve(numRows);
+        for (size_t i = 0; i < numRows; ++i) {
+            auto [rowTag, rowVal] = value::makeNewArray();
+            fillRow(value::getArrayView(rowVal), i);
+            rows->push_back(rowTag, rowVal);
+        }
+        _inputs.emplace_back(tag, val);
+        return _inputs.size() - 1;
+    }
+
+    QueryTestServiceContext _serviceContext;
+    ServiceContext::UniqueOperationContext _opCtx;
+    value::SlotIdGenerator _slotIdGenerator;
+    PseudoRandom _random{1};
+    std::vector<std::pair<value::TypeTags, value::Value>> _inputs;
+};
+
+/**
+ * $group on column 0 with a $sum over each payload column. Arguments: rows, distinct keys, width.
+ */
+void BM_HashAgg(benchmark::State& state) {
+    const size_t numRows = state.range(0);
+    const size_t cardinality = state.range(1);
+    const size_t width = state.range(2);
+
+    PlanStageBenchmark bm;
+    auto input = bm.makeRows(numRows, width, cardinality);
+    bm.run(
+        state,
+        [&] {
+            auto [scanSlots, scanStage] = bm.scan(input, width);
+            value::SlotVector outSlots{scanSlots[0]};
+            AggExprVector aggs;
+            SlotExprPairVector mergingExprs;
+            for (size_t col = 1; col < width; ++col) {
+                auto outSlot = bm.generateSlotId();
+                aggs.emplace_back(
+                    outSlot,
+                    AggExprPair{nullptr,
+                                stage_builder::makeFunction(
+                                    "sum", makeE<EVariable>(scanSlots[col]))});
+                outSlots.push_back(outSlot);
+
+                auto spillSlot = bm.generateSlotId();
+                mergingExprs.emplace_back(
+                    spillSlot,
+                    stage_builder::makeFunction("sum", makeE<EVariable>(spillSlot)));
+            }
+            auto stage = makeS<HashAggStage>(std::move(scanStage),
+                                             makeSV(scanSlots[0]),
+                                             std::move(aggs),
+                                             makeSV(),
+                                             true /* optimizedClose */,
+                                             boost::none /* collatorSlot */,
+                                             false /* allowDiskUse */,
+                                             std::move(mergingExprs),
+                                             nullptr /* yieldPolicy */,
+                                             kEmptyPlanNodeId);
+            return StageTree{std::move(outSlots), std::move(stage)};
+        },
+        numRows);
+}
+
+/**
+ * The block-based equivalent of BM_HashAgg, fed kBlockSize rows per scanned block.
+ */
+void BM_BlockHashAgg(benchmark::State& state) {
+    const size_t numRows = state.range(0);
+    const size_t cardinality = state.range(1);
+    const size_t width = state.range(2);
+
+    PlanStageBenchmark bm;
+    auto input = bm.makeBlockRows(numRows, width, cardinality);
+    bm.run(
+        state,
+        [&] {
+            // Scanned columns are: keys, bitset, then width - 1 payload blocks.
+            auto [scanSlots, scanStage] = bm.scan(input, width + 1);
+            auto bitsetSlot = bm.generateSlotId();
+            value::SlotVector outSlots{scanSlots[0]};
+            value::SlotVector dataInSlots;
+            value::SlotVector accDataSlots;
+            AggExprTupleVector aggs;
+            SlotExprPairVector mergingExprs;
+            for (size_t col = 2; col < width + 1; ++col) {
+                dataInSlots.push_back(scanSlots[col]);
+                auto internalSlot = bm.generateSlotId();
+                accDataSlots.push_back(internalSlot);
+
+                auto outSlot = bm.generateSlotId();
+                aggs.emplace_back(
+                    outSlot,
+                    AggExprTuple{nullptr,
+                                 stage_builder::makeFunction("valueBlockAggSum",
+                                                             makeE<EVariable>(bitsetSlot),
+                                                             makeE<EVariable>(internalSlot)),
+                                 stage_builder::makeFunction("sum",
+                                                             makeE<EVariable>(internalSlot))});
+                outSlots.push_back(outSlot);
+
+                auto spillSlot = bm.generateSlotId();
+                mergingExprs.emplace_back(
+                    spillSlot, stage_builder::makeFunction("sum", makeE<EVariable>(spillSlot)));
+            }
+            auto stage = makeS<BlockHashAggStage>(std::move(scanStage),
+                                                  makeSV(scanSlots[0]),
+                                                  scanSlots[1],
+                                                  std::move(dataInSlots),
+                                                  std::move(accDataSlots),
+                                                  bitsetSlot,
+                                                  std::move(aggs),
+                                                  false /* allowDiskUse */,
+                                                  std::move(mergingExprs),
+                                                  nullptr /* yieldPolicy */,
+                                                  kEmptyPlanNodeId);
+            return StageTree{std::move(outSlots), std::move(stage)};
+        },
+        numRows);
+}
+
+/**
+ * Equality join of 'rows' outer rows against one inner row per key, projecting every column of
+ * both sides. Arguments: outer rows, distinct keys (inner rows), width.
+ */
+void BM_HashJoin(benchmark::State& state) {
+    const size_t numRows = state.range(0);
+    const size_t cardinality = state.range(1);
+    const size_t width = state.range(2);
+
+    PlanStageBenchmark bm;
+    auto outerInput = bm.makeRows(numRows, width, cardinality);
+    auto innerInput = bm.makeKeyRows(cardinality, width);
+    bm.run(
+        state,
+        [&] {
+            auto [outerSlots, outerStage] = bm.scan(outerInput, width);
+            auto [innerSlots, innerStage] = bm.scan(innerInput, width);
+            value::SlotVector outerProjects(outerSlots.begin() + 1, outerSlots.end());
+            value::SlotVector innerProjects(innerSlots.begin() + 1, innerSlots.end());
+
+            value::SlotVector outSlots = outerSlots;
+            outSlots.insert(outSlots.end(), innerSlots.begin(), innerSlots.end());
+            auto stage = makeS<HashJoinStage>(std::move(outerStage),
+                                              std::move(innerStage),
+                                              makeSV(outerSlots[0]),
+                                              std::move(outerProjects),
+                                              makeSV(innerSlots[0]),
+                                              std::move(innerProjects),
+                                              boost::none /* collatorSlot */,
+                                              nullptr /* yieldPolicy */,
+                                              kEmptyPlanNodeId);
+            return StageTree{std::move(outSlots), std::move(stage)};
+        },
+        numRows + cardinality);
+}
+
+/**
+ * $lookup-style hash lookup: every outer row collects the matching inner rows' second column into
+ * an array. Arguments: outer rows, distinct keys (inner rows), width.
+ */
+void BM_HashLookup(benchmark::State& state) {
+    const size_t numRows = state.range(0);
+    const size_t cardinality = state.range(1);
+    const size_t width = std::max<size_t>(state.range(2), 2);
+
+    PlanStageBenchmark bm;
+    auto outerInput = bm.makeRows(numRows, width, cardinality);
+    auto innerInput = bm.makeKeyRows(cardinality, width);
+    bm.run(
+        state,
+        [&] {
+            auto [outerSlots, outerStage] = bm.scan(outerInput, width);
+            auto [innerSlots, innerStage] = bm.scan(innerInput, width);
+            auto lookupSlot = bm.generateSlotId();
+            SlotExprPair agg{
+                lookupSlot,
+                stage_builder::makeFunction("addToArray", makeE<EVariable>(innerSlots[1]))};
+
+            value::SlotVector outSlots = outerSlots;
+            outSlots.push_back(lookupSlot);
+            auto stage = makeS<HashLookupStage>(std::move(outerStage),
+                                                std::move(innerStage),
+                                                outerSlots[0],
+                                                innerSlots[0],
+                                                innerSlots[1],
+                                                std::move(agg),
+                                                boost::none /* collatorSlot */,
+                                                kEmptyPlanNodeId);
+            return StageTree{std::move(outSlots), std::move(stage)};
+        },
+        numRows + cardinality);
+}
+
+/**
+ * Full sort on column 0 carrying the remaining columns. Arguments: rows, distinct keys, width.
+ */
+void BM_Sort(benchmark::State& state) {
+    const size_t numRows = state.range(0);
+    const size_t cardinality = state.range(1);
+    const size_t width = state.range(2);
+
+    PlanStageBenchmark bm;
+    auto input = bm.makeRows(numRows, width, cardinality);
+    bm.run(
+        state,
+        [&] {
+            auto [scanSlots, scanStage] = bm.scan(input, width);
+            value::SlotVector vals(scanSlots.begin() + 1, scanSlots.end());
+            auto stage = makeS<SortStage>(std::move(scanStage),
+                                          makeSV(scanSlots[0]),
+                                          std::vector<value::SortDirection>{
+                                              value::SortDirection::Ascending},
+                                          std::move(vals),
+                                          nullptr /* limit */,
+                                          kMemoryLimit,
+                                          false /* allowDiskUse */,
+                                          nullptr /* yieldPolicy */,
+                                          kEmptyPlanNodeId);
+            return StageTree{std::move(scanSlots), std::move(stage)};
+        },
+        numRows);
+}
+
+/**
+ * Unwinds an array column. Arguments: rows, array length.
+ */
+void BM_Unwind(benchmark::State& state) {
+    const size_t numRows = state.range(0);
+    const size_t arrayLength = state.range(1);
+
+    PlanStageBenchmark bm;
+    auto input = bm.makeArrayRows(numRows, arrayLength);
+    bm.run(
+        state,
+        [&] {
+            auto [scanSlots, scanStage] = bm.scan(input, 1);
+            auto outSlot = bm.generateSlotId();
+            auto indexSlot = bm.generateSlotId();
+            auto stage = makeS<UnwindStage>(std::move(scanStage),
+                                            scanSlots[0],
+                                            outSlot,
+                                            indexSlot,
+                                            false /* preserveNullAndEmptyArrays */,
+                                            kEmptyPlanNodeId);
+            return StageTree{makeSV(outSlot, indexSlot), std::move(stage)};
+        },
+        numRows * arrayLength);
+}
+
+/**
+ * Builds a BSON object from every column of the row. Arguments: rows, width.
+ */
+void BM_MakeBsonObj(benchmark::State& state) {
+    const size_t numRows = state.range(0);
+    const size_t width = state.range(1);
+
+    PlanStageBenchmark bm;
+    auto input = bm.makeRows(numRows, width, numRows);
+    std::vector<std::string> fieldNames;
+    for (size_t col = 0; col < width; ++col) {
+        fieldNames.push_back("field" + std::to_string(col));
+    }
+    bm.run(
+        state,
+        [&] {
+            auto [scanSlots, scanStage] = bm.scan(input, width);
+            auto objSlot = bm.generateSlotId();
+            auto stage = makeS<MakeBsonObjStage>(std::move(scanStage),
+                                                 objSlot,
+                                                 boost::none /* rootSlot */,
+                                                 boost::none /* fieldBehavior */,
+                                                 std::vector<std::string>{},
+                                                 fieldNames,
+                                                 std::move(scanSlots),
+                                                 false /* forceNewObject */,
+                                                 false /* returnOldObject */,
+                                                 kEmptyPlanNodeId);
+            return StageTree{makeSV(objSlot), std::move(stage)};
+        },
+        numRows);
+}
+
+BENCHMARK(BM_HashAgg)->ArgsProduct({{1 << 17}, {16, 1 << 12, 1 << 17}, {2, 8}});
+BENCHMARK(BM_BlockHashAgg)->ArgsProduct({{1 << 17}, {16, 1 << 12, 1 << 17}, {2, 8}});
+BENCHMARK(BM_HashJoin)->ArgsProduct({{1 << 17}, {16, 1 << 12, 1 << 17}, {2, 8}});
+BENCHMARK(BM_HashLookup)->ArgsProduct({{1 << 17}, {16, 1 << 12, 1 << 17}, {2, 8}});
+BENCHMARK(BM_Sort)->ArgsProduct({{1 << 17}, {16, 1 << 17}, {2, 8}});
+BENCHMARK(BM_Unwind)->ArgsProduct({{1 << 14}, {1, 8, 64}});
+BENCHMARK(BM_MakeBsonObj)->ArgsProduct({{1 << 17}, {2, 8, 32}});
+
+}  // namespace
+}  // namespace mongo::sbe
@@ -426,6 +426,47 @@ TEST(SBEVM, CompareBinData) {
     }
 }
 
+TEST(SBEVM, GetFieldFillEmpty) {
+    auto obj = BSON("a" << 42);
+    auto objTag = value::TypeTags::bsonObject;
+    auto objVal = value::bitcastFrom<const char*>(obj.objdata());
+    {
+        vm::CodeFragment code;
+        code.appendConstVal(objTag, objVal);
+        code.appendGetFieldFillEmpty({}, "a"_sd, vm::Instruction::Null);
+
+        vm::ByteCode interpreter;
+        auto [owned, tag, val] = interpreter.run(&code);
+
+        ASSERT_EQ(tag, value::TypeTags::NumberInt32);
+        ASSERT_EQ(value::bitcastTo<int32_t>(val), 42);
+        ASSERT_FALSE(owned);
+    }
+    {
+        vm::CodeFragment code;
+        code.appendConstVal(objTag, objVal);
+        code.appendGetFieldFillEmpty({}, "b"_sd, vm::Instruction::False);
+
+        vm::ByteCode interpreter;
+        auto [owned, tag, val] = interpreter.run(&code);
+
+        ASSERT_EQ(tag, value::TypeTags::Boolean);
+        ASSERT_FALSE(value::bitcastTo<bool>(val));
+        ASSERT_FALSE(owned);
+    }
+    {
+        vm::CodeFragment code;
+        code.appendConstVal(value::TypeTags::Nothing, 0);
+        code.appendGetFieldFillEmpty({}, "a"_sd, vm::Instruction::Null);
+
+        vm::ByteCode interpreter;
+        auto [owned, tag, val] = interpreter.run(&code);
+
+        ASSERT_EQ(tag, value::TypeTags::Null);
+        ASSERT_FALSE(owned);
+    }
+}
+
 TEST(SBEVM, ConvertBinDataToBsonObj) {
     uint8_t byteArray[] = {1, 2, 3, 4, 5, 6, 7, 8};
     auto originalBinData =
@@ -658,7 +658,10 @@ void BlockHashAggStage::open(bool reOpen) {
     _children[0]->open(reOpen);
     _commonStats.opens++;
 
-    _ht.emplace();
+    _ht.emplace(0,
+                value::MaterializedRowHasher(),
+                value::MaterializedRowEq(),
+                TableAllocator(_htMemoryStats));
 
     for (auto& aggAccessor : _rowAggAccessors) {
         aggAccessor->setIndex(0);
@@ -721,8 +724,11 @@ void BlockHashAggStage::open(bool reOpen) {
             } else {
                 // Estimates how much memory is being used. If we estimate that the hash table
                 // exceeds the allotted memory budget, its contents are spilled to the
-                // '_recordStore' and '_ht' is cleared.
-                checkMemoryUsageAndSpillIfNecessary(memoryCheckData);
+                // '_recordStore' and '_ht' is cleared. Every row of the block counts as an
+                // advance, so that high-cardinality blocks are checked as often as the row-based
+                // HashAggStage would check them.
+                checkMemoryUsageAndSpillIfNecessary(memoryCheckData,
+                                                    static_cast<int64_t>(_currentBlockSize));
             }
         }
 
@@ -744,10 +750,11 @@ void BlockHashAggStage::open(bool reOpen) {
             spill(memoryCheckData);
         }
 
-        _specificStats.spilledDataStorageSize = _recordStore->rs()->storageSize(_opCtx);
-
         // Establish a cursor, positioned at the beginning of the record store.
         _rsCursor = _recordStore->getCursor(_opCtx);
+
+        // Sorted file stores only write out their last run once the cursor is established.
+        _specificStats.spilledDataStorageSize = _recordStore->storageSize(_opCtx);
     }
 
     _accumulatorBitsetAccessor.reset(false, value::TypeTags::Nothing, 0);
@@ -962,6 +969,7 @@ std::unique_ptr<PlanStageStats> BlockHashAggStage::getStats(bool includeDebugInf
         bob.appendNumber("spills", _specificStats.spills);
         bob.appendNumber("spilledRecords", _specificStats.spilledRecords);
         bob.appendNumber("spilledDataStorageSize", _specificStats.spilledDataStorageSize);
+        bob.appendNumber("peakTrackedMemBytes", _specificStats.peakTrackedMemBytes);
 
         // Block-specific stats.
         bob.appendNumber("blockAccumulations", _specificStats.blockAccumulations);
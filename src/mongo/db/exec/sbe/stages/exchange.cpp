@@ -30,6 +30,7 @@
 // IWYU pragma: no_include "cxxabi.h"
 // IWYU pragma: no_include "ext/alloc_traits.h"
 #include <absl/container/inlined_vector.h>
+#include <algorithm>
 #include <boost/move/utility_core.hpp>
 #include <boost/smart_ptr.hpp>
 #include <functional>
@@ -44,8 +45,10 @@
 #include "mongo/db/concurrency/lock_manager_defs.h"
 #include "mongo/db/exec/sbe/size_estimator.h"
 #include "mongo/db/exec/sbe/stages/exchange.h"
+#include "mongo/db/service_context.h"
 #include "mongo/util/concurrency/thread_pool.h"
 #include "mongo/util/future_impl.h"
+#include "mongo/util/scopeguard.h"
 
 namespace mongo::sbe {
 std::unique_ptr<ThreadPool> s_globalThreadPool;
@@ -97,10 +100,17 @@ std::unique_ptr<ExchangeBuffer> ExchangePipe::getEmptyBuffer() {
     return std::move(_emptyBuffers[_emptyCount]);
 }
 
-std::unique_ptr<ExchangeBuffer> ExchangePipe::getFullBuffer() {
+std::unique_ptr<ExchangeBuffer> ExchangePipe::getFullBuffer(OperationContext* opCtx) {
     stdx::unique_lock lock(_mutex);
 
-    _cond.wait(lock, [this]() { return _closed || _fullCount != _fullPosition; });
+    auto pred = [this]() {
+        return _closed || _fullCount != _fullPosition;
+    };
+    if (opCtx) {
+        opCtx->waitForConditionOrInterrupt(_cond, lock, pred);
+    } else {
+        _cond.wait(lock, pred);
+    }
 
     if (_closed) {
         return nullptr;
@@ -147,6 +157,41 @@ ExchangePipe* ExchangeState::pipe(size_t consumerTid, size_t producerTid) {
     return _consumers[consumerTid]->pipe(producerTid);
 }
 
+void ExchangeState::addProducerOpCtx(OperationContext* opCtx) {
+    stdx::lock_guard lock(_producerOpCtxsMutex);
+    _producerOpCtxs.push_back(opCtx);
+
+    if (_producerInterruptCode != ErrorCodes::OK) {
+        stdx::lock_guard<Client> clientLock(*opCtx->getClient());
+        opCtx->getServiceContext()->killOperation(clientLock, opCtx, _producerInterruptCode);
+    }
+}
+
+void ExchangeState::removeProducerOpCtx(OperationContext* opCtx) {
+    stdx::lock_guard lock(_producerOpCtxsMutex);
+    _producerOpCtxs.erase(std::find(_producerOpCtxs.begin(), _producerOpCtxs.end(), opCtx));
+}
+
+void ExchangeState::interruptProducers(ErrorCodes::Error code) {
+    invariant(code != ErrorCodes::OK);
+
+    stdx::lock_guard lock(_producerOpCtxsMutex);
+    if (_producerInterruptCode != ErrorCodes::OK) {
+        return;
+    }
+    _producerInterruptCode = code;
+
+    for (auto opCtx : _producerOpCtxs) {
+        stdx::lock_guard<Client> clientLock(*opCtx->getClient());
+        opCtx->getServiceContext()->killOperation(clientLock, opCtx, code);
+    }
+}
+
+ErrorCodes::Error ExchangeState::producerInterruptCode() const {
+    stdx::lock_guard lock(_producerOpCtxsMutex);
+    return _producerInterruptCode;
+}
+
 size_t ExchangeState::estimateCompileTimeSize() const {
     size_t size = sizeof(*this);
     size += size_estimator::estimate(_fields);
@@ -162,7 +207,9 @@ ExchangeBuffer* ExchangeConsumer::getBuffer(size_t producerId) {
         return _fullBuffers[producerId].get();
     }
 
-    _fullBuffers[producerId] = _pipes[producerId]->getFullBuffer();
+    // Wait interruptibly, so that killing the operation or hitting its deadline is noticed while
+    // the producers are busy.
+    _fullBuffers[producerId] = _pipes[producerId]->getFullBuffer(_opCtx);
 
     return _fullBuffers[producerId].get();
 }
@@ -301,6 +348,8 @@ void ExchangeConsumer::open(bool reOpen) {
                         invariant(status);
 
                         auto opCtx = cc().makeOperationContext();
+                        _state->addProducerOpCtx(opCtx.get());
+                        ON_BLOCK_EXIT([&] { _state->removeProducerOpCtx(opCtx.get()); });
 
                         promise.setWith([&] {
                             ExchangeProducer::start(opCtx.get(),
@@ -336,6 +385,18 @@ void ExchangeConsumer::open(bool reOpen) {
 PlanState ExchangeConsumer::getNext() {
     auto optTimer(getOptTimer(_opCtx));
 
+    try {
+        checkForInterruptAndYield(_opCtx);
+        return getNextImpl();
+    } catch (const DBException& ex) {
+        // Producers run on their own operation contexts, so they have to be told that this
+        // operation has been interrupted.
+        _state->interruptProducers(ex.code());
+        throw;
+    }
+}
+
+PlanState ExchangeConsumer::getNextImpl() {
     if (_orderPreserving) {
         // Build a heap and return min element.
         uasserted(4822834, "ordere exchange not yet implemented");
@@ -376,6 +437,13 @@ void ExchangeConsumer::close() {
         stdx::unique_lock lock(_state->consumerCloseMutex());
         ++_state->consumerClose();
 
+        // Producers that have not finished yet may still be reading their input without producing
+        // anything. Closing the pipes alone would not stop them until they hand over the next
+        // buffer.
+        if (_tid == 0 && _eofs < _state->numOfProducers()) {
+            _state->interruptProducers(ErrorCodes::Interrupted);
+        }
+
         // Signal early out.
         for (auto& p : _pipes) {
             p->close();
@@ -398,12 +466,16 @@ void ExchangeConsumer::close() {
                 lock, [this]() { return _state->consumerClose() == _state->numOfConsumers(); });
         }
     }
-    // Rethrow the first stored exception from producers.
-    // We can do it outside of the lock as everybody else is gone by now.
+    // Rethrow the first stored exception from producers, other than the interruption caused by
+    // the consumers. We can do it outside of the lock as everybody else is gone by now.
     if (_tid == 0) {
         // Consumer ID 0
+        const auto interruptCode = _state->producerInterruptCode();
         for (size_t idx = 0; idx < _state->numOfProducers(); ++idx) {
-            _state->producerResults()[idx].get();
+            auto status = _state->producerResults()[idx].getNoThrow();
+            if (!status.isOK() && status.code() != interruptCode) {
+                uassertStatusOK(status);
+            }
         }
     }
 }
@@ -535,6 +607,13 @@ void ExchangeProducer::start(OperationContext* opCtx,
 
     p->attachToOperationContext(opCtx);
 
+    // Producers yield on their own operation contexts, independently of the consumers.
+    std::unique_ptr<PlanYieldPolicy> yieldPolicy;
+    if (const auto& makeYieldPolicy = p->_state->producerYieldPolicyFactory()) {
+        yieldPolicy = makeYieldPolicy(opCtx, p);
+        p->attachNewYieldPolicy(yieldPolicy.get());
+    }
+
     try {
         p->prepare(ctx);
         p->open(false);
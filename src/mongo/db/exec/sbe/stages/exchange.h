@@ -31,10 +31,12 @@
 
 #include <boost/move/utility_core.hpp>
 #include <cstddef>
+#include <functional>
 #include <memory>
 #include <utility>
 #include <vector>
 
+#include "mongo/base/error_codes.h"
 #include "mongo/db/exec/plan_stats.h"
 #include "mongo/db/exec/sbe/expressions/compile_ctx.h"
 #include "mongo/db/exec/sbe/expressions/expression.h"
@@ -45,6 +47,7 @@
 #include "mongo/db/exec/sbe/values/value.h"
 #include "mongo/db/exec/sbe/vm/vm.h"
 #include "mongo/db/operation_context.h"
+#include "mongo/db/query/plan_yield_policy.h"
 #include "mongo/db/query/stage_types.h"
 #include "mongo/platform/mutex.h"
 #include "mongo/stdx/condition_variable.h"
@@ -59,6 +62,13 @@ class ExchangeProducer;
 
 enum class ExchangePolicy { broadcast, roundrobin, hashpartition, rangepartition };
 
+/**
+ * Makes the yield policy a producer uses on its own operation context. The producer's plan must be
+ * registered with the returned policy.
+ */
+using ExchangeProducerYieldPolicyFactory =
+    std::function<std::unique_ptr<PlanYieldPolicy>(OperationContext* opCtx, PlanStage* producer)>;
+
 // A unit of exchange between a consumer and a producer
 class ExchangeBuffer {
 public:
@@ -138,7 +148,11 @@ public:
 
     void close();
     std::unique_ptr<ExchangeBuffer> getEmptyBuffer();
-    std::unique_ptr<ExchangeBuffer> getFullBuffer();
+    /**
+     * Waits for a full buffer. If 'opCtx' is given, the wait is interruptible and throws if the
+     * operation is killed or exceeds its deadline.
+     */
+    std::unique_ptr<ExchangeBuffer> getFullBuffer(OperationContext* opCtx = nullptr);
     void putEmptyBuffer(std::unique_ptr<ExchangeBuffer>);
     void putFullBuffer(std::unique_ptr<ExchangeBuffer>);
 
@@ -237,6 +251,32 @@ public:
 
     ExchangePipe* pipe(size_t consumerTid, size_t producerTid);
 
+    void setProducerYieldPolicyFactory(ExchangeProducerYieldPolicyFactory factory) {
+        _producerYieldPolicyFactory = std::move(factory);
+    }
+    const ExchangeProducerYieldPolicyFactory& producerYieldPolicyFactory() const {
+        return _producerYieldPolicyFactory;
+    }
+
+    /**
+     * Producers run on their own operation contexts, which they register here for the duration of
+     * their execution so that the consumers can interrupt them.
+     */
+    void addProducerOpCtx(OperationContext* opCtx);
+    void removeProducerOpCtx(OperationContext* opCtx);
+
+    /**
+     * Kills the operations of all running producers, and of producers that start afterwards, with
+     * 'code'. Producers stop at their next interrupt check, even if they never hand a buffer to a
+     * consumer. Only the first call takes effect.
+     */
+    void interruptProducers(ErrorCodes::Error code);
+
+    /**
+     * Returns the code the producers were interrupted with by interruptProducers(), or OK.
+     */
+    ErrorCodes::Error producerInterruptCode() const;
+
     size_t estimateCompileTimeSize() const;
 
 private:
@@ -266,6 +306,13 @@ private:
     mongo::Mutex _consumerCloseMutex;
     stdx::condition_variable _consumerCloseCond;
     size_t _consumerClose{0};
+
+    ExchangeProducerYieldPolicyFactory _producerYieldPolicyFactory;
+
+    mutable mongo::Mutex _producerOpCtxsMutex =
+        MONGO_MAKE_LATCH("ExchangeState::_producerOpCtxsMutex");
+    std::vector<OperationContext*> _producerOpCtxs;
+    ErrorCodes::Error _producerInterruptCode{ErrorCodes::OK};
 };
 
 class ExchangeConsumer final : public PlanStage {
@@ -285,6 +332,14 @@ public:
 
     std::unique_ptr<PlanStage> clone() const final;
 
+    /**
+     * Sets the factory for the yield policies used by the producers. Without one, producers never
+     * yield, but they are still interrupted when a consumer is.
+     */
+    void setProducerYieldPolicyFactory(ExchangeProducerYieldPolicyFactory factory) {
+        _state->setProducerYieldPolicyFactory(std::move(factory));
+    }
+
     void prepare(CompileCtx& ctx) final;
     value::SlotAccessor* getAccessor(CompileCtx& ctx, value::SlotId slot) final;
     void open(bool reOpen) final;
@@ -299,6 +354,7 @@ public:
     size_t estimateCompileTimeSize() const final;
 
 private:
+    PlanState getNextImpl();
     ExchangeBuffer* getBuffer(size_t producerId);
     void putBuffer(size_t producerId);
 
@@ -276,9 +276,12 @@ void HashAggStage::open(bool reOpen) {
             auto collatorView = value::getCollatorView(collatorVal);
             const value::MaterializedRowHasher hasher(collatorView);
             _keyEq = value::MaterializedRowEq(collatorView);
-            _ht.emplace(0, hasher, _keyEq);
+            _ht.emplace(0, hasher, _keyEq, TableAllocator(_htMemoryStats));
         } else {
-            _ht.emplace();
+            _ht.emplace(0,
+                        value::MaterializedRowHasher(),
+                        value::MaterializedRowEq(),
+                        TableAllocator(_htMemoryStats));
         }
 
         _seekKeys.resize(_seekKeysAccessors.size());
@@ -380,11 +383,12 @@ void HashAggStage::open(bool reOpen) {
                 spill(memoryCheckData);
             }
 
-            _specificStats.spilledDataStorageSize = _recordStore->rs()->storageSize(_opCtx);
-
             // Establish a cursor, positioned at the beginning of the record store.
             _rsCursor = _recordStore->getCursor(_opCtx);
 
+            // Sorted file stores only write out their last run once the cursor is established.
+            _specificStats.spilledDataStorageSize = _recordStore->storageSize(_opCtx);
+
             // Callers will be obtaining the results from the spill table, so set the
             // 'SwitchAccessors' so that they refer to the rows recovered from the record store
             // under the hood.
@@ -548,6 +552,7 @@ std::unique_ptr<PlanStageStats> HashAggStage::getStats(bool includeDebugInfo) co
         bob.appendNumber("spills", _specificStats.spills);
         bob.appendNumber("spilledRecords", _specificStats.spilledRecords);
         bob.appendNumber("spilledDataStorageSize", _specificStats.spilledDataStorageSize);
+        bob.appendNumber("peakTrackedMemBytes", _specificStats.peakTrackedMemBytes);
 
         ret->debugInfo = bob.obj();
     }
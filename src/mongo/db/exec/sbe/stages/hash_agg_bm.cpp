@@ -0,0 +1,106 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include <absl/container/flat_hash_map.h>
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "mongo/db/exec/sbe/values/row.h"
+#include "mongo/db/exec/sbe/values/value.h"
+#include "mongo/platform/random.h"
+#include "mongo/stdx/unordered_map.h"
+
+namespace mongo::sbe {
+namespace {
+
+// The table layout used by HashAggStage and BlockHashAggStage.
+using FlatTable = absl::flat_hash_map<value::MaterializedRow,
+                                      value::MaterializedRow,
+                                      value::MaterializedRowHasher,
+                                      value::MaterializedRowEq>;
+
+// The node-based table the stages used previously, kept here for comparison.
+using NodeTable = stdx::unordered_map<value::MaterializedRow,
+                                      value::MaterializedRow,
+                                      value::MaterializedRowHasher,
+                                      value::MaterializedRowEq>;
+
+/**
+ * Mimics the build phase of a $group with a single int64 key and a single accumulator: look up the
+ * key of every input row, insert it if it is new, then bump the accumulator in place. The first
+ * benchmark argument is the number of input rows and the second is the number of distinct keys.
+ */
+template <typename Table>
+void BM_GroupByInt64(benchmark::State& state) {
+    const size_t numRows = state.range(0);
+    const size_t numKeys = state.range(1);
+
+    PseudoRandom random(1);
+    std::vector<int64_t> inputs(numRows);
+    for (auto& input : inputs) {
+        input = random.nextInt64(numKeys);
+    }
+
+    for (auto keepRunning : state) {
+        Table table;
+        value::MaterializedRow key{1};
+        for (auto input : inputs) {
+            key.reset(0, false, value::TypeTags::NumberInt64, value::bitcastFrom<int64_t>(input));
+            auto it = table.find(key);
+            if (it == table.end()) {
+                value::MaterializedRow keyCopy(key);
+                keyCopy.makeOwned();
+                it = table.emplace(std::move(keyCopy), value::MaterializedRow{1}).first;
+                it->second.reset(
+                    0, false, value::TypeTags::NumberInt64, value::bitcastFrom<int64_t>(0));
+            }
+            auto [tag, val] = it->second.getViewOfValue(0);
+            it->second.reset(0,
+                             false,
+                             value::TypeTags::NumberInt64,
+                             value::bitcastFrom<int64_t>(value::bitcastTo<int64_t>(val) + 1));
+        }
+        benchmark::DoNotOptimize(table.size());
+    }
+    state.SetItemsProcessed(state.iterations() * numRows);
+}
+
+BENCHMARK_TEMPLATE(BM_GroupByInt64, FlatTable)
+    ->Args({1 << 20, 16})
+    ->Args({1 << 20, 1 << 14})
+    ->Args({1 << 20, 1 << 20});
+BENCHMARK_TEMPLATE(BM_GroupByInt64, NodeTable)
+    ->Args({1 << 20, 16})
+    ->Args({1 << 20, 1 << 14})
+    ->Args({1 << 20, 1 << 20});
+
+}  // namespace
+}  // namespace mongo::sbe
@@ -190,6 +190,12 @@ PlanState HashJoinStage::getNext() {
     }
 
     if (_htIt == _htItEnd) {
+        // No probe row can match an empty build side, so don't pull the probe side at all. This
+        // avoids scanning a possibly large inner child when the outer side is filtered to nothing.
+        if (_ht->empty()) {
+            return trackPlanState(PlanState::IS_EOF);
+        }
+
         while (_htIt == _htItEnd) {
             auto state = _children[1]->getNext();
             if (state == PlanState::IS_EOF) {
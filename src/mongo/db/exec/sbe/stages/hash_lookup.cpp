@@ -41,6 +41,7 @@
 #include "mongo/db/exec/sbe/expressions/expression.h"
 #include "mongo/db/exec/sbe/size_estimator.h"
 #include "mongo/db/exec/sbe/stages/stage_visitors.h"
+#include "mongo/db/query/query_knobs_gen.h"
 
 namespace mongo::sbe {
 
@@ -144,7 +145,23 @@ value::SlotAccessor* HashLookupStage::getAccessor(CompileCtx& ctx, value::SlotId
         if (slot == _lookupStageOutputSlot) {
             return &_lookupStageOutputAccessor;
         }
-        return outerChild()->getAccessor(ctx, slot);
+
+        // Outer slots are read from the outer child directly, or from '_outerBatch' while probing
+        // a spilled hash table in batches, which is only known once the stage is opened.
+        auto it = _outOuterAccessors.find(slot);
+        if (it == _outOuterAccessors.end()) {
+            auto childAccessor = outerChild()->getAccessor(ctx, slot);
+            _outOuterBatchAccessors.emplace_back(
+                _outerBatch, _outerBatchPos, _inOuterAccessors.size());
+            _inOuterAccessors.push_back(childAccessor);
+            it = _outOuterAccessors
+                     .emplace(slot,
+                              value::SwitchAccessor{
+                                  {childAccessor, &_outOuterBatchAccessors.back()}})
+                     .first;
+            it->second.setIndex(_outerBatchSize > 0 ? 1 : 0);
+        }
+        return &it->second;
     }
 }
 
@@ -167,6 +184,12 @@ void HashLookupStage::doRestoreState(bool relinquishCursor) {
 void HashLookupStage::reset(bool fromClose) {
     // Also resets the memory threshold if the knob changes between re-open calls.
     _hashTable.reset(fromClose);
+
+    _outerBatch.clear();
+    if (fromClose) {
+        _outerBatch.shrink_to_fit();
+    }
+    _outerBatchPos = 0;
 }
 
 void HashLookupStage::open(bool reOpen) {
@@ -206,6 +229,14 @@ void HashLookupStage::open(bool reOpen) {
     }
     innerChild()->close();
     outerChild()->open(reOpen);
+
+    // Probe in batches only if there is something on disk to read.
+    _outerBatchSize = _hashTable.hasSpilled()
+        ? static_cast<size_t>(internalQuerySBELookupSpilledProbeBatchSize.load())
+        : 0;
+    for (auto& [_, accessor] : _outOuterAccessors) {
+        accessor.setIndex(_outerBatchSize > 0 ? 1 : 0);
+    }
 }  // HashLookupStage::open
 
 template <typename Container>
@@ -221,9 +252,65 @@ void HashLookupStage::accumulateFromValueIndices(const Container* bufferIndices)
     }
 }  // HashLookupStage::accumulateFromValueIndices
 
+void HashLookupStage::fillOuterBatch() {
+    _outerBatch.clear();
+    _outerBatchPos = 0;
+
+    // Columns of each buffered row: the requested outer slots, then the outer key, then the result.
+    const size_t keyColumn = _inOuterAccessors.size();
+    const size_t resultColumn = keyColumn + 1;
+
+    std::vector<std::pair<value::TypeTags, value::Value>> probeKeys;
+    while (_outerBatch.size() < _outerBatchSize &&
+           outerChild()->getNext() == PlanState::ADVANCED) {
+        auto& row = _outerBatch.emplace_back(resultColumn + 1);
+        for (size_t idx = 0; idx < keyColumn; ++idx) {
+            auto [tag, val] = _inOuterAccessors[idx]->getCopyOfValue();
+            row.reset(idx, true, tag, val);
+        }
+        auto [tagKey, valKey] = _inOuterMatchAccessor->getCopyOfValue();
+        row.reset(keyColumn, true, tagKey, valKey);
+        probeKeys.emplace_back(tagKey, valKey);
+    }
+
+    // Read everything the batch needs from disk at once, then compute each row's result.
+    _hashTable.prefetchSpilled(probeKeys);
+    for (auto& row : _outerBatch) {
+        _lookupStageOutput.reset(0, false, value::TypeTags::Nothing, 0);
+        auto [tagKey, valKey] = row.getViewOfValue(keyColumn);
+        _hashTable.htIter.reset(tagKey, valKey);
+        accumulateFromValueIndicesVariant(_hashTable.htIter.getAllMatchingIndices());
+
+        auto [tag, val] = _lookupStageOutputAccessor.copyOrMoveValue();
+        row.reset(resultColumn, true, tag, val);
+    }
+    _hashTable.htIter.clear();
+    _hashTable.clearPrefetched();
+}  // HashLookupStage::fillOuterBatch
+
+PlanState HashLookupStage::getNextFromOuterBatch() {
+    if (_outerBatchPos + 1 < _outerBatch.size()) {
+        ++_outerBatchPos;
+    } else {
+        fillOuterBatch();
+        if (_outerBatch.empty()) {
+            return PlanState::IS_EOF;
+        }
+    }
+
+    const size_t resultColumn = _inOuterAccessors.size() + 1;
+    auto [tag, val] = _outerBatch[_outerBatchPos].copyOrMoveValue(resultColumn);
+    _lookupStageOutput.reset(0, true, tag, val);
+    return PlanState::ADVANCED;
+}  // HashLookupStage::getNextFromOuterBatch
+
 PlanState HashLookupStage::getNext() {
     auto optTimer(getOptTimer(_opCtx));
 
+    if (_outerBatchSize > 0) {
+        return trackPlanState(getNextFromOuterBatch());
+    }
+
     PlanState state = outerChild()->getNext();
     if (state == PlanState::ADVANCED) {
         // We just got this outer doc, so reset the $lookup "as" result array accumulator to nothing
@@ -31,6 +31,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <deque>
 #include <memory>
 #include <tuple>
 #include <unordered_map>
@@ -47,6 +48,7 @@
 #include "mongo/db/exec/sbe/values/value.h"
 #include "mongo/db/operation_context.h"
 #include "mongo/db/query/collation/collator_interface.h"
+#include "mongo/stdx/unordered_map.h"
 
 namespace mongo::sbe {
 /**
@@ -84,6 +86,12 @@ namespace mongo::sbe {
  * for string equality. For example, this can be used to perform a case-insensitive matching on
  * string values.
  *
+ * Once the hash table has spilled to disk, probing it one 'outer' row at a time would issue point
+ * reads for every spilled key and document. Instead, the stage then buffers batches of 'outer' rows
+ * (see 'internalQuerySBELookupSpilledProbeBatchSize'), reads what the whole batch needs from disk in
+ * sorted order, and returns the batch in its original order. To do so, every 'outer' slot requested
+ * from this stage is materialized while batching.
+ *
  * Debug string representation:
  *
  *   hash_lookup [innerAggSlot = expr] collatorSlot?
@@ -137,6 +145,13 @@ private:
     using HashKeyAccessor = value::MaterializedRowKeyAccessor<HashTableType::iterator>;
     using BufferAccessor = value::MaterializedRowAccessor<BufferType>;
 
+    // Returns the next row from '_outerBatch', refilling the batch when it has been consumed.
+    PlanState getNextFromOuterBatch();
+
+    // Buffers up to '_outerBatchSize' rows from the outer side and computes the lookup result for
+    // each of them, prefetching what they need from the spilled hash table all at once.
+    void fillOuterBatch();
+
     // Resets state of the hash table and miscellany. 'fromClose' == true indicates the call is from
     // the stage's close() method, so it should also try to shrink its memory footprint.
     void reset(bool fromClose);
@@ -191,6 +206,22 @@ private:
     // Accessor for collator. Only set if collatorSlot provided during construction.
     value::SlotAccessor* _collatorAccessor{nullptr};
 
+    // Outer rows buffered while probing a spilled hash table in batches. Each row holds the values
+    // of the outer slots requested from this stage, followed by the outer key and the lookup
+    // result. '_outerBatchPos' is the row currently returned.
+    BufferType _outerBatch;
+    size_t _outerBatchPos{0};
+    size_t _outerBatchSize{0};
+
+    // Accessors of the outer child for the slots requested from this stage, in column order of
+    // '_outerBatch'.
+    std::vector<value::SlotAccessor*> _inOuterAccessors;
+    // Accessors into the current row of '_outerBatch'. A deque keeps them at stable addresses.
+    std::deque<BufferAccessor> _outOuterBatchAccessors;
+    // The accessors handed out for outer slots, switching between the outer child (index 0) and
+    // '_outerBatch' (index 1).
+    stdx::unordered_map<value::SlotId, value::SwitchAccessor> _outOuterAccessors;
+
     // LookupHashTable instance holding the inner collection.
     LookupHashTable _hashTable;
 };  // class HashLookupStage
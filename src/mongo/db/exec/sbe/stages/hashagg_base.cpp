@@ -39,7 +39,9 @@
 #include "mongo/db/exec/sbe/stages/hash_agg.h"
 #include "mongo/db/exec/sbe/util/spilling.h"
 #include "mongo/db/exec/sbe/values/value.h"
+#include "mongo/db/query/query_knobs_gen.h"
 #include "mongo/db/stats/counters.h"
+#include "mongo/util/str.h"
 
 namespace mongo {
 namespace sbe {
@@ -133,8 +135,15 @@ void HashAggBaseStage<Derived>::makeTemporaryRecordStore() {
     tassert(5907501,
             "No storage engine so HashAggStage cannot spill to disk",
             _opCtx->getServiceContext()->getStorageEngine());
-    assertIgnorePrepareConflictsBehavior(_opCtx);
-    _recordStore = std::make_unique<SpillingStore>(_opCtx);
+    if (internalQuerySBEAggSpillToSortedFiles.load()) {
+        // Spilled partial aggregates are only ever appended and then read back with a single
+        // forward scan, so they can be written to sorted-run files which bypass the storage
+        // engine's cache entirely.
+        _recordStore = SpillingStore::makeSortedFileStore(_opCtx);
+    } else {
+        assertIgnorePrepareConflictsBehavior(_opCtx);
+        _recordStore = std::make_unique<SpillingStore>(_opCtx);
+    }
 
     static_cast<Derived*>(this)->getHashAggStats()->usedDisk = true;
 }
@@ -160,16 +169,46 @@ void HashAggBaseStage<Derived>::spillRowToDisk(const value::MaterializedRow& key
     kb.appendNumberLong(_ridSuffixCounter++);
     auto rid = RecordId(kb.getBuffer(), kb.getSize());
 
+    BufBuilder buf;
     if (collator) {
         // The keystring cannot always be deserialized back to the original keys when a collation is
         // in use, so we also store the unmodified key in the data part of the spilled record.
-        _recordStore->upsertToRecordStore(_opCtx, rid, key, val, false /*update*/);
+        key.serializeForSorter(buf);
+        val.serializeForSorter(buf);
     } else {
+        val.serializeForSorter(buf);
         auto typeBits = kb.getTypeBits();
-        _recordStore->upsertToRecordStore(_opCtx, rid, val, typeBits, false /*update*/);
+        buf.appendBuf(typeBits.getBuffer(), typeBits.getSize());
     }
 
+    const int bufferSize = buf.len();
+    auto buffer = buf.release();
+    _spilledRecords.push_back(Record{std::move(rid), RecordData(buffer.get(), bufferSize)});
+    _spilledRecordBuffers.push_back(std::move(buffer));
+
     static_cast<Derived*>(this)->getHashAggStats()->spilledRecords++;
+
+    if (_spilledRecords.size() >= kSpillBatchSize) {
+        flushSpilledRows();
+    }
+}
+
+template <class Derived>
+void HashAggBaseStage<Derived>::flushSpilledRows() {
+    if (_spilledRecords.empty()) {
+        return;
+    }
+
+    // Writing the whole batch in one unit of work avoids paying for a storage transaction per
+    // spilled group, which dominates when the number of groups is large.
+    _spilledRecordTimestamps.resize(_spilledRecords.size());
+    auto status = _recordStore->insertRecords(_opCtx, &_spilledRecords, _spilledRecordTimestamps);
+    if (!status.isOK()) {
+        tasserted(9156660, str::stream() << "Failed to write to disk because " << status.reason());
+    }
+
+    _spilledRecords.clear();
+    _spilledRecordBuffers.clear();
 }
 
 template <class Derived>
@@ -190,30 +229,40 @@ void HashAggBaseStage<Derived>::spill(MemoryCheckData& mcd) {
     for (auto&& it : *_ht) {
         spillRowToDisk(it.first, it.second);
     }
+    flushSpilledRows();
 
     _ht->clear();
 
     static_cast<Derived*>(this)->getHashAggStats()->spills++;
 }
 
-// Checks memory usage. Ideally, we'd want to know the exact size of already accumulated data, but
-// we cannot, so we estimate it based on the last updated/inserted row, if we have one, or the first
-// row in the '_ht' table. If the estimated memory usage exceeds the allowed, this method initiates
-// spilling.
+// Checks memory usage. The slot and control arrays of the '_ht' table are measured exactly by its
+// tracking allocator. The heap memory owned by the rows themselves cannot be measured cheaply, so
+// we estimate it based on the last updated/inserted row, if we have one, or the first row in the
+// '_ht' table. If the memory usage exceeds the allowed, this method initiates spilling.
 template <class Derived>
-void HashAggBaseStage<Derived>::checkMemoryUsageAndSpillIfNecessary(MemoryCheckData& mcd) {
+void HashAggBaseStage<Derived>::checkMemoryUsageAndSpillIfNecessary(MemoryCheckData& mcd,
+                                                                   int64_t numAdvances) {
     invariant(!_ht->empty());
 
-    mcd.memoryCheckpointCounter++;
+    mcd.memoryCheckpointCounter += numAdvances;
     if (mcd.memoryCheckpointCounter < mcd.nextMemoryCheckpoint) {
         // We haven't reached the next checkpoint at which we estimate memory usage and decide if we
         // should spill.
         return;
     }
 
-    const long estimatedRowSize =
-        _htIt->first.memUsageForSorter() + _htIt->second.memUsageForSorter();
-    const long long estimatedTotalSize = _ht->size() * estimatedRowSize;
+    // 'memUsageForSorter()' includes the row objects themselves, which already live in the tracked
+    // slot array, so only the remainder is extrapolated.
+    const long estimatedRowHeapSize = std::max<long>(
+        0,
+        _htIt->first.memUsageForSorter() + _htIt->second.memUsageForSorter() -
+            2 * static_cast<long>(sizeof(value::MaterializedRow)));
+    const long long estimatedTotalSize =
+        static_cast<long long>(_htMemoryStats.allocated()) + _ht->size() * estimatedRowHeapSize;
+
+    auto stats = static_cast<Derived*>(this)->getHashAggStats();
+    stats->peakTrackedMemBytes = std::max(stats->peakTrackedMemBytes, estimatedTotalSize);
 
     if (estimatedTotalSize >= _approxMemoryUseInBytesBeforeSpill) {
         spill(mcd);
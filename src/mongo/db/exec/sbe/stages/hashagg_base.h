@@ -29,8 +29,10 @@
 
 #pragma once
 
+#include <absl/container/flat_hash_map.h>
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "mongo/db/exec/sbe/values/row.h"
 #include "mongo/db/exec/sbe/values/value.h"
@@ -39,11 +41,16 @@
 #include "mongo/base/string_data.h"
 #include "mongo/bson/bsonobj.h"
 #include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/bson/timestamp.h"
 #include "mongo/db/exec/sbe/expressions/compile_ctx.h"
 #include "mongo/db/exec/sbe/stages/stages.h"
 #include "mongo/db/exec/sbe/util/spilling.h"
 #include "mongo/db/exec/sbe/values/value.h"
 #include "mongo/db/query/query_knobs_gen.h"
+#include "mongo/db/record_id.h"
+#include "mongo/db/storage/record_data.h"
+#include "mongo/util/shared_buffer.h"
+#include "mongo/util/tracking_allocator.h"
 
 namespace mongo {
 namespace sbe {
@@ -65,10 +72,17 @@ protected:
     void doAttachToOperationContext(OperationContext* opCtx) override;
 
     using SpilledRow = std::pair<value::MaterializedRow, value::MaterializedRow>;
-    using TableType = stdx::unordered_map<value::MaterializedRow,
+    // An open-addressing table which stores the key and accumulator rows inline, avoiding a node
+    // allocation per group. Iterators are invalidated by insertion, so '_htIt' must be refreshed
+    // after every emplace(). The table's own storage goes through a tracking allocator so that
+    // its footprint is measured rather than extrapolated from a single row.
+    using TableAllocator =
+        TrackingAllocator<std::pair<const value::MaterializedRow, value::MaterializedRow>>;
+    using TableType = absl::flat_hash_map<value::MaterializedRow,
                                           value::MaterializedRow,
                                           value::MaterializedRowHasher,
-                                          value::MaterializedRowEq>;
+                                          value::MaterializedRowEq,
+                                          TableAllocator>;
 
     using HashKeyAccessor = value::MaterializedRowKeyAccessor<TableType::iterator>;
     using HashAggAccessor = value::MaterializedRowValueAccessor<TableType::iterator>;
@@ -128,21 +142,34 @@ protected:
     void makeTemporaryRecordStore();
 
     /**
-     * Inserts a key and value pair to the '_recordStore'. They key is serialized to a
-     * 'key_string::Value' which becomes the 'RecordId'.
+     * Adds a key and value pair to the current batch of records to be written to the
+     * '_recordStore'. They key is serialized to a 'key_string::Value' which becomes the 'RecordId'.
+     * The batch is written out once it holds 'kSpillBatchSize' records, or by
+     * 'flushSpilledRows()'.
      *
      * Note that the 'typeBits' are needed to reconstruct the spilled 'key' to a 'MaterializedRow',
      * but are not necessary for comparison purposes. Therefore, we carry the type bits separately
      * from the record id, instead appending them to the end of the serialized 'val' buffer.
      */
     void spillRowToDisk(const value::MaterializedRow& key, const value::MaterializedRow& val);
+    void flushSpilledRows();
     void spill(MemoryCheckData& mcd);
-    void checkMemoryUsageAndSpillIfNecessary(MemoryCheckData& mcd);
+
+    /**
+     * Accounts for 'numAdvances' processed input rows and, if a memory checkpoint has been reached,
+     * estimates the size of '_ht' and spills it if needed. Block-based callers pass the number of
+     * rows in the block so that the checkpoints are spaced in rows rather than in blocks.
+     */
+    void checkMemoryUsageAndSpillIfNecessary(MemoryCheckData& mcd, int64_t numAdvances = 1);
 
     // Memory tracking and spilling to disk.
     const long long _approxMemoryUseInBytesBeforeSpill =
         internalQuerySBEAggApproxMemoryUseInBytesBeforeSpill.load();
 
+    // Bytes held by the slot and control arrays of '_ht'. Values owned by the rows themselves are
+    // not covered and are still estimated. Must be declared before '_ht' so that it outlives it.
+    TrackingAllocatorStats _htMemoryStats{1};
+
     // Hash table where we'll map groupby key to the accumulators.
     boost::optional<TableType> _ht;
     TableType::iterator _htIt;
@@ -165,6 +192,15 @@ protected:
     // key. We ensure uniqueness by appending a unique integer to the end of this key, which is
     // simply ignored during deserialization.
     int64_t _ridSuffixCounter = 0;
+
+    // The number of records written to '_recordStore' with a single 'insertRecords()' call.
+    static constexpr size_t kSpillBatchSize = 1000;
+
+    // The batch of spilled records which has not been written to '_recordStore' yet, along with
+    // the buffers backing their data.
+    std::vector<Record> _spilledRecords;
+    std::vector<SharedBuffer> _spilledRecordBuffers;
+    std::vector<Timestamp> _spilledRecordTimestamps;
 };
 
 }  // namespace sbe
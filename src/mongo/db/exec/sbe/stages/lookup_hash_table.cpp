@@ -29,6 +29,8 @@
 
 #include "mongo/db/exec/sbe/stages/lookup_hash_table.h"
 
+#include <algorithm>
+
 #include "mongo/db/curop.h"
 #include "mongo/db/exec/sbe/size_estimator.h"
 
@@ -148,26 +150,126 @@ std::tuple<bool, value::TypeTags, value::Value> LookupHashTable::normalizeString
     return {false, tag, val};
 }
 
+std::vector<size_t> LookupHashTable::decodeIndices(const RecordData& record) {
+    // 'BufBuilder' writes numbers in little endian format, so must read them using the same.
+    auto valueReader = BufReader(record.data(), record.size());
+    auto nRecords = valueReader.read<LittleEndian<size_t>>();
+    std::vector<size_t> result(nRecords);
+    for (size_t i = 0; i < nRecords; ++i) {
+        auto idx = valueReader.read<LittleEndian<size_t>>();
+        result[i] = idx;
+    }
+    return result;
+}
+
 boost::optional<std::vector<size_t>> LookupHashTable::readIndicesFromRecordStore(
     SpillingStore* rs, value::TypeTags tagKey, value::Value valKey) {
     _htProbeKey.reset(0, false, tagKey, valKey);
 
     auto [rid, _] = serializeKeyForRecordStore(_htProbeKey);
+    if (rs == _recordStoreHt.get()) {
+        if (auto it = _prefetchedIndices.find(rid); it != _prefetchedIndices.end()) {
+            return it->second;
+        }
+    }
+
     RecordData record;
     if (rs->findRecord(_opCtx, rid, &record)) {
-        // 'BufBuilder' writes numbers in little endian format, so must read them using the same.
-        auto valueReader = BufReader(record.data(), record.size());
-        auto nRecords = valueReader.read<LittleEndian<size_t>>();
-        std::vector<size_t> result(nRecords);
-        for (size_t i = 0; i < nRecords; ++i) {
-            auto idx = valueReader.read<LittleEndian<size_t>>();
-            result[i] = idx;
-        }
-        return result;
+        return decodeIndices(record);
     }
     return boost::none;
 }
 
+void LookupHashTable::prefetchSpilled(
+    const std::vector<std::pair<value::TypeTags, value::Value>>& probeKeys) {
+    clearPrefetched();
+    if (!hasSpilled()) {
+        return;
+    }
+
+    // Spilled keys to read, as the RecordIds they are stored under, and indices of the matching
+    // documents which are not in the memory buffer.
+    std::vector<RecordId> spilledKeys;
+    std::vector<size_t> spilledValues;
+    auto addSpilledValues = [&](const std::vector<size_t>& indices) {
+        for (auto idx : indices) {
+            if (idx >= _buffer.size()) {
+                spilledValues.push_back(idx);
+            }
+        }
+    };
+    auto addKey = [&](value::TypeTags tag, value::Value val) {
+        _htProbeKey.reset(0, false, tag, val);
+        if (auto htIt = _memoryHt->find(_htProbeKey); htIt != _memoryHt->end()) {
+            addSpilledValues(htIt->second);
+        } else if (hasSpilledHtToDisk()) {
+            auto [owned, tagColl, valColl] = normalizeStringIfCollator(tag, val);
+            value::ValueGuard guard{owned, tagColl, valColl};
+            _htProbeKey.reset(0, false, tagColl, valColl);
+            spilledKeys.push_back(serializeKeyForRecordStore(_htProbeKey).first);
+        }
+    };
+
+    for (auto [tag, val] : probeKeys) {
+        if (value::isArray(tag)) {
+            for (value::ArrayEnumerator enumerator(tag, val); !enumerator.atEnd();
+                 enumerator.advance()) {
+                auto [tagElem, valElem] = enumerator.getViewOfValue();
+                addKey(tagElem, valElem);
+            }
+        } else {
+            addKey(tag, val);
+        }
+    }
+
+    // Keeps what is read ahead within the memory budget of the hash table. Returns false if
+    // 'bytes' more do not fit.
+    auto reserveMemory = [&](long long bytes) {
+        if (_computedTotalMemUsage + bytes > _memoryUseInBytesBeforeSpill) {
+            return false;
+        }
+        _computedTotalMemUsage += bytes;
+        _prefetchedMemUsage += bytes;
+        return true;
+    };
+
+    // Read each distinct spilled key once, in the order the record store keeps them.
+    std::sort(spilledKeys.begin(), spilledKeys.end());
+    spilledKeys.erase(std::unique(spilledKeys.begin(), spilledKeys.end()), spilledKeys.end());
+    for (auto& rid : spilledKeys) {
+        RecordData record;
+        if (_recordStoreHt->findRecord(_opCtx, rid, &record)) {
+            auto indices = decodeIndices(record);
+            if (!reserveMemory(rid.memUsage() + indices.size() * sizeof(size_t))) {
+                break;
+            }
+            addSpilledValues(indices);
+            _prefetchedIndices.emplace(std::move(rid), std::move(indices));
+        } else {
+            if (!reserveMemory(rid.memUsage())) {
+                break;
+            }
+            _prefetchedIndices.emplace(std::move(rid), boost::none);
+        }
+    }
+
+    // Likewise read each distinct spilled document once, in index order.
+    if (!hasSpilledBufToDisk()) {
+        return;
+    }
+    std::sort(spilledValues.begin(), spilledValues.end());
+    spilledValues.erase(std::unique(spilledValues.begin(), spilledValues.end()),
+                        spilledValues.end());
+    for (auto idx : spilledValues) {
+        if (auto row = _recordStoreBuf->readFromRecordStore(_opCtx, getValueRecordId(idx))) {
+            if (!reserveMemory(size_estimator::estimate(*row))) {
+                break;
+            }
+            _prefetchedValues.emplace(idx, std::move(*row));
+        }
+    }
+}
+
 void LookupHashTable::addHashTableEntry(value::SlotAccessor* keyAccessor, size_t valueIndex) {
     // Adds a new key-value entry. Will attempt to move or copy from key accessor when needed.
     // array case each elem in array we put each element into ht.
@@ -343,6 +445,8 @@ boost::optional<std::pair<value::TypeTags, value::Value>> LookupHashTable::getVa
     if (index < _buffer.size()) {
         // Document is in memory buffer, always in column 0.
         return _buffer[index].getViewOfValue(0);
+    } else if (auto it = _prefetchedValues.find(index); it != _prefetchedValues.end()) {
+        return it->second.getViewOfValue(0);
     } else if (_recordStoreBuf) {
         // Document is in disk buffer, always in column 0. The MaterializedRow object constructed
         // from this must be copied to a place that does not go out of scope when this method
@@ -381,6 +485,7 @@ void LookupHashTable::reset(bool fromClose) {
 
     _valueId = 0;
     htIter.clear();
+    clearPrefetched();
 }
 
 void LookupHashTable::doSaveState(bool relinquishCursor) {
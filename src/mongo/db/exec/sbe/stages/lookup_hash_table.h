@@ -46,6 +46,8 @@
 #include "mongo/db/exec/sbe/values/value.h"
 #include "mongo/db/operation_context.h"
 #include "mongo/db/query/collation/collator_interface.h"
+#include "mongo/db/record_id.h"
+#include "mongo/stdx/unordered_map.h"
 
 namespace mongo::sbe {
 using HashTableType = std::unordered_map<value::MaterializedRow,  // NOLINT
@@ -224,6 +226,35 @@ public:
 
     void reset(bool fromClose);
 
+    /**
+     * Returns true if any part of the hash table or of its document buffer has spilled to disk.
+     */
+    inline bool hasSpilled() const {
+        return _recordStoreHt != nullptr || _recordStoreBuf != nullptr;
+    }
+
+    /**
+     * Reads into memory everything on disk that probing with any of 'probeKeys' (each a scalar or
+     * an array of keys) would need: first the spilled hash table entries of the keys not found in
+     * memory, in key order, and then the spilled documents all the matches refer to, in index
+     * order. Until clearPrefetched() is called, htIter and getValueAtIndex() serve these from
+     * memory instead of issuing a point read per key and document.
+     *
+     * What is read ahead counts towards the memory usage of the hash table, so reading stops once
+     * the memory budget is used up. Whatever was not read ahead is read on demand.
+     */
+    void prefetchSpilled(const std::vector<std::pair<value::TypeTags, value::Value>>& probeKeys);
+
+    /**
+     * Releases everything read by prefetchSpilled().
+     */
+    void clearPrefetched() {
+        _prefetchedIndices.clear();
+        _prefetchedValues.clear();
+        _computedTotalMemUsage -= _prefetchedMemUsage;
+        _prefetchedMemUsage = 0;
+    }
+
     /**
      * Sets the collator for the query if one was specified.
      */
@@ -269,6 +300,8 @@ private:
     std::tuple<bool, value::TypeTags, value::Value> normalizeStringIfCollator(
         value::TypeTags tag, value::Value val) const;
 
+    static std::vector<size_t> decodeIndices(const RecordData& record);
+
     boost::optional<std::vector<size_t>> readIndicesFromRecordStore(SpillingStore* rs,
                                                                     value::TypeTags tagKey,
                                                                     value::Value valKey);
@@ -332,6 +365,14 @@ private:
     // when getValueAtIndex() returns a view of it.
     boost::optional<value::MaterializedRow> _bufValueRecordStore;
 
+    // Spilled hash table entries and documents read ahead by prefetchSpilled(). A key that was
+    // looked up but is not on disk maps to boost::none.
+    stdx::unordered_map<RecordId, boost::optional<std::vector<size_t>>, RecordId::Hasher>
+        _prefetchedIndices;
+    stdx::unordered_map<size_t, value::MaterializedRow> _prefetchedValues;
+    // The part of '_computedTotalMemUsage' taken by '_prefetchedIndices' and '_prefetchedValues'.
+    long long _prefetchedMemUsage = 0;
+
     friend class LookupHashTableIter;
 };  // class LookupHashTable
 }  // namespace mongo::sbe
@@ -340,7 +340,7 @@ void MakeObjStageBase<MakeObjOutputType::Object>::produceObject() {
 
 template <>
 void MakeObjStageBase<MakeObjOutputType::BsonObject>::produceObject() {
-    UniqueBSONObjBuilder bob;
+    UniqueBSONObjBuilder bob(_sizeTracker);
 
     auto finish = [this, &bob]() {
         bob.doneFast();
@@ -368,6 +368,18 @@ void MakeObjStageBase<MakeObjOutputType::BsonObject>::produceObject() {
             // Skip document length.
             be += sizeof(int32_t);
 
+            // Consecutive fields copied unchanged from '_root' are contiguous in the input, so
+            // rather than appending them one by one we copy each run of them with a single memcpy
+            // once a field that is dropped or computed is reached.
+            const char* keptRunBegin = nullptr;
+            const char* keptRunEnd = nullptr;
+            auto flushKeptRun = [&]() {
+                if (keptRunBegin) {
+                    bob.bb().appendBuf(keptRunBegin, keptRunEnd - keptRunBegin);
+                    keptRunBegin = nullptr;
+                }
+            };
+
             // Loop over _root's fields until numFieldsRemaining - numComputedFieldsRemaining == 0
             // AND until one of the follow is true:
             //   (1) numComputedFieldsRemaining == 1 and isInclusion == true; -OR-
@@ -383,11 +395,17 @@ void MakeObjStageBase<MakeObjOutputType::BsonObject>::produceObject() {
                     if (projectIdx == std::numeric_limits<size_t>::max()) {
                         if (found == isInclusion) {
                             nextBe = bson::advance(be, sv.size());
-                            bob.append(BSONElement(be, sv.size() + 1, nextBe - be));
+                            if (!keptRunBegin) {
+                                keptRunBegin = be;
+                            }
+                            keptRunEnd = nextBe;
+                        } else {
+                            flushKeptRun();
                         }
 
                         numFieldsRemaining -= found;
                     } else {
+                        flushKeptRun();
                         projectField(&bob, projectIdx);
                         _visited[projectIdx] = 1;
                         --numFieldsRemaining;
@@ -407,17 +425,12 @@ void MakeObjStageBase<MakeObjOutputType::BsonObject>::produceObject() {
                 }
             }
 
+            flushKeptRun();
+
             // If this is an exclusion projection and 'be' has not reached the end of the input
             // object, copy over the remaining fields from the input object into 'bob'.
             if (!isInclusion) {
-                while (be != end - 1) {
-                    auto sv = bson::fieldNameAndLength(be);
-                    auto nextBe = bson::advance(be, sv.size());
-
-                    bob.append(BSONElement(be, sv.size() + 1, nextBe - be));
-
-                    be = nextBe;
-                }
+                bob.bb().appendBuf(be, end - 1 - be);
             }
         } else if (tag == value::TypeTags::Object) {
             auto objRoot = value::getObjectView(val);
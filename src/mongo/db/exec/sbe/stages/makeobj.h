@@ -192,6 +192,10 @@ private:
 
     typename O::OutputAccessorType _obj;
 
+    // Sizes of the most recently produced objects, used to size the buffer for the next one so
+    // that large outputs are built without repeated reallocation. Only used for BSON output.
+    BSONSizeTracker _sizeTracker;
+
     value::SlotAccessor* _root{nullptr};
 
     bool _compiled{false};
@@ -339,6 +339,9 @@ struct HashAggStats : public SpecificStats {
     // An estimate, in bytes, of the size of the final spill table after all spill events have taken
     // place.
     long long spilledDataStorageSize{0};
+    // The largest in-memory footprint of the hash table observed at a memory checkpoint, combining
+    // the bytes tracked by the table's allocator with the estimated size of the rows' own values.
+    long long peakTrackedMemBytes{0};
 };
 
 struct BlockHashAggStats : public HashAggStats {
@@ -0,0 +1,210 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/db/exec/sbe/stages/row_to_block.h"
+
+#include "mongo/db/exec/sbe/size_estimator.h"
+#include "mongo/db/exec/sbe/values/value.h"
+#include "mongo/util/assert_util.h"
+
+namespace mongo::sbe {
+RowToBlockStage::RowToBlockStage(std::unique_ptr<PlanStage> input,
+                                 value::SlotVector valsIn,
+                                 value::SlotVector blocksOut,
+                                 value::SlotId bitmapOutSlotId,
+                                 size_t blockSize,
+                                 PlanNodeId nodeId,
+                                 PlanYieldPolicy* yieldPolicy,
+                                 bool participateInTrialRunTracking)
+    : PlanStage("row_to_block"_sd, yieldPolicy, nodeId, participateInTrialRunTracking),
+      _valsInSlotIds(std::move(valsIn)),
+      _blocksOutSlotIds(std::move(blocksOut)),
+      _bitmapOutSlotId(bitmapOutSlotId),
+      _blockSize(blockSize) {
+    _children.emplace_back(std::move(input));
+    invariant(_valsInSlotIds.size() == _blocksOutSlotIds.size());
+    invariant(_blockSize > 0);
+}
+
+std::unique_ptr<PlanStage> RowToBlockStage::clone() const {
+    return std::make_unique<RowToBlockStage>(_children[0]->clone(),
+                                             _valsInSlotIds,
+                                             _blocksOutSlotIds,
+                                             _bitmapOutSlotId,
+                                             _blockSize,
+                                             _commonStats.nodeId,
+                                             _yieldPolicy,
+                                             participateInTrialRunTracking());
+}
+
+void RowToBlockStage::prepare(CompileCtx& ctx) {
+    _children[0]->prepare(ctx);
+
+    for (auto& id : _valsInSlotIds) {
+        _valsInAccessors.push_back(_children[0]->getAccessor(ctx, id));
+    }
+
+    _blocksOutAccessors.resize(_blocksOutSlotIds.size());
+}
+
+value::SlotAccessor* RowToBlockStage::getAccessor(CompileCtx& ctx, value::SlotId slot) {
+    if (slot == _bitmapOutSlotId) {
+        return &_bitmapOutAccessor;
+    }
+
+    for (size_t i = 0; i < _blocksOutSlotIds.size(); ++i) {
+        if (slot == _blocksOutSlotIds[i]) {
+            return &_blocksOutAccessors[i];
+        }
+    }
+
+    return _children[0]->getAccessor(ctx, slot);
+}
+
+void RowToBlockStage::open(bool reOpen) {
+    auto optTimer(getOptTimer(_opCtx));
+
+    _commonStats.opens++;
+    _children[0]->open(reOpen);
+    _childIsEOF = false;
+}
+
+PlanState RowToBlockStage::getNext() {
+    auto optTimer(getOptTimer(_opCtx));
+
+    for (auto& acc : _blocksOutAccessors) {
+        acc.reset();
+    }
+    _bitmapOutAccessor.reset();
+
+    if (_childIsEOF) {
+        return trackPlanState(PlanState::IS_EOF);
+    }
+
+    std::vector<std::unique_ptr<value::HeterogeneousBlock>> blocks;
+    blocks.reserve(_valsInAccessors.size());
+    for (size_t i = 0; i < _valsInAccessors.size(); ++i) {
+        auto block = std::make_unique<value::HeterogeneousBlock>();
+        block->reserve(_blockSize);
+        blocks.emplace_back(std::move(block));
+    }
+
+    // The values gathered so far are owned by the blocks, so there is nothing to save if the child
+    // yields while we are filling them.
+    size_t numRows = 0;
+    while (numRows < _blockSize) {
+        if (_children[0]->getNext() == PlanState::IS_EOF) {
+            _childIsEOF = true;
+            break;
+        }
+
+        for (size_t i = 0; i < _valsInAccessors.size(); ++i) {
+            blocks[i]->push_back(_valsInAccessors[i]->copyOrMoveValue());
+        }
+        ++numRows;
+    }
+
+    if (numRows == 0) {
+        return trackPlanState(PlanState::IS_EOF);
+    }
+
+    for (size_t i = 0; i < blocks.size(); ++i) {
+        _blocksOutAccessors[i].reset(
+            true,
+            value::TypeTags::valueBlock,
+            value::bitcastFrom<value::ValueBlock*>(blocks[i].release()));
+    }
+
+    _bitmapOutAccessor.reset(true,
+                             value::TypeTags::valueBlock,
+                             value::bitcastFrom<value::ValueBlock*>(
+                                 std::make_unique<value::MonoBlock>(numRows,
+                                                                    value::TypeTags::Boolean,
+                                                                    value::bitcastFrom<bool>(true))
+                                     .release()));
+
+    return trackPlanState(PlanState::ADVANCED);
+}
+
+void RowToBlockStage::close() {
+    auto optTimer(getOptTimer(_opCtx));
+
+    trackClose();
+    _children[0]->close();
+}
+
+std::unique_ptr<PlanStageStats> RowToBlockStage::getStats(bool includeDebugInfo) const {
+    auto ret = std::make_unique<PlanStageStats>(_commonStats);
+    ret->children.emplace_back(_children[0]->getStats(includeDebugInfo));
+    return ret;
+}
+
+const SpecificStats* RowToBlockStage::getSpecificStats() const {
+    return nullptr;
+}
+
+std::vector<DebugPrinter::Block> RowToBlockStage::debugPrint() const {
+    auto ret = PlanStage::debugPrint();
+
+    ret.emplace_back(std::to_string(_blockSize));
+
+    ret.emplace_back(DebugPrinter::Block("row[`"));
+    for (size_t i = 0; i < _valsInSlotIds.size(); ++i) {
+        if (i) {
+            ret.emplace_back(DebugPrinter::Block("`,"));
+        }
+        DebugPrinter::addIdentifier(ret, _valsInSlotIds[i]);
+    }
+    ret.emplace_back(DebugPrinter::Block("`]"));
+
+    ret.emplace_back(DebugPrinter::Block("blocks[`"));
+    for (size_t i = 0; i < _blocksOutSlotIds.size(); ++i) {
+        if (i) {
+            ret.emplace_back(DebugPrinter::Block("`,"));
+        }
+        DebugPrinter::addIdentifier(ret, _blocksOutSlotIds[i]);
+    }
+    ret.emplace_back(DebugPrinter::Block("`]"));
+
+    DebugPrinter::addIdentifier(ret, _bitmapOutSlotId);
+
+    DebugPrinter::addNewLine(ret);
+    DebugPrinter::addBlocks(ret, _children[0]->debugPrint());
+
+    return ret;
+}
+
+size_t RowToBlockStage::estimateCompileTimeSize() const {
+    size_t size = sizeof(*this);
+    size += size_estimator::estimate(_children);
+    size += size_estimator::estimate(_valsInSlotIds);
+    size += size_estimator::estimate(_blocksOutSlotIds);
+    return size;
+}
+}  // namespace mongo::sbe
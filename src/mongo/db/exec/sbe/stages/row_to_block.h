@@ -0,0 +1,93 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "mongo/db/exec/sbe/stages/stages.h"
+#include "mongo/db/exec/sbe/values/block_interface.h"
+#include "mongo/db/exec/sbe/values/slot.h"
+
+namespace mongo::sbe {
+/**
+ * The inverse of BlockToRowStage. The stage pulls up to 'blockSize' rows from its child and, for
+ * each input slot in 'valsIn', gathers the values into a ValueBlock published in the corresponding
+ * slot of 'blocksOut'. This allows block processing (vectorized filters, BlockHashAggStage) to run
+ * on top of row oriented stages such as a regular collection scan.
+ *
+ * The 'bitmapOutSlotId' slot contains an all 1s bitmap with one entry per gathered row. The last
+ * batch produced before EOF may contain fewer than 'blockSize' rows; an empty batch is never
+ * produced.
+ *
+ * Debug string representation:
+ *
+ *  row_to_block blockSize row[valsIn[0], ..., valsIn[N]] blocks[blocksOut[0], ..., blocksOut[N]]
+ *      bitmapOutSlotId
+ */
+class RowToBlockStage final : public PlanStage {
+public:
+    RowToBlockStage(std::unique_ptr<PlanStage> input,
+                    value::SlotVector valsIn,
+                    value::SlotVector blocksOut,
+                    value::SlotId bitmapOutSlotId,
+                    size_t blockSize,
+                    PlanNodeId nodeId,
+                    PlanYieldPolicy* yieldPolicy = nullptr,
+                    bool participateInTrialRunTracking = true);
+
+    std::unique_ptr<PlanStage> clone() const final;
+
+    void prepare(CompileCtx& ctx) final;
+    value::SlotAccessor* getAccessor(CompileCtx& ctx, value::SlotId slot) final;
+    void open(bool reOpen) final;
+    PlanState getNext() final;
+    void close() final;
+
+    std::unique_ptr<PlanStageStats> getStats(bool includeDebugInfo) const final;
+    const SpecificStats* getSpecificStats() const final;
+    std::vector<DebugPrinter::Block> debugPrint() const final;
+    size_t estimateCompileTimeSize() const final;
+
+private:
+    const value::SlotVector _valsInSlotIds;
+    const value::SlotVector _blocksOutSlotIds;
+    const value::SlotId _bitmapOutSlotId;
+    const size_t _blockSize;
+
+    std::vector<value::SlotAccessor*> _valsInAccessors;
+    std::vector<value::OwnedValueAccessor> _blocksOutAccessors;
+    value::OwnedValueAccessor _bitmapOutAccessor;
+
+    // Set once the child has returned EOF, so that the partially filled last batch can be returned
+    // without calling getNext() on an exhausted child again.
+    bool _childIsEOF = false;
+};
+}  // namespace mongo::sbe
@@ -39,16 +39,136 @@
 #include "mongo/base/string_data.h"
 #include "mongo/bson/timestamp.h"
 #include "mongo/db/query/query_knobs_gen.h"
+#include "mongo/db/sorter/sorter.h"
+#include "mongo/db/sorter/sorter_stats.h"
 #include "mongo/db/storage/record_data.h"
 #include "mongo/db/storage/recovery_unit.h"
+#include "mongo/db/storage/storage_options.h"
 #include "mongo/db/storage/write_unit_of_work.h"
 #include "mongo/db/transaction_resources.h"
+#include "mongo/platform/atomic_word.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/bufreader.h"
+#include "mongo/util/shared_buffer.h"
 #include "mongo/util/str.h"
 
+namespace {
+std::string nextFileName() {
+    static mongo::AtomicWord<unsigned> spillingStoreFileCounter;
+    return "extsort-spill-sbe." + std::to_string(spillingStoreFileCounter.fetchAndAdd(1));
+}
+}  // namespace
+
+// Include the sorter's implementation so that it can be instantiated for spilled records.
+#include "mongo/db/sorter/sorter.cpp"  // IWYU pragma: keep
+
 namespace mongo {
 namespace sbe {
+namespace {
+/**
+ * The data portion of a record spilled to a sorted file store, in the form the 'Sorter' expects.
+ */
+class SpilledRecordData {
+public:
+    struct SorterDeserializeSettings {};  // unused
+
+    SpilledRecordData() = default;
+    SpilledRecordData(const char* data, int size)
+        : _buffer(SharedBuffer::allocate(size)), _size(size) {
+        memcpy(_buffer.get(), data, size);
+    }
+
+    const char* data() const {
+        return _buffer.get();
+    }
+    int size() const {
+        return _size;
+    }
+
+    void serializeForSorter(BufBuilder& buf) const {
+        buf.appendNum(_size);
+        buf.appendBuf(_buffer.get(), _size);
+    }
+    static SpilledRecordData deserializeForSorter(BufReader& buf,
+                                                  const SorterDeserializeSettings&) {
+        int32_t size = buf.read<LittleEndian<int32_t>>();
+        return SpilledRecordData{static_cast<const char*>(buf.skip(size)), size};
+    }
+    int memUsageForSorter() const {
+        return sizeof(SpilledRecordData) + _size;
+    }
+    SpilledRecordData getOwned() const {
+        return *this;
+    }
+    void makeOwned() {}
+
+private:
+    SharedBuffer _buffer;
+    int _size{0};
+};
+
+struct SpilledRecordIdComparator {
+    int operator()(const RecordId& lhs, const RecordId& rhs) const {
+        return lhs.compare(rhs);
+    }
+};
+
+using SpilledRecordSorter = Sorter<RecordId, SpilledRecordData>;
+
+/**
+ * Walks the records of a sorted file store in 'RecordId' order. The merged runs live in files
+ * owned by the store rather than in the storage engine, so there is no storage state to save or
+ * restore across yields.
+ */
+class SortedFileCursor final : public SeekableRecordCursor {
+public:
+    explicit SortedFileCursor(std::unique_ptr<SpilledRecordSorter::Iterator> iterator)
+        : _iterator(std::move(iterator)) {}
+
+    boost::optional<Record> next() final {
+        if (!_iterator->more()) {
+            return boost::none;
+        }
+        _current = _iterator->next();
+        return Record{_current.first, RecordData(_current.second.data(), _current.second.size())};
+    }
+
+    boost::optional<Record> seek(const RecordId& start, BoundInclusion boundInclusion) final {
+        tasserted(9156615, "A sorted file spilling store only supports forward scans");
+    }
+
+    boost::optional<Record> seekExact(const RecordId& id) final {
+        tasserted(9156616, "A sorted file spilling store only supports forward scans");
+    }
+
+    void save() final {}
+    bool restore(bool tolerateCappedRepositioning = true) final {
+        return true;
+    }
+    void detachFromOperationContext() final {}
+    void reattachToOperationContext(OperationContext* opCtx) final {}
+    void setSaveStorageCursorOnDetachFromOperationContext(bool) final {}
+
+private:
+    std::unique_ptr<SpilledRecordSorter::Iterator> _iterator;
+    std::pair<RecordId, SpilledRecordData> _current;
+};
+}  // namespace
+
+struct SpillingStore::SortedFileState {
+    SortedFileState() : fileStats(nullptr /* sorterTracker */) {
+        SortOptions opts;
+        opts.tempDir = storageGlobalParams.dbpath + "/_tmp";
+        opts.maxMemoryUsageBytes = internalQuerySBESortedFileSpillingMaxMemoryUsageBytes.load();
+        opts.extSortAllowed = true;
+        opts.moveSortedDataIntoIterator = true;
+        opts.sorterFileStats = &fileStats;
+        sorter.reset(SpilledRecordSorter::make(opts, SpilledRecordIdComparator{}, {}));
+    }
+
+    SorterFileStats fileStats;
+    std::unique_ptr<SpilledRecordSorter> sorter;
+};
 
 void assertIgnorePrepareConflictsBehavior(OperationContext* opCtx) {
     tassert(5907502,
@@ -85,6 +205,13 @@ SpillingStore::SpillingStore(OperationContext* opCtx, KeyFormat format) {
     _spillingState = WriteUnitOfWork::RecoveryUnitState::kNotInUnitOfWork;
 }
 
+SpillingStore::SpillingStore(std::unique_ptr<SortedFileState> sortedFiles)
+    : _sortedFiles(std::move(sortedFiles)) {}
+
+std::unique_ptr<SpillingStore> SpillingStore::makeSortedFileStore(OperationContext* opCtx) {
+    return std::unique_ptr<SpillingStore>(new SpillingStore(std::make_unique<SortedFileState>()));
+}
+
 SpillingStore::~SpillingStore() {}
 
 int SpillingStore::upsertToRecordStore(OperationContext* opCtx,
@@ -155,6 +282,14 @@ int SpillingStore::upsertToRecordStore(OperationContext* opCtx,
 Status SpillingStore::insertRecords(OperationContext* opCtx,
                                     std::vector<Record>* inOutRecords,
                                     const std::vector<Timestamp>& timestamps) {
+    if (_sortedFiles) {
+        for (auto&& record : *inOutRecords) {
+            _sortedFiles->sorter->emplace(
+                record.id.getOwned(), SpilledRecordData{record.data.data(), record.data.size()});
+        }
+        return Status::OK();
+    }
+
     assertIgnorePrepareConflictsBehavior(opCtx);
 
     switchToSpilling(opCtx);
@@ -186,7 +321,66 @@ bool SpillingStore::findRecord(OperationContext* opCtx, const RecordId& loc, Rec
     return rs()->findRecord(opCtx, loc, out);
 }
 
+int64_t SpillingStore::storageSize(OperationContext* opCtx) {
+    if (_sortedFiles) {
+        return _sortedFiles->fileStats.bytesSpilled();
+    }
+    return rs()->storageSize(opCtx);
+}
+
+std::unique_ptr<SeekableRecordCursor> SpillingStore::getCursor(OperationContext* opCtx) {
+    if (_sortedFiles) {
+        tassert(9156618,
+                "A sorted file spilling store can only be read once",
+                _sortedFiles->sorter);
+        std::unique_ptr<SpilledRecordSorter::Iterator> iterator(_sortedFiles->sorter->done());
+        _sortedFiles->sorter.reset();
+        return std::make_unique<SortedFileCursor>(std::move(iterator));
+    }
+
+    switchToSpilling(opCtx);
+    ON_BLOCK_EXIT([&] { switchToOriginal(opCtx); });
+    return rs()->getCursor(opCtx);
+}
+
+void SpillingStore::resetCursor(OperationContext* opCtx,
+                                std::unique_ptr<SeekableRecordCursor>& cursor) {
+    if (_sortedFiles) {
+        cursor.reset();
+        return;
+    }
+
+    switchToSpilling(opCtx);
+    ON_BLOCK_EXIT([&] { switchToOriginal(opCtx); });
+    cursor.reset();
+}
+
+void SpillingStore::saveCursor(OperationContext* opCtx,
+                               std::unique_ptr<SeekableRecordCursor>& cursor) {
+    if (_sortedFiles) {
+        return;
+    }
+
+    switchToSpilling(opCtx);
+    ON_BLOCK_EXIT([&] { switchToOriginal(opCtx); });
+    cursor->save();
+}
+
+bool SpillingStore::restoreCursor(OperationContext* opCtx,
+                                  std::unique_ptr<SeekableRecordCursor>& cursor) {
+    if (_sortedFiles) {
+        return true;
+    }
+
+    switchToSpilling(opCtx);
+    ON_BLOCK_EXIT([&] { switchToOriginal(opCtx); });
+    return cursor->restore();
+}
+
 void SpillingStore::switchToSpilling(OperationContext* opCtx) {
+    tassert(9156617,
+            "A sorted file spilling store only supports inserts and forward scans",
+            !_sortedFiles);
     invariant(!_originalUnit);
     _originalUnit = shard_role_details::releaseRecoveryUnit(opCtx);
     _originalState =
@@ -202,6 +396,9 @@ void SpillingStore::switchToOriginal(OperationContext* opCtx) {
 }
 
 void SpillingStore::saveState() {
+    if (_sortedFiles) {
+        return;
+    }
     _spillingUnit->abandonSnapshot();
 }
 void SpillingStore::restoreState() {
@@ -210,3 +407,7 @@ void SpillingStore::restoreState() {
 
 }  // namespace sbe
 }  // namespace mongo
+
+MONGO_CREATE_SORTER(mongo::RecordId,
+                    mongo::sbe::SpilledRecordData,
+                    mongo::sbe::SpilledRecordIdComparator);
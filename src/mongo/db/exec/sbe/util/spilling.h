@@ -30,6 +30,7 @@
 #pragma once
 
 #include <boost/optional/optional.hpp>
+#include <memory>
 #include <utility>
 
 #include "mongo/bson/util/builder.h"
@@ -41,6 +42,7 @@
 #include "mongo/db/storage/record_store.h"
 #include "mongo/db/storage/temporary_record_store.h"
 #include "mongo/platform/basic.h"
+#include "mongo/util/assert_util.h"
 
 namespace mongo {
 namespace sbe {
@@ -62,11 +64,27 @@ key_string::Value decodeKeyString(const RecordId& rid, key_string::TypeBits type
  * SpillingStore is a wrapper around a temporary record store than maintains its own transaction as
  * we do not want to intermingle operations running in the main query with spill reads and writes.
  */
+/**
+ * Temporary storage for data spilled by SBE stages. By default the spilled records are written to
+ * a temporary record store owned by the storage engine, which supports point reads and updates.
+ *
+ * Stages which only ever append spilled records and read them back with a single forward scan in
+ * 'RecordId' order may instead use a store created by 'makeSortedFileStore()'. Such a store
+ * buffers records up to its own memory budget and writes them out as sorted runs to files in the
+ * temporary directory, the same way the 'Sorter' does, so spilling never goes through the storage
+ * engine's cache. Point reads and updates are not supported by this kind of store.
+ */
 class SpillingStore {
 public:
     SpillingStore(OperationContext* opCtx, KeyFormat format = KeyFormat::String);
     ~SpillingStore();
 
+    /**
+     * Creates a store backed by sorted-run files rather than by a temporary record store. Records
+     * inserted into it can be read back exactly once via 'getCursor()', in 'RecordId' order.
+     */
+    static std::unique_ptr<SpillingStore> makeSortedFileStore(OperationContext* opCtx);
+
     /**
      * When a collator is provided, the key is encoded using the collator before being converted to
      * a record id. In this case, it is not possible to recover the key from the record id, thus we
@@ -111,39 +129,29 @@ public:
     bool findRecord(OperationContext* opCtx, const RecordId& loc, RecordData* out);
 
     auto rs() {
+        tassert(9156614, "A sorted file spilling store has no record store", _recordStore);
         return _recordStore->rs();
     }
 
-    auto getCursor(OperationContext* opCtx) {
-        switchToSpilling(opCtx);
-        ON_BLOCK_EXIT([&] { switchToOriginal(opCtx); });
-        return rs()->getCursor(opCtx);
-    }
-
-    void resetCursor(OperationContext* opCtx, std::unique_ptr<SeekableRecordCursor>& cursor) {
-        switchToSpilling(opCtx);
-        ON_BLOCK_EXIT([&] { switchToOriginal(opCtx); });
-        cursor.reset();
-    }
+    // Returns the number of bytes the spilled data occupies on disk.
+    int64_t storageSize(OperationContext* opCtx);
 
-    auto saveCursor(OperationContext* opCtx, std::unique_ptr<SeekableRecordCursor>& cursor) {
-        switchToSpilling(opCtx);
-        ON_BLOCK_EXIT([&] { switchToOriginal(opCtx); });
+    std::unique_ptr<SeekableRecordCursor> getCursor(OperationContext* opCtx);
 
-        return cursor->save();
-    }
+    void resetCursor(OperationContext* opCtx, std::unique_ptr<SeekableRecordCursor>& cursor);
 
-    auto restoreCursor(OperationContext* opCtx, std::unique_ptr<SeekableRecordCursor>& cursor) {
-        switchToSpilling(opCtx);
-        ON_BLOCK_EXIT([&] { switchToOriginal(opCtx); });
+    void saveCursor(OperationContext* opCtx, std::unique_ptr<SeekableRecordCursor>& cursor);
 
-        return cursor->restore();
-    }
+    bool restoreCursor(OperationContext* opCtx, std::unique_ptr<SeekableRecordCursor>& cursor);
 
     void saveState();
     void restoreState();
 
 private:
+    struct SortedFileState;
+
+    explicit SpillingStore(std::unique_ptr<SortedFileState> sortedFiles);
+
     void switchToSpilling(OperationContext* opCtx);
     void switchToOriginal(OperationContext* opCtx);
 
@@ -155,6 +163,9 @@ private:
     std::unique_ptr<RecoveryUnit> _spillingUnit;
     WriteUnitOfWork::RecoveryUnitState _spillingState;
 
+    // Only set for stores created by 'makeSortedFileStore()'.
+    std::unique_ptr<SortedFileState> _sortedFiles;
+
     size_t _counter{0};
 };
 }  // namespace sbe
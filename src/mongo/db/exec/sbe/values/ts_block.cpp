@@ -29,6 +29,7 @@
 
 #include "mongo/db/exec/sbe/values/ts_block.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <memory>
 #include <tuple>
@@ -143,6 +144,183 @@ private:
     // position information of the values.
     // std::vector<int32_t> _positions;
 };
+
+/**
+ * Appendable buffer for the block-based decompressing API that stores the values of a column of a
+ * single scalar type as packed SBE values plus a presence bitset, so they can be moved straight
+ * into a HomogeneousBlock without materializing a tag/value pair per element. The control min and
+ * max only bound the column's type when both are dates; numeric columns may mix integer widths and
+ * doubles. Any value of a type other than 'T' marks the buffer as mismatched and the caller must
+ * fall back to the generic decompression path.
+ */
+template <typename T>
+class HomogeneousDecompressBuffer {
+public:
+    explicit HomogeneousDecompressBuffer(size_t count)
+        : _allocator(new mongo::bsoncolumn::ElementStorage()) {
+        _vals.reserve(count);
+        _presentBitset.reserve(count);
+    }
+
+    void append(bool val) {
+        _appendValue(val);
+    }
+    void append(int32_t val) {
+        _appendValue(val);
+    }
+    void append(int64_t val) {
+        _appendValue(val);
+    }
+    void append(Decimal128 val) {
+        _appendValue(val);
+    }
+    void append(double val) {
+        _appendValue(val);
+    }
+    void append(Timestamp val) {
+        _appendValue(val);
+    }
+    void append(Date_t val) {
+        _appendValue(val);
+    }
+    void append(OID val) {
+        _appendValue(val);
+    }
+    void append(StringData val) {
+        _appendValue(val);
+    }
+    void append(const BSONBinData& val) {
+        _appendValue(val);
+    }
+    void append(const BSONCode& val) {
+        _appendValue(val);
+    }
+
+    template <typename U>
+    void append(const BSONElement& val) {
+        setLast<U>(val);
+        appendLast();
+    }
+
+    void appendPreallocated(const BSONElement& val) {
+        _mismatch = true;
+    }
+
+    void appendMissing() {
+        _presentBitset.push_back(false);
+    }
+
+    void appendLast() {
+        if (!_last) {
+            appendMissing();
+            return;
+        }
+        _vals.push_back(*_last);
+        _presentBitset.push_back(true);
+    }
+
+    template <typename U>
+    void setLast(const BSONElement& val) {
+        if constexpr (std::is_same_v<U, T>) {
+            if constexpr (std::is_same_v<T, Date_t>) {
+                _last = bitcastFrom<int64_t>(val.date().toMillisSinceEpoch());
+            } else if constexpr (std::is_same_v<T, double>) {
+                _last = bitcastFrom<double>(val._numberDouble());
+            } else if constexpr (std::is_same_v<T, int64_t>) {
+                _last = bitcastFrom<int64_t>(val._numberLong());
+            } else {
+                _last = bitcastFrom<int32_t>(val._numberInt());
+            }
+        } else {
+            _mismatch = true;
+        }
+    }
+
+    void appendPositionInfo(int32_t n) {}
+
+    mongo::bsoncolumn::ElementStorage& getAllocator() {
+        return *_allocator;
+    }
+
+    /**
+     * Returns the decompressed values as a block with tag 'TypeTag', or nullptr if the column
+     * contained a value of any other type. Mirrors buildBlockFromStorage() in returning a
+     * MonoBlock for columns where every value is the same.
+     */
+    template <TypeTags TypeTag>
+    std::unique_ptr<ValueBlock> build() {
+        if (_mismatch) {
+            return nullptr;
+        }
+        if (_presentBitset.empty()) {
+            return std::make_unique<HeterogeneousBlock>();
+        }
+        if (_vals.empty()) {
+            return std::make_unique<MonoBlock>(_presentBitset.size(), TypeTags::Nothing, Value{0u});
+        }
+        if (_vals.size() == _presentBitset.size() &&
+            std::all_of(_vals.begin(), _vals.end(), [&](Value v) { return v == _vals[0]; })) {
+            return std::make_unique<MonoBlock>(_vals.size(), TypeTag, _vals[0]);
+        }
+        using BlockType =
+            HomogeneousBlock<std::conditional_t<std::is_same_v<T, Date_t>, int64_t, T>, TypeTag>;
+        return std::make_unique<BlockType>(std::move(_vals), std::move(_presentBitset));
+    }
+
+private:
+    template <typename U>
+    void _appendValue(const U& val) {
+        if constexpr (std::is_same_v<U, T>) {
+            if constexpr (std::is_same_v<T, Date_t>) {
+                _last = bitcastFrom<int64_t>(val.toMillisSinceEpoch());
+            } else {
+                _last = bitcastFrom<T>(val);
+            }
+            _vals.push_back(*_last);
+            _presentBitset.push_back(true);
+        } else {
+            _mismatch = true;
+        }
+    }
+
+    // Only used by the interleaved decompressor, which scalar columns never reach.
+    boost::intrusive_ptr<mongo::bsoncolumn::ElementStorage> _allocator;
+
+    // Values of the present elements, in order.
+    std::vector<Value> _vals;
+    HomogeneousBlockBitset _presentBitset;
+    boost::optional<Value> _last;
+    bool _mismatch = false;
+};
+
+template <typename T, TypeTags TypeTag>
+std::unique_ptr<ValueBlock> decompressToHomogeneousBlock(BSONBinData binData, size_t count) {
+    mongo::bsoncolumn::BSONColumnBlockBased col(binData);
+    HomogeneousDecompressBuffer<T> buffer(count);
+    col.decompress(buffer);
+    return buffer.template build<TypeTag>();
+}
+
+/**
+ * Decompresses 'binData' directly into a homogeneous block when the column holds a single numeric
+ * or date type, indicated by 'tag'. Returns nullptr when the fast path does not apply.
+ */
+std::unique_ptr<ValueBlock> decompressToHomogeneousBlock(BSONBinData binData,
+                                                         TypeTags tag,
+                                                         size_t count) {
+    switch (tag) {
+        case TypeTags::NumberInt32:
+            return decompressToHomogeneousBlock<int32_t, TypeTags::NumberInt32>(binData, count);
+        case TypeTags::NumberInt64:
+            return decompressToHomogeneousBlock<int64_t, TypeTags::NumberInt64>(binData, count);
+        case TypeTags::NumberDouble:
+            return decompressToHomogeneousBlock<double, TypeTags::NumberDouble>(binData, count);
+        case TypeTags::Date:
+            return decompressToHomogeneousBlock<Date_t, TypeTags::Date>(binData, count);
+        default:
+            return nullptr;
+    }
+}
 }  // namespace
 
 TsBucketPathExtractor::TsBucketPathExtractor(std::vector<CellBlock::PathRequest> pathReqs,
@@ -398,6 +576,15 @@ void TsBlock::deblockFromBsonObj() {
 void TsBlock::deblockFromBsonColumn() {
     const auto binData = getBinData();
 
+    // Numeric and date columns skip the per-element SBE materialization when every value turns
+    // out to be of the control min/max type.
+    if (_blockBasedDecompressionEnabled && hasNoObjsOrArrays()) {
+        if (auto block = decompressToHomogeneousBlock(binData, _controlMin.first, _count)) {
+            _decompressedBlock = std::move(block);
+            return;
+        }
+    }
+
     std::vector<TypeTags> tags;
     std::vector<Value> vals;
     tags.reserve(_count);
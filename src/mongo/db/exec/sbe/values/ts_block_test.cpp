@@ -69,7 +69,9 @@ int getBucketVersion(const BSONObj& bucket) {
         timeseries::kBucketControlVersionFieldName);
 }
 
-std::unique_ptr<value::TsBlock> makeTsBlockFromBucket(const BSONObj& bucket, StringData fieldName) {
+std::unique_ptr<value::TsBlock> makeTsBlockFromBucket(const BSONObj& bucket,
+                                                      StringData fieldName,
+                                                      bool blockBasedDecompressionEnabled = false) {
     auto bucketElem = bucket["data"][fieldName];
     const auto nFields = [&bucket]() -> size_t {
         // Use a dense field.
@@ -104,7 +106,7 @@ std::unique_ptr<value::TsBlock> makeTsBlockFromBucket(const BSONObj& bucket, Str
                                             // isTimefield: this check is only safe for the tests
                                             // here where the time field is called 'time'.
                                             fieldName == "time",
-                                            false, /* blockBasedDecompressionEnabled */
+                                            blockBasedDecompressionEnabled,
                                             min,
                                             max);
 }
@@ -608,4 +610,25 @@ TEST_F(SbeValueTest, FillType) {
         }
     }
 }
+
+TEST_F(SbeValueTest, BlockBasedDecompressionMatchesIterativeDecompression) {
+    auto compressedBucketOpt =
+        timeseries::compressBucket(kBucketWithMixedNumbers, "time"_sd, {}, false).compressedBucket;
+    ASSERT(compressedBucketOpt) << "Should have been able to create compressed v2 bucket";
+    auto compressedBucket = *compressedBucketOpt;
+
+    // "time" and "_id" hold a single type and decompress straight into homogeneous blocks, "num"
+    // mixes integer widths and falls back to the generic decoder.
+    for (auto fieldName : {"time"_sd, "_id"_sd, "num"_sd}) {
+        auto iterative = makeTsBlockFromBucket(compressedBucket, fieldName);
+        auto blockBased = makeTsBlockFromBucket(compressedBucket, fieldName, true);
+
+        auto expected = iterative->extract();
+        auto actual = blockBased->extract();
+        ASSERT_EQ(expected.count(), actual.count()) << fieldName;
+        for (size_t i = 0; i < expected.count(); ++i) {
+            ASSERT_THAT(actual[i], ValueEq(expected[i])) << fieldName << " at index " << i;
+        }
+    }
+}
 }  // namespace mongo::sbe
@@ -28,6 +28,7 @@
  */
 
 #include <limits>
+#include <type_traits>
 
 #include "mongo/bson/bsonelement.h"
 #include "mongo/bson/bsonobjbuilder.h"
@@ -139,6 +140,19 @@ void ByteCode::produceBsonObject(const MakeObjSpec* spec,
     size_t valueArgsLeft = numValueArgs;
     size_t mandatoryLamsAndMakeObjsVisited = 0;
 
+    // When the input is a BSON object, consecutive kept fields are not appended one at a time.
+    // Instead we remember the byte range that they span in the input and copy the whole range to
+    // 'bob' with a single memcpy when a field that is not kept is reached.
+    constexpr bool kCopyKeptRuns = std::is_same_v<CursorT, BsonObjCursor>;
+    const char* keptRunBegin = nullptr;
+    const char* keptRunEnd = nullptr;
+    auto flushKeptRun = [&]() {
+        if (keptRunBegin) {
+            bob.bb().appendBuf(keptRunBegin, keptRunEnd - keptRunBegin);
+            keptRunBegin = nullptr;
+        }
+    };
+
     // If 'isClosed' is false, loop over the input object until 'fieldsLeft == 0' is true. If
     // 'isClosed' is true, loop over the input object until 'fieldsLeft == 0' is true or until
     // 'fieldsLeft == 1 && valueArgsLeft == 1' is true.
@@ -148,14 +162,25 @@ void ByteCode::produceBsonObject(const MakeObjSpec* spec,
         auto fieldIdx = cursor.fieldIdx();
         auto t = fieldIdx != StringListSet::npos ? actions[fieldIdx].type() : defActionType;
 
-        if (t == MakeObjSpec::ActionType::kDrop) {
-            fieldsLeft -= static_cast<uint8_t>(!isClosed);
+        if (t == MakeObjSpec::ActionType::kKeep) {
+            fieldsLeft -= static_cast<uint8_t>(isClosed);
+            if constexpr (kCopyKeptRuns) {
+                if (!keptRunBegin) {
+                    keptRunBegin = cursor.rawBegin();
+                }
+                keptRunEnd = cursor.rawEnd();
+            } else {
+                cursor.appendTo(bob);
+            }
             continue;
         }
 
-        if (t == MakeObjSpec::ActionType::kKeep) {
-            fieldsLeft -= static_cast<uint8_t>(isClosed);
-            cursor.appendTo(bob);
+        if constexpr (kCopyKeptRuns) {
+            flushKeptRun();
+        }
+
+        if (t == MakeObjSpec::ActionType::kDrop) {
+            fieldsLeft -= static_cast<uint8_t>(!isClosed);
             continue;
         }
 
@@ -218,11 +243,19 @@ void ByteCode::produceBsonObject(const MakeObjSpec* spec,
         }
     }
 
+    if constexpr (kCopyKeptRuns) {
+        flushKeptRun();
+    }
+
     // If 'isClosed' is false and 'cursor' has not reached the end of the input object, copy over
     // the remaining fields from the input object to the output object.
     if (!isClosed) {
-        for (; !cursor.atEnd(); cursor.moveNext(fields)) {
-            cursor.appendTo(bob);
+        if constexpr (kCopyKeptRuns) {
+            cursor.appendRemainingTo(bob);
+        } else {
+            for (; !cursor.atEnd(); cursor.moveNext(fields)) {
+                cursor.appendTo(bob);
+            }
         }
     }
 
@@ -98,6 +98,23 @@ public:
         bob.append(bsonElement());
     }
 
+    // Returns pointers to the beginning and to the end of the current field's raw BSON bytes.
+    // Fields that are consecutive in the input object are contiguous in memory, so a run of kept
+    // fields can be copied to the output with a single memcpy.
+    MONGO_COMPILER_ALWAYS_INLINE const char* rawBegin() const {
+        return _be;
+    }
+    MONGO_COMPILER_ALWAYS_INLINE const char* rawEnd() const {
+        return _nextBe;
+    }
+
+    // Appends the current field and all the fields after it to 'bob' with a single memcpy, and
+    // then moves the cursor to the end of the input object.
+    MONGO_COMPILER_ALWAYS_INLINE void appendRemainingTo(UniqueBSONObjBuilder& bob) {
+        bob.bb().appendBuf(_be, _last - _be);
+        _be = _last;
+    }
+
 private:
     MONGO_COMPILER_ALWAYS_INLINE BSONElement bsonElement() const {
         auto fieldNameLenWithNull = _name.size() + 1;
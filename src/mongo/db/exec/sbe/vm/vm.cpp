@@ -85,6 +85,7 @@
 #include "mongo/db/hasher.h"
 #include "mongo/db/index/btree_key_generator.h"
 #include "mongo/db/matcher/in_list_data.h"
+#include "mongo/db/pipeline/percentile_algo.h"
 #include "mongo/db/query/collation/collation_index_key.h"
 #include "mongo/db/query/datetime/date_time_support.h"
 #include "mongo/db/query/query_knobs_gen.h"
@@ -158,6 +159,7 @@ int Instruction::stackOffset[Instruction::Tags::lastInstruction] = {
     0,   // fillEmptyImm
     -1,  // getField
     0,   // getFieldImm
+    0,   // getFieldFillEmptyImm
     -1,  // getElement
     -1,  // collComparisonKey
     -1,  // getFieldOrElement
@@ -788,6 +790,29 @@ void CodeFragment::appendGetField(Instruction::Parameter input, StringData field
     adjustStackSimple(i, input);
 }
 
+void CodeFragment::appendGetFieldFillEmpty(Instruction::Parameter input,
+                                           StringData fieldName,
+                                           Instruction::Constants k) {
+    auto size = fieldName.size();
+    invariant(size < Instruction::kMaxInlineStringSize);
+
+    Instruction i;
+    i.tag = Instruction::getFieldFillEmptyImm;
+
+    auto offset =
+        allocateSpace(sizeof(Instruction) + input.size() + sizeof(k) + sizeof(uint8_t) + size);
+
+    offset += writeToMemory(offset, i);
+    offset += appendParameters(offset, input);
+    offset += writeToMemory(offset, k);
+    offset += writeToMemory(offset, static_cast<uint8_t>(size));
+    for (auto ch : fieldName) {
+        offset += writeToMemory(offset, ch);
+    }
+
+    adjustStackSimple(i, input);
+}
+
 void CodeFragment::appendGetElement(Instruction::Parameter lhs, Instruction::Parameter rhs) {
     appendSimpleInstruction(Instruction::getElement, lhs, rhs);
 }
@@ -8477,6 +8502,115 @@ FastTuple<bool, value::TypeTags, value::Value> ByteCode::builtinAggRemovablePush
     return {true, resultTag, resultVal};
 }
 
+namespace {
+/**
+ * The state of the removable $percentile and $median window functions is an array holding every
+ * numeric input in the window as a double, in ascending order. NaN is ordered before all other
+ * values, as in the MQL sort order, so that the order stays well-defined.
+ */
+bool percentileStateLess(const std::pair<value::TypeTags, value::Value>& elem, double input) {
+    auto elemVal = value::bitcastTo<double>(elem.second);
+    return std::isnan(elemVal) ? !std::isnan(input) : elemVal < input;
+}
+
+value::Array* percentileState(value::TypeTags stateTag, value::Value stateVal) {
+    uassert(9156640, "State should be of array type", stateTag == value::TypeTags::Array);
+    return value::getArrayView(stateVal);
+}
+
+/**
+ * Returns the value at the given percentile of a non-empty state, using the same rank as the
+ * classic removable window functions.
+ */
+double percentileStateValueAt(const value::Array* state, double p) {
+    auto rank = PercentileAlgorithm::computeTrueRank(static_cast<int>(state->size()), p);
+    return value::bitcastTo<double>(state->getAt(rank).second);
+}
+}  // namespace
+
+FastTuple<bool, value::TypeTags, value::Value> ByteCode::builtinAggRemovablePercentileAdd(
+    ArityType arity) {
+    auto [stateTag, stateVal] = moveOwnedFromStack(0);
+    if (stateTag == value::TypeTags::Nothing) {
+        std::tie(stateTag, stateVal) = value::makeNewArray();
+    }
+    value::ValueGuard stateGuard{stateTag, stateVal};
+    auto state = percentileState(stateTag, stateVal);
+
+    // Only numeric values are tracked.
+    auto [inputOwned, inputTag, inputVal] = getFromStack(1);
+    if (value::isNumber(inputTag)) {
+        auto input = value::bitcastTo<double>(value::coerceToDouble(inputTag, inputVal).second);
+        auto& values = state->values();
+        auto pos = std::lower_bound(values.begin(), values.end(), input, percentileStateLess);
+        values.insert(pos, {value::TypeTags::NumberDouble, value::bitcastFrom<double>(input)});
+    }
+
+    stateGuard.reset();
+    return {true, stateTag, stateVal};
+}
+
+FastTuple<bool, value::TypeTags, value::Value> ByteCode::builtinAggRemovablePercentileRemove(
+    ArityType arity) {
+    auto [stateTag, stateVal] = moveOwnedFromStack(0);
+    value::ValueGuard stateGuard{stateTag, stateVal};
+    auto state = percentileState(stateTag, stateVal);
+
+    // Only numeric values were added, so only numeric values need to be removed.
+    auto [inputOwned, inputTag, inputVal] = getFromStack(1);
+    if (value::isNumber(inputTag)) {
+        auto input = value::bitcastTo<double>(value::coerceToDouble(inputTag, inputVal).second);
+        auto& values = state->values();
+        auto pos = std::lower_bound(values.begin(), values.end(), input, percentileStateLess);
+        tassert(9156641,
+                "Cannot remove a value not tracked by the removable $percentile state",
+                pos != values.end() &&
+                    (std::isnan(input) ? std::isnan(value::bitcastTo<double>(pos->second))
+                                       : value::bitcastTo<double>(pos->second) == input));
+        values.erase(pos);
+    }
+
+    stateGuard.reset();
+    return {true, stateTag, stateVal};
+}
+
+FastTuple<bool, value::TypeTags, value::Value> ByteCode::builtinAggRemovablePercentileFinalize(
+    ArityType arity) {
+    auto [stateOwned, stateTag, stateVal] = getFromStack(0);
+    auto state = percentileState(stateTag, stateVal);
+
+    auto [psOwned, psTag, psVal] = getFromStack(1);
+    uassert(9156642, "Percentiles should be of array type", psTag == value::TypeTags::Array);
+    auto ps = value::getArrayView(psVal);
+
+    auto [resultTag, resultVal] = value::makeNewArray();
+    auto result = value::getArrayView(resultVal);
+    result->reserve(ps->size());
+    for (size_t i = 0; i < ps->size(); ++i) {
+        if (state->size() == 0) {
+            result->push_back(value::TypeTags::Null, 0);
+        } else {
+            auto p = value::numericCast<double>(ps->getAt(i).first, ps->getAt(i).second);
+            result->push_back(value::TypeTags::NumberDouble,
+                              value::bitcastFrom<double>(percentileStateValueAt(state, p)));
+        }
+    }
+    return {true, resultTag, resultVal};
+}
+
+FastTuple<bool, value::TypeTags, value::Value> ByteCode::builtinAggRemovableMedianFinalize(
+    ArityType arity) {
+    auto [stateOwned, stateTag, stateVal] = getFromStack(0);
+    auto state = percentileState(stateTag, stateVal);
+
+    if (state->size() == 0) {
+        return {false, value::TypeTags::Null, 0};
+    }
+    return {false,
+            value::TypeTags::NumberDouble,
+            value::bitcastFrom<double>(percentileStateValueAt(state, 0.5))};
+}
+
 std::tuple<value::Array*, value::Array*, value::Array*, int64_t, int64_t> removableStdDevState(
     value::TypeTags stateTag, value::Value stateVal) {
     uassert(8019600, "state should be of array type", stateTag == value::TypeTags::Array);
@@ -9814,6 +9948,14 @@ FastTuple<bool, value::TypeTags, value::Value> ByteCode::dispatchBuiltin(Builtin
             return builtinAggRemovableTopBottomNFinalize<TopBottomSense::kTop>(arity);
         case Builtin::aggRemovableBottomNFinalize:
             return builtinAggRemovableTopBottomNFinalize<TopBottomSense::kBottom>(arity);
+        case Builtin::aggRemovablePercentileAdd:
+            return builtinAggRemovablePercentileAdd(arity);
+        case Builtin::aggRemovablePercentileRemove:
+            return builtinAggRemovablePercentileRemove(arity);
+        case Builtin::aggRemovablePercentileFinalize:
+            return builtinAggRemovablePercentileFinalize(arity);
+        case Builtin::aggRemovableMedianFinalize:
+            return builtinAggRemovableMedianFinalize(arity);
         case Builtin::aggLinearFillCanAdd:
             return builtinAggLinearFillCanAdd(arity);
         case Builtin::aggLinearFillAdd:
@@ -10362,6 +10504,14 @@ std::string builtinToString(Builtin b) {
             return "aggRemovableBottomNRemove";
         case Builtin::aggRemovableBottomNFinalize:
             return "aggRemovableBottomNFinalize";
+        case Builtin::aggRemovablePercentileAdd:
+            return "aggRemovablePercentileAdd";
+        case Builtin::aggRemovablePercentileRemove:
+            return "aggRemovablePercentileRemove";
+        case Builtin::aggRemovablePercentileFinalize:
+            return "aggRemovablePercentileFinalize";
+        case Builtin::aggRemovableMedianFinalize:
+            return "aggRemovableMedianFinalize";
         case Builtin::valueBlockTypeMatch:
             return "valueBlockTypeMatch";
         case Builtin::valueBlockIsTimezone:
@@ -11080,6 +11230,52 @@ void ByteCode::runInternal(const CodeFragment* code, int64_t position) {
                 pushStack(owned, tag, val);
                 break;
             }
+            case Instruction::getFieldFillEmptyImm: {
+                auto [popLhs, moveFromLhs, offsetLhs] = decodeParam(pcPointer);
+                auto k = readFromMemory<Instruction::Constants>(pcPointer);
+                pcPointer += sizeof(k);
+                auto size = readFromMemory<uint8_t>(pcPointer);
+                pcPointer += sizeof(size);
+                StringData fieldName(reinterpret_cast<const char*>(pcPointer), size);
+                pcPointer += size;
+
+                auto [lhsOwned, lhsTag, lhsVal] = getFromStack(offsetLhs, popLhs);
+                value::ValueGuard lhsGuard(lhsOwned && popLhs, lhsTag, lhsVal);
+
+                auto [owned, tag, val] = getField(lhsTag, lhsVal, fieldName);
+
+                if (tag == value::TypeTags::Nothing) {
+                    switch (k) {
+                        case Instruction::Nothing:
+                            break;
+                        case Instruction::Null:
+                            tag = value::TypeTags::Null;
+                            val = 0;
+                            break;
+                        case Instruction::True:
+                            tag = value::TypeTags::Boolean;
+                            val = value::bitcastFrom<bool>(true);
+                            break;
+                        case Instruction::False:
+                            tag = value::TypeTags::Boolean;
+                            val = value::bitcastFrom<bool>(false);
+                            break;
+                        case Instruction::Int32One:
+                            tag = value::TypeTags::NumberInt32;
+                            val = value::bitcastFrom<int32_t>(1);
+                            break;
+                        default:
+                            MONGO_UNREACHABLE;
+                    }
+                } else if (lhsOwned && !owned) {
+                    // Copy value only if needed
+                    owned = true;
+                    std::tie(tag, val) = value::copyValue(tag, val);
+                }
+
+                pushStack(owned, tag, val);
+                break;
+            }
             case Instruction::getElement: {
                 auto [popLhs, moveFromLhs, offsetLhs] = decodeParam(pcPointer);
                 auto [popRhs, moveFromRhs, offsetRhs] = decodeParam(pcPointer);
@@ -149,6 +149,8 @@ struct Instruction {
         fillEmptyImm,
         getField,
         getFieldImm,
+        // Fused 'getFieldImm' + 'fillEmptyImm', emitted for 'fillEmpty(getField(x, "f"), k)'.
+        getFieldFillEmptyImm,
         getElement,
         collComparisonKey,
         getFieldOrElement,
@@ -355,6 +357,8 @@ struct Instruction {
                 return "getField";
             case getFieldImm:
                 return "getFieldImm";
+            case getFieldFillEmptyImm:
+                return "getFieldFillEmptyImm";
             case getElement:
                 return "getElement";
             case collComparisonKey:
@@ -718,6 +722,10 @@ enum class Builtin : uint16_t {
     aggRemovableBottomNAdd,
     aggRemovableBottomNRemove,
     aggRemovableBottomNFinalize,
+    aggRemovablePercentileAdd,
+    aggRemovablePercentileRemove,
+    aggRemovablePercentileFinalize,
+    aggRemovableMedianFinalize,
 
     // Additional one-byte builtins go here.
 
@@ -1131,6 +1139,9 @@ public:
     void appendFillEmpty(Instruction::Constants k);
     void appendGetField(Instruction::Parameter lhs, Instruction::Parameter rhs);
     void appendGetField(Instruction::Parameter input, StringData fieldName);
+    void appendGetFieldFillEmpty(Instruction::Parameter input,
+                                 StringData fieldName,
+                                 Instruction::Constants k);
     void appendGetElement(Instruction::Parameter lhs, Instruction::Parameter rhs);
     void appendCollComparisonKey(Instruction::Parameter lhs, Instruction::Parameter rhs);
     void appendGetFieldOrElement(Instruction::Parameter lhs, Instruction::Parameter rhs);
@@ -1996,6 +2007,14 @@ private:
     FastTuple<bool, value::TypeTags, value::Value> builtinAggRemovablePushAdd(ArityType arity);
     FastTuple<bool, value::TypeTags, value::Value> builtinAggRemovablePushRemove(ArityType arity);
     FastTuple<bool, value::TypeTags, value::Value> builtinAggRemovablePushFinalize(ArityType arity);
+    FastTuple<bool, value::TypeTags, value::Value> builtinAggRemovablePercentileAdd(
+        ArityType arity);
+    FastTuple<bool, value::TypeTags, value::Value> builtinAggRemovablePercentileRemove(
+        ArityType arity);
+    FastTuple<bool, value::TypeTags, value::Value> builtinAggRemovablePercentileFinalize(
+        ArityType arity);
+    FastTuple<bool, value::TypeTags, value::Value> builtinAggRemovableMedianFinalize(
+        ArityType arity);
     template <int quantity>
     void aggRemovableStdDevImpl(value::TypeTags stateTag,
                                 value::Value stateVal,
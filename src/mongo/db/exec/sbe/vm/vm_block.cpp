@@ -41,6 +41,7 @@
 #include "mongo/db/exec/sbe/values/value_printer.h"
 #include "mongo/db/matcher/in_list_data.h"
 #include "mongo/logv2/log.h"
+#include "mongo/platform/overflow_arithmetic.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/represent_as.h"
 
@@ -503,6 +504,83 @@ FastTuple<bool, value::TypeTags, value::Value> ByteCode::builtinValueBlockAggCou
     return {true, value::TypeTags::NumberInt64, value::bitcastFrom<int64_t>(n + count)};
 }
 
+namespace {
+/**
+ * Sums the values of a dense, single-typed numeric block where 'bitset' is true using native
+ * arithmetic. The result is identical to folding the selected values with genericAdd(), including
+ * the widening from int32 to int64. Returns boost::none when the block doesn't qualify or an int64
+ * sum overflows, in which case the caller must fall back to the generic path.
+ */
+boost::optional<std::pair<value::TypeTags, value::Value>> homogeneousBlockSum(
+    const value::DeblockedTagVals& block, const value::DeblockedTagVals& bitset) {
+    if (!block.isDense()) {
+        return boost::none;
+    }
+
+    const value::Value* vals = block.vals();
+    const value::Value* selected = bitset.vals();
+    bool hasSelected = false;
+
+    switch (block.tag()) {
+        case value::TypeTags::NumberInt32: {
+            // Block sizes are far too small for a sum of int32 values to overflow int64. We only
+            // need to remember whether any partial sum left the int32 range, as genericAdd() would
+            // have switched to int64 at that point.
+            int64_t sum = 0;
+            bool widened = false;
+            for (size_t i = 0; i < block.count(); ++i) {
+                if (value::bitcastTo<bool>(selected[i])) {
+                    sum += value::bitcastTo<int32_t>(vals[i]);
+                    widened |= sum != static_cast<int32_t>(sum);
+                    hasSelected = true;
+                }
+            }
+            if (!hasSelected) {
+                return std::pair{value::TypeTags::Nothing, value::Value{0u}};
+            }
+            if (widened) {
+                return std::pair{value::TypeTags::NumberInt64, value::bitcastFrom<int64_t>(sum)};
+            }
+            return std::pair{value::TypeTags::NumberInt32,
+                             value::bitcastFrom<int32_t>(static_cast<int32_t>(sum))};
+        }
+        case value::TypeTags::NumberInt64: {
+            int64_t sum = 0;
+            for (size_t i = 0; i < block.count(); ++i) {
+                if (value::bitcastTo<bool>(selected[i])) {
+                    if (overflow::add(sum, value::bitcastTo<int64_t>(vals[i]), &sum)) {
+                        return boost::none;
+                    }
+                    hasSelected = true;
+                }
+            }
+            if (!hasSelected) {
+                return std::pair{value::TypeTags::Nothing, value::Value{0u}};
+            }
+            return std::pair{value::TypeTags::NumberInt64, value::bitcastFrom<int64_t>(sum)};
+        }
+        case value::TypeTags::NumberDouble: {
+            // Seed with the first selected value rather than 0.0 so that a sum of negative zeros
+            // stays negative, as it does with genericAdd().
+            double sum = 0;
+            for (size_t i = 0; i < block.count(); ++i) {
+                if (value::bitcastTo<bool>(selected[i])) {
+                    auto val = value::bitcastTo<double>(vals[i]);
+                    sum = hasSelected ? sum + val : val;
+                    hasSelected = true;
+                }
+            }
+            if (!hasSelected) {
+                return std::pair{value::TypeTags::Nothing, value::Value{0u}};
+            }
+            return std::pair{value::TypeTags::NumberDouble, value::bitcastFrom<double>(sum)};
+        }
+        default:
+            return boost::none;
+    }
+}
+}  // namespace
+
 /*
  * Given a ValueBlock and bitset, returns the sum of the elements of the ValueBlock where the bitset
  * indicates true. If all elements of the bitset are false, return Nothing. If there are non-Nothing
@@ -539,24 +617,28 @@ FastTuple<bool, value::TypeTags, value::Value> ByteCode::builtinValueBlockAggSum
 
     value::TypeTags blockResTag = value::TypeTags::Nothing;
     value::Value blockResVal = 0;
-    for (size_t i = 0; i < bitset.count(); ++i) {
-        if (value::bitcastTo<bool>(bitset[i].second) && value::isNumber(block.tags()[i])) {
-            // If 'blockRes' is Nothing, set 'blockRes' equal to 'block[i]'. Otherwise, compute the
-            // sum of 'blockRes' and 'block[i]' and store the result back into 'blockRes'.
-            if (blockResTag == value::TypeTags::Nothing) {
-                std::tie(blockResTag, blockResVal) =
-                    value::copyValue(block.tags()[i], block.vals()[i]);
-            } else {
-                value::ValueGuard curBlockResGuard{blockResTag, blockResVal};
+    if (auto nativeSum = homogeneousBlockSum(block, bitset)) {
+        std::tie(blockResTag, blockResVal) = *nativeSum;
+    } else {
+        for (size_t i = 0; i < bitset.count(); ++i) {
+            if (value::bitcastTo<bool>(bitset[i].second) && value::isNumber(block.tags()[i])) {
+                // If 'blockRes' is Nothing, set 'blockRes' equal to 'block[i]'. Otherwise, compute
+                // the sum of 'blockRes' and 'block[i]' and store the result back into 'blockRes'.
+                if (blockResTag == value::TypeTags::Nothing) {
+                    std::tie(blockResTag, blockResVal) =
+                        value::copyValue(block.tags()[i], block.vals()[i]);
+                } else {
+                    value::ValueGuard curBlockResGuard{blockResTag, blockResVal};
 
-                auto [sumOwned, sumTag, sumVal] =
-                    genericAdd(blockResTag, blockResVal, block.tags()[i], block.vals()[i]);
+                    auto [sumOwned, sumTag, sumVal] =
+                        genericAdd(blockResTag, blockResVal, block.tags()[i], block.vals()[i]);
 
-                if (!sumOwned) {
-                    std::tie(sumTag, sumVal) = value::copyValue(sumTag, sumVal);
-                }
+                    if (!sumOwned) {
+                        std::tie(sumTag, sumVal) = value::copyValue(sumTag, sumVal);
+                    }
 
-                std::tie(blockResTag, blockResVal) = std::pair(sumTag, sumVal);
+                    std::tie(blockResTag, blockResVal) = std::pair(sumTag, sumVal);
+                }
             }
         }
     }
@@ -677,7 +759,7 @@ size_t homogeneousTopBottomHelper(bool isAscending,
         // All values in the bitset were false, so we don't need to update the state.
         return bitsetVals.size();
     }
-    auto keyLess = HomogeneousSortPattern<Less, int64_t>(isAscending);
+    auto keyLess = HomogeneousSortPattern<Less, T>(isAscending);
     size_t bestIdx = firstPresent;
     for (size_t i = firstPresent; i < keyVals.size(); ++i) {
         if (value::bitcastTo<bool>(bitsetVals[i]) && keyLess(keyVals[bestIdx], keyVals[i])) {
@@ -311,6 +311,22 @@ public:
                        << ", offsetParam: " << offsetParam << ", value: \"" << fieldName << "\"";
                     break;
                 }
+                case Instruction::getFieldFillEmptyImm: {
+                    auto [popParam, moveFromParam, offsetParam] =
+                        Instruction::Parameter::decodeParam(pcPointer);
+                    auto k = readFromMemory<Instruction::Constants>(pcPointer);
+                    pcPointer += sizeof(k);
+                    auto size = readFromMemory<uint8_t>(pcPointer);
+                    pcPointer += sizeof(size);
+                    StringData fieldName(reinterpret_cast<const char*>(pcPointer), size);
+                    pcPointer += size;
+
+                    os << "popParam: " << popParam << ", moveFromParam: " << moveFromParam
+                       << ", offsetParam: " << offsetParam << ", k: "
+                       << Instruction::toStringConstants(k) << ", value: \"" << fieldName
+                       << "\"";
+                    break;
+                }
                 case Instruction::pushConstVal: {
                     auto tag = readFromMemory<value::TypeTags>(pcPointer);
                     pcPointer += sizeof(tag);
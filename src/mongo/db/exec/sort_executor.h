@@ -41,6 +41,7 @@
 #include "mongo/db/exec/sort_key_comparator.h"
 #include "mongo/db/exec/working_set.h"
 #include "mongo/db/pipeline/expression.h"
+#include "mongo/db/query/query_knobs_gen.h"
 #include "mongo/db/query/sort_pattern.h"
 #include "mongo/db/sorter/sorter.h"
 #include "mongo/db/sorter/sorter_stats.h"
@@ -62,13 +63,24 @@ public:
     using DocumentSorter = Sorter<Value, T>;
     class Comparator {
     public:
-        Comparator(const SortPattern& sortPattern) : _sortKeyComparator(sortPattern) {}
+        Comparator(const SortPattern& sortPattern)
+            : _sortKeyComparator(sortPattern),
+              _normalizeKeys(internalQueryEnableNormalizedSortKeys.load()) {}
         int operator()(const Value& lhs, const Value& rhs) const {
             return _sortKeyComparator(lhs, rhs);
         }
 
+        /**
+         * Lets the Sorter sort in-memory data by memcmp on KeyString-encoded sort keys. Returns
+         * false if this is disabled or 'key' cannot be encoded.
+         */
+        bool appendNormalizedKey(const Value& key, std::string* out) const {
+            return _normalizeKeys && _sortKeyComparator.appendNormalizedKey(key, out);
+        }
+
     private:
         SortKeyComparator _sortKeyComparator;
+        bool _normalizeKeys;
     };
 
     /**
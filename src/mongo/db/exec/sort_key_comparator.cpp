@@ -34,10 +34,69 @@
 #include <iterator>
 
 #include "mongo/bson/bsonelement.h"
+#include "mongo/bson/bsonmisc.h"
+#include "mongo/bson/bsonobjbuilder.h"
 #include "mongo/db/exec/document_value/value_comparator.h"
+#include "mongo/db/storage/key_string.h"
 
 namespace mongo {
 
+namespace {
+
+const BSONObj kMinKeyObj = BSON("" << MINKEY);
+const BSONObj kMaxKeyObj = BSON("" << MAXKEY);
+
+/**
+ * Appends 'value' to 'builder' if its KeyString encoding orders the same way as ValueComparator,
+ * otherwise returns false.
+ */
+bool appendScalar(const Value& value, key_string::Builder* builder) {
+    switch (value.getType()) {
+        case NumberInt:
+            builder->appendNumberInt(value.getInt());
+            return true;
+        case NumberLong:
+            builder->appendNumberLong(value.getLong());
+            return true;
+        case NumberDouble:
+            builder->appendNumberDouble(value.getDouble());
+            return true;
+        case NumberDecimal:
+            builder->appendNumberDecimal(value.getDecimal());
+            return true;
+        case String:
+            builder->appendString(value.getStringData());
+            return true;
+        case Bool:
+            builder->appendBool(value.getBool());
+            return true;
+        case Date:
+            builder->appendDate(value.getDate());
+            return true;
+        case jstOID:
+            builder->appendOID(value.getOid());
+            return true;
+        case bsonTimestamp:
+            builder->appendTimestamp(value.getTimestamp());
+            return true;
+        case jstNULL:
+            builder->appendNull();
+            return true;
+        case MinKey:
+            builder->appendBSONElement(kMinKeyObj.firstElement());
+            return true;
+        case MaxKey:
+            builder->appendBSONElement(kMaxKeyObj.firstElement());
+            return true;
+        default:
+            // Missing and undefined values, arrays, objects and the rarer BSON types are left to
+            // the regular comparator.
+            return false;
+    }
+}
+
+}  // namespace
+
 SortKeyComparator::SortKeyComparator(const SortPattern& sortPattern) {
     _pattern.reserve(sortPattern.size());
     std::transform(sortPattern.begin(),
@@ -47,6 +106,7 @@ SortKeyComparator::SortKeyComparator(const SortPattern& sortPattern) {
                        return part.isAscending ? SortDirection::kAscending
                                                : SortDirection::kDescending;
                    });
+    initOrdering();
 }
 
 int SortKeyComparator::operator()(const Value& lhsKey, const Value& rhsKey) const {
@@ -87,6 +147,46 @@ SortKeyComparator::SortKeyComparator(const BSONObj& sortPattern) {
                        return (part.number() >= 0) ? SortDirection::kAscending
                                                    : SortDirection::kDescending;
                    });
+    initOrdering();
+}
+
+void SortKeyComparator::initOrdering() {
+    if (_pattern.empty() || _pattern.size() > Ordering::kMaxCompoundIndexKeys) {
+        return;
+    }
+
+    BSONObjBuilder bob;
+    for (size_t i = 0; i < _pattern.size(); ++i) {
+        bob.append(std::to_string(i), _pattern[i] == SortDirection::kAscending ? 1 : -1);
+    }
+    _ordering = Ordering::make(bob.obj());
+}
+
+bool SortKeyComparator::appendNormalizedKey(const Value& key, std::string* out) const {
+    if (!_ordering) {
+        return false;
+    }
+
+    key_string::Builder builder(key_string::Version::kLatestVersion, *_ordering);
+    const size_t n = _pattern.size();
+    if (n == 1) {
+        if (!appendScalar(key, &builder)) {
+            return false;
+        }
+    } else {
+        // A compound sort key is an array holding one value per component.
+        if (key.getType() != Array || key.getArrayLength() != n) {
+            return false;
+        }
+        for (size_t i = 0; i < n; ++i) {
+            if (!appendScalar(key[i], &builder)) {
+                return false;
+            }
+        }
+    }
+
+    out->append(builder.getBuffer(), builder.getSize());
+    return true;
 }
 
 }  // namespace mongo
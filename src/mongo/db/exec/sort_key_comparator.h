@@ -29,9 +29,12 @@
 
 #pragma once
 
+#include <boost/optional/optional.hpp>
+#include <string>
 #include <vector>
 
 #include "mongo/bson/bsonobj.h"
+#include "mongo/bson/ordering.h"
 #include "mongo/db/exec/document_value/value.h"
 #include "mongo/db/query/sort_pattern.h"
 
@@ -49,11 +52,26 @@ public:
     SortKeyComparator(const BSONObj& sortPattern);
     int operator()(const Value& lhsKey, const Value& rhsKey) const;
 
+    /**
+     * Appends a KeyString encoding of 'key' to 'out', such that comparing the encodings of two keys
+     * with memcmp agrees with operator(). This lets a sort encode each key once rather than
+     * comparing Values on every comparison. Returns false if 'key' holds a value whose encoding
+     * does not preserve the order, e.g. an array or an object, in which case 'out' may hold a
+     * partial encoding.
+     */
+    bool appendNormalizedKey(const Value& key, std::string* out) const;
+
 private:
+    void initOrdering();
+
     // The comparator does not need the entire sort pattern, just the sort direction for each
     // component.
     enum class SortDirection { kDescending, kAscending };
     std::vector<SortDirection> _pattern;
+
+    // The KeyString ordering matching '_pattern', or none if the pattern has too many components
+    // to be represented by an Ordering.
+    boost::optional<Ordering> _ordering;
 };
 
 }  // namespace mongo
@@ -55,6 +55,7 @@
 #include "mongo/db/service_context.h"
 #include "mongo/db/service_context_d_test_fixture.h"
 #include "mongo/db/storage/snapshot.h"
+#include "mongo/idl/server_parameter_test_util.h"
 #include "mongo/stdx/type_traits.h"
 #include "mongo/unittest/assert.h"
 #include "mongo/unittest/framework.h"
@@ -319,4 +320,66 @@ TEST_F(SortStageDefaultTest, SortDescendingWithCollation) {
              "{input: [{a: 'ba'}, {a: 'aa'}, {a: 'ab'}]}",
              "{output: [{a: 'ab'}, {a: 'ba'}, {a: 'aa'}]}");
 }
+
+//
+// Sorting on normalized (KeyString-encoded) sort keys
+//
+
+TEST_F(SortStageDefaultTest, SortNormalizedKeysMixedNumericTypes) {
+    RAIIServerParameterControllerForTest controller("internalQueryEnableNormalizedSortKeys", true);
+    testWork("{a: 1}",
+             nullptr,
+             0,
+             "{input: [{a: 2.5}, {a: NumberLong(-3)}, {a: null}, {a: NumberDecimal('2.25')}, "
+             "{a: 1}, {a: 'x'}]}",
+             "{output: [{a: null}, {a: NumberLong(-3)}, {a: 1}, {a: NumberDecimal('2.25')}, "
+             "{a: 2.5}, {a: 'x'}]}");
+}
+
+TEST_F(SortStageDefaultTest, SortNormalizedKeysCompoundWithDescendingComponent) {
+    RAIIServerParameterControllerForTest controller("internalQueryEnableNormalizedSortKeys", true);
+    testWork("{a: 1, b: -1}",
+             nullptr,
+             0,
+             "{input: [{a: 'b', b: 1}, {a: 'a', b: 1}, {a: 'ab', b: 2}, {a: 'a', b: 3}]}",
+             "{output: [{a: 'a', b: 3}, {a: 'a', b: 1}, {a: 'ab', b: 2}, {a: 'b', b: 1}]}");
+}
+
+TEST_F(SortStageDefaultTest, SortNormalizedKeysWithCollation) {
+    RAIIServerParameterControllerForTest controller("internalQueryEnableNormalizedSortKeys", true);
+    CollatorInterfaceMock collator(CollatorInterfaceMock::MockType::kReverseString);
+    testWork("{a: 1}",
+             &collator,
+             0,
+             "{input: [{a: 'ba'}, {a: 'aa'}, {a: 'ab'}]}",
+             "{output: [{a: 'aa'}, {a: 'ba'}, {a: 'ab'}]}");
+}
+
+TEST_F(SortStageDefaultTest, SortNormalizedKeysFallsBackForObjects) {
+    RAIIServerParameterControllerForTest controller("internalQueryEnableNormalizedSortKeys", true);
+    testWork("{a: 1}",
+             nullptr,
+             0,
+             "{input: [{a: {c: 2}}, {a: 1}, {a: {c: 1}}]}",
+             "{output: [{a: 1}, {a: {c: 1}}, {a: {c: 2}}]}");
+}
+
+TEST_F(SortStageDefaultTest, SortNormalizedKeysWithLimit) {
+    RAIIServerParameterControllerForTest controller("internalQueryEnableNormalizedSortKeys", true);
+    testWork("{a: -1}",
+             nullptr,
+             2,
+             "{input: [{a: 1}, {a: NumberLong(4)}, {a: 2.5}, {a: 4.5}, {a: NumberDecimal('4.25')}, "
+             "{a: 3}, {a: null}]}",
+             "{output: [{a: 4.5}, {a: NumberDecimal('4.25')}]}");
+}
+
+TEST_F(SortStageDefaultTest, SortNormalizedKeysWithLimitFallsBackForObjects) {
+    RAIIServerParameterControllerForTest controller("internalQueryEnableNormalizedSortKeys", true);
+    testWork("{a: 1}",
+             nullptr,
+             2,
+             "{input: [{a: {c: 2}}, {a: 5}, {a: {c: 1}}, {a: 3}, {a: 'x'}, {a: 1}]}",
+             "{output: [{a: 1}, {a: 3}]}");
+}
 }  // namespace
@@ -59,6 +59,7 @@
 #include "mongo/db/operation_context.h"
 #include "mongo/db/query/plan_executor.h"
 #include "mongo/db/query/plan_executor_impl.h"
+#include "mongo/db/query/query_knobs_gen.h"
 #include "mongo/db/query/stage_types.h"
 #include "mongo/db/repl/replication_coordinator.h"
 #include "mongo/db/s/operation_sharding_state.h"
@@ -69,6 +70,7 @@
 #include "mongo/db/storage/recovery_unit.h"
 #include "mongo/db/storage/write_unit_of_work.h"
 #include "mongo/db/transaction_resources.h"
+#include "mongo/db/update/document_diff_applier.h"
 #include "mongo/db/update/path_support.h"
 #include "mongo/db/update/update_oplog_entry_serialization.h"
 #include "mongo/db/update/update_util.h"
@@ -126,6 +128,35 @@ CollectionUpdateArgs::StoreDocOption getStoreDocMode(const UpdateRequest& update
     return CollectionUpdateArgs::StoreDocOption::None;
 }
 
+/**
+ * Returns true if an update that wasn't applied in place, but produced the delta 'diff', should
+ * still be written to storage as damages to the existing record rather than as a whole new
+ * document. Rewriting a large document to change a few fields is much more expensive for the
+ * storage engine than modifying the changed bytes.
+ */
+bool shouldWriteDiffAsDamages(const CollectionPtr& collection,
+                              const boost::optional<BSONObj>& diff,
+                              const BSONObj& oldObj,
+                              const BSONObj& newObj) {
+    const auto minDocumentSize = internalUpdateDamagesMinDocumentSizeBytes.load();
+    if (!diff || minDocumentSize <= 0 || oldObj.objsize() < minDocumentSize) {
+        return false;
+    }
+
+    // Damages bypass document validation, so this is only allowed when there is no validator.
+    // Capped collections and queryable encryption need checks that only the whole-document write
+    // performs.
+    if (!collection->updateWithDamagesSupported() || collection->isCapped() ||
+        collection->getCollectionOptions().encryptedFieldConfig) {
+        return false;
+    }
+
+    // The diff doesn't capture an _id that was generated or moved to the front of the document, so
+    // only use it when the _id is already the unchanged first field.
+    return oldObj.firstElementFieldNameStringData() == idFieldName &&
+        newObj.firstElement().binaryEqual(oldObj.firstElement());
+}
+
 }  // namespace
 
 // Public constructor.
@@ -134,25 +165,34 @@ UpdateStage::UpdateStage(ExpressionContext* expCtx,
                          WorkingSet* ws,
                          CollectionAcquisition collection,
                          PlanStage* child)
-    : UpdateStage(expCtx, params, ws, collection) {
+    : UpdateStage(kStageType.rawData(), expCtx, params, ws, collection, child) {}
+
+UpdateStage::UpdateStage(const char* stageType,
+                         ExpressionContext* expCtx,
+                         const UpdateStageParams& params,
+                         WorkingSet* ws,
+                         CollectionAcquisition collection,
+                         PlanStage* child)
+    : UpdateStage(stageType, expCtx, params, ws, collection) {
     // We should never reach here if the request is an upsert.
     invariant(!_params.request->isUpsert());
     _children.emplace_back(child);
 }
 
 // Protected constructor.
-UpdateStage::UpdateStage(ExpressionContext* expCtx,
+UpdateStage::UpdateStage(const char* stageType,
+                         ExpressionContext* expCtx,
                          const UpdateStageParams& params,
                          WorkingSet* ws,
                          CollectionAcquisition collection)
-    : RequiresWritableCollectionStage(kStageType.rawData(), expCtx, collection),
+    : RequiresWritableCollectionStage(stageType, expCtx, collection),
       _params(params),
       _ws(ws),
       _doc(params.driver->getDocument()),
-      _idRetrying(WorkingSet::INVALID_ID),
-      _idReturning(WorkingSet::INVALID_ID),
       _updatedRecordIds(params.request->isMulti() ? new RecordIdSet() : nullptr),
-      _preWriteFilter(opCtx(), collection.nss()) {
+      _preWriteFilter(opCtx(), collection.nss()),
+      _idRetrying(WorkingSet::INVALID_ID),
+      _idReturning(WorkingSet::INVALID_ID) {
 
     // Should the modifiers validate their embedded docs via storage_validation::scanDocument()?
     // Only user updates should be checked. Any system or replication stuff should pass through.
@@ -339,16 +379,35 @@ BSONObj UpdateStage::transformAndUpdate(const Snapshotted<BSONObj>& oldObj,
 
                 auto diff = update_oplog_entry::extractDiffFromOplogEntry(logObj);
                 WriteUnitOfWork wunit(opCtx());
-                collection_internal::updateDocument(
-                    opCtx(),
-                    collectionPtr(),
-                    recordId,
-                    oldObj,
-                    newObj,
-                    diff.has_value() ? &*diff : collection_internal::kUpdateAllIndexes,
-                    &indexesAffected,
-                    _params.opDebug,
-                    &args);
+                if (shouldWriteDiffAsDamages(collectionPtr(), diff, oldObjValue, newObj)) {
+                    auto damagesOutput = doc_diff::computeDamages(
+                        oldObjValue, *diff, args.mustCheckExistenceForInsertOperations);
+                    auto damagedObj =
+                        uassertStatusOK(collection_internal::updateDocumentWithDamages(
+                            opCtx(),
+                            collectionPtr(),
+                            recordId,
+                            oldObj,
+                            damagesOutput.damageSource.get(),
+                            damagesOutput.damages,
+                            &*diff,
+                            &indexesAffected,
+                            _params.opDebug,
+                            &args));
+                    dassert(damagedObj.binaryEqual(newObj));
+                    newObj = std::move(damagedObj);
+                } else {
+                    collection_internal::updateDocument(
+                        opCtx(),
+                        collectionPtr(),
+                        recordId,
+                        oldObj,
+                        newObj,
+                        diff.has_value() ? &*diff : collection_internal::kUpdateAllIndexes,
+                        &indexesAffected,
+                        _params.opDebug,
+                        &args);
+                }
                 invariant(oldObj.snapshotId() ==
                           shard_role_details::getRecoveryUnit(opCtx())->getSnapshotId());
                 wunit.commit();
@@ -674,7 +733,7 @@ void UpdateStage::doRestoreStateRequiresCollection() {
 
 std::unique_ptr<PlanStageStats> UpdateStage::getStats() {
     _commonStats.isEOF = isEOF();
-    auto ret = std::make_unique<PlanStageStats>(_commonStats, STAGE_UPDATE);
+    auto ret = std::make_unique<PlanStageStats>(_commonStats, stageType());
     ret->specific = std::make_unique<UpdateStats>(_specificStats);
     ret->children.emplace_back(child()->getStats());
     return ret;
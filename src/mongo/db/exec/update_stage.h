@@ -121,14 +121,21 @@ public:
                 CollectionAcquisition collection,
                 PlanStage* child);
 
+    UpdateStage(const char* stageType,
+                ExpressionContext* expCtx,
+                const UpdateStageParams& params,
+                WorkingSet* ws,
+                CollectionAcquisition collection,
+                PlanStage* child);
+
     bool isEOF() override;
     StageState doWork(WorkingSetID* out) override;
 
-    StageType stageType() const final {
+    StageType stageType() const override {
         return STAGE_UPDATE;
     }
 
-    std::unique_ptr<PlanStageStats> getStats() final;
+    std::unique_ptr<PlanStageStats> getStats() override;
 
     const SpecificStats* getSpecificStats() const final;
 
@@ -137,7 +144,8 @@ public:
     }
 
 protected:
-    UpdateStage(ExpressionContext* expCtx,
+    UpdateStage(const char* stageType,
+                ExpressionContext* expCtx,
                 const UpdateStageParams& params,
                 WorkingSet* ws,
                 CollectionAcquisition collection);
@@ -167,7 +175,6 @@ protected:
     mutablebson::Document& _doc;
     mutablebson::DamageVector _damages;
 
-private:
     /**
      * Computes the result of applying mods to the document 'oldObj' at RecordId 'recordId' in
      * memory, then commits these changes to the database. Returns a possibly unowned copy
@@ -177,6 +184,25 @@ private:
                                RecordId& recordId,
                                bool writeOnOrphan);
 
+    // Guard against the "Halloween Problem": If we're scanning an index {x:1} and performing
+    // {$inc:{x:5}}, we'll keep moving the document forward and it will continue to reappear in our
+    // index scan. Unless the index is multikey, the underlying query machinery won't de-dup so we
+    // keep track of already updated docs in '_updatedRecordIds'.
+    typedef stdx::unordered_set<RecordId, RecordId::Hasher> RecordIdSet;
+    const std::unique_ptr<RecordIdSet> _updatedRecordIds;
+
+    /**
+     * This member is used to check whether the write should be performed, and if so, any other
+     * behavior that should be done as part of the write (e.g. skipping it because it affects an
+     * orphan document). A yield cannot happen between the check and the write, so the checks are
+     * embedded in the stage.
+     *
+     * It's refreshed after yielding and reacquiring the locks.
+     */
+    write_stage_common::PreWriteFilter _preWriteFilter;
+
+private:
+
     /**
      * Stores 'idToRetry' in '_idRetrying' so the update can be retried during the next call to
      * doWork(). Sets 'out' to WorkingSet::INVALID_ID.
@@ -218,23 +244,6 @@ private:
 
     // If not WorkingSet::INVALID_ID, we return this member to our caller.
     WorkingSetID _idReturning;
-
-    // Guard against the "Halloween Problem": If we're scanning an index {x:1} and performing
-    // {$inc:{x:5}}, we'll keep moving the document forward and it will continue to reappear in our
-    // index scan. Unless the index is multikey, the underlying query machinery won't de-dup so we
-    // keep track of already updated docs in '_updatedRecordIds'.
-    typedef stdx::unordered_set<RecordId, RecordId::Hasher> RecordIdSet;
-    const std::unique_ptr<RecordIdSet> _updatedRecordIds;
-
-    /**
-     * This member is used to check whether the write should be performed, and if so, any other
-     * behavior that should be done as part of the write (e.g. skipping it because it affects an
-     * orphan document). A yield cannot happen between the check and the write, so the checks are
-     * embedded in the stage.
-     *
-     * It's refreshed after yielding and reacquiring the locks.
-     */
-    write_stage_common::PreWriteFilter _preWriteFilter;
 };
 
 }  // namespace mongo
@@ -94,7 +94,7 @@ UpsertStage::UpsertStage(ExpressionContext* expCtx,
                          WorkingSet* ws,
                          CollectionAcquisition collection,
                          PlanStage* child)
-    : UpdateStage(expCtx, params, ws, collection) {
+    : UpdateStage(kStageType.rawData(), expCtx, params, ws, collection) {
     // We should never create this stage for a non-upsert request.
     invariant(_params.request->isUpsert());
     _children.emplace_back(child);
@@ -61,41 +61,52 @@ WorkingSet::WorkingSet() : _freeList(INVALID_ID) {}
 
 WorkingSetID WorkingSet::allocate() {
     if (_freeList == INVALID_ID) {
-        // The free list is empty so we need to make a single new WSM to return. This relies on
-        // vector::resize being amortized O(1) for efficient allocation. Note that the free list
+        // The free list is empty so we need to hand out a new WSM. Members are allocated a slab at
+        // a time, so this only allocates once every kSlabSize calls. Note that the free list
         // remains empty until something is returned by a call to free().
-        WorkingSetID id = _data.size();
-        _data.resize(_data.size() + 1);
-        _data.back().nextFreeOrSelf = id;
+        if (_size == _slabs.size() * kSlabSize) {
+            _slabs.push_back(std::make_unique<MemberHolder[]>(kSlabSize));
+        }
+        WorkingSetID id = _size++;
+        holder(id).nextFreeOrSelf = id;
         return id;
     }
 
     // Pop the head off the free list and return it.
     WorkingSetID id = _freeList;
-    _freeList = _data[id].nextFreeOrSelf;
-    _data[id].nextFreeOrSelf = id;  // set to self to mark as in-use
+    _freeList = holder(id).nextFreeOrSelf;
+    holder(id).nextFreeOrSelf = id;  // set to self to mark as in-use
     return id;
 }
 
 void WorkingSet::free(WorkingSetID i) {
-    MemberHolder& holder = _data[i];
-    MONGO_verify(i < _data.size());            // ID has been allocated.
-    MONGO_verify(holder.nextFreeOrSelf == i);  // ID currently in use.
+    MONGO_verify(i < _size);  // ID has been allocated.
+    MemberHolder& memberHolder = holder(i);
+    MONGO_verify(memberHolder.nextFreeOrSelf == i);  // ID currently in use.
 
     // Free resources and push this WSM to the head of the freelist.
-    holder.member.clear();
-    holder.nextFreeOrSelf = _freeList;
+    memberHolder.member.clear();
+    memberHolder.nextFreeOrSelf = _freeList;
     _freeList = i;
 }
 
 void WorkingSet::clear() {
-    _data.clear();
+    _slabs.clear();
+    _size = 0;
 
     // Since working set is now empty, the free list pointer should
     // point to nothing.
     _freeList = INVALID_ID;
 }
 
+void WorkingSet::releaseFreeMembers() {
+    for (WorkingSetID id = _freeList; id != INVALID_ID; id = holder(id).nextFreeOrSelf) {
+        WorkingSetMember& member = holder(id).member;
+        member.doc = {};
+        member.keyData = {};
+    }
+}
+
 void WorkingSet::transitionToRecordIdAndIdx(WorkingSetID id) {
     WorkingSetMember* member = get(id);
     member->_state = WorkingSetMember::RID_AND_IDX;
@@ -112,8 +123,8 @@ void WorkingSet::transitionToOwnedObj(WorkingSetID id) {
 }
 
 WorkingSetMember WorkingSet::extract(WorkingSetID wsid) {
-    invariant(wsid < _data.size());
-    WorkingSetMember ret = std::move(_data[wsid].member);
+    invariant(wsid < _size);
+    WorkingSetMember ret = std::move(holder(wsid).member);
     free(wsid);
     return ret;
 }
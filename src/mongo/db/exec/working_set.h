@@ -334,22 +334,22 @@ public:
      * release it.
      */
     WorkingSetMember* get(WorkingSetID i) {
-        dassert(i < _data.size());              // ID has been allocated.
-        dassert(_data[i].nextFreeOrSelf == i);  // ID currently in use.
-        return &_data[i].member;
+        dassert(i < _size);                      // ID has been allocated.
+        dassert(holder(i).nextFreeOrSelf == i);  // ID currently in use.
+        return &holder(i).member;
     }
 
     const WorkingSetMember* get(WorkingSetID i) const {
-        dassert(i < _data.size());              // ID has been allocated.
-        dassert(_data[i].nextFreeOrSelf == i);  // ID currently in use.
-        return &_data[i].member;
+        dassert(i < _size);                      // ID has been allocated.
+        dassert(holder(i).nextFreeOrSelf == i);  // ID currently in use.
+        return &holder(i).member;
     }
 
     /**
      * Returns true if WorkingSetMember with id 'i' is free.
      */
     bool isFree(WorkingSetID i) const {
-        return _data[i].nextFreeOrSelf != i;
+        return holder(i).nextFreeOrSelf != i;
     }
 
     /**
@@ -362,6 +362,13 @@ public:
      */
     void clear();
 
+    /**
+     * Releases the memory retained by the members on the free list, which otherwise keep their
+     * document storage and index key buffers for reuse by the next allocate(). Intended to be
+     * called between batches, e.g. when a cursor is stashed at a getMore boundary.
+     */
+    void releaseFreeMembers();
+
     //
     // WorkingSetMember state transitions
     //
@@ -410,13 +417,29 @@ private:
         WorkingSetMember member;
     };
 
-    // All WorkingSetIDs are indexes into this, except for INVALID_ID.
-    // Elements are added to _freeList rather than removed when freed.
-    std::vector<MemberHolder> _data;
+    // The number of members allocated per slab. A power of two so that finding a member is cheap.
+    static constexpr size_t kSlabSize = 64;
+
+    MemberHolder& holder(WorkingSetID i) {
+        return _slabs[i / kSlabSize][i % kSlabSize];
+    }
+
+    const MemberHolder& holder(WorkingSetID i) const {
+        return _slabs[i / kSlabSize][i % kSlabSize];
+    }
+
+    // All WorkingSetIDs are indexes into the concatenation of these slabs, except for INVALID_ID.
+    // Members are allocated a slab at a time and never move, so growing the working set neither
+    // reallocates nor moves the existing members. Elements are added to _freeList rather than
+    // removed when freed.
+    std::vector<std::unique_ptr<MemberHolder[]>> _slabs;
+
+    // The number of members handed out so far, in use or on the free list.
+    size_t _size = 0;
 
-    // Index into _data, forming a linked-list using MemberHolder::nextFreeOrSelf as the next
+    // Index into the slabs, forming a linked-list using MemberHolder::nextFreeOrSelf as the next
     // link. INVALID_ID is the list terminator since 0 is a valid index.
-    // If _freeList == INVALID_ID, the free list is empty and all elements in _data are in use.
+    // If _freeList == INVALID_ID, the free list is empty and all members up to _size are in use.
     WorkingSetID _freeList;
 
     // Holds index idents that have been registered with 'registerIndexIdent()`. The
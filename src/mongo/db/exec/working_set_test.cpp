@@ -27,6 +27,9 @@
  *    it in the license file.
  */
 
+#include <memory>
+#include <vector>
+
 #include "mongo/bson/bsonmisc.h"
 #include "mongo/bson/bsonobjbuilder.h"
 #include "mongo/bson/oid.h"
@@ -330,4 +333,43 @@ TEST_F(WorkingSetFixture, WsmCanBeExtractedAndReinserted) {
     ASSERT_FALSE(emplacedWsm->metadata());
 }
 
+TEST_F(WorkingSetFixture, MembersKeepTheirAddressWhileTheWorkingSetGrows) {
+    member->recordId = RecordId{1};
+    ws->transitionToRecordIdAndObj(id);
+
+    std::vector<WorkingSetID> ids;
+    for (int i = 0; i < 1000; ++i) {
+        ids.push_back(ws->allocate());
+    }
+    ASSERT_EQ(member, ws->get(id));
+    ASSERT_EQ(member->recordId.getLong(), 1);
+
+    for (auto otherId : ids) {
+        ws->free(otherId);
+    }
+
+    // Freed ids are recycled rather than growing the working set.
+    auto recycledId = ws->allocate();
+    ASSERT_EQ(recycledId, ids.back());
+}
+
+TEST_F(WorkingSetFixture, ReleasingFreeMembersLeavesMembersInUseAlone) {
+    Document doc{{"foo", Value{"bar"_sd}}};
+    member->doc.setValue(doc);
+    ws->transitionToRecordIdAndObj(id);
+
+    auto freedId = ws->allocate();
+    ws->get(freedId)->doc.setValue(Document{{"baz", Value{1}}});
+    ws->get(freedId)->keyData.emplace_back(BSON("a" << 1), BSON("" << 1), 0, SnapshotId());
+    ws->free(freedId);
+
+    ws->releaseFreeMembers();
+    ASSERT_DOCUMENT_EQ(ws->get(id)->doc.value(), doc);
+
+    auto reusedId = ws->allocate();
+    ASSERT_EQ(reusedId, freedId);
+    ASSERT_TRUE(ws->get(reusedId)->doc.value().empty());
+    ASSERT_TRUE(ws->get(reusedId)->keyData.empty());
+}
+
 }  // namespace mongo
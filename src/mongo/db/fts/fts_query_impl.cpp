@@ -136,6 +136,13 @@ Status FTSQueryImpl::parse(TextIndexVersion textIndexVersion) {
     _addTerms(tokenizer.get(), positiveTermSentence, false);
     _addTerms(tokenizer.get(), negativeTermSentence, true);
 
+    for (const auto& phrase : _positivePhrases) {
+        tokenizer->reset(phrase.c_str(), FTSTokenizer::kFilterStopWords);
+        while (tokenizer->moveNext()) {
+            _phraseTermsForBounds.insert(tokenizer->get().toString());
+        }
+    }
+
     return Status::OK();
 }
 
@@ -150,6 +157,7 @@ std::unique_ptr<FTSQuery> FTSQueryImpl::clone() const {
     clonedQuery->_positivePhrases = _positivePhrases;
     clonedQuery->_negatedPhrases = _negatedPhrases;
     clonedQuery->_termsForBounds = _termsForBounds;
+    clonedQuery->_phraseTermsForBounds = _phraseTermsForBounds;
     return std::move(clonedQuery);
 }
 
@@ -232,6 +240,7 @@ size_t FTSQueryImpl::getApproximateSize() const {
     size += computeVectorSize(_positivePhrases);
     size += computeVectorSize(_negatedPhrases);
     size += computeSetSize(_termsForBounds);
+    size += computeSetSize(_phraseTermsForBounds);
     return size;
 }
 }  // namespace fts
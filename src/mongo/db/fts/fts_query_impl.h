@@ -69,6 +69,14 @@ public:
         return _termsForBounds;
     }
 
+    /**
+     * Returns the index terms of the positive phrases, each of which must be present in any
+     * document matching the query that was indexed in the query's language.
+     */
+    const std::set<std::string>& getPhraseTermsForBounds() const {
+        return _phraseTermsForBounds;
+    }
+
     /**
      * Returns a BSON object with the following format:
      * {
@@ -90,6 +98,7 @@ private:
     std::vector<std::string> _positivePhrases;
     std::vector<std::string> _negatedPhrases;
     std::set<std::string> _termsForBounds;
+    std::set<std::string> _phraseTermsForBounds;
 };
 }  // namespace fts
 }  // namespace mongo
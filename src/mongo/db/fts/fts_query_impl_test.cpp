@@ -28,6 +28,8 @@
  */
 
 #include <algorithm>
+#include <set>
+#include <string>
 
 #include "mongo/base/string_data.h"
 #include "mongo/bson/json.h"
@@ -178,6 +180,28 @@ TEST(FTSQueryImpl, Phrase2) {
     ASSERT_EQUALS("phrase-test", q.getPositivePhr()[0]);
 }
 
+TEST(FTSQueryImpl, PhraseTermsForBoundsExcludeOtherTermsAndStopWords) {
+    FTSQueryImpl q;
+    q.setQuery("running \"the blue shoes\" -\"red laces\" sale");
+    q.setLanguage("english");
+    q.setCaseSensitive(true);
+    q.setDiacriticSensitive(false);
+    ASSERT(q.parse(TEXT_INDEX_VERSION_3).isOK());
+
+    ASSERT_TRUE((std::set<std::string>{"blue", "shoe"}) == q.getPhraseTermsForBounds());
+    ASSERT_EQUALS(4U, q.getTermsForBounds().size());
+}
+
+TEST(FTSQueryImpl, NoPhraseTermsForBoundsWithoutPositivePhrases) {
+    FTSQueryImpl q;
+    q.setQuery("doing a -\"phrase test\" for fun");
+    q.setLanguage("english");
+    q.setCaseSensitive(false);
+    q.setDiacriticSensitive(false);
+    ASSERT(q.parse(TEXT_INDEX_VERSION_3).isOK());
+    ASSERT_TRUE(q.getPhraseTermsForBounds().empty());
+}
+
 TEST(FTSQueryImpl, HyphenDirectlyBeforePhraseShouldNegateEntirePhrase) {
     FTSQueryImpl q;
     q.setQuery("doing a -\"phrase test\" for fun");
@@ -29,23 +29,79 @@
 
 #include "mongo/db/fts/stemmer.h"
 
+#include <absl/container/flat_hash_map.h>
 #include <cstdlib>
 #include <libstemmer.h>
 #include <string>
+#include <string_view>
 
 
 #include "mongo/util/assert_util.h"
 
 namespace mongo::fts {
+namespace {
+
+/**
+ * The stems of recently stemmed words, so that the words which recur across documents and queries
+ * are only run through the Snowball stemmer once. There is one cache per language and per thread,
+ * so no synchronization is needed. The cache is emptied when it fills up.
+ */
+class StemCache {
+public:
+    static constexpr size_t kMaxEntries = 4096;
+
+    // Longer words are rarely repeated and would only evict the common ones.
+    static constexpr size_t kMaxWordSize = 32;
+
+    static StemCache& get(const FTSLanguage* language) {
+        static thread_local absl::flat_hash_map<const FTSLanguage*, StemCache> caches;
+        return caches[language];
+    }
+
+    const std::string* find(StringData word) const {
+        auto it = _stems.find(std::string_view(word));
+        return it == _stems.end() ? nullptr : &it->second;
+    }
+
+    void insert(StringData word, StringData stem) {
+        if (_stems.size() >= kMaxEntries) {
+            _stems.clear();
+        }
+        _stems.emplace(std::string(word), std::string(stem));
+    }
+
+private:
+    absl::flat_hash_map<std::string, std::string> _stems;
+};
+
+}  // namespace
 
 class Stemmer::Impl {
 public:
-    explicit Impl(const FTSLanguage* language) : _stemmer{_makeStemmer(language->str())} {}
+    explicit Impl(const FTSLanguage* language)
+        : _language(language), _stemmer{_makeStemmer(language->str())} {}
 
     StringData stem(StringData word) const {
         auto st = _stemmer.get();
         if (!st)
             return word;
+        if (word.size() > StemCache::kMaxWordSize)
+            return _stem(st, word);
+
+        auto& cache = StemCache::get(_language);
+        if (auto cached = cache.find(word)) {
+            // Copied so that the result does not depend on the cache, which other Stemmers on
+            // this thread may clear.
+            _cachedStem = *cached;
+            return _cachedStem;
+        }
+        auto stemmed = _stem(st, word);
+        cache.insert(word, stemmed);
+        return stemmed;
+    }
+
+private:
+    static StringData _stem(sb_stemmer* st, StringData word) {
         auto sym =
             sb_stemmer_stem(st, reinterpret_cast<const sb_symbol*>(word.rawData()), word.size());
         invariant(sym);
@@ -53,7 +109,6 @@ public:
                           static_cast<size_t>(sb_stemmer_length(st))};
     }
 
-private:
     struct SbStemmerDeleter {
         void operator()(sb_stemmer* p) const {
             sb_stemmer_delete(p);
@@ -66,7 +121,9 @@ private:
         return {sb_stemmer_new(lang.c_str(), "UTF_8"), {}};
     }
 
+    const FTSLanguage* _language;
     std::unique_ptr<sb_stemmer, SbStemmerDeleter> _stemmer;
+    mutable std::string _cachedStem;
 };
 
 Stemmer::Stemmer(const FTSLanguage* language) : _impl{std::make_unique<Impl>(language)} {}
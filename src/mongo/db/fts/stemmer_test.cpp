@@ -56,5 +56,25 @@ TEST(English, Caps) {
     ASSERT_EQUALS("unit", s.stem("united"));
     ASSERT_EQUALS("Unite", s.stem("United"));
 }
+
+TEST(English, CachedStemsMatchAcrossStemmers) {
+    Stemmer first(languageEnglishV2());
+    Stemmer second(languageEnglishV2());
+    ASSERT_EQUALS("run", first.stem("running"));
+
+    // The second lookup is served from the cache, and must outlive uses of other stemmers.
+    auto cached = second.stem("running");
+    ASSERT_EQUALS("shoe", first.stem("shoes"));
+    ASSERT_EQUALS("run", cached);
+}
+
+TEST(English, CacheIsPerLanguage) {
+    Stemmer english(languageEnglishV2());
+    Stemmer french(&FTSLanguage::make("french", TEXT_INDEX_VERSION_2));
+    ASSERT_EQUALS("shoe", english.stem("shoes"));
+    auto frenchStem = french.stem("shoes").toString();
+    ASSERT_EQUALS(frenchStem, french.stem("shoes"));
+    ASSERT_EQUALS("shoe", english.stem("shoes"));
+}
 }  // namespace fts
 }  // namespace mongo
@@ -30,6 +30,7 @@
 #include "mongo/db/index/btree_key_generator.h"
 
 #include <boost/container/flat_set.hpp>
+#include <boost/container/small_vector.hpp>
 #include <boost/container/vector.hpp>
 #include <boost/dynamic_bitset/dynamic_bitset.hpp>
 #include <boost/move/utility_core.hpp>
@@ -66,41 +67,6 @@ const BSONElement nullElt = nullObj.firstElement();
 const BSONObj undefinedObj = BSON("" << BSONUndefined);
 const BSONElement undefinedElt = undefinedObj.firstElement();
 
-/**
- * Returns the non-array element at the specified path. This function returns an empty BSON element
- * if the path doesn't exist.
- *
- * The 'path' can be specified using a dotted notation in order to traverse through embedded
- * objects. If 'exist' is specified it should be set to true if the element is present. This output
- * can help the caller to know whether the 'path' is missing or has a 'null' value.
- *
- * This function must only be used when there is no an array element along the 'path'. Otherwise,
- * an exception will be thrown if encounters any array.
- */
-std::pair<BSONElement, bool> extractNonArrayElementAtPath(const BSONObj& obj, StringData path) {
-    static const auto kEmptyElt = BSONElement{};
-
-    auto&& [elt, tail] = [&]() -> std::pair<BSONElement, StringData> {
-        if (auto dotOffset = path.find("."); dotOffset != std::string::npos) {
-            return {obj.getField(path.substr(0, dotOffset)), path.substr(dotOffset + 1)};
-        }
-        return {obj.getField(path), ""_sd};
-    }();
-    uassert(7246301,
-            str::stream() << "field " << path << " cannot be indexed as an array (multikey)",
-            elt.type() != BSONType::Array);
-
-    if (elt.eoo()) {
-        return {kEmptyElt, false};
-    } else if (tail.empty()) {
-        return {elt, true};
-    } else if (elt.type() == BSONType::Object) {
-        return extractNonArrayElementAtPath(elt.embeddedObject(), tail);
-    }
-    // We found a scalar element, but there is more path to traverse, e.g. {a: 1} with a path of
-    // "a.b".
-    return {kEmptyElt, false};
-}
 }  // namespace
 
 BtreeKeyGenerator::BtreeKeyGenerator(std::vector<const char*> fieldNames,
@@ -124,6 +90,26 @@ BtreeKeyGenerator::BtreeKeyGenerator(std::vector<const char*> fieldNames,
         _pathLengths.push_back(pathLength);
         _pathsContainPositionalComponent =
             _pathsContainPositionalComponent || fieldRef.hasNumericPathComponents();
+
+        std::vector<StringData> components;
+        StringData remaining(fieldName);
+        for (auto dotOffset = remaining.find('.'); dotOffset != std::string::npos;
+             dotOffset = remaining.find('.')) {
+            components.push_back(remaining.substr(0, dotOffset));
+            remaining = remaining.substr(dotOffset + 1);
+        }
+        components.push_back(remaining);
+
+        size_t sharedPrefixLength = 0;
+        if (!_pathComponents.empty()) {
+            const auto& previous = _pathComponents.back();
+            while (sharedPrefixLength < std::min(previous.size(), components.size()) &&
+                   previous[sharedPrefixLength] == components[sharedPrefixLength]) {
+                ++sharedPrefixLength;
+            }
+        }
+        _sharedPrefixLengths.push_back(sharedPrefixLength);
+        _pathComponents.push_back(std::move(components));
     }
 }
 
@@ -314,6 +300,10 @@ size_t BtreeKeyGenerator::getApproximateSize() const {
     size += _fixed.size() * sizeof(BSONElement);
     size += computePositionalInfoSize(_emptyPositionalInfo);
     size += _pathLengths.size() * sizeof(size_t);
+    for (const auto& components : _pathComponents) {
+        size += sizeof(components) + components.size() * sizeof(StringData);
+    }
+    size += _sharedPrefixLengths.size() * sizeof(size_t);
     return size;
 }
 
@@ -325,6 +315,43 @@ size_t BtreeKeyGenerator::PositionalPathInfo::getApproximateSize() const {
     return size;
 }
 
+template <typename Callback>
+void BtreeKeyGenerator::_forEachNonArrayElement(const BSONObj& obj, Callback&& callback) const {
+    // 'objects[j]' is the embedded object reached by the first 'j' components of the path walked
+    // last, so 'objects[0]' is always 'obj' itself.
+    boost::container::small_vector<BSONObj, 4> objects{obj};
+
+    for (size_t i = 0; i < _pathComponents.size(); ++i) {
+        const auto& components = _pathComponents[i];
+
+        // Resume from the deepest object this path shares with the previous one.
+        size_t depth = std::min(_sharedPrefixLengths[i], objects.size() - 1);
+        objects.resize(depth + 1);
+
+        BSONElement found;
+        for (; depth < components.size(); ++depth) {
+            BSONElement elt = objects[depth].getField(components[depth]);
+            uassert(7246301,
+                    str::stream() << "field " << _fieldNames[i]
+                                  << " cannot be indexed as an array (multikey)",
+                    elt.type() != BSONType::Array);
+            if (elt.eoo()) {
+                break;
+            } else if (depth + 1 == components.size()) {
+                found = elt;
+            } else if (elt.type() == BSONType::Object) {
+                objects.push_back(elt.embeddedObject());
+            } else {
+                // We found a scalar element, but there is more path to traverse, e.g. {a: 1} with
+                // a path of "a.b".
+                break;
+            }
+        }
+
+        callback(i, found, !found.eoo());
+    }
+}
+
 void BtreeKeyGenerator::_getKeysWithoutArray(SharedBufferFragmentBuilder& pooledBufferBuilder,
                                              const BSONObj& obj,
                                              const CollatorInterface* collator,
@@ -334,8 +361,7 @@ void BtreeKeyGenerator::_getKeysWithoutArray(SharedBufferFragmentBuilder& pooled
     key_string::PooledBuilder keyString{pooledBufferBuilder, _keyStringVersion, _ordering};
     size_t numNotFound{0};
 
-    for (auto&& fieldName : _fieldNames) {
-        auto [elem, _] = extractNonArrayElementAtPath(obj, fieldName);
+    _forEachNonArrayElement(obj, [&](size_t, BSONElement elem, bool) {
         if (elem.eoo()) {
             ++numNotFound;
         }
@@ -347,7 +373,7 @@ void BtreeKeyGenerator::_getKeysWithoutArray(SharedBufferFragmentBuilder& pooled
         } else {
             keyString.appendBSONElement(elem);
         }
-    }
+    });
 
     if (_isSparse && numNotFound == _fieldNames.size()) {
         return;
@@ -362,12 +388,10 @@ void BtreeKeyGenerator::_getKeysWithoutArray(SharedBufferFragmentBuilder& pooled
 boost::dynamic_bitset<size_t> BtreeKeyGenerator::extractElements(
     const BSONObj& obj, std::vector<BSONElement>* elems) const {
     boost::dynamic_bitset<size_t> existFields(_fieldNames.size());
-    size_t idx = 0;
-    for (auto&& fieldName : _fieldNames) {
-        auto [elem, exist] = extractNonArrayElementAtPath(obj, fieldName);
+    _forEachNonArrayElement(obj, [&](size_t idx, BSONElement elem, bool exists) {
         elems->push_back(elem);
-        existFields[idx++] = exist;
-    }
+        existFields[idx] = exists;
+    });
     return existFields;
 }
 
@@ -251,6 +251,16 @@ private:
                              const CollatorInterface* collator,
                              const boost::optional<RecordId>& id) const;
 
+    /**
+     * Resolves every indexed path in 'obj', which must not contain an array along any of them, and
+     * invokes 'callback(i, elem, exists)' for each path in key pattern order. 'elem' is EOO when
+     * the path is missing. Paths are walked through the components split at construction, and each
+     * path resumes from the deepest embedded object it shares with the previous one rather than
+     * from the root of 'obj'.
+     */
+    template <typename Callback>
+    void _forEachNonArrayElement(const BSONObj& obj, Callback&& callback) const;
+
     key_string::Value _buildNullKeyString() const;
 
     const key_string::Version _keyStringVersion;
@@ -274,6 +284,13 @@ private:
     // A vector with size equal to the number of elements in the index key pattern. Each element in
     // the vector is the number of path components in the indexed field.
     std::vector<size_t> _pathLengths;
+
+    // Each indexed field split into its path components, which point into '_fieldNames'.
+    std::vector<std::vector<StringData>> _pathComponents;
+
+    // For each indexed field, the number of leading path components it has in common with the
+    // previous field of the key pattern. Zero for the first field.
+    std::vector<size_t> _sharedPrefixLengths;
 };
 
 }  // namespace mongo
@@ -207,6 +207,29 @@ TEST(BtreeKeyGeneratorTest, GetKeysFromObjectSimple) {
     ASSERT(testKeygen(keyPattern, genKeysFrom, expectedKeys, expectedMultikeyPaths));
 }
 
+TEST(BtreeKeyGeneratorTest, GetKeysFromObjectPathsWithSharedPrefixes) {
+    BSONObj keyPattern = fromjson("{'a.b.c': 1, 'a.b.d': 1, 'a.e': 1, 'a.b': 1, f: 1, 'a.x.y': 1}");
+    BSONObj genKeysFrom = fromjson("{a: {b: {c: 1, d: 2}, e: 3, x: 4}, f: 5}");
+    key_string::HeapBuilder keyString(
+        key_string::Version::kLatestVersion,
+        fromjson("{'': 1, '': 2, '': 3, '': {c: 1, d: 2}, '': 5, '': null}"),
+        Ordering::make(BSONObj()));
+    KeyStringSet expectedKeys{keyString.release()};
+    MultikeyPaths expectedMultikeyPaths(keyPattern.nFields());
+    ASSERT(testKeygen(keyPattern, genKeysFrom, expectedKeys, expectedMultikeyPaths));
+}
+
+TEST(BtreeKeyGeneratorTest, GetKeysFromObjectPathsWithSharedMissingPrefix) {
+    BSONObj keyPattern = fromjson("{'a.b.c': 1, 'a.b.d': 1, 'a.e': 1}");
+    BSONObj genKeysFrom = fromjson("{a: {e: 'foo'}}");
+    key_string::HeapBuilder keyString(key_string::Version::kLatestVersion,
+                                      fromjson("{'': null, '': null, '': 'foo'}"),
+                                      Ordering::make(BSONObj()));
+    KeyStringSet expectedKeys{keyString.release()};
+    MultikeyPaths expectedMultikeyPaths(keyPattern.nFields());
+    ASSERT(testKeygen(keyPattern, genKeysFrom, expectedKeys, expectedMultikeyPaths));
+}
+
 TEST(BtreeKeyGeneratorTest, GetKeysFromObjectDotted) {
     BSONObj keyPattern = fromjson("{'a.b': 1}");
     BSONObj genKeysFrom = fromjson("{a: {b: 4}, c: 'foo'}");
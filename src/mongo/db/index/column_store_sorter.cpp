@@ -130,7 +130,8 @@ ColumnStoreSorter::ColumnStoreSorter(size_t maxMemoryUsageBytes,
                            {},
                            _dbName,
                            range.getChecksum(),
-                           range.getChecksumVersion().value_or(SorterChecksumVersion::v1));
+                           range.getChecksumVersion().value_or(SorterChecksumVersion::v1),
+                           range.getCompressor().value_or(SorterCompressor::kSnappy));
                    });
     this->_stats.setSpilledRanges(_spilledFileIterators.size());
 }
@@ -238,6 +238,17 @@ SortOptions makeSortOptions(size_t maxMemoryUsageBytes,
         .DBName(dbName);
 }
 
+/**
+ * Returns a copy of 'key' whose buffer is allocated from 'memPool'.
+ */
+key_string::Value copyKeyIntoPool(const key_string::Value& key,
+                                  SharedBufferFragmentBuilder& memPool) {
+    key_string::PooledBuilder builder(memPool, key.getVersion());
+    builder.resetFromBuffer(key.getBuffer(), key.getSize());
+    builder.setTypeBits(key.getTypeBits());
+    return builder.release();
+}
+
 MultikeyPaths createMultikeyPaths(const std::vector<MultikeyPath>& multikeyPathsVec) {
     MultikeyPaths multikeyPaths;
     for (const auto& multikeyPath : multikeyPathsVec) {
@@ -270,6 +281,17 @@ Status SortedDataIndexAccessMethod::insert(OperationContext* opCtx,
                                            const std::vector<BsonRecord>& bsonRecords,
                                            const InsertDeleteOptions& options,
                                            int64_t* numInserted) {
+    // Records without their own timestamp all commit at the same time, so keys from the whole
+    // batch can be interleaved. Inserting them in key order keeps the index cursor moving forward
+    // instead of jumping around the tree once per document.
+    if (bsonRecords.size() > 1 && !entry->isHybridBuilding() &&
+        std::all_of(bsonRecords.begin(), bsonRecords.end(), [](const BsonRecord& bsonRecord) {
+            return bsonRecord.ts.isNull();
+        })) {
+        return _insertBatchInKeyOrder(
+            opCtx, pooledBuilder, coll, entry, bsonRecords, options, numInserted);
+    }
+
     for (const auto& bsonRecord : bsonRecords) {
         invariant(bsonRecord.id != RecordId());
 
@@ -313,6 +335,67 @@ Status SortedDataIndexAccessMethod::insert(OperationContext* opCtx,
     return Status::OK();
 }
 
+Status SortedDataIndexAccessMethod::_insertBatchInKeyOrder(
+    OperationContext* opCtx,
+    SharedBufferFragmentBuilder& pooledBuilder,
+    const CollectionPtr& coll,
+    const IndexCatalogEntry* entry,
+    const std::vector<BsonRecord>& bsonRecords,
+    const InsertDeleteOptions& options,
+    int64_t* numInserted) {
+    auto& executionCtx = StorageExecutionContext::get(opCtx);
+
+    KeyStringSet::sequence_type batchKeys;
+    // Multikey state for the documents that make the index multikey, applied once all the keys
+    // have been inserted.
+    std::vector<std::pair<KeyStringSet, MultikeyPaths>> multikeyUpdates;
+
+    for (const auto& bsonRecord : bsonRecords) {
+        invariant(bsonRecord.id != RecordId());
+
+        auto keys = executionCtx.keys();
+        auto multikeyMetadataKeys = executionCtx.multikeyMetadataKeys();
+        auto multikeyPaths = executionCtx.multikeyPaths();
+
+        getKeys(opCtx,
+                coll,
+                entry,
+                pooledBuilder,
+                *bsonRecord.docPtr,
+                options.getKeysMode,
+                GetKeysContext::kAddingKeys,
+                keys.get(),
+                multikeyMetadataKeys.get(),
+                multikeyPaths.get(),
+                bsonRecord.id);
+
+        if (shouldMarkIndexAsMultikey(keys->size(), *multikeyMetadataKeys, *multikeyPaths)) {
+            multikeyUpdates.emplace_back(*multikeyMetadataKeys, *multikeyPaths);
+        }
+        batchKeys.insert(batchKeys.end(), keys->begin(), keys->end());
+    }
+
+    // Every key has its RecordId appended, so keys from different documents never collide.
+    KeyStringSet sortedKeys;
+    sortedKeys.adopt_sequence(std::move(batchKeys));
+
+    int64_t inserted = 0;
+    Status status = insertKeys(opCtx, coll, entry, sortedKeys, options, nullptr, &inserted);
+    if (!status.isOK()) {
+        return status;
+    }
+
+    for (const auto& [multikeyMetadataKeys, multikeyPaths] : multikeyUpdates) {
+        entry->setMultikey(opCtx, coll, multikeyMetadataKeys, multikeyPaths);
+        inserted += multikeyMetadataKeys.size();
+    }
+
+    if (numInserted) {
+        *numInserted += inserted;
+    }
+    return Status::OK();
+}
+
 void SortedDataIndexAccessMethod::remove(OperationContext* opCtx,
                                          SharedBufferFragmentBuilder& pooledBuilder,
                                          const CollectionPtr& coll,
@@ -895,6 +978,16 @@ public:
                   const OnSuppressedErrorFn& onSuppressedError = nullptr,
                   const ShouldRelaxConstraintsFn& shouldRelaxConstraints = nullptr) final;
 
+    bool generateKeys(OperationContext* opCtx,
+                      const CollectionPtr& collection,
+                      const IndexCatalogEntry* entry,
+                      SharedBufferFragmentBuilder& pooledBuilder,
+                      const BSONObj& obj,
+                      const RecordId& loc,
+                      GeneratedKeys* out) const final;
+
+    void insertGeneratedKeys(GeneratedKeys& generated) final;
+
     const MultikeyPaths& getMultikeyPaths() const final;
 
     bool isMultikey() const final;
@@ -924,6 +1017,8 @@ public:
 private:
     void _insertMultikeyMetadataKeysIntoSorter();
 
+    void _mergeMultikeyPaths(const MultikeyPaths& multikeyPaths);
+
     Sorter* _makeSorter(
         size_t maxMemoryUsageBytes,
         const DatabaseName& dbName,
@@ -1020,18 +1115,7 @@ Status SortedDataIndexAccessMethod::BulkBuilderImpl::insert(
         return exceptionToStatus();
     }
 
-    if (!multikeyPaths->empty()) {
-        if (_indexMultikeyPaths.empty()) {
-            _indexMultikeyPaths = *multikeyPaths;
-        } else {
-            invariant(_indexMultikeyPaths.size() == multikeyPaths->size());
-            for (size_t i = 0; i < multikeyPaths->size(); ++i) {
-                _indexMultikeyPaths[i].insert(boost::container::ordered_unique_range_t(),
-                                              (*multikeyPaths)[i].begin(),
-                                              (*multikeyPaths)[i].end());
-            }
-        }
-    }
+    _mergeMultikeyPaths(*multikeyPaths);
 
     for (const auto& keyString : *keys) {
         _sorter->add(keyString, mongo::NullValue());
@@ -1044,6 +1128,71 @@ Status SortedDataIndexAccessMethod::BulkBuilderImpl::insert(
     return Status::OK();
 }
 
+bool SortedDataIndexAccessMethod::BulkBuilderImpl::generateKeys(
+    OperationContext* opCtx,
+    const CollectionPtr& collection,
+    const IndexCatalogEntry* entry,
+    SharedBufferFragmentBuilder& pooledBuilder,
+    const BSONObj& obj,
+    const RecordId& loc,
+    GeneratedKeys* out) const {
+    try {
+        // Enforcing constraints makes getKeys() rethrow any error rather than suppress it, which
+        // could involve writing to the side table from this thread.
+        _iam->getKeys(opCtx,
+                      collection,
+                      entry,
+                      pooledBuilder,
+                      obj,
+                      InsertDeleteOptions::ConstraintEnforcementMode::kEnforceConstraints,
+                      GetKeysContext::kAddingKeys,
+                      &out->keys,
+                      &out->multikeyMetadataKeys,
+                      &out->multikeyPaths,
+                      loc);
+    } catch (const DBException&) {
+        return false;
+    }
+    return true;
+}
+
+void SortedDataIndexAccessMethod::BulkBuilderImpl::insertGeneratedKeys(GeneratedKeys& generated) {
+    // The keys were built in the memory pool of the thread which generated them. Copy them into the
+    // sorter's pool, which is what the sorter's memory accounting is based on.
+    auto& memPool = _sorter->memPool();
+    for (const auto& keyString : generated.keys) {
+        _sorter->add(copyKeyIntoPool(keyString, memPool), mongo::NullValue());
+        ++_keysInserted;
+    }
+    for (const auto& keyString : generated.multikeyMetadataKeys) {
+        _multikeyMetadataKeys.insert(copyKeyIntoPool(keyString, memPool));
+    }
+
+    _mergeMultikeyPaths(generated.multikeyPaths);
+
+    _isMultiKey = _isMultiKey ||
+        _iam->shouldMarkIndexAsMultikey(
+            generated.keys.size(), _multikeyMetadataKeys, generated.multikeyPaths);
+}
+
+void SortedDataIndexAccessMethod::BulkBuilderImpl::_mergeMultikeyPaths(
+    const MultikeyPaths& multikeyPaths) {
+    if (multikeyPaths.empty()) {
+        return;
+    }
+
+    if (_indexMultikeyPaths.empty()) {
+        _indexMultikeyPaths = multikeyPaths;
+    } else {
+        invariant(_indexMultikeyPaths.size() == multikeyPaths.size());
+        for (size_t i = 0; i < multikeyPaths.size(); ++i) {
+            _indexMultikeyPaths[i].insert(boost::container::ordered_unique_range_t(),
+                                          multikeyPaths[i].begin(),
+                                          multikeyPaths[i].end());
+        }
+    }
+}
+
 const MultikeyPaths& SortedDataIndexAccessMethod::BulkBuilderImpl::getMultikeyPaths() const {
     return _indexMultikeyPaths;
 }
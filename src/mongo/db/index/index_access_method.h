@@ -63,6 +63,7 @@
 #include "mongo/db/storage/key_string.h"
 #include "mongo/db/storage/sorted_data_interface.h"
 #include "mongo/db/yieldable.h"
+#include "mongo/util/assert_util.h"
 #include "mongo/util/shared_buffer_fragment.h"
 
 namespace mongo {
@@ -244,6 +245,43 @@ public:
                               const OnSuppressedErrorFn& onSuppressedError = nullptr,
                               const ShouldRelaxConstraintsFn& shouldRelaxConstraints = nullptr) = 0;
 
+        /**
+         * The keys that insert() would add to the BulkBuilder for one document, generated ahead of
+         * time by generateKeys().
+         */
+        struct GeneratedKeys {
+            KeyStringSet keys;
+            KeyStringSet multikeyMetadataKeys;
+            MultikeyPaths multikeyPaths;
+        };
+
+        /**
+         * Generates into 'out' the keys that insert() would add for 'obj', without modifying the
+         * BulkBuilder, so that key generation for several documents can run on several threads.
+         * Concurrent callers must make sure that 'collection' and 'entry' are not yielded or
+         * otherwise modified meanwhile.
+         *
+         * Returns false if the keys could not be generated this way, in which case the document
+         * must be passed to insert() instead. Key generation errors are never raised here, so that
+         * insert() can raise or suppress them on the caller's thread.
+         */
+        virtual bool generateKeys(OperationContext* opCtx,
+                                  const CollectionPtr& collection,
+                                  const IndexCatalogEntry* entry,
+                                  SharedBufferFragmentBuilder& pooledBuilder,
+                                  const BSONObj& obj,
+                                  const RecordId& loc,
+                                  GeneratedKeys* out) const {
+            return false;
+        }
+
+        /**
+         * Adds keys produced by a successful call to generateKeys() to the BulkBuilder.
+         */
+        virtual void insertGeneratedKeys(GeneratedKeys& generated) {
+            MONGO_UNREACHABLE;
+        }
+
         /**
          * Call this when you are ready to finish your bulk work.
          * @param dupsAllowed - If false and 'dupRecords' is not null, append with the RecordIds of
@@ -669,6 +707,19 @@ private:
                                const key_string::Value& dataKey,
                                const RecordIdHandlerFn& onDuplicateRecord);
 
+    /**
+     * Inserts the keys for all of 'bsonRecords' into the index in a single pass in key order,
+     * rather than one document at a time. Only valid when the index is not being built and none
+     * of the records carries its own commit timestamp.
+     */
+    Status _insertBatchInKeyOrder(OperationContext* opCtx,
+                                  SharedBufferFragmentBuilder& pooledBuilder,
+                                  const CollectionPtr& coll,
+                                  const IndexCatalogEntry* entry,
+                                  const std::vector<BsonRecord>& bsonRecords,
+                                  const InsertDeleteOptions& options,
+                                  int64_t* numInserted);
+
     Status _indexKeysOrWriteToSideTable(OperationContext* opCtx,
                                         const CollectionPtr& coll,
                                         const IndexCatalogEntry* entry,
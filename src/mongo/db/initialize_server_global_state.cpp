@@ -390,6 +390,8 @@ MONGO_INITIALIZER_GENERAL(ServerLogRedirection,
         lv2Config.fileOpenMode = serverGlobalParams.logAppend
             ? logv2::LogDomainGlobal::ConfigurationOptions::OpenMode::kAppend
             : logv2::LogDomainGlobal::ConfigurationOptions::OpenMode::kTruncate;
+        lv2Config.fileAsyncBufferSizeBytes = static_cast<size_t>(gAsyncLogFileBufferSizeKB) * 1024;
+        lv2Config.fileAsyncDropWhenFull = gAsyncLogFileDropWhenFull;
 
         if (serverGlobalParams.logAppend && exists) {
             writeServerRestartedAfterLogConfig = true;
@@ -163,12 +163,15 @@ SignedLogicalTime LogicalTimeValidator::signLogicalTime(OperationContext* opCtx,
 }
 
 Status LogicalTimeValidator::validate(OperationContext* opCtx, const SignedLogicalTime& newTime) {
+    uint64_t keyCacheResets;
     {
         stdx::lock_guard<Latch> lk(_mutex);
-        if (newTime.getTime() <= _lastSeenValidTime.getTime() &&
+        if ((newTime.getTime() <= _lastSeenValidTime.getTime() ||
+             newTime.getTime() <= _lastValidatedTime) &&
             !MONGO_unlikely(alwaysValidateClientsClusterTime.shouldFail())) {
             return Status::OK();
         }
+        keyCacheResets = _keyCacheResets;
     }
 
     auto keyStatusWith =
@@ -192,6 +195,12 @@ Status LogicalTimeValidator::validate(OperationContext* opCtx, const SignedLogic
         auto proofStatus =
             _timeProofService.checkProof(newTime.getTime(), newProof.value(), key.getKey());
         if (proofStatus.isOK()) {
+            // Every inbound request carries the latest cluster time, so remember it to avoid
+            // checking the same signature again for each of them.
+            stdx::lock_guard<Latch> lk(_mutex);
+            if (keyCacheResets == _keyCacheResets && newTime.getTime() > _lastValidatedTime) {
+                _lastValidatedTime = newTime.getTime();
+            }
             return Status::OK();
         } else if (firstError.isOK()) {
             firstError = proofStatus;
@@ -243,6 +252,8 @@ void LogicalTimeValidator::resetKeyManagerCache() {
     _keyManager->clearCache();
     stdx::lock_guard<Latch> lk(_mutex);
     _lastSeenValidTime = SignedLogicalTime();
+    _lastValidatedTime = LogicalTime();
+    ++_keyCacheResets;
     _timeProofService.resetCache();
 }
 
@@ -254,6 +265,8 @@ void LogicalTimeValidator::stopKeyManager() {
 
         stdx::lock_guard<Latch> lk(_mutex);
         _lastSeenValidTime = SignedLogicalTime();
+        _lastValidatedTime = LogicalTime();
+        ++_keyCacheResets;
         _timeProofService.resetCache();
     } else {
         LOGV2(20718, "Stopping key manager: no key manager exists.");
@@ -134,6 +134,16 @@ private:
 
     Mutex _mutex = MONGO_MAKE_LATCH("LogicalTimeValidator::_mutex");  // protects _lastSeenValidTime
     SignedLogicalTime _lastSeenValidTime;
+
+    // The highest time whose signature was successfully checked by validate(). Times at or below
+    // it are accepted without checking their signature again, the same way as times at or below
+    // '_lastSeenValidTime'. Protected by '_mutex' and cleared along with the key cache.
+    LogicalTime _lastValidatedTime;
+
+    // Incremented, under '_mutex', whenever the key cache is reset, so that a validation which was
+    // running concurrently doesn't record its result for keys which are no longer trusted.
+    uint64_t _keyCacheResets = 0;
+
     TimeProofService _timeProofService;
     std::shared_ptr<KeysCollectionManager> _keyManager;
 };
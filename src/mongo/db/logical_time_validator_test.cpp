@@ -59,6 +59,10 @@ public:
         return _validator.get();
     }
 
+    std::shared_ptr<KeysCollectionManager> keyManager() {
+        return _keyManager;
+    }
+
 protected:
     LogicalTimeValidatorTest() : ConfigServerTestFixture(Options{}.useMockClock(true)) {}
 
@@ -135,6 +139,28 @@ TEST_F(LogicalTimeValidatorTest, ValidateErrorsOnInvalidTime) {
     ASSERT_EQ(ErrorCodes::TimeProofMismatch, status);
 }
 
+TEST_F(LogicalTimeValidatorTest, ValidateSkipsCheckForTimesAtOrBelowLastValidated) {
+    validator()->enableKeyGenerator(operationContext(), true);
+    refreshKeyManager();
+
+    // Sign through a separate validator so that the one under test has not seen the time yet.
+    LogicalTimeValidator otherValidator(keyManager());
+    auto signedTime = otherValidator.trySignLogicalTime(LogicalTime(Timestamp(30, 0)));
+    ASSERT_OK(validator()->validate(operationContext(), signedTime));
+
+    TimeProofService::TimeProof invalidProof = {{{1, 2, 3}}};
+    SignedLogicalTime lowerTime(LogicalTime(Timestamp(25, 0)), invalidProof, signedTime.getKeyId());
+    ASSERT_OK(validator()->validate(operationContext(), lowerTime));
+
+    SignedLogicalTime higherTime(
+        LogicalTime(Timestamp(40, 0)), invalidProof, signedTime.getKeyId());
+    ASSERT_EQ(ErrorCodes::TimeProofMismatch, validator()->validate(operationContext(), higherTime));
+
+    // Resetting the key cache forgets the validated time.
+    validator()->resetKeyManagerCache();
+    ASSERT_EQ(ErrorCodes::TimeProofMismatch, validator()->validate(operationContext(), lowerTime));
+}
+
 TEST_F(LogicalTimeValidatorTest, ValidateReturnsOkForValidSignatureWithImplicitRefresh) {
     validator()->enableKeyGenerator(operationContext(), true);
 
@@ -640,6 +640,15 @@ MatchExpression::ExpressionOptimizerFunc InMatchExpression::getOptimizer() const
             return std::make_unique<AlwaysFalseMatchExpression>();
         }
 
+        if (!ime._equalities->isPrepared() &&
+            ime._equalities->getElements().size() >= InListData::kHashedLookupThreshold) {
+            // Large lists are probed through the InListData hash set instead of binary search.
+            // Preparing a private copy leaves any clones that share '_equalities' untouched.
+            auto equalities = ime._equalities->clone();
+            equalities->prepare();
+            ime._equalities = std::move(equalities);
+        }
+
         return expression;
     };
 }
@@ -40,6 +40,8 @@
 #include "mongo/base/string_data.h"
 #include "mongo/bson/bsonelement.h"
 #include "mongo/bson/bsonobj.h"
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/bson/oid.h"
 #include "mongo/bson/json.h"
 #include "mongo/db/matcher/expression.h"
 #include "mongo/db/matcher/expression_always_boolean.h"
@@ -372,6 +374,31 @@ TEST(ExpressionOptimizeTest, NormalizeWithInPreservesCollator) {
     ASSERT_EQ(eqMatchExpression->getCollator(), &collator);
 }
 
+TEST(ExpressionOptimizeTest, NormalizeWithLargeInPreparesHashedLookup) {
+    std::vector<OID> oids;
+    BSONArrayBuilder bab;
+    for (int i = 0; i < static_cast<int>(InListData::kHashedLookupThreshold); ++i) {
+        oids.push_back(OID::gen());
+        bab.append(i * 2);
+        bab.append(oids.back());
+    }
+    BSONObj obj = BSON("x" << BSON("$in" << bab.arr()));
+    std::unique_ptr<MatchExpression> matchExpression(parseMatchExpression(obj));
+    matchExpression = MatchExpression::optimize(std::move(matchExpression));
+    ASSERT(matchExpression->matchType() == MatchExpression::MatchType::MATCH_IN);
+
+    auto inMatchExpression = static_cast<InMatchExpression*>(matchExpression.get());
+    ASSERT_TRUE(inMatchExpression->getInList()->isPrepared());
+    ASSERT_TRUE(inMatchExpression->matchesBSON(BSON("x" << 4)));
+    ASSERT_TRUE(inMatchExpression->matchesBSON(BSON("x" << 4LL)));
+    ASSERT_TRUE(inMatchExpression->matchesBSON(BSON("x" << 4.0)));
+    ASSERT_TRUE(inMatchExpression->matchesBSON(BSON("x" << oids.front())));
+    ASSERT_FALSE(inMatchExpression->matchesBSON(BSON("x" << 3)));
+    ASSERT_FALSE(inMatchExpression->matchesBSON(BSON("x" << OID::gen())));
+    ASSERT_FALSE(inMatchExpression->matchesBSON(BSON("x"
+                                                     << "4")));
+}
+
 TEST(ExpressionOptimizeTest, AndWithAlwaysFalseChildOptimizesToAlwaysFalse) {
     BSONObj obj = fromjson("{$and: [{a: 1}, {$alwaysFalse: 1}]}");
     std::unique_ptr<MatchExpression> matchExpression(parseMatchExpression(obj));
@@ -321,7 +321,7 @@ void InListData::updateSbeTagMasks() {
             _sbeTagMask |= (1ull << tagValue);
 
             if ((sbe::value::isShallowType(tag) && !sbe::value::isStringOrSymbol(tag)) ||
-                tag == sbe::value::TypeTags::NumberDecimal ||
+                tag == sbe::value::TypeTags::NumberDecimal || sbe::value::isObjectId(tag) ||
                 (sbe::value::isStringOrSymbol(tag) && !_collator)) {
                 // If 'tag' is eligible to use the hash, set the corresponding bit in
                 // '_hashSetSbeTagMask'.
@@ -458,7 +458,8 @@ void InListData::buildHashSet() {
             if (!_collator && str.size() <= kLargeStringThreshold) {
                 _hashSet.insert({tag, val});
             }
-        } else if (sbe::value::isShallowType(tag) || tag == sbe::value::TypeTags::NumberDecimal) {
+        } else if (sbe::value::isShallowType(tag) || tag == sbe::value::TypeTags::NumberDecimal ||
+                   sbe::value::isObjectId(tag)) {
             _hashSet.insert({tag, val});
         }
     }
@@ -44,6 +44,9 @@ namespace mongo {
 class InListData {
 public:
     static constexpr size_t kLargeStringThreshold = 1000u;
+    // Classic $in evaluation switches from binary search to hashed lookups for lists with at
+    // least this many elements (see 'InMatchExpression::getOptimizer()').
+    static constexpr size_t kHashedLookupThreshold = 32u;
     static constexpr BSONObj::ComparisonRulesSet kIgnoreFieldName = 0;
 
     class InListElemLessThan {
@@ -152,6 +155,12 @@ public:
             return false;
         }
 
+        // Once prepared, '_hashSet' has been built, so use the same lookup as SBE.
+        if (_prepared) {
+            auto [tag, val] = sbe::bson::convertFrom<true>(e);
+            return contains(tag, val);
+        }
+
         // Use binary search.
         auto elemLt = InListElemLessThan(_collator);
         return std::binary_search(_elements.begin(), _elements.end(), e, elemLt);
@@ -171,7 +180,8 @@ public:
         bool searchHashSet = false;
 
         if ((mask & stringOrSymbolSbeTagMask) == 0u) {
-            if (sbe::value::isShallowType(tag) || tag == sbe::value::TypeTags::NumberDecimal) {
+            if (sbe::value::isShallowType(tag) || tag == sbe::value::TypeTags::NumberDecimal ||
+                sbe::value::isObjectId(tag)) {
                 searchHashSet = true;
             } else if ((mask & _sbeTagMask) == 0u) {
                 // If 'mask' is not present in '_sbeTagMask', then we know 'tag'/'val' cannot
@@ -354,9 +364,10 @@ private:
     // prior to sorting and deduping.
     boost::optional<std::vector<BSONElement>> _originalElements;
 
-    // De-duped hash set containing all non-string shallow-type elements and all NumberDecimal
-    // elements. If _collator is null, this hash set will also contain all non-large strings/symbols
-    // (i.e. strings and symbols whose length doesn't exceed 'kLargeStringThreshold').
+    // De-duped hash set containing all non-string shallow-type elements, all NumberDecimal
+    // elements and all ObjectId elements. If _collator is null, this hash set will also contain
+    // all non-large strings/symbols (i.e. strings and symbols whose length doesn't exceed
+    // 'kLargeStringThreshold').
     sbe::value::ValueSetType _hashSet;
 
     // This field indicates where the beginning of the binary search range should be when using
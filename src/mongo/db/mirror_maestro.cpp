@@ -99,6 +99,7 @@ constexpr auto kMirroredReadsParamName = "mirrorReads"_sd;
 
 constexpr auto kMirroredReadsSeenKey = "seen"_sd;
 constexpr auto kMirroredReadsSentKey = "sent"_sd;
+constexpr auto kMirroredReadsSkippedKey = "skipped"_sd;
 constexpr auto kMirroredReadsProcessedAsSecondaryKey = "processedAsSecondary"_sd;
 constexpr auto kMirroredReadsResolvedKey = "resolved"_sd;
 constexpr auto kMirroredReadsResolvedBreakdownKey = "resolvedBreakdown"_sd;
@@ -163,6 +164,40 @@ private:
                  const CommandInvocation& invocation,
                  const MirroredReadsParameters& params) noexcept;
 
+    /**
+     * Counts the mirrored reads that have been handed to the executor for each host and have not
+     * yet completed, so that hosts which stop keeping up can be skipped.
+     */
+    class OutstandingByHost {
+    public:
+        /**
+         * Reserves a slot for 'host' and returns true, unless 'host' already has 'limit'
+         * outstanding reads. A non-positive 'limit' never rejects.
+         */
+        bool tryAcquire(const HostAndPort& host, int limit) noexcept {
+            stdx::lock_guard<Mutex> lk(_mutex);
+            auto& outstanding = _outstanding[host.toString()];
+            if (limit > 0 && outstanding >= limit) {
+                return false;
+            }
+            outstanding++;
+            return true;
+        }
+
+        void release(const HostAndPort& host) noexcept {
+            stdx::lock_guard<Mutex> lk(_mutex);
+            auto it = _outstanding.find(host.toString());
+            invariant(it != _outstanding.end() && it->second > 0);
+            if (--it->second == 0) {
+                _outstanding.erase(it);
+            }
+        }
+
+    private:
+        Mutex _mutex = MONGO_MAKE_LATCH("MirrorMaestroImpl::OutstandingByHost::_mutex");
+        stdx::unordered_map<std::string, int> _outstanding;
+    };
+
     /**
      * An enum detailing the liveness of the Maestro
      *
@@ -194,6 +229,8 @@ private:
     std::shared_ptr<executor::TaskExecutor> _executor;
     repl::TopologyVersionObserver _topologyVersionObserver;
     synchronized_value<PseudoRandom> _random{PseudoRandom(SecureRandom{}.nextInt64())};
+    // Shared with the response callbacks, which may run after '_mirror()' has returned.
+    std::shared_ptr<OutstandingByHost> _outstanding = std::make_shared<OutstandingByHost>();
 };
 
 const auto getMirrorMaestroImpl = ServiceContext::declareDecoration<MirrorMaestroImpl>();
@@ -213,6 +250,7 @@ public:
         BSONObjBuilder section;
         section.append(kMirroredReadsSeenKey, seen.loadRelaxed());
         section.append(kMirroredReadsSentKey, sent.loadRelaxed());
+        section.append(kMirroredReadsSkippedKey, skipped.loadRelaxed());
         section.append(kMirroredReadsProcessedAsSecondaryKey, processedAsSecondary.loadRelaxed());
 
         if (MONGO_unlikely(mirrorMaestroExpectsResponse.shouldFail())) {
@@ -265,6 +303,9 @@ public:
     AtomicWord<CounterT> seen;
     // Counts the number of remote requests (for mirroring as primary) sent over the network.
     AtomicWord<CounterT> sent;
+    // Counts the number of remote requests (for mirroring as primary) that were not sent because
+    // the target already had too many mirrored reads outstanding.
+    AtomicWord<CounterT> skipped;
     // Counts the number of responses (as primary) from secondaries after mirrored operations.
     AtomicWord<CounterT> resolved;
     // Counts the number of responses (as primary) of successful mirrored operations. Disabled by
@@ -447,11 +488,24 @@ void MirrorMaestroImpl::_mirror(const std::vector<HostAndPort>& hosts,
     // Mirror to a normalized subset of eligible hosts (i.e., secondaries).
     const auto startIndex = (*_random)->nextInt64(hosts.size());
     const auto mirroringFactor = std::ceil(params.getSamplingRate() * hosts.size());
+    const auto maxOutstandingPerHost = gMirrorReadsMaxOutstandingPerHost.load();
 
     for (auto i = 0; i < mirroringFactor; i++) {
         auto& host = hosts[(startIndex + i) % hosts.size()];
+        if (!_outstanding->tryAcquire(host, maxOutstandingPerHost)) {
+            // This host has not drained the reads we already mirrored to it. Sending it more would
+            // only add to its load without warming its cache any sooner.
+            gMirroredReadsSection.skipped.fetchAndAdd(1);
+            continue;
+        }
+        ScopeGuard releaseGuard([&] { _outstanding->release(host); });
+
         std::weak_ptr<executor::TaskExecutor> wExec(_executor);
-        auto mirrorResponseCallback = [host, wExec = std::move(wExec)](auto& args) {
+        auto mirrorResponseCallback = [host,
+                                       wExec = std::move(wExec),
+                                       outstanding = _outstanding](auto& args) {
+            outstanding->release(host);
+
             if (MONGO_likely(!mirrorMaestroExpectsResponse.shouldFail())) {
                 // If we don't expect responses, then there is nothing to do here
                 return;
@@ -513,6 +567,8 @@ void MirrorMaestroImpl::_mirror(const std::vector<HostAndPort>& hosts,
         }
 
         tassert(status);
+        // The response callback now owns the reservation.
+        releaseGuard.dismiss();
         gMirroredReadsSection.sent.fetchAndAdd(1);
     }
 } catch (const DBException& e) {
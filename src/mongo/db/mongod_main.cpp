@@ -133,6 +133,7 @@
 #include "mongo/db/op_observer/user_write_block_mode_op_observer.h"
 #include "mongo/db/operation_context.h"
 #include "mongo/db/periodic_runner_job_abort_expired_transactions.h"
+#include "mongo/db/periodic_runner_job_snapshot_plan_cache.h"
 #include "mongo/db/pipeline/change_stream_expired_pre_image_remover.h"
 #include "mongo/db/pipeline/change_stream_preimage_gen.h"
 #include "mongo/db/pipeline/process_interface/replica_set_node_process_interface.h"
@@ -1154,6 +1155,21 @@ ExitCode _initAndListen(ServiceContext* serviceContext, int listenPort) {
         serviceContext->getService(ClusterRole::ShardServer), std::move(cacheLoader));
     stats::StatsCatalog::set(serviceContext, std::move(catalog));
 
+    // Warm up the plan caches from the last snapshot, and keep snapshotting them for the next
+    // restart.
+    if (internalQueryPlanCacheSnapshotIntervalSecs > 0) {
+        TimeElapsedBuilderScopedTimer scopedTimer(serviceContext->getFastClockSource(),
+                                                  "Load the plan cache snapshot",
+                                                  &startupTimeElapsedBuilder);
+        try {
+            PeriodicThreadToSnapshotPlanCache::loadSnapshot(startupOpCtx.get());
+        } catch (const DBException& ex) {
+            LOGV2_WARNING(
+                9156608, "Failed to load the plan cache snapshot", "error"_attr = ex.toStatus());
+        }
+        PeriodicThreadToSnapshotPlanCache::get(serviceContext)->start();
+    }
+
     // Startup options are written to the audit log at the end of startup so that cluster server
     // parameters are guaranteed to have been initialized from disk at this point.
     {
@@ -1816,6 +1832,11 @@ void shutdownTask(const ShutdownTaskArgs& shutdownArgs) {
             PeriodicThreadToAbortExpiredTransactions::get(serviceContext)->stop();
         }
 
+        if (internalQueryPlanCacheSnapshotIntervalSecs > 0) {
+            LOGV2(9156609, "Shutting down the PeriodicThreadToSnapshotPlanCache");
+            PeriodicThreadToSnapshotPlanCache::get(serviceContext)->stop();
+        }
+
         {
             stdx::lock_guard lg(*client);
             opCtx->setIsExecutingShutdown();
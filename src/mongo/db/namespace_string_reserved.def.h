@@ -260,6 +260,9 @@ NSS_CONSTANT(kLocalClusterManagerNamespace, DatabaseName::kLocal, "clustermanage
 // Namespace used for startup log.
 NSS_CONSTANT(kStartupLogNamespace, DatabaseName::kLocal, "startup_log"_sd)
 
+// Namespace used for the snapshots of the plan cache which warm it up after a restart.
+NSS_CONSTANT(kLocalPlanCacheWarmupNamespace, DatabaseName::kLocal, "planCacheWarmup"_sd)
+
 // Namespace for changelog on CSRS.
 NSS_CONSTANT(kConfigChangelogNamespace, DatabaseName::kConfig, "changelog"_sd)
 
@@ -1199,6 +1199,8 @@ WriteResult performInserts(OperationContext* opCtx,
             // Similarly, if the insert was already executed as part of a retryable write, flush the
             // current batch to preserve the error results order.
         } else {
+            // The document is still a view into the received message, so only its handle moves
+            // into the batch.
             BSONObj toInsert = fixedDoc.getValue().isEmpty() ? doc : std::move(fixedDoc.getValue());
 
             if (containsDotsAndDollarsField)
@@ -1209,7 +1211,7 @@ WriteResult performInserts(OperationContext* opCtx,
             batch.emplace_back(source == OperationSource::kTimeseriesInsert && wholeOp.getStmtIds()
                                    ? *wholeOp.getStmtIds()
                                    : std::vector<StmtId>{stmtId},
-                               toInsert);
+                               std::move(toInsert));
 
             bytesInBatch += batch.back().doc.objsize();
 
@@ -0,0 +1,153 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/db/periodic_runner_job_snapshot_plan_cache.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "mongo/base/error_codes.h"
+#include "mongo/bson/bsonobj.h"
+#include "mongo/db/catalog/collection_catalog.h"
+#include "mongo/db/client.h"
+#include "mongo/db/dbdirectclient.h"
+#include "mongo/db/namespace_string.h"
+#include "mongo/db/query/collection_query_info.h"
+#include "mongo/db/query/find_command.h"
+#include "mongo/db/query/plan_cache_warmup.h"
+#include "mongo/db/query/query_knobs_gen.h"
+#include "mongo/idl/idl_parser.h"
+#include "mongo/logv2/log.h"
+#include "mongo/util/assert_util.h"
+#include "mongo/util/duration.h"
+
+#define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kQuery
+
+
+namespace mongo {
+
+auto PeriodicThreadToSnapshotPlanCache::get(ServiceContext* serviceContext)
+    -> PeriodicThreadToSnapshotPlanCache& {
+    auto& jobContainer = _serviceDecoration(serviceContext);
+    jobContainer._init(serviceContext);
+
+    return jobContainer;
+}
+
+auto PeriodicThreadToSnapshotPlanCache::operator*() const noexcept -> PeriodicJobAnchor& {
+    stdx::lock_guard lk(_mutex);
+    return *_anchor;
+}
+
+auto PeriodicThreadToSnapshotPlanCache::operator->() const noexcept -> PeriodicJobAnchor* {
+    stdx::lock_guard lk(_mutex);
+    return _anchor.get();
+}
+
+void PeriodicThreadToSnapshotPlanCache::loadSnapshot(OperationContext* opCtx) {
+    auto& store = plan_cache_warmup::PlanCacheWarmupStore::get(opCtx->getServiceContext());
+
+    DBDirectClient client(opCtx);
+    auto cursor =
+        client.find(FindCommandRequest{NamespaceString::kLocalPlanCacheWarmupNamespace});
+    while (cursor->more()) {
+        auto doc = cursor->next();
+        try {
+            store.add(plan_cache_warmup::PlanCacheWarmupEntry::parse(
+                IDLParserContext("PlanCacheWarmupEntry"), doc));
+        } catch (const DBException& ex) {
+            LOGV2_WARNING(9156602,
+                          "Skipping invalid plan cache snapshot entry",
+                          "entry"_attr = doc,
+                          "error"_attr = ex.toStatus());
+        }
+    }
+
+    LOGV2(9156603, "Loaded plan cache snapshot", "numEntries"_attr = store.size());
+}
+
+void PeriodicThreadToSnapshotPlanCache::writeSnapshot(OperationContext* opCtx) {
+    std::vector<BSONObj> docs;
+    auto catalog = CollectionCatalog::get(opCtx);
+    for (auto&& dbName : catalog->getAllDbNames()) {
+        for (auto&& coll : catalog->range(dbName)) {
+            auto planCache = CollectionQueryInfo::getCollectionQueryInfo(coll).getPlanCache();
+            if (!planCache) {
+                continue;
+            }
+            for (auto&& entry : plan_cache_warmup::snapshotPlanCache(coll->uuid(), *planCache)) {
+                docs.push_back(entry.toBSON());
+            }
+        }
+    }
+
+    // Replace the previous snapshot, inserting in batches to keep each command small.
+    static constexpr size_t kInsertBatchSize = 1000;
+    DBDirectClient client(opCtx);
+    client.remove(NamespaceString::kLocalPlanCacheWarmupNamespace, BSONObj{});
+    for (size_t begin = 0; begin < docs.size(); begin += kInsertBatchSize) {
+        const size_t end = std::min(docs.size(), begin + kInsertBatchSize);
+        client.insert(NamespaceString::kLocalPlanCacheWarmupNamespace,
+                      std::vector<BSONObj>(docs.begin() + begin, docs.begin() + end));
+    }
+
+    LOGV2_DEBUG(9156604, 2, "Wrote plan cache snapshot", "numEntries"_attr = docs.size());
+}
+
+void PeriodicThreadToSnapshotPlanCache::_init(ServiceContext* serviceContext) {
+    stdx::lock_guard lk(_mutex);
+    if (_anchor) {
+        return;
+    }
+
+    auto periodicRunner = serviceContext->getPeriodicRunner();
+    invariant(periodicRunner);
+
+    PeriodicRunner::PeriodicJob job(
+        "snapshotPlanCache",
+        [](Client* client) {
+            auto opCtx = client->makeOperationContext();
+            try {
+                writeSnapshot(opCtx.get());
+            } catch (ExceptionForCat<ErrorCategory::CancellationError>& ex) {
+                LOGV2_DEBUG(9156605, 2, "Periodic job canceled", "reason"_attr = ex.reason());
+            } catch (ExceptionForCat<ErrorCategory::Interruption>& ex) {
+                LOGV2_DEBUG(9156606, 2, "Periodic job canceled", "reason"_attr = ex.reason());
+            } catch (const DBException& ex) {
+                LOGV2_WARNING(
+                    9156607, "Failed to write plan cache snapshot", "error"_attr = ex.toStatus());
+            }
+        },
+        Seconds(internalQueryPlanCacheSnapshotIntervalSecs),
+        false /*isKillableByStepdown*/);
+
+    _anchor = std::make_shared<PeriodicJobAnchor>(periodicRunner->makeJob(std::move(job)));
+}
+
+}  // namespace mongo
@@ -0,0 +1,76 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <memory>
+
+#include "mongo/db/operation_context.h"
+#include "mongo/db/service_context.h"
+#include "mongo/platform/mutex.h"
+#include "mongo/util/hierarchical_acquisition.h"
+#include "mongo/util/periodic_runner.h"
+
+namespace mongo {
+
+/**
+ * Defines a periodic background job which snapshots the active entries of the classic plan caches
+ * of all the collections to local.planCacheWarmup. The job runs every
+ * 'internalQueryPlanCacheSnapshotIntervalSecs' seconds.
+ */
+class PeriodicThreadToSnapshotPlanCache {
+public:
+    static PeriodicThreadToSnapshotPlanCache& get(ServiceContext* serviceContext);
+
+    /**
+     * Loads the last snapshot into the PlanCacheWarmupStore, so that its entries can be
+     * re-installed into the plan caches as queries are run.
+     */
+    static void loadSnapshot(OperationContext* opCtx);
+
+    /**
+     * Replaces the snapshot with the active entries of the plan caches.
+     */
+    static void writeSnapshot(OperationContext* opCtx);
+
+    PeriodicJobAnchor& operator*() const noexcept;
+    PeriodicJobAnchor* operator->() const noexcept;
+
+private:
+    void _init(ServiceContext* serviceContext);
+
+    inline static const auto _serviceDecoration =
+        ServiceContext::declareDecoration<PeriodicThreadToSnapshotPlanCache>();
+
+    mutable Mutex _mutex = MONGO_MAKE_LATCH(HierarchicalAcquisitionLevel(1),
+                                            "PeriodicThreadToSnapshotPlanCache::_mutex");
+    std::shared_ptr<PeriodicJobAnchor> _anchor;
+};
+
+}  // namespace mongo
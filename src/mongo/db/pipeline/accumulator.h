@@ -298,9 +298,9 @@ public:
      *  - ConstantSumState, which is used in the cases of sums over non-decimal constants such as
      *    {$sum: 1}. It stores the current sum as a running total.
      *  - NonConstantSumState which is used in all other cases. It stores the current sum using a
-     *    DoubleDoubleSummation and a DecimalTotal.
+     *    DoubleDoubleSummation and a DecimalSummation.
      */
-    using NonConstantSumState = std::pair<DoubleDoubleSummation, Decimal128>;
+    using NonConstantSumState = std::pair<DoubleDoubleSummation, DecimalSummation>;
     using ConstantSumState = std::variant<int, long long, double>;
 
 
@@ -354,7 +354,7 @@ private:
     BSONType totalType = NumberInt;
     BSONType nonDecimalTotalType = NumberInt;
     std::variant<NonConstantSumState, ConstantSumState> sum =
-        std::make_pair<>(DoubleDoubleSummation(), Decimal128());
+        std::make_pair<>(DoubleDoubleSummation(), DecimalSummation());
 };
 
 class AccumulatorMinMax : public AccumulatorState {
@@ -460,7 +460,7 @@ private:
     BSONType _totalType = NumberInt;
     BSONType _nonDecimalTotalType = NumberInt;
     DoubleDoubleSummation _nonDecimalTotal;
-    Decimal128 _decimalTotal;
+    DecimalSummation _decimalTotal;
     long long _count;
 };
 
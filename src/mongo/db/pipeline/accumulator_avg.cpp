@@ -60,7 +60,7 @@ void applyPartialSum(const std::vector<Value>& arr,
                      BSONType& nonDecimalTotalType,
                      BSONType& totalType,
                      DoubleDoubleSummation& nonDecimalTotal,
-                     Decimal128& decimalTotal);
+                     DecimalSummation& decimalTotal);
 
 Value serializePartialSum(BSONType nonDecimalTotalType,
                           BSONType totalType,
@@ -102,7 +102,7 @@ void AccumulatorAvg::processInternal(const Value& input, bool merging) {
 
     switch (input.getType()) {
         case NumberDecimal:
-            _decimalTotal = _decimalTotal.add(input.getDecimal());
+            _decimalTotal.add(input.getDecimal());
             break;
         case NumberLong:
             // Avoid summation using double as that loses precision.
@@ -125,13 +125,13 @@ intrusive_ptr<AccumulatorState> AccumulatorAvg::create(ExpressionContext* const
 }
 
 Decimal128 AccumulatorAvg::_getDecimalTotal() const {
-    return _decimalTotal.add(_nonDecimalTotal.getDecimal());
+    return _decimalTotal.getDecimal().add(_nonDecimalTotal.getDecimal());
 }
 
 Value AccumulatorAvg::getValue(bool toBeMerged) {
     if (toBeMerged) {
-        auto partialSumVal =
-            serializePartialSum(_nonDecimalTotalType, _totalType, _nonDecimalTotal, _decimalTotal);
+        auto partialSumVal = serializePartialSum(
+            _nonDecimalTotalType, _totalType, _nonDecimalTotal, _decimalTotal.getDecimal());
         return Value(Document{{stage_builder::countName, _count},
                               {stage_builder::partialSumName, partialSumVal}});
     }
@@ -178,14 +178,15 @@ boost::intrusive_ptr<Expression> AccumulatorPercentile::parseExpression(
 
 void AccumulatorPercentile::processInternal(const Value& input, bool merging) {
     if (merging) {
+        // Shards send their t-digests as serialized partial states, so the merger only has to
+        // combine the centroids and never sees the raw inputs.
         dynamic_cast<PartialPercentile<Value>*>(_algo.get())->combine(input);
-        return;
-    }
-
-    if (!input.numeric()) {
-        return;
+    } else {
+        if (!input.numeric()) {
+            return;
+        }
+        _algo->incorporate(input.coerceToDouble());
     }
-    _algo->incorporate(input.coerceToDouble());
     _memUsageTracker.set(sizeof(*this) + _algo->memUsageBytes());
 }
 
@@ -64,7 +64,7 @@ void applyPartialSum(const std::vector<Value>& arr,
                      BSONType& nonDecimalTotalType,
                      BSONType& totalType,
                      DoubleDoubleSummation& nonDecimalTotal,
-                     Decimal128& decimalTotal) {
+                     DecimalSummation& decimalTotal) {
     tassert(6294002,
             "The partial sum's first element must be an int",
             arr[AggSumValueElems::kNonDecimalTotalTag].getType() == NumberInt);
@@ -97,7 +97,7 @@ void applyPartialSum(const std::vector<Value>& arr,
         tassert(6294005,
                 "The partial sum's last element must be a decimal",
                 arr[AggSumValueElems::kDecimalTotal].getType() == NumberDecimal);
-        decimalTotal = decimalTotal.add(arr[AggSumValueElems::kDecimalTotal].getDecimal());
+        decimalTotal.add(arr[AggSumValueElems::kDecimalTotal].getDecimal());
     }
 }
 
@@ -181,7 +181,7 @@ void AccumulatorSum::_processInternalNonConstant(
             nonDecimalTotal.addDouble(input.getDouble());
             break;
         case NumberDecimal:
-            decimalTotal = decimalTotal.add(input.coerceToDecimal());
+            decimalTotal.add(input.coerceToDecimal());
             break;
         default:
             MONGO_UNREACHABLE;
@@ -192,7 +192,7 @@ void AccumulatorSum::processInternal(const Value& input, bool merging) {
     if (merging) {
         // Convert a constant sum to a non constant one.
         if (std::holds_alternative<AccumulatorSum::ConstantSumState>(sum)) {
-            sum = std::make_pair<>(_constantSumToDoubleDoubleSummation(), Decimal128());
+            sum = std::make_pair<>(_constantSumToDoubleDoubleSummation(), DecimalSummation());
         }
 
         auto& nonConst = std::get<AccumulatorSum::NonConstantSumState>(sum);
@@ -288,7 +288,7 @@ Value AccumulatorSum::getValue(bool toBeMerged) {
                                   return serializePartialSum(nonDecimalTotalType,
                                                              totalType,
                                                              nonConstantSum.first,
-                                                             nonConstantSum.second);
+                                                             nonConstantSum.second.getDecimal());
                               }},
             sum);
     }
@@ -321,7 +321,8 @@ Value AccumulatorSum::getValue(bool toBeMerged) {
                                   }
                                   case NumberDecimal: {
                                       return Value(
-                                          nonConstantSum.second.add(nonDecimalTotal.getDecimal()));
+                                          nonConstantSum.second.getDecimal().add(
+                                              nonDecimalTotal.getDecimal()));
                                   }
                                   default:
                                       MONGO_UNREACHABLE;
@@ -363,7 +364,7 @@ AccumulatorSum::AccumulatorSum(ExpressionContext* const expCtx, boost::optional<
         nonDecimalTotalType = totalType;
         _initConstant(totalType);
     } else {
-        sum = std::make_pair<>(DoubleDoubleSummation(), Decimal128());
+        sum = std::make_pair<>(DoubleDoubleSummation(), DecimalSummation());
     }
 
     // This is a fixed size AccumulatorState so we never need to update this.
@@ -380,7 +381,7 @@ void AccumulatorSum::reset() {
     } else {
         totalType = NumberInt;
         nonDecimalTotalType = NumberInt;
-        sum = std::make_pair<DoubleDoubleSummation, Decimal128>({}, {});
+        sum = std::make_pair<DoubleDoubleSummation, DecimalSummation>({}, {});
     }
 }
 
@@ -55,6 +55,7 @@
 #include "mongo/db/pipeline/accumulator_for_window_functions.h"
 #include "mongo/db/pipeline/accumulator_js_reduce.h"
 #include "mongo/db/pipeline/accumulator_multi.h"
+#include "mongo/db/pipeline/accumulator_percentile.h"
 #include "mongo/db/pipeline/aggregation_context_fixture.h"
 #include "mongo/db/pipeline/expression_context_for_test.h"
 #include "mongo/db/pipeline/variables.h"
@@ -1759,6 +1760,30 @@ TEST(Accumulators, PushRespectsMaxMemoryConstraint) {
         ErrorCodes::ExceededMemoryLimit);
 }
 
+TEST(Accumulators, PercentileMergesPartialDigests) {
+    auto expCtx = ExpressionContextForTest{};
+    const std::vector<double> ps{0.5, 0.9};
+
+    // Each "shard" sees every third input and hands a serialized t-digest to the merger.
+    auto merger = AccumulatorPercentile::create(&expCtx, ps, PercentileMethod::Approximate);
+    const auto emptyMemUsage = merger->getMemUsage();
+    for (int shard = 0; shard < 3; ++shard) {
+        auto acc = AccumulatorPercentile::create(&expCtx, ps, PercentileMethod::Approximate);
+        for (int i = shard; i < 3000; i += 3) {
+            acc->process(Value(i), false /* merging */);
+        }
+        Value partial = acc->getValue(true /* toBeMerged */);
+        ASSERT_TRUE(partial.isArray());
+        merger->process(partial, true /* merging */);
+    }
+    ASSERT_GT(merger->getMemUsage(), emptyMemUsage);
+
+    Value result = merger->getValue(false /* toBeMerged */);
+    ASSERT_EQ(result.getArrayLength(), 2u);
+    ASSERT_APPROX_EQUAL(result.getArray()[0].getDouble(), 1500.0, 30.0);
+    ASSERT_APPROX_EQUAL(result.getArray()[1].getDouble(), 2700.0, 30.0);
+}
+
 /* ------------------------- AccumulatorCorvariance(Samp/Pop) -------------------------- */
 
 // Calculate covariance using the offline algorithm.
@@ -250,7 +250,8 @@ Document ChangeStreamDefaultEventTransformation::applyTransformation(const Docum
 
                 if (_changeStreamSpec.getShowRawUpdateDescription()) {
                     updateDescription = input[repl::OplogEntry::kObjectFieldName];
-                } else {
+                } else if (isFieldRequired(DocumentSourceChangeStream::kUpdateDescriptionField)) {
+                    // Parsing the diff is only worthwhile if a later stage can see the result.
                     auto deltaDesc = change_stream_document_diff_parser::parseDiff(
                         diffObj.getDocument().toBson());
 
@@ -463,7 +464,9 @@ Document ChangeStreamDefaultEventTransformation::applyTransformation(const Docum
     doc.addField(DocumentSourceChangeStream::kWallTimeField, wallTime);
 
     // Add the post-image, pre-image id, namespace, documentKey and other fields as appropriate.
-    doc.addField(DocumentSourceChangeStream::kFullDocumentField, std::move(fullDocument));
+    if (isFieldRequired(DocumentSourceChangeStream::kFullDocumentField)) {
+        doc.addField(DocumentSourceChangeStream::kFullDocumentField, std::move(fullDocument));
+    }
 
     // Determine whether the preImageId should be included, for eligible operations. Note that we
     // will include preImageId even if the user requested a post-image but no pre-image, because the
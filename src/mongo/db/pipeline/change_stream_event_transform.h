@@ -33,6 +33,7 @@
 #include <set>
 #include <string>
 
+#include <boost/optional/optional.hpp>
 #include <boost/smart_ptr/intrusive_ptr.hpp>
 
 #include "mongo/base/string_data.h"
@@ -64,7 +65,19 @@ public:
      */
     virtual std::set<std::string> getFieldNameDependencies() const = 0;
 
+    /**
+     * Limits the optional event fields such as 'fullDocument' and 'updateDescription' to the
+     * top-level fields in 'fields'. If 'fields' is boost::none, every field is produced.
+     */
+    void setRequiredFields(boost::optional<std::set<std::string>> fields) {
+        _requiredFields = std::move(fields);
+    }
+
 protected:
+    bool isFieldRequired(StringData fieldName) const {
+        return !_requiredFields || _requiredFields->count(fieldName.toString());
+    }
+
     // Construct a resume token for the specified event.
     ResumeTokenData makeResumeToken(Value tsVal,
                                     Value txnOpIndexVal,
@@ -82,6 +95,10 @@ protected:
 
     // Set to true if the post-image should be included in the output documents.
     bool _postImageRequested = false;
+
+    // The top-level event fields that later stages may read or return, or boost::none if they
+    // could depend on the whole event.
+    boost::optional<std::set<std::string>> _requiredFields;
 };
 
 /*
@@ -130,6 +147,10 @@ public:
         return accessedFields;
     }
 
+    void setRequiredFields(const boost::optional<std::set<std::string>>& fields) {
+        _defaultEventBuilder->setRequiredFields(fields);
+    }
+
 private:
     ChangeStreamEventTransformation* getBuilder(const Document& oplog) const;
 
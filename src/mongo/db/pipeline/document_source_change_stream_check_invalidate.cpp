@@ -192,6 +192,16 @@ DocumentSource::GetNextResult DocumentSourceChangeStreamCheckInvalidate::doGetNe
     return nextInput;
 }
 
+DepsTracker::State DocumentSourceChangeStreamCheckInvalidate::getDependencies(
+    DepsTracker* deps) const {
+    // These are the fields read from an invalidating event to build the invalidate entry.
+    deps->fields.insert(DSCS::kOperationTypeField.toString());
+    deps->fields.insert(DSCS::kIdField.toString());
+    deps->fields.insert(DSCS::kClusterTimeField.toString());
+    deps->fields.insert(DSCS::kWallTimeField.toString());
+    return DepsTracker::State::SEE_NEXT;
+}
+
 Value DocumentSourceChangeStreamCheckInvalidate::serialize(const SerializationOptions& opts) const {
     BSONObjBuilder builder;
     if (opts.verbosity) {
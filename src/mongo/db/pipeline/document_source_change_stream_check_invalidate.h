@@ -86,6 +86,8 @@ public:
 
     Value serialize(const SerializationOptions& opts = SerializationOptions{}) const final;
 
+    DepsTracker::State getDependencies(DepsTracker* deps) const final;
+
     void addVariableRefs(std::set<Variables::Id>* refs) const final {}
 
     static boost::intrusive_ptr<DocumentSourceChangeStreamCheckInvalidate> createFromBson(
@@ -107,6 +107,12 @@ public:
 
     Value serialize(const SerializationOptions& opts = SerializationOptions{}) const override;
 
+    DepsTracker::State getDependencies(DepsTracker* deps) const override {
+        // The resume token is read from the sort key, but is also reported from '_id' on error.
+        deps->fields.insert(DocumentSourceChangeStream::kIdField.toString());
+        return DepsTracker::State::SEE_NEXT;
+    }
+
     void addVariableRefs(std::set<Variables::Id>* refs) const final {}
 
     static boost::intrusive_ptr<DocumentSourceChangeStreamCheckResumability> createFromBson(
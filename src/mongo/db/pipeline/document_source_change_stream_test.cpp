@@ -77,6 +77,7 @@
 #include "mongo/db/pipeline/document_source_change_stream_unwind_transaction.h"
 #include "mongo/db/pipeline/document_source_match.h"
 #include "mongo/db/pipeline/document_source_mock.h"
+#include "mongo/db/pipeline/document_source_project.h"
 #include "mongo/db/pipeline/expression_context_for_test.h"
 #include "mongo/db/pipeline/pipeline.h"
 #include "mongo/db/pipeline/process_interface/stub_mongo_process_interface.h"
@@ -802,6 +803,37 @@ TEST_F(ChangeStreamStageTest, TransformUpdateFields) {
     checkTransformation(updateField, expectedUpdateField);
 }
 
+TEST_F(ChangeStreamStageTest, TransformSkipsUpdateDescriptionNotNeededByLaterStages) {
+    BSONObj o = BSON("diff" << BSON("u" << BSON("y" << 1)) << "$v" << 2);
+    BSONObj o2 = BSON("_id" << 1 << "x" << 2);
+    auto updateField = makeOplogEntry(OpTypeEnum::kUpdate,  // op type
+                                      nss,                  // namespace
+                                      o,                    // o
+                                      testUuid(),           // uuid
+                                      boost::none,          // fromMigrate
+                                      o2);                  // o2
+
+    auto stages = makeStages(updateField);
+    auto transform = stages[3];
+    ASSERT(dynamic_cast<DocumentSourceChangeStreamTransform*>(transform.get()));
+
+    // Optimize the transform as though the remaining stages were followed by an inclusion $project
+    // which does not need the update description.
+    Pipeline::SourceContainer container(std::next(stages.begin(), 3), stages.end());
+    container.push_back(DocumentSourceProject::createFromBson(
+        BSON("$project" << BSON(DSChangeStream::kOperationTypeField << 1)).firstElement(),
+        getExpCtx()));
+    transform->optimizeAt(container.begin(), &container);
+
+    auto next = transform->getNext();
+    ASSERT_TRUE(next.isAdvanced());
+    auto event = next.releaseDocument();
+    ASSERT_VALUE_EQ(event[DSChangeStream::kOperationTypeField],
+                    Value(DSChangeStream::kUpdateOpType));
+    ASSERT_FALSE(event[DSChangeStream::kIdField].missing());
+    ASSERT_TRUE(event[DSChangeStream::kUpdateDescriptionField].missing());
+}
+
 TEST_F(ChangeStreamStageTest, TransformUpdateFieldsShowExpandedEvents) {
     BSONObj diff = BSON("u" << BSON("y" << 1));
     BSONObj o = BSON("diff" << diff << "$v" << 2);
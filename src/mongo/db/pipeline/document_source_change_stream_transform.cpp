@@ -43,6 +43,7 @@
 #include "mongo/db/pipeline/change_stream_helpers.h"
 #include "mongo/db/pipeline/document_source_change_stream.h"
 #include "mongo/db/pipeline/document_source_change_stream_transform.h"
+#include "mongo/db/pipeline/field_path.h"
 #include "mongo/db/pipeline/resume_token.h"
 #include "mongo/idl/idl_parser.h"
 #include "mongo/util/assert_util.h"
@@ -224,6 +225,36 @@ DepsTracker::State DocumentSourceChangeStreamTransform::getDependencies(DepsTrac
     return DepsTracker::State::EXHAUSTIVE_ALL;
 }
 
+Pipeline::SourceContainer::iterator DocumentSourceChangeStreamTransform::doOptimizeAt(
+    Pipeline::SourceContainer::iterator itr, Pipeline::SourceContainer* container) {
+    invariant(*itr == this);
+
+    // Collect the top-level fields read by each later stage until one of them reports an
+    // exhaustive set of fields. We deliberately do not discount fields generated by those stages:
+    // e.g. the post-image stage only replaces 'fullDocument' for some event types.
+    auto requiredFields = [&]() -> boost::optional<std::set<std::string>> {
+        std::set<std::string> fields;
+        for (auto it = std::next(itr); it != container->end(); ++it) {
+            DepsTracker deps;
+            auto state = (*it)->getDependencies(&deps);
+            if (state == DepsTracker::State::NOT_SUPPORTED || deps.needWholeDocument) {
+                return boost::none;
+            }
+            for (auto&& path : deps.fields) {
+                fields.insert(FieldPath::extractFirstFieldFromDottedPath(path).toString());
+            }
+            if (state & DepsTracker::State::EXHAUSTIVE_FIELDS) {
+                return fields;
+            }
+        }
+        // The whole event may be returned to the client.
+        return boost::none;
+    }();
+    _transformer.setRequiredFields(requiredFields);
+
+    return std::next(itr);
+}
+
 DocumentSource::GetModPathsReturn DocumentSourceChangeStreamTransform::getModifiedPaths() const {
     // All paths are modified.
     return {DocumentSource::GetModPathsReturn::Type::kAllPaths, OrderedPathSet{}, {}};
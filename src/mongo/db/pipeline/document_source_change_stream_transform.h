@@ -88,6 +88,13 @@ public:
 protected:
     DocumentSource::GetNextResult doGetNext() override;
 
+    /**
+     * Passes the fields needed by the rest of the pipeline to the event transformer, so that it can
+     * avoid building parts of the event which would be discarded anyway.
+     */
+    Pipeline::SourceContainer::iterator doOptimizeAt(Pipeline::SourceContainer::iterator itr,
+                                                     Pipeline::SourceContainer* container) final;
+
 private:
     // This constructor is private, callers should use the 'create()' method above.
     DocumentSourceChangeStreamTransform(const boost::intrusive_ptr<ExpressionContext>& expCtx,
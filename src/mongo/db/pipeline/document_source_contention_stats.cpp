@@ -0,0 +1,113 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/db/pipeline/document_source_contention_stats.h"
+
+#include <algorithm>
+#include <deque>
+#include <fmt/format.h>
+#include <iterator>
+#include <vector>
+
+#include "mongo/base/error_codes.h"
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/db/concurrency/contention_profiler.h"
+#include "mongo/db/exec/document_value/document.h"
+#include "mongo/db/pipeline/document_source_queue.h"
+#include "mongo/db/query/allowed_contexts.h"
+#include "mongo/util/assert_util.h"
+#include "mongo/util/intrusive_counter.h"
+#include "mongo/util/stacktrace.h"
+#include "mongo/util/str.h"
+
+namespace mongo {
+namespace {
+
+Document makeDocumentFromEntry(const ContentionProfiler::Entry& entry) {
+    BSONObjBuilder bob;
+    bob.append("source", ContentionProfiler::toString(entry.source));
+    bob.append("resource", entry.resource);
+    bob.append("stackId", fmt::format("{:016x}", entry.stackId));
+    bob.append("samples", entry.samples);
+    bob.append("totalWaitMicros", entry.totalWaitMicros);
+    bob.append("maxWaitMicros", entry.maxWaitMicros);
+
+    BSONArrayBuilder frames(bob.subarrayStart("stack"));
+#ifndef _WIN32
+    StackTraceAddressMetadataGenerator metaGen;
+    for (void* address : entry.frames) {
+        const auto& meta = metaGen.load(address);
+        BSONObjBuilder frame(frames.subobjStart());
+        frame.append("address", fmt::format("{:#x}", meta.address()));
+        if (meta.file()) {
+            frame.append("file", meta.file().name());
+        }
+        if (meta.symbol()) {
+            frame.append("symbol", meta.symbol().name());
+            frame.append("offset", fmt::format("{:#x}", meta.address() - meta.symbol().base()));
+        }
+    }
+#endif
+    frames.done();
+    return Document(bob.obj());
+}
+
+}  // namespace
+
+REGISTER_DOCUMENT_SOURCE(contentionStats,
+                         DocumentSourceContentionStats::LiteParsed::parse,
+                         DocumentSourceContentionStats::createFromBson,
+                         AllowedWithApiStrict::kNeverInVersion1);
+
+boost::intrusive_ptr<DocumentSource> DocumentSourceContentionStats::createFromBson(
+    BSONElement spec, const boost::intrusive_ptr<ExpressionContext>& pExpCtx) {
+    uassert(ErrorCodes::BadValue,
+            str::stream() << kStageName << " must be run as { " << kStageName << ": {}}",
+            spec.isABSONObj() && spec.Obj().isEmpty());
+
+    const NamespaceString& nss = pExpCtx->ns;
+    uassert(ErrorCodes::InvalidNamespace,
+            str::stream() << kStageName
+                          << " must be run against the 'admin' database with {aggregate: 1}",
+            nss.isAdminDB() && nss.isCollectionlessAggregateNS());
+
+    auto entries = ContentionProfiler::get().getEntries();
+    std::sort(entries.begin(), entries.end(), [](const auto& a, const auto& b) {
+        return a.totalWaitMicros > b.totalWaitMicros;
+    });
+
+    std::deque<DocumentSource::GetNextResult> queue;
+    std::transform(
+        entries.begin(), entries.end(), std::back_inserter(queue), makeDocumentFromEntry);
+
+    return make_intrusive<DocumentSourceQueue>(
+        std::move(queue), pExpCtx, kStageName, Value(DOC(kStageName << Document())));
+}
+
+}  // namespace mongo
@@ -1047,6 +1047,35 @@ private:
     }
 };
 
+class StreamingAllowsNullishAndArrayIds final : public CheckResultsBase {
+public:
+    StreamingAllowsNullishAndArrayIds() : CheckResultsBase(GroupStageType::Streaming) {}
+
+private:
+    std::deque<DocumentSource::GetNextResult> inputData() final {
+        // Sorted by "a" as an index on it would return them: the arrays sort by their minimum
+        // element, so the array groups are interleaved with the scalar group of 2.
+        return {Document(BSON("a" << 1 << "b" << 1)),
+                Document(BSON("a" << 1 << "b" << 2)),
+                Document(BSON("a" << 2 << "b" << 3)),
+                Document(BSON("a" << BSON_ARRAY(2 << 5) << "b" << 4)),
+                Document(BSON("a" << 2 << "b" << 5)),
+                Document(BSON("a" << BSON_ARRAY(2 << 5) << "b" << 6))};
+    }
+    BSONObj groupSpec() final {
+        return BSON("_id"
+                    << "$a"
+                    << "sum"
+                    << BSON("$sum"
+                            << "$b")
+                    << "$monotonicIdFields" << BSON_ARRAY("_id") << "$allowNullishOrArrayIds"
+                    << true);
+    }
+    std::string expectedResultSetString() final {
+        return "[{_id:1,sum:3},{_id:2,sum:8},{_id:[2,5],sum:10}]";
+    }
+};
+
 constexpr size_t kBigStringSize = 1024;
 const std::string kBigString(kBigStringSize, 'a');
 
@@ -1342,6 +1371,7 @@ public:
         add<ArrayConstantAccumulatorExpression>();
 
         add<StreamingSimple>();
+        add<StreamingAllowsNullishAndArrayIds>();
         add<WithoutStreamingSpills>();
         add<StreamingDoesNotSpill>();
         add<StreamingCanSpill>();
@@ -573,6 +573,23 @@ std::unique_ptr<AccumulationExpression> rewriteMinMaxGroupAccm(
     return std::make_unique<AccumulationExpression>(std::move(accExpr));
 }
 
+std::unique_ptr<AccumulationExpression> rewriteFirstLastGroupAccm(
+    boost::intrusive_ptr<ExpressionContext> pExpCtx,
+    const mongo::AccumulationStatement& stmt,
+    const boost::optional<std::string>& metaField) {
+    // All measurements in a bucket share the bucket's meta value and are unpacked in bucket order,
+    // so $first/$last over a path at or under the metaField is the $first/$last of the bucket-level
+    // meta. No other field can be rewritten: the control fields don't record the first and last
+    // measurements of a bucket.
+    if (!fieldPathsAccessOnlyMetaField(stmt.expr.argument, metaField)) {
+        return {};
+    }
+
+    AccumulationExpression accExpr = stmt.expr;
+    accExpr.argument = rewriteMetaFieldPaths(pExpCtx, metaField, stmt.expr.argument);
+    return std::make_unique<AccumulationExpression>(std::move(accExpr));
+}
+
 boost::intrusive_ptr<Expression> rewriteGroupByField(
     boost::intrusive_ptr<ExpressionContext> pExpCtx,
     const std::vector<boost::intrusive_ptr<Expression>>& idFieldExpressions,
@@ -1211,9 +1228,9 @@ DocumentSourceInternalUnpackBucket::rewriteGroupStage(Pipeline::SourceContainer:
     std::vector<AccumulationStatement> accumulationStatementsBucket;
     for (const AccumulationStatement& stmt : groupPtr->getAccumulationStatements()) {
         const auto& op = stmt.expr.name;
-        // If _any_ of the accumulators aren't $min/$max/$count we won't perform the re-write (some
-        // other accs might be re-writable in terms of the bucket controls, we just haven't invested
-        // into implementing them). $count is desugared to {$sum: 1}.
+        // If _any_ of the accumulators aren't $min/$max/$count/$first/$last we won't perform the
+        // re-write (some other accs might be re-writable in terms of the bucket controls, we just
+        // haven't invested into implementing them). $count is desugared to {$sum: 1}.
         std::unique_ptr<AccumulationExpression> accExpr;
         if (op == "$min" || op == "$max") {
             accExpr = rewriteMinMaxGroupAccm(pExpCtx, stmt, metaField, timeField);
@@ -1225,6 +1242,11 @@ DocumentSourceInternalUnpackBucket::rewriteGroupStage(Pipeline::SourceContainer:
             if (!accExpr) {
                 return {};
             }
+        } else if (op == "$first" || op == "$last") {
+            accExpr = rewriteFirstLastGroupAccm(pExpCtx, stmt, metaField);
+            if (!accExpr) {
+                return {};
+            }
         } else {
             return {};
         }
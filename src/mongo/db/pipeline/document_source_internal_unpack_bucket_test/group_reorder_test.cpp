@@ -309,8 +309,41 @@ TEST_F(InternalUnpackBucketGroupReorder, MaxGroupRewriteTimeField) {
     ASSERT_BSONOBJ_EQ(optimized, serialized[0]);
 }
 
+TEST_F(InternalUnpackBucketGroupReorder, FirstLastGroupOnMetaField) {
+    // $first and $last over the metaField can read the bucket-level meta, since every measurement
+    // in a bucket has the same meta value.
+    auto groupSpecObj = fromjson(
+        "{$group: {_id: '$meta1.a', accfirst: {$first: '$meta1.b'}, acclast: {$last: '$meta1'}, "
+        "accmax: {$max: '$c'}}}");
+
+    auto serialized = makeAndOptimizePipeline(
+        getExpCtx(), groupSpecObj, 3600 /* bucketMaxSpanSeconds */, false /* fixedBuckets */);
+    ASSERT_EQ(1, serialized.size());
+
+    auto optimized = fromjson(
+        "{$group: {_id: '$meta.a', accfirst: {$first: '$meta.b'}, acclast: {$last: '$meta'}, "
+        "accmax: {$max: '$control.max.c'}}}");
+    ASSERT_BSONOBJ_EQ(optimized, serialized[0]);
+}
+
 // The following tests confirms the $group rewrite does not apply when some requirements are not
 // met.
+TEST_F(InternalUnpackBucketGroupReorder, FirstLastGroupOnMeasurementFieldNegative) {
+    // This rewrite does not apply because the control fields don't record the first or last
+    // measurement of a bucket.
+    auto groupSpecObj = fromjson("{$group: {_id: '$meta1', accfirst: {$first: '$b'}}}");
+
+    auto serialized = makeAndOptimizePipeline(
+        getExpCtx(), groupSpecObj, 3600 /* bucketMaxSpanSeconds */, false /* fixedBuckets */);
+    ASSERT_EQ(2, serialized.size());
+
+    auto unpackSpecObj = fromjson(
+        "{$_internalUnpackBucket: { include: ['a', 'b', 'c'], timeField: 't', metaField: 'meta1', "
+        "bucketMaxSpanSeconds: 3600}}");
+    ASSERT_BSONOBJ_EQ(unpackSpecObj, serialized[0]);
+    ASSERT_BSONOBJ_EQ(groupSpecObj, serialized[1]);
+}
+
 TEST_F(InternalUnpackBucketGroupReorder, MinMaxGroupOnMetadataNegative) {
     // This rewrite does not apply because the $group stage uses the $sum accumulator.
     auto groupSpecObj =
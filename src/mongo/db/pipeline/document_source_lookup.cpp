@@ -58,6 +58,7 @@
 #include "mongo/db/matcher/expression_parser.h"
 #include "mongo/db/namespace_string.h"
 #include "mongo/db/pipeline/aggregation_request_helper.h"
+#include "mongo/db/pipeline/dependencies.h"
 #include "mongo/db/pipeline/document_path_support.h"
 #include "mongo/db/pipeline/document_source_documents.h"
 #include "mongo/db/pipeline/document_source_merge_gen.h"
@@ -242,7 +243,7 @@ DocumentSourceLookUp::DocumentSourceLookUp(
     const boost::intrusive_ptr<ExpressionContext>& expCtx)
     : DocumentSource(kStageName, expCtx),
       _fromNs(std::move(fromNs)),
-      _as(std::move(as)),
+      _as(std::move(as), true /* precomputeHashes */),
       _variables(expCtx->variables),
       _variablesParseState(expCtx->variablesParseState.copyWith(_variables.useIdGenerator())) {
     if (!_fromNs.isOnInternalDb()) {
@@ -339,6 +340,7 @@ DocumentSourceLookUp::DocumentSourceLookUp(
     }
 
     initializeResolvedIntrospectionPipeline();
+    initializeResultCache();
 }
 
 DocumentSourceLookUp::DocumentSourceLookUp(const DocumentSourceLookUp& original,
@@ -368,6 +370,7 @@ DocumentSourceLookUp::DocumentSourceLookUp(const DocumentSourceLookUp& original,
     if (original._unwindSrc) {
         _unwindSrc = static_cast<DocumentSourceUnwind*>(original._unwindSrc->clone(pExpCtx).get());
     }
+    initializeResultCache();
 }
 
 boost::intrusive_ptr<DocumentSource> DocumentSourceLookUp::clone(
@@ -576,6 +579,25 @@ DocumentSource::GetNextResult DocumentSourceLookUp::doGetNext() {
     // '_unwindSrc' would be non-null, and we would not have made it here.
     invariant(!_matchSrc);
 
+    // If this input binds the same 'let' values as a recent one, reuse the results computed then
+    // rather than running the sub-pipeline again.
+    boost::optional<Value> resultCacheKey;
+    if (_resultCache) {
+        resultCacheKey = computeResultCacheKey(inputDoc);
+        if (auto cachedResults = (*_resultCache)[*resultCacheKey]) {
+            ++_stats.resultCacheHits;
+            std::vector<Value> results;
+            results.reserve(cachedResults->size());
+            for (auto&& result : *cachedResults) {
+                results.emplace_back(result);
+            }
+            MutableDocument output(std::move(inputDoc));
+            output.setNestedField(_as, Value(std::move(results)));
+            return output.freeze();
+        }
+        ++_stats.resultCacheMisses;
+    }
+
     std::unique_ptr<Pipeline, PipelineDeleter> pipeline;
     try {
         pipeline = buildPipeline(_fromExpCtx, inputDoc);
@@ -614,6 +636,23 @@ DocumentSource::GetNextResult DocumentSourceLookUp::doGetNext() {
     // Check if pipeline uses disk.
     _stats.planSummaryStats.usedDisk = _stats.planSummaryStats.usedDisk || pipeline->usedDisk();
 
+    if (resultCacheKey) {
+        // A result set which does not fit in the cache on its own is not kept, since it would only
+        // evict every other entry before being evicted itself.
+        const auto maxCacheSizeBytes =
+            static_cast<size_t>(internalDocumentSourceLookupResultCacheSizeBytes.load());
+        if (static_cast<size_t>(objsize) + resultCacheKey->getApproximateSize() <=
+            maxCacheSizeBytes) {
+            std::vector<Document> cachedResults;
+            cachedResults.reserve(results.size());
+            for (auto&& result : results) {
+                cachedResults.push_back(result.getDocument());
+            }
+            _resultCache->insertAll(std::move(*resultCacheKey), std::move(cachedResults));
+        }
+        _resultCache->evictDownTo(maxCacheSizeBytes);
+    }
+
     MutableDocument output(std::move(inputDoc));
     output.setNestedField(_as, Value(std::move(results)));
     return output.freeze();
@@ -1118,6 +1157,36 @@ void DocumentSourceLookUp::resolveLetVariables(const Document& localDoc, Variabl
     }
 }
 
+void DocumentSourceLookUp::initializeResultCache() {
+    if (internalDocumentSourceLookupResultCacheSizeBytes.load() == 0 || _letVariables.empty() ||
+        hasLocalFieldForeignFieldJoin()) {
+        return;
+    }
+
+    // The sub-pipeline can only see the 'let' variables and variables which are fixed for the
+    // whole query, so its results are determined by the 'let' values unless one of its stages
+    // does not report its dependencies or generates random numbers.
+    DepsTracker deps(DepsTracker::kNoMetadata);
+    for (auto&& source : _resolvedIntrospectionPipeline->getSources()) {
+        if (source->getDependencies(&deps) == DepsTracker::State::NOT_SUPPORTED ||
+            deps.needRandomGenerator) {
+            return;
+        }
+    }
+
+    _resultCache.emplace(ValueComparator::kInstance);
+}
+
+Value DocumentSourceLookUp::computeResultCacheKey(const Document& inputDoc) const {
+    BSONObjBuilder keyBuilder;
+    for (auto&& letVar : _letVariables) {
+        letVar.expression->evaluate(inputDoc, &pExpCtx->variables)
+            .addToBsonObj(&keyBuilder, letVar.name);
+    }
+    auto key = keyBuilder.done();
+    return Value(BSONBinData(key.objdata(), key.objsize(), BinDataGeneral));
+}
+
 void DocumentSourceLookUp::initializeResolvedIntrospectionPipeline() {
     _variables.copyToExpCtx(_variablesParseState, _fromExpCtx.get());
     _fromExpCtx->startExpressionCounters();
@@ -1137,6 +1206,10 @@ void DocumentSourceLookUp::appendSpecificExecStats(MutableDocument& doc) const {
                    std::back_inserter(indexesUsedVec),
                    [](std::string idx) -> Value { return Value(idx); });
     doc["indexesUsed"] = Value{std::move(indexesUsedVec)};
+    if (_resultCache) {
+        doc["resultCacheHits"] = Value(_stats.resultCacheHits);
+        doc["resultCacheMisses"] = Value(_stats.resultCacheMisses);
+    }
 }
 
 void DocumentSourceLookUp::serializeToArray(std::vector<Value>& array,
@@ -1238,6 +1311,10 @@ DepsTracker::State DocumentSourceLookUp::getDependencies(DepsTracker* deps) cons
             source->getDependencies(&subDeps);
         }
 
+        // The results of the subpipeline are only repeatable if it does not generate random
+        // numbers, which matters to anything caching the output of this $lookup.
+        deps->needRandomGenerator |= subDeps.needRandomGenerator;
+
         // Add the 'let' dependencies to the tracker.
         for (auto&& letVar : _letVariables) {
             expression::addDependencies(letVar.expression.get(), deps);
@@ -399,6 +399,21 @@ private:
      */
     void initializeResolvedIntrospectionPipeline();
 
+    /**
+     * Enables '_resultCache' if this $lookup binds 'let' variables and the results of its
+     * sub-pipeline are fully determined by their values, so that the results can be reused for
+     * input documents which bind the same values. Must be called after the resolved introspection
+     * pipeline has been built.
+     */
+    void initializeResultCache();
+
+    /**
+     * Returns the key of '_resultCache' for the values bound to the 'let' variables by 'inputDoc'.
+     * The values are compared by their BSON representation, so that values which only compare
+     * equal, such as 1 and 1.0 or strings equal under a collation, are kept apart.
+     */
+    Value computeResultCacheKey(const Document& inputDoc) const;
+
     /**
      * Builds the $lookup pipeline using the resolved view definition for a sharded foreign view and
      * updates the '_resolvedPipeline', as well as '_fieldMatchPipelineIdx' in the case of a
@@ -485,6 +500,11 @@ private:
     // from a cursor source.
     boost::optional<SequentialDocumentCache> _cache;
 
+    // Remembers the results of the sub-pipeline for the most recently used values of the 'let'
+    // variables, up to 'internalDocumentSourceLookupResultCacheSizeBytes'. Only present when the
+    // sub-pipeline depends on nothing but those values; see initializeResultCache().
+    boost::optional<LookupSetCache> _resultCache;
+
     // The ExpressionContext used when performing aggregation pipelines against the '_resolvedNs'
     // namespace.
     boost::intrusive_ptr<ExpressionContext> _fromExpCtx;
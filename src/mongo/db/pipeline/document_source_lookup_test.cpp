@@ -1542,6 +1542,60 @@ TEST_F(DocumentSourceLookUpTest, ShouldNotCacheIfCorrelatedStageIsAbsorbedIntoPl
     ASSERT_VALUE_EQ(Value(subPipeline->writeExplainOps(kExplain)), Value(BSONArray(expectedPipe)));
 }
 
+TEST_F(DocumentSourceLookUpTest, ShouldReuseResultsForRepeatedLetValues) {
+    auto expCtx = getExpCtx();
+    NamespaceString fromNs =
+        NamespaceString::createNamespaceString_forTest(boost::none, "test", "coll");
+    expCtx->setResolvedNamespaces(StringMap<ExpressionContext::ResolvedNamespace>{
+        {fromNs.coll().toString(), {fromNs, std::vector<BSONObj>()}}});
+
+    std::deque<DocumentSource::GetNextResult> mockForeignContents{
+        Document{{"x", 1}}, Document{{"x", 2}}, Document{{"x", 1}}};
+    expCtx->mongoProcessInterface = std::make_shared<MockMongoInterface>(mockForeignContents);
+
+    auto docSource = DocumentSourceLookUp::createFromBson(
+        fromjson("{$lookup: {let: {var1: '$k'}, pipeline: [{$match: {$expr: {$eq: ['$x', "
+                 "'$$var1']}}}, {$project: {_id: 0, x: 1}}], from: 'coll', as: 'as'}}")
+            .firstElement(),
+        expCtx);
+
+    auto lookupStage = static_cast<DocumentSourceLookUp*>(docSource.get());
+    ASSERT(lookupStage);
+
+    // The value 1.0 compares equal to 1, but is kept apart from it since it has a different type.
+    auto mockLocalSource = DocumentSourceMock::createForTest({Document{{"_id", 0}, {"k", 1}},
+                                                              Document{{"_id", 1}, {"k", 3}},
+                                                              Document{{"_id", 2}, {"k", 1}},
+                                                              Document{{"_id", 3}, {"k", 3}},
+                                                              Document{{"_id", 4}, {"k", 1.0}}},
+                                                             expCtx);
+    lookupStage->setSource(mockLocalSource.get());
+
+    auto next = lookupStage->getNext();
+    ASSERT(next.isAdvanced());
+    ASSERT_DOCUMENT_EQ(Document{fromjson("{_id: 0, k: 1, as: [{x: 1}, {x: 1}]}")},
+                       next.getDocument());
+    next = lookupStage->getNext();
+    ASSERT(next.isAdvanced());
+    ASSERT_DOCUMENT_EQ(Document{fromjson("{_id: 1, k: 3, as: []}")}, next.getDocument());
+    next = lookupStage->getNext();
+    ASSERT(next.isAdvanced());
+    ASSERT_DOCUMENT_EQ(Document{fromjson("{_id: 2, k: 1, as: [{x: 1}, {x: 1}]}")},
+                       next.getDocument());
+    next = lookupStage->getNext();
+    ASSERT(next.isAdvanced());
+    ASSERT_DOCUMENT_EQ(Document{fromjson("{_id: 3, k: 3, as: []}")}, next.getDocument());
+    next = lookupStage->getNext();
+    ASSERT(next.isAdvanced());
+    ASSERT_DOCUMENT_EQ(Document{fromjson("{_id: 4, k: 1.0, as: [{x: 1}, {x: 1}]}")},
+                       next.getDocument());
+    ASSERT(lookupStage->getNext().isEOF());
+
+    auto stats = static_cast<const DocumentSourceLookupStats*>(lookupStage->getSpecificStats());
+    ASSERT_EQ(stats->resultCacheHits, 2);
+    ASSERT_EQ(stats->resultCacheMisses, 3);
+}
+
 TEST_F(DocumentSourceLookUpTest, IncrementNestedAggregateOpCounterOnCreateButNotOnCopy) {
     auto testOpCounter = [&](const NamespaceString& nss, const int expectedIncrease) {
         auto resolvedNss = StringMap<ExpressionContext::ResolvedNamespace>{
@@ -97,7 +97,12 @@ DocumentSource::GetNextResult DocumentSourceSample::doGetNext() {
 }
 
 Value DocumentSourceSample::serialize(const SerializationOptions& opts) const {
-    return Value(DOC(kStageName << DOC("size" << opts.serializeLiteral(_size))));
+    MutableDocument spec;
+    spec["size"] = opts.serializeLiteral(_size);
+    if (_blockSize > 1) {
+        spec["blockSize"] = opts.serializeLiteral(_blockSize);
+    }
+    return Value(DOC(kStageName << spec.freezeToValue()));
 }
 
 namespace {
@@ -111,6 +116,7 @@ intrusive_ptr<DocumentSource> DocumentSourceSample::createFromBson(
 
     bool sizeSpecified = false;
     long long size;
+    long long blockSize = 1;
     for (auto&& elem : specElem.embeddedObject()) {
         auto fieldName = elem.fieldNameStringData();
 
@@ -118,21 +124,29 @@ intrusive_ptr<DocumentSource> DocumentSourceSample::createFromBson(
             uassert(28746, "size argument to $sample must be a number", elem.isNumber());
             size = elem.safeNumberLong();
             sizeSpecified = true;
+        } else if (fieldName == "blockSize") {
+            uassert(9156658, "blockSize argument to $sample must be a number", elem.isNumber());
+            blockSize = elem.safeNumberLong();
         } else {
             uasserted(28748, str::stream() << "unrecognized option to $sample: " << fieldName);
         }
     }
     uassert(28749, "$sample stage must specify a size", sizeSpecified);
 
-    return DocumentSourceSample::create(expCtx, size);
+    return DocumentSourceSample::create(expCtx, size, blockSize);
 }
 
 boost::intrusive_ptr<DocumentSource> DocumentSourceSample::create(
-    const boost::intrusive_ptr<ExpressionContext>& expCtx, long long size) {
+    const boost::intrusive_ptr<ExpressionContext>& expCtx, long long size, long long blockSize) {
     uassert(28747, "size argument to $sample must not be negative", size >= 0);
+    uassert(9156659,
+            str::stream() << "blockSize argument to $sample must be between 1 and "
+                          << kMaxBlockSize,
+            blockSize >= 1 && blockSize <= kMaxBlockSize);
 
     intrusive_ptr<DocumentSourceSample> sample(new DocumentSourceSample(expCtx));
     sample->_size = size;
+    sample->_blockSize = blockSize;
     sample->_sortStage = DocumentSourceSort::create(expCtx, {randSortSpec, expCtx}, sample->_size);
     return sample;
 }
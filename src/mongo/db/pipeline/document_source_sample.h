@@ -80,13 +80,22 @@ public:
         return _size;
     }
 
+    long long getBlockSize() const {
+        return _blockSize;
+    }
+
     void addVariableRefs(std::set<Variables::Id>* refs) const final {}
 
     static boost::intrusive_ptr<DocumentSource> createFromBson(
         BSONElement elem, const boost::intrusive_ptr<ExpressionContext>& expCtx);
 
     static boost::intrusive_ptr<DocumentSource> create(
-        const boost::intrusive_ptr<ExpressionContext>& expCtx, long long size);
+        const boost::intrusive_ptr<ExpressionContext>& expCtx,
+        long long size,
+        long long blockSize = 1);
+
+    // Upper bound for the 'blockSize' option.
+    static constexpr long long kMaxBlockSize = 1000;
 
 private:
     explicit DocumentSourceSample(const boost::intrusive_ptr<ExpressionContext>& pExpCtx);
@@ -95,6 +104,11 @@ private:
 
     long long _size;
 
+    // When the sample is served by a storage engine random cursor, the number of consecutive
+    // records read from each random position. Values greater than 1 give up the independence of
+    // the sampled documents in exchange for fewer random seeks.
+    long long _blockSize = 1;
+
     // Uses a $sort stage to randomly sort the documents.
     boost::intrusive_ptr<DocumentSourceSort> _sortStage;
 };
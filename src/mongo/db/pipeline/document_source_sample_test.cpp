@@ -248,6 +248,31 @@ TEST_F(InvalidSampleSpec, MissingSize) {
     ASSERT_THROWS_CODE(createSample(createSpec(BSONObj())), AssertionException, 28749);
 }
 
+TEST_F(InvalidSampleSpec, InvalidBlockSize) {
+    ASSERT_THROWS_CODE(createSample(createSpec(BSON("size" << 1 << "blockSize"
+                                                           << "string"))),
+                       AssertionException,
+                       9156658);
+    ASSERT_THROWS_CODE(createSample(createSpec(BSON("size" << 1 << "blockSize" << 0))),
+                       AssertionException,
+                       9156659);
+    ASSERT_THROWS_CODE(
+        createSample(createSpec(
+            BSON("size" << 1 << "blockSize" << DocumentSourceSample::kMaxBlockSize + 1))),
+        AssertionException,
+        9156659);
+}
+
+TEST_F(InvalidSampleSpec, BlockSizeRoundTrips) {
+    auto sample = createSample(createSpec(BSON("size" << 10 << "blockSize" << 8)));
+    ASSERT_EQ(static_cast<DocumentSourceSample*>(sample.get())->getBlockSize(), 8);
+
+    std::vector<Value> serialized;
+    sample->serializeToArray(serialized);
+    ASSERT_BSONOBJ_EQ(serialized[0].getDocument().toBson(),
+                      BSON("$sample" << BSON("size" << 10LL << "blockSize" << 8LL)));
+}
+
 //
 // Test the implementation that gets results from a random cursor.
 //
@@ -101,7 +101,8 @@ boost::intrusive_ptr<DocumentSourceStreamingGroup> DocumentSourceStreamingGroup:
     const boost::intrusive_ptr<Expression>& groupByExpression,
     std::vector<size_t> monotonicExpressionIndexes,
     std::vector<AccumulationStatement> accumulationStatements,
-    boost::optional<int64_t> maxMemoryUsageBytes) {
+    boost::optional<int64_t> maxMemoryUsageBytes,
+    bool allowNullishOrArrayIds) {
     boost::intrusive_ptr<DocumentSourceStreamingGroup> groupStage =
         new DocumentSourceStreamingGroup(expCtx, maxMemoryUsageBytes);
     groupStage->_groupProcessor.setIdExpression(groupByExpression);
@@ -119,6 +120,7 @@ boost::intrusive_ptr<DocumentSourceStreamingGroup> DocumentSourceStreamingGroup:
                             return i < groupStage->_groupProcessor.getIdExpressions().size();
                         }));
     groupStage->_monotonicExpressionIndexes = std::move(monotonicExpressionIndexes);
+    groupStage->_allowNullishOrArrayIds = allowNullishOrArrayIds;
     return groupStage;
 }
 
@@ -165,6 +167,15 @@ boost::intrusive_ptr<DocumentSource> DocumentSourceStreamingGroup::createFromBso
                   groupStage->_monotonicExpressionIndexes.end());
     }
 
+    const auto& allowNullishOrArrayIdsElem =
+        elem.Obj().getField(kAllowNullishOrArrayIdsSpecField);
+    if (!allowNullishOrArrayIdsElem.eoo()) {
+        uassert(9156639,
+                kAllowNullishOrArrayIdsSpecField + " must be a boolean",
+                allowNullishOrArrayIdsElem.type() == Bool);
+        groupStage->_allowNullishOrArrayIds = allowNullishOrArrayIdsElem.boolean();
+    }
+
     return groupStage;
 }
 
@@ -180,10 +191,14 @@ void DocumentSourceStreamingGroup::serializeAdditionalFields(
         }
     }
     out[kMonotonicIdFieldsSpecField] = Value(std::move(monotonicIdFields));
+    if (_allowNullishOrArrayIds) {
+        out[kAllowNullishOrArrayIdsSpecField] = Value(true);
+    }
 }
 
 bool DocumentSourceStreamingGroup::isSpecFieldReserved(StringData fieldName) {
-    return fieldName == kMonotonicIdFieldsSpecField;
+    return fieldName == kMonotonicIdFieldsSpecField ||
+        fieldName == kAllowNullishOrArrayIdsSpecField;
 }
 
 DocumentSource::GetNextResult DocumentSourceStreamingGroup::getNextDocument() {
@@ -238,6 +253,10 @@ DocumentSourceStreamingGroup::readyNextBatchInner(GetNextResult input) {
 }
 
 bool DocumentSourceStreamingGroup::isBatchFinished(const Value& id) {
+    if (_streamingStopped) {
+        return false;
+    }
+
     if (_groupProcessor.getIdExpressions().size() == 1) {
         tassert(7026706,
                 "if there are no explicit id fields, it is only one monotonic expression with id 0",
@@ -255,6 +274,20 @@ bool DocumentSourceStreamingGroup::isBatchFinished(const Value& id) {
 template <typename IdValueGetter>
 bool DocumentSourceStreamingGroup::checkForBatchEndAndUpdateLastIdValues(
     const IdValueGetter& idValueGetter) {
+    if (_allowNullishOrArrayIds &&
+        std::any_of(_monotonicExpressionIndexes.begin(),
+                    _monotonicExpressionIndexes.end(),
+                    [&](size_t i) {
+                        const Value& value = idValueGetter(i);
+                        return value.nullish() || value.isArray();
+                    })) {
+        // See below for why these values can't be streamed. Every batch finished so far held only
+        // scalar ids that precede this one in the input order, so none of the remaining input can
+        // belong to them, and it is safe to group all of it as the current batch.
+        _streamingStopped = true;
+        return false;
+    }
+
     auto assertStreamable = [&](Value value) {
         // Nullish and array values will mess us up because they sort differently than they group.
         // A null and a missing value will compare equal in sorting, but could result in different
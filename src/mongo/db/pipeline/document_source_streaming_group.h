@@ -82,13 +82,18 @@ public:
      * Convenience method for creating a new $_internalStreamingGroup stage. If maxMemoryUsageBytes
      * is boost::none, then it will actually use the value of
      * internalDocumentSourceGroupMaxMemoryBytes.
+     *
+     * Unless 'allowNullishOrArrayIds' is set, a missing, null or array value of a monotonic id
+     * expression is an error. If it is set, such a value stops the streaming instead, and the rest
+     * of the input is grouped as a single batch.
      */
     static boost::intrusive_ptr<DocumentSourceStreamingGroup> create(
         const boost::intrusive_ptr<ExpressionContext>& expCtx,
         const boost::intrusive_ptr<Expression>& groupByExpression,
         std::vector<size_t> monotonicExpressionIndexes,
         std::vector<AccumulationStatement> accumulationStatements,
-        boost::optional<int64_t> maxMemoryUsageBytes = boost::none);
+        boost::optional<int64_t> maxMemoryUsageBytes = boost::none,
+        bool allowNullishOrArrayIds = false);
 
     /**
      * Parses 'elem' into a $_internalStreamingGroup stage, or throws a AssertionException if 'elem'
@@ -111,6 +116,7 @@ protected:
 
 private:
     static constexpr StringData kMonotonicIdFieldsSpecField = "$monotonicIdFields"_sd;
+    static constexpr StringData kAllowNullishOrArrayIdsSpecField = "$allowNullishOrArrayIds"_sd;
 
     explicit DocumentSourceStreamingGroup(
         const boost::intrusive_ptr<ExpressionContext>& expCtx,
@@ -137,6 +143,11 @@ private:
     boost::optional<Document> _firstDocumentOfNextBatch;
 
     bool _sourceDepleted;
+
+    // Whether a nullish or array monotonic id value stops the streaming rather than failing, and
+    // whether one has been seen so that the rest of the input goes into the current batch.
+    bool _allowNullishOrArrayIds = false;
+    bool _streamingStopped = false;
 };
 
 }  // namespace mongo
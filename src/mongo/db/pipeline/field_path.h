@@ -134,6 +134,15 @@ public:
         return HashedFieldName{getFieldName(i), _fieldHash[i]};
     }
 
+    /**
+     * Returns whether the hash of the ith field name was pre-computed, so that
+     * getFieldNameHashed() may be used for it.
+     */
+    bool hasPrecomputedHash(size_t i) const {
+        dassert(i < getPathLength());
+        return _fieldHash[i] != kHashUninitialized;
+    }
+
     /**
      * Returns the full path, not including the prefix 'FieldPath::prefix'.
      */
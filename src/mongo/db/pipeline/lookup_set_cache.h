@@ -78,6 +78,10 @@ public:
 
         // This includes the size of both key and the documents.
         size_t approxCacheEntrySize = 0;
+
+        // Whether this entry is in the first half of the sequence, before '_middle'. This does not
+        // take part in the indexes, so it is safe to update in place.
+        mutable bool inFrontHalf = false;
     };
 
     // boost::multi_index_container provides a system for implementing a cache. Here, we create
@@ -100,7 +104,11 @@ public:
                                        boost::make_tuple(0,
                                                          member<Cached, Value, &Cached::key>(),
                                                          comparator.getHasher(),
-                                                         comparator.getEqualTo()))) {}
+                                                         comparator.getEqualTo()))),
+          _middle(_container.end()) {}
+
+    LookupSetCache(const LookupSetCache&) = delete;
+    LookupSetCache& operator=(const LookupSetCache&) = delete;
 
     /**
      * Insert "value" into the set with key "key". If "key" is already present in the cache, move it
@@ -114,31 +122,38 @@ public:
      * likely we don't want to evict it (i.e., we want to make sure it isn't at the back).
      */
     void insert(Value key, Document doc) {
-        // Get an iterator to the middle of the container.
-        size_t middle = size() / 2;
-        auto it = _container.begin();
-        std::advance(it, middle);
-        const auto keySize = key.getApproximateSize();
         auto cacheEntrySizeIncreaseBy = doc.getApproximateSize();
-
-        // Find the cache entry, or create one if it doesn't exist yet.
-        auto insertionResult = _container.insert(it, {std::move(key), {}, 0});
-        if (insertionResult.second) {
-            cacheEntrySizeIncreaseBy += keySize;
-        } else {
-            // We did not insert due to a duplicate key. Update the cached doc, moving it to the
-            // middle of the cache.
-            _container.relocate(it, insertionResult.first);
-        }
+        auto [cachedIt, keySize] = placeInMiddle(std::move(key));
+        cacheEntrySizeIncreaseBy += keySize;
 
         // Add the doc to the cache entry.
-        _container.modify(insertionResult.first, [&doc, cacheEntrySizeIncreaseBy](Cached& entry) {
+        _container.modify(cachedIt, [&doc, cacheEntrySizeIncreaseBy](Cached& entry) {
             entry.docs.push_back(std::move(doc));
             entry.approxCacheEntrySize += cacheEntrySizeIncreaseBy;
         });
         _memoryUsage += cacheEntrySizeIncreaseBy;
     }
 
+    /**
+     * Insert all of "docs" into the set with key "key", placing the key in the middle of the cache
+     * as insert() does. Unlike insert(), this creates an entry for "key" even if "docs" is empty,
+     * so that a cached empty set can be told apart from a missing key.
+     */
+    void insertAll(Value key, std::vector<Document> docs) {
+        size_t cacheEntrySizeIncreaseBy = 0;
+        for (auto&& doc : docs) {
+            cacheEntrySizeIncreaseBy += doc.getApproximateSize();
+        }
+        auto [cachedIt, keySize] = placeInMiddle(std::move(key));
+        cacheEntrySizeIncreaseBy += keySize;
+
+        _container.modify(cachedIt, [&docs, cacheEntrySizeIncreaseBy](Cached& entry) {
+            std::move(docs.begin(), docs.end(), std::back_inserter(entry.docs));
+            entry.approxCacheEntrySize += cacheEntrySizeIncreaseBy;
+        });
+        _memoryUsage += cacheEntrySizeIncreaseBy;
+    }
+
     /**
      * Evict the least-recently-used item.
      */
@@ -154,6 +169,13 @@ public:
                 cacheEntrySize <= _memoryUsage);
         _memoryUsage -= cacheEntrySize;
 
+        if (size() % 2 == 0) {
+            // The front half shrinks along with the cache, so its last entry becomes the middle one.
+            _middle = std::prev(_middle);
+            _middle->inFrontHalf = false;
+        } else if (size() == 1) {
+            _middle = _container.end();
+        }
         _container.erase(std::prev(_container.end()));
     }
 
@@ -187,6 +209,7 @@ public:
      */
     void clear() {
         _container.clear();
+        _middle = _container.end();
         _memoryUsage = 0;
     }
 
@@ -196,9 +219,18 @@ public:
     const std::vector<Document>* operator[](const Value& key) {
         auto it = boost::multi_index::get<1>(_container).find(key);
         if (it != boost::multi_index::get<1>(_container).end()) {
-            boost::multi_index::get<0>(_container)
-                .relocate(boost::multi_index::get<0>(_container).begin(),
-                          boost::multi_index::project<0>(_container, it));
+            auto entry = boost::multi_index::project<0>(_container, it);
+            if (entry->inFrontHalf) {
+                _container.relocate(_container.begin(), entry);
+            } else {
+                // Moving an entry from the back half to the front leaves the front half one entry
+                // too long, so its last entry becomes the middle one.
+                auto backHalfBegin = entry == _middle ? std::next(_middle) : _middle;
+                _container.relocate(_container.begin(), entry);
+                entry->inFrontHalf = true;
+                _middle = std::prev(backHalfBegin);
+                _middle->inFrontHalf = false;
+            }
             return &it->docs;
         }
         return nullptr;
@@ -209,8 +241,45 @@ public:
     }
 
 private:
+    /**
+     * Find the cache entry for "key", or create one if it doesn't exist yet, and move it to the
+     * middle of the cache. Returns the entry along with the size of "key" if the entry was created,
+     * or zero if it already existed.
+     */
+    std::pair<IndexedContainer::iterator, size_t> placeInMiddle(Value key) {
+        const auto keySize = key.getApproximateSize();
+        const bool hadOddSize = size() % 2 == 1;
+
+        auto insertionResult = _container.insert(_middle, {std::move(key), {}, 0});
+        if (insertionResult.second) {
+            // The front half grows by one entry for every other insertion. When it does, the new
+            // entry is its last one, and otherwise the new entry is the middle one.
+            if (hadOddSize) {
+                insertionResult.first->inFrontHalf = true;
+            } else {
+                _middle = insertionResult.first;
+            }
+            return {insertionResult.first, keySize};
+        }
+
+        if (insertionResult.first != _middle) {
+            // We did not insert due to a duplicate key. Move the existing entry to the middle of
+            // the cache. An entry moved there from the back half becomes the middle one.
+            _container.relocate(_middle, insertionResult.first);
+            if (!insertionResult.first->inFrontHalf) {
+                _middle = insertionResult.first;
+            }
+        }
+        return {insertionResult.first, 0};
+    }
+
     IndexedContainer _container;
 
+    // The entry at position size() / 2 of the sequence, where new and updated entries are placed,
+    // or end() if the cache is empty. It is maintained as the cache changes so that finding the
+    // middle does not need a walk over half of the sequence.
+    IndexedContainer::iterator _middle;
+
     size_t _memoryUsage = 0;
 };
 
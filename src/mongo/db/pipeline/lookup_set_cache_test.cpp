@@ -122,6 +122,27 @@ TEST(LookupSetCacheTest, InsertDoesPutKeyInMiddle) {
     ASSERT_TRUE(cache[Value(1)]);
 }
 
+TEST(LookupSetCacheTest, InsertAfterReadFromBackDoesPutKeyInMiddle) {
+    LookupSetCache cache(defaultComparator);
+
+    cache.insert(Value(0), intToDoc(0));
+    cache.insert(Value(1), intToDoc(0));
+    cache.insert(Value(2), intToDoc(0));
+    cache.insert(Value(3), intToDoc(0));
+    // Cache ordering is {1: ..., 3: ..., 2: ..., 0: ...}.
+
+    ASSERT_TRUE(cache[Value(0)]);
+    // Cache ordering is now {0: ..., 1: ..., 3: ..., 2: ...}.
+
+    cache.insert(Value(4), intToDoc(0));
+    // Cache ordering is now {0: ..., 1: ..., 4: ..., 3: ..., 2: ...}.
+
+    cache.evictUntilSize(3);
+    ASSERT_TRUE(cache[Value(4)]);
+    ASSERT_FALSE(cache[Value(3)]);
+    ASSERT_FALSE(cache[Value(2)]);
+}
+
 TEST(LookupSetCacheTest, EvictDoesRespectMemoryUsage) {
     LookupSetCache cache(defaultComparator);
 
@@ -135,6 +156,21 @@ TEST(LookupSetCacheTest, EvictDoesRespectMemoryUsage) {
     ASSERT_FALSE(cache[Value(0)]);
 }
 
+TEST(LookupSetCacheTest, InsertAllCachesEmptySet) {
+    LookupSetCache cache(defaultComparator);
+
+    cache.insertAll(Value(0), {});
+    cache.insertAll(Value(1), {intToDoc(1), intToDoc(2)});
+
+    ASSERT(cache[Value(0)]);
+    ASSERT_TRUE(cache[Value(0)]->empty());
+    ASSERT_EQ(cache[Value(1)]->size(), 2U);
+    ASSERT_TRUE(vectorContains(cache[Value(1)], intToDoc(2)));
+    ASSERT_EQ(cache.getMemoryUsage(),
+              Value(0).getApproximateSize() + Value(1).getApproximateSize() +
+                  intToDoc(1).getApproximateSize() + intToDoc(2).getApproximateSize());
+}
+
 TEST(LookupSetCacheTest, ComplexAccessPatternDoesBehaveCorrectly) {
     LookupSetCache cache(defaultComparator);
 
@@ -0,0 +1,110 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <vector>
+
+#include <boost/optional/optional.hpp>
+#include <boost/smart_ptr/intrusive_ptr.hpp>
+
+#include "mongo/bson/bsonobj.h"
+#include "mongo/db/exec/document_value/document.h"
+#include "mongo/db/namespace_string.h"
+#include "mongo/db/pipeline/document_source_mock.h"
+#include "mongo/db/pipeline/expression_context_for_test.h"
+#include "mongo/db/pipeline/pipeline.h"
+#include "mongo/db/pipeline/pipeline_bm_fixture.h"
+#include "mongo/db/pipeline/process_interface/stub_mongo_process_interface.h"
+#include "mongo/db/query/query_test_service_context.h"
+#include "mongo/util/intrusive_counter.h"
+#include "mongo/util/string_map.h"
+
+namespace mongo {
+namespace {
+
+/**
+ * Serves every pipeline on the foreign collection from an in-memory copy of its documents.
+ */
+class ForeignCollectionProcessInterface final : public StubMongoProcessInterface {
+public:
+    explicit ForeignCollectionProcessInterface(std::vector<Document> documents)
+        : _documents(std::move(documents)) {}
+
+    std::unique_ptr<Pipeline, PipelineDeleter> preparePipelineForExecution(
+        Pipeline* ownedPipeline,
+        ShardTargetingPolicy shardTargetingPolicy = ShardTargetingPolicy::kAllowed,
+        boost::optional<BSONObj> readConcern = boost::none) final {
+        std::unique_ptr<Pipeline, PipelineDeleter> pipeline(
+            ownedPipeline, PipelineDeleter(ownedPipeline->getContext()->opCtx));
+        pipeline->addInitialSource(
+            DocumentSourceMock::createForTest(_documents, pipeline->getContext()));
+        return pipeline;
+    }
+
+private:
+    std::vector<Document> _documents;
+};
+
+class ClassicPipelineBenchmarkFixture : public PipelineBenchmarkFixture {
+    void benchmarkPipeline(const std::vector<BSONObj>& pipeline,
+                           benchmark::State& state,
+                           const std::vector<Document>& documents,
+                           const std::vector<Document>& foreignDocuments) final {
+        QueryTestServiceContext testServiceContext;
+        auto opContext = testServiceContext.makeOperationContext();
+        NamespaceString nss = NamespaceString::createNamespaceString_forTest("test.bm");
+        NamespaceString foreignNss =
+            NamespaceString::createNamespaceString_forTest("test", kForeignCollection);
+        auto expCtx = make_intrusive<ExpressionContextForTest>(opContext.get(), nss);
+        expCtx->mongoProcessInterface =
+            std::make_shared<ForeignCollectionProcessInterface>(foreignDocuments);
+        expCtx->setResolvedNamespaces(StringMap<ExpressionContext::ResolvedNamespace>{
+            {foreignNss.coll().toString(), {foreignNss, std::vector<BSONObj>()}}});
+
+        for (auto keepRunning : state) {
+            // Parsing, optimizing and loading the input are not part of what is measured.
+            state.PauseTiming();
+            auto parsed = Pipeline::parse(pipeline, expCtx);
+            parsed->optimizePipeline();
+            parsed->addInitialSource(DocumentSourceMock::createForTest(documents, expCtx));
+            state.ResumeTiming();
+
+            while (auto next = parsed->getNext()) {
+                benchmark::DoNotOptimize(*next);
+            }
+            benchmark::ClobberMemory();
+        }
+    }
+};
+
+BENCHMARK_PIPELINES(ClassicPipelineBenchmarkFixture)
+
+}  // namespace
+}  // namespace mongo
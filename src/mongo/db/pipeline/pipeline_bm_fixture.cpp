@@ -0,0 +1,252 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/db/pipeline/pipeline_bm_fixture.h"
+
+#include <initializer_list>
+#include <string>
+#include <vector>
+
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/bson/json.h"
+#include "mongo/util/duration.h"
+#include "mongo/util/time_support.h"
+
+namespace mongo {
+
+namespace {
+
+constexpr int kNumOrders = 10'000;
+// $lookup is a nested loop join over the foreign documents, so it uses fewer orders to keep a
+// single iteration short.
+constexpr int kNumLookupOrders = 1'000;
+
+const std::vector<std::string> kStatuses{"pending", "shipped", "delivered", "cancelled"};
+const std::vector<std::string> kCities{
+    "Austin", "Berlin", "Dublin", "Lagos", "Mumbai", "Osaka", "Sydney", "Toronto"};
+const std::vector<std::string> kTiers{"bronze", "silver", "gold"};
+const std::vector<std::string> kRegions{"amer", "emea", "apac"};
+
+template <typename T>
+const T& pick(PseudoRandom& random, const std::vector<T>& values) {
+    return values[random.nextInt32(values.size())];
+}
+
+std::vector<BSONObj> parsePipeline(std::initializer_list<const char*> stages) {
+    std::vector<BSONObj> pipeline;
+    for (auto&& stage : stages) {
+        pipeline.push_back(fromjson(stage));
+    }
+    return pipeline;
+}
+
+}  // namespace
+
+std::vector<Document> PipelineBenchmarkFixture::generateOrders(PseudoRandom& random, int count) {
+    const auto start = Date_t::fromMillisSinceEpoch(1'700'000'000'000);
+    const auto span = durationCount<Milliseconds>(Days{365});
+
+    std::vector<Document> documents;
+    documents.reserve(count);
+    for (int i = 0; i < count; ++i) {
+        BSONObjBuilder bob;
+        bob.append("_id", i);
+        bob.append("customerId", random.nextInt32(kNumCustomers));
+        bob.append("status", pick(random, kStatuses));
+
+        double total = 0;
+        {
+            BSONArrayBuilder items{bob.subarrayStart("items")};
+            for (int item = random.nextInt32(6); item > 0; --item) {
+                int qty = 1 + random.nextInt32(5);
+                double price = random.nextInt32(10'000) / 100.0;
+                total += qty * price;
+                items.append(BSON("sku" << "sku-" + std::to_string(random.nextInt32(500))
+                                        << "qty" << qty << "price" << price));
+            }
+        }
+        bob.append("total", total);
+        bob.append("createdAt", start + Milliseconds{random.nextInt64(span)});
+        bob.append("address",
+                   BSON("city" << pick(random, kCities) << "zip"
+                               << std::to_string(10'000 + random.nextInt32(90'000))));
+        documents.emplace_back(bob.obj());
+    }
+    return documents;
+}
+
+std::vector<Document> PipelineBenchmarkFixture::generateCustomers(PseudoRandom& random,
+                                                                  int count) {
+    std::vector<Document> documents;
+    documents.reserve(count);
+    for (int i = 0; i < count; ++i) {
+        documents.emplace_back(BSON("_id" << i << "name" << "customer-" + std::to_string(i)
+                                          << "tier" << pick(random, kTiers) << "region"
+                                          << pick(random, kRegions)));
+    }
+    return documents;
+}
+
+void PipelineBenchmarkFixture::_benchmarkOrders(const std::vector<BSONObj>& pipeline,
+                                                benchmark::State& state,
+                                                int numOrders) {
+    auto orders = generateOrders(random, numOrders);
+    auto customers = generateCustomers(random, kNumCustomers);
+    benchmarkPipeline(pipeline, state, orders, customers);
+    // Report throughput in input documents so that results are comparable across stages.
+    state.SetItemsProcessed(state.iterations() * numOrders);
+}
+
+void PipelineBenchmarkFixture::benchmarkLookupLocalForeignField(benchmark::State& state) {
+    _benchmarkOrders(parsePipeline({R"({$lookup: {
+                                        from: "customers",
+                                        localField: "customerId",
+                                        foreignField: "_id",
+                                        as: "customer"}})"}),
+                     state,
+                     kNumLookupOrders);
+}
+
+void PipelineBenchmarkFixture::benchmarkLookupUnwind(benchmark::State& state) {
+    _benchmarkOrders(parsePipeline({R"({$lookup: {
+                                        from: "customers",
+                                        localField: "customerId",
+                                        foreignField: "_id",
+                                        as: "customer"}})",
+                                    R"({$unwind: "$customer"})"}),
+                     state,
+                     kNumLookupOrders);
+}
+
+void PipelineBenchmarkFixture::benchmarkUnwindItems(benchmark::State& state) {
+    _benchmarkOrders(parsePipeline({R"({$unwind: "$items"})"}), state, kNumOrders);
+}
+
+void PipelineBenchmarkFixture::benchmarkUnwindItemsIncludeArrayIndex(benchmark::State& state) {
+    _benchmarkOrders(parsePipeline({R"({$unwind: {
+                                        path: "$items",
+                                        includeArrayIndex: "itemIndex",
+                                        preserveNullAndEmptyArrays: true}})"}),
+                     state,
+                     kNumOrders);
+}
+
+void PipelineBenchmarkFixture::benchmarkSortByTotal(benchmark::State& state) {
+    _benchmarkOrders(parsePipeline({R"({$sort: {total: -1}})"}), state, kNumOrders);
+}
+
+void PipelineBenchmarkFixture::benchmarkSortCompound(benchmark::State& state) {
+    _benchmarkOrders(parsePipeline({R"({$sort: {status: 1, createdAt: -1}})"}), state, kNumOrders);
+}
+
+void PipelineBenchmarkFixture::benchmarkSortLimit(benchmark::State& state) {
+    _benchmarkOrders(
+        parsePipeline({R"({$sort: {total: -1}})", R"({$limit: 10})"}), state, kNumOrders);
+}
+
+void PipelineBenchmarkFixture::benchmarkBucketAuto(benchmark::State& state) {
+    _benchmarkOrders(
+        parsePipeline({R"({$bucketAuto: {groupBy: "$total", buckets: 10}})"}), state, kNumOrders);
+}
+
+void PipelineBenchmarkFixture::benchmarkBucketAutoWithOutput(benchmark::State& state) {
+    _benchmarkOrders(parsePipeline({R"({$bucketAuto: {
+                                        groupBy: "$createdAt",
+                                        buckets: 20,
+                                        output: {
+                                            count: {$sum: 1},
+                                            avgTotal: {$avg: "$total"},
+                                            cities: {$addToSet: "$address.city"}}}})"}),
+                     state,
+                     kNumOrders);
+}
+
+void PipelineBenchmarkFixture::benchmarkSetWindowFieldsCumulativeSum(benchmark::State& state) {
+    _benchmarkOrders(parsePipeline({R"({$setWindowFields: {
+                                        partitionBy: "$customerId",
+                                        sortBy: {createdAt: 1},
+                                        output: {runningTotal: {
+                                            $sum: "$total",
+                                            window: {documents: ["unbounded", "current"]}}}}})"}),
+                     state,
+                     kNumOrders);
+}
+
+void PipelineBenchmarkFixture::benchmarkSetWindowFieldsRangeAvg(benchmark::State& state) {
+    _benchmarkOrders(parsePipeline({R"({$setWindowFields: {
+                                        sortBy: {createdAt: 1},
+                                        output: {
+                                            weeklyAvg: {
+                                                $avg: "$total",
+                                                window: {range: [-7, 0], unit: "day"}}}}})"}),
+                     state,
+                     kNumOrders);
+}
+
+void PipelineBenchmarkFixture::benchmarkSetWindowFieldsRank(benchmark::State& state) {
+    _benchmarkOrders(parsePipeline({R"({$setWindowFields: {
+                                        partitionBy: "$status",
+                                        sortBy: {total: -1},
+                                        output: {rank: {$rank: {}}}}})"}),
+                     state,
+                     kNumOrders);
+}
+
+void PipelineBenchmarkFixture::benchmarkFacet(benchmark::State& state) {
+    _benchmarkOrders(parsePipeline({R"({$facet: {
+                                        byStatus: [{$sortByCount: "$status"}],
+                                        topOrders: [{$sort: {total: -1}}, {$limit: 5}],
+                                        totals: [{$bucketAuto: {groupBy: "$total", buckets: 5}}]
+                                    }})"}),
+                     state,
+                     kNumOrders);
+}
+
+void PipelineBenchmarkFixture::benchmarkProjectInclusion(benchmark::State& state) {
+    _benchmarkOrders(parsePipeline({R"({$project: {customerId: 1, total: 1, "address.city": 1}})"}),
+                     state,
+                     kNumOrders);
+}
+
+void PipelineBenchmarkFixture::benchmarkProjectExclusion(benchmark::State& state) {
+    _benchmarkOrders(
+        parsePipeline({R"({$project: {items: 0, address: 0}})"}), state, kNumOrders);
+}
+
+void PipelineBenchmarkFixture::benchmarkProjectComputed(benchmark::State& state) {
+    _benchmarkOrders(parsePipeline({R"({$project: {
+                                        customerId: 1,
+                                        itemCount: {$size: "$items"},
+                                        discounted: {$multiply: ["$total", 0.9]},
+                                        month: {$month: "$createdAt"}}})"}),
+                     state,
+                     kNumOrders);
+}
+
+}  // namespace mongo
@@ -0,0 +1,164 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <vector>
+
+#include "mongo/base/string_data.h"
+#include "mongo/bson/bsonobj.h"
+#include "mongo/db/exec/document_value/document.h"
+#include "mongo/platform/random.h"
+
+namespace mongo {
+
+/**
+ * Benchmarks for individual aggregation stages, run over generated collections of a fixed shape.
+ * The execution engine is supplied by subclasses through 'benchmarkPipeline()', so the same set
+ * of pipelines can be measured against each engine with BENCHMARK_PIPELINES.
+ *
+ * The main collection holds "orders":
+ *   {_id, customerId, status, total, createdAt, items: [{sku, qty, price}], address: {city, zip}}
+ * and the foreign collection, named kForeignCollection, holds "customers":
+ *   {_id, name, tier, region}
+ * Both are generated from a fixed seed, so every run sees the same data.
+ */
+class PipelineBenchmarkFixture : public benchmark::Fixture {
+private:
+    static constexpr int32_t kSeed = 1;
+
+public:
+    static constexpr auto kForeignCollection = "customers"_sd;
+    static constexpr int kNumCustomers = 100;
+
+    PipelineBenchmarkFixture() : random(kSeed) {}
+
+    /**
+     * Runs 'pipeline' over 'documents' once per benchmark iteration. Stages that read from
+     * kForeignCollection must see 'foreignDocuments'.
+     */
+    virtual void benchmarkPipeline(const std::vector<BSONObj>& pipeline,
+                                   benchmark::State& benchmarkState,
+                                   const std::vector<Document>& documents,
+                                   const std::vector<Document>& foreignDocuments) = 0;
+
+    void benchmarkLookupLocalForeignField(benchmark::State& state);
+    void benchmarkLookupUnwind(benchmark::State& state);
+
+    void benchmarkUnwindItems(benchmark::State& state);
+    void benchmarkUnwindItemsIncludeArrayIndex(benchmark::State& state);
+
+    void benchmarkSortByTotal(benchmark::State& state);
+    void benchmarkSortCompound(benchmark::State& state);
+    void benchmarkSortLimit(benchmark::State& state);
+
+    void benchmarkBucketAuto(benchmark::State& state);
+    void benchmarkBucketAutoWithOutput(benchmark::State& state);
+
+    void benchmarkSetWindowFieldsCumulativeSum(benchmark::State& state);
+    void benchmarkSetWindowFieldsRangeAvg(benchmark::State& state);
+    void benchmarkSetWindowFieldsRank(benchmark::State& state);
+
+    void benchmarkFacet(benchmark::State& state);
+
+    void benchmarkProjectInclusion(benchmark::State& state);
+    void benchmarkProjectExclusion(benchmark::State& state);
+    void benchmarkProjectComputed(benchmark::State& state);
+
+    /**
+     * Generators for the two collections. Exposed so that tests can run over the same shapes.
+     */
+    static std::vector<Document> generateOrders(PseudoRandom& random, int count);
+    static std::vector<Document> generateCustomers(PseudoRandom& random, int count);
+
+private:
+    void _benchmarkOrders(const std::vector<BSONObj>& pipeline,
+                          benchmark::State& state,
+                          int numOrders);
+
+    PseudoRandom random;
+};
+
+#define BENCHMARK_PIPELINES(Fixture)                                       \
+    BENCHMARK_F(Fixture, LookupLocalForeignField)                          \
+    (benchmark::State & state) {                                           \
+        benchmarkLookupLocalForeignField(state);                           \
+    }                                                                      \
+    BENCHMARK_F(Fixture, LookupUnwind)(benchmark::State & state) {         \
+        benchmarkLookupUnwind(state);                                      \
+    }                                                                      \
+    BENCHMARK_F(Fixture, UnwindItems)(benchmark::State & state) {          \
+        benchmarkUnwindItems(state);                                       \
+    }                                                                      \
+    BENCHMARK_F(Fixture, UnwindItemsIncludeArrayIndex)                     \
+    (benchmark::State & state) {                                           \
+        benchmarkUnwindItemsIncludeArrayIndex(state);                      \
+    }                                                                      \
+    BENCHMARK_F(Fixture, SortByTotal)(benchmark::State & state) {          \
+        benchmarkSortByTotal(state);                                       \
+    }                                                                      \
+    BENCHMARK_F(Fixture, SortCompound)(benchmark::State & state) {         \
+        benchmarkSortCompound(state);                                      \
+    }                                                                      \
+    BENCHMARK_F(Fixture, SortLimit)(benchmark::State & state) {            \
+        benchmarkSortLimit(state);                                         \
+    }                                                                      \
+    BENCHMARK_F(Fixture, BucketAuto)(benchmark::State & state) {           \
+        benchmarkBucketAuto(state);                                        \
+    }                                                                      \
+    BENCHMARK_F(Fixture, BucketAutoWithOutput)(benchmark::State & state) { \
+        benchmarkBucketAutoWithOutput(state);                              \
+    }                                                                      \
+    BENCHMARK_F(Fixture, SetWindowFieldsCumulativeSum)                     \
+    (benchmark::State & state) {                                           \
+        benchmarkSetWindowFieldsCumulativeSum(state);                      \
+    }                                                                      \
+    BENCHMARK_F(Fixture, SetWindowFieldsRangeAvg)                          \
+    (benchmark::State & state) {                                           \
+        benchmarkSetWindowFieldsRangeAvg(state);                           \
+    }                                                                      \
+    BENCHMARK_F(Fixture, SetWindowFieldsRank)(benchmark::State & state) {  \
+        benchmarkSetWindowFieldsRank(state);                               \
+    }                                                                      \
+    BENCHMARK_F(Fixture, Facet)(benchmark::State & state) {                \
+        benchmarkFacet(state);                                             \
+    }                                                                      \
+    BENCHMARK_F(Fixture, ProjectInclusion)(benchmark::State & state) {     \
+        benchmarkProjectInclusion(state);                                  \
+    }                                                                      \
+    BENCHMARK_F(Fixture, ProjectExclusion)(benchmark::State & state) {     \
+        benchmarkProjectExclusion(state);                                  \
+    }                                                                      \
+    BENCHMARK_F(Fixture, ProjectComputed)(benchmark::State & state) {      \
+        benchmarkProjectComputed(state);                                   \
+    }
+
+}  // namespace mongo
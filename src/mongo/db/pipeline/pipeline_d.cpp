@@ -42,6 +42,7 @@
 #include <cstring>
 #include <iterator>
 #include <list>
+#include <map>
 #include <string>
 #include <tuple>
 #include <type_traits>
@@ -73,6 +74,7 @@
 #include "mongo/db/exec/unpack_timeseries_bucket.h"
 #include "mongo/db/exec/working_set.h"
 #include "mongo/db/feature_flag.h"
+#include "mongo/db/field_ref.h"
 #include "mongo/db/index/index_descriptor.h"
 #include "mongo/db/index_names.h"
 #include "mongo/db/matcher/expression_algo.h"
@@ -100,6 +102,7 @@
 #include "mongo/db/pipeline/document_source_single_document_transformation.h"
 #include "mongo/db/pipeline/document_source_skip.h"
 #include "mongo/db/pipeline/document_source_sort.h"
+#include "mongo/db/pipeline/document_source_streaming_group.h"
 #include "mongo/db/pipeline/expression.h"
 #include "mongo/db/pipeline/expression_context.h"
 #include "mongo/db/pipeline/pipeline.h"
@@ -357,6 +360,103 @@ SortAndUnpackInPipeline findUnpackAndSort(const Pipeline::SourceContainer& sourc
     }
     return su;
 }
+
+/**
+ * Wraps a storage engine random cursor for block sampling: every random position starts a block of
+ * up to 'blockSize' records which are read sequentially with a regular cursor. The RecordId range
+ * covered by each block is remembered so that blocks never overlap, which keeps the memory used
+ * proportional to the number of blocks rather than to the number of sampled records.
+ */
+class BlockSamplingRecordCursor final : public RecordCursor {
+public:
+    BlockSamplingRecordCursor(std::unique_ptr<RecordCursor> randomCursor,
+                              std::unique_ptr<SeekableRecordCursor> sequentialCursor,
+                              long long blockSize)
+        : _randomCursor(std::move(randomCursor)),
+          _sequentialCursor(std::move(sequentialCursor)),
+          _blockSize(blockSize) {}
+
+    boost::optional<Record> next() final {
+        if (_leftInBlock > 0) {
+            auto record = _sequentialCursor->next();
+            if (record && !_isCovered(record->id)) {
+                --_leftInBlock;
+                _currentBlock->second = record->id;
+                return record;
+            }
+            // Either the end of the collection or the start of another block was reached.
+            _leftInBlock = 0;
+        }
+
+        // Start a new block at a random position which isn't part of an earlier block.
+        const int kMaxAttempts = 100;
+        for (int i = 0; i < kMaxAttempts; ++i) {
+            auto start = _randomCursor->next();
+            if (!start) {
+                return boost::none;
+            }
+            if (_isCovered(start->id)) {
+                continue;
+            }
+            auto record = _sequentialCursor->seekExact(start->id);
+            if (!record) {
+                continue;
+            }
+            _currentBlock = _blocks.emplace(record->id, record->id).first;
+            _leftInBlock = _blockSize - 1;
+            return record;
+        }
+
+        // Most of the collection has been sampled already. Fall back to plain random records and
+        // leave it to $sampleFromRandomCursor to discard the duplicates.
+        return _randomCursor->next();
+    }
+
+    void save() final {
+        _randomCursor->save();
+        _sequentialCursor->save();
+    }
+
+    bool restore(bool tolerateCappedRepositioning = true) final {
+        const bool randomRestored = _randomCursor->restore(tolerateCappedRepositioning);
+        const bool sequentialRestored = _sequentialCursor->restore(tolerateCappedRepositioning);
+        return randomRestored && sequentialRestored;
+    }
+
+    void detachFromOperationContext() final {
+        _randomCursor->detachFromOperationContext();
+        _sequentialCursor->detachFromOperationContext();
+    }
+
+    void reattachToOperationContext(OperationContext* opCtx) final {
+        _randomCursor->reattachToOperationContext(opCtx);
+        _sequentialCursor->reattachToOperationContext(opCtx);
+    }
+
+    void setSaveStorageCursorOnDetachFromOperationContext(bool saveCursor) final {
+        _randomCursor->setSaveStorageCursorOnDetachFromOperationContext(saveCursor);
+        _sequentialCursor->setSaveStorageCursorOnDetachFromOperationContext(saveCursor);
+    }
+
+private:
+    bool _isCovered(const RecordId& id) const {
+        auto it = _blocks.upper_bound(id);
+        if (it == _blocks.begin()) {
+            return false;
+        }
+        --it;
+        return id <= it->second;
+    }
+
+    std::unique_ptr<RecordCursor> _randomCursor;
+    std::unique_ptr<SeekableRecordCursor> _sequentialCursor;
+    const long long _blockSize;
+
+    // Maps the first RecordId of every block to its last RecordId.
+    std::map<RecordId, RecordId> _blocks;
+    std::map<RecordId, RecordId>::iterator _currentBlock;
+    long long _leftInBlock = 0;
+};
 }  // namespace
 
 StatusWith<unique_ptr<PlanExecutor, PlanExecutor::Deleter>> PipelineD::createRandomCursorExecutor(
@@ -365,6 +465,7 @@ StatusWith<unique_ptr<PlanExecutor, PlanExecutor::Deleter>> PipelineD::createRan
     Pipeline* pipeline,
     long long sampleSize,
     long long numRecords,
+    long long blockSize,
     boost::optional<timeseries::BucketUnpacker> bucketUnpacker) {
     OperationContext* opCtx = expCtx->opCtx;
 
@@ -412,6 +513,13 @@ StatusWith<unique_ptr<PlanExecutor, PlanExecutor::Deleter>> PipelineD::createRan
         return nullptr;
     }
 
+    // Time-series buckets are sampled by 'SampleFromTimeseriesBucket', which needs every record to
+    // be an independent random draw.
+    if (blockSize > 1 && !expCtx->ns.isTimeseriesBucketsCollection()) {
+        rsRandCursor = std::make_unique<BlockSamplingRecordCursor>(
+            std::move(rsRandCursor), coll->getRecordStore()->getCursor(opCtx), blockSize);
+    }
+
     // Build a MultiIteratorStage and pass it the random-sampling RecordCursor.
     auto ws = std::make_unique<WorkingSet>();
     std::unique_ptr<PlanStage> root =
@@ -632,8 +740,13 @@ PipelineD::BuildQueryExecutorResult PipelineD::buildInnerQueryExecutorSample(
     if (unpackBucketStage) {
         bucketUnpacker = unpackBucketStage->bucketUnpacker().copy();
     }
-    auto exec = uassertStatusOK(createRandomCursorExecutor(
-        collection, expCtx, pipeline, sampleSize, numRecords, std::move(bucketUnpacker)));
+    auto exec = uassertStatusOK(createRandomCursorExecutor(collection,
+                                                           expCtx,
+                                                           pipeline,
+                                                           sampleSize,
+                                                           numRecords,
+                                                           sampleStage->getBlockSize(),
+                                                           std::move(bucketUnpacker)));
 
     AttachExecutorCallback attachExecutorCallback;
     if (exec) {
@@ -764,6 +877,126 @@ std::unique_ptr<GroupFromFirstDocumentTransformation> tryDistinctGroupRewrite(
     return groupStage ? groupStage->rewriteGroupAsTransformOnFirstDocument() : nullptr;
 }
 
+/**
+ * Returns the indexes of the _id expressions of 'groupStage' that are monotonic in the leading
+ * fields of 'sortPattern', or an empty vector if there are none and the group can't stream over
+ * input in that order. A sort field after the first is only considered if the field before it is
+ * itself one of the _id expressions, because the input is clustered on the later field only
+ * within each run of equal values of the earlier ones.
+ */
+std::vector<size_t> getMonotonicGroupIdExpressions(const SortPattern& sortPattern,
+                                                   const DocumentSourceGroup& groupStage) {
+    const auto& idExpressions = groupStage.getIdExpressions();
+    std::vector<size_t> monotonicIdExpressions;
+    for (const auto& sortPart : sortPattern) {
+        if (!sortPart.fieldPath) {
+            break;
+        }
+
+        bool sortFieldIsIdExpression = false;
+        for (size_t i = 0; i < idExpressions.size(); ++i) {
+            auto monotonicState = idExpressions[i]->getMonotonicState(*sortPart.fieldPath);
+            if (monotonicState != monotonic::State::Increasing &&
+                monotonicState != monotonic::State::Decreasing) {
+                continue;
+            }
+            if (std::find(monotonicIdExpressions.begin(), monotonicIdExpressions.end(), i) ==
+                monotonicIdExpressions.end()) {
+                monotonicIdExpressions.push_back(i);
+            }
+            if (auto fieldPathExpr = dynamic_cast<ExpressionFieldPath*>(idExpressions[i].get());
+                fieldPathExpr && fieldPathExpr->representsPath(sortPart.fieldPath->fullPath())) {
+                sortFieldIsIdExpression = true;
+            }
+        }
+        if (!sortFieldIsIdExpression) {
+            break;
+        }
+    }
+    std::sort(monotonicIdExpressions.begin(), monotonicIdExpressions.end());
+    return monotonicIdExpressions;
+}
+
+/**
+ * Returns true if 'collection' has a multikey index on a path that is a prefix of, or is prefixed
+ * by, one of the fields of 'sortPattern'. An array sorts by its smallest or largest element, so
+ * documents holding an array in such a field are not clustered with the documents holding the
+ * scalar it sorts as.
+ */
+bool sortPatternCoversMultikeyPath(OperationContext* opCtx,
+                                   const CollectionPtr& collection,
+                                   const SortPattern& sortPattern) {
+    if (!collection) {
+        return false;
+    }
+
+    auto ii = collection->getIndexCatalog()->getIndexIterator(
+        opCtx, IndexCatalog::InclusionPolicy::kReady);
+    while (ii->more()) {
+        const IndexCatalogEntry* entry = ii->next();
+        if (!entry->isMultikey(opCtx, collection)) {
+            continue;
+        }
+        for (auto&& keyElem : entry->descriptor()->keyPattern()) {
+            FieldRef indexPath(keyElem.fieldNameStringData());
+            for (const auto& sortPart : sortPattern) {
+                if (!sortPart.fieldPath) {
+                    continue;
+                }
+                FieldRef sortPath(sortPart.fieldPath->fullPath());
+                if (indexPath.isPrefixOfOrEqualTo(sortPath) || sortPath.isPrefixOf(indexPath)) {
+                    return true;
+                }
+            }
+        }
+    }
+    return false;
+}
+
+/**
+ * Replaces 'groupStage', which must be at the front of the pipeline and whose input is known to be
+ * sorted by 'sortPattern', with a $_internalStreamingGroup where possible. The streaming group
+ * returns the groups for each value of the monotonic _id expressions as soon as that value
+ * changes, so it holds one batch of groups in memory instead of all of them.
+ *
+ * The rewrite is skipped when the sort uses a collation, since the monotonic state of an _id
+ * expression describes the order of its values without one, and when a multikey index on
+ * 'collection' shows the sort fields may hold arrays.
+ */
+void tryStreamingGroupOverSortedInput(const CollectionPtr& collection,
+                                      const SortPattern& sortPattern,
+                                      DocumentSourceGroup* groupStage,
+                                      Pipeline* pipeline) {
+    invariant(pipeline->peekFront() == groupStage);
+    if (groupStage->doingMerge()) {
+        return;
+    }
+
+    const auto& expCtx = pipeline->getContext();
+    if (expCtx->getCollator() ||
+        sortPatternCoversMultikeyPath(expCtx->opCtx, collection, sortPattern)) {
+        return;
+    }
+
+    auto monotonicIdExpressions = getMonotonicGroupIdExpressions(sortPattern, *groupStage);
+    if (monotonicIdExpressions.empty()) {
+        return;
+    }
+
+    // Unlike the time field of a time-series collection, the sort fields here may hold nulls or
+    // arrays, which are sorted but not clustered, so let the streaming group fall back to grouping
+    // the rest of its input at once when it finds one.
+    auto streamingGroup = DocumentSourceStreamingGroup::create(
+        expCtx,
+        groupStage->getIdExpression(),
+        std::move(monotonicIdExpressions),
+        std::move(groupStage->getMutableAccumulationStatements()),
+        groupStage->getMaxMemoryUsageBytes(),
+        true /* allowNullishOrArrayIds */);
+    pipeline->popFront();
+    pipeline->addInitialSource(std::move(streamingGroup));
+}
+
 boost::optional<long long> extractSkipForPushdown(Pipeline* pipeline) {
     // If the disablePipelineOptimization failpoint is enabled, then do not attempt the skip
     // pushdown optimization.
@@ -1499,6 +1732,18 @@ PipelineD::BuildQueryExecutorResult PipelineD::buildInnerQueryExecutorGeneric(
                         QueryPlannerParams::ASSERT_MIN_TS_HAS_NOT_FALLEN_OFF_OPLOG);
     }
 
+    // A $sort at the front of the pipeline is pushed down into the query layer, so a $group right
+    // after it sees the executor's output in the order of the sort. Hold on to the $group to tell
+    // whether it is still the first stage once the executor has been built, as it may have been
+    // lowered into the executor or replaced by a DISTINCT_SCAN.
+    boost::optional<SortPattern> pushedDownSortPattern;
+    boost::intrusive_ptr<DocumentSourceGroup> groupAfterSort;
+    if (auto sortStage = dynamic_cast<DocumentSourceSort*>(pipeline->peekFront());
+        sortStage && sources.size() > 1) {
+        groupAfterSort = dynamic_cast<DocumentSourceGroup*>(std::next(sources.begin())->get());
+        pushedDownSortPattern = sortStage->getSortKeyPattern();
+    }
+
     // Create the PlanExecutor.
     bool shouldProduceEmptyDocs = false;
     auto exec = uassertStatusOK(prepareExecutor(expCtx,
@@ -1514,6 +1759,14 @@ PipelineD::BuildQueryExecutorResult PipelineD::buildInnerQueryExecutorGeneric(
                                                 plannerOpts,
                                                 std::move(traversalPreference)));
 
+    if (groupAfterSort && pipeline->peekFront() == groupAfterSort.get() &&
+        internalDocumentSourceGroupStreamOverSortedInput.load()) {
+        tryStreamingGroupOverSortedInput(collections.getMainCollection(),
+                                         *pushedDownSortPattern,
+                                         groupAfterSort.get(),
+                                         pipeline);
+    }
+
     // If this is a query on a time-series collection then it may be eligible for a post-planning
     // sort optimization. We check eligibility and perform the rewrite here.
     if (timeseriesBoundedSortOptimization) {
@@ -220,7 +220,9 @@ private:
     /**
      * Returns a 'PlanExecutor' which uses a random cursor to sample documents if successful as
      * determined by the boolean. Returns {} if the storage engine doesn't support random cursors,
-     * or if 'sampleSize' is a large enough percentage of the collection.
+     * or if 'sampleSize' is a large enough percentage of the collection. A 'blockSize' greater
+     * than 1 reads that many consecutive records from each random position, see $sample's
+     * 'blockSize' option.
      *
      * Note: this function may mutate the input 'pipeline' sources in the case of timeseries
      * collections. It always pushes down the $_internalUnpackBucket source to the PlanStage layer.
@@ -235,6 +237,7 @@ private:
                                Pipeline* pipeline,
                                long long sampleSize,
                                long long numRecords,
+                               long long blockSize,
                                boost::optional<timeseries::BucketUnpacker> bucketUnpacker);
 
     typedef bool IndexSortOrderAgree;
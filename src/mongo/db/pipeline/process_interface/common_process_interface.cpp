@@ -95,8 +95,20 @@ std::vector<BSONObj> CommonProcessInterface::getCurrentOps(
 #endif
 
     auto reportCurrentOpForService = [&](Service* service) {
-        for (Service::LockedClientsCursor cursor(service); ClientLock lc = cursor.next();) {
-            Client* client = &*lc;
+        for (ServiceContext::LockedClientsCursor cursor(service->getServiceContext());
+             Client* client = cursor.next();) {
+            // On nodes with many connections most clients are idle. Skip them without taking
+            // each Client's lock, which otherwise makes every poll contend with all connections.
+            if (connMode == CurrentOpConnectionsMode::kExcludeIdle &&
+                !client->mayHaveActiveCurrentOp()) {
+                continue;
+            }
+
+            ClientLock lc(client);
+            if (client->getService() != service) {
+                continue;
+            }
+
             if (ctxAuth->getAuthorizationManager().isAuthEnabled()) {
                 // If auth is disabled, ignore the allUsers parameter.
                 if (userMode == CurrentOpUserMode::kExcludeOthers &&
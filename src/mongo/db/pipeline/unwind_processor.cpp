@@ -43,9 +43,11 @@ UnwindProcessor::UnwindProcessor(const FieldPath& unwindPath,
                                  bool preserveNullAndEmptyArrays,
                                  const boost::optional<FieldPath>& indexPath,
                                  bool strict)
-    : _unwindPath(unwindPath),
+    : _unwindPath(unwindPath.fullPath(), true /* precomputeHashes */),
       _preserveNullAndEmptyArrays(preserveNullAndEmptyArrays),
-      _indexPath(indexPath),
+      _indexPath(indexPath ? boost::make_optional(FieldPath(indexPath->fullPath(),
+                                                            true /* precomputeHashes */))
+                           : boost::none),
       _strict(strict) {}
 
 void UnwindProcessor::process(const Document& document) {
@@ -1020,7 +1020,16 @@ public:
           _ps(std::move(ps)),
           _method(method),
           _intializeExpr(std::move(initializeExpr)) {
-        expCtx->sbeWindowCompatibility = SbeCompatibility::notCompatible;
+        // SBE only implements the removable form of these window functions, which is used unless
+        // the lower bound of the window is unbounded.
+        auto lowerUnbounded = std::visit(
+            [](const auto& bounds) {
+                return std::holds_alternative<WindowBounds::Unbounded>(bounds.lower);
+            },
+            _bounds.bounds);
+        if (lowerUnbounded) {
+            expCtx->sbeWindowCompatibility = SbeCompatibility::notCompatible;
+        }
     }
 
     Value serialize(const SerializationOptions& opts) const final;
@@ -1029,6 +1038,10 @@ public:
 
     std::unique_ptr<WindowFunctionState> buildRemovable() const final;
 
+    const std::vector<double>& getPs() const {
+        return _ps;
+    }
+
 private:
     std::vector<double> _ps;
     PercentileMethod _method;
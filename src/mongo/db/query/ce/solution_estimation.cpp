@@ -0,0 +1,184 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/db/query/ce/solution_estimation.h"
+
+#include <algorithm>
+
+#include "mongo/bson/bsonelement.h"
+#include "mongo/db/exec/sbe/values/bson.h"
+#include "mongo/db/query/ce/histogram_predicate_estimation.h"
+#include "mongo/db/query/index_bounds.h"
+#include "mongo/db/query/interval.h"
+#include "mongo/db/query/stats/value_utils.h"
+
+namespace mongo::optimizer::ce {
+namespace {
+/**
+ * Estimates the fraction of the values of a field described by 'ah' that fall into 'interval'.
+ */
+boost::optional<double> estimateIntervalSelectivity(const stats::ArrayHistogram& ah,
+                                                    const Interval& interval) {
+    if (interval.isMinToMax() || interval.isMaxToMin()) {
+        return 1.0;
+    }
+
+    // Index bounds on a descending index are reversed. The histogram expects ascending ranges.
+    const bool reversed = interval.getDirection() == Interval::Direction::kDirectionDescending;
+    const auto& low = reversed ? interval.end : interval.start;
+    const auto& high = reversed ? interval.start : interval.end;
+    const bool lowInclusive = reversed ? interval.endInclusive : interval.startInclusive;
+    const bool highInclusive = reversed ? interval.startInclusive : interval.endInclusive;
+
+    auto [lowTag, lowVal] = sbe::bson::convertFrom<true>(low);
+    auto [highTag, highVal] = sbe::bson::convertFrom<true>(high);
+
+    // Histograms don't describe MinKey and MaxKey, and a range that crosses type brackets can't be
+    // interpolated in a single histogram.
+    if (lowTag == sbe::value::TypeTags::MinKey || highTag == sbe::value::TypeTags::MaxKey ||
+        !stats::sameTypeBracket(lowTag, highTag)) {
+        return boost::none;
+    }
+
+    if (interval.isPoint()) {
+        return estimateSelEq(ah, lowTag, lowVal, true /* includeScalar */)._value;
+    }
+
+    return estimateSelRange(ah,
+                            lowInclusive,
+                            lowTag,
+                            lowVal,
+                            highInclusive,
+                            highTag,
+                            highVal,
+                            true /* includeScalar */)
+        ._value;
+}
+
+boost::optional<double> estimateIndexScan(const IndexScanNode& node,
+                                          const HistogramLookupFn& getHistogram,
+                                          double collectionCardinality) {
+    // Collation keys and the keys of special indexes don't compare like the values the histograms
+    // are built from.
+    if (node.index.type != INDEX_BTREE || node.index.collator || node.bounds.isSimpleRange ||
+        node.bounds.fields.empty()) {
+        return boost::none;
+    }
+
+    auto histogram = getHistogram(node.index.keyPattern.firstElementFieldName());
+    if (!histogram) {
+        return boost::none;
+    }
+
+    double selectivity = 0.0;
+    for (const auto& interval : node.bounds.fields[0].intervals) {
+        auto intervalSelectivity = estimateIntervalSelectivity(*histogram, interval);
+        if (!intervalSelectivity) {
+            return boost::none;
+        }
+        selectivity += *intervalSelectivity;
+    }
+
+    return std::min(selectivity, 1.0) * collectionCardinality;
+}
+
+boost::optional<double> estimateNode(const QuerySolutionNode* node,
+                                     const HistogramLookupFn& getHistogram,
+                                     double collectionCardinality) {
+    switch (node->getType()) {
+        case STAGE_COLLSCAN:
+            return collectionCardinality;
+        case STAGE_IXSCAN:
+            return estimateIndexScan(
+                *static_cast<const IndexScanNode*>(node), getHistogram, collectionCardinality);
+        default:
+            break;
+    }
+
+    // Any other leaf is a kind of scan that we don't know how to estimate.
+    if (node->children.empty()) {
+        return boost::none;
+    }
+
+    // The remaining stages process the output of their children, so the cost of the plan is
+    // dominated by what the scans underneath them examine.
+    double total = 0.0;
+    for (const auto& child : node->children) {
+        auto childEstimate = estimateNode(child.get(), getHistogram, collectionCardinality);
+        if (!childEstimate) {
+            return boost::none;
+        }
+        total += *childEstimate;
+    }
+    return total;
+}
+}  // namespace
+
+boost::optional<double> estimateScannedCardinality(const QuerySolution& solution,
+                                                   const HistogramLookupFn& getHistogram,
+                                                   double collectionCardinality) {
+    if (!solution.root()) {
+        return boost::none;
+    }
+    return estimateNode(solution.root(), getHistogram, collectionCardinality);
+}
+
+boost::optional<size_t> pickSolutionByEstimatedCardinality(
+    const std::vector<std::unique_ptr<QuerySolution>>& solutions,
+    const HistogramLookupFn& getHistogram,
+    double collectionCardinality,
+    double minRatio) {
+    if (solutions.size() < 2) {
+        return boost::none;
+    }
+
+    std::vector<double> estimates;
+    estimates.reserve(solutions.size());
+    for (const auto& solution : solutions) {
+        auto estimate = estimateScannedCardinality(*solution, getHistogram, collectionCardinality);
+        if (!estimate) {
+            return boost::none;
+        }
+        estimates.push_back(*estimate);
+    }
+
+    auto bestIt = std::min_element(estimates.begin(), estimates.end());
+    const size_t bestIdx = std::distance(estimates.begin(), bestIt);
+
+    // Add one to the estimates so that a plan estimated to examine nothing doesn't automatically
+    // beat a plan estimated to examine a handful of keys.
+    for (size_t i = 0; i < estimates.size(); ++i) {
+        if (i != bestIdx && estimates[i] + 1 < minRatio * (*bestIt + 1)) {
+            return boost::none;
+        }
+    }
+    return bestIdx;
+}
+
+}  // namespace mongo::optimizer::ce
@@ -0,0 +1,76 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <boost/optional/optional.hpp>
+
+#include "mongo/db/query/query_solution.h"
+#include "mongo/db/query/stats/array_histogram.h"
+
+namespace mongo::optimizer::ce {
+
+/**
+ * Returns the histogram for the given dotted path, or nullptr if there is none.
+ */
+using HistogramLookupFn =
+    std::function<std::shared_ptr<const stats::ArrayHistogram>(const std::string& path)>;
+
+/**
+ * Estimates how many documents or index keys the scans of 'solution' examine. A collection scan
+ * examines 'collectionCardinality' documents. The keys that an index scan examines are estimated
+ * from the histogram of the leading field of the index and the bounds on that field.
+ *
+ * Returns boost::none if the estimate cannot be computed. This happens if the solution contains a
+ * scan other than a collection scan or a btree index scan, if the leading field of an index has no
+ * histogram, or if the bounds on it cannot be estimated.
+ */
+boost::optional<double> estimateScannedCardinality(const QuerySolution& solution,
+                                                   const HistogramLookupFn& getHistogram,
+                                                   double collectionCardinality);
+
+/**
+ * Picks the solution which examines the fewest documents or index keys according to
+ * estimateScannedCardinality(). A solution is only picked if all the solutions can be estimated
+ * and every other solution is estimated to examine at least 'minRatio' times more. Otherwise the
+ * estimates are too close to call and boost::none is returned, so that the caller can fall back to
+ * ranking the solutions with trial runs.
+ */
+boost::optional<size_t> pickSolutionByEstimatedCardinality(
+    const std::vector<std::unique_ptr<QuerySolution>>& solutions,
+    const HistogramLookupFn& getHistogram,
+    double collectionCardinality,
+    double minRatio);
+
+}  // namespace mongo::optimizer::ce
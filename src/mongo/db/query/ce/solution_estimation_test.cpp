@@ -0,0 +1,164 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/db/query/ce/solution_estimation.h"
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "mongo/bson/bsonmisc.h"
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/db/index/index_descriptor.h"
+#include "mongo/db/index_names.h"
+#include "mongo/db/query/index_bounds.h"
+#include "mongo/db/query/interval.h"
+#include "mongo/db/query/query_solution.h"
+#include "mongo/db/query/stats/array_histogram.h"
+#include "mongo/db/query/stats/max_diff.h"
+#include "mongo/db/query/stats/value_utils.h"
+#include "mongo/unittest/framework.h"
+
+namespace mongo::optimizer::ce {
+namespace {
+constexpr double kCollectionCardinality = 1000.0;
+
+IndexEntry makeIndexEntry(const BSONObj& keyPattern) {
+    return {keyPattern,
+            IndexNames::nameToType(IndexNames::findPluginName(keyPattern)),
+            IndexDescriptor::kLatestIndexVersion,
+            false,
+            {},
+            {},
+            false,
+            false,
+            CoreIndexInfo::Identifier(keyPattern.firstElementFieldName()),
+            nullptr,
+            {},
+            nullptr,
+            nullptr};
+}
+
+std::unique_ptr<QuerySolution> makeIndexScanSolution(const std::string& field,
+                                                     long long low,
+                                                     long long high) {
+    auto ixscan = std::make_unique<IndexScanNode>(makeIndexEntry(BSON(field << 1)));
+    OrderedIntervalList oil(field);
+    oil.intervals.push_back(Interval(BSON("" << low << "" << high), true, true));
+    ixscan->bounds.fields.push_back(std::move(oil));
+
+    auto solution = std::make_unique<QuerySolution>();
+    solution->setRoot(std::make_unique<FetchNode>(std::move(ixscan)));
+    return solution;
+}
+
+std::unique_ptr<QuerySolution> makeCollScanSolution() {
+    auto solution = std::make_unique<QuerySolution>();
+    solution->setRoot(std::make_unique<CollectionScanNode>());
+    return solution;
+}
+
+class SolutionEstimationTest : public unittest::Test {
+protected:
+    void setUp() override {
+        // 'a' is unique across the collection, while 'b' only has 10 distinct values.
+        std::vector<stats::SBEValue> aValues;
+        std::vector<stats::SBEValue> bValues;
+        for (int i = 0; i < kCollectionCardinality; ++i) {
+            aValues.emplace_back(stats::makeInt64Value(i));
+            bValues.emplace_back(stats::makeInt64Value(i % 10));
+        }
+        _histograms["a"] = stats::createArrayEstimator(aValues, 100 /* nBuckets */);
+        _histograms["b"] = stats::createArrayEstimator(bValues, 10 /* nBuckets */);
+    }
+
+    HistogramLookupFn lookup() const {
+        return [this](const std::string& path) -> std::shared_ptr<const stats::ArrayHistogram> {
+            auto it = _histograms.find(path);
+            return it != _histograms.end() ? it->second : nullptr;
+        };
+    }
+
+    std::map<std::string, std::shared_ptr<const stats::ArrayHistogram>> _histograms;
+};
+
+TEST_F(SolutionEstimationTest, EstimatesIndexScanFromLeadingFieldHistogram) {
+    auto aPoint = estimateScannedCardinality(
+        *makeIndexScanSolution("a", 5, 5), lookup(), kCollectionCardinality);
+    ASSERT_TRUE(aPoint);
+    ASSERT_APPROX_EQUAL(1.0, *aPoint, 1.0);
+
+    auto bPoint = estimateScannedCardinality(
+        *makeIndexScanSolution("b", 5, 5), lookup(), kCollectionCardinality);
+    ASSERT_TRUE(bPoint);
+    ASSERT_APPROX_EQUAL(100.0, *bPoint, 10.0);
+
+    auto collScan =
+        estimateScannedCardinality(*makeCollScanSolution(), lookup(), kCollectionCardinality);
+    ASSERT_TRUE(collScan);
+    ASSERT_EQ(kCollectionCardinality, *collScan);
+}
+
+TEST_F(SolutionEstimationTest, NoEstimateWithoutHistogram) {
+    ASSERT_FALSE(estimateScannedCardinality(
+        *makeIndexScanSolution("c", 5, 5), lookup(), kCollectionCardinality));
+}
+
+TEST_F(SolutionEstimationTest, PicksClearlyCheapestSolution) {
+    std::vector<std::unique_ptr<QuerySolution>> solutions;
+    solutions.push_back(makeIndexScanSolution("b", 5, 5));
+    solutions.push_back(makeIndexScanSolution("a", 5, 5));
+    solutions.push_back(makeCollScanSolution());
+
+    auto best =
+        pickSolutionByEstimatedCardinality(solutions, lookup(), kCollectionCardinality, 10.0);
+    ASSERT_TRUE(best);
+    ASSERT_EQ(1U, *best);
+}
+
+TEST_F(SolutionEstimationTest, FallsBackWhenEstimatesAreClose) {
+    std::vector<std::unique_ptr<QuerySolution>> solutions;
+    solutions.push_back(makeIndexScanSolution("a", 0, 99));
+    solutions.push_back(makeIndexScanSolution("b", 5, 5));
+
+    ASSERT_FALSE(
+        pickSolutionByEstimatedCardinality(solutions, lookup(), kCollectionCardinality, 10.0));
+}
+
+TEST_F(SolutionEstimationTest, FallsBackWhenAnySolutionCannotBeEstimated) {
+    std::vector<std::unique_ptr<QuerySolution>> solutions;
+    solutions.push_back(makeIndexScanSolution("a", 5, 5));
+    solutions.push_back(makeIndexScanSolution("c", 5, 5));
+
+    ASSERT_FALSE(
+        pickSolutionByEstimatedCardinality(solutions, lookup(), kCollectionCardinality, 10.0));
+}
+}  // namespace
+}  // namespace mongo::optimizer::ce
@@ -29,6 +29,8 @@
 
 #include "mongo/db/query/classic_runtime_planner/planner_interface.h"
 
+#include "mongo/db/exec/batched_update_stage.h"
+#include "mongo/db/exec/collection_scan.h"
 #include "mongo/db/exec/count.h"
 #include "mongo/db/exec/spool.h"
 #include "mongo/db/exec/timeseries_modify.h"
@@ -146,6 +148,21 @@ void ClassicPlannerInterface::addUpdateStage(ParsedUpdate* parsedUpdate,
     const auto& request = parsedUpdate->getRequest();
     const bool isUpsert = updateStageParams.request->isUpsert();
     const auto timeseriesOptions = collections().getMainCollection()->getTimeseriesOptions();
+
+    // As for batched deletes, change streams' pre- and post-images and the config.* namespace are
+    // not supported.
+    const bool batchUpdate = gBatchUserMultiUpdates.load() &&
+        (shard_role_details::getRecoveryUnit(opCtx())->getState() ==
+             RecoveryUnit::State::kInactive ||
+         shard_role_details::getRecoveryUnit(opCtx())->getState() ==
+             RecoveryUnit::State::kActiveNotInUnitOfWork) &&
+        !opCtx()->inMultiDocumentTransaction() && !opCtx()->isRetryableWrite() &&
+        !collections().getMainCollection()->isChangeStreamPreAndPostImagesEnabled() &&
+        !collections().getMainCollection()->ns().isConfigDB() && request->isMulti() &&
+        !isUpsert && !request->isFromOplogApplication() &&
+        request->source() != OperationSource::kFromMigrate && !request->shouldReturnAnyDocs() &&
+        request->getSort().isEmpty() && !updateStageParams.numStatsForDoc;
+
     if (parsedUpdate->isEligibleForArbitraryTimeseriesUpdate()) {
         if (request->isMulti()) {
             // If this is a multi-update, we need to spool the data before beginning to apply
@@ -180,6 +197,13 @@ void ClassicPlannerInterface::addUpdateStage(ParsedUpdate* parsedUpdate,
                                               ws(),
                                               collections().getMainAcquisition(),
                                               _root.release());
+    } else if (batchUpdate) {
+        _root = std::make_unique<BatchedUpdateStage>(cq()->getExpCtxRaw(),
+                                                     updateStageParams,
+                                                     std::make_unique<BatchedUpdateStageParams>(),
+                                                     ws(),
+                                                     collections().getMainAcquisition(),
+                                                     _root.release());
     } else {
         _root = std::make_unique<UpdateStage>(cq()->getExpCtxRaw(),
                                               updateStageParams,
@@ -197,6 +221,11 @@ void ClassicPlannerInterface::addUpdateStage(ParsedUpdate* parsedUpdate,
 
 void ClassicPlannerInterface::addCountStage(long long limit, long long skip) {
     invariant(_state == kNotInitialized);
+    // When the plan is a single collection scan, such as a bounded scan over the cluster key of a
+    // clustered collection, the count only needs the RecordIds.
+    if (_root->stageType() == STAGE_COLLSCAN) {
+        static_cast<CollectionScan*>(_root.get())->setReturnRecordIdsOnly();
+    }
     // Make a CountStage to be the new root.
     _root = std::make_unique<CountStage>(cq()->getExpCtxRaw(),
                                          collections().getMainCollection(),
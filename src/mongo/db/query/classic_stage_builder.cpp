@@ -45,6 +45,7 @@
 #include "mongo/db/catalog/collection.h"
 #include "mongo/db/catalog/index_catalog.h"
 #include "mongo/db/catalog/index_catalog_entry.h"
+#include "mongo/db/exec/and_bitmap.h"
 #include "mongo/db/exec/and_hash.h"
 #include "mongo/db/exec/and_sorted.h"
 #include "mongo/db/exec/collection_scan.h"
@@ -232,6 +233,14 @@ std::unique_ptr<PlanStage> ClassicStageBuilder::build(const QuerySolutionNode* r
         }
         case STAGE_AND_HASH: {
             const AndHashNode* ahn = static_cast<const AndHashNode*>(root);
+            if (ahn->useBitmaps) {
+                auto ret = std::make_unique<AndBitmapStage>(expCtx, _ws);
+                for (size_t i = 0; i < ahn->children.size(); ++i) {
+                    auto childStage = build(ahn->children[i].get());
+                    ret->addChild(std::move(childStage));
+                }
+                return ret;
+            }
             auto ret = std::make_unique<AndHashStage>(expCtx, _ws);
             for (size_t i = 0; i < ahn->children.size(); ++i) {
                 auto childStage = build(ahn->children[i].get());
@@ -379,6 +388,7 @@ std::unique_ptr<PlanStage> ClassicStageBuilder::build(const QuerySolutionNode* r
             params.scanDirection = dn->direction;
             params.bounds = dn->bounds;
             params.fieldNo = dn->fieldNo;
+            params.shouldDedup = dn->shouldDedup;
             return std::make_unique<DistinctScan>(expCtx, _collection, std::move(params), _ws);
         }
         case STAGE_COUNT_SCAN: {
@@ -401,6 +411,12 @@ std::unique_ptr<PlanStage> ClassicStageBuilder::build(const QuerySolutionNode* r
             params.startKeyInclusive = csn->startKeyInclusive;
             params.endKey = csn->endKey;
             params.endKeyInclusive = csn->endKeyInclusive;
+            for (const auto& interval : csn->additionalIntervals) {
+                params.additionalIntervals.push_back({interval.startKey,
+                                                      interval.startKeyInclusive,
+                                                      interval.endKey,
+                                                      interval.endKeyInclusive});
+            }
             return std::make_unique<CountScan>(expCtx, _collection, std::move(params), _ws);
         }
         case STAGE_EOF: {
@@ -439,6 +455,7 @@ std::unique_ptr<PlanStage> ClassicStageBuilder::build(const QuerySolutionNode* r
             return mockStage;
         }
         case STAGE_BATCHED_DELETE:
+        case STAGE_BATCHED_UPDATE:
         case STAGE_CACHED_PLAN:
         case STAGE_COUNT:
         case STAGE_DELETE:
@@ -41,6 +41,7 @@
 #include <boost/optional/optional.hpp>
 #include <boost/smart_ptr/intrusive_ptr.hpp>
 // IWYU pragma: no_include "ext/alloc_traits.h"
+#include <algorithm>
 #include <cstdint>
 #include <iterator>
 #include <limits>
@@ -105,6 +106,7 @@
 #include "mongo/db/pipeline/sbe_pushdown.h"
 #include "mongo/db/pipeline/search/search_helper.h"
 #include "mongo/db/query/canonical_query.h"
+#include "mongo/db/query/ce/solution_estimation.h"
 #include "mongo/db/query/classic_plan_cache.h"
 #include "mongo/db/query/classic_runtime_planner/planner_interface.h"
 #include "mongo/db/query/classic_runtime_planner_for_sbe/planner_interface.h"
@@ -124,7 +126,9 @@
 #include "mongo/db/query/optimizer/defs.h"
 #include "mongo/db/query/optimizer/explain_interface.h"
 #include "mongo/db/query/plan_cache.h"
+#include "mongo/db/query/plan_cache_callbacks.h"
 #include "mongo/db/query/plan_cache_key_factory.h"
+#include "mongo/db/query/plan_cache_warmup.h"
 #include "mongo/db/query/plan_executor_express.h"
 #include "mongo/db/query/plan_executor_factory.h"
 #include "mongo/db/query/plan_explainer.h"
@@ -156,6 +160,7 @@
 #include "mongo/db/query/sbe_sub_planner.h"
 #include "mongo/db/query/stage_builder_util.h"
 #include "mongo/db/query/stage_types.h"
+#include "mongo/db/query/stats/stats_catalog.h"
 #include "mongo/db/query/util/make_data_structure.h"
 #include "mongo/db/query/wildcard_multikey_paths.h"
 #include "mongo/db/query/yield_policy_callbacks_impl.h"
@@ -221,7 +226,7 @@ boost::intrusive_ptr<ExpressionContext> makeExpressionContextForGetExecutor(
 namespace {
 namespace wcp = ::mongo::wildcard_planning;
 // The body is below in the "count hack" section but getExecutor calls it.
-bool turnIxscanIntoCount(QuerySolution* soln);
+bool turnIxscanIntoCount(QuerySolution* soln, bool allowMultipleIntervals);
 }  // namespace
 
 namespace {
@@ -423,6 +428,9 @@ private:
 template <typename KeyType, typename ResultType>
 class PrepareExecutionHelper {
 public:
+    // Only the classic engine can count over multiple disjoint intervals with a single COUNT_SCAN.
+    static constexpr bool kClassicEngine = std::is_same_v<ResultType, ClassicRuntimePlannerResult>;
+
     PrepareExecutionHelper(OperationContext* opCtx,
                            const MultipleCollectionAccessor& collections,
                            CanonicalQuery* cq,
@@ -543,7 +551,7 @@ public:
         // See if one of our solutions is a fast count hack in disguise.
         if (_cq->isCountLike()) {
             for (size_t i = 0; i < solutions.size(); ++i) {
-                if (turnIxscanIntoCount(solutions[i].get())) {
+                if (turnIxscanIntoCount(solutions[i].get(), kClassicEngine)) {
                     LOGV2_DEBUG(20925,
                                 2,
                                 "Using fast count",
@@ -553,6 +561,29 @@ public:
             }
         }
 
+        // A plan cache entry from a snapshot taken before a restart lets us skip multi-planning.
+        if (solutions.size() > 1 &&
+            !plan_cache_warmup::PlanCacheWarmupStore::get(_opCtx->getServiceContext()).empty()) {
+            if (auto result = buildRestoredCachedPlan(solutions)) {
+                return {std::move(result)};
+            }
+        }
+
+        // When histograms are available for every candidate, a clear winner can be chosen from the
+        // estimated number of scanned keys and documents without running a trial period.
+        if (solutions.size() > 1 && !_cq->getExpCtxRaw()->forcePlanCache &&
+            internalQueryPlanSelectionUseHistograms.load()) {
+            if (auto best = pickSolutionByHistograms(solutions)) {
+                LOGV2_DEBUG(9156600,
+                            2,
+                            "Picked plan from histogram estimates",
+                            "query"_attr = redact(_queryStringForDebugLog),
+                            "solution"_attr = redact(solutions[*best]->toString()));
+                solutions[*best]->indexFilterApplied = _plannerParams.indexFiltersApplied;
+                return buildSingleSolutionPlan(std::move(solutions[*best]));
+            }
+        }
+
         // Force multiplanning (and therefore caching) if forcePlanCache is set. We could
         // manually update the plan cache instead without multiplanning but this is simpler.
         if (1 == solutions.size() && !_cq->getExpCtxRaw()->forcePlanCache) {
@@ -564,6 +595,26 @@ public:
     }
 
 protected:
+    /**
+     * Returns the index of the solution to use if the histograms of the main collection show it
+     * scans clearly less than every other candidate, or boost::none if trial runs are needed.
+     */
+    boost::optional<size_t> pickSolutionByHistograms(
+        const std::vector<std::unique_ptr<QuerySolution>>& solutions) {
+        const auto& mainColl = getCollections().getMainCollection();
+        auto getHistogram =
+            [&](const std::string& path) -> std::shared_ptr<const stats::ArrayHistogram> {
+            auto swHistogram =
+                stats::StatsCatalog::get(_opCtx).getHistogram(_opCtx, mainColl->ns(), path);
+            return swHistogram.isOK() ? swHistogram.getValue() : nullptr;
+        };
+        return optimizer::ce::pickSolutionByEstimatedCardinality(
+            solutions,
+            getHistogram,
+            static_cast<double>(mainColl->numRecords(_opCtx)),
+            internalQueryPlanSelectionHistogramMinRatio.load());
+    }
+
     const MultipleCollectionAccessor& getCollections() const {
         return _collections;
     }
@@ -612,6 +663,17 @@ protected:
     // boost::none.
     virtual boost::optional<size_t> getCachedPlanHash(const KeyType& planCacheKey) = 0;
 
+    /**
+     * Re-installs the plan cache entry that a snapshot of the plan cache holds for the query, if
+     * one of 'solutions' has the same access path and indexes, and builds the plan from the cache.
+     * Returns nullptr if there is no such entry, or if the plan cache does not support restoring
+     * entries.
+     */
+    virtual std::unique_ptr<ResultType> buildRestoredCachedPlan(
+        std::vector<std::unique_ptr<QuerySolution>>& solutions) {
+        return nullptr;
+    }
+
     /**
      * Constructs a special PlanStage tree for rooted $or queries. Each clause of the $or is planned
      * individually, and then an overall query plan is created based on the winning plan from each
@@ -742,6 +804,70 @@ private:
         return boost::none;
     }
 
+    std::unique_ptr<ClassicRuntimePlannerResult> buildRestoredCachedPlan(
+        std::vector<std::unique_ptr<QuerySolution>>& solutions) final {
+        if (!shouldCacheQuery(*_cq)) {
+            return nullptr;
+        }
+
+        const auto& collection = getCollections().getMainCollection();
+        auto planCacheKey = buildPlanCacheKey();
+        auto warmupEntry =
+            plan_cache_warmup::PlanCacheWarmupStore::get(_opCtx->getServiceContext())
+                .take(collection->uuid(), planCacheKey.planCacheKeyHash());
+        if (!warmupEntry) {
+            return nullptr;
+        }
+
+        // If no candidate uses the same indexes, they changed since the snapshot was taken.
+        auto solutionIt =
+            std::find_if(solutions.begin(), solutions.end(), [&](const auto& solution) {
+                return solution->cacheData &&
+                    plan_cache_warmup::matchesCacheData(*warmupEntry, *solution->cacheData);
+            });
+        if (solutionIt == solutions.end()) {
+            return nullptr;
+        }
+        auto& solution = *solutionIt;
+        solution->cacheData->indexFilterApplied = _plannerParams.indexFiltersApplied;
+        solution->cacheData->solutionHash = solution->hash();
+
+        // The ranking decision which picked the plan is gone. The works it took are all the plan
+        // cache needs from it.
+        auto ranking = std::make_unique<plan_ranker::PlanRankingDecision>();
+        auto stats =
+            std::make_unique<PlanStageStats>(CommonStats("PLAN_CACHE_SNAPSHOT"), STAGE_CACHED_PLAN);
+        stats->common.works = warmupEntry->getWorks();
+        std::vector<std::unique_ptr<PlanStageStats>> candidateStats;
+        candidateStats.push_back(std::move(stats));
+        ranking->stats = plan_ranker::StatsDetails{std::move(candidateStats)};
+        ranking->scores = {0.0};
+        ranking->candidateOrder = {0};
+
+        auto buildDebugInfoFn = [&]() -> plan_cache_debug_info::DebugInfo {
+            return plan_cache_util::buildDebugInfo(*_cq, std::move(ranking));
+        };
+        PlanCacheCallbacksImpl<PlanCacheKey, SolutionCacheData, plan_cache_debug_info::DebugInfo>
+            callbacks{*_cq, buildDebugInfoFn};
+        auto isSensitive = CurOp::get(_opCtx)->getShouldOmitDiagnosticInformation();
+        CollectionQueryInfo::get(collection)
+            .getPlanCache()
+            ->setRestored(planCacheKey,
+                          solution->cacheData->clone(),
+                          warmupEntry->getWorks(),
+                          _opCtx->getServiceContext()->getPreciseClockSource()->now(),
+                          &callbacks,
+                          isSensitive ? PlanSecurityLevel::kSensitive
+                                      : PlanSecurityLevel::kNotSensitive);
+
+        LOGV2_DEBUG(9156601,
+                    2,
+                    "Restored plan cache entry from snapshot",
+                    "query"_attr = redact(_queryStringForDebugLog),
+                    "works"_attr = warmupEntry->getWorks());
+        return buildCachedPlan(planCacheKey);
+    }
+
     std::unique_ptr<ClassicRuntimePlannerResult> buildSubPlan() final {
         auto result = releaseResult();
         result->runtimePlanner = std::make_unique<crp_classic::SubPlanner>(makePlannerData());
@@ -773,9 +899,9 @@ private:
 
         std::unique_ptr<QuerySolution> querySolution = std::move(statusWithQs.getValue());
         if (_cq->isCountLike()) {
-            const bool usedFastCount = turnIxscanIntoCount(querySolution.get());
+            const bool usedFastCount = turnIxscanIntoCount(querySolution.get(), kClassicEngine);
             if (usedFastCount) {
-                if (_cq->isCountLike() && turnIxscanIntoCount(querySolution.get())) {
+                if (_cq->isCountLike() && turnIxscanIntoCount(querySolution.get(), kClassicEngine)) {
                     LOGV2_DEBUG(5968201,
                                 2,
                                 "Using fast count",
@@ -1898,13 +2024,64 @@ StatusWith<std::unique_ptr<PlanExecutor, PlanExecutor::Deleter>> getExecutorUpda
 
 namespace {
 
+/**
+ * Splits 'bounds' into at most 'maxIntervals' ranges of keys, each of which is a single interval of
+ * the index, e.g. a point of an $in on the leading field. The ranges are returned in the order of
+ * the bounds. Returns false if 'bounds' cannot be split this way.
+ */
+bool explodeIntoSingleIntervals(const IndexBounds& bounds,
+                                size_t maxIntervals,
+                                std::vector<CountScanNode::Interval>* out) {
+    size_t numIntervals = 1;
+    for (const auto& oil : bounds.fields) {
+        if (oil.intervals.empty()) {
+            return false;
+        }
+        numIntervals *= oil.intervals.size();
+        if (numIntervals > maxIntervals) {
+            return false;
+        }
+    }
+
+    // Walk the cartesian product of the per-field intervals, varying the last field the fastest.
+    // Since the intervals of each field are disjoint and sorted, so are the resulting ranges.
+    std::vector<size_t> position(bounds.fields.size(), 0);
+    for (size_t n = 0; n < numIntervals; ++n) {
+        IndexBounds singleBounds;
+        for (size_t i = 0; i < bounds.fields.size(); ++i) {
+            OrderedIntervalList oil(bounds.fields[i].name);
+            oil.intervals.push_back(bounds.fields[i].intervals[position[i]]);
+            singleBounds.fields.push_back(std::move(oil));
+        }
+
+        CountScanNode::Interval interval;
+        if (!IndexBoundsBuilder::isSingleInterval(singleBounds,
+                                                  &interval.startKey,
+                                                  &interval.startKeyInclusive,
+                                                  &interval.endKey,
+                                                  &interval.endKeyInclusive)) {
+            return false;
+        }
+        out->push_back(std::move(interval));
+
+        for (size_t i = bounds.fields.size(); i-- > 0;) {
+            if (++position[i] < bounds.fields[i].intervals.size()) {
+                break;
+            }
+            position[i] = 0;
+        }
+    }
+    return true;
+}
+
 /**
  * Returns 'true' if the provided solution 'soln' can be rewritten to use a fast counting stage.
- * Mutates the tree in 'soln->root'.
+ * Mutates the tree in 'soln->root'. If 'allowMultipleIntervals' is true, index bounds which are a
+ * union of disjoint single intervals are counted by seeking between them.
  *
  * Otherwise, returns 'false'.
  */
-bool turnIxscanIntoCount(QuerySolution* soln) {
+bool turnIxscanIntoCount(QuerySolution* soln, bool allowMultipleIntervals) {
     QuerySolutionNode* root = soln->root();
 
     // Root should be an ixscan or fetch w/o any filters.
@@ -1964,7 +2141,35 @@ bool turnIxscanIntoCount(QuerySolution* soln) {
 
     if (!IndexBoundsBuilder::isSingleInterval(
             isn->bounds, &startKey, &startKeyInclusive, &endKey, &endKeyInclusive)) {
-        return false;
+        std::vector<CountScanNode::Interval> intervals;
+        if (!allowMultipleIntervals ||
+            !explodeIntoSingleIntervals(isn->bounds,
+                                        internalQueryMaxCountScanIntervals.load(),
+                                        &intervals) ||
+            intervals.size() < 2) {
+            return false;
+        }
+
+        // Count scans always run forwards, so each range and their order must be reversed for a
+        // backward index scan.
+        if (isn->direction < 0) {
+            std::reverse(intervals.begin(), intervals.end());
+            for (auto& interval : intervals) {
+                interval.startKey.swap(interval.endKey);
+                std::swap(interval.startKeyInclusive, interval.endKeyInclusive);
+            }
+        }
+
+        auto csn = std::make_unique<CountScanNode>(isn->index);
+        csn->startKey = std::move(intervals.front().startKey);
+        csn->startKeyInclusive = intervals.front().startKeyInclusive;
+        csn->endKey = std::move(intervals.front().endKey);
+        csn->endKeyInclusive = intervals.front().endKeyInclusive;
+        csn->additionalIntervals.assign(std::make_move_iterator(intervals.begin() + 1),
+                                        std::make_move_iterator(intervals.end()));
+        csn->iets = isn->iets;
+        soln->setRoot(std::move(csn));
+        return true;
     }
 
     // Make the count node that we replace the fetch + ixscan with.
@@ -2252,20 +2457,20 @@ bool turnIxscanIntoDistinctIxscan(QuerySolution* soln,
         }
     }
 
-    // We should not use a distinct scan if the field over which we are computing the distinct is
-    // multikey.
-    if (indexScanNode->index.multikey) {
-        const auto& multikeyPaths = indexScanNode->index.multikeyPaths;
-        if (multikeyPaths.empty()) {
-            // We don't have path-level multikey information available.
-            return false;
-        }
-
-        if (!multikeyPaths[fieldNo].empty()) {
-            // Path-level multikey information indicates that the distinct key contains at least one
-            // array component.
-            return false;
-        }
+    // A distinct scan over a field which is multikey visits each array element as its own key,
+    // so it effectively "unwinds" arrays. That is only acceptable when the caller is a distinct
+    // command (i.e. not 'strictDistinctOnly'), and only when the plan fetches the documents: the
+    // distinct command then extracts all values along the path from the full document, while a
+    // covered plan would report the index keys (e.g. 'undefined' for an empty array) instead.
+    // The DISTINCT_SCAN stage deduplicates RecordIds in this case, so that a document is fetched
+    // at most once even if it is keyed under several distinct values.
+    const auto& multikeyPaths = indexScanNode->index.multikeyPaths;
+    const bool distinctFieldMayBeMultikey = indexScanNode->index.multikey &&
+        (multikeyPaths.empty() || !multikeyPaths[fieldNo].empty());
+    if (distinctFieldMayBeMultikey &&
+        (strictDistinctOnly || !fetchNode ||
+         indexScanNode->index.type != IndexType::INDEX_BTREE)) {
+        return false;
     }
 
     // Make a new DistinctNode. We will swap this for the ixscan in the provided solution.
@@ -2276,6 +2481,7 @@ bool turnIxscanIntoDistinctIxscan(QuerySolution* soln,
         flipDistinctScanDirection ? indexScanNode->bounds.reverse() : indexScanNode->bounds;
     distinctNode->queryCollator = indexScanNode->queryCollator;
     distinctNode->fieldNo = fieldNo;
+    distinctNode->shouldDedup = distinctFieldMayBeMultikey;
 
     if (fetchNode) {
         // If the original plan had PROJECT and FETCH stages, we can get rid of the PROJECT
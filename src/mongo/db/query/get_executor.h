@@ -133,7 +133,8 @@ StatusWith<std::unique_ptr<PlanExecutor, PlanExecutor::Deleter>> getSearchMetada
  */
 bool turnIxscanIntoDistinctIxscan(QuerySolution* soln,
                                   const std::string& field,
-                                  bool strictDistinctOnly);
+                                  bool strictDistinctOnly,
+                                  bool flipDistinctScanDirection = false);
 
 /**
  * Attempts to get an executor that uses a DISTINCT_SCAN, intended for either a "distinct" command
@@ -198,6 +198,15 @@ public:
      * evicted entries.
      */
     size_t add(const K& key, V entry) {
+        return add(key, std::move(entry), [](const K&) {});
+    }
+
+    /**
+     * Same as above, but additionally invokes 'onEvict' with the key of each entry evicted to bring
+     * the kv-store back under budget, before the entry is destroyed.
+     */
+    template <typename OnEvict>
+    size_t add(const K& key, V entry, OnEvict&& onEvict) {
         KVMapConstIt i = _kvMap.find(&key);
         if (i != _kvMap.end()) {
             KVListIt found = i->second;
@@ -210,7 +219,7 @@ public:
         auto& newEntry = _kvList.emplace_front(std::make_pair(key, std::move(entry)));
         _kvMap[&newEntry.first] = _kvList.begin();
 
-        return evict();
+        return evict(onEvict);
     }
 
     /**
@@ -283,8 +292,16 @@ public:
      * Reset the kv-store with new budget tracker. Returns the number of evicted entries.
      */
     size_t reset(size_t newMaxSize) {
+        return reset(newMaxSize, [](const K&) {});
+    }
+
+    /**
+     * Same as above, but additionally invokes 'onEvict' with the key of each evicted entry.
+     */
+    template <typename OnEvict>
+    size_t reset(size_t newMaxSize, OnEvict&& onEvict) {
         _budgetTracker.reset(newMaxSize);
-        return evict();
+        return evict(onEvict);
     }
 
     /**
@@ -316,13 +333,16 @@ public:
 private:
     /**
      * If the kv-store is over its budget this function evicts the least recently used entries until
-     * the size is again under-budget. Returns the number of evicted entries
+     * the size is again under-budget. The key of each evicted entry is passed to 'onEvict'. Returns
+     * the number of evicted entries
      */
-    size_t evict() {
+    template <typename OnEvict>
+    size_t evict(OnEvict&& onEvict) {
         size_t nEvicted = 0;
         while (_budgetTracker.isOverBudget()) {
             invariant(!_kvList.empty());
 
+            onEvict(_kvList.back().first);
             _budgetTracker.onRemove(_kvList.back().first, _kvList.back().second);
             _kvMap.erase(&_kvList.back().first);
             _kvList.pop_back();
@@ -31,6 +31,7 @@
 
 #include <memory>
 #include <ostream>
+#include <vector>
 
 #include <absl/container/node_hash_map.h>
 #include <boost/move/utility_core.hpp>
@@ -226,6 +227,33 @@ TEST(LRUKeyValueTest, EvictionTest) {
     }
 }
 
+TEST(LRUKeyValueTest, EvictionCallbackReceivesEvictedKeys) {
+    int maxSize = 3;
+    TestSharedPtrValue cache{static_cast<size_t>(maxSize)};
+    std::vector<int> evicted;
+    auto onEvict = [&](const int& key) {
+        evicted.push_back(key);
+    };
+    for (int i = 0; i < maxSize; ++i) {
+        ASSERT_EQ(0, cache.add(i, std::make_shared<int>(i), onEvict));
+    }
+    ASSERT_TRUE(evicted.empty());
+
+    // Replacing an existing key is not an eviction.
+    ASSERT_EQ(0, cache.add(1, std::make_shared<int>(10), onEvict));
+    ASSERT_TRUE(evicted.empty());
+
+    ASSERT_EQ(1, cache.add(maxSize, std::make_shared<int>(maxSize), onEvict));
+    ASSERT_EQ(1UL, evicted.size());
+    ASSERT_EQ(0, evicted[0]);
+
+    ASSERT_EQ(2, cache.reset(1, onEvict));
+    ASSERT_EQ(3UL, evicted.size());
+    ASSERT_EQ(2, evicted[1]);
+    ASSERT_EQ(1, evicted[2]);
+    assertInKVStore(cache, maxSize, std::make_shared<int>(maxSize));
+}
+
 /**
  * Eviction test with non-trivial budget estimator.
  */
@@ -29,17 +29,29 @@
 
 #pragma once
 
+#include <memory>
+#include <vector>
+
 #include "mongo/db/catalog/util/partitioned.h"
 #include "mongo/db/commands/server_status_metric.h"
 #include "mongo/db/query/lru_key_value.h"
 #include "mongo/platform/mutex.h"
 #include "mongo/util/container_size_helper.h"
+#include "mongo/util/immutable/unordered_map.h"
 
 namespace mongo {
 
 /**
  * A partitioned cache combines a size-bounded map (LRU-based entry eviction) with a partition
  * function which allows reducing contention.
+ *
+ * When 'kLockFreeLookups' is true, every partition additionally publishes an immutable snapshot of
+ * its <key, value> pairs which is replaced, under the partition lock, by each modification made
+ * through this class. 'lookupUnlocked()' reads that snapshot without ever waiting for the
+ * partition lock, so readers are not serialized behind each other or behind writers. This requires
+ * 'ValueType' to be cheap to copy and safe to read concurrently (e.g. a shared_ptr to an immutable
+ * object), and all modifications to go through the methods of this class rather than through a
+ * 'Partition' handle.
  */
 template <class KeyType,
           class ValueType,
@@ -47,7 +59,8 @@ template <class KeyType,
           class Partitioner,
           class InsertionEvictionListener,
           class KeyHasher = std::hash<KeyType>,
-          class Eq = std::equal_to<KeyType>>
+          class Eq = std::equal_to<KeyType>,
+          bool kLockFreeLookups = false>
 class PartitionedCache {
 private:
     PartitionedCache(const PartitionedCache&) = delete;
@@ -62,6 +75,7 @@ public:
                             Eq>;
     using Partition = typename Partitioned<Lru, Partitioner>::OnePartition;
     using PartitionId = typename Partitioned<Lru, Partitioner>::PartitionId;
+    using ReadSnapshot = immutable::unordered_map<KeyType, ValueType, KeyHasher, Eq>;
 
     /**
      * Initialize plan cache with the total cache size in bytes and number of partitions.
@@ -104,6 +118,12 @@ public:
         Lru lru{cacheSize / numPartitions};
         _partitionedCache =
             std::make_unique<Partitioned<Lru, Partitioner>>(numPartitions, std::move(lru));
+        if constexpr (kLockFreeLookups) {
+            _readSnapshots.reserve(numPartitions);
+            for (size_t partitionId = 0; partitionId < numPartitions; ++partitionId) {
+                _readSnapshots.push_back(std::make_shared<const ReadSnapshot>());
+            }
+        }
     }
 
     ~PartitionedCache() = default;
@@ -113,14 +133,24 @@ public:
      */
     size_t put(const KeyType& key, ValueType value) {
         auto partition = _partitionedCache->lockOnePartition(key);
-        return partition->add(key, std::move(value));
+        return put(key, std::move(value), partition);
     }
     /**
      * Inserts the provided <key, value> into the specified partition. Returns the number of older
      * entries evicted to fit this new one.
      */
     size_t put(const KeyType& key, ValueType value, Partition& partition) {
-        return partition->add(key, std::move(value));
+        if constexpr (kLockFreeLookups) {
+            auto& published = _readSnapshots[Partitioner()(key, _numPartitions)];
+            auto snapshot = atomic_load(&published)->set(key, value);
+            auto nEvicted = partition->add(key, std::move(value), [&](const KeyType& evictedKey) {
+                snapshot = snapshot.erase(evictedKey);
+            });
+            atomic_store(&published, std::make_shared<const ReadSnapshot>(std::move(snapshot)));
+            return nEvicted;
+        } else {
+            return partition->add(key, std::move(value));
+        }
     }
 
     StatusWith<ValueType*> lookup(const KeyType& key) const {
@@ -133,6 +163,28 @@ public:
         return {&entry.getValue()->second};
     }
 
+    /**
+     * Lookup an entry without acquiring the partition lock, returning a copy of the value. The
+     * entry is promoted to the most recently used one only if its partition lock happens to be
+     * free, so under contention the LRU order is approximate. Only available when the cache is
+     * instantiated with 'kLockFreeLookups'.
+     */
+    StatusWith<ValueType> lookupUnlocked(const KeyType& key) const {
+        static_assert(kLockFreeLookups, "lookupUnlocked() requires lock-free lookups");
+        auto snapshot = atomic_load(&_readSnapshots[Partitioner()(key, _numPartitions)]);
+        const ValueType* value = snapshot->find(key);
+        if (!value) {
+            return Status(ErrorCodes::NoSuchKey, "no such key in partitioned cache");
+        }
+
+        if (auto partition = _partitionedCache->tryLockOnePartition(key)) {
+            // The entry may have been replaced or evicted since the snapshot was taken, in which
+            // case there is nothing to promote.
+            (*partition)->get(key).getStatus().ignore();
+        }
+        return {*value};
+    }
+
     /**
      * Lookup an entry and also return a lock over the partition. The lock is returned whether
      * or not the entry is found.
@@ -152,7 +204,17 @@ public:
      * the cache, this call is a no-op.
      */
     void remove(const KeyType& key) {
-        _partitionedCache->erase(key);
+        if constexpr (kLockFreeLookups) {
+            auto partition = _partitionedCache->lockOnePartition(key);
+            if (partition->erase(key)) {
+                auto& published = _readSnapshots[Partitioner()(key, _numPartitions)];
+                atomic_store(&published,
+                             std::make_shared<const ReadSnapshot>(
+                                 atomic_load(&published)->erase(key)));
+            }
+        } else {
+            _partitionedCache->erase(key);
+        }
     }
 
     /**
@@ -164,7 +226,25 @@ public:
         size_t nRemoved = 0;
         for (size_t partitionId = 0; partitionId < _numPartitions; ++partitionId) {
             auto lockedPartition = _partitionedCache->lockOnePartitionById(partitionId);
-            nRemoved += lockedPartition->removeIf(predicate);
+            if constexpr (kLockFreeLookups) {
+                auto& published = _readSnapshots[partitionId];
+                auto snapshot = *atomic_load(&published);
+                auto nRemovedFromPartition =
+                    lockedPartition->removeIf([&](const KeyType& key, const auto& value) {
+                        if (!predicate(key, value)) {
+                            return false;
+                        }
+                        snapshot = snapshot.erase(key);
+                        return true;
+                    });
+                if (nRemovedFromPartition > 0) {
+                    atomic_store(&published,
+                                 std::make_shared<const ReadSnapshot>(std::move(snapshot)));
+                }
+                nRemoved += nRemovedFromPartition;
+            } else {
+                nRemoved += lockedPartition->removeIf(predicate);
+            }
         }
         return nRemoved;
     }
@@ -173,7 +253,15 @@ public:
      * Remove *all* cache entries.
      */
     void clear() {
-        _partitionedCache->clear();
+        if constexpr (kLockFreeLookups) {
+            auto all = _partitionedCache->lockAllPartitions();
+            all.clear();
+            for (auto& published : _readSnapshots) {
+                atomic_store(&published, std::make_shared<const ReadSnapshot>());
+            }
+        } else {
+            _partitionedCache->clear();
+        }
     }
 
     /**
@@ -185,7 +273,21 @@ public:
         size_t numEvicted = 0;
         for (size_t partitionId = 0; partitionId < _numPartitions; ++partitionId) {
             auto lockedPartition = _partitionedCache->lockOnePartitionById(partitionId);
-            numEvicted += lockedPartition->reset(cacheSize / _numPartitions);
+            if constexpr (kLockFreeLookups) {
+                auto& published = _readSnapshots[partitionId];
+                auto snapshot = *atomic_load(&published);
+                auto nEvictedFromPartition = lockedPartition->reset(
+                    cacheSize / _numPartitions, [&](const KeyType& evictedKey) {
+                        snapshot = snapshot.erase(evictedKey);
+                    });
+                if (nEvictedFromPartition > 0) {
+                    atomic_store(&published,
+                                 std::make_shared<const ReadSnapshot>(std::move(snapshot)));
+                }
+                numEvicted += nEvictedFromPartition;
+            } else {
+                numEvicted += lockedPartition->reset(cacheSize / _numPartitions);
+            }
         }
 
         return numEvicted;
@@ -237,6 +339,11 @@ public:
 private:
     std::size_t _numPartitions;
     std::unique_ptr<Partitioned<Lru, Partitioner>> _partitionedCache;
+
+    // One immutable snapshot per partition, only maintained when 'kLockFreeLookups' is true. The
+    // pointers are accessed with atomic_load/atomic_store so that readers never need the partition
+    // lock; they are only replaced while holding the lock of the corresponding partition.
+    std::vector<std::shared_ptr<const ReadSnapshot>> _readSnapshots;
 };
 
 }  // namespace mongo
@@ -0,0 +1,125 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <memory>
+
+#include "mongo/db/query/partitioned_cache.h"
+#include "mongo/util/processinfo.h"
+
+namespace mongo {
+namespace {
+
+using ValueType = std::shared_ptr<const size_t>;
+
+struct BudgetEstimator {
+    size_t operator()(const size_t&, const ValueType&) {
+        return 1;
+    }
+};
+
+struct KeyPartitioner {
+    std::size_t operator()(const size_t& key, const std::size_t nPartitions) const {
+        return key % nPartitions;
+    }
+};
+
+template <bool kLockFreeLookups>
+using Cache = PartitionedCache<size_t,
+                               ValueType,
+                               BudgetEstimator,
+                               KeyPartitioner,
+                               NoopInsertionEvictionListener,
+                               std::hash<size_t>,
+                               std::equal_to<size_t>,
+                               kLockFreeLookups>;
+
+constexpr size_t kNumEntries = 1024;
+constexpr size_t kNumPartitions = 16;
+
+template <bool kLockFreeLookups>
+Cache<kLockFreeLookups>& getCache() {
+    static auto cache = [] {
+        // Leave room for the entries put by the writer thread so it never causes evictions of the
+        // entries the readers look up.
+        auto cache = std::make_unique<Cache<kLockFreeLookups>>(4 * kNumEntries, kNumPartitions);
+        for (size_t key = 0; key < kNumEntries; ++key) {
+            cache->put(key, std::make_shared<const size_t>(key));
+        }
+        return cache;
+    }();
+    return *cache;
+}
+
+/**
+ * Mirrors how the plan cache read its entries before lock-free lookups: the value is copied out
+ * while holding the partition lock.
+ */
+ValueType lookUp(Cache<false>& cache, size_t key) {
+    auto [entry, partitionLock] = cache.getWithPartitionLock(key);
+    return *entry.getValue();
+}
+
+ValueType lookUp(Cache<true>& cache, size_t key) {
+    return cache.lookupUnlocked(key).getValue();
+}
+
+/**
+ * Every thread looks up keys spread over all partitions. When 'state.range(0)' is non-zero, the
+ * first thread instead keeps replacing entries to measure the interference of writers.
+ */
+template <bool kLockFreeLookups>
+void BM_PartitionedCacheLookup(benchmark::State& state) {
+    auto& cache = getCache<kLockFreeLookups>();
+    const bool isWriter = state.range(0) && state.thread_index == 0;
+
+    size_t key = state.thread_index * 7;
+    for (auto _ : state) {
+        key = (key + 1) % kNumEntries;
+        if (isWriter) {
+            cache.put(kNumEntries + key, std::make_shared<const size_t>(key));
+        } else {
+            benchmark::DoNotOptimize(lookUp(cache, key));
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK_TEMPLATE(BM_PartitionedCacheLookup, false)
+    ->Arg(0)
+    ->Arg(1)
+    ->ThreadRange(1, ProcessInfo::getNumAvailableCores());
+BENCHMARK_TEMPLATE(BM_PartitionedCacheLookup, true)
+    ->Arg(0)
+    ->Arg(1)
+    ->ThreadRange(1, ProcessInfo::getNumAvailableCores());
+
+}  // namespace
+}  // namespace mongo
@@ -354,7 +354,9 @@ class PlanCacheBase
           KeyBudgetEstimator,
           Partitioner,
           NoopInsertionEvictionListener,
-          KeyHasher> {
+          KeyHasher,
+          std::equal_to<KeyType>,
+          true /* kLockFreeLookups */> {
 private:
     PlanCacheBase(const PlanCacheBase&) = delete;
     PlanCacheBase& operator=(const PlanCacheBase&) = delete;
@@ -366,7 +368,9 @@ public:
                          KeyBudgetEstimator,
                          Partitioner,
                          NoopInsertionEvictionListener,
-                         KeyHasher>;
+                         KeyHasher,
+                         std::equal_to<KeyType>,
+                         true /* kLockFreeLookups */>;
     using Entry = PlanCacheEntryBase<CachedPlanType, DebugInfoType>;
 
     // We have three states for a cache entry to be in. Rather than just 'present' or 'not
@@ -514,6 +518,38 @@ public:
         return Status::OK();
     }
 
+    /**
+     * Adds an active entry for 'cachedPlan', which an earlier plan ranking decision picked after
+     * 'works' work units, unless 'key' already has an entry. This re-installs entries from a
+     * snapshot of the plan cache. Like any other active entry, the plan is replanned if it needs
+     * much more work than 'works'.
+     */
+    void setRestored(const KeyType& key,
+                     std::unique_ptr<CachedPlanType> cachedPlan,
+                     size_t works,
+                     Date_t now,
+                     const PlanCacheCallbacks<KeyType, CachedPlanType, DebugInfoType>* callbacks,
+                     PlanSecurityLevel securityLevel) {
+        invariant(cachedPlan);
+
+        auto oldEntryWithPartitionLock = this->getWithPartitionLock(key);
+        auto partitionLock = std::move(oldEntryWithPartitionLock.second);
+        if (oldEntryWithPartitionLock.first.isOK()) {
+            return;
+        }
+
+        std::shared_ptr<Entry> newEntry = Entry::create(std::move(cachedPlan),
+                                                        key.queryHash(),
+                                                        key.planCacheKeyHash(),
+                                                        callbacks->getPlanCacheCommandKeyHash(),
+                                                        now,
+                                                        true /* isActive */,
+                                                        securityLevel,
+                                                        works,
+                                                        callbacks->buildDebugInfo());
+        this->put(key, std::move(newEntry), partitionLock);
+    }
+
     /**
      * Adds a 'cachedPlan', resulting from a single QuerySolution, into the cache. A new cache entry
      * is always created and always active in this scenario.
@@ -573,24 +609,22 @@ public:
      * for the query (if there is one).
      */
     GetResult get(const KeyType& key) const {
-        std::shared_ptr<const Entry> entrySharedPtr;
-        CacheEntryState state;
-        {
-            auto [entry, partitionLock] = this->getWithPartitionLock(key);
-            if (!entry.isOK()) {
-                tassert(6007023,
-                        "Unexpected error code from LRU store",
-                        entry.getStatus() == ErrorCodes::NoSuchKey);
-                return {CacheEntryState::kNotPresent, nullptr};
-            }
-            entrySharedPtr = *entry.getValue();
-            state = entrySharedPtr->isActive ? CacheEntryState::kPresentActive
-                                             : CacheEntryState::kPresentInactive;
+        // Readers do not take the partition lock: the entry is read from the partition's published
+        // snapshot, so concurrent lookups of hot query shapes are not serialized.
+        auto entry = this->lookupUnlocked(key);
+        if (!entry.isOK()) {
+            tassert(6007023,
+                    "Unexpected error code from LRU store",
+                    entry.getStatus() == ErrorCodes::NoSuchKey);
+            return {CacheEntryState::kNotPresent, nullptr};
         }
-        // The purpose of cloning 'entry' (in CachedPlanHolder ctor) after we release the lock
-        // is to allow multiple threads to clone the same plan cache entry at once. 'entry'
-        // cannot be deleted by another thread even if the plan cache is being concurrently
-        // modified by other threads because we are holding a std::shared_ptr to this entry.
+        std::shared_ptr<const Entry> entrySharedPtr = std::move(entry.getValue());
+        CacheEntryState state = entrySharedPtr->isActive ? CacheEntryState::kPresentActive
+                                                         : CacheEntryState::kPresentInactive;
+        // The purpose of cloning 'entry' (in CachedPlanHolder ctor) outside of any lock is to
+        // allow multiple threads to clone the same plan cache entry at once. 'entry' cannot be
+        // deleted by another thread even if the plan cache is being concurrently modified by other
+        // threads because we are holding a std::shared_ptr to this entry.
         return {state,
                 std::make_unique<CachedPlanHolder<CachedPlanType, DebugInfoType>>(*entrySharedPtr)};
     }
@@ -616,11 +650,11 @@ public:
      * If there is no entry in the cache for the 'query', returns an error Status.
      */
     StatusWith<std::unique_ptr<Entry>> getEntry(const KeyType& key) const {
-        auto result = this->lookup(key);
+        auto result = this->lookupUnlocked(key);
         if (!result.isOK()) {
             return {result.getStatus()};
         }
-        return {result.getValue()->get()->clone()};
+        return {result.getValue()->clone()};
     }
 
     /**
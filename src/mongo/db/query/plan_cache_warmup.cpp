@@ -0,0 +1,133 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/db/query/plan_cache_warmup.h"
+
+#include <algorithm>
+#include <string>
+
+#include "mongo/util/decorable.h"
+
+namespace mongo::plan_cache_warmup {
+namespace {
+const auto getPlanCacheWarmupStore = ServiceContext::declareDecoration<PlanCacheWarmupStore>();
+
+void collectIndexNames(const PlanCacheIndexTree& tree, std::vector<std::string>* indexNames) {
+    if (tree.entry) {
+        indexNames->push_back(tree.entry->identifier.catalogName);
+    }
+    for (auto&& orPushdown : tree.orPushdowns) {
+        indexNames->push_back(orPushdown.indexEntryId.catalogName);
+    }
+    for (auto&& child : tree.children) {
+        collectIndexNames(*child, indexNames);
+    }
+}
+
+/**
+ * Returns the sorted names of the indexes that the plan described by 'cacheData' uses.
+ */
+std::vector<std::string> getIndexNames(const SolutionCacheData& cacheData) {
+    std::vector<std::string> indexNames;
+    if (cacheData.tree) {
+        collectIndexNames(*cacheData.tree, &indexNames);
+    }
+    std::sort(indexNames.begin(), indexNames.end());
+    indexNames.erase(std::unique(indexNames.begin(), indexNames.end()), indexNames.end());
+    return indexNames;
+}
+}  // namespace
+
+boost::optional<PlanCacheWarmupEntry> makeWarmupEntry(const UUID& collectionUuid,
+                                                      const PlanCacheEntry& entry) {
+    if (!entry.isActive || entry.isPinned()) {
+        return boost::none;
+    }
+
+    const auto& cacheData = *entry.cachedPlan;
+    return PlanCacheWarmupEntry{
+        PlanCacheWarmupEntryId{collectionUuid, static_cast<long long>(entry.planCacheKey)},
+        static_cast<int>(cacheData.solnType),
+        cacheData.wholeIXSolnDir,
+        getIndexNames(cacheData),
+        static_cast<long long>(*entry.works)};
+}
+
+std::vector<PlanCacheWarmupEntry> snapshotPlanCache(const UUID& collectionUuid,
+                                                    const PlanCache& planCache) {
+    std::vector<PlanCacheWarmupEntry> snapshot;
+    planCache.getMatchingStats(
+        {} /* cacheKeyFilterFunc */,
+        [&](const PlanCacheKey&, const PlanCacheEntry& entry) {
+            if (auto warmupEntry = makeWarmupEntry(collectionUuid, entry)) {
+                snapshot.push_back(std::move(*warmupEntry));
+            }
+            return BSONObj();
+        },
+        [](const BSONObj&) { return false; });
+    return snapshot;
+}
+
+bool matchesCacheData(const PlanCacheWarmupEntry& entry, const SolutionCacheData& cacheData) {
+    if (entry.getSolutionType() != static_cast<int>(cacheData.solnType)) {
+        return false;
+    }
+    if (cacheData.solnType == SolutionCacheData::WHOLE_IXSCAN_SOLN &&
+        entry.getWholeIXSolnDir() != cacheData.wholeIXSolnDir) {
+        return false;
+    }
+    return entry.getIndexNames() == getIndexNames(cacheData);
+}
+
+PlanCacheWarmupStore& PlanCacheWarmupStore::get(ServiceContext* serviceContext) {
+    return getPlanCacheWarmupStore(serviceContext);
+}
+
+void PlanCacheWarmupStore::add(PlanCacheWarmupEntry entry) {
+    stdx::lock_guard lk(_mutex);
+    Key key{entry.getId().getCollectionUuid(),
+            static_cast<uint32_t>(entry.getId().getPlanCacheKey())};
+    _entries.insert_or_assign(std::move(key), std::move(entry));
+    _size.store(_entries.size());
+}
+
+boost::optional<PlanCacheWarmupEntry> PlanCacheWarmupStore::take(const UUID& collectionUuid,
+                                                                 uint32_t planCacheKey) {
+    stdx::lock_guard lk(_mutex);
+    auto it = _entries.find(Key{collectionUuid, planCacheKey});
+    if (it == _entries.end()) {
+        return boost::none;
+    }
+    auto entry = std::move(it->second);
+    _entries.erase(it);
+    _size.store(_entries.size());
+    return entry;
+}
+
+}  // namespace mongo::plan_cache_warmup
@@ -0,0 +1,117 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include <boost/optional/optional.hpp>
+
+#include "mongo/db/query/classic_plan_cache.h"
+#include "mongo/db/query/plan_cache_warmup_gen.h"
+#include "mongo/db/service_context.h"
+#include "mongo/platform/atomic_word.h"
+#include "mongo/platform/mutex.h"
+#include "mongo/util/uuid.h"
+
+/**
+ * Snapshots of the classic plan cache which are used to warm it up after a restart.
+ *
+ * Active entries are periodically summarized as PlanCacheWarmupEntry documents: the query shape's
+ * plan cache key, the access path and indexes of the cached plan, and the works it took to pick
+ * it. After a restart, the documents are loaded into the PlanCacheWarmupStore. The first query
+ * with a matching plan cache key is planned as usual, and if one of its candidate solutions uses
+ * the same indexes as the snapshot, that solution is re-installed in the plan cache instead of
+ * multi-planning the query. The re-installed entry is subject to the usual replanning and
+ * invalidation rules of the plan cache.
+ */
+namespace mongo::plan_cache_warmup {
+
+/**
+ * Builds the snapshot of 'entry' from the plan cache of the collection 'collectionUuid'. Returns
+ * boost::none if the entry should not be restored, because it is inactive or pinned.
+ */
+boost::optional<PlanCacheWarmupEntry> makeWarmupEntry(const UUID& collectionUuid,
+                                                      const PlanCacheEntry& entry);
+
+/**
+ * Returns the snapshots of all the restorable entries in 'planCache'.
+ */
+std::vector<PlanCacheWarmupEntry> snapshotPlanCache(const UUID& collectionUuid,
+                                                    const PlanCache& planCache);
+
+/**
+ * Returns true if 'cacheData' describes a plan with the same access path and indexes as the plan
+ * that 'entry' was made from.
+ */
+bool matchesCacheData(const PlanCacheWarmupEntry& entry, const SolutionCacheData& cacheData);
+
+/**
+ * Holds the entries of the last snapshot until they are re-installed or found to be stale. Each
+ * entry is handed out at most once.
+ */
+class PlanCacheWarmupStore {
+public:
+    static PlanCacheWarmupStore& get(ServiceContext* serviceContext);
+
+    /**
+     * Adds 'entry' to the store, replacing any entry with the same id.
+     */
+    void add(PlanCacheWarmupEntry entry);
+
+    /**
+     * Removes and returns the entry for the plan cache key 'planCacheKey' of the collection
+     * 'collectionUuid', if there is one.
+     */
+    boost::optional<PlanCacheWarmupEntry> take(const UUID& collectionUuid, uint32_t planCacheKey);
+
+    /**
+     * Cheap check for the query planning path, which doesn't take the mutex.
+     */
+    bool empty() const {
+        return _size.load() == 0;
+    }
+
+    size_t size() const {
+        return _size.load();
+    }
+
+private:
+    using Key = std::pair<UUID, uint32_t>;
+
+    mutable Mutex _mutex = MONGO_MAKE_LATCH("PlanCacheWarmupStore::_mutex");
+    std::map<Key, PlanCacheWarmupEntry> _entries;
+    AtomicWord<size_t> _size{0};
+};
+
+}  // namespace mongo::plan_cache_warmup
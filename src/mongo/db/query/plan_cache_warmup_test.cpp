@@ -0,0 +1,179 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/db/query/plan_cache_warmup.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "mongo/bson/bsonmisc.h"
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/db/exec/plan_stats.h"
+#include "mongo/db/index/index_descriptor.h"
+#include "mongo/db/index_names.h"
+#include "mongo/db/query/index_entry.h"
+#include "mongo/db/query/plan_cache_debug_info.h"
+#include "mongo/db/query/plan_ranking_decision.h"
+#include "mongo/db/query/query_test_service_context.h"
+#include "mongo/idl/idl_parser.h"
+#include "mongo/unittest/framework.h"
+
+namespace mongo::plan_cache_warmup {
+namespace {
+
+IndexEntry makeIndexEntry(const BSONObj& keyPattern, const std::string& name) {
+    return {keyPattern,
+            IndexNames::nameToType(IndexNames::findPluginName(keyPattern)),
+            IndexDescriptor::kLatestIndexVersion,
+            false,
+            {},
+            {},
+            false,
+            false,
+            CoreIndexInfo::Identifier(name),
+            nullptr,
+            {},
+            nullptr,
+            nullptr};
+}
+
+/**
+ * Makes the cache data of a plan which intersects the indexes 'b_1' and 'a_1'.
+ */
+std::unique_ptr<SolutionCacheData> makeIndexTagsCacheData() {
+    auto tree = std::make_unique<PlanCacheIndexTree>();
+    for (auto&& [keyPattern, name] : std::vector<std::pair<BSONObj, std::string>>{
+             {BSON("b" << 1), "b_1"}, {BSON("a" << 1), "a_1"}}) {
+        auto child = std::make_unique<PlanCacheIndexTree>();
+        child->setIndexEntry(makeIndexEntry(keyPattern, name));
+        tree->children.push_back(std::move(child));
+    }
+
+    auto cacheData = std::make_unique<SolutionCacheData>();
+    cacheData->solnType = SolutionCacheData::USE_INDEX_TAGS_SOLN;
+    cacheData->tree = std::move(tree);
+    return cacheData;
+}
+
+std::unique_ptr<PlanCacheEntry> makeEntry(std::unique_ptr<SolutionCacheData> cacheData,
+                                          bool isActive,
+                                          size_t works) {
+    auto ranking = std::make_unique<plan_ranker::PlanRankingDecision>();
+    auto stats = std::make_unique<PlanStageStats>(CommonStats("COLLSCAN"), STAGE_COLLSCAN);
+    stats->common.works = works;
+    std::vector<std::unique_ptr<PlanStageStats>> candidateStats;
+    candidateStats.push_back(std::move(stats));
+    ranking->stats = plan_ranker::StatsDetails{std::move(candidateStats)};
+    ranking->scores = {0.0};
+    ranking->candidateOrder = {0};
+
+    return PlanCacheEntry::create(std::move(cacheData),
+                                  1 /* queryHash */,
+                                  42 /* planCacheKey */,
+                                  3 /* planCacheCommandKey */,
+                                  Date_t(),
+                                  isActive,
+                                  PlanSecurityLevel::kNotSensitive,
+                                  works,
+                                  plan_cache_debug_info::DebugInfo{
+                                      plan_cache_debug_info::CreatedFromQuery{}, std::move(ranking)});
+}
+
+TEST(PlanCacheWarmupTest, MakeWarmupEntryRecordsSortedIndexNamesAndWorks) {
+    const auto uuid = UUID::gen();
+    auto entry = makeEntry(makeIndexTagsCacheData(), true /* isActive */, 17 /* works */);
+
+    auto warmupEntry = makeWarmupEntry(uuid, *entry);
+    ASSERT_TRUE(warmupEntry);
+    ASSERT_EQ(uuid, warmupEntry->getId().getCollectionUuid());
+    ASSERT_EQ(42, warmupEntry->getId().getPlanCacheKey());
+    ASSERT_EQ(17, warmupEntry->getWorks());
+    ASSERT_EQ(static_cast<int>(SolutionCacheData::USE_INDEX_TAGS_SOLN),
+              warmupEntry->getSolutionType());
+    const auto& indexNames = warmupEntry->getIndexNames();
+    ASSERT_EQ(2U, indexNames.size());
+    ASSERT_EQ("a_1", indexNames[0]);
+    ASSERT_EQ("b_1", indexNames[1]);
+}
+
+TEST(PlanCacheWarmupTest, InactiveEntriesAreNotSnapshotted) {
+    auto entry = makeEntry(makeIndexTagsCacheData(), false /* isActive */, 17 /* works */);
+    ASSERT_FALSE(makeWarmupEntry(UUID::gen(), *entry));
+}
+
+TEST(PlanCacheWarmupTest, WarmupEntryRoundTripsThroughBSON) {
+    auto entry = makeEntry(makeIndexTagsCacheData(), true /* isActive */, 17 /* works */);
+    auto warmupEntry = makeWarmupEntry(UUID::gen(), *entry);
+    ASSERT_TRUE(warmupEntry);
+
+    auto parsed = PlanCacheWarmupEntry::parse(IDLParserContext("PlanCacheWarmupEntry"),
+                                              warmupEntry->toBSON());
+    ASSERT_BSONOBJ_EQ(warmupEntry->toBSON(), parsed.toBSON());
+    ASSERT_TRUE(matchesCacheData(parsed, *makeIndexTagsCacheData()));
+}
+
+TEST(PlanCacheWarmupTest, MatchesCacheDataRequiresSameIndexesAndAccessPath) {
+    auto entry = makeEntry(makeIndexTagsCacheData(), true /* isActive */, 17 /* works */);
+    auto warmupEntry = makeWarmupEntry(UUID::gen(), *entry);
+    ASSERT_TRUE(warmupEntry);
+
+    // A plan which uses only one of the indexes.
+    auto singleIndex = makeIndexTagsCacheData();
+    singleIndex->tree->children.pop_back();
+    ASSERT_FALSE(matchesCacheData(*warmupEntry, *singleIndex));
+
+    // A collection scan.
+    SolutionCacheData collScan;
+    collScan.solnType = SolutionCacheData::COLLSCAN_SOLN;
+    ASSERT_FALSE(matchesCacheData(*warmupEntry, collScan));
+}
+
+TEST(PlanCacheWarmupTest, StoreHandsOutEachEntryOnce) {
+    QueryTestServiceContext serviceContext;
+    auto& store = PlanCacheWarmupStore::get(serviceContext.getServiceContext());
+    ASSERT_TRUE(store.empty());
+
+    const auto uuid = UUID::gen();
+    auto entry = makeEntry(makeIndexTagsCacheData(), true /* isActive */, 17 /* works */);
+    store.add(*makeWarmupEntry(uuid, *entry));
+    ASSERT_EQ(1U, store.size());
+
+    ASSERT_FALSE(store.take(UUID::gen(), 42));
+    ASSERT_FALSE(store.take(uuid, 43));
+
+    auto taken = store.take(uuid, 42);
+    ASSERT_TRUE(taken);
+    ASSERT_EQ(17, taken->getWorks());
+    ASSERT_TRUE(store.empty());
+    ASSERT_FALSE(store.take(uuid, 42));
+}
+
+}  // namespace
+}  // namespace mongo::plan_cache_warmup
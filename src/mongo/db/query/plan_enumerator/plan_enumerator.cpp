@@ -53,6 +53,7 @@
 #include "mongo/db/query/indexability.h"
 #include "mongo/db/query/plan_enumerator/enumerator_memo.h"
 #include "mongo/db/query/plan_enumerator/memo_prune.h"
+#include "mongo/db/query/planner_ixselect.h"
 #include "mongo/db/query/query_planner_common.h"
 #include "mongo/logv2/log.h"
 #include "mongo/logv2/log_attr.h"
@@ -296,6 +297,7 @@ PlanEnumerator::PlanEnumerator(const PlanEnumeratorParams& params)
       _indices(params.indices),
       _ixisect(params.intersect),
       _enumerateOrChildrenLockstep(params.enumerateOrChildrenLockstep),
+      _skipScan(params.skipScan),
       _orLimit(params.maxSolutionsPerOr),
       _intersectLimit(params.maxIntersectPerAnd),
       _disableOrPushdown(params.disableOrPushdown),
@@ -604,6 +606,11 @@ bool PlanEnumerator::prepMemo(MatchExpression* node, const PrepMemoContext& cont
         enumerateOneIndex(
             idxToFirst, idxToNotFirst, subnodes, childContext.outsidePreds, andAssignment);
 
+        if (_skipScan) {
+            enumerateSkipScans(
+                idxToFirst, idxToNotFirst, childContext.outsidePreds, andAssignment);
+        }
+
         if (_ixisect) {
             enumerateAndIntersect(idxToFirst, idxToNotFirst, subnodes, andAssignment);
         }
@@ -1018,6 +1025,42 @@ void PlanEnumerator::enumerateOneIndex(
     }
 }
 
+void PlanEnumerator::enumerateSkipScans(
+    const IndexToPredMap& idxToFirst,
+    const IndexToPredMap& idxToNotFirst,
+    const stdx::unordered_map<MatchExpression*, OutsidePredRoute>& outsidePreds,
+    AndAssignment* andAssignment) {
+    for (auto&& [indexId, preds] : idxToNotFirst) {
+        // Indexes with a predicate over their leading field were handled by enumerateOneIndex().
+        if (idxToFirst.find(indexId) != idxToFirst.end()) {
+            continue;
+        }
+
+        const IndexEntry& thisIndex = (*_indices)[indexId];
+        if (!QueryPlannerIXSelect::canUseIndexForSkipScan(thisIndex)) {
+            continue;
+        }
+
+        OneIndexAssignment indexAssign;
+        indexAssign.index = indexId;
+        bool hasPredOverSecondField = false;
+        for (auto pred : preds) {
+            const size_t position = getPosition(thisIndex, pred);
+            if (position == 1 && outsidePreds.find(pred) == outsidePreds.end()) {
+                hasPredOverSecondField = true;
+            }
+            assignPredicate(outsidePreds, pred, position, &indexAssign);
+        }
+
+        // Without bounds on the second field, the scan would not skip anything and would be no
+        // better than a full index scan.
+        if (hasPredOverSecondField && !indexAssign.preds.empty()) {
+            andAssignment->choices.push_back(
+                AndEnumerableState::makeSingleton(std::move(indexAssign)));
+        }
+    }
+}
+
 void PlanEnumerator::enumerateAndIntersect(const IndexToPredMap& idxToFirst,
                                            const IndexToPredMap& idxToNotFirst,
                                            const vector<MemoID>& subnodes,
@@ -71,6 +71,10 @@ struct PlanEnumeratorParams {
     // same assignment on each branch?
     bool enumerateOrChildrenLockstep = false;
 
+    // Do we provide solutions that skip-scan a compound index whose leading field has no
+    // predicate, as long as there is a predicate over its second field?
+    bool skipScan = false;
+
     // Not owned here.
     MatchExpression* root;
 
@@ -420,6 +424,19 @@ private:
         const stdx::unordered_map<MatchExpression*, OutsidePredRoute>& outsidePreds,
         AndAssignment* andAssignment);
 
+    /**
+     * Generate one-index assignments for the compound indexes in 'idxToNotFirst' which have no
+     * predicate over their leading field but at least one over their second field. Such an index
+     * is scanned with [MinKey, MaxKey] bounds on the leading field, and the index scan seeks over
+     * the keys that fall outside of the bounds on the trailing fields. Outputs the assignments into
+     * 'andAssignment'.
+     */
+    void enumerateSkipScans(
+        const IndexToPredMap& idxToFirst,
+        const IndexToPredMap& idxToNotFirst,
+        const stdx::unordered_map<MatchExpression*, OutsidePredRoute>& outsidePreds,
+        AndAssignment* andAssignment);
+
     /**
      * Generate single-index assignments for queries which contain mandatory
      * predicates (TEXT and GEO_NEAR, which are required to use a compatible index).
@@ -518,6 +535,9 @@ private:
     // same assignment on each branch?
     bool _enumerateOrChildrenLockstep;
 
+    // Do we output assignments that skip-scan the leading field of a compound index?
+    bool _skipScan;
+
     // How many enumerations are we willing to produce from each OR?
     size_t _orLimit;
 
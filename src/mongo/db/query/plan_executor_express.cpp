@@ -28,18 +28,54 @@
  */
 
 #include "mongo/db/query/plan_executor_express.h"
+
+#include <algorithm>
+#include <limits>
+
 #include "mongo/db/exec/projection.h"
 #include "mongo/db/index/index_access_method.h"
+#include "mongo/db/matcher/expression_leaf.h"
 #include "mongo/db/query/collation/collation_index_key.h"
 #include "mongo/db/query/index_bounds_builder.h"
 #include "mongo/db/query/planner_ixselect.h"
 
 namespace mongo {
+namespace {
+/**
+ * Returns true if the projection of 'cq' is a simple inclusion of top-level fields which are all
+ * part of 'keyPattern', so that it can be computed from the index keys.
+ */
+bool isProjectionCoveredByKeyPattern(const CanonicalQuery& cq, const BSONObj& keyPattern) {
+    auto proj = cq.getProj();
+    if (!proj || !proj->isSimple() || !proj->isInclusionOnly()) {
+        return false;
+    }
+    for (auto&& field : proj->getRequiredFields()) {
+        if (field.find('.') != std::string::npos || !keyPattern.hasField(field)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Returns the values which the express executor looks up in the index for the match expression
+ * 'me' of an express eligible query.
+ */
+std::vector<BSONElement> getPointBounds(const MatchExpression* me) {
+    if (me->matchType() == MatchExpression::MATCH_IN) {
+        return static_cast<const InMatchExpression*>(me)->getEqualities();
+    }
+    return {static_cast<const ComparisonMatchExpressionBase*>(me)->getData()};
+}
+}  // namespace
+
 /*
  * Tries to find an index suitable for use in the express equality path. Excludes indexes which
- * cannot 1) satisfy the given query with exact bounds and 2) provably return at most one result
- * doc. If at least one suitable index remains, returns the name of the index with the fewest
- * fields. If not, returns boost::none.
+ * cannot 1) satisfy the given query with exact bounds and 2) provably return at most
+ * 'internalQueryExpressMaxResults' result docs. If at least one suitable index remains, returns the
+ * name of the index which can compute the projection from its keys or, if there are none or
+ * several of those, the one with the fewest fields. If not, returns boost::none.
  */
 boost::optional<std::string> getIndexForExpressEquality(const CanonicalQuery& cq,
                                                         const QueryPlannerParams& plannerParams) {
@@ -47,11 +83,17 @@ boost::optional<std::string> getIndexForExpressEquality(const CanonicalQuery& cq
 
     const bool needsShardFilter =
         plannerParams.mainCollectionInfo.options & QueryPlannerParams::INCLUDE_SHARD_FILTER;
-    const bool hasLimitOne = (findCommand.getLimit() && findCommand.getLimit().get() == 1);
-    const auto& data =
-        static_cast<ComparisonMatchExpressionBase*>(cq.getPrimaryMatchExpression())->getData();
-    const bool collationRelevant = data.type() == BSONType::String ||
-        data.type() == BSONType::Object || data.type() == BSONType::Array;
+    const bool hasSmallLimit = findCommand.getLimit() &&
+        findCommand.getLimit().get() <= internalQueryExpressMaxResults.load();
+    const auto points = getPointBounds(cq.getPrimaryMatchExpression());
+    const bool isPointQuery = points.size() == 1;
+    const bool collationRelevant =
+        std::any_of(points.begin(), points.end(), [](const BSONElement& elt) {
+            return elt.type() == BSONType::String || elt.type() == BSONType::Object ||
+                elt.type() == BSONType::Array;
+        });
+    const bool hasNull = std::any_of(
+        points.begin(), points.end(), [](const BSONElement& elt) { return elt.isNull(); });
 
     RelevantFieldIndexMap fields;
     QueryPlannerIXSelect::getFields(cq.getPrimaryMatchExpression(), &fields);
@@ -59,6 +101,7 @@ boost::optional<std::string> getIndexForExpressEquality(const CanonicalQuery& cq
         QueryPlannerIXSelect::findRelevantIndices(fields, plannerParams.mainCollectionInfo.indexes);
 
     int numFields = -1;
+    bool isCovered = false;
     const IndexEntry* bestEntry = nullptr;
     for (const auto& e : indexes) {
         if (
@@ -68,24 +111,32 @@ boost::optional<std::string> getIndexForExpressEquality(const CanonicalQuery& cq
             (collationRelevant &&
              !CollatorInterface::collatorsMatch(cq.getCollator(), e.collator)) ||
             // Sparse indexes cannot support comparisons to null.
-            (e.sparse && data.isNull()) ||
+            (e.sparse && hasNull) ||
             // Partial indexes may not be able to answer the query.
             (e.filterExpr &&
              !expression::isSubsetOf(cq.getPrimaryMatchExpression(), e.filterExpr))) {
             continue;
         }
         const auto currNFields = e.keyPattern.nFields();
+        const bool currIsCovered = isProjectionCoveredByKeyPattern(cq, e.keyPattern);
         if (
-            // We cannot guarantee that the result has at most one result doc.
-            ((!e.unique || currNFields != 1) && !hasLimitOne) ||
+            // We cannot guarantee that the result has at most one result doc per point, or that
+            // the limit keeps the number of results small.
+            ((!e.unique || currNFields != 1) && !hasSmallLimit) ||
             // TODO SERVER-87016: Support shard filtering for limitOne query with non-unique index.
             (!e.unique && needsShardFilter) ||
+            // A non-unique index may return many documents for each value of a $in list. The
+            // executor only supports this for point queries.
+            (!e.unique && !isPointQuery) ||
+            // This index is suitable but doesn't cover the projection, while the best so far does.
+            (bestEntry && isCovered && !currIsCovered) ||
             // This index is suitable but has more fields than the best so far.
-            (bestEntry && numFields <= currNFields)) {
+            (bestEntry && isCovered == currIsCovered && numFields <= currNFields)) {
             continue;
         }
         bestEntry = &e;
         numFields = currNFields;
+        isCovered = currIsCovered;
     }
     if (bestEntry) {
         return bestEntry->identifier.catalogName;
@@ -162,6 +213,20 @@ PlanExecutorExpress::PlanExecutorExpress(std::unique_ptr<CanonicalQuery> cq,
                 descriptor);
         _entry = descriptor->getEntry();
         _planExplainer.setKeyPattern(descriptor->keyPattern());
+
+        // Collation keys can't reproduce the strings of the documents, and the shard filter needs
+        // the shard key, which might not be part of the index keys.
+        const bool needsShardFilter = _shardFilterer && _shardFilterer->isCollectionSharded();
+        if (!needsShardFilter && !_entry->getCollator() &&
+            isProjectionCoveredByKeyPattern(*_cq, descriptor->keyPattern())) {
+            _isCovered = true;
+            _keyPattern = descriptor->keyPattern();
+            const auto& includedFields = _cq->getProj()->getRequiredFields();
+            for (auto&& keyField : _keyPattern) {
+                _includeKeyField.push_back(
+                    includedFields.count(keyField.fieldNameStringData().toString()) > 0);
+            }
+        }
     } else if (!_isClusteredOnId) {
         auto descriptor = _coll.getCollectionPtr()->getIndexCatalog()->findIdIndex(_opCtx);
         tassert(8623701,
@@ -175,69 +240,106 @@ PlanExecutorExpress::PlanExecutorExpress(std::unique_ptr<CanonicalQuery> cq,
 }
 
 PlanExecutor::ExecState PlanExecutorExpress::getNext(BSONObj* out, RecordId* dlOut) {
-    if (_done) {
+    if (!_resultsGathered) {
+        _resultsGathered = true;
+        _commonStats.works++;
+
+        const auto& findCommand = _cq->getFindCommandRequest();
+        size_t maxResults = findCommand.getLimit() ? findCommand.getLimit().get()
+                                                   : std::numeric_limits<size_t>::max();
+
+        // A multikey index may contain several keys matching the points for the same document.
+        _needsDedup = _entry && _entry->isMultikey(_opCtx, _coll.getCollectionPtr());
+
+        const auto points = getPointBounds(_cq->getPrimaryMatchExpression());
+        _results.reserve(std::min(points.size(), maxResults));
+        for (auto&& point : points) {
+            if (_results.size() >= maxResults) {
+                break;
+            }
+            gatherResultsForPoint(point, maxResults - _results.size());
+        }
+    }
+
+    if (_nextResult == _results.size()) {
+        _done = true;
         _commonStats.isEOF = true;
         return ExecState::IS_EOF;
     }
-    _done = true;
-    _commonStats.works++;
 
-    RecordId rid = getRIDForPoint(
-        static_cast<ComparisonMatchExpressionBase*>(_cq->getPrimaryMatchExpression())->getData());
+    auto& [doc, rid] = _results[_nextResult++];
+    *out = std::move(doc);
+    if (dlOut) {
+        *dlOut = std::move(rid);
+    }
+    _commonStats.advanced++;
 
-    // It's possible that we could do a covered index scan here, to avoid fetching the whole
-    // document. However, 1) the impact would be small, since we always expect to return at most
-    // one document, and 2) it would require a query like find({_id: <num>}, {_id: 1}), which we
-    // assume is an uncommon pattern.
+    // Report EOF right away after the last result so that the cursor can be closed without a
+    // getMore.
+    if (_nextResult == _results.size()) {
+        _done = true;
+        _commonStats.isEOF = true;
+    }
+    return ExecState::ADVANCED;
+}
+
+void PlanExecutorExpress::appendFetchedResult(RecordId rid) {
     const auto& collptr = _coll.getCollectionPtr();
     Snapshotted<BSONObj> snapDoc;
-    BSONObj doc;
-    bool found = false;
-    if (!rid.isNull() && collptr->findDoc(_opCtx, rid, &snapDoc)) {
-        doc = std::move(snapDoc.value());
-        if (dlOut) {
-            *dlOut = std::move(rid);
+    if (rid.isNull() || !collptr->findDoc(_opCtx, rid, &snapDoc)) {
+        return;
+    }
+    BSONObj doc = std::move(snapDoc.value());
+
+    if (_shardFilterer && _shardFilterer->isCollectionSharded() &&
+        _shardFilterer->documentBelongsToMe(doc) !=
+            ShardFilterer::DocumentBelongsResult::kBelongs) {
+        return;
+    }
+
+    invariant(!doc.isEmpty());
+    if (_cq->getProj()) {
+        // Only simple projections are currently supported.
+        auto proj = _cq->getProj();
+        auto projType = proj->type();
+        if (projType == projection_ast::ProjectType::kInclusion) {
+            doc = ProjectionStageSimple::transform(
+                doc, _cq->getProj()->getRequiredFields(), projType);
+        } else {
+            doc = ProjectionStageSimple::transform(
+                doc, _cq->getProj()->getExcludedPaths(), projType);
         }
-        found = true;
     }
+    _results.emplace_back(std::move(doc), std::move(rid));
+}
 
-    auto belongsToShard = [&](const BSONObj& doc) {
-        if (_shardFilterer && _shardFilterer->isCollectionSharded()) {
-            return _shardFilterer->documentBelongsToMe(doc) ==
-                ShardFilterer::DocumentBelongsResult::kBelongs;
+bool PlanExecutorExpress::appendCoveredResult(const BSONObj& keyData, const RecordId& rid) {
+    BSONObjBuilder bob;
+    BSONObjIterator keyPatternIt(_keyPattern);
+    size_t keyIndex = 0;
+    for (auto&& keyElt : keyData) {
+        auto keyField = keyPatternIt.next();
+        if (!_includeKeyField[keyIndex++]) {
+            continue;
         }
-        return true;
-    };
-
-    if (found && belongsToShard(doc)) {
-        invariant(!doc.isEmpty());
-        if (_cq->getProj()) {
-            // Only simple projections are currently supported.
-            auto proj = _cq->getProj();
-            auto projType = proj->type();
-            if (projType == projection_ast::ProjectType::kInclusion) {
-                doc = ProjectionStageSimple::transform(
-                    doc, _cq->getProj()->getRequiredFields(), projType);
-            } else {
-                doc = ProjectionStageSimple::transform(
-                    doc, _cq->getProj()->getExcludedPaths(), projType);
-            }
+        // A null key is also generated for a missing field, which the projection must not include.
+        if (keyElt.isNull() || keyElt.type() == BSONType::Undefined) {
+            return false;
         }
-        *out = std::move(doc);
-        _commonStats.advanced++;
-        return ExecState::ADVANCED;
-    };
-    _commonStats.isEOF = true;
-    return ExecState::IS_EOF;
+        bob.appendAs(keyElt, keyField.fieldNameStringData());
+    }
+    _results.emplace_back(bob.obj(), rid);
+    return true;
 }
 
-RecordId PlanExecutorExpress::getRIDForPoint(const BSONElement& val) const {
+void PlanExecutorExpress::gatherResultsForPoint(const BSONElement& val, size_t maxResults) {
     const auto& collptr = _coll.getCollectionPtr();
 
     // For a clustered collection, compute the RID directly. Otherwise, do an index access.
     if (_isClusteredOnId) {
-        return record_id_helpers::keyForObj(
-            IndexBoundsBuilder::objFromElement(val, collptr->getDefaultCollator()));
+        appendFetchedResult(record_id_helpers::keyForObj(
+            IndexBoundsBuilder::objFromElement(val, collptr->getDefaultCollator())));
+        return;
     }
 
     uassert(ErrorCodes::QueryPlanKilled,
@@ -249,8 +351,12 @@ RecordId PlanExecutorExpress::getRIDForPoint(const BSONElement& val) const {
     // TODO SERVER-87148: We may be able to use the findSingle() path with any single-field index,
     // or maybe any non-dotted single-field index.
     auto sortedAccessMethod = _entry->accessMethod()->asSortedData();
-    if (desc->isIdIndex() == 1) {
-        return sortedAccessMethod->findSingle(_opCtx, collptr, _entry, val.wrap());
+    if (desc->isIdIndex() == 1 && !_isCovered) {
+        auto rid = sortedAccessMethod->findSingle(_opCtx, collptr, _entry, val.wrap());
+        if (!_needsDedup || _seenRecordIds.insert(rid).second) {
+            appendFetchedResult(std::move(rid));
+        }
+        return;
     }
 
     // Build the start and end bounds for the equality by appending a fully-open bound for each
@@ -270,7 +376,18 @@ RecordId PlanExecutorExpress::getRIDForPoint(const BSONElement& val) const {
     auto startKey = startBob.obj();
     auto endKey = endBob.obj();
 
-    // Now seek to the first matching key in the index.
+    // A unique single-field index has at most one key per value, so there is no need to look
+    // past the first one.
+    if (desc->unique() && desc->getNumFields() == 1) {
+        maxResults = 1;
+    }
+
+    // Now seek to the first matching key in the index, and walk the keys until we have enough
+    // results. The keys of a multikey index hold array elements rather than the arrays, so they
+    // can't cover the projection.
+    const bool covered = _isCovered && !_needsDedup;
+    const auto keyInclusion = covered ? SortedDataInterface::Cursor::KeyInclusion::kInclude
+                                      : SortedDataInterface::Cursor::KeyInclusion::kExclude;
     auto indexCursor = sortedAccessMethod->newCursor(_opCtx, true /* forward */);
     indexCursor->setEndPosition(endKey, true /* endKeyInclusive */);
     auto keyStringForSeek = IndexEntryComparison::makeKeyStringFromBSONKeyForSeek(
@@ -279,12 +396,17 @@ RecordId PlanExecutorExpress::getRIDForPoint(const BSONElement& val) const {
         sortedAccessMethod->getSortedDataInterface()->getOrdering(),
         true /* forward */,
         true /* startKeyInclusive */);
-    auto kv =
-        indexCursor->seek(keyStringForSeek, SortedDataInterface::Cursor::KeyInclusion::kExclude);
-    if (!kv) {
-        return {};
+    const size_t targetSize = _results.size() + maxResults;
+    for (auto kv = indexCursor->seek(keyStringForSeek, keyInclusion);
+         kv && _results.size() < targetSize;
+         kv = _results.size() < targetSize ? indexCursor->next(keyInclusion) : boost::none) {
+        if (_needsDedup && !_seenRecordIds.insert(kv->loc).second) {
+            continue;
+        }
+        if (!covered || !appendCoveredResult(kv->key, kv->loc)) {
+            appendFetchedResult(std::move(kv->loc));
+        }
     }
-    return kv->loc;
 }
 
 }  // namespace mongo
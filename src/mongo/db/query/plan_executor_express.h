@@ -28,18 +28,24 @@
  */
 #pragma once
 
+#include <utility>
+#include <vector>
+
 #include "mongo/db/exec/shard_filterer_impl.h"
 #include "mongo/db/query/plan_executor.h"
 #include "mongo/db/query/plan_explainer_express.h"
 #include "mongo/db/query/query_planner_params.h"
+#include "mongo/db/record_id.h"
+#include "mongo/stdx/unordered_set.h"
 
 namespace mongo {
 
 /**
  * Tries to find an index suitable for use in the express equality path. Excludes indexes which
- * cannot 1) satisfy the given query with exact bounds and 2) provably return at most one result
- * doc. If at least one suitable index remains, returns the name of the index with the fewest
- * fields. If not, returns boost::none.
+ * cannot 1) satisfy the given query with exact bounds and 2) provably return at most
+ * 'internalQueryExpressMaxResults' result docs. If at least one suitable index remains, returns the
+ * name of the index which can compute the projection from its keys or, if there are none or
+ * several of those, the one with the fewest fields. If not, returns boost::none.
  */
 boost::optional<std::string> getIndexForExpressEquality(const CanonicalQuery& cq,
                                                         const QueryPlannerParams& plannerParams);
@@ -88,7 +94,13 @@ private:
  * the index and record store for the equivalent of an IXSCAN + FETCH plan.
  *
  * It supports single-field equalities which can use an index on that field and will return at most
- * one document, including point queries on _id.
+ * one document, including point queries on _id. It also supports $in lists on a unique
+ * single-field index and equalities on the leading field of a compound or non-unique index with a
+ * small limit. A simple inclusion projection on fields of the index is computed from the index
+ * keys, without fetching the documents.
+ *
+ * All the results are gathered by the first call to getNext(), so the executor holds no storage
+ * cursors across yields.
  */
 class PlanExecutorExpress final : public PlanExecutor {
 public:
@@ -244,13 +256,25 @@ private:
                         boost::optional<const std::string> indexName);
 
     /**
-     * Fast path for finding a RecordId: searches for the first RID where the first element of the
-     * index has value 'pointBound'. Uses the clustered order to answer the query, if
-     * '_isClusteredOnId'. Otherwise, uses the index identified by '_entry'.
+     * Appends to '_results' up to 'maxResults' documents where the first element of the index has
+     * value 'pointBound'. Uses the clustered order to answer the query, if '_isClusteredOnId'.
+     * Otherwise, uses the index identified by '_entry'.
      *
      * Will uassert() if the index indicated  by '_entry' has been dropped.
      */
-    RecordId getRIDForPoint(const BSONElement& pointBound) const;
+    void gatherResultsForPoint(const BSONElement& pointBound, size_t maxResults);
+
+    /**
+     * Fetches the document 'rid' and, if it exists and belongs to this shard, appends it to
+     * '_results' after applying the projection.
+     */
+    void appendFetchedResult(RecordId rid);
+
+    /**
+     * Appends the covered projection computed from the index key 'keyData' to '_results'. Returns
+     * false without appending anything if 'keyData' can't reproduce the projected fields.
+     */
+    bool appendCoveredResult(const BSONObj& keyData, const RecordId& rid);
 
 
     OperationContext* _opCtx;
@@ -265,6 +289,20 @@ private:
     boost::optional<const std::string> _indexName;
     const IndexCatalogEntry* _entry;
 
+    // Whether '_keyPattern' can compute the projection of '_cq', and which fields of the key
+    // pattern it includes.
+    bool _isCovered{false};
+    BSONObj _keyPattern;
+    std::vector<bool> _includeKeyField;
+
+    // The results gathered by the first call to getNext() and the position of the next one to
+    // return. '_seenRecordIds' deduplicates the results if the index is multikey.
+    bool _resultsGathered{false};
+    std::vector<std::pair<BSONObj, RecordId>> _results;
+    size_t _nextResult{0};
+    bool _needsDedup{false};
+    stdx::unordered_set<RecordId, RecordId::Hasher> _seenRecordIds;
+
     mongo::CommonStats _commonStats;
     const NamespaceString _nss;
     Status _killStatus = Status::OK();
@@ -234,6 +234,8 @@ void PlanExecutorImpl::detachFromOperationContext() {
     invariant(_currentState == kSaved);
     _opCtx = nullptr;
     _root->detachFromOperationContext();
+    // Don't hold on to the memory recycled between work() calls while the cursor is idle.
+    _workingSet->releaseFreeMembers();
     if (_expCtx) {
         _expCtx->opCtx = nullptr;
     }
@@ -554,7 +556,8 @@ UpdateResult PlanExecutorImpl::getUpdateResult() const {
                 stats.objInserted /* objInserted */,
                 static_cast<TimeseriesModifyStage*>(updateStage)->containsDotsAndDollarsField());
         }
-        case StageType::STAGE_UPDATE: {
+        case StageType::STAGE_UPDATE:
+        case StageType::STAGE_BATCHED_UPDATE: {
             const auto& stats = static_cast<const UpdateStats&>(*updateStage->getSpecificStats());
             return updateStatsToResult(
                 stats, static_cast<UpdateStage*>(updateStage)->containsDotsAndDollarsField());
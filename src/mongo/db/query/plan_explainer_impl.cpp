@@ -267,7 +267,7 @@ void statsToBSON(const PlanStageStats& stats,
     }
 
     // Stage-specific stats
-    if (STAGE_AND_HASH == stats.stageType) {
+    if (STAGE_AND_HASH == stats.stageType || STAGE_AND_BITMAP == stats.stageType) {
         AndHashStats* spec = static_cast<AndHashStats*>(stats.specific.get());
 
         if (verbosity >= ExplainOptions::Verbosity::kExecStats) {
@@ -333,6 +333,9 @@ void statsToBSON(const PlanStageStats& stats,
         indexBoundsBob.append("startKeyInclusive", spec->startKeyInclusive);
         indexBoundsBob.append("endKey", spec->endKey);
         indexBoundsBob.append("endKeyInclusive", spec->endKeyInclusive);
+        if (spec->numIntervals > 1) {
+            indexBoundsBob.appendNumber("numIntervals", static_cast<long long>(spec->numIntervals));
+        }
     } else if (STAGE_DELETE == stats.stageType || STAGE_BATCHED_DELETE == stats.stageType) {
         DeleteStats* spec = static_cast<DeleteStats*>(stats.specific.get());
 
@@ -366,6 +369,10 @@ void statsToBSON(const PlanStageStats& stats,
 
         if (verbosity >= ExplainOptions::Verbosity::kExecStats) {
             bob->appendNumber("keysExamined", static_cast<long long>(spec->keysExamined));
+            if (spec->shouldDedup) {
+                bob->appendNumber("dupsTested", static_cast<long long>(spec->dupsTested));
+                bob->appendNumber("dupsDropped", static_cast<long long>(spec->dupsDropped));
+            }
         }
     } else if (STAGE_FETCH == stats.stageType) {
         FetchStats* spec = static_cast<FetchStats*>(stats.specific.get());
@@ -543,7 +550,7 @@ void statsToBSON(const PlanStageStats& stats,
         if (verbosity >= ExplainOptions::Verbosity::kExecStats) {
             bob->appendNumber("nBucketsUnpacked", static_cast<long long>(spec->nBucketsUnpacked));
         }
-    } else if (STAGE_UPDATE == stats.stageType) {
+    } else if (STAGE_UPDATE == stats.stageType || STAGE_BATCHED_UPDATE == stats.stageType) {
         UpdateStats* spec = static_cast<UpdateStats*>(stats.specific.get());
 
         if (verbosity >= ExplainOptions::Verbosity::kExecStats) {
@@ -136,7 +136,8 @@ public:
         // allows us to examine fewer documents, the penalty given to ixisect
         // can be made up via the no fetch bonus.
         double noIxisectBonus = epsilon;
-        if (hasStage(STAGE_AND_HASH, stats) || hasStage(STAGE_AND_SORTED, stats)) {
+        if (hasStage(STAGE_AND_HASH, stats) || hasStage(STAGE_AND_BITMAP, stats) ||
+            hasStage(STAGE_AND_SORTED, stats)) {
             noIxisectBonus = 0;
         }
 
@@ -153,7 +154,8 @@ public:
                                     tieBreakers);
 
         if (internalQueryForceIntersectionPlans.load()) {
-            if (hasStage(STAGE_AND_HASH, stats) || hasStage(STAGE_AND_SORTED, stats)) {
+            if (hasStage(STAGE_AND_HASH, stats) || hasStage(STAGE_AND_BITMAP, stats) ||
+                hasStage(STAGE_AND_SORTED, stats)) {
                 // The boost should be >2.001 to make absolutely sure the ixisect plan will win due
                 // to the combination of 1) productivity, 2) eof bonus, and 3) no ixisect bonus.
                 score += 3;
@@ -978,9 +978,17 @@ void buildTextSubPlan(TextMatchNode* tn) {
         return;
     }
 
+    // A document matching a positive phrase contains every term of the phrase. Unless the text
+    // score, which sums the weights of all the terms, is needed, we can intersect the scans of just
+    // those terms and so only fetch the documents which can match.
+    const bool intersectPhraseTerms = internalQueryTextIntersectPhraseTerms.load() &&
+        !tn->wantTextScore && !query->getPhraseTermsForBounds().empty();
+    const auto& scanTerms =
+        intersectPhraseTerms ? query->getPhraseTermsForBounds() : query->getTermsForBounds();
+
     // If the query requires the "textScore" field or involves multiple search terms, a TEXT_OR or
     // OR stage is needed. Otherwise, we can use a single index scan directly.
-    const bool needOrStage = tn->wantTextScore || query->getTermsForBounds().size() > 1;
+    const bool needOrStage = tn->wantTextScore || scanTerms.size() > 1;
 
     tassert(5432208,
             "failed to obtain text index version",
@@ -990,8 +998,8 @@ void buildTextSubPlan(TextMatchNode* tn) {
 
     // Get all the index scans for each term in our query.
     std::vector<std::unique_ptr<QuerySolutionNode>> indexScanList;
-    indexScanList.reserve(query->getTermsForBounds().size());
-    for (const auto& term : query->getTermsForBounds()) {
+    indexScanList.reserve(scanTerms.size());
+    for (const auto& term : scanTerms) {
         auto ixscan = std::make_unique<IndexScanNode>(tn->index);
         ixscan->bounds.startKey = fts::FTSIndexFormat::getIndexKey(
             fts::MAX_WEIGHT, term, tn->indexPrefix, textIndexVersion);
@@ -1029,6 +1037,7 @@ void buildTextSubPlan(TextMatchNode* tn) {
     } else {
         // Because we don't need the text score, we can use a non-blocking OR stage to get the union
         // of the index scans or use the index scan directly if there is only one.
+        std::unique_ptr<MatchExpression> fetchFilter;
         auto textSearcher = [&]() -> std::unique_ptr<QuerySolutionNode> {
             if (indexScanList.size() == 1) {
                 tassert(5397400,
@@ -1036,6 +1045,14 @@ void buildTextSubPlan(TextMatchNode* tn) {
                         "should be false",
                         !needOrStage);
                 return std::move(indexScanList[0]);
+            } else if (intersectPhraseTerms) {
+                // The intersection does not apply a filter, so the FETCH does. TEXT_MATCH only
+                // needs the fetched documents, so the index keys of the children may be dropped.
+                auto andTextSearcher = std::make_unique<AndHashNode>();
+                andTextSearcher->addChildren(std::move(indexScanList));
+                andTextSearcher->useBitmaps = internalQueryPlannerEnableBitmapIntersection.load();
+                fetchFilter = std::move(tn->filter);
+                return andTextSearcher;
             } else {
                 auto orTextSearcher = std::make_unique<OrNode>();
                 orTextSearcher->filter = std::move(tn->filter);
@@ -1048,6 +1065,7 @@ void buildTextSubPlan(TextMatchNode* tn) {
         // add our own FETCH stage to satisfy the requirement of the TEXT_MATCH stage that its
         // WorkingSetMember inputs have fetched data.
         auto fetchNode = std::make_unique<FetchNode>();
+        fetchNode->filter = std::move(fetchFilter);
         fetchNode->children.push_back(std::move(textSearcher));
 
         tn->children.push_back(std::move(fetchNode));
@@ -1766,6 +1784,17 @@ std::unique_ptr<QuerySolutionNode> QueryPlannerAccess::buildIndexedAnd(
                     break;
                 }
             }
+
+            // Intersecting bitmaps of RecordIds only keeps the data of the last child. Nothing
+            // above an index intersection reads the index keys of the other children, since the
+            // FETCH added below evaluates the whole predicate on the documents. Children which
+            // already fetched the documents are cheaper to intersect by buffering them.
+            if (internalQueryPlannerEnableBitmapIntersection.load() && !inArrayOperator &&
+                std::none_of(andResult->children.begin(),
+                             andResult->children.end(),
+                             [](auto&& child) { return child->fetched(); })) {
+                static_cast<AndHashNode*>(andResult.get())->useBitmaps = true;
+            }
         } else {
             // We can't use sort-based intersection, and hash-based intersection is disabled.
             // Clean up the index scans and bail out by returning NULL.
@@ -60,6 +60,7 @@
 #include "mongo/db/index_names.h"
 #include "mongo/db/matcher/expression.h"
 #include "mongo/db/matcher/expression_geo.h"
+#include "mongo/db/operation_context.h"
 #include "mongo/db/pipeline/dependencies.h"
 #include "mongo/db/pipeline/field_path.h"
 #include "mongo/db/query/find_command.h"
@@ -69,10 +70,13 @@
 #include "mongo/db/query/optimizer/algebra/polyvalue.h"
 #include "mongo/db/query/projection.h"
 #include "mongo/db/query/query_knob_configuration.h"
+#include "mongo/db/query/query_knobs_gen.h"
 #include "mongo/db/query/query_planner_common.h"
 #include "mongo/db/query/query_request_helper.h"
 #include "mongo/db/query/query_solution.h"
 #include "mongo/db/query/stage_types.h"
+#include "mongo/db/repl/read_concern_args.h"
+#include "mongo/db/repl/read_concern_level.h"
 #include "mongo/logv2/log.h"
 #include "mongo/logv2/log_attr.h"
 #include "mongo/logv2/log_component.h"
@@ -798,6 +802,54 @@ void deprioritizeUnboundedCollectionScan(QuerySolutionNode* solnRoot,
     collScan->lowPriority = true;
 }
 
+/**
+ * Requests a parallel SBE scan on the given node if it is an unbounded forward collection scan over
+ * a regular collection whose output order does not matter. Parallel producers each read from their
+ * own storage snapshot, so reads that need a particular snapshot are excluded.
+ */
+void parallelizeUnboundedCollectionScan(QuerySolutionNode* solnRoot,
+                                        const CanonicalQuery& query,
+                                        const QueryPlannerParams& params) {
+    const int degree = internalQuerySlotBasedExecutionParallelCollScanDegree.load();
+    if (degree <= 1 || solnRoot->getType() != StageType::STAGE_COLLSCAN) {
+        return;
+    }
+
+    auto collScan = checked_cast<CollectionScanNode*>(solnRoot);
+    if (collScan->direction != 1 || collScan->tailable || collScan->isOplog ||
+        collScan->isClustered || collScan->minRecord || collScan->maxRecord ||
+        collScan->resumeAfterRecordId || collScan->requestResumeToken ||
+        collScan->shouldTrackLatestOplogTimestamp || collScan->lowPriority ||
+        collScan->nss.isChangeCollection()) {
+        return;
+    }
+
+    const FindCommandRequest& findCommand = query.getFindCommandRequest();
+    if (findCommand.getLimit() || findCommand.getHint()[query_request_helper::kNaturalSortField] ||
+        params.mainCollectionInfo.collscanDirection) {
+        // A limit is better served by a single cursor, and a $natural hint asks for RecordId order.
+        return;
+    }
+
+    auto opCtx = query.getOpCtx();
+    if (!opCtx || opCtx->inMultiDocumentTransaction()) {
+        return;
+    }
+    const auto& readConcernArgs = repl::ReadConcernArgs::get(opCtx);
+    const auto level = readConcernArgs.getLevel();
+    if ((level != repl::ReadConcernLevel::kLocalReadConcern &&
+         level != repl::ReadConcernLevel::kAvailableReadConcern) ||
+        readConcernArgs.getArgsAtClusterTime() || readConcernArgs.getArgsAfterClusterTime()) {
+        return;
+    }
+
+    collScan->parallelDegree = degree;
+
+    // The ExchangeConsumer at the root of a parallel scan cannot be cloned once it has been opened,
+    // so plans using it are never cached.
+    collScan->markNotEligibleForPlanCache();
+}
+
 bool isShardedCollScan(QuerySolutionNode* solnRoot) {
     return solnRoot->getType() == StageType::STAGE_SHARDING_FILTER &&
         solnRoot->children.size() == 1 &&
@@ -1335,6 +1387,7 @@ std::unique_ptr<QuerySolution> QueryPlannerAnalysis::analyzeDataAccess(
     const FindCommandRequest& findCommand = query.getFindCommandRequest();
 
     deprioritizeUnboundedCollectionScan(solnRoot.get(), findCommand);
+    parallelizeUnboundedCollectionScan(solnRoot.get(), query, params);
 
     // solnRoot finds all our results.  Let's see what transformations we must perform to the
     // data.
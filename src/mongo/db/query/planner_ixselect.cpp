@@ -321,7 +321,9 @@ std::vector<IndexEntry> QueryPlannerIXSelect::findIndexesByHint(
 
 // static
 std::vector<IndexEntry> QueryPlannerIXSelect::findRelevantIndices(
-    const RelevantFieldIndexMap& fields, const std::vector<IndexEntry>& allIndices) {
+    const RelevantFieldIndexMap& fields,
+    const std::vector<IndexEntry>& allIndices,
+    bool allowSkipScan) {
 
     std::vector<IndexEntry> out;
     for (auto&& index : allIndices) {
@@ -334,12 +336,20 @@ std::vector<IndexEntry> QueryPlannerIXSelect::findRelevantIndices(
         if (fields.contains(fieldName) &&
             (!index.sparse || fields.find(fieldName)->second.isSparse)) {
             out.push_back(index);
+        } else if (allowSkipScan && canUseIndexForSkipScan(index) &&
+                   fields.contains(it.next().fieldNameStringData().toString())) {
+            out.push_back(index);
         }
     }
 
     return out;
 }
 
+bool QueryPlannerIXSelect::canUseIndexForSkipScan(const IndexEntry& index) {
+    return index.type == IndexType::INDEX_BTREE && !index.multikey && !index.sparse &&
+        index.keyPattern.nFields() >= 2;
+}
+
 std::vector<IndexEntry> QueryPlannerIXSelect::expandIndexes(const RelevantFieldIndexMap& fields,
                                                             std::vector<IndexEntry> relevantIndices,
                                                             bool indexHinted) {
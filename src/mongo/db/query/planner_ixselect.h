@@ -110,10 +110,21 @@ public:
 
     /**
      * Finds all indices prefixed by fields we have predicates over.  Only these indices are
-     * useful in answering the query.
+     * useful in answering the query. If 'allowSkipScan' is true, compound indexes which can be
+     * skip-scanned (see canUseIndexForSkipScan()) are also relevant when there is a predicate over
+     * their second field.
      */
     static std::vector<IndexEntry> findRelevantIndices(const RelevantFieldIndexMap& fields,
-                                                       const std::vector<IndexEntry>& allIndices);
+                                                       const std::vector<IndexEntry>& allIndices,
+                                                       bool allowSkipScan = false);
+
+    /**
+     * Returns true if 'index' can be scanned with [MinKey, MaxKey] bounds on its leading field and
+     * tighter bounds on the following fields. Only non-multikey, non-sparse compound btree
+     * indexes qualify, so that such a scan returns every document matching the predicates over
+     * the trailing fields.
+     */
+    static bool canUseIndexForSkipScan(const IndexEntry& index);
 
     /**
      * Determine how useful all of our relevant 'indices' are to all predicates in the subtree
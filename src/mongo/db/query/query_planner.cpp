@@ -675,6 +675,9 @@ string optionString(size_t options) {
             case QueryPlannerParams::IGNORE_QUERY_SETTINGS:
                 ss << "IGNORE_QUERY_SETTINGS ";
                 break;
+            case QueryPlannerParams::INDEX_SKIP_SCAN:
+                ss << "INDEX_SKIP_SCAN ";
+                break;
             case QueryPlannerParams::DEFAULT:
                 MONGO_UNREACHABLE;
                 break;
@@ -1321,7 +1324,10 @@ StatusWith<std::vector<std::unique_ptr<QuerySolution>>> QueryPlanner::plan(
     std::vector<IndexEntry> relevantIndices;
 
     if (!hintedIndexEntry) {
-        relevantIndices = QueryPlannerIXSelect::findRelevantIndices(fields, fullIndexList);
+        relevantIndices = QueryPlannerIXSelect::findRelevantIndices(
+            fields,
+            fullIndexList,
+            params.mainCollectionInfo.options & QueryPlannerParams::INDEX_SKIP_SCAN);
     } else {
         relevantIndices = fullIndexList;
 
@@ -1499,6 +1505,8 @@ StatusWith<std::vector<std::unique_ptr<QuerySolution>>> QueryPlanner::plan(
         enumParams.indices = &relevantIndices;
         enumParams.enumerateOrChildrenLockstep =
             params.mainCollectionInfo.options & QueryPlannerParams::ENUMERATE_OR_CHILDREN_LOCKSTEP;
+        enumParams.skipScan =
+            params.mainCollectionInfo.options & QueryPlannerParams::INDEX_SKIP_SCAN;
         enumParams.projection = query.getProj();
         enumParams.sort = &query.getSortPattern();
         enumParams.shardKey = params.shardKey;
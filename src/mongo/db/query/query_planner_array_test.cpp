@@ -36,8 +36,10 @@
 #include "mongo/bson/bsonobjbuilder.h"
 #include "mongo/bson/json.h"
 #include "mongo/db/index/multikey_paths.h"
+#include "mongo/db/query/get_executor.h"
 #include "mongo/db/query/query_planner_params.h"
 #include "mongo/db/query/query_planner_test_fixture.h"
+#include "mongo/db/query/query_solution.h"
 #include "mongo/stdx/type_traits.h"
 #include "mongo/unittest/assert.h"
 #include "mongo/unittest/framework.h"
@@ -2596,4 +2598,57 @@ TEST_F(QueryPlannerTest, MustFetchBeforeDottedMultiKeyPathSort) {
         "  }"
         "}}");
 }
+
+/**
+ * Converts the first solution that can use a DISTINCT_SCAN over 'field' for the distinct command,
+ * and returns its DISTINCT_SCAN node, or nullptr if none can.
+ */
+const DistinctNode* turnFirstIxscanIntoDistinctIxscan(
+    std::vector<std::unique_ptr<QuerySolution>>& solns, const std::string& field) {
+    for (auto&& soln : solns) {
+        if (turnIxscanIntoDistinctIxscan(soln.get(), field, false /* strictDistinctOnly */)) {
+            ASSERT_EQ(STAGE_FETCH, soln->root()->getType());
+            auto node = soln->root()->children[0].get();
+            ASSERT_EQ(STAGE_DISTINCT_SCAN, node->getType());
+            return static_cast<const DistinctNode*>(node);
+        }
+    }
+    return nullptr;
+}
+
+TEST_F(QueryPlannerTest, DistinctScanOverMultikeyFieldDedupsFetchedDocuments) {
+    addIndex(BSON("a" << 1), true /* multikey */);
+    runQuery(fromjson("{a: {$gt: 0}}"));
+    assertSolutionExists("{fetch: {filter: null, node: {ixscan: {pattern: {a: 1}}}}}");
+
+    auto distinctNode = turnFirstIxscanIntoDistinctIxscan(solns, "a");
+    ASSERT(distinctNode);
+    ASSERT_TRUE(distinctNode->shouldDedup);
+}
+
+TEST_F(QueryPlannerTest, DistinctScanOverNonMultikeyFieldDoesNotDedup) {
+    addIndex(BSON("a" << 1 << "b" << 1), MultikeyPaths{{}, {0U}});
+    runQuery(fromjson("{a: {$gt: 0}}"));
+
+    auto distinctNode = turnFirstIxscanIntoDistinctIxscan(solns, "a");
+    ASSERT(distinctNode);
+    ASSERT_FALSE(distinctNode->shouldDedup);
+}
+
+TEST_F(QueryPlannerTest, StrictDistinctScanNotUsedOverMultikeyField) {
+    addIndex(BSON("a" << 1), true /* multikey */);
+    runQuery(fromjson("{a: {$gt: 0}}"));
+
+    for (auto&& soln : solns) {
+        ASSERT_FALSE(turnIxscanIntoDistinctIxscan(soln.get(), "a", true /* strictDistinctOnly */));
+    }
+}
+
+TEST_F(QueryPlannerTest, DistinctScanNotUsedOverMultikeyFieldWhenFetchHasFilter) {
+    addIndex(BSON("a" << 1), true /* multikey */);
+    runQuery(fromjson("{a: {$gt: 0}, b: 1}"));
+    assertSolutionExists("{fetch: {filter: {b: 1}, node: {ixscan: {pattern: {a: 1}}}}}");
+
+    ASSERT_FALSE(turnFirstIxscanIntoDistinctIxscan(solns, "a"));
+}
 }  // namespace
@@ -1665,5 +1665,73 @@ TEST_F(QueryPlannerTest, PlansForWholeIndexScanWithSortAreGenerated) {
         "{proj: {spec: {'b': 1, _id: 0}, node: {fetch: {node: {ixscan: {pattern: {a: 1}}}}}}}");
 }
 
+//
+// Index skip scan.
+//
+
+TEST_F(QueryPlannerTest, SkipScanNotUsedWhenDisabled) {
+    addIndex(BSON("tenant" << 1 << "ts" << 1));
+    runQuery(fromjson("{ts: 5}"));
+
+    assertNumSolutions(1U);
+    assertSolutionExists("{cscan: {dir: 1}}");
+}
+
+TEST_F(QueryPlannerTest, SkipScanUsesCompoundIndexWithUnconstrainedLeadingField) {
+    params.mainCollectionInfo.options |= QueryPlannerParams::INDEX_SKIP_SCAN;
+    addIndex(BSON("tenant" << 1 << "ts" << 1));
+    runQuery(fromjson("{ts: {$gte: 5, $lt: 10}}"));
+
+    assertNumSolutions(2U);
+    assertSolutionExists("{cscan: {dir: 1}}");
+    assertSolutionExists(
+        "{fetch: {filter: null, node: {ixscan: {filter: null, pattern: {tenant: 1, ts: 1}, "
+        "bounds: {tenant: [['MinKey','MaxKey',true,true]], ts: [[5,10,true,false]]}}}}}");
+}
+
+TEST_F(QueryPlannerTest, SkipScanAssignsPredicatesOverTrailingFields) {
+    params.mainCollectionInfo.options |= QueryPlannerParams::INDEX_SKIP_SCAN;
+    addIndex(BSON("tenant" << 1 << "ts" << 1 << "x" << 1));
+    runQuery(fromjson("{ts: 5, x: {$gt: 1}}"));
+
+    assertNumSolutions(2U);
+    assertSolutionExists("{cscan: {dir: 1}}");
+    assertSolutionExists(
+        "{fetch: {filter: null, node: {ixscan: {filter: null, pattern: {tenant: 1, ts: 1, x: 1}, "
+        "bounds: {tenant: [['MinKey','MaxKey',true,true]], ts: [[5,5,true,true]], "
+        "x: [[1,Infinity,false,true]]}}}}}");
+}
+
+TEST_F(QueryPlannerTest, SkipScanRequiresPredicateOverSecondField) {
+    params.mainCollectionInfo.options |= QueryPlannerParams::INDEX_SKIP_SCAN;
+    addIndex(BSON("tenant" << 1 << "ts" << 1 << "x" << 1));
+    runQuery(fromjson("{x: 5}"));
+
+    assertNumSolutions(1U);
+    assertSolutionExists("{cscan: {dir: 1}}");
+}
+
+TEST_F(QueryPlannerTest, SkipScanNotUsedForMultikeyOrSparseIndexes) {
+    params.mainCollectionInfo.options |= QueryPlannerParams::INDEX_SKIP_SCAN;
+    addIndex(BSON("tenant" << 1 << "ts" << 1), true /* multikey */);
+    addIndex(BSON("org" << 1 << "ts" << 1), false /* multikey */, true /* sparse */);
+    runQuery(fromjson("{ts: 5}"));
+
+    assertNumSolutions(1U);
+    assertSolutionExists("{cscan: {dir: 1}}");
+}
+
+TEST_F(QueryPlannerTest, SkipScanNotGeneratedWhenLeadingFieldIsConstrained) {
+    params.mainCollectionInfo.options |= QueryPlannerParams::INDEX_SKIP_SCAN;
+    addIndex(BSON("tenant" << 1 << "ts" << 1));
+    runQuery(fromjson("{tenant: 'a', ts: 5}"));
+
+    assertNumSolutions(2U);
+    assertSolutionExists("{cscan: {dir: 1}}");
+    assertSolutionExists(
+        "{fetch: {filter: null, node: {ixscan: {filter: null, pattern: {tenant: 1, ts: 1}, "
+        "bounds: {tenant: [['a','a',true,true]], ts: [[5,5,true,true]]}}}}}");
+}
+
 }  // namespace
 }  // namespace mongo
@@ -59,6 +59,7 @@
 #include "mongo/db/query/query_solution.h"
 #include "mongo/db/record_id.h"
 #include "mongo/db/service_context.h"
+#include "mongo/idl/server_parameter_test_util.h"
 #include "mongo/unittest/assert.h"
 #include "mongo/unittest/framework.h"
 
@@ -900,5 +901,39 @@ TEST_F(QueryPlannerTest, PreserveRecordIdOptionPrecludesSimpleSort) {
         "{sort: {pattern: {a: 1}, limit: 0, type: 'default', node: {cscan: {dir: 1}}}}");
 }
 
+TEST_F(QueryPlannerTest, ParallelCollScanDegreeSetOnUnboundedCollScan) {
+    RAIIServerParameterControllerForTest controller(
+        "internalQuerySlotBasedExecutionParallelCollScanDegree", 4);
+
+    runQueryAsCommand(fromjson("{find: 'testns', filter: {a: {$gt: 1}}}"));
+    assertHasOnlyCollscan();
+
+    const auto* csn = static_cast<const CollectionScanNode*>(solns.front()->root());
+    ASSERT_EQUALS(4, csn->parallelDegree);
+    ASSERT_FALSE(solns.front()->isEligibleForPlanCache());
+}
+
+TEST_F(QueryPlannerTest, ParallelCollScanNotUsedWhenOrderOrLimitMatters) {
+    RAIIServerParameterControllerForTest controller(
+        "internalQuerySlotBasedExecutionParallelCollScanDegree", 4);
+
+    runQueryAsCommand(fromjson("{find: 'testns', filter: {a: 1}, limit: 10}"));
+    assertHasOnlyCollscan();
+    ASSERT_EQUALS(1, static_cast<const CollectionScanNode*>(solns.front()->root())->parallelDegree);
+
+    runQueryAsCommand(fromjson("{find: 'testns', filter: {a: 1}, hint: {$natural: 1}}"));
+    assertHasOnlyCollscan();
+    ASSERT_EQUALS(1, static_cast<const CollectionScanNode*>(solns.front()->root())->parallelDegree);
+}
+
+TEST_F(QueryPlannerTest, ParallelCollScanDisabledByDefault) {
+    runQueryAsCommand(fromjson("{find: 'testns', filter: {a: {$gt: 1}}}"));
+    assertHasOnlyCollscan();
+
+    const auto* csn = static_cast<const CollectionScanNode*>(solns.front()->root());
+    ASSERT_EQUALS(1, csn->parallelDegree);
+    ASSERT_TRUE(solns.front()->isEligibleForPlanCache());
+}
+
 }  // namespace
 }  // namespace mongo
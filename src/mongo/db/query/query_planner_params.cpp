@@ -517,6 +517,10 @@ void QueryPlannerParams::fillOutMainCollectionPlannerParams(
         mainCollectionInfo.options |= QueryPlannerParams::INDEX_INTERSECTION;
     }
 
+    if (internalQueryPlannerEnableIndexSkipScan.load()) {
+        mainCollectionInfo.options |= QueryPlannerParams::INDEX_SKIP_SCAN;
+    }
+
     if (internalQueryEnumerationPreferLockstepOrEnumeration.load()) {
         mainCollectionInfo.options |= QueryPlannerParams::ENUMERATE_OR_CHILDREN_LOCKSTEP;
     }
@@ -626,8 +630,8 @@ std::vector<IndexEntry> getIndexEntriesForDistinct(
 
             // It is not necessary to do any checks about 'mayUnwindArrays' in this case, because:
             // 1) If there is no predicate on the distinct(), a wildcard indices may not be used.
-            // 2) distinct() _with_ a predicate may not be answered with a DISTINCT_SCAN on _any_
-            // multikey index.
+            // 2) distinct() _with_ a predicate may not be answered with a DISTINCT_SCAN on a
+            // wildcard index whose distinct field is multikey.
 
             // So, we will not distinct scan a wildcard index that's multikey on the distinct()
             // field, regardless of the value of 'mayUnwindArrays'.
@@ -182,6 +182,12 @@ struct QueryPlannerParams {
 
         // Set this to ignore the query settings imposed constraints over plan selection.
         IGNORE_QUERY_SETTINGS = 1 << 13,
+
+        // Set this to let the planner use a compound index whose leading field has no predicate,
+        // provided the query constrains the second field. The resulting index scan seeks from one
+        // leading field value to the next, which pays off when the leading field has few distinct
+        // values.
+        INDEX_SKIP_SCAN = 1 << 14,
     };
 
     /**
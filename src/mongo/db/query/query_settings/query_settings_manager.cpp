@@ -150,6 +150,33 @@ QuerySettingsManager::getQuerySettingsForQueryShapeHash(
     return boost::none;
 }
 
+bool QuerySettingsManager::hasQueryShapeConfigurations(
+    OperationContext* opCtx, const boost::optional<TenantId>& tenantId) const {
+    if (_numQueryShapeConfigurations.load() == 0) {
+        return false;
+    }
+
+    Lock::SharedLock readLock(opCtx, _mutex);
+    return getNumQueryShapeConfigurations_inlock(tenantId) > 0;
+}
+
+size_t QuerySettingsManager::getNumQueryShapeConfigurations_inlock(
+    const boost::optional<TenantId>& tenantId) const {
+    auto versionedQueryShapeConfigurationsIt =
+        _tenantIdToVersionedQueryShapeConfigurationsMap.find(tenantId);
+    if (versionedQueryShapeConfigurationsIt ==
+        _tenantIdToVersionedQueryShapeConfigurationsMap.end()) {
+        return 0;
+    }
+
+    size_t count = 0;
+    for (const auto& it :
+         versionedQueryShapeConfigurationsIt->second.nssToQueryShapeConfigurationsMap) {
+        count += it.second.size();
+    }
+    return count;
+}
+
 void QuerySettingsManager::setQueryShapeConfigurations(
     OperationContext* opCtx,
     std::vector<QueryShapeConfiguration>&& settingsArray,
@@ -159,10 +186,13 @@ void QuerySettingsManager::setQueryShapeConfigurations(
         computeTenantConfiguration(std::move(settingsArray), tenantId);
 
     Lock::ExclusiveLock writeLock(opCtx, _mutex);
+    const auto numRemoved = getNumQueryShapeConfigurations_inlock(tenantId);
     _tenantIdToVersionedQueryShapeConfigurationsMap.insert_or_assign(
         tenantId,
         VersionedQueryShapeConfigurations{std::move(nssToQueryShapeConfigurationsMap),
                                           parameterClusterTime});
+    _numQueryShapeConfigurations.store(_numQueryShapeConfigurations.load() - numRemoved +
+                                       getNumQueryShapeConfigurations_inlock(tenantId));
 }
 
 std::vector<QueryShapeConfiguration> QuerySettingsManager::getAllQueryShapeConfigurations(
@@ -199,6 +229,7 @@ void QuerySettingsManager::refreshQueryShapeConfigurations(OperationContext* opC
 void QuerySettingsManager::removeAllQueryShapeConfigurations(
     OperationContext* opCtx, const boost::optional<TenantId>& tenantId) {
     Lock::ExclusiveLock writeLock(opCtx, _mutex);
+    _numQueryShapeConfigurations.subtractAndFetch(getNumQueryShapeConfigurations_inlock(tenantId));
     _tenantIdToVersionedQueryShapeConfigurationsMap.erase(tenantId);
 }
 
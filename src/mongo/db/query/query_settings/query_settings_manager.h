@@ -50,6 +50,7 @@
 #include "mongo/db/server_parameter.h"
 #include "mongo/db/service_context.h"
 #include "mongo/db/tenant_id.h"
+#include "mongo/platform/atomic_word.h"
 #include "mongo/platform/mutex.h"
 #include "mongo/stdx/trusted_hasher.h"
 #include "mongo/stdx/unordered_map.h"
@@ -137,6 +138,14 @@ public:
                                       const query_shape::QueryShapeHash& queryShapeHash,
                                       const boost::optional<TenantId>& tenantId) const;
 
+    /**
+     * Returns true if any QueryShapeConfiguration is stored for the given tenant. Allows callers to
+     * skip the QueryShapeHash computation when no query settings could possibly apply. Does not
+     * acquire the mutex if no query settings are stored for any tenant.
+     */
+    bool hasQueryShapeConfigurations(OperationContext* opCtx,
+                                     const boost::optional<TenantId>& tenantId) const;
+
     /**
      * Returns all QueryShapeConfigurations stored for the given tenant.
      */
@@ -186,7 +195,13 @@ private:
     LogicalTime getClusterParameterTime_inlock(OperationContext* opCtx,
                                                const boost::optional<TenantId>& tenantId) const;
 
+    size_t getNumQueryShapeConfigurations_inlock(const boost::optional<TenantId>& tenantId) const;
+
     TenantIdMap<VersionedQueryShapeConfigurations> _tenantIdToVersionedQueryShapeConfigurationsMap;
+
+    // Total number of QueryShapeConfigurations stored across all tenants. Only modified while
+    // holding '_mutex' exclusively, but read without it on the query settings lookup path.
+    AtomicWord<size_t> _numQueryShapeConfigurations{0};
     Lock::ResourceMutex _mutex = Lock::ResourceMutex("QuerySettingsManager::mutex");
     std::function<void(OperationContext*)> _clusterParameterRefreshFn;
 };
@@ -267,4 +267,30 @@ TEST_F(QuerySettingsManagerTest, QuerySettingsLookup) {
                     std::make_pair(configs[1].getSettings(), configs[1].getRepresentativeQuery()));
 }
 
+TEST_F(QuerySettingsManagerTest, HasQueryShapeConfigurations) {
+    RAIIServerParameterControllerForTest multitenanyController("multitenancySupport", true);
+    TenantId tenantId(OID::fromTerm(1)), otherTenantId(OID::fromTerm(2));
+    auto configs = getExampleQueryShapeConfigurations(opCtx(), tenantId);
+
+    // No tenant has any query settings initially.
+    ASSERT_FALSE(manager().hasQueryShapeConfigurations(opCtx(), tenantId));
+    ASSERT_FALSE(manager().hasQueryShapeConfigurations(opCtx(), otherTenantId));
+
+    // Setting query settings for one tenant must not affect the other one.
+    manager().setQueryShapeConfigurations(
+        opCtx(), std::vector<QueryShapeConfiguration>(configs), LogicalTime(), tenantId);
+    ASSERT_TRUE(manager().hasQueryShapeConfigurations(opCtx(), tenantId));
+    ASSERT_FALSE(manager().hasQueryShapeConfigurations(opCtx(), otherTenantId));
+
+    // Replacing the query settings with an empty array leaves no settings for the tenant.
+    manager().setQueryShapeConfigurations(opCtx(), {}, LogicalTime(), tenantId);
+    ASSERT_FALSE(manager().hasQueryShapeConfigurations(opCtx(), tenantId));
+
+    manager().setQueryShapeConfigurations(
+        opCtx(), std::vector<QueryShapeConfiguration>(configs), LogicalTime(), otherTenantId);
+    ASSERT_TRUE(manager().hasQueryShapeConfigurations(opCtx(), otherTenantId));
+    manager().removeAllQueryShapeConfigurations(opCtx(), otherTenantId);
+    ASSERT_FALSE(manager().hasQueryShapeConfigurations(opCtx(), otherTenantId));
+}
+
 }  // namespace mongo::query_settings
@@ -366,7 +366,13 @@ QuerySettings lookupQuerySettingsForFind(const boost::intrusive_ptr<ExpressionCo
         return query_settings::QuerySettings();
     }
 
+    // Skip the QueryShapeHash computation if there are no query settings to match against.
     auto* opCtx = expCtx->opCtx;
+    auto& manager = QuerySettingsManager::get(opCtx);
+    if (!manager.hasQueryShapeConfigurations(opCtx, nss.dbName().tenantId())) {
+        return query_settings::QuerySettings();
+    }
+
     const auto& serializationContext = parsedFind.findCommandRequest->getSerializationContext();
     auto curOp = CurOp::get(opCtx);
     auto& opDebug = curOp->debug();
@@ -388,7 +394,6 @@ QuerySettings lookupQuerySettingsForFind(const boost::intrusive_ptr<ExpressionCo
     setQueryShapeHash(opCtx, hash);
 
     // Return the found query settings or an empty one.
-    auto& manager = QuerySettingsManager::get(opCtx);
     auto settings = manager.getQuerySettingsForQueryShapeHash(opCtx, *hash, nss.dbName().tenantId())
                         .get_value_or({})
                         .first;
@@ -428,7 +433,13 @@ QuerySettings lookupQuerySettingsForAgg(
         return query_settings::QuerySettings();
     }
 
+    // Skip the QueryShapeHash computation if there are no query settings to match against.
     auto* opCtx = expCtx->opCtx;
+    auto& manager = QuerySettingsManager::get(opCtx);
+    if (!manager.hasQueryShapeConfigurations(opCtx, nss.dbName().tenantId())) {
+        return query_settings::QuerySettings();
+    }
+
     const auto& serializationContext = aggregateCommandRequest.getSerializationContext();
     auto curOp = CurOp::get(opCtx);
     auto& opDebug = curOp->debug();
@@ -450,7 +461,6 @@ QuerySettings lookupQuerySettingsForAgg(
     setQueryShapeHash(opCtx, hash);
 
     // Return the found query settings or an empty one.
-    auto& manager = QuerySettingsManager::get(opCtx);
     auto settings = manager.getQuerySettingsForQueryShapeHash(opCtx, *hash, nss.dbName().tenantId())
                         .get_value_or({})
                         .first;
@@ -482,7 +492,13 @@ QuerySettings lookupQuerySettingsForDistinct(const boost::intrusive_ptr<Expressi
         return query_settings::QuerySettings();
     }
 
+    // Skip the QueryShapeHash computation if there are no query settings to match against.
     auto* opCtx = expCtx->opCtx;
+    auto& manager = QuerySettingsManager::get(opCtx);
+    if (!manager.hasQueryShapeConfigurations(opCtx, nss.dbName().tenantId())) {
+        return query_settings::QuerySettings();
+    }
+
     const auto& serializationContext =
         parsedDistinct.distinctCommandRequest->getSerializationContext();
     auto curOp = CurOp::get(opCtx);
@@ -506,7 +522,6 @@ QuerySettings lookupQuerySettingsForDistinct(const boost::intrusive_ptr<Expressi
     setQueryShapeHash(opCtx, hash);
 
     // Return the found query settings or an empty one.
-    auto& manager = QuerySettingsManager::get(opCtx);
     auto settings = manager.getQuerySettingsForQueryShapeHash(opCtx, *hash, nss.dbName().tenantId())
                         .get_value_or({})
                         .first;
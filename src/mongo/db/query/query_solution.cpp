@@ -409,6 +409,10 @@ void CollectionScanNode::appendToString(str::stream* ss, int indent) const {
         addIndent(ss, indent + 1);
         *ss << "filter = " << filter->debugString();
     }
+    if (parallelDegree > 1) {
+        addIndent(ss, indent + 1);
+        *ss << "parallelDegree = " << parallelDegree << '\n';
+    }
     addCommon(ss, indent);
 }
 
@@ -430,6 +434,10 @@ std::unique_ptr<QuerySolutionNode> CollectionScanNode::clone() const {
     copy->clusteredIndex = this->clusteredIndex;
     copy->hasCompatibleCollation = this->hasCompatibleCollation;
     copy->lowPriority = this->lowPriority;
+    copy->parallelDegree = this->parallelDegree;
+    if (!this->eligibleForPlanCache) {
+        copy->markNotEligibleForPlanCache();
+    }
     return copy;
 }
 
@@ -481,6 +489,10 @@ void AndHashNode::appendToString(str::stream* ss, int indent) const {
         addIndent(ss, indent + 1);
         *ss << " filter = " << filter->debugString() << '\n';
     }
+    if (useBitmaps) {
+        addIndent(ss, indent + 1);
+        *ss << "useBitmaps = 1\n";
+    }
     addCommon(ss, indent);
     for (size_t i = 0; i < children.size(); ++i) {
         addIndent(ss, indent + 1);
@@ -501,6 +513,11 @@ bool AndHashNode::fetched() const {
 }
 
 FieldAvailability AndHashNode::getFieldAvailability(const string& field) const {
+    // When intersecting bitmaps of RecordIds only the data from the last child is kept.
+    if (useBitmaps) {
+        return children.back()->getFieldAvailability(field);
+    }
+
     // A field can be provided by any of the children.
     auto result = FieldAvailability::kNotProvided;
     for (size_t i = 0; i < children.size(); ++i) {
@@ -512,6 +529,7 @@ FieldAvailability AndHashNode::getFieldAvailability(const string& field) const {
 std::unique_ptr<QuerySolutionNode> AndHashNode::clone() const {
     auto copy = std::make_unique<AndHashNode>();
     cloneBaseData(copy.get());
+    copy->useBitmaps = this->useBitmaps;
     return copy;
 }
 
@@ -1684,6 +1702,7 @@ std::unique_ptr<QuerySolutionNode> DistinctNode::clone() const {
     copy->bounds = this->bounds;
     copy->queryCollator = this->queryCollator;
     copy->fieldNo = this->fieldNo;
+    copy->shouldDedup = this->shouldDedup;
 
     return copy;
 }
@@ -1711,6 +1730,12 @@ void CountScanNode::appendToString(str::stream* ss, int indent) const {
     *ss << "startKey = " << startKey << '\n';
     addIndent(ss, indent + 1);
     *ss << "endKey = " << endKey << '\n';
+    for (const auto& interval : additionalIntervals) {
+        addIndent(ss, indent + 1);
+        *ss << "startKey = " << interval.startKey << '\n';
+        addIndent(ss, indent + 1);
+        *ss << "endKey = " << interval.endKey << '\n';
+    }
 }
 
 std::unique_ptr<QuerySolutionNode> CountScanNode::clone() const {
@@ -1721,6 +1746,7 @@ std::unique_ptr<QuerySolutionNode> CountScanNode::clone() const {
     copy->startKeyInclusive = this->startKeyInclusive;
     copy->endKey = this->endKey;
     copy->endKeyInclusive = this->endKeyInclusive;
+    copy->additionalIntervals = this->additionalIntervals;
 
     return copy;
 }
@@ -649,6 +649,10 @@ struct CollectionScanNode : public QuerySolutionNodeWithSortSet {
 
     // Whether the collection scan should have low storage admission priority.
     bool lowPriority = false;
+
+    // The number of threads that SBE may split this scan across by RecordId range. Only values
+    // greater than 1 request a parallel scan, which does not preserve RecordId order.
+    int parallelDegree = 1;
 };
 
 struct ColumnIndexScanNode : public QuerySolutionNode {
@@ -804,6 +808,10 @@ struct AndHashNode : public QuerySolutionNode {
     }
 
     std::unique_ptr<QuerySolutionNode> clone() const final;
+
+    // If true, the intersection is computed over bitmaps of RecordIds and only the data of the last
+    // child is output. Only valid when no child provides fetched data.
+    bool useBitmaps = false;
 };
 
 struct AndSortedNode : public QuerySolutionNodeWithSortSet {
@@ -1590,6 +1598,10 @@ struct DistinctNode : public QuerySolutionNodeWithSortSet {
     // We are distinct-ing over the 'fieldNo'-th field of 'index.keyPattern'.
     int fieldNo{0};
     int direction{1};
+
+    // Set when the distinct field may be multikey and the documents are fetched, so that the scan
+    // returns each document at most once.
+    bool shouldDedup = false;
 };
 
 /**
@@ -1625,6 +1637,23 @@ struct CountScanNode : public QuerySolutionNodeWithSortSet {
     BSONObj endKey;
     bool endKeyInclusive;
 
+    /**
+     * A range of keys to count in addition to [startKey, endKey].
+     */
+    struct Interval {
+        BSONObj startKey;
+        bool startKeyInclusive;
+
+        BSONObj endKey;
+        bool endKeyInclusive;
+    };
+
+    /**
+     * Disjoint ranges of keys which follow [startKey, endKey] in increasing index order, e.g. the
+     * remaining points of an $in. Only supported by the classic engine.
+     */
+    std::vector<Interval> additionalIntervals;
+
     /**
      * A vector of Interval Evaluation Trees (IETs) with the same ordering as the index key pattern.
      */
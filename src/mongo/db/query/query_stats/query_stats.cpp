@@ -247,6 +247,10 @@ void updateStatistics(const QueryStatsStore::Partition& proofOfLock,
     toUpdate.fromMultiPlanner.aggregate(snapshot.fromMultiPlanner);
     toUpdate.fromPlanCache.aggregate(snapshot.fromPlanCache);
 
+    toUpdate.cpuNanos.aggregate(snapshot.cpuNanos);
+    toUpdate.lockWaitMicros.aggregate(snapshot.lockWaitMicros);
+    toUpdate.ticketWaitMicros.aggregate(snapshot.ticketWaitMicros);
+
     toUpdate.addSupplementalStats(std::move(supplementalStatsEntry));
 }
 
@@ -376,6 +380,9 @@ QueryStatsSnapshot captureMetrics(const OperationContext* opCtx,
         metrics.usedDisk,
         metrics.fromMultiPlanner,
         metrics.fromPlanCache.value_or(false),
+        static_cast<uint64_t>(durationCount<Nanoseconds>(metrics.cpuTime.value_or(Nanoseconds{0}))),
+        microsecondsToUint64(metrics.lockWaitTime),
+        microsecondsToUint64(metrics.ticketWaitTime),
     };
 
     return snapshot;
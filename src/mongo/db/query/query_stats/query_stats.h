@@ -222,6 +222,10 @@ struct QueryStatsSnapshot {
     bool usedDisk;
     bool fromMultiPlanner;
     bool fromPlanCache;
+
+    uint64_t cpuNanos;
+    uint64_t lockWaitMicros;
+    uint64_t ticketWaitMicros;
 };
 
 /**
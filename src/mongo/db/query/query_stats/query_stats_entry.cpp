@@ -51,6 +51,9 @@ BSONObj QueryStatsEntry::toBSON(bool includeDiskUsageMetrics) const {
         usedDisk.appendTo(builder, "usedDisk");
         fromMultiPlanner.appendTo(builder, "fromMultiPlanner");
         fromPlanCache.appendTo(builder, "fromPlanCache");
+        cpuNanos.appendTo(builder, "cpuNanos");
+        lockWaitMicros.appendTo(builder, "lockWaitMicros");
+        ticketWaitMicros.appendTo(builder, "ticketWaitMicros");
     }
 
     builder.append("firstSeenTimestamp", firstSeenTimestamp);
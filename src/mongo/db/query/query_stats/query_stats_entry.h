@@ -122,6 +122,22 @@ struct QueryStatsEntry {
      */
     AggregatedBool fromPlanCache;
 
+    /**
+     * Aggregates the time spent on the CPU, in nanoseconds, including getMore requests. This is
+     * zero on platforms without per-thread CPU timers.
+     */
+    AggregatedMetric<uint64_t> cpuNanos;
+
+    /**
+     * Aggregates the time spent waiting to acquire locks including getMore requests.
+     */
+    AggregatedMetric<uint64_t> lockWaitMicros;
+
+    /**
+     * Aggregates the time spent queued for execution tickets including getMore requests.
+     */
+    AggregatedMetric<uint64_t> ticketWaitMicros;
+
     /**
      * The Key that can generate the query stats key for this request.
      */
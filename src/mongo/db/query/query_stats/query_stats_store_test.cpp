@@ -1543,6 +1543,9 @@ TEST_F(QueryStatsStoreTest, BasicDiskUsage) {
                               .append("usedDisk", boolMetricBson(0, 0))
                               .append("fromMultiPlanner", boolMetricBson(0, 0))
                               .append("fromPlanCache", boolMetricBson(0, 0))
+                              .append("cpuNanos", emptyIntMetric)
+                              .append("lockWaitMicros", emptyIntMetric)
+                              .append("ticketWaitMicros", emptyIntMetric)
                               .append("firstSeenTimestamp", qse.firstSeenTimestamp)
                               .append("latestSeenTimestamp", Date_t())
                               .obj());
@@ -1574,6 +1577,9 @@ TEST_F(QueryStatsStoreTest, BasicDiskUsage) {
                               .append("usedDisk", boolMetricBson(1, 0))
                               .append("fromMultiPlanner", boolMetricBson(0, 0))
                               .append("fromPlanCache", boolMetricBson(0, 0))
+                              .append("cpuNanos", emptyIntMetric)
+                              .append("lockWaitMicros", emptyIntMetric)
+                              .append("ticketWaitMicros", emptyIntMetric)
                               .append("firstSeenTimestamp", qse2.firstSeenTimestamp)
                               .append("latestSeenTimestamp", Date_t())
                               .obj());
@@ -29,8 +29,11 @@
 
 #pragma once
 
+#include <algorithm>
+
 #include "mongo/db/catalog/clustered_collection_util.h"
 #include "mongo/db/catalog/collection.h"
+#include "mongo/db/matcher/expression_leaf.h"
 #include "mongo/db/query/canonical_query.h"
 #include "mongo/db/query/collation/collator_interface.h"
 #include "mongo/db/query/indexability.h"
@@ -66,30 +69,53 @@ inline bool isIdHackEligibleQuery(const CollectionPtr& collection,
         CollatorInterface::collatorsMatch(queryCollator, collection->getDefaultCollator());
 }
 
+/**
+ * Returns 'true' if 'me' is an equality or a $in list which the express executor can answer with
+ * point lookups into an index. Each value must generate exact bounds, and a $in list can't contain
+ * regexes or more values than the express executor may return.
+ */
+inline bool isExpressEligibleMatchExpression(const MatchExpression* me) {
+    if (me->matchType() == MatchExpression::EQ) {
+        return Indexability::isExactBoundsGenerating(
+            static_cast<const ComparisonMatchExpressionBase*>(me)->getData());
+    }
+    if (me->matchType() != MatchExpression::MATCH_IN) {
+        return false;
+    }
+
+    const auto* in = static_cast<const InMatchExpression*>(me);
+    const auto& equalities = in->getEqualities();
+    if (in->hasRegex() || equalities.empty() ||
+        equalities.size() > static_cast<size_t>(internalQueryExpressMaxResults.load())) {
+        return false;
+    }
+    return std::all_of(equalities.begin(), equalities.end(), [](const BSONElement& elt) {
+        return Indexability::isExactBoundsGenerating(elt);
+    });
+}
+
 /**
  * Returns 'true' if 'query' on the given 'collection' can be answered using a special IXSCAN +
- * FETCH plan. Among other restrictions, the query must be a single-field equality generating exact
- * bounds.
+ * FETCH plan. Among other restrictions, the query must be a single-field equality or $in list
+ * generating exact bounds.
  */
 inline bool isEqualityExpressEligibleQuery(const CollectionPtr& collection,
                                            const CanonicalQuery& cq) {
     const auto& findCommand = cq.getFindCommandRequest();
-    auto me = cq.getPrimaryMatchExpression();
 
     if (internalQueryDisableSingleFieldExpressExecutor.load()) {
         return false;
     }
 
     return
-        // Properties of the find command.
+        // Properties of the find command. Only simple projections get this far, and the express
+        // executor either computes them from the index keys or applies them to the fetched
+        // documents.
         !findCommand.getShowRecordId() && findCommand.getHint().isEmpty() &&
         findCommand.getMin().isEmpty() && findCommand.getMax().isEmpty() &&
-        findCommand.getProjection().isEmpty() && findCommand.getSort().isEmpty() &&
-        !findCommand.getSkip() && !findCommand.getTailable() &&
+        findCommand.getSort().isEmpty() && !findCommand.getSkip() && !findCommand.getTailable() &&
         // Properties of the query's match expression.
-        me->matchType() == MatchExpression::EQ &&
-        Indexability::isExactBoundsGenerating(
-            static_cast<ComparisonMatchExpressionBase*>(me)->getData());
+        isExpressEligibleMatchExpression(cq.getPrimaryMatchExpression());
 }
 
 /**
@@ -172,6 +172,9 @@ MultiPlanner::PlanQ MultiPlanner::preparePlans(
 }
 
 void MultiPlanner::trialPlans(PlanQ planq) {
+    const bool endTrialOnFirstCompletedPlan =
+        internalQueryPlanEvaluationEndTrialOnFirstCompletedPlanSbe.load();
+
     while (!planq.empty()) {
         plan_ranker::CandidatePlan* bestCandidate = planq.top();
         planq.pop();
@@ -179,6 +182,15 @@ void MultiPlanner::trialPlans(PlanQ planq) {
             _maxNumReads);
         if (fetchOneDocument(bestCandidate)) {
             planq.push(bestCandidate);
+        } else if (endTrialOnFirstCompletedPlan && bestCandidate->status.isOK() &&
+                   !bestCandidate->exitedEarly) {
+            // The candidate hit EOF or produced enough results without running out of its
+            // budget. Stop the trial for the remaining candidates, which will be ranked on the
+            // work they have done so far.
+            while (!planq.empty()) {
+                planq.top()->root->detachFromTrialRunTracker();
+                planq.pop();
+            }
         }
     }
 }
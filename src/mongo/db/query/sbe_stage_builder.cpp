@@ -78,6 +78,7 @@
 #include "mongo/db/exec/sbe/stages/makeobj.h"
 #include "mongo/db/exec/sbe/stages/merge_join.h"
 #include "mongo/db/exec/sbe/stages/project.h"
+#include "mongo/db/exec/sbe/stages/row_to_block.h"
 #include "mongo/db/exec/sbe/stages/search_cursor.h"
 #include "mongo/db/exec/sbe/stages/sort.h"
 #include "mongo/db/exec/sbe/stages/sorted_merge.h"
@@ -106,6 +107,7 @@
 #include "mongo/db/pipeline/accumulation_statement.h"
 #include "mongo/db/pipeline/accumulator.h"
 #include "mongo/db/pipeline/accumulator_multi.h"
+#include "mongo/db/pipeline/accumulator_percentile.h"
 #include "mongo/db/pipeline/dependencies.h"
 #include "mongo/db/pipeline/expression.h"
 #include "mongo/db/pipeline/expression_context.h"
@@ -124,6 +126,7 @@
 #include "mongo/db/query/optimizer/syntax/syntax.h"
 #include "mongo/db/query/projection.h"
 #include "mongo/db/query/projection_parser.h"
+#include "mongo/db/query/query_knobs_gen.h"
 #include "mongo/db/query/query_utils.h"
 #include "mongo/db/query/sbe_stage_builder_abt_helpers.h"
 #include "mongo/db/query/sbe_stage_builder_abt_holder_impl.h"
@@ -977,9 +980,66 @@ std::pair<std::unique_ptr<sbe::PlanStage>, PlanStageSlots> SlotBasedStageBuilder
                                       makeFunction("newObj"_sd));
     }
 
+    // If the parent can process block values and only needs top-level fields from the documents,
+    // gather the fields into blocks so that the parent can use vectorized filters and block
+    // hash aggregation. Tailable scans and scans tracking a resume token need to report progress
+    // on every document, so they keep producing rows.
+    const int blockSize = internalQuerySlotBasedExecutionCollScanBlockSize.load();
+    if (blockSize > 0 && reqs.getCanProcessBlockValues() && reqs.hasOnlyFields() &&
+        !reqs.getIsTailableCollScanResumeBranch() && !_data->shouldUseTailableScan &&
+        !_data->shouldTrackResumeToken) {
+        auto blockFields = reqs.getFields();
+        if (std::none_of(blockFields.begin(), blockFields.end(), [](const std::string& field) {
+                return field.find('.') != std::string::npos;
+            })) {
+            stage = buildRowToBlock(std::move(stage), blockFields, blockSize, outputs, root);
+        }
+    }
+
     return {std::move(stage), std::move(outputs)};
 }
 
+std::unique_ptr<sbe::PlanStage> SlotBasedStageBuilder::buildRowToBlock(
+    std::unique_ptr<sbe::PlanStage> stage,
+    const std::vector<std::string>& fields,
+    size_t blockSize,
+    PlanStageSlots& outputs,
+    const QuerySolutionNode* root) {
+    PlanStageSlots blockOutputs;
+    sbe::value::SlotVector rowSlots;
+    sbe::value::SlotVector blockSlots;
+
+    for (const auto& field : fields) {
+        auto name = PlanStageSlots::UnownedSlotName(PlanStageSlots::kField, field);
+        auto blockSlot = _state.slotId();
+
+        rowSlots.push_back(outputs.get(name).getId());
+        blockSlots.push_back(blockSlot);
+        blockOutputs.set(name,
+                         SbSlot{blockSlot,
+                                TypeSignature::kBlockType.include(TypeSignature::kAnyScalarType)});
+    }
+
+    // The RowToBlock stage produces an all 1s bitmap for every block it emits. This bitmap is
+    // carried around until the block_to_row stage.
+    auto bitmapSlot = _state.slotId();
+    stage = sbe::makeS<sbe::RowToBlockStage>(std::move(stage),
+                                             std::move(rowSlots),
+                                             std::move(blockSlots),
+                                             bitmapSlot,
+                                             blockSize,
+                                             root->nodeId(),
+                                             _yieldPolicy);
+    blockOutputs.set(
+        PlanStageSlots::kBlockSelectivityBitmap,
+        SbSlot{bitmapSlot, TypeSignature::kBlockType.include(TypeSignature::kBooleanType)});
+
+    // Only the block slots are visible to the parent; the row slots below the RowToBlock stage
+    // would only hold the last value of each block.
+    outputs = std::move(blockOutputs);
+    return stage;
+}
+
 std::pair<std::unique_ptr<sbe::PlanStage>, PlanStageSlots> SlotBasedStageBuilder::buildVirtualScan(
     const QuerySolutionNode* root, const PlanStageReqs& reqs) {
     using namespace std::literals;
@@ -1167,6 +1227,9 @@ std::pair<std::unique_ptr<sbe::PlanStage>, PlanStageSlots> SlotBasedStageBuilder
     tassert(5295805, "buildCountScan() does not support kSortKey", !reqs.hasSortKeys());
 
     auto csn = static_cast<const CountScanNode*>(root);
+    tassert(9156610,
+            "buildCountScan() does not support multiple intervals",
+            csn->additionalIntervals.empty());
 
     const auto& collection = getCurrentCollection(reqs);
     auto indexName = csn->index.identifier.catalogName;
@@ -4650,6 +4713,29 @@ public:
         return removable;
     }
 
+    /**
+     * Returns a constant array with an element for each of the percentiles requested by the
+     * $percentile window function 'outputField'. The elements are nulls if 'nullElems' is true,
+     * and the percentiles themselves otherwise.
+     */
+    SbExpr makePercentilesArray(const WindowFunctionStatement& outputField, bool nullElems) {
+        auto expr = dynamic_cast<window_function::ExpressionQuantile<AccumulatorPercentile>*>(
+            outputField.expr.get());
+        tassert(9156645, "Expected a $percentile window function", expr);
+
+        auto [arrTag, arrVal] = sbe::value::makeNewArray();
+        auto arr = sbe::value::getArrayView(arrVal);
+        for (double p : expr->getPs()) {
+            if (nullElems) {
+                arr->push_back(sbe::value::TypeTags::Null, 0);
+            } else {
+                arr->push_back(sbe::value::TypeTags::NumberDouble,
+                               sbe::value::bitcastFrom<double>(p));
+            }
+        }
+        return b.makeConstant(arrTag, arrVal);
+    }
+
     SbExpr convertSbExprToArgExpr(SbExpr argExpr) {
         if (argExpr.isSlotExpr()) {
             ensureSlotInBuffer(argExpr.toSlot());
@@ -5117,6 +5203,9 @@ public:
         } else if (isTopBottomN(outputField)) {
             finalizeInputs = std::make_unique<FinalizeTopBottomNInputs>(
                 b.makeVariable(state.getSortSpecSlot(&outputField)));
+        } else if (outputField.expr->getOpName() == AccumulatorPercentile::kName) {
+            finalizeInputs = std::make_unique<FinalizeWindowPercentileInputs>(
+                makePercentilesArray(outputField, false /* nullElems */));
         }
 
         // Build finalize.
@@ -5142,6 +5231,8 @@ public:
                 return b.makeConstant(tag, val);
             } else if (opName == "$shift") {
                 return getDefaultValueExpr(state, outputField);
+            } else if (opName == AccumulatorPercentile::kName) {
+                return makePercentilesArray(outputField, true /* nullElems */);
             } else {
                 return b.makeNullConstant();
             }
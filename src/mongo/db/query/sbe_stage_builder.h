@@ -669,6 +669,17 @@ public:
         return hasType(kSortKey);
     }
 
+    // Returns true if this PlanStageReqs has at least one explicit requirement and all of its
+    // explicit requirements are of the form '{kField, N}'.
+    bool hasOnlyFields() const {
+        if (_data->slotNameSet.empty()) {
+            return false;
+        }
+        return std::all_of(_data->slotNameSet.begin(), _data->slotNameSet.end(), [](auto& item) {
+            return item.first == kField;
+        });
+    }
+
     // Returns a list of all strings N where 'has({kField, N})' is true, sorted in lexicographic
     // order.
     //
@@ -1115,6 +1126,17 @@ private:
         PlanStageSlots& outputs,
         PlanNodeId nodeId);
 
+    /**
+     * Adds a RowToBlock stage on top of 'stage' that gathers the values of the top-level 'fields'
+     * into blocks of up to 'blockSize' values. On return 'outputs' maps each field to its block
+     * slot and kBlockSelectivityBitmap to the bitmap produced by the new stage.
+     */
+    std::unique_ptr<sbe::PlanStage> buildRowToBlock(std::unique_ptr<sbe::PlanStage> stage,
+                                                    const std::vector<std::string>& fields,
+                                                    size_t blockSize,
+                                                    PlanStageSlots& outputs,
+                                                    const QuerySolutionNode* root);
+
     std::unique_ptr<sbe::EExpression> buildLimitSkipAmountExpression(
         LimitSkipParameterization canBeParameterized,
         long long amount,
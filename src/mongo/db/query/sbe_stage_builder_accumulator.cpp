@@ -139,6 +139,10 @@ AccumInputsPtr FinalizeLinearFillInputs::clone() const {
     return std::make_unique<FinalizeLinearFillInputs>(sortBy.clone());
 }
 
+AccumInputsPtr FinalizeWindowPercentileInputs::clone() const {
+    return std::make_unique<FinalizeWindowPercentileInputs>(ps.clone());
+}
+
 AccumInputsPtr FinalizeWindowFirstLastInputs::clone() const {
     return std::make_unique<FinalizeWindowFirstLastInputs>(inputExpr.clone(), defaultVal.clone());
 }
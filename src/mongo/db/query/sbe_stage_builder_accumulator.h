@@ -331,6 +331,14 @@ struct FinalizeLinearFillInputs : public AccumInputs {
     SbExpr sortBy;
 };
 
+struct FinalizeWindowPercentileInputs : public AccumInputs {
+    FinalizeWindowPercentileInputs(SbExpr ps) : ps(std::move(ps)) {}
+
+    AccumInputsPtr clone() const final;
+
+    SbExpr ps;
+};
+
 struct FinalizeWindowFirstLastInputs : public AccumInputs {
     FinalizeWindowFirstLastInputs(SbExpr inputExpr, SbExpr defaultVal)
         : inputExpr(std::move(inputExpr)), defaultVal(std::move(defaultVal)) {}
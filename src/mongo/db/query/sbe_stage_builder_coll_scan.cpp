@@ -45,6 +45,7 @@
 #include "mongo/db/exec/sbe/expressions/expression.h"
 #include "mongo/db/exec/sbe/expressions/runtime_environment.h"
 #include "mongo/db/exec/sbe/stages/co_scan.h"
+#include "mongo/db/exec/sbe/stages/exchange.h"
 #include "mongo/db/exec/sbe/stages/filter.h"
 #include "mongo/db/exec/sbe/stages/limit_skip.h"
 #include "mongo/db/exec/sbe/stages/loop_join.h"
@@ -57,6 +58,8 @@
 #include "mongo/db/namespace_string.h"
 #include "mongo/db/operation_context.h"
 #include "mongo/db/pipeline/dependencies.h"
+#include "mongo/db/query/plan_yield_policy_sbe.h"
+#include "mongo/db/query/query_knobs_gen.h"
 #include "mongo/db/query/record_id_bound.h"
 #include "mongo/db/query/sbe_stage_builder.h"
 #include "mongo/db/query/sbe_stage_builder_coll_scan.h"
@@ -66,6 +69,7 @@
 #include "mongo/db/storage/record_store.h"
 #include "mongo/db/storage/recovery_unit.h"
 #include "mongo/db/transaction_resources.h"
+#include "mongo/db/yieldable.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/str.h"
 
@@ -388,6 +392,107 @@ std::pair<std::unique_ptr<sbe::PlanStage>, PlanStageSlots> generateClusteredColl
     return {std::move(stage), std::move(outputs)};
 }  // generateClusteredCollScan
 
+/**
+ * The yieldable of the parallel scan producers. They only hold the collection through the scan
+ * stage, which reacquires it by UUID when it is restored after a yield.
+ */
+class ParallelScanProducerYieldable final : public Yieldable {
+public:
+    bool yieldable() const override {
+        return true;
+    }
+    void yield() const override {}
+    void restore() const override {}
+};
+
+const ParallelScanProducerYieldable kParallelScanProducerYieldable;
+
+/**
+ * Generates a collection scan sub-tree which splits the collection into RecordId ranges and reads
+ * them on 'csn->parallelDegree' exchange producer threads. The filter, if any, is evaluated by the
+ * producers; the exchange consumer at the root of the sub-tree gathers the surviving rows in no
+ * particular order.
+ */
+std::pair<std::unique_ptr<sbe::PlanStage>, PlanStageSlots> generateParallelCollScan(
+    StageBuilderState& state,
+    const CollectionPtr& collection,
+    const CollectionScanNode* csn,
+    std::vector<std::string> fields,
+    PlanYieldPolicy* yieldPolicy) {
+    invariant(csn->parallelDegree > 1);
+    invariant(csn->direction == CollectionScanParams::FORWARD);
+    invariant(!csn->resumeAfterRecordId && !csn->tailable && !csn->shouldTrackLatestOplogTimestamp);
+
+    auto fieldSlots = state.slotIdGenerator->generateMultiple(fields.size());
+    auto resultSlot = state.slotId();
+    auto recordIdSlot = state.slotId();
+
+    // The producers run on their own threads and operation contexts, so they cannot use the yield
+    // policy of the executor that owns the consumer. The scan is only built with it to mark it as
+    // yielding; every producer replaces it with a policy of its own.
+    sbe::ScanCallbacks callbacks({}, {}, makeOpenCallbackIfNeeded(collection, csn));
+    std::unique_ptr<sbe::PlanStage> stage =
+        sbe::makeS<sbe::ParallelScanStage>(collection->uuid(),
+                                           resultSlot,
+                                           recordIdSlot,
+                                           boost::none /* snapshotIdSlot */,
+                                           boost::none /* indexIdentSlot */,
+                                           boost::none /* indexKeySlot */,
+                                           boost::none /* keyPatternSlot */,
+                                           fields,
+                                           fieldSlots,
+                                           yieldPolicy,
+                                           csn->nodeId(),
+                                           std::move(callbacks));
+
+    PlanStageSlots outputs;
+    outputs.setResultObj(resultSlot);
+    outputs.set(PlanStageSlots::kRecordId, recordIdSlot);
+    for (size_t i = 0; i < fields.size(); ++i) {
+        outputs.set(std::make_pair(PlanStageSlots::kField, fields[i]), fieldSlots[i]);
+    }
+
+    if (csn->filter) {
+        auto filterExpr = generateFilter(
+            state, csn->filter.get(), SbSlot{resultSlot, TypeSignature::kAnyScalarType}, outputs);
+        if (!filterExpr.isNull()) {
+            stage = sbe::makeS<sbe::FilterStage<false>>(
+                std::move(stage), filterExpr.extractExpr(state), csn->nodeId());
+        }
+    }
+
+    sbe::value::SlotVector exchangeSlots{resultSlot, recordIdSlot};
+    exchangeSlots.insert(exchangeSlots.end(), fieldSlots.begin(), fieldSlots.end());
+
+    auto consumer = sbe::makeS<sbe::ExchangeConsumer>(std::move(stage),
+                                                      static_cast<size_t>(csn->parallelDegree),
+                                                      std::move(exchangeSlots),
+                                                      sbe::ExchangePolicy::roundrobin,
+                                                      nullptr /* partition */,
+                                                      nullptr /* orderLess */,
+                                                      csn->nodeId());
+    if (yieldPolicy) {
+        const auto producerPolicy = yieldPolicy->canReleaseLocksDuringExecution()
+            ? PlanYieldPolicy::YieldPolicy::YIELD_AUTO
+            : PlanYieldPolicy::YieldPolicy::INTERRUPT_ONLY;
+        consumer->setProducerYieldPolicyFactory(
+            [producerPolicy](OperationContext* opCtx,
+                             sbe::PlanStage* producer) -> std::unique_ptr<PlanYieldPolicy> {
+                auto policy =
+                    PlanYieldPolicySBE::make(opCtx,
+                                             producerPolicy,
+                                             opCtx->getServiceContext()->getFastClockSource(),
+                                             internalQueryExecYieldIterations.load(),
+                                             Milliseconds{internalQueryExecYieldPeriodMS.load()},
+                                             &kParallelScanProducerYieldable);
+                policy->registerPlan(producer);
+                return policy;
+            });
+    }
+
+    return {std::move(consumer), std::move(outputs)};
+}  // generateParallelCollScan
+
 /**
  * Generates a generic collection scan sub-tree.
  *  - If a resume token has been provided, the scan will start from a RecordId contained within this
@@ -420,6 +525,10 @@ std::pair<std::unique_ptr<sbe::PlanStage>, PlanStageSlots> generateGenericCollSc
         }
     }
 
+    if (csn->parallelDegree > 1 && !isResumingTailableScan) {
+        return generateParallelCollScan(state, collection, csn, std::move(fields), yieldPolicy);
+    }
+
     auto fieldSlots = state.slotIdGenerator->generateMultiple(fields.size());
 
     auto resultSlot = state.slotId();
@@ -249,6 +249,40 @@ SbExpr buildWindowFinalizePush(const WindowOp& op, StageBuilderState& state, SbS
     return b.makeFunction("aggRemovablePushFinalize", std::move(exprs));
 }
 
+SbExpr::Vector buildWindowAddPercentile(const WindowOp& op,
+                                        std::unique_ptr<AddSingleInput> inputs,
+                                        StageBuilderState& state) {
+    SbExprBuilder b(state);
+    return SbExpr::makeSeq(
+        b.makeFunction("aggRemovablePercentileAdd", std::move(inputs->inputExpr)));
+}
+
+SbExpr::Vector buildWindowRemovePercentile(const WindowOp& op,
+                                           std::unique_ptr<AddSingleInput> inputs,
+                                           StageBuilderState& state) {
+    SbExprBuilder b(state);
+    return SbExpr::makeSeq(
+        b.makeFunction("aggRemovablePercentileRemove", std::move(inputs->inputExpr)));
+}
+
+SbExpr buildWindowFinalizePercentile(const WindowOp& op,
+                                     std::unique_ptr<FinalizeWindowPercentileInputs> inputs,
+                                     StageBuilderState& state,
+                                     SbSlotVector slots) {
+    SbExprBuilder b(state);
+
+    tassert(9156643, "Expected a single slot", slots.size() == 1);
+    return b.makeFunction(
+        "aggRemovablePercentileFinalize", b.makeVariable(slots[0]), std::move(inputs->ps));
+}
+
+SbExpr buildWindowFinalizeMedian(const WindowOp& op, StageBuilderState& state, SbSlotVector slots) {
+    SbExprBuilder b(state);
+
+    tassert(9156644, "Expected a single slot", slots.size() == 1);
+    return b.makeFunction("aggRemovableMedianFinalize", b.makeVariable(slots[0]));
+}
+
 SbExpr::Vector buildWindowInitializeIntegral(const WindowOp& op,
                                              std::unique_ptr<InitIntegralInputs> inputs,
                                              StageBuilderState& state) {
@@ -831,6 +865,12 @@ static const StringDataMap<WindowOpInfo> windowOpInfoMap = {
                   .buildInit = makeBuildFn(&buildWindowInitializeMinMaxN),
                   .buildFinalize = makeBuildFn(&buildWindowFinalizeMaxN)}},
 
+    // Median
+    {AccumulatorMedian::kName,
+     WindowOpInfo{.buildAddAggs = makeBuildFn(&buildWindowAddPercentile),
+                  .buildRemoveAggs = makeBuildFn(&buildWindowRemovePercentile),
+                  .buildFinalize = makeBuildFn(&buildWindowFinalizeMedian)}},
+
     // Min
     {AccumulatorMin::kName,
      WindowOpInfo{.buildAddAggs = makeBuildFn(&buildWindowAddMinMaxN),
@@ -845,6 +885,12 @@ static const StringDataMap<WindowOpInfo> windowOpInfoMap = {
                   .buildInit = makeBuildFn(&buildWindowInitializeMinMaxN),
                   .buildFinalize = makeBuildFn(&buildWindowFinalizeMinN)}},
 
+    // Percentile
+    {AccumulatorPercentile::kName,
+     WindowOpInfo{.buildAddAggs = makeBuildFn(&buildWindowAddPercentile),
+                  .buildRemoveAggs = makeBuildFn(&buildWindowRemovePercentile),
+                  .buildFinalize = makeBuildFn(&buildWindowFinalizePercentile)}},
+
     // Push
     {"$push",
      WindowOpInfo{.buildAddAggs = makeBuildFn(&buildWindowAddPush),
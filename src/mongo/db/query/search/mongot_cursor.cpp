@@ -51,8 +51,11 @@ executor::TaskExecutorCursor::Options getSearchCursorOptions(
     // syncronously on the subsequent 'getNext()' call.
     opts.preFetchNextBatch = preFetchNextBatch;
     if (!opts.preFetchNextBatch) {
-        // Only set this function if we will not be prefetching.
+        // Only set this function if we will not be prefetching up front.
         opts.getMoreAugmentationWriter = augmentGetMore;
+        // Needing a getMore means the optimistic single batch did not satisfy the limit, so it is
+        // likely that further batches will be needed as well.
+        opts.preFetchAfterFirstGetMore = globalMongotParams.prefetchAfterFirstGetMore.load();
     }
     return opts;
 }
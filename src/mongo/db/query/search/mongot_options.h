@@ -52,6 +52,8 @@ struct MongotParams {
 
     AtomicWord<int> minConnections;
     AtomicWord<int> maxConnections;
+
+    AtomicWord<bool> prefetchAfterFirstGetMore;
 };
 
 extern MongotParams globalMongotParams;
@@ -48,9 +48,11 @@ static constexpr PlanNodeId kEmptyPlanNodeId = 0u;
  * stage types are shared between Classic and SBE.
  */
 enum StageType {
+    STAGE_AND_BITMAP,
     STAGE_AND_HASH,
     STAGE_AND_SORTED,
     STAGE_BATCHED_DELETE,
+    STAGE_BATCHED_UPDATE,
     STAGE_CACHED_PLAN,
 
     STAGE_COLLSCAN,
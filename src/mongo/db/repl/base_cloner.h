@@ -32,6 +32,7 @@
 #include <boost/move/utility_core.hpp>
 #include <boost/smart_ptr.hpp>
 #include <functional>
+#include <memory>
 #include <string>
 #include <utility>
 #include <vector>
@@ -63,6 +64,8 @@ namespace repl {
 
 class BaseCloner {
 public:
+    using CreateClientFn = std::function<std::unique_ptr<DBClientConnection>()>;
+
     BaseCloner(StringData clonerName,
                ReplSyncSharedData* sharedData,
                HostAndPort source,
@@ -95,6 +98,15 @@ public:
      */
     void setStopAfterStage_forTest(std::string stage);
 
+    /**
+     * Sets the factory for the connections to the sync source a cloner opens in addition to the
+     * one it was given. They are not connected yet when the factory returns them. Cloners pass
+     * the factory on to the cloners they create.
+     */
+    void setCreateClientFn(CreateClientFn createClientFn) {
+        _createClientFn = std::move(createClientFn);
+    }
+
 private:
     // The _clonerName must be initialized before _mutex, as _clonerName is used to generate the
     // name of the _mutex.
@@ -193,6 +205,10 @@ protected:
         return _dbPool;
     }
 
+    const CreateClientFn& getCreateClientFn() const {
+        return _createClientFn;
+    }
+
     bool isActive(WithLock) const {
         return _active;
     }
@@ -292,6 +308,8 @@ private:
     StorageInterface* _storageInterface;  // (X)
     ThreadPool* _dbPool;                  // (X)
     HostAndPort _source;                  // (R)
+    CreateClientFn _createClientFn =
+        [] { return std::make_unique<DBClientConnection>(true /* autoReconnect */); };  // (R)
 
     // _active indicates this cloner is being run, and is used only for status reporting and
     // invariant checking.
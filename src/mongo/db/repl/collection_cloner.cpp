@@ -29,12 +29,14 @@
 
 
 #include <absl/container/node_hash_map.h>
+#include <algorithm>
 #include <boost/cstdint.hpp>
 #include <boost/none.hpp>
 #include <cstdint>
 #include <list>
 #include <mutex>
 #include <type_traits>
+#include <utility>
 
 #include <boost/move/utility_core.hpp>
 #include <boost/optional/optional.hpp>
@@ -52,12 +54,14 @@
 #include "mongo/db/index_builds_coordinator.h"
 #include "mongo/db/multitenancy_gen.h"
 #include "mongo/db/operation_context.h"
+#include "mongo/db/pipeline/aggregate_command_gen.h"
 #include "mongo/db/query/find_command.h"
 #include "mongo/db/repl/collection_bulk_loader.h"
 #include "mongo/db/repl/collection_cloner.h"
 #include "mongo/db/repl/oplog_entry.h"
 #include "mongo/db/repl/read_concern_args.h"
 #include "mongo/db/repl/repl_server_parameters_gen.h"
+#include "mongo/db/repl/replication_auth.h"
 #include "mongo/db/server_feature_flags_gen.h"
 #include "mongo/db/server_options.h"
 #include "mongo/db/service_context.h"
@@ -74,7 +78,9 @@
 #include "mongo/util/clock_source.h"
 #include "mongo/util/duration.h"
 #include "mongo/util/fail_point.h"
+#include "mongo/util/future.h"
 #include "mongo/util/namespace_string_util.h"
+#include "mongo/util/scopeguard.h"
 #include "mongo/util/str.h"
 
 #define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kReplicationInitialSync
@@ -318,7 +324,14 @@ BaseCloner::AfterStageBehavior CollectionCloner::createCollectionStage() {
 }
 
 BaseCloner::AfterStageBehavior CollectionCloner::queryStage() {
-    runQuery();
+    if (_partitions.empty() && shouldPartitionQuery()) {
+        makePartitions();
+    }
+    if (_partitions.empty()) {
+        runQuery();
+    } else {
+        runPartitionedQuery();
+    }
     waitForDatabaseWorkToComplete();
     // We want to free the _collLoader regardless of whether the commit succeeds.
     std::unique_ptr<CollectionBulkLoader> loader = std::move(_collLoader);
@@ -431,6 +444,210 @@ void CollectionCloner::runQuery() {
     }
 }
 
+bool CollectionCloner::shouldPartitionQuery() const {
+    if (collectionClonerPartitionCount <= 1 || _resumeToken) {
+        // Partitioning is disabled, or a single query already copied part of the collection.
+        return false;
+    }
+    {
+        stdx::lock_guard<Latch> lk(_mutex);
+        if (_stats.bytesToCopy < collectionClonerPartitionMinBytes) {
+            return false;
+        }
+    }
+    // Capped collections must be copied in insertion order, and record ids that are replicated
+    // must be read in order along with the documents. The ranges are bounds on the _id index, so
+    // they need one with simple string comparison.
+    return !_collectionOptions.capped && !_collectionOptions.recordIdsReplicated &&
+        !_collectionOptions.clusteredIndex && _collectionOptions.collation.isEmpty() &&
+        !_idIndexSpec.isEmpty();
+}
+
+std::vector<BSONObj> CollectionCloner::makePartitionSplitPoints(
+    const std::vector<BSONObj>& sortedSampleIds, int numPartitions) {
+    std::vector<BSONObj> splitPoints;
+    const size_t numSamples = sortedSampleIds.size();
+    if (numSamples == 0) {
+        return splitPoints;
+    }
+    for (int i = 1; i < numPartitions; ++i) {
+        const auto& candidate = sortedSampleIds[i * numSamples / numPartitions];
+        // $sample may return the same document more than once.
+        if (!splitPoints.empty() && splitPoints.back().woCompare(candidate) >= 0) {
+            continue;
+        }
+        splitPoints.push_back(candidate);
+    }
+    return splitPoints;
+}
+
+void CollectionCloner::makePartitions() {
+    // Sample a few documents per partition so that the ranges come out roughly even.
+    static constexpr int kSamplesPerPartition = 20;
+    const int numPartitions = collectionClonerPartitionCount;
+
+    AggregateCommandRequest aggRequest(
+        _sourceNss,
+        {BSON("$sample" << BSON("size" << numPartitions * kSamplesPerPartition)),
+         BSON("$project" << BSON("_id" << 1)),
+         BSON("$sort" << BSON("_id" << 1))});
+    aggRequest.setReadConcern(ReadConcernArgs::kLocal);
+    auto cursor = uassertStatusOK(DBClientCursor::fromAggregationRequest(
+        getClient(), std::move(aggRequest), true /* secondaryOk */, false /* useExhaust */));
+
+    std::vector<BSONObj> sampleIds;
+    while (cursor->more()) {
+        sampleIds.push_back(cursor->nextSafe().getOwned());
+    }
+
+    auto splitPoints = makePartitionSplitPoints(sampleIds, numPartitions);
+    if (splitPoints.empty()) {
+        return;
+    }
+
+    BSONObj min;
+    for (auto&& splitPoint : splitPoints) {
+        _partitions.push_back({min, splitPoint});
+        min = splitPoint;
+    }
+    _partitions.push_back({min, BSONObj()});
+
+    LOGV2(9156625,
+          "Collection cloner will clone the collection in partitions",
+          logAttrs(_sourceNss),
+          "partitions"_attr = _partitions.size());
+    stdx::lock_guard<Latch> lk(_mutex);
+    _stats.partitions = _partitions.size();
+}
+
+void CollectionCloner::runPartitionedQuery() {
+    std::vector<Partition*> pending;
+    for (auto& partition : _partitions) {
+        if (!partition.done) {
+            pending.push_back(&partition);
+        }
+    }
+
+    // The partitions are cloned on the database work pool. Leave a thread of the pool to the
+    // inserts they schedule, so that the documents read do not pile up until the partitions end.
+    const size_t maxThreads = getDBPool()->getStats().options.maxThreads;
+    const size_t numWorkers = std::min(pending.size(), std::max(maxThreads, size_t{2}) - 1);
+
+    AtomicWord<bool> stopPartitions{false};
+    AtomicWord<size_t> nextPartition{0};
+    Mutex statusMutex = MONGO_MAKE_LATCH("CollectionCloner::runPartitionedQuery::statusMutex");
+    Status firstError = Status::OK();
+    auto recordError = [&](Status status) {
+        // Stop the other partitions so the error is reported, and retried, promptly.
+        stopPartitions.store(true);
+        stdx::lock_guard<Latch> lk(statusMutex);
+        if (firstError.isOK()) {
+            firstError = std::move(status);
+        }
+    };
+
+    std::vector<Future<void>> workers;
+    for (size_t i = 0; i < numWorkers; ++i) {
+        auto pf = makePromiseFuture<void>();
+        getDBPool()->schedule([&, promise = std::move(pf.promise)](Status status) mutable {
+            ON_BLOCK_EXIT([&] { promise.emplaceValue(); });
+            if (!status.isOK()) {
+                recordError(std::move(status));
+                return;
+            }
+            try {
+                auto client = getCreateClientFn()();
+                client->connect(getSource(), StringData(), boost::none);
+                uassertStatusOK(replAuthenticate(client.get())
+                                    .withContext(str::stream() << "Failed to authenticate to "
+                                                               << getSource()));
+                for (auto idx = nextPartition.fetchAndAdd(1);
+                     idx < pending.size() && !stopPartitions.load();
+                     idx = nextPartition.fetchAndAdd(1)) {
+                    runPartitionQuery(client.get(), pending[idx], stopPartitions);
+                }
+            } catch (const DBException& e) {
+                recordError(e.toStatus());
+            }
+        });
+        workers.push_back(std::move(pf.future));
+    }
+    for (auto& worker : workers) {
+        worker.wait();
+    }
+
+    // Let the inserts already scheduled finish, so that a retry resumes each partition after the
+    // last document that made it into the collection.
+    waitForDatabaseWorkToComplete();
+    uassertStatusOK(firstError);
+}
+
+void CollectionCloner::runPartitionQuery(DBClientConnection* client,
+                                         Partition* partition,
+                                         const AtomicWord<bool>& stop) {
+    FindCommandRequest findCmd{_sourceDbAndUuid};
+    findCmd.setHint(BSON("_id" << 1));
+    // A resumed range restarts at the last document it copied, which is skipped below.
+    const BSONObj resumeId = [&] {
+        stdx::lock_guard<Latch> lk(_mutex);
+        return partition->lastId;
+    }();
+    if (!resumeId.isEmpty()) {
+        findCmd.setMin(resumeId);
+    } else if (!partition->min.isEmpty()) {
+        findCmd.setMin(partition->min);
+    }
+    if (!partition->max.isEmpty()) {
+        findCmd.setMax(partition->max);
+    }
+    findCmd.setNoCursorTimeout(true);
+    findCmd.setReadConcern(ReadConcernArgs::kLocal);
+    if (_collectionClonerBatchSize) {
+        findCmd.setBatchSize(_collectionClonerBatchSize);
+    }
+
+    ExhaustMode exhaustMode = collectionClonerUsesExhaust ? ExhaustMode::kOn : ExhaustMode::kOff;
+    auto cursor = client->find(
+        std::move(findCmd), ReadPreferenceSetting{ReadPreference::SecondaryPreferred}, exhaustMode);
+
+    bool firstDoc = true;
+    while (!stop.load() && cursor->more()) {
+        uassert(ErrorCodes::CallbackCanceled,
+                "Collection cloning cancelled due to initial sync failure",
+                !mustExit());
+
+        std::vector<BSONObj> docs;
+        while (cursor->moreInCurrentBatch()) {
+            auto doc = cursor->nextSafe();
+            if (std::exchange(firstDoc, false) && !resumeId.isEmpty() &&
+                doc["_id"].woCompare(resumeId.firstElement(), false /* considerFieldName */) ==
+                    0) {
+                continue;
+            }
+            docs.emplace_back(std::move(doc));
+        }
+        if (docs.empty()) {
+            continue;
+        }
+
+        {
+            stdx::lock_guard<Latch> lk(_mutex);
+            _stats.receivedBatches++;
+        }
+        auto&& scheduleResult = _scheduleDbWorkFn(
+            [this, partition, docs = std::move(docs)](
+                const executor::TaskExecutor::CallbackArgs& cbd) {
+                insertPartitionDocumentsCallback(cbd, partition, docs);
+            });
+        uassertStatusOK(scheduleResult.getStatus().withContext(
+            str::stream() << "Error cloning collection '" << _sourceNss.toStringForErrorMsg()
+                          << "'"));
+    }
+
+    if (!stop.load()) {
+        partition->done = true;
+    }
+}
 
 void CollectionCloner::handleNextBatch(DBClientCursor& cursor) {
     waitWhileFailPointEnabled(&initialSyncHangCollectionClonerBeforeHandlingBatchResponse,
@@ -508,19 +725,7 @@ void CollectionCloner::insertDocumentsCallback(const executor::TaskExecutor::Cal
             return;
         }
         _documentsToInsert.swap(docs);
-        _stats.documentsCopied += docs.size();
-        _stats.approxBytesCopied = ((long)_stats.documentsCopied) * _stats.avgObjSize;
-        _progressMeter.hit(int(docs.size()));
-        invariant(_collLoader);
-
-        CollectionBulkLoader::ParseRecordIdAndDocFunc fn = (_collectionOptions.recordIdsReplicated)
-            ? ([](const BSONObj& doc) {
-                  return std::make_pair(RecordId(doc["r"].Long()), doc["d"].Obj());
-              })
-            : ([](const BSONObj& doc) { return std::make_pair(RecordId(0), doc); });
-        // The insert must be done within the lock, because CollectionBulkLoader is not
-        // thread safe.
-        uassertStatusOK(_collLoader->insertDocuments(docs.cbegin(), docs.cend(), fn));
+        insertDocuments_inlock(lk, docs);
     }
 
     initialSyncHangDuringCollectionClone.executeIf(
@@ -539,6 +744,34 @@ void CollectionCloner::insertDocumentsCallback(const executor::TaskExecutor::Cal
         });
 }
 
+void CollectionCloner::insertPartitionDocumentsCallback(
+    const executor::TaskExecutor::CallbackArgs& cbd,
+    Partition* partition,
+    const std::vector<BSONObj>& docs) {
+    uassertStatusOK(cbd.status);
+    stdx::lock_guard<Latch> lk(_mutex);
+    ++_stats.fetchedBatches;
+    insertDocuments_inlock(lk, docs);
+    // Only resume after documents that were inserted.
+    partition->lastId = docs.back()["_id"].wrap();
+}
+
+void CollectionCloner::insertDocuments_inlock(WithLock, const std::vector<BSONObj>& docs) {
+    _stats.documentsCopied += docs.size();
+    _stats.approxBytesCopied = ((long)_stats.documentsCopied) * _stats.avgObjSize;
+    _progressMeter.hit(int(docs.size()));
+    invariant(_collLoader);
+
+    CollectionBulkLoader::ParseRecordIdAndDocFunc fn = (_collectionOptions.recordIdsReplicated)
+        ? ([](const BSONObj& doc) {
+              return std::make_pair(RecordId(doc["r"].Long()), doc["d"].Obj());
+          })
+        : ([](const BSONObj& doc) { return std::make_pair(RecordId(0), doc); });
+    // The insert must be done within the lock, because CollectionBulkLoader is not
+    // thread safe.
+    uassertStatusOK(_collLoader->insertDocuments(docs.cbegin(), docs.cend(), fn));
+}
+
 bool CollectionCloner::isMyFailPoint(const BSONObj& data) const {
     const auto fpNss = NamespaceStringUtil::parseFailPointData(data, "nss"_sd);
     return (fpNss.isEmpty() || fpNss == _sourceNss) && BaseCloner::isMyFailPoint(data);
@@ -584,6 +817,9 @@ void CollectionCloner::Stats::append(BSONObjBuilder* builder) const {
         }
     }
     builder->appendNumber("receivedBatches", static_cast<long long>(receivedBatches));
+    if (partitions) {
+        builder->appendNumber("partitions", static_cast<long long>(partitions));
+    }
 }
 
 }  // namespace repl
@@ -55,7 +55,9 @@
 #include "mongo/db/repl/storage_interface.h"
 #include "mongo/db/repl/task_runner.h"
 #include "mongo/executor/task_executor.h"
+#include "mongo/platform/atomic_word.h"
 #include "mongo/util/concurrency/thread_pool.h"
+#include "mongo/util/concurrency/with_lock.h"
 #include "mongo/util/functional.h"
 #include "mongo/util/net/hostandport.h"
 #include "mongo/util/progress_meter.h"
@@ -84,6 +86,7 @@ public:
         size_t indexes{0};
         size_t fetchedBatches{0};  // This is actually inserted batches.
         size_t receivedBatches{0};
+        size_t partitions{0};
         long long bytesToCopy{0};
         long long avgObjSize{0};
         long long approxBytesCopied{0};
@@ -127,6 +130,15 @@ public:
         return _sourceDbAndUuid.uuid();
     }
 
+    /**
+     * Picks the bounds splitting a collection into at most 'numPartitions' _id ranges from
+     * 'sortedSampleIds', a sorted sample of documents of the form {_id: <value>}. Returns the
+     * split points in increasing order; a collection is cloned in one range more than there are
+     * split points.
+     */
+    static std::vector<BSONObj> makePartitionSplitPoints(
+        const std::vector<BSONObj>& sortedSampleIds, int numPartitions);
+
     /**
      * Set the cloner batch size.
      *
@@ -251,6 +263,61 @@ private:
      */
     void runQuery();
 
+    /**
+     * An _id range of the collection cloned by its own query. 'min' is inclusive and 'max' is
+     * exclusive; an empty bound leaves that side of the range open.
+     */
+    struct Partition {
+        BSONObj min;
+        BSONObj max;
+        // The _id of the last document inserted by the bulk loader, to resume the range from.
+        BSONObj lastId;  // (M)
+        bool done = false;
+    };
+
+    /**
+     * Returns true if the collection should be cloned as several _id ranges. Collections whose
+     * document order matters, or whose _id index bounds are not plain values, are always cloned
+     * with a single query.
+     */
+    bool shouldPartitionQuery() const;
+
+    /**
+     * Samples the source collection to fill in _partitions. Leaves _partitions empty if the
+     * sample does not yield any split point.
+     */
+    void makePartitions();
+
+    /**
+     * Clones the unfinished partitions concurrently on the database work pool, each worker over
+     * its own connection to the source made by the cloner's client factory. Throws the first error
+     * any partition hit once all of them have stopped and their inserts are done; the partitions
+     * keep their progress so a retry resumes them.
+     */
+    void runPartitionedQuery();
+
+    /**
+     * Runs the query for one partition on the given connection until the range is exhausted or
+     * 'stop' is set.
+     */
+    void runPartitionQuery(DBClientConnection* client,
+                           Partition* partition,
+                           const AtomicWord<bool>& stop);
+
+    /**
+     * Inserts a batch of documents read by the query of 'partition', and records the last of
+     * them as the point to resume the partition from.
+     */
+    void insertPartitionDocumentsCallback(const executor::TaskExecutor::CallbackArgs& cbd,
+                                          Partition* partition,
+                                          const std::vector<BSONObj>& docs);
+
+    /**
+     * Inserts 'docs' into the collection through the bulk loader and accounts for them in the
+     * stats.
+     */
+    void insertDocuments_inlock(WithLock, const std::vector<BSONObj>& docs);
+
     // All member variables are labeled with one of the following codes indicating the
     // synchronization rules for accessing them.
     //
@@ -291,6 +358,10 @@ private:
     // The cursorId of the remote collection cursor.
     long long _remoteCursorId = -1;  // (X)
 
+    // The _id ranges the collection is being cloned in, if it is partitioned. While partitions
+    // are running, each one is only touched by the worker cloning it, except for its lastId.
+    std::vector<Partition> _partitions;  // (X)
+
     // If true, it means we are starting a new query or resuming an interrupted one.
     bool _firstBatchOfQueryRound = true;  // (X)
 
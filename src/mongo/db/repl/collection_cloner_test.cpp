@@ -1190,5 +1190,123 @@ TEST_F(CollectionClonerMultitenancyTest, CollectionClonerMultitenancy) {
     ASSERT_EQ(numOperations, cloner->getStats().documentsCopied);
 }
 
+class CollectionClonerPartitionedTest : public CollectionClonerTestResumable {
+protected:
+    void setUp() override {
+        CollectionClonerTestResumable::setUp();
+        _partitionCountDefault = collectionClonerPartitionCount;
+        _partitionMinBytesDefault = collectionClonerPartitionMinBytes;
+        collectionClonerPartitionCount = 2;
+        collectionClonerPartitionMinBytes = 0;
+
+        _mockServer->setCommandReply("replSetGetRBID", fromjson("{ok:1, rbid:1}"));
+        setMockServerReplies(BSON("size" << 10),
+                             createCountResponse(kNumDocs),
+                             createCursorResponse(_nss.ns_forTest(), BSON_ARRAY(_idIndexSpec)));
+        BSONArrayBuilder sampleIds;
+        for (int i = 1; i <= kNumDocs; ++i) {
+            _mockServer->insert(_nss, BSON("_id" << i));
+            sampleIds.append(BSON("_id" << i));
+        }
+        // The sample splits the collection into [MinKey, 4) and [4, MaxKey).
+        _mockServer->setCommandReply("aggregate",
+                                     createCursorResponse(_nss.ns_forTest(), sampleIds.arr()));
+    }
+
+    void tearDown() override {
+        collectionClonerPartitionCount = _partitionCountDefault;
+        collectionClonerPartitionMinBytes = _partitionMinBytesDefault;
+        CollectionClonerTestResumable::tearDown();
+    }
+
+    std::unique_ptr<CollectionCloner> makePartitionedCollectionCloner() {
+        auto cloner = makeCollectionCloner();
+        cloner->setCreateClientFn([this]() -> std::unique_ptr<DBClientConnection> {
+            return std::make_unique<MockDBClientConnection>(_mockServer.get());
+        });
+        cloner->setBatchSize_forTest(2);
+        return cloner;
+    }
+
+    static constexpr int kNumDocs = 6;
+
+private:
+    int _partitionCountDefault;
+    long long _partitionMinBytesDefault;
+};
+
+TEST_F(CollectionClonerPartitionedTest, PartitionsCopyEveryDocumentOnce) {
+    auto cloner = makePartitionedCollectionCloner();
+    ASSERT_OK(cloner->run());
+
+    ASSERT_EQUALS(kNumDocs, _collectionStats->insertCount);
+    ASSERT_TRUE(_collectionStats->commitCalled);
+    auto stats = cloner->getStats();
+    ASSERT_EQUALS(2u, stats.partitions);
+    ASSERT_EQUALS(static_cast<size_t>(kNumDocs), stats.documentsCopied);
+}
+
+TEST_F(CollectionClonerPartitionedTest, PartitionResumesAfterLastInsertedDocumentOnRetry) {
+    // The pool of the fixture has a single thread, so the partitions run one after the other.
+    // The first partition reads [1, 2] and [3]; the second one reads [4, 5] and then fails to get
+    // its next batch.
+    auto failNextBatch = globalFailPointRegistry().find("mockCursorThrowErrorOnGetMore");
+    failNextBatch->setMode(FailPoint::skip, 3, fromjson("{errorType: 'HostUnreachable'}"));
+    ON_BLOCK_EXIT([&] { failNextBatch->setMode(FailPoint::off, 0); });
+
+    auto beforeRetryFailPoint = globalFailPointRegistry().find("hangBeforeRetryingClonerStage");
+    auto timesEnteredBeforeRetry = beforeRetryFailPoint->setMode(
+        FailPoint::alwaysOn, 0, fromjson("{cloner: 'CollectionCloner', stage: 'query'}"));
+
+    auto cloner = makePartitionedCollectionCloner();
+
+    // Run the cloner in a separate thread.
+    stdx::thread clonerThread([&] {
+        Client::initThread("ClonerRunner", getGlobalServiceContext()->getService());
+        ASSERT_OK(cloner->run());
+    });
+
+    // The documents read before the error are inserted before the stage is retried.
+    beforeRetryFailPoint->waitForTimesEntered(timesEnteredBeforeRetry + 1);
+    ASSERT_EQUALS(5, _collectionStats->insertCount);
+
+    failNextBatch->setMode(FailPoint::off, 0);
+    beforeRetryFailPoint->setMode(FailPoint::off, 0);
+    clonerThread.join();
+
+    // The finished partition is not cloned again, and the other one resumes after _id 5, so no
+    // document is inserted twice.
+    ASSERT_EQUALS(kNumDocs, _collectionStats->insertCount);
+    ASSERT_TRUE(_collectionStats->commitCalled);
+    auto stats = cloner->getStats();
+    ASSERT_EQUALS(static_cast<size_t>(kNumDocs), stats.documentsCopied);
+}
+
+TEST(CollectionClonerPartitionTest, SplitPointsAreEvenlySpacedSamples) {
+    std::vector<BSONObj> sampleIds;
+    for (int i = 0; i < 10; ++i) {
+        sampleIds.push_back(BSON("_id" << i));
+    }
+
+    auto splitPoints = CollectionCloner::makePartitionSplitPoints(sampleIds, 4);
+    ASSERT_EQ(3U, splitPoints.size());
+    ASSERT_BSONOBJ_EQ(BSON("_id" << 2), splitPoints[0]);
+    ASSERT_BSONOBJ_EQ(BSON("_id" << 5), splitPoints[1]);
+    ASSERT_BSONOBJ_EQ(BSON("_id" << 7), splitPoints[2]);
+}
+
+TEST(CollectionClonerPartitionTest, SplitPointsSkipRepeatedSamples) {
+    // $sample can return the same document more than once, which must not produce empty ranges.
+    std::vector<BSONObj> sampleIds{
+        BSON("_id" << 1), BSON("_id" << 1), BSON("_id" << 1), BSON("_id" << 1), BSON("_id" << 2)};
+
+    auto splitPoints = CollectionCloner::makePartitionSplitPoints(sampleIds, 4);
+    ASSERT_EQ(1U, splitPoints.size());
+    ASSERT_BSONOBJ_EQ(BSON("_id" << 1), splitPoints[0]);
+
+    ASSERT(CollectionCloner::makePartitionSplitPoints({}, 4).empty());
+    ASSERT(CollectionCloner::makePartitionSplitPoints(sampleIds, 1).empty());
+}
+
 }  // namespace repl
 }  // namespace mongo
@@ -165,6 +165,7 @@ void DatabaseCloner::postStage() {
                                                                           getClient(),
                                                                           getStorageInterface(),
                                                                           getDBPool());
+            _currentCollectionCloner->setCreateClientFn(getCreateClientFn());
         }
         auto collStatus = _currentCollectionCloner->run();
         if (collStatus.isOK()) {
@@ -1185,8 +1185,10 @@ void InitialSyncer::_fcvFetcherCallback(const StatusWith<Fetcher::QueryResponse>
                                                 _allowedOutageDuration,
                                                 getGlobalServiceContext()->getFastClockSource());
     _client = _createClientFn();
-    _initialSyncState = std::make_unique<InitialSyncState>(std::make_unique<AllDatabaseCloner>(
-        _sharedData.get(), _syncSource, _client.get(), _storage, _writerPool));
+    auto allDatabaseCloner = std::make_unique<AllDatabaseCloner>(
+        _sharedData.get(), _syncSource, _client.get(), _storage, _writerPool);
+    allDatabaseCloner->setCreateClientFn(_createClientFn);
+    _initialSyncState = std::make_unique<InitialSyncState>(std::move(allDatabaseCloner));
 
     // Create oplog applier.
     auto consistencyMarkers = _replicationProcess->getConsistencyMarkers();
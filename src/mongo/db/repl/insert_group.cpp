@@ -39,10 +39,10 @@
 #include "mongo/base/error_codes.h"
 #include "mongo/bson/bsonobj.h"
 #include "mongo/db/namespace_string.h"
-#include "mongo/db/ops/write_ops.h"
 #include "mongo/db/repl/insert_group.h"
 #include "mongo/db/repl/oplog_entry.h"
 #include "mongo/db/repl/oplog_entry_gen.h"
+#include "mongo/db/repl/repl_server_parameters_gen.h"
 #include "mongo/logv2/log.h"
 #include "mongo/logv2/log_attr.h"
 #include "mongo/logv2/log_component.h"
@@ -55,16 +55,6 @@
 namespace mongo {
 namespace repl {
 
-namespace {
-
-// Must not create too large an object.
-const auto kInsertGroupMaxGroupSize = write_ops::insertVectorMaxBytes;
-
-// Limit number of ops in a single group.
-constexpr auto kInsertGroupMaxOpCount = 64;
-
-}  // namespace
-
 InsertGroup::InsertGroup(std::vector<ApplierOperation>* ops,
                          OperationContext* opCtx,
                          InsertGroup::Mode mode,
@@ -104,6 +94,11 @@ StatusWith<InsertGroup::ConstIterator> InsertGroup::groupAndApplyInserts(
     auto opCount = std::vector<ApplierOperation>::size_type(1);
     auto groupNamespace = op->getNss();
 
+    // Must not create too large an object, nor too many ops in a single group.
+    const auto maxGroupSize = static_cast<size_t>(replInsertGroupMaxBytes.load());
+    const auto maxOpCount =
+        static_cast<std::vector<ApplierOperation>::size_type>(replInsertGroupMaxOps.load());
+
     /**
      * Search for the op that delimits this insert group, and save its position
      * in endOfGroupableOpsIterator. For example, given the following list of oplog
@@ -127,8 +122,8 @@ StatusWith<InsertGroup::ConstIterator> InsertGroup::groupAndApplyInserts(
             // Only add the op to this group if it passes the criteria.
             return nextOp->getOpType() != OpTypeEnum::kInsert  // Must be an insert.
                 || opNamespace != groupNamespace               // Must be in the same namespace.
-                || groupSize > kInsertGroupMaxGroupSize  // Must not create too large an object.
-                || opCount > kInsertGroupMaxOpCount;     // Limit number of ops in a single group.
+                || groupSize > maxGroupSize  // Must not create too large an object.
+                || opCount > maxOpCount;     // Limit number of ops in a single group.
         });
 
     // See if we were able to create a group that contains more than a single op.
@@ -34,6 +34,7 @@
 #include "mongo/db/namespace_string.h"
 #include "mongo/db/repl/insert_group.h"
 #include "mongo/db/repl/oplog_entry_test_helpers.h"
+#include "mongo/idl/server_parameter_test_util.h"
 #include "mongo/unittest/assert.h"
 
 namespace mongo {
@@ -180,6 +181,44 @@ TEST(InsertGroupTest, NoGroupingCount) {
     ASSERT(numGroups == 2);
 }
 
+// Group size limits follow replInsertGroupMaxOps and replInsertGroupMaxBytes
+TEST(InsertGroupTest, GroupLimitsAreConfigurable) {
+    std::vector<ApplierOperation> applyOps;
+    std::vector<mongo::repl::OplogEntry> ops;
+    constexpr int numOps = 67;
+
+    buildOps(numOps, docId, nssV[0], ops);
+    buildApplierOperationsFromOps(applyOps, ops);
+
+    auto countGroups = [&] {
+        InsertGroup insertGroup(
+            &applyOps, nullptr, OplogApplication::Mode::kSecondary, true, testApplierFunctionOK);
+        int numGroups = 0;
+        for (auto it = applyOps.cbegin(); it != applyOps.cend(); ++it, ++numGroups) {
+            auto groupResult = insertGroup.groupAndApplyInserts(it);
+            if (groupResult.isOK()) {
+                it = groupResult.getValue();
+            }
+        }
+        return numGroups;
+    };
+
+    {
+        RAIIServerParameterControllerForTest maxOps("replInsertGroupMaxOps", 1000);
+        ASSERT_EQ(1, countGroups());
+    }
+    {
+        RAIIServerParameterControllerForTest maxOps("replInsertGroupMaxOps", 8);
+        ASSERT_EQ(9, countGroups());
+    }
+    {
+        // Each document is 14 bytes, so at most two fit in a group.
+        RAIIServerParameterControllerForTest maxOps("replInsertGroupMaxOps", 1000);
+        RAIIServerParameterControllerForTest maxBytes("replInsertGroupMaxBytes", 28);
+        ASSERT_EQ(34, countGroups());
+    }
+}
+
 }  // namespace
 }  // namespace repl
 }  // namespace mongo
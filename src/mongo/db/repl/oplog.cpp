@@ -1619,8 +1619,9 @@ Status applyOperation_inlock(OperationContext* opCtx,
                         "Cannot apply an array insert with applyOps",
                         !opCtx->writesAreReplicated() || tenantMigrationInfo(opCtx));
 
+                const auto& insertOps = opOrGroupedInserts.getGroupedInserts();
                 std::vector<InsertStatement> insertObjs;
-                const auto insertOps = opOrGroupedInserts.getGroupedInserts();
+                insertObjs.reserve(insertOps.size());
                 WriteUnitOfWork wuow(opCtx);
                 if (!opCtx->writesAreReplicated()) {
                     for (const auto& iOp : insertOps) {
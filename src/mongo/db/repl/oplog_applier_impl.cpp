@@ -67,6 +67,7 @@
 #include "mongo/db/repl/oplog_applier_utils.h"
 #include "mongo/db/repl/oplog_batcher.h"
 #include "mongo/db/repl/oplog_entry_gen.h"
+#include "mongo/db/repl/repl_server_parameters_gen.h"
 #include "mongo/db/repl/replication_metrics.h"
 #include "mongo/db/repl/split_prepare_session_manager.h"
 #include "mongo/db/repl/transaction_oplog_application.h"
@@ -103,6 +104,7 @@
 #include "mongo/util/scopeguard.h"
 #include "mongo/util/str.h"
 #include "mongo/util/time_support.h"
+#include "mongo/util/timer.h"
 
 #define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kReplication
 
@@ -528,7 +530,14 @@ OplogApplierImpl::OplogApplierImpl(executor::TaskExecutor* executor,
       _writerPool(writerPool),
       _storageInterface(storageInterface),
       _consistencyMarkers(consistencyMarkers),
-      _beginApplyingOpTime(options.beginApplyingOpTime) {}
+      _beginApplyingOpTime(options.beginApplyingOpTime) {
+    if (options.mode == OplogApplication::Mode::kSecondary && replOplogPrefetchThreadCount > 0) {
+        _prefetcher = std::make_unique<OplogPrefetcher>(replOplogPrefetchThreadCount,
+                                                        replOplogPrefetchMaxPendingOps);
+        _oplogBatcher->setPrefetchFn(
+            [this](const std::vector<OplogEntry>& ops) { _prefetcher->prefetch(ops); });
+    }
+}
 
 void OplogApplierImpl::_run(OplogBuffer* oplogBuffer) {
     // Start up a thread from the batcher to pull from the oplog buffer into the batcher's oplog
@@ -616,6 +625,14 @@ void OplogApplierImpl::_run(OplogBuffer* oplogBuffer) {
         // Don't allow the fsync+lock thread to see intermediate states of batch application.
         stdx::lock_guard<SimpleMutex> fsynclk(filesLockedFsync);
 
+        // Measure the batch as counted against the batch limits, so the batcher can size the
+        // next ones.
+        std::size_t opCountInBatch = 0;
+        for (const auto& entry : ops.getBatch()) {
+            opCountInBatch += OplogBatcher::getOpCount(entry);
+        }
+        Timer batchTimer;
+
         // Apply the operations in this batch. '_applyOplogBatch' returns the optime of the
         // last op that was applied, which should be the last optime in the batch.
         auto swLastOpTimeAppliedInBatch = _applyOplogBatch(&opCtx, ops.releaseBatch());
@@ -630,6 +647,11 @@ void OplogApplierImpl::_run(OplogBuffer* oplogBuffer) {
         fassertNoTrace(34437, swLastOpTimeAppliedInBatch);
         invariant(swLastOpTimeAppliedInBatch.getValue() == lastOpTimeInBatch);
 
+        _oplogBatcher->getBatchSizeController().onBatchApplied(
+            opCountInBatch,
+            duration_cast<Milliseconds>(batchTimer.elapsed()),
+            Date_t::now() - lastWallTimeInBatch);
+
         // Update various things that care about our last applied optime.
 
         // 1. Ensure that the last applied op time hasn't changed since the start of this batch.
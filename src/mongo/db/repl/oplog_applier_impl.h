@@ -30,6 +30,7 @@
 
 #pragma once
 
+#include <memory>
 #include <vector>
 
 #include "mongo/base/status.h"
@@ -44,6 +45,7 @@
 #include "mongo/db/repl/oplog_buffer.h"
 #include "mongo/db/repl/oplog_entry.h"
 #include "mongo/db/repl/oplog_entry_or_grouped_inserts.h"
+#include "mongo/db/repl/oplog_prefetcher.h"
 #include "mongo/db/repl/optime.h"
 #include "mongo/db/repl/replication_consistency_markers.h"
 #include "mongo/db/repl/replication_coordinator.h"
@@ -147,6 +149,10 @@ private:
     // we will apply all operations that were fetched.
     OpTime _beginApplyingOpTime = OpTime();
 
+    // Warms the cache for each upcoming batch on secondaries. Null when prefetching is disabled by
+    // replOplogPrefetchThreadCount.
+    std::unique_ptr<OplogPrefetcher> _prefetcher;
+
 protected:
     // Marked as protected for use in unit tests.
     /**
@@ -99,6 +99,7 @@
 #include "mongo/db/repl/oplog_entry_gen.h"
 #include "mongo/db/repl/oplog_entry_or_grouped_inserts.h"
 #include "mongo/db/repl/oplog_entry_test_helpers.h"
+#include "mongo/db/repl/oplog_prefetcher.h"
 #include "mongo/db/repl/optime.h"
 #include "mongo/db/repl/repl_server_parameters_gen.h"
 #include "mongo/db/repl/replication_consistency_markers.h"
@@ -122,6 +123,7 @@
 #include "mongo/db/update/update_oplog_entry_serialization.h"
 #include "mongo/executor/task_executor.h"
 #include "mongo/idl/idl_parser.h"
+#include "mongo/idl/server_parameter_test_util.h"
 #include "mongo/platform/atomic_word.h"
 #include "mongo/platform/mutex.h"
 #include "mongo/unittest/assert.h"
@@ -1265,6 +1267,57 @@ TEST_F(OplogApplierImplTest,
                   secondDerivedOp.getObject()["lastWriteOpTime"]["ts"].timestamp());
 }
 
+TEST_F(OplogApplierImplTest, BalancedWriterAssignmentKeepsHotDocumentOnItsOwnWriter) {
+    RAIIServerParameterControllerForTest balanced{"replWriterBalancedAssignment", true};
+    const NamespaceString nss = NamespaceString::createNamespaceString_forTest("test", "foo");
+
+    auto writerPool = makeReplWriterPool();
+    const size_t numWriters = writerPool->getStats().options.maxThreads;
+    ASSERT_GT(numWriters, 2);
+
+    // Every other op is on the same document.
+    std::vector<OplogEntry> ops;
+    for (unsigned i = 0; i < 4 * numWriters; ++i) {
+        ops.push_back(
+            makeInsertDocumentOplogEntry({Timestamp(1, 2 * i + 1), 1}, nss, BSON("_id" << 0)));
+        ops.push_back(makeInsertDocumentOplogEntry(
+            {Timestamp(1, 2 * i + 2), 1}, nss, BSON("_id" << static_cast<int>(i + 1))));
+    }
+
+    NoopOplogApplierObserver observer;
+    OplogApplierImpl oplogApplier(
+        nullptr,  // executor
+        nullptr,  // oplogBuffer
+        &observer,
+        ReplicationCoordinator::get(_opCtx.get()),
+        getConsistencyMarkers(),
+        getStorageInterface(),
+        repl::OplogApplier::Options(repl::OplogApplication::Mode::kSecondary),
+        writerPool.get());
+
+    std::vector<std::vector<ApplierOperation>> writerVectors(numWriters);
+    std::vector<std::vector<OplogEntry>> derivedOps;
+    oplogApplier.fillWriterVectors_forTest(_opCtx.get(), &ops, &writerVectors, &derivedOps);
+
+    // The writer applying the hot document gets none of the other ops, which are spread evenly
+    // over the remaining writers.
+    size_t minOtherLoad = ops.size();
+    size_t maxOtherLoad = 0;
+    for (const auto& writer : writerVectors) {
+        ASSERT_FALSE(writer.empty());
+        if (writer.front()->getIdElement().numberInt() == 0) {
+            ASSERT_EQ(writer.size(), 4 * numWriters);
+            for (const auto& op : writer) {
+                ASSERT_EQ(op->getIdElement().numberInt(), 0);
+            }
+            continue;
+        }
+        minOtherLoad = std::min(minOtherLoad, writer.size());
+        maxOtherLoad = std::max(maxOtherLoad, writer.size());
+    }
+    ASSERT_LTE(maxOtherLoad - minOtherLoad, 1);
+}
+
 TEST_F(OplogApplierImplTest, applyOplogEntryOrGroupedInsertsInsertDocumentIncludesTenantId) {
     setServerParameter("multitenancySupport", true);
     setServerParameter("featureFlagRequireTenantID", true);
@@ -6476,6 +6529,42 @@ TEST_F(GlobalIndexTest, LargeBatchDifferentUUIDAssignsAtLeastOneOpToEachWriter)
     ASSERT_EQ(count, kNumEntries + 1);  // CRUD ops + 1 config.transactions entry.
 }
 
+TEST_F(OplogApplierImplTest, OplogPrefetcherSchedulesOnlyUpdatesAndDeletes) {
+    const NamespaceString nss = NamespaceString::createNamespaceString_forTest("test.t");
+    createCollectionWithUuid(_opCtx.get(), nss);
+    ASSERT_OK(getStorageInterface()->insertDocument(
+        _opCtx.get(), nss, {BSON("_id" << 0 << "x" << 1)}, 0));
+
+    std::vector<OplogEntry> ops{
+        makeInsertDocumentOplogEntry(nextOpTime(), nss, BSON("_id" << 1)),
+        makeUpdateDocumentOplogEntry(
+            nextOpTime(), nss, BSON("_id" << 0), BSON("$set" << BSON("x" << 2))),
+        makeDeleteDocumentOplogEntry(nextOpTime(), nss, BSON("_id" << 0)),
+        makeDeleteDocumentOplogEntry(nextOpTime(), nss, BSON("_id" << 2)),
+    };
+
+    OplogPrefetcher prefetcher(2, 100);
+    ASSERT_EQ(3U, prefetcher.prefetch(ops));
+    prefetcher.waitForIdle_forTest();
+    ASSERT_EQ(0, prefetcher.getPendingOps());
+}
+
+TEST_F(OplogApplierImplTest, OplogPrefetcherSkipsOpsBeyondPendingBound) {
+    const NamespaceString nss = NamespaceString::createNamespaceString_forTest("test.t");
+    createCollectionWithUuid(_opCtx.get(), nss);
+
+    std::vector<OplogEntry> ops;
+    for (int i = 0; i < 5; i++) {
+        ops.push_back(makeDeleteDocumentOplogEntry(nextOpTime(), nss, BSON("_id" << i)));
+    }
+
+    OplogPrefetcher prefetcher(1, 2);
+    ASSERT_EQ(2U, prefetcher.prefetch(ops));
+    ASSERT_LTE(prefetcher.getPendingOps(), 2);
+    prefetcher.waitForIdle_forTest();
+    ASSERT_EQ(0, prefetcher.getPendingOps());
+}
+
 }  // namespace
 }  // namespace repl
 }  // namespace mongo
@@ -522,6 +522,37 @@ TEST_F(OplogApplierTest, LastOpInLargeTransactionIsProcessedIndividually) {
     ASSERT_EQUALS(srcOps[4], batch[0]);
 }
 
+TEST(OplogBatchSizeControllerTest, UsesStaticLimitWhenDisabled) {
+    RAIIServerParameterControllerForTest maxOps{"replBatchLimitOperations", 5000};
+    OplogBatchSizeController controller;
+    controller.onBatchApplied(5000, Seconds{10}, Milliseconds{0});
+    ASSERT_EQ(controller.getOpsLimit(), 5000U);
+}
+
+TEST(OplogBatchSizeControllerTest, SizesBatchesFromMeasuredThroughput) {
+    RAIIServerParameterControllerForTest adaptive{"replBatchAdaptiveSizing", true};
+    RAIIServerParameterControllerForTest target{"replBatchTargetApplyMillis", 100};
+    RAIIServerParameterControllerForTest maxOps{"replBatchLimitOperations", 5000};
+    OplogBatchSizeController controller;
+    ASSERT_EQ(controller.getOpsLimit(), 5000U);
+
+    // 5 ops per millisecond fit 500 ops in the 100ms target.
+    controller.onBatchApplied(5000, Seconds{1}, Milliseconds{0});
+    ASSERT_EQ(controller.getOpsLimit(), 500U);
+
+    // Batches much smaller than the limit don't say much about the throughput.
+    controller.onBatchApplied(10, Milliseconds{100}, Milliseconds{0});
+    ASSERT_EQ(controller.getOpsLimit(), 500U);
+
+    // A faster batch moves the average towards 50 ops per millisecond.
+    controller.onBatchApplied(500, Milliseconds{10}, Milliseconds{0});
+    ASSERT_EQ(controller.getOpsLimit(), 1625U);
+
+    // Lagging nodes take bigger batches, up to the static limit.
+    controller.onBatchApplied(1625, Milliseconds{100}, OplogBatchSizeController::kCatchUpLag);
+    ASSERT_EQ(controller.getOpsLimit(), 5000U);
+}
+
 class OplogApplierDelayTest : public OplogApplierTest {
 public:
     void setUp() override {
@@ -97,6 +97,9 @@ MONGO_FAIL_POINT_DEFINE(hangAfterApplyingCollectionDropOplogEntry);
 
 namespace mongo {
 namespace repl {
+CachedCollectionProperties::CachedCollectionProperties()
+    : _balanceWriters(replWriterBalancedAssignment.load()) {}
+
 CachedCollectionProperties::CollectionProperties
 CachedCollectionProperties::getCollectionProperties(OperationContext* opCtx,
                                                     const NamespaceString& nss) {
@@ -115,6 +118,33 @@ CachedCollectionProperties::getCollectionProperties(OperationContext* opCtx,
     return collProperties;
 }
 
+uint32_t CachedCollectionProperties::getWriterId(uint32_t hash,
+                                                uint32_t numWriters,
+                                                boost::optional<uint32_t> forceWriterId) {
+    if (!_balanceWriters) {
+        return (forceWriterId ? *forceWriterId : hash) % numWriters;
+    }
+
+    if (_writerLoads.size() != numWriters) {
+        _writerLoads.assign(numWriters, 0);
+        _writerIdByHash.clear();
+    }
+
+    uint32_t writerId;
+    if (forceWriterId) {
+        writerId = *forceWriterId % numWriters;
+        _writerIdByHash.emplace(hash, writerId);
+    } else if (auto it = _writerIdByHash.find(hash); it != _writerIdByHash.end()) {
+        writerId = it->second;
+    } else {
+        auto leastLoaded = std::min_element(_writerLoads.begin(), _writerLoads.end());
+        writerId = leastLoaded - _writerLoads.begin();
+        _writerIdByHash.emplace(hash, writerId);
+    }
+    ++_writerLoads[writerId];
+    return writerId;
+}
+
 namespace {
 /**
  * Populates a CRUD op's idHash and updates the isForCappedCollection field if necessary.
@@ -160,7 +190,7 @@ uint32_t getWriterId(OperationContext* opCtx,
                      uint32_t numWriters,
                      boost::optional<uint32_t> forceWriterId = boost::none) {
     auto hash = OplogApplierUtils::getOplogEntryHash(opCtx, op, collPropertiesCache);
-    return (forceWriterId ? *forceWriterId : hash) % numWriters;
+    return collPropertiesCache->getWriterId(hash, numWriters, forceWriterId);
 }
 
 /**
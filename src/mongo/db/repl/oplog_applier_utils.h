@@ -53,10 +53,13 @@ namespace repl {
 
 /**
  * Caches per-collection properties which are relevant for oplog application, so that they don't
- * have to be retrieved repeatedly for each op.
+ * have to be retrieved repeatedly for each op. Also tracks the assignment of the ops of the batch
+ * to writers.
  */
 class CachedCollectionProperties {
 public:
+    CachedCollectionProperties();
+
     struct CollectionProperties {
         bool isCapped = false;
         bool isClustered = false;
@@ -66,8 +69,24 @@ public:
     CollectionProperties getCollectionProperties(OperationContext* opCtx,
                                                  const NamespaceString& nss);
 
+    /**
+     * Returns the writer, out of 'numWriters', that applies an op of the batch with the given
+     * hash. Ops with the same hash are assigned to the same writer.
+     *
+     * By default the writer is picked by hash. With 'replWriterBalancedAssignment', the first op
+     * with a given hash goes to the writer with the fewest ops assigned so far, so that the ops on
+     * a hot document don't hold up the unrelated ops that happen to hash to the same writer.
+     */
+    uint32_t getWriterId(uint32_t hash,
+                         uint32_t numWriters,
+                         boost::optional<uint32_t> forceWriterId);
+
 private:
     stdx::unordered_map<NamespaceString, CollectionProperties> _cache;
+
+    const bool _balanceWriters;
+    stdx::unordered_map<uint32_t, uint32_t> _writerIdByHash;
+    std::vector<size_t> _writerLoads;
 };
 
 /**
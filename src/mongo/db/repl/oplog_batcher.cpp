@@ -42,7 +42,9 @@
 #include "mongo/bson/bsonelement.h"
 #include "mongo/bson/bsonobj.h"
 #include "mongo/db/admission/execution_admission_context.h"
+#include "mongo/base/counter.h"
 #include "mongo/db/client.h"
+#include "mongo/db/commands/server_status_metric.h"
 #include "mongo/db/concurrency/d_concurrency.h"
 #include "mongo/db/concurrency/lock_manager_defs.h"
 #include "mongo/db/namespace_string.h"
@@ -73,6 +75,65 @@ namespace repl {
 MONGO_FAIL_POINT_DEFINE(skipOplogBatcherWaitForData);
 MONGO_FAIL_POINT_DEFINE(oplogBatcherPauseAfterSuccessfulPeek);
 
+namespace {
+auto& adaptiveOpsLimit = *MetricBuilder<Atomic64Metric>("repl.apply.adaptiveBatchSize.opsLimit");
+auto& adaptiveThroughput =
+    *MetricBuilder<Atomic64Metric>("repl.apply.adaptiveBatchSize.opsPerSecond");
+auto& adaptiveIncreases = *MetricBuilder<Counter64>("repl.apply.adaptiveBatchSize.increases");
+auto& adaptiveDecreases = *MetricBuilder<Counter64>("repl.apply.adaptiveBatchSize.decreases");
+auto& adaptiveCatchUpBatches =
+    *MetricBuilder<Counter64>("repl.apply.adaptiveBatchSize.catchUpBatches");
+}  // namespace
+
+std::size_t OplogBatchSizeController::getOpsLimit() {
+    auto maxOps = getBatchLimitOplogEntries();
+    if (!replBatchAdaptiveSizing.load()) {
+        return maxOps;
+    }
+
+    stdx::lock_guard<Latch> lk(_mutex);
+    return _opsLimit ? std::min(_opsLimit, maxOps) : maxOps;
+}
+
+void OplogBatchSizeController::onBatchApplied(std::size_t ops,
+                                              Milliseconds duration,
+                                              Milliseconds lag) {
+    if (!replBatchAdaptiveSizing.load()) {
+        return;
+    }
+
+    auto maxOps = getBatchLimitOplogEntries();
+    stdx::lock_guard<Latch> lk(_mutex);
+
+    // Batches cut short by a lack of data or by a command are dominated by their fixed cost, and
+    // would underestimate the throughput.
+    auto currentLimit = _opsLimit ? std::min(_opsLimit, maxOps) : maxOps;
+    if (ops < currentLimit / 2) {
+        return;
+    }
+
+    auto sample = static_cast<double>(ops) / std::max(duration.count(), Milliseconds::rep{1});
+    _opsPerMilli = _opsPerMilli == 0 ? sample : kAlpha * sample + (1 - kAlpha) * _opsPerMilli;
+
+    auto targetMillis = replBatchTargetApplyMillis.load();
+    if (lag >= kCatchUpLag) {
+        targetMillis *= kCatchUpFactor;
+        adaptiveCatchUpBatches.increment();
+    }
+
+    auto newLimit = std::clamp(
+        static_cast<std::size_t>(_opsPerMilli * targetMillis), std::min(kMinOps, maxOps), maxOps);
+    if (newLimit > currentLimit) {
+        adaptiveIncreases.increment();
+    } else if (newLimit < currentLimit) {
+        adaptiveDecreases.increment();
+    }
+    _opsLimit = newLimit;
+
+    adaptiveOpsLimit.set(newLimit);
+    adaptiveThroughput.set(static_cast<int64_t>(_opsPerMilli * 1000));
+}
+
 OplogBatcher::OplogBatcher(OplogApplier* oplogApplier, OplogBuffer* oplogBuffer)
     : _oplogApplier(oplogApplier), _oplogBuffer(oplogBuffer), _ops() {}
 OplogBatcher::~OplogBatcher() {
@@ -357,7 +418,7 @@ void OplogBatcher::_run(StorageInterface* storageInterface) {
         }
 
         // Check the limits once per batch since users can change them at runtime.
-        batchLimits.ops = getBatchLimitOplogEntries();
+        batchLimits.ops = _batchSizeController.getOpsLimit();
 
         // Use the OplogBuffer to populate a local OplogBatch. Note that the buffer may be empty.
         OplogApplierBatch ops;
@@ -440,6 +501,11 @@ void OplogBatcher::_run(StorageInterface* storageInterface) {
             }
         }
 
+        if (_prefetchFn && !ops.empty()) {
+            // Start warming the cache for this batch while the previous one is still applying.
+            _prefetchFn(ops.getBatch());
+        }
+
         stdx::unique_lock<Latch> lk(_mutex);
         // Block until the previous batch has been taken.
         _cv.wait(lk, [&] { return _ops.empty() && !_ops.termWhenExhausted(); });
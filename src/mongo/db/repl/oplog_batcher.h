@@ -32,6 +32,7 @@
 #include <boost/move/utility_core.hpp>
 #include <boost/optional/optional.hpp>
 #include <cstddef>
+#include <functional>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -58,6 +59,46 @@ constexpr std::size_t kMaxPrepareOpsPerBatch = 128;
 
 class OplogApplier;
 
+/**
+ * Sizes the batches of the OplogBatcher from the measured cost of applying them, when
+ * 'replBatchAdaptiveSizing' is enabled.
+ *
+ * The operation limit is set so that a batch applies in about 'replBatchTargetApplyMillis' at the
+ * recently measured throughput. That is large enough to amortize the fixed cost of each batch, and
+ * small enough to keep the visible lag and the memory of a batch bounded. While the node lags by
+ * more than 'kCatchUpLag', batches may take 'kCatchUpFactor' times longer, favoring throughput
+ * until it has caught up. The limit never exceeds 'replBatchLimitOperations'.
+ */
+class OplogBatchSizeController {
+public:
+    static constexpr std::size_t kMinOps = 16;
+    static constexpr Milliseconds kCatchUpLag{Seconds{10}};
+    static constexpr int kCatchUpFactor = 4;
+
+    /**
+     * Returns the maximum number of operations for the next batch.
+     */
+    std::size_t getOpsLimit();
+
+    /**
+     * Records that a batch of 'ops' operations took 'duration' to apply, and that the last of them
+     * was 'lag' behind the wall clock once applied.
+     */
+    void onBatchApplied(std::size_t ops, Milliseconds duration, Milliseconds lag);
+
+private:
+    // Weight of the latest batch in the moving average of the throughput.
+    static constexpr double kAlpha = 0.25;
+
+    Mutex _mutex = MONGO_MAKE_LATCH("OplogBatchSizeController::_mutex");
+
+    // Exponentially weighted moving average of the application throughput, zero until measured.
+    double _opsPerMilli = 0;
+
+    // Limit picked from '_opsPerMilli', zero until measured.
+    std::size_t _opsLimit = 0;
+};
+
 /**
  * Consumes batches of oplog entries from the OplogBuffer to give to the oplog applier, freeing
  * up space for more operations to be fetched from a sync source and allocated onto the OplogBuffer.
@@ -134,6 +175,20 @@ public:
      */
     static std::size_t getOpCount(const OplogEntry& entry);
 
+    OplogBatchSizeController& getBatchSizeController() {
+        return _batchSizeController;
+    }
+
+    /**
+     * Called by the batcher thread with each new batch as soon as it has been built, before
+     * waiting for the applier to take the previous batch. Must be set before startup().
+     */
+    using PrefetchFn = std::function<void(const std::vector<OplogEntry>&)>;
+    void setPrefetchFn(PrefetchFn prefetchFn) {
+        invariant(!_thread);
+        _prefetchFn = std::move(prefetchFn);
+    }
+
 private:
     enum class BatchAction { kContinueBatch, kStartNewBatch, kProcessIndividually };
 
@@ -175,6 +230,10 @@ private:
      */
     OplogApplierBatch _ops;
 
+    OplogBatchSizeController _batchSizeController;
+
+    PrefetchFn _prefetchFn;
+
     std::unique_ptr<stdx::thread> _thread;
 };
 
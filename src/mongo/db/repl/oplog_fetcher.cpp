@@ -50,6 +50,7 @@
 #include "mongo/client/read_preference.h"
 #include "mongo/db/basic_types_gen.h"
 #include "mongo/db/client.h"
+#include "mongo/db/cluster_role.h"
 #include "mongo/db/commands/server_status_metric.h"
 #include "mongo/db/exec/document_value/document.h"
 #include "mongo/db/matcher/matcher.h"
@@ -246,7 +247,8 @@ OplogFetcher::OplogFetcher(executor::TaskExecutor* executor,
       _dataReplicatorExternalState(dataReplicatorExternalState),
       _enqueueDocumentsFn(enqueueDocumentsFn),
       _awaitDataTimeout(calculateAwaitDataTimeout(config.replSetConfig)),
-      _config(std::move(config)) {
+      _config(std::move(config)),
+      _prefetchBatches(oplogFetcherPrefetchBatches) {
     invariant(_config.replSetConfig.isInitialized());
     invariant(!_lastFetched.isNull());
     invariant(onShutdownCallbackFn);
@@ -366,6 +368,11 @@ Milliseconds OplogFetcher::_getRetriedFindMaxTime() const {
 
 void OplogFetcher::_finishCallback(Status status) {
     invariant(isActive());
+
+    // The prefetch thread uses the connection and the cursor, so it must be gone before our owner
+    // learns that the oplog fetcher is done.
+    _stopPrefetching();
+
     // If the oplog fetcher is shutting down, consolidate return code to CallbackCanceled.
     if (_isShuttingDown() && status != ErrorCodes::CallbackCanceled) {
         status = Status(ErrorCodes::CallbackCanceled,
@@ -446,7 +453,11 @@ void OplogFetcher::_runQuery(const executor::TaskExecutor::CallbackArgs& callbac
             return;
         }
 
-        auto batchResult = _getNextBatch();
+        // The first batch of every cursor is read on this thread, so that it is checked against
+        // our oplog before we start reading ahead of it.
+        auto batchResult = (_prefetchBatches > 0 && _cursor && !_firstBatch)
+            ? _getNextPrefetchedBatch()
+            : _getNextBatch();
         if (!batchResult.isOK()) {
             auto brStatus = batchResult.getStatus();
             // Determine if we should stop syncing from our current sync source. If we're going
@@ -484,7 +495,7 @@ void OplogFetcher::_runQuery(const executor::TaskExecutor::CallbackArgs& callbac
             return;
         }
 
-        if (_cursor->isDead()) {
+        if (batchResult.getValue().cursorDead) {
             if (!_cursor->tailable()) {
                 try {
                     auto opCtx = cc().makeOperationContext();
@@ -718,8 +729,8 @@ Status OplogFetcher::_createNewCursor(bool initialFind) {
     return Status::OK();
 }
 
-StatusWith<OplogFetcher::Documents> OplogFetcher::_getNextBatch() {
-    Documents batch;
+StatusWith<OplogFetcher::FetchedBatch> OplogFetcher::_getNextBatch() {
+    FetchedBatch batch;
     try {
         Timer timer;
         if (!_cursor) {
@@ -788,12 +799,15 @@ StatusWith<OplogFetcher::Documents> OplogFetcher::_getNextBatch() {
             _cursor->more();
         }
         while (_cursor->moreInCurrentBatch()) {
-            batch.emplace_back(_cursor->nextSafe());
+            batch.documents.emplace_back(_cursor->nextSafe());
         }
 
         // This value is only used on a successful batch for metrics.repl.network.getmores. This
         // metric intentionally tracks the time taken by the initial find as well.
-        _lastBatchElapsedMS = timer.millis();
+        batch.elapsedMillis = timer.millis();
+        batch.metadataObj = _metadataObj;
+        batch.postBatchResumeToken = _cursor->getPostBatchResumeToken();
+        batch.cursorDead = _cursor->isDead();
     } catch (const DBException& ex) {
         if (_cursor->connectionHasPendingReplies()) {
             // Close the connection because the connection cannot be used anymore as more data is on
@@ -807,7 +821,88 @@ StatusWith<OplogFetcher::Documents> OplogFetcher::_getNextBatch() {
     return batch;
 }
 
-Status OplogFetcher::_onSuccessfulBatch(const Documents& documents) {
+StatusWith<OplogFetcher::FetchedBatch> OplogFetcher::_getNextPrefetchedBatch() {
+    if (!_prefetchThread) {
+        {
+            stdx::lock_guard<Latch> lk(_prefetchMutex);
+            invariant(_prefetchedBatches.empty());
+            _prefetchStopRequested = false;
+        }
+        _prefetchThread = std::make_unique<stdx::thread>([this] { _runPrefetcher(); });
+    }
+
+    boost::optional<StatusWith<FetchedBatch>> batch;
+    {
+        stdx::unique_lock<Latch> lk(_prefetchMutex);
+        // The prefetch thread always hands over a batch or an error eventually: shutting down the
+        // oplog fetcher interrupts the connection it is reading from.
+        _prefetchCondVar.wait(lk, [&] { return !_prefetchedBatches.empty(); });
+        batch.emplace(std::move(_prefetchedBatches.front()));
+        _prefetchedBatches.pop_front();
+    }
+    _prefetchCondVar.notify_all();
+
+    if (!batch->isOK() || batch->getValue().cursorDead) {
+        // This was the last batch the prefetch thread will read, so it has exited or is about to.
+        _prefetchThread->join();
+        _prefetchThread.reset();
+    }
+    return std::move(*batch);
+}
+
+void OplogFetcher::_runPrefetcher() {
+    Client::initThread("OplogFetcherPrefetch",
+                       getGlobalServiceContext()->getService(ClusterRole::ShardServer));
+
+    while (true) {
+        {
+            stdx::unique_lock<Latch> lk(_prefetchMutex);
+            _prefetchCondVar.wait(lk, [&] {
+                return _prefetchStopRequested ||
+                    _prefetchedBatches.size() < static_cast<size_t>(_prefetchBatches);
+            });
+            if (_prefetchStopRequested) {
+                return;
+            }
+        }
+
+        auto batch = _getNextBatch();
+        const bool lastBatch = !batch.isOK() || batch.getValue().cursorDead;
+        {
+            stdx::lock_guard<Latch> lk(_prefetchMutex);
+            _prefetchedBatches.push_back(std::move(batch));
+        }
+        _prefetchCondVar.notify_all();
+
+        if (lastBatch) {
+            return;
+        }
+    }
+}
+
+void OplogFetcher::_stopPrefetching() {
+    if (!_prefetchThread) {
+        return;
+    }
+
+    {
+        stdx::lock_guard<Latch> lk(_prefetchMutex);
+        _prefetchStopRequested = true;
+    }
+    _prefetchCondVar.notify_all();
+
+    // The prefetch thread may be waiting for the sync source to send the next batch.
+    _conn->shutdown();
+
+    _prefetchThread->join();
+    _prefetchThread.reset();
+
+    stdx::lock_guard<Latch> lk(_prefetchMutex);
+    _prefetchedBatches.clear();
+}
+
+Status OplogFetcher::_onSuccessfulBatch(const FetchedBatch& batch) {
+    const auto& documents = batch.documents;
     hangBeforeProcessingSuccessfulBatch.pauseWhileSet();
 
     if (_isShuttingDown()) {
@@ -865,13 +960,13 @@ Status OplogFetcher::_onSuccessfulBatch(const Documents& documents) {
         LOGV2_DEBUG(21271, 2, "Oplog fetcher read 0 operations from remote oplog");
     }
 
-    auto oqMetadataResult = rpc::OplogQueryMetadata::readFromMetadata(_metadataObj);
+    auto oqMetadataResult = rpc::OplogQueryMetadata::readFromMetadata(batch.metadataObj);
     if (!oqMetadataResult.isOK()) {
         LOGV2_ERROR(21278,
                     "Invalid oplog query metadata from sync source",
                     "syncSource"_attr = _config.source,
                     "error"_attr = oqMetadataResult.getStatus(),
-                    "metadata"_attr = _metadataObj);
+                    "metadata"_attr = batch.metadataObj);
         return oqMetadataResult.getStatus();
     }
     const auto& oqMetadata = oqMetadataResult.getValue();
@@ -929,13 +1024,13 @@ Status OplogFetcher::_onSuccessfulBatch(const Documents& documents) {
     // Process replset metadata.  It is important that this happen after we've validated the
     // first batch, so we don't progress our knowledge of the commit point from a
     // response that triggers a rollback.
-    auto metadataResult = rpc::ReplSetMetadata::readFromMetadata(_metadataObj);
+    auto metadataResult = rpc::ReplSetMetadata::readFromMetadata(batch.metadataObj);
     if (!metadataResult.isOK()) {
         LOGV2_ERROR(21279,
                     "Invalid replication metadata from sync source",
                     "syncSource"_attr = _config.source,
                     "error"_attr = metadataResult.getStatus(),
-                    "metadata"_attr = _metadataObj);
+                    "metadata"_attr = batch.metadataObj);
         return metadataResult.getStatus();
     }
     const auto& replSetMetadata = metadataResult.getValue();
@@ -967,12 +1062,12 @@ Status OplogFetcher::_onSuccessfulBatch(const Documents& documents) {
     opsReadStats.increment(info.networkDocumentCount);
     networkByteStats.increment(info.networkDocumentBytes);
 
-    oplogBatchStats.recordMillis(_lastBatchElapsedMS, documents.empty());
+    oplogBatchStats.recordMillis(batch.elapsedMillis, documents.empty());
 
-    if (_cursor->getPostBatchResumeToken()) {
+    if (batch.postBatchResumeToken) {
         auto pbrt =
             ResumeTokenOplogTimestamp::parse(IDLParserContext("OplogFetcher PostBatchResumeToken"),
-                                             *_cursor->getPostBatchResumeToken());
+                                             *batch.postBatchResumeToken);
         info.resumeToken = pbrt.getTs();
     }
 
@@ -1009,7 +1104,11 @@ Status OplogFetcher::_onSuccessfulBatch(const Documents& documents) {
         _lastFetched = lastDocOpTime;
     }
 
-    _firstBatch = false;
+    // Only write this on the transition, since the prefetch thread reads it once the first batch
+    // has been processed.
+    if (_firstBatch) {
+        _firstBatch = false;
+    }
     return Status::OK();
 }
 
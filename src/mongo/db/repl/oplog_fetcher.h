@@ -29,7 +29,9 @@
 
 #pragma once
 
+#include <boost/optional/optional.hpp>
 #include <cstddef>
+#include <deque>
 #include <functional>
 #include <memory>
 #include <string>
@@ -55,6 +57,7 @@
 #include "mongo/executor/task_executor.h"
 #include "mongo/platform/mutex.h"
 #include "mongo/stdx/condition_variable.h"
+#include "mongo/stdx/thread.h"
 #include "mongo/util/duration.h"
 #include "mongo/util/fail_point.h"
 #include "mongo/util/net/hostandport.h"
@@ -335,6 +338,19 @@ protected:
     virtual OpTime _getLastOpTimeFetched() const;
 
 private:
+    /**
+     * A batch read from the sync source along with the reply metadata and cursor state that came
+     * with it. These are captured when the batch is read so that the batch can be processed while
+     * the next one is being read.
+     */
+    struct FetchedBatch {
+        Documents documents;
+        BSONObj metadataObj;
+        boost::optional<BSONObj> postBatchResumeToken;
+        int elapsedMillis = 0;
+        bool cursorDead = false;
+    };
+
     // =============== AbstractAsyncComponent overrides ================
 
     /**
@@ -411,7 +427,28 @@ private:
      * shouldContinue function to see if it should create a new cursor and if so, calls
      * _createNewCursor.
      */
-    StatusWith<Documents> _getNextBatch();
+    StatusWith<FetchedBatch> _getNextBatch();
+
+    /**
+     * Returns the next batch read by the prefetch thread, starting the thread if it is not running.
+     *
+     * The prefetch thread owns the cursor while it runs. It stops after handing over a batch that
+     * ends the stream, either an error or a dead cursor, so that the cursor is back in the hands of
+     * the caller when it has to decide whether to retry.
+     */
+    StatusWith<FetchedBatch> _getNextPrefetchedBatch();
+
+    /**
+     * Body of the prefetch thread. Reads batches until the stream ends or it is asked to stop,
+     * keeping at most oplogFetcherPrefetchBatches of them ahead of the oplog fetcher thread.
+     */
+    void _runPrefetcher();
+
+    /**
+     * Stops the prefetch thread, if running, and discards the batches it read. The connection is
+     * shut down to interrupt the thread if it is still waiting on the network.
+     */
+    void _stopPrefetching();
 
     /**
      * Function called by the oplog fetcher when it gets a successful batch from the sync source.
@@ -419,7 +456,7 @@ private:
      *
      * On failure returns a status that will be passed to _finishCallback.
      */
-    Status _onSuccessfulBatch(const Documents& documents);
+    Status _onSuccessfulBatch(const FetchedBatch& batch);
 
     /**
      * Notifies caller that the oplog fetcher has completed processing operations from the remote
@@ -492,7 +529,8 @@ private:
     // Logical time metadata handling hook for the DBClientConnection.
     std::unique_ptr<rpc::VectorClockMetadataHook> _vectorClockMetadataHook;
 
-    // Set by the ReplyMetadataReader upon receiving a new batch.
+    // Set by the ReplyMetadataReader upon receiving a new batch, and captured into the
+    // FetchedBatch by _getNextBatch.
     BSONObj _metadataObj;
 
     // Connection to the sync source whose oplog we will be querying. This connection should be
@@ -517,7 +555,16 @@ private:
     // Handle to currently scheduled _runQuery task.
     executor::TaskExecutor::CallbackHandle _runQueryHandle;
 
-    int _lastBatchElapsedMS = 0;
+    // Number of batches the prefetch thread may read ahead. Prefetching is disabled when 0.
+    const int _prefetchBatches;
+
+    // Protects the prefetch state below. The prefetch thread handle itself is only touched by the
+    // thread running _runQuery.
+    Mutex _prefetchMutex = MONGO_MAKE_LATCH("OplogFetcher::_prefetchMutex");
+    stdx::condition_variable _prefetchCondVar;
+    std::deque<StatusWith<FetchedBatch>> _prefetchedBatches;
+    bool _prefetchStopRequested = false;
+    std::unique_ptr<stdx::thread> _prefetchThread;
 
     // Condition to be notified on shutdown.
     stdx::condition_variable _shutdownCondVar;
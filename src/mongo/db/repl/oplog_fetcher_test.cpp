@@ -1727,6 +1727,65 @@ TEST_F(OplogFetcherTest, OplogFetcherWorksWithoutExhaust) {
     ASSERT_EQUALS(remoteRBID, shutdownState.getRBID());
 }
 
+TEST_F(OplogFetcherTest, OplogFetcherEnqueuesPrefetchedBatchesInOrder) {
+    // Test that the oplog fetcher processes the batches read by its prefetch thread in order and
+    // finishes successfully when the prefetch thread reports that the cursor is dead.
+    RAIIServerParameterControllerForTest prefetchBatches("oplogFetcherPrefetchBatches", 2);
+
+    OplogFetcher::Documents enqueuedDocuments;
+    enqueueDocumentsFn = [&](OplogFetcher::Documents::const_iterator begin,
+                             OplogFetcher::Documents::const_iterator end,
+                             const OplogFetcher::DocumentsInfo& info) -> Status {
+        enqueuedDocuments.insert(enqueuedDocuments.end(), begin, end);
+        return Status::OK();
+    };
+
+    ShutdownState shutdownState;
+
+    // Create an oplog fetcher with one retry.
+    auto oplogFetcher = getOplogFetcherAfterConnectionCreated(std::ref(shutdownState), 1);
+
+    CursorId cursorId = 22LL;
+    auto firstEntry = makeNoopOplogEntry(lastFetched);
+    auto secondEntry = makeNoopOplogEntry({{Seconds(124), 0}, lastFetched.getTerm()});
+    auto thirdEntry = makeNoopOplogEntry({{Seconds(125), 0}, lastFetched.getTerm()});
+    auto fourthEntry = makeNoopOplogEntry({{Seconds(126), 0}, lastFetched.getTerm()});
+    auto fifthEntry = makeNoopOplogEntry({{Seconds(127), 0}, lastFetched.getTerm()});
+    auto metadataObj = makeOplogBatchMetadata(replSetMetadata, oqMetadata);
+
+    // The first batch is processed before the prefetch thread starts, which then blocks on the
+    // first getMore.
+    processSingleRequestResponse(oplogFetcher->getDBClientConnection_forTest(),
+                                 makeFirstBatch(cursorId, {firstEntry, secondEntry}, metadataObj),
+                                 true);
+    ASSERT_EQ(1U, enqueuedDocuments.size());
+
+    auto secondBatch = {thirdEntry, fourthEntry};
+    auto m = processSingleRequestResponse(
+        oplogFetcher->getDBClientConnection_forTest(),
+        makeSubsequentBatch(cursorId, secondBatch, metadataObj, true /* moreToCome */),
+        true);
+    validateGetMoreCommand(m,
+                           cursorId,
+                           durationCount<Milliseconds>(oplogFetcher->getAwaitDataTimeout_forTest()),
+                           dataReplicatorExternalState->getCurrentTermAndLastCommittedOpTime());
+
+    // The oplog fetcher shuts down after this batch because the cursor id is 0.
+    processSingleExhaustResponse(
+        oplogFetcher->getDBClientConnection_forTest(),
+        makeSubsequentBatch(0LL, {fifthEntry}, metadataObj, false /* moreToCome */));
+    oplogFetcher->join();
+
+    ASSERT_OK(shutdownState.getStatus());
+    ASSERT_EQ(4U, enqueuedDocuments.size());
+    ASSERT_BSONOBJ_EQ(secondEntry, enqueuedDocuments[0]);
+    ASSERT_BSONOBJ_EQ(thirdEntry, enqueuedDocuments[1]);
+    ASSERT_BSONOBJ_EQ(fourthEntry, enqueuedDocuments[2]);
+    ASSERT_BSONOBJ_EQ(fifthEntry, enqueuedDocuments[3]);
+    ASSERT_EQUALS(fifthEntry["ts"].timestamp(),
+                  oplogFetcher->getLastOpTimeFetched_forTest().getTimestamp());
+}
+
 TEST_F(OplogFetcherTest, CursorIsDeadShutsDownOplogFetcherWithSuccessfulStatus) {
     ShutdownState shutdownState;
 
@@ -0,0 +1,154 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/db/repl/oplog_prefetcher.h"
+
+#include <utility>
+
+#include "mongo/base/counter.h"
+#include "mongo/base/status.h"
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/db/admission/execution_admission_context.h"
+#include "mongo/db/client.h"
+#include "mongo/db/commands/server_status_metric.h"
+#include "mongo/db/db_raii.h"
+#include "mongo/db/dbhelpers.h"
+#include "mongo/db/namespace_string.h"
+#include "mongo/db/record_id.h"
+#include "mongo/db/repl/oplog_applier.h"
+#include "mongo/db/storage/snapshot.h"
+#include "mongo/util/assert_util.h"
+#include "mongo/util/concurrency/admission_context.h"
+#include "mongo/util/scopeguard.h"
+
+namespace mongo {
+namespace repl {
+namespace {
+
+auto& prefetchedOps = *MetricBuilder<Counter64>("repl.apply.prefetch.ops");
+auto& skippedOps = *MetricBuilder<Counter64>("repl.apply.prefetch.skipped");
+
+NamespaceStringOrUUID targetOf(const OplogEntry& op) {
+    if (op.getUuid()) {
+        return {op.getNss().dbName(), *op.getUuid()};
+    }
+    return op.getNss();
+}
+
+bool sameTarget(const OplogEntry& a, const OplogEntry& b) {
+    return a.getUuid() == b.getUuid() && a.getNss() == b.getNss();
+}
+
+}  // namespace
+
+OplogPrefetcher::OplogPrefetcher(int threadCount, int maxPendingOps)
+    : _maxPendingOps(maxPendingOps),
+      _pool(makeReplWriterPool(threadCount, "ReplPrefetchWorker"_sd)) {}
+
+OplogPrefetcher::~OplogPrefetcher() {
+    _pool->shutdown();
+    _pool->join();
+}
+
+std::size_t OplogPrefetcher::prefetch(const std::vector<OplogEntry>& ops) {
+    const long long budget = _maxPendingOps - _pendingOps.load();
+    std::size_t scheduled = 0;
+    std::size_t skipped = 0;
+
+    const OplogEntry* groupOp = nullptr;
+    std::vector<BSONObj> ids;
+    auto flush = [&] {
+        if (ids.empty()) {
+            return;
+        }
+        _pendingOps.addAndFetch(ids.size());
+        _pool->schedule(
+            [this, nsOrUUID = targetOf(*groupOp), ids = std::move(ids)](Status status) {
+                ON_BLOCK_EXIT([&] { _pendingOps.subtractAndFetch(ids.size()); });
+                if (!status.isOK()) {
+                    return;
+                }
+
+                auto opCtx = cc().makeOperationContext();
+                ScopedAdmissionPriority<ExecutionAdmissionContext> priority(
+                    opCtx.get(), AdmissionContext::Priority::kExempt);
+                try {
+                    _prefetchDocuments(opCtx.get(), nsOrUUID, ids);
+                } catch (const DBException&) {
+                    // Prefetching is best effort. Any real problem with the collection surfaces
+                    // when the batch is applied.
+                }
+            });
+        ids.clear();
+    };
+
+    for (const auto& op : ops) {
+        const auto opType = op.getOpType();
+        if (opType != OpTypeEnum::kUpdate && opType != OpTypeEnum::kDelete) {
+            continue;
+        }
+        if (static_cast<long long>(scheduled) >= budget) {
+            ++skipped;
+            continue;
+        }
+
+        if (!groupOp || !sameTarget(*groupOp, op) || ids.size() >= kMaxIdsPerTask) {
+            flush();
+            groupOp = &op;
+        }
+        ids.push_back(BSON("_id" << op.getIdElement()));
+        ++scheduled;
+    }
+    flush();
+
+    prefetchedOps.increment(scheduled);
+    skippedOps.increment(skipped);
+    return scheduled;
+}
+
+void OplogPrefetcher::_prefetchDocuments(OperationContext* opCtx,
+                                         const NamespaceStringOrUUID& nsOrUUID,
+                                         const std::vector<BSONObj>& ids) {
+    AutoGetCollectionForRead collection(opCtx, nsOrUUID);
+    if (!collection) {
+        return;
+    }
+
+    for (const auto& id : ids) {
+        const RecordId rid = Helpers::findById(opCtx, *collection, id);
+        if (rid.isNull()) {
+            continue;
+        }
+        Snapshotted<BSONObj> doc;
+        collection->findDoc(opCtx, rid, &doc);
+    }
+}
+
+}  // namespace repl
+}  // namespace mongo
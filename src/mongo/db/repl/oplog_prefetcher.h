@@ -0,0 +1,101 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "mongo/db/operation_context.h"
+#include "mongo/db/repl/oplog_entry.h"
+#include "mongo/platform/atomic_word.h"
+#include "mongo/util/concurrency/thread_pool.h"
+
+namespace mongo {
+namespace repl {
+
+/**
+ * Warms the storage engine cache for an upcoming oplog batch on secondaries. For every update and
+ * delete in the batch, a task on a small, dedicated thread pool looks up the target document
+ * through the _id index and reads it, so that the writer threads find those pages in cache when
+ * the batch is applied.
+ *
+ * Prefetching is best effort: failed lookups are ignored, and once 'maxPendingOps' entries are
+ * queued, further entries are not prefetched until the queue drains.
+ */
+class OplogPrefetcher {
+    OplogPrefetcher(const OplogPrefetcher&) = delete;
+    OplogPrefetcher& operator=(const OplogPrefetcher&) = delete;
+
+public:
+    // The maximum number of _id lookups performed by a single prefetch task.
+    static constexpr std::size_t kMaxIdsPerTask = 64;
+
+    OplogPrefetcher(int threadCount, int maxPendingOps);
+
+    /**
+     * Shuts down and joins the thread pool. Pending prefetch tasks are dropped.
+     */
+    ~OplogPrefetcher();
+
+    /**
+     * Schedules prefetch tasks for the update and delete entries in 'ops'. Does not block.
+     * Returns the number of entries that were scheduled.
+     */
+    std::size_t prefetch(const std::vector<OplogEntry>& ops);
+
+    /**
+     * Returns the number of entries that are scheduled but not yet prefetched.
+     */
+    long long getPendingOps() const {
+        return _pendingOps.load();
+    }
+
+    void waitForIdle_forTest() {
+        _pool->waitForIdle();
+    }
+
+private:
+    /**
+     * Looks up each _id in 'ids' on the collection 'nsOrUUID' and reads the matching document.
+     */
+    void _prefetchDocuments(OperationContext* opCtx,
+                            const NamespaceStringOrUUID& nsOrUUID,
+                            const std::vector<BSONObj>& ids);
+
+    const long long _maxPendingOps;
+
+    AtomicWord<long long> _pendingOps{0};
+
+    std::unique_ptr<ThreadPool> _pool;
+};
+
+}  // namespace repl
+}  // namespace mongo
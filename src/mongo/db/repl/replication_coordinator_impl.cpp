@@ -44,6 +44,7 @@
 #include <iterator>
 #include <ostream>
 #include <type_traits>
+#include <utility>
 #include <variant>
 
 #include "mongo/base/status.h"
@@ -265,24 +266,67 @@ void ReplicationCoordinatorImpl::WaiterList::_updateMetric_inlock() {
     _waiterCountMetric.set(_waiters.size());
 }
 
-void ReplicationCoordinatorImpl::WaiterList::add_inlock(const OpTime& opTime,
-                                                        SharedWaiterHandle waiter) {
+namespace {
+// Returns whether two waiters wait on the same condition, such that the one with the earlier
+// opTime is ready whenever the other one is.
+bool sameWriteConcern(const boost::optional<WriteConcernOptions>& a,
+                      const boost::optional<WriteConcernOptions>& b) {
+    if (!a || !b) {
+        return !a && !b;
+    }
+    return a->w == b->w && a->syncMode == b->syncMode && a->checkCondition == b->checkCondition;
+}
+}  // namespace
+
+void ReplicationCoordinatorImpl::WaiterList::_add_inlock(const OpTime& opTime,
+                                                         SharedWaiterHandle waiter) {
+    auto it = std::find_if(_writeConcernCounts.begin(), _writeConcernCounts.end(), [&](auto& c) {
+        return sameWriteConcern(c.first, waiter->writeConcern);
+    });
+    if (it == _writeConcernCounts.end()) {
+        _writeConcernCounts.emplace_back(waiter->writeConcern, 1);
+    } else {
+        ++it->second;
+    }
     _waiters.emplace(opTime, std::move(waiter));
     _updateMetric_inlock();
 }
 
+ReplicationCoordinatorImpl::WaiterList::WaiterMap::iterator
+ReplicationCoordinatorImpl::WaiterList::_erase_inlock(WaiterMap::iterator it) {
+    auto countIt =
+        std::find_if(_writeConcernCounts.begin(), _writeConcernCounts.end(), [&](auto& c) {
+            return sameWriteConcern(c.first, it->second->writeConcern);
+        });
+    invariant(countIt != _writeConcernCounts.end());
+    if (--countIt->second == 0) {
+        _writeConcernCounts.erase(countIt);
+    }
+    return _waiters.erase(it);
+}
+
+void ReplicationCoordinatorImpl::WaiterList::_clear_inlock() {
+    _waiters.clear();
+    _writeConcernCounts.clear();
+    _updateMetric_inlock();
+}
+
+void ReplicationCoordinatorImpl::WaiterList::add_inlock(const OpTime& opTime,
+                                                        SharedWaiterHandle waiter) {
+    _add_inlock(opTime, std::move(waiter));
+}
+
 SharedSemiFuture<void> ReplicationCoordinatorImpl::WaiterList::add_inlock(
     const OpTime& opTime, boost::optional<WriteConcernOptions> wc) {
     auto pf = makePromiseFuture<void>();
-    _waiters.emplace(opTime, std::make_shared<Waiter>(std::move(pf.promise), std::move(wc)));
-    _updateMetric_inlock();
+    _add_inlock(opTime, std::make_shared<Waiter>(std::move(pf.promise), std::move(wc)));
     return std::move(pf.future);
 }
 
 bool ReplicationCoordinatorImpl::WaiterList::remove_inlock(SharedWaiterHandle waiter) {
     for (auto iter = _waiters.begin(); iter != _waiters.end(); iter++) {
         if (iter->second == waiter) {
-            _waiters.erase(iter);
+            _erase_inlock(iter);
             _updateMetric_inlock();
             return true;
         }
@@ -298,13 +342,58 @@ void ReplicationCoordinatorImpl::WaiterList::setValueIf_inlock(Func&& func,
         try {
             if (func(it->first, waiter)) {
                 waiter->promise.emplaceValue();
-                it = _waiters.erase(it);
+                it = _erase_inlock(it);
+            } else {
+                ++it;
+            }
+        } catch (const DBException& e) {
+            waiter->promise.setError(e.toStatus());
+            it = _erase_inlock(it);
+        }
+    }
+    _updateMetric_inlock();
+}
+
+template <typename Func>
+void ReplicationCoordinatorImpl::WaiterList::setValueIfReady_inlock(
+    Func&& func,
+    boost::optional<OpTime> opTime,
+    std::vector<SharedWaiterHandle>* readyWaiters) {
+    // Write concerns with a waiter that is not ready yet. Waiters that wait on a config condition
+    // rather than an opTime are always checked.
+    std::vector<const boost::optional<WriteConcernOptions>*> blocked;
+    auto isBlocked = [&](const SharedWaiterHandle& waiter) {
+        return std::any_of(blocked.begin(), blocked.end(), [&](auto* wc) {
+            return sameWriteConcern(*wc, waiter->writeConcern);
+        });
+    };
+
+    for (auto it = _waiters.begin(); it != _waiters.end() && (!opTime || it->first <= *opTime) &&
+         blocked.size() < _writeConcernCounts.size();) {
+        auto waiter = it->second;
+        if (isBlocked(waiter)) {
+            ++it;
+            continue;
+        }
+        try {
+            if (func(it->first, waiter)) {
+                it = _erase_inlock(it);
+                if (readyWaiters) {
+                    readyWaiters->push_back(std::move(waiter));
+                } else {
+                    waiter->promise.emplaceValue();
+                }
             } else {
+                if (!waiter->writeConcern ||
+                    waiter->writeConcern->checkCondition ==
+                        WriteConcernOptions::CheckCondition::OpTime) {
+                    blocked.push_back(&waiter->writeConcern);
+                }
                 ++it;
             }
         } catch (const DBException& e) {
             waiter->promise.setError(e.toStatus());
-            it = _waiters.erase(it);
+            it = _erase_inlock(it);
         }
     }
     _updateMetric_inlock();
@@ -314,8 +403,7 @@ void ReplicationCoordinatorImpl::WaiterList::setValueAll_inlock() {
     for (auto& [opTime, waiter] : _waiters) {
         waiter->promise.emplaceValue();
     }
-    _waiters.clear();
-    _updateMetric_inlock();
+    _clear_inlock();
 }
 
 void ReplicationCoordinatorImpl::WaiterList::setErrorAll_inlock(Status status) {
@@ -323,8 +411,7 @@ void ReplicationCoordinatorImpl::WaiterList::setErrorAll_inlock(Status status) {
     for (auto& [opTime, waiter] : _waiters) {
         waiter->promise.setError(status);
     }
-    _waiters.clear();
-    _updateMetric_inlock();
+    _clear_inlock();
 }
 
 namespace {
@@ -5334,12 +5421,13 @@ ReplicationCoordinatorImpl::_setCurrentRSConfig(WithLock lk,
 }
 
 void ReplicationCoordinatorImpl::_wakeReadyWaiters(WithLock lk, boost::optional<OpTime> opTime) {
-    _replicationWaiterList.setValueIf_inlock(
+    _replicationWaiterList.setValueIfReady_inlock(
         [this](const OpTime& opTime, const SharedWaiterHandle& waiter) {
             invariant(waiter->writeConcern);
             return _doneWaitingForReplication_inlock(opTime, waiter->writeConcern.value());
         },
-        opTime);
+        opTime,
+        _deferReplicationWaiterWakeups ? &_readyReplicationWaiters : nullptr);
 }
 
 Status ReplicationCoordinatorImpl::processReplSetUpdatePosition(const UpdatePositionArgs& updates) {
@@ -5358,15 +5446,34 @@ Status ReplicationCoordinatorImpl::processReplSetUpdatePosition(const UpdatePosi
         maxRemoteOpTime = std::max(maxRemoteOpTime, statusWithOpTime.getValue());
         gotValidUpdate = true;
     }
+
+    // A position update can satisfy many write concern waiters at once. Collect them and fulfill
+    // their promises after releasing _mutex, so that waking them does not extend the critical
+    // section.
+    _deferReplicationWaiterWakeups = true;
+    ScopeGuard wakeOnError([&] {
+        _deferReplicationWaiterWakeups = false;
+        for (const auto& waiter : std::exchange(_readyReplicationWaiters, {})) {
+            waiter->promise.emplaceValue();
+        }
+    });
     _updateStateAfterRemoteOpTimeUpdates(lock, maxRemoteOpTime);
+    wakeOnError.dismiss();
+    _deferReplicationWaiterWakeups = false;
+    auto readyWaiters = std::exchange(_readyReplicationWaiters, {});
+
+    // If we become primary after the unlock below, the forwardSecondaryProgress will do nothing
+    // (slightly expensively).  If we become secondary after the unlock below, BackgroundSync
+    // will take care of forwarding our progress by calling signalUpstreamUpdater() once we
+    // select a new sync source.  So it's OK to depend on the stale value of wasPrimary here.
+    const bool wasPrimary = _getMemberState_inlock().primary();
+    lock.unlock();
+
+    for (const auto& waiter : readyWaiters) {
+        waiter->promise.emplaceValue();
+    }
 
     if (gotValidUpdate) {
-        // If we become primary after the unlock below, the forwardSecondaryProgress will do nothing
-        // (slightly expensively).  If we become secondary after the unlock below, BackgroundSync
-        // will take care of forwarding our progress by calling signalUpstreamUpdater() once we
-        // select a new sync source.  So it's OK to depend on the stale value of wasPrimary here.
-        bool wasPrimary = _getMemberState_inlock().primary();
-        lock.unlock();
         // maxRemoteOpTime is null here if we got valid updates but no downstream node had
         // actually advanced any optime.
         if (!maxRemoteOpTime.isNull())
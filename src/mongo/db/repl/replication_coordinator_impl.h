@@ -857,6 +857,14 @@ private:
         // condition in func.
         template <typename Func>
         void setValueIf_inlock(Func&& func, boost::optional<OpTime> opTime = boost::none);
+        // Like setValueIf_inlock, but assumes that waiters with the same write concern become
+        // ready in OpTime order: once one of them does not satisfy func, later ones are skipped,
+        // so the cost is proportional to the number of ready waiters. If 'readyWaiters' is given,
+        // ready waiters are removed and appended to it instead of having their promises fulfilled.
+        template <typename Func>
+        void setValueIfReady_inlock(Func&& func,
+                                    boost::optional<OpTime> opTime,
+                                    std::vector<SharedWaiterHandle>* readyWaiters = nullptr);
         // Signals all waiters from the list and fulfills promises with OK status.
         void setValueAll_inlock();
         // Signals all waiters from the list and fulfills promises with Error status.
@@ -865,8 +873,16 @@ private:
     private:
         void _updateMetric_inlock();
 
+        using WaiterMap = std::multimap<OpTime, SharedWaiterHandle>;
+        void _add_inlock(const OpTime& opTime, SharedWaiterHandle waiter);
+        WaiterMap::iterator _erase_inlock(WaiterMap::iterator it);
+        void _clear_inlock();
+
         // Waiters sorted by OpTime.
-        std::multimap<OpTime, SharedWaiterHandle> _waiters;
+        WaiterMap _waiters;
+        // The number of waiters in _waiters for each distinct write concern, as compared by
+        // setValueIfReady_inlock.
+        std::vector<std::pair<boost::optional<WriteConcernOptions>, size_t>> _writeConcernCounts;
         // We keep a separate count outside _waiters.size() in order to avoid having to
         // take a lock to read the metric.
         Atomic64Metric& _waiterCountMetric;
@@ -1817,6 +1833,12 @@ private:
     // avoid checking all waiters in the list on every write.
     WaiterList _replicationWaiterList;  // (M)
 
+    // While set, _wakeReadyWaiters moves ready replication waiters into _readyReplicationWaiters
+    // rather than fulfilling them, so that processReplSetUpdatePosition can wake them all after
+    // releasing _mutex.
+    bool _deferReplicationWaiterWakeups = false;               // (M)
+    std::vector<SharedWaiterHandle> _readyReplicationWaiters;  // (M)
+
     // list of information about clients waiting for a particular lastApplied opTime.
     // Waiters in this list are checked and notified on self's lastApplied opTime updates.
     WaiterList _lastAppliedOpTimeWaiterList;  // (M)
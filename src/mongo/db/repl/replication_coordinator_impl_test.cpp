@@ -1174,6 +1174,54 @@ TEST_F(ReplCoordTest, NodeReturnsOkWhenAWriteConcernWithNoTimeoutHasBeenSatisfie
     awaiter.reset();
 }
 
+TEST_F(ReplCoordTest, WaiterBlockedOnOneWriteConcernDoesNotDelayLaterWaitersOnAnother) {
+    assertStartSuccess(BSON("_id"
+                            << "mySet"
+                            << "version" << 2 << "members"
+                            << BSON_ARRAY(BSON("host"
+                                               << "node1:12345"
+                                               << "_id" << 0)
+                                          << BSON("host"
+                                                  << "node2:12345"
+                                                  << "_id" << 1)
+                                          << BSON("host"
+                                                  << "node3:12345"
+                                                  << "_id" << 2))),
+                       HostAndPort("node1", 12345));
+    ASSERT_OK(getReplCoord()->setFollowerMode(MemberState::RS_SECONDARY));
+    replCoordSetMyLastWrittenAndAppliedAndDurableOpTime(OpTimeWithTermOne(100, 1),
+                                                        Date_t() + Seconds(100));
+    simulateSuccessfulV1Election();
+
+    OpTimeWithTermOne time1(100, 1);
+    OpTimeWithTermOne time2(100, 2);
+    replCoordSetMyLastWrittenAndAppliedAndDurableOpTime(time2, Date_t() + Seconds(100));
+
+    WriteConcernOptions writeConcernAll;
+    writeConcernAll.wTimeout = WriteConcernOptions::kNoTimeout;
+    writeConcernAll.w = 3;
+    WriteConcernOptions writeConcernTwo = writeConcernAll;
+    writeConcernTwo.w = 2;
+
+    // The earlier waiter needs all three nodes, the later one only two.
+    ReplicationAwaiter awaiterAll(getReplCoord(), getServiceContext());
+    awaiterAll.setOpTime(time1);
+    awaiterAll.setWriteConcern(writeConcernAll);
+    awaiterAll.start();
+    ReplicationAwaiter awaiterTwo(getReplCoord(), getServiceContext());
+    awaiterTwo.setOpTime(time2);
+    awaiterTwo.setWriteConcern(writeConcernTwo);
+    awaiterTwo.start();
+
+    ASSERT_OK(getReplCoord()->setLastAppliedOptime_forTest(2, 1, time2));
+    ASSERT_OK(awaiterTwo.getResult().status);
+    awaiterTwo.reset();
+
+    ASSERT_OK(getReplCoord()->setLastAppliedOptime_forTest(2, 2, time1));
+    ASSERT_OK(awaiterAll.getResult().status);
+    awaiterAll.reset();
+}
+
 
 TEST_F(ReplCoordTest, NodeCalculatesDefaultWriteConcernOnStartupExistingLocalConfigMajority) {
     assertStartSuccess(BSON("_id"
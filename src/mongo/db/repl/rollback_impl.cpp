@@ -40,8 +40,10 @@
 #include <cstdint>
 #include <fmt/format.h>
 #include <limits>
+#include <functional>
 #include <memory>
 #include <mutex>
+#include <tuple>
 #include <utility>
 
 #include <boost/move/utility_core.hpp>
@@ -117,10 +119,13 @@
 #include "mongo/logv2/redaction.h"
 #include "mongo/platform/atomic_word.h"
 #include "mongo/platform/compiler.h"
+#include "mongo/platform/mutex.h"
 #include "mongo/s/catalog/type_config_version.h"
 #include "mongo/s/database_version.h"
 #include "mongo/s/shard_version.h"
 #include "mongo/util/clock_source.h"
+#include "mongo/util/concurrency/thread_name.h"
+#include "mongo/util/concurrency/thread_pool.h"
 #include "mongo/util/duration.h"
 #include "mongo/util/fail_point.h"
 #include "mongo/util/namespace_string_util.h"
@@ -128,6 +133,7 @@
 #include "mongo/util/scopeguard.h"
 #include "mongo/util/str.h"
 #include "mongo/util/string_map.h"
+#include "mongo/util/timer.h"
 
 #define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kReplicationRollback
 
@@ -754,8 +760,10 @@ void RollbackImpl::_runPhaseFromAbortToReconstructPreparedTxns(
 void RollbackImpl::_correctRecordStoreCounts(OperationContext* opCtx) {
     // This function explicitly does not check for shutdown since a clean shutdown post oplog
     // truncation is not allowed to occur until the record store counts are corrected.
-    auto catalog = CollectionCatalog::get(opCtx);
-    for (const auto& uiCount : _newCounts) {
+    const std::vector<std::pair<UUID, long long>> newCounts(_newCounts.begin(), _newCounts.end());
+    auto correctCount = [&](OperationContext* opCtx, size_t i) {
+        auto catalog = CollectionCatalog::get(opCtx);
+        const auto& uiCount = newCounts[i];
         const auto uuid = uiCount.first;
         const auto coll = catalog->lookupCollectionByUUID(opCtx, uuid);
         invariant(coll,
@@ -783,7 +791,7 @@ void RollbackImpl::_correctRecordStoreCounts(OperationContext* opCtx) {
                 logAttrs(nss),
                 "uuid"_attr = uuid.toString(),
                 "ident"_attr = ident);
-            continue;
+            return;
         }
 
         // If _findRecordStoreCounts() is unable to determine the correct count from the oplog
@@ -817,7 +825,7 @@ void RollbackImpl::_correctRecordStoreCounts(OperationContext* opCtx) {
                               "uuid"_attr = uuid.toString(),
                               "ident"_attr = ident,
                               "error"_attr = exec->stateToStr(state));
-                continue;
+                return;
             }
             newCount = countFromScan;
         }
@@ -842,7 +850,8 @@ void RollbackImpl::_correctRecordStoreCounts(OperationContext* opCtx) {
                         "ident"_attr = ident,
                         "newCount"_attr = newCount);
         }
-    }
+    };
+    _runOnWorkers(opCtx, "correct record store counts"_sd, newCounts.size(), correctCount);
 }
 
 Status RollbackImpl::_findRecordStoreCounts(OperationContext* opCtx) {
@@ -1322,6 +1331,7 @@ boost::optional<BSONObj> RollbackImpl::_findDocumentById(OperationContext* opCtx
 Status RollbackImpl::_writeRollbackFiles(OperationContext* opCtx) {
     auto catalog = CollectionCatalog::get(opCtx);
     auto storageEngine = opCtx->getServiceContext()->getStorageEngine();
+    std::vector<std::tuple<UUID, NamespaceString, const SimpleBSONObjUnorderedSet*>> namespaces;
     for (auto&& entry : _observerInfo.rollbackDeletedIdsMap) {
         const auto& uuid = entry.first;
         const auto nss = catalog->lookupNSSByUUID(opCtx, uuid);
@@ -1340,9 +1350,15 @@ Status RollbackImpl::_writeRollbackFiles(OperationContext* opCtx) {
                   str::stream() << "The collection with UUID " << uuid
                                 << " is unexpectedly missing in the CollectionCatalog");
 
-        _writeRollbackFileForNamespace(opCtx, uuid, *nss, entry.second);
+        namespaces.emplace_back(uuid, *nss, &entry.second);
     }
 
+    auto writeRollbackFile = [&](OperationContext* opCtx, size_t i) {
+        const auto& [uuid, nss, idSet] = namespaces[i];
+        _writeRollbackFileForNamespace(opCtx, uuid, nss, *idSet);
+    };
+    _runOnWorkers(opCtx, "write rollback files"_sd, namespaces.size(), writeRollbackFile);
+
     return Status::OK();
 }
 
@@ -1369,6 +1385,7 @@ void RollbackImpl::_writeRollbackFileForNamespace(OperationContext* opCtx,
     // If this is the first data directory created, we save the full directory path in
     // _rollbackStats. Otherwise, we store the longest common prefix of the two directories.
     const auto& newDirectoryPath = removeSaver.root().generic_string();
+    stdx::unique_lock<Latch> lk(_workersMutex);
     if (!_rollbackStats.rollbackDataFileDirectory) {
         _rollbackStats.rollbackDataFileDirectory = newDirectoryPath;
     } else {
@@ -1380,6 +1397,7 @@ void RollbackImpl::_writeRollbackFileForNamespace(OperationContext* opCtx,
                                     .first;
         _rollbackStats.rollbackDataFileDirectory = std::string(newDirectoryPath.begin(), prefixEnd);
     }
+    lk.unlock();
 
     for (auto&& id : idSet) {
         // StorageInterface::findById() does not respect the collation, but because we are using
@@ -1390,9 +1408,86 @@ void RollbackImpl::_writeRollbackFileForNamespace(OperationContext* opCtx,
             fassert(50750, removeSaver.goingToDelete(*document));
         }
     }
+
+    lk.lock();
     _listener->onRollbackFileWrittenForNamespace(std::move(uuid), std::move(nss));
 }
 
+void RollbackImpl::_runOnWorkers(OperationContext* opCtx,
+                                 StringData phase,
+                                 size_t numTasks,
+                                 std::function<void(OperationContext*, size_t)> task) {
+    const auto threadCount =
+        std::min(static_cast<size_t>(gRollbackWorkerThreadCount.load()), numTasks);
+    const auto progressInterval = std::max(numTasks / 10, size_t(1));
+    LOGV2(9156626,
+          "Starting rollback phase",
+          "phase"_attr = phase,
+          "tasks"_attr = numTasks,
+          "threads"_attr = threadCount);
+
+    Timer timer;
+    AtomicWord<size_t> completed{0};
+    auto onTaskDone = [&] {
+        const auto done = completed.addAndFetch(1);
+        if (done % progressInterval == 0 && done < numTasks) {
+            LOGV2(9156627,
+                  "Rollback phase progress",
+                  "phase"_attr = phase,
+                  "completed"_attr = done,
+                  "tasks"_attr = numTasks);
+        }
+    };
+
+    if (threadCount <= 1) {
+        for (size_t i = 0; i < numTasks; ++i) {
+            task(opCtx, i);
+            onTaskDone();
+        }
+    } else {
+        ThreadPool::Options options;
+        options.threadNamePrefix = "RollbackWorker-";
+        options.poolName = "RollbackWorkerThreadPool";
+        options.maxThreads = threadCount;
+        options.onCreateThread = [](const std::string&) {
+            Client::initThread(getThreadName(),
+                               getGlobalServiceContext()->getService(ClusterRole::ShardServer));
+            stdx::lock_guard<Client> lk(cc());
+            cc().setSystemOperationUnkillableByStepdown(lk);
+        };
+        ThreadPool pool(options);
+        pool.startup();
+
+        Mutex errorMutex = MONGO_MAKE_LATCH("RollbackImpl::_runOnWorkers::errorMutex");
+        Status firstError = Status::OK();
+        for (size_t i = 0; i < numTasks; ++i) {
+            pool.schedule([&, i](Status scheduleStatus) {
+                invariant(scheduleStatus);
+                try {
+                    auto workerOpCtx = cc().makeOperationContext();
+                    task(workerOpCtx.get(), i);
+                } catch (const DBException& ex) {
+                    stdx::lock_guard<Latch> lk(errorMutex);
+                    if (firstError.isOK()) {
+                        firstError = ex.toStatus();
+                    }
+                }
+                onTaskDone();
+            });
+        }
+        pool.waitForIdle();
+        pool.shutdown();
+        pool.join();
+        uassertStatusOK(firstError);
+    }
+
+    LOGV2(9156628,
+          "Finished rollback phase",
+          "phase"_attr = phase,
+          "tasks"_attr = numTasks,
+          "durationMillis"_attr = timer.millis());
+}
+
 Timestamp RollbackImpl::_recoverToStableTimestamp(OperationContext* opCtx) {
     // Recover to the stable timestamp while holding the global exclusive lock. This may throw,
     // which the caller must handle.
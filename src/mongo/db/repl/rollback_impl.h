@@ -38,6 +38,7 @@
 
 #include "mongo/base/status.h"
 #include "mongo/base/status_with.h"
+#include "mongo/base/string_data.h"
 #include "mongo/bson/bsonelement.h"
 #include "mongo/bson/bsonobj.h"
 #include "mongo/bson/simple_bsonobj_comparator.h"
@@ -436,6 +437,17 @@ private:
      */
     void _correctRecordStoreCounts(OperationContext* opCtx);
 
+    /**
+     * Runs 'task' for each index in [0, numTasks) and waits for all of them to finish, logging
+     * the progress of 'phase'. Tasks run on up to rollbackWorkerThreadCount threads, each with its
+     * own OperationContext, or inline on 'opCtx' when there is only one thread. Throws the first
+     * error raised by a task.
+     */
+    void _runOnWorkers(OperationContext* opCtx,
+                       StringData phase,
+                       size_t numTasks,
+                       std::function<void(OperationContext*, size_t)> task);
+
     /**
      * Called after we have successfully recovered to the stable timestamp and recovered from the
      * oplog. Triggers the replication rollback OpObserver method, notifying other server subsystems
@@ -512,6 +524,10 @@ private:
     // Holds information about this rollback event.
     RollbackStats _rollbackStats;  // (N)
 
+    // Serializes the updates to _rollbackStats and the calls to _listener made by the rollback
+    // workers.
+    Mutex _workersMutex = MONGO_MAKE_LATCH("RollbackImpl::_workersMutex");  // (S)
+
     // Maintains a count of the difference between the count of the record store pointed to by the
     // UUID before recover to a stable timestamp is called and the count after we recover from the
     // oplog. This only must keep track of inserts and deletes. Rolling back drops is just a rename
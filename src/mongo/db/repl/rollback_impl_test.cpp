@@ -1439,6 +1439,35 @@ TEST_F(RollbackImplTest, RollbackSetsMultipleCollectionCounts) {
     ASSERT_EQ(_storageInterface->getFinalCollectionCount(uuid2), 2);
 }
 
+TEST_F(RollbackImplTest, RollbackCorrectsCountsOfManyCollectionsOnWorkerThreads) {
+    RAIIServerParameterControllerForTest workerThreads("rollbackWorkerThreadCount", 4);
+    _storageInterface->setStableTimestamp(nullptr, Timestamp(1, 1));
+
+    const auto commonOp = makeOpAndRecordId(1);
+    _remoteOplog->setOperations({commonOp});
+    ASSERT_OK(_insertOplogEntry(commonOp.first));
+
+    std::vector<UUID> uuids;
+    for (int i = 0; i < 8; ++i) {
+        const auto uuid = UUID::gen();
+        const auto nss =
+            NamespaceString::createNamespaceString_forTest("test", "coll" + std::to_string(i));
+        const auto coll = _initializeCollection(_opCtx.get(), uuid, nss);
+        _insertDocAndGenerateOplogEntry(BSON("_id" << 1), uuid, nss, i + 2);
+
+        const Timestamp time(i + 2, i + 2);
+        ASSERT_OK(_storageInterface->insertDocument(
+            _opCtx.get(), {nss.dbName(), uuid}, {BSON("_id" << 2), time}, time.asULL()));
+        ASSERT_OK(_storageInterface->setCollectionCount(_opCtx.get(), {nss.dbName(), uuid}, 2));
+        uuids.push_back(uuid);
+    }
+
+    ASSERT_OK(_rollback->runRollback(_opCtx.get()));
+    for (const auto& uuid : uuids) {
+        ASSERT_EQ(_storageInterface->getFinalCollectionCount(uuid), 1);
+    }
+}
+
 TEST_F(RollbackImplTest, CountChangesCancelOut) {
     auto uuid = kGenericUUID;
     _storageInterface->setStableTimestamp(nullptr, Timestamp(1, 1));
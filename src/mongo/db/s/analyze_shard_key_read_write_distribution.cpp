@@ -35,7 +35,9 @@
 #include <boost/optional/optional.hpp>
 
 #include "mongo/base/status_with.h"
+#include "mongo/client/dbclient_cursor.h"
 #include "mongo/db/commands/bulk_write_crud_op.h"
+#include "mongo/db/dbdirectclient.h"
 #include "mongo/db/feature_flag.h"
 #include "mongo/db/internal_transactions_feature_flag_gen.h"
 #include "mongo/db/ops/write_ops.h"
@@ -43,6 +45,7 @@
 #include "mongo/db/pipeline/expression_context.h"
 #include "mongo/db/pipeline/variables.h"
 #include "mongo/db/query/collation/collator_factory_interface.h"
+#include "mongo/db/query/find_command.h"
 #include "mongo/db/s/analyze_shard_key_util.h"
 #include "mongo/db/server_options.h"
 #include "mongo/db/shard_id.h"
@@ -378,5 +381,40 @@ void WriteDistributionMetricsCalculator::_incrementMetricsForQuery(const QueryTa
     }
 }
 
+void processSampledQueries(OperationContext* opCtx,
+                           ReadDistributionMetricsCalculator* readDistributionCalculator,
+                           WriteDistributionMetricsCalculator* writeDistributionCalculator,
+                           const UUID& collUuid) {
+    FindCommandRequest findRequest{NamespaceString::kConfigSampledQueriesNamespace};
+    findRequest.setFilter(BSON(SampledQueryDocument::kCollectionUuidFieldName << collUuid));
+
+    DBDirectClient client(opCtx);
+    auto cursor = client.find(std::move(findRequest));
+
+    while (cursor->more()) {
+        const auto obj = cursor->next().getOwned();
+        const auto doc = SampledQueryDocument::parse(IDLParserContext("SampledQueryDocument"), obj);
+
+        switch (doc.getCmdName()) {
+            case SampledCommandNameEnum::kFind:
+            case SampledCommandNameEnum::kAggregate:
+            case SampledCommandNameEnum::kDistinct:
+            case SampledCommandNameEnum::kCount: {
+                readDistributionCalculator->addQuery(opCtx, doc);
+                break;
+            }
+            case SampledCommandNameEnum::kUpdate:
+            case SampledCommandNameEnum::kDelete:
+            case SampledCommandNameEnum::kFindAndModify:
+            case SampledCommandNameEnum::kBulkWrite: {
+                writeDistributionCalculator->addQuery(opCtx, doc);
+                break;
+            }
+            default:
+                MONGO_UNREACHABLE;
+        }
+    }
+}
+
 }  // namespace analyze_shard_key
 }  // namespace mongo
@@ -104,6 +104,13 @@ public:
      */
     virtual int64_t getNumTotal() const = 0;
 
+    /**
+     * Returns the number of sampled queries added so far that targeted each chunk range.
+     */
+    const std::map<ChunkRange, int64_t>& getNumByRange() const {
+        return _numByRange;
+    }
+
 protected:
     virtual SampleSizeType _getSampleSize() const = 0;
 
@@ -260,6 +267,15 @@ private:
     int64_t _numMultiWritesWithoutShardKey = 0;
 };
 
+/**
+ * Adds the sampled queries for the collection 'collUuid' that are stored on this node to the given
+ * read and write distribution calculators.
+ */
+void processSampledQueries(OperationContext* opCtx,
+                           ReadDistributionMetricsCalculator* readDistributionCalculator,
+                           WriteDistributionMetricsCalculator* writeDistributionCalculator,
+                           const UUID& collUuid);
+
 // Override the + operator and == operator for ReadSampleSize, WriteSampleSize,
 // ReadDistributionMetrics and WriteDistributionMetrics.
 
@@ -138,6 +138,7 @@ const Milliseconds kBalanceRoundDefaultInterval(10 * 1000);
 static constexpr StringData kBalancerPolicyStatusDraining = "draining"_sd;
 static constexpr StringData kBalancerPolicyStatusZoneViolation = "zoneViolation"_sd;
 static constexpr StringData kBalancerPolicyStatusChunksImbalance = "chunksImbalance"_sd;
+static constexpr StringData kBalancerPolicyStatusLoadImbalance = "loadImbalance"_sd;
 static constexpr StringData kBalancerPolicyStatusDefragmentingChunks = "defragmentingChunks"_sd;
 
 /**
@@ -1504,6 +1505,9 @@ BalancerCollectionStatusResponse Balancer::getBalancerStatusForNs(OperationConte
         case MigrationReason::chunksImbalance:
             setViolationOnResponse(kBalancerPolicyStatusChunksImbalance);
             break;
+        case MigrationReason::loadImbalance:
+            setViolationOnResponse(kBalancerPolicyStatusLoadImbalance);
+            break;
     }
 
     return response;
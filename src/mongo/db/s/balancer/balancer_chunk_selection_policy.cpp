@@ -154,6 +154,7 @@ getDataSizeInfoForCollections(OperationContext* opCtx,
 
     ShardsvrGetStatsForBalancing req{namespacesWithUUIDsForStatsRequest};
     req.setScaleFactor(1);
+    req.setIncludeSampledLoad(balancerLoadAwareRangeSelection.load());
     const auto reqObj = req.toBSON({});
 
     const auto executor = Grid::get(opCtx)->getExecutorPool()->getFixedExecutor();
@@ -179,7 +180,16 @@ getDataSizeInfoForCollections(OperationContext* opCtx,
                     collStatsFromShard.size() == collections.size());
             for (const auto& stats : collStatsFromShard) {
                 tassert(8245201, "Namespace not found", dataSizeInfoMap.contains(stats.getNs()));
-                dataSizeInfoMap.at(stats.getNs()).shardToDataSizeMap[shardId] = stats.getCollSize();
+                auto& dataSizeInfo = dataSizeInfoMap.at(stats.getNs());
+                dataSizeInfo.shardToDataSizeMap[shardId] = stats.getCollSize();
+
+                if (const auto& sampledLoadByRange = stats.getSampledLoadByRange()) {
+                    auto& rangeLoadMap = dataSizeInfo.shardToRangeLoadMap[shardId];
+                    for (const auto& rangeLoad : *sampledLoadByRange) {
+                        rangeLoadMap.emplace(rangeLoad.getMin().getOwned(),
+                                             rangeLoad.getNumQueries());
+                    }
+                }
             }
         } catch (const ExceptionFor<ErrorCodes::ShardNotFound>& ex) {
             // Handle `removeShard`: skip shards removed during a balancing round
@@ -31,6 +31,7 @@
 #include <absl/container/node_hash_map.h>
 #include <algorithm>
 #include <cstdint>
+#include <cstdlib>
 #include <ctime>
 #include <fmt/format.h>
 #include <limits>
@@ -79,6 +80,36 @@ using namespace fmt::literals;
 
 namespace {
 
+// Minimum number of sampled queries the most loaded shard must have for the balancer to move a
+// range based on load, so that a handful of samples does not trigger migrations.
+constexpr int64_t kMinSampledQueriesForLoadBalancing = 100;
+
+int64_t getShardLoad(const CollectionDataSizeInfoForBalancing& collDataSizeInfo,
+                     const ShardId& shardId) {
+    const auto shardLoadIt = collDataSizeInfo.shardToRangeLoadMap.find(shardId);
+    if (shardLoadIt == collDataSizeInfo.shardToRangeLoadMap.end()) {
+        return 0;
+    }
+
+    int64_t load = 0;
+    for (const auto& [_, numQueries] : shardLoadIt->second) {
+        load += numQueries;
+    }
+    return load;
+}
+
+int64_t getRangeLoad(const CollectionDataSizeInfoForBalancing& collDataSizeInfo,
+                     const ShardId& shardId,
+                     const BSONObj& minKey) {
+    const auto shardLoadIt = collDataSizeInfo.shardToRangeLoadMap.find(shardId);
+    if (shardLoadIt == collDataSizeInfo.shardToRangeLoadMap.end()) {
+        return 0;
+    }
+
+    const auto rangeLoadIt = shardLoadIt->second.find(minKey);
+    return rangeLoadIt == shardLoadIt->second.end() ? 0 : rangeLoadIt->second;
+}
+
 ChunkType makeChunkType(const UUID& collUUID, const Chunk& chunk) {
     ChunkType ct{collUUID, chunk.getRange(), chunk.getLastmod(), chunk.getShardId()};
     ct.setJumbo(chunk.isJumbo());
@@ -693,6 +724,23 @@ MigrateInfosWithReason BalancerPolicy::balance(
                 firstReason = MigrationReason::chunksImbalance;
             }
         }
+
+        if (collDataSizeInfo.shardToRangeLoadMap.empty()) {
+            continue;
+        }
+
+        while (_singleZoneBalanceBasedOnLoad(shardStats,
+                                             distribution,
+                                             collDataSizeInfo,
+                                             zone,
+                                             &migrations,
+                                             availableShards,
+                                             forceJumbo ? ForceJumbo::kForceBalancer
+                                                        : ForceJumbo::kDoNotForce)) {
+            if (firstReason == MigrationReason::none) {
+                firstReason = MigrationReason::loadImbalance;
+            }
+        }
     }
 
     return std::make_pair(std::move(migrations), firstReason);
@@ -757,30 +805,32 @@ bool BalancerPolicy::_singleZoneBalanceBasedOnDataSize(
 
     unsigned numJumboChunks = 0;
 
-    const auto chunkFound =
-        !distribution.forEachChunkOnShardInZone(fromShardId, zone, [&](const auto& chunk) {
-            if (chunk.isJumbo()) {
-                numJumboChunks++;
-                return true;  // continue
-            }
-
-            migrations->emplace_back(toShardId,
-                                     chunk.getShardId(),
-                                     distribution.nss(),
-                                     distribution.getChunkManager().getUUID(),
-                                     chunk.getMin(),
-                                     boost::none /* max */,
-                                     chunk.getLastmod(),
-                                     forceJumbo,
-                                     collDataSizeInfo.maxChunkSizeBytes);
-            tassert(8245231,
-                    "Source shard does not exist in available shards",
-                    availableShards->erase(chunk.getShardId()));
-            tassert(8245232,
-                    "Target shard does not exist in available shards",
-                    availableShards->erase(toShardId));
-            return false;  // break
-        });
+    const auto chunk = _selectChunkToMove(distribution,
+                                          collDataSizeInfo,
+                                          fromShardId,
+                                          toShardId,
+                                          zone,
+                                          false /* requireLoadReduction */,
+                                          &numJumboChunks);
+    const bool chunkFound = chunk.has_value();
+
+    if (chunkFound) {
+        migrations->emplace_back(toShardId,
+                                 chunk->getShardId(),
+                                 distribution.nss(),
+                                 distribution.getChunkManager().getUUID(),
+                                 chunk->getMin(),
+                                 boost::none /* max */,
+                                 chunk->getLastmod(),
+                                 forceJumbo,
+                                 collDataSizeInfo.maxChunkSizeBytes);
+        tassert(8245231,
+                "Source shard does not exist in available shards",
+                availableShards->erase(chunk->getShardId()));
+        tassert(8245232,
+                "Target shard does not exist in available shards",
+                availableShards->erase(toShardId));
+    }
 
     if (!chunkFound && numJumboChunks) {
         LOGV2_WARNING(6581602,
@@ -794,6 +844,141 @@ bool BalancerPolicy::_singleZoneBalanceBasedOnDataSize(
     return chunkFound;
 }
 
+bool BalancerPolicy::_singleZoneBalanceBasedOnLoad(
+    const ShardStatisticsVector& shardStats,
+    const DistributionStatus& distribution,
+    const CollectionDataSizeInfoForBalancing& collDataSizeInfo,
+    const string& zone,
+    vector<MigrateInfo>* migrations,
+    stdx::unordered_set<ShardId>* availableShards,
+    ForceJumbo forceJumbo) {
+    ShardId from;
+    int64_t fromLoad = numeric_limits<int64_t>::min();
+    ShardId to;
+    int64_t toLoad = numeric_limits<int64_t>::max();
+
+    for (const auto& stat : shardStats) {
+        if (!availableShards->count(stat.shardId))
+            continue;
+
+        if (!collDataSizeInfo.shardToDataSizeMap.count(stat.shardId)) {
+            // Skip if stats not available (may happen if add|remove shard during a round)
+            continue;
+        }
+
+        const auto shardLoad = getShardLoad(collDataSizeInfo, stat.shardId);
+        if (shardLoad > fromLoad) {
+            from = stat.shardId;
+            fromLoad = shardLoad;
+        }
+        if (shardLoad < toLoad && isShardSuitableReceiver(stat, zone).isOK()) {
+            to = stat.shardId;
+            toLoad = shardLoad;
+        }
+    }
+
+    if (!from.isValid() || !to.isValid() || from == to) {
+        return false;
+    }
+
+    if (fromLoad < kMinSampledQueriesForLoadBalancing || fromLoad < 2 * toLoad) {
+        // Do not balance if the load differs too few between the chosen shards
+        return false;
+    }
+
+    const auto fromSize = collDataSizeInfo.shardToDataSizeMap.at(from);
+    const auto toSize = collDataSizeInfo.shardToDataSizeMap.at(to);
+    if (toSize - fromSize >= collDataSizeInfo.maxChunkSizeBytes) {
+        // Moving up to 'maxChunkSizeBytes' more data to a shard which already has more data than
+        // the source could get the range moved back by data size balancing in a later round
+        return false;
+    }
+
+    LOGV2_DEBUG(9156631,
+                1,
+                "Balancing single zone based on sampled load",
+                logAttrs(distribution.nss()),
+                "zone"_attr = zone,
+                "fromShardId"_attr = from,
+                "fromShardLoad"_attr = fromLoad,
+                "fromShardDataSize"_attr = fromSize,
+                "toShardId"_attr = to,
+                "toShardLoad"_attr = toLoad,
+                "toShardDataSize"_attr = toSize);
+
+    unsigned numJumboChunks = 0;
+    const auto chunk = _selectChunkToMove(distribution,
+                                          collDataSizeInfo,
+                                          from,
+                                          to,
+                                          zone,
+                                          true /* requireLoadReduction */,
+                                          &numJumboChunks);
+    if (!chunk) {
+        return false;
+    }
+
+    migrations->emplace_back(to,
+                             from,
+                             distribution.nss(),
+                             distribution.getChunkManager().getUUID(),
+                             chunk->getMin(),
+                             boost::none /* max */,
+                             chunk->getLastmod(),
+                             forceJumbo,
+                             collDataSizeInfo.maxChunkSizeBytes);
+    tassert(9156632,
+            "Source shard does not exist in available shards",
+            availableShards->erase(from));
+    tassert(9156633, "Target shard does not exist in available shards", availableShards->erase(to));
+    return true;
+}
+
+boost::optional<Chunk> BalancerPolicy::_selectChunkToMove(
+    const DistributionStatus& distribution,
+    const CollectionDataSizeInfoForBalancing& collDataSizeInfo,
+    const ShardId& fromShardId,
+    const ShardId& toShardId,
+    const string& zone,
+    bool requireLoadReduction,
+    unsigned* numJumboChunks) {
+    const bool hasLoadInfo = !collDataSizeInfo.shardToRangeLoadMap.empty();
+    const int64_t loadDifference = hasLoadInfo
+        ? getShardLoad(collDataSizeInfo, fromShardId) - getShardLoad(collDataSizeInfo, toShardId)
+        : 0;
+
+    boost::optional<Chunk> bestChunk;
+    int64_t bestLoadDifferenceAfterMove = numeric_limits<int64_t>::max();
+
+    distribution.forEachChunkOnShardInZone(fromShardId, zone, [&](const auto& chunk) {
+        if (chunk.isJumbo()) {
+            (*numJumboChunks)++;
+            return true;  // continue
+        }
+
+        if (!hasLoadInfo) {
+            bestChunk.emplace(chunk);
+            return false;  // break
+        }
+
+        // Moving a range with 'rangeLoad' sampled queries changes the difference between the load
+        // of the two shards from 'loadDifference' to 'loadDifference - 2 * rangeLoad'.
+        const auto rangeLoad = getRangeLoad(collDataSizeInfo, fromShardId, chunk.getMin());
+        const auto loadDifferenceAfterMove = std::abs(loadDifference - 2 * rangeLoad);
+        if (requireLoadReduction && loadDifferenceAfterMove >= std::abs(loadDifference)) {
+            return true;  // continue
+        }
+
+        if (loadDifferenceAfterMove < bestLoadDifferenceAfterMove) {
+            bestChunk.emplace(chunk);
+            bestLoadDifferenceAfterMove = loadDifferenceAfterMove;
+        }
+        return true;  // continue
+    });
+
+    return bestChunk;
+}
+
 ZoneRange::ZoneRange(const BSONObj& a_min, const BSONObj& a_max, const std::string& _zone)
     : min(a_min.getOwned()), max(a_max.getOwned()), zone(_zone) {}
 
@@ -114,7 +114,7 @@ struct MigrateInfo {
     boost::optional<int64_t> optMaxChunkSizeBytes;
 };
 
-enum MigrationReason { none, drain, zoneViolation, chunksImbalance };
+enum MigrationReason { none, drain, zoneViolation, chunksImbalance, loadImbalance };
 
 typedef std::vector<MigrateInfo> MigrateInfoVector;
 
@@ -241,6 +241,11 @@ struct CollectionDataSizeInfoForBalancing {
 
     std::map<ShardId, int64_t> shardToDataSizeMap;
     const int64_t maxChunkSizeBytes;
+
+    // Number of sampled queries that targeted the ranges owned by each shard, keyed by the minKey
+    // of the range. Left empty unless load aware range selection is enabled, in which case the
+    // balancer only uses data size.
+    std::map<ShardId, SimpleBSONObjMap<int64_t>> shardToRangeLoadMap;
 };
 
 /**
@@ -454,7 +459,9 @@ public:
      *
      * The balancing logic calculates the optimum number of chunks per shard for each zone and if
      * any of the shards have chunks, which are sufficiently higher than this number, suggests
-     * moving chunks to shards, which are under this number.
+     * moving chunks to shards, which are under this number. If the sampled load of the shards is
+     * available, it is used to pick which ranges to move and to suggest moving hot ranges off the
+     * shards with the most sampled queries as long as the data size stays balanced.
      *
      * The availableShards parameter is in/out and it contains the set of shards, which haven't
      * been used for migrations yet. Used so we don't return multiple conflicting migrations for the
@@ -505,6 +512,40 @@ private:
         std::vector<MigrateInfo>* migrations,
         stdx::unordered_set<ShardId>* availableShards,
         ForceJumbo forceJumbo);
+
+    /**
+     * Selects one range for the specified zone to be moved from the available shard with the most
+     * sampled queries to the available shard with the fewest, if the difference between them is
+     * large enough and the move would not cause the collection data size to become imbalanced.
+     * Only used when 'collDataSizeInfo' carries the sampled load of the shards.
+     *
+     * Returns true if a migration was suggested, false otherwise. This method is intented to be
+     * called multiple times until all posible migrations for a zone have been selected.
+     */
+    static bool _singleZoneBalanceBasedOnLoad(
+        const ShardStatisticsVector& shardStats,
+        const DistributionStatus& distribution,
+        const CollectionDataSizeInfoForBalancing& collDataSizeInfo,
+        const std::string& zone,
+        std::vector<MigrateInfo>* migrations,
+        stdx::unordered_set<ShardId>* availableShards,
+        ForceJumbo forceJumbo);
+
+    /**
+     * Returns the non-jumbo chunk on 'fromShardId' in the specified zone to move to 'toShardId'.
+     * Without sampled load this is the first such chunk. With sampled load it is the chunk whose
+     * move leaves the smallest difference between the load of the two shards, which favors moving
+     * hot ranges off the more loaded shard. If 'requireLoadReduction' is true, only chunks whose
+     * move reduces that difference are considered.
+     */
+    static boost::optional<Chunk> _selectChunkToMove(
+        const DistributionStatus& distribution,
+        const CollectionDataSizeInfoForBalancing& collDataSizeInfo,
+        const ShardId& fromShardId,
+        const ShardId& toShardId,
+        const std::string& zone,
+        bool requireLoadReduction,
+        unsigned* numJumboChunks);
 };
 
 }  // namespace mongo
@@ -234,6 +234,16 @@ MigrateInfosWithReason balanceChunks(const ShardStatisticsVector& shardStats,
                                    forceJumbo);
 }
 
+MigrateInfosWithReason balanceChunksWithSampledLoad(
+    const ShardStatisticsVector& shardStats,
+    const DistributionStatus& distribution,
+    const CollectionDataSizeInfoForBalancing& collDataSizeInfo) {
+    auto availableShards = getAllShardIds(shardStats);
+
+    return BalancerPolicy::balance(
+        shardStats, distribution, collDataSizeInfo, &availableShards, false /* forceJumbo */);
+}
+
 void checkChunksOnShardForTag(const DistributionStatus& dist,
                               const ShardId& shardId,
                               const std::string& zoneName,
@@ -460,6 +470,98 @@ TEST(BalancerPolicy, ParallelBalancingDoesNotMoveDataFromShardsBelowIdealZoneSiz
     ASSERT_EQ(MigrationReason::chunksImbalance, reason);
 }
 
+TEST(BalancerPolicy, DataSizeBalancingPrefersRangeThatEvensSampledLoad) {
+    auto [cluster, cm] = generateCluster({{4, 4 * kDefaultMaxChunkSizeBytes},
+                                          {0, 0 * kDefaultMaxChunkSizeBytes},
+                                          {3, 3 * kDefaultMaxChunkSizeBytes}});
+    const auto& chunks = cluster.second[getShardId(0)];
+
+    auto collDataSizeInfo = buildDataSizeInfoForBalancingFromShardStats(cluster.first);
+    collDataSizeInfo.shardToRangeLoadMap[getShardId(0)] = {
+        {chunks[1].getMin(), 100}, {chunks[2].getMin(), 300}, {chunks[3].getMin(), 50}};
+
+    const auto [migrations, reason] =
+        balanceChunksWithSampledLoad(cluster.first, makeDistStatus(cm), collDataSizeInfo);
+    ASSERT_EQ(1U, migrations.size());
+    ASSERT_EQ(getShardId(0), migrations[0].from);
+    ASSERT_EQ(getShardId(1), migrations[0].to);
+    ASSERT_BSONOBJ_EQ(chunks[2].getMin(), migrations[0].minKey);
+    ASSERT_EQ(MigrationReason::chunksImbalance, reason);
+}
+
+TEST(BalancerPolicy, LoadBalancingMovesHotRangeWhenDataSizeIsBalanced) {
+    auto [cluster, cm] = generateCluster(
+        {{3, 3 * kDefaultMaxChunkSizeBytes}, {3, 3 * kDefaultMaxChunkSizeBytes}});
+    const auto& chunks = cluster.second[getShardId(0)];
+
+    auto collDataSizeInfo = buildDataSizeInfoForBalancingFromShardStats(cluster.first);
+    collDataSizeInfo.shardToRangeLoadMap[getShardId(0)] = {
+        {chunks[0].getMin(), 10}, {chunks[1].getMin(), 200}, {chunks[2].getMin(), 30}};
+
+    {
+        // Without sampled load the cluster is balanced.
+        const auto [migrations, reason] =
+            balanceChunks(cluster.first, makeDistStatus(cm), false, false);
+        ASSERT(migrations.empty());
+        ASSERT_EQ(MigrationReason::none, reason);
+    }
+    {
+        const auto [migrations, reason] =
+            balanceChunksWithSampledLoad(cluster.first, makeDistStatus(cm), collDataSizeInfo);
+        ASSERT_EQ(1U, migrations.size());
+        ASSERT_EQ(getShardId(0), migrations[0].from);
+        ASSERT_EQ(getShardId(1), migrations[0].to);
+        ASSERT_BSONOBJ_EQ(chunks[1].getMin(), migrations[0].minKey);
+        ASSERT_EQ(MigrationReason::loadImbalance, reason);
+    }
+}
+
+TEST(BalancerPolicy, LoadBalancingIgnoresShardsWithFewSampledQueries) {
+    auto [cluster, cm] = generateCluster(
+        {{3, 3 * kDefaultMaxChunkSizeBytes}, {3, 3 * kDefaultMaxChunkSizeBytes}});
+    const auto& chunks = cluster.second[getShardId(0)];
+
+    auto collDataSizeInfo = buildDataSizeInfoForBalancingFromShardStats(cluster.first);
+    collDataSizeInfo.shardToRangeLoadMap[getShardId(0)] = {
+        {chunks[0].getMin(), 1}, {chunks[1].getMin(), 20}, {chunks[2].getMin(), 3}};
+
+    const auto [migrations, reason] =
+        balanceChunksWithSampledLoad(cluster.first, makeDistStatus(cm), collDataSizeInfo);
+    ASSERT(migrations.empty());
+    ASSERT_EQ(MigrationReason::none, reason);
+}
+
+TEST(BalancerPolicy, LoadBalancingIgnoresSmallLoadDifference) {
+    auto [cluster, cm] = generateCluster(
+        {{3, 3 * kDefaultMaxChunkSizeBytes}, {3, 3 * kDefaultMaxChunkSizeBytes}});
+
+    auto collDataSizeInfo = buildDataSizeInfoForBalancingFromShardStats(cluster.first);
+    collDataSizeInfo.shardToRangeLoadMap[getShardId(0)] = {
+        {cluster.second[getShardId(0)][1].getMin(), 300}};
+    collDataSizeInfo.shardToRangeLoadMap[getShardId(1)] = {
+        {cluster.second[getShardId(1)][1].getMin(), 200}};
+
+    const auto [migrations, reason] =
+        balanceChunksWithSampledLoad(cluster.first, makeDistStatus(cm), collDataSizeInfo);
+    ASSERT(migrations.empty());
+    ASSERT_EQ(MigrationReason::none, reason);
+}
+
+TEST(BalancerPolicy, LoadBalancingDoesNotMoveRangesToShardWithMoreData) {
+    auto [cluster, cm] = generateCluster(
+        {{2, 2 * kDefaultMaxChunkSizeBytes}, {4, 4 * kDefaultMaxChunkSizeBytes}});
+    const auto& chunks = cluster.second[getShardId(0)];
+
+    auto collDataSizeInfo = buildDataSizeInfoForBalancingFromShardStats(cluster.first);
+    collDataSizeInfo.shardToRangeLoadMap[getShardId(0)] = {{chunks[0].getMin(), 100},
+                                                           {chunks[1].getMin(), 300}};
+
+    const auto [migrations, reason] =
+        balanceChunksWithSampledLoad(cluster.first, makeDistStatus(cm), collDataSizeInfo);
+    ASSERT(migrations.empty());
+    ASSERT_EQ(MigrationReason::none, reason);
+}
+
 TEST(BalancerPolicy, JumboChunksNotMoved) {
     auto [cluster, cm] =
         generateCluster({{4, 4 * kDefaultMaxChunkSizeBytes}, {0, 0 * kDefaultMaxChunkSizeBytes}});
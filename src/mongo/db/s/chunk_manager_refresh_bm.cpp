@@ -53,6 +53,7 @@
 #include "mongo/bson/oid.h"
 #include "mongo/bson/simple_bsonobj_comparator.h"
 #include "mongo/bson/timestamp.h"
+#include "mongo/config.h"
 #include "mongo/db/keypattern.h"
 #include "mongo/db/namespace_string.h"
 #include "mongo/db/query/collation/collator_interface.h"
@@ -70,11 +71,32 @@
 #include "mongo/util/str.h"
 #include "mongo/util/uuid.h"
 
+#if defined(MONGO_CONFIG_TCMALLOC_GOOGLE)
+#include <tcmalloc/malloc_extension.h>
+#elif defined(MONGO_CONFIG_TCMALLOC_GPERF)
+#include <gperftools/malloc_extension.h>
+#endif
+
 namespace mongo {
 namespace {
 
 const NamespaceString kNss = NamespaceString::createNamespaceString_forTest("test", "foo");
 
+// Returns the number of bytes currently allocated by the application, or 0 when the allocator
+// does not expose that statistic.
+size_t currentAllocatedBytes() {
+#if defined(MONGO_CONFIG_TCMALLOC_GOOGLE)
+    return tcmalloc::MallocExtension::GetNumericProperty("generic.current_allocated_bytes")
+        .value_or(0);
+#elif defined(MONGO_CONFIG_TCMALLOC_GPERF)
+    size_t value = 0;
+    MallocExtension::instance()->GetNumericProperty("generic.current_allocated_bytes", &value);
+    return value;
+#else
+    return 0;
+#endif
+}
+
 RoutingTableHistoryValueHandle makeStandaloneRoutingTableHistory(RoutingTableHistory rt) {
     const auto version = rt.getVersion();
     return RoutingTableHistoryValueHandle(
@@ -200,6 +222,8 @@ void BM_IncrementalSpacedRefreshMoveChunks(benchmark::State& state) {
     for (auto _ : state) {
         benchmark::DoNotOptimize(runIncrementalUpdate(metadata, newChunks));
     }
+    state.counters["chunksRefreshed"] =
+        benchmark::Counter(newChunks.size(), benchmark::Counter::kIsIterationInvariantRate);
 }
 
 BENCHMARK(BM_IncrementalSpacedRefreshMoveChunks)
@@ -271,6 +295,8 @@ void BM_IncrementalSpacedRefreshMergeChunks(benchmark::State& state) {
     for (auto _ : state) {
         benchmark::DoNotOptimize(runIncrementalUpdate(metadata, newChunks));
     }
+    state.counters["chunksRefreshed"] =
+        benchmark::Counter(newChunks.size(), benchmark::Counter::kIsIterationInvariantRate);
 }
 
 /*
@@ -307,7 +333,9 @@ auto BM_FullBuildOfChunkManager(benchmark::State& state, ShardSelectorFn selectS
                             selectShard(i, nShards, nChunks));
     }
 
+    size_t routingTableBytes = 0;
     for (auto keepRunning : state) {
+        const auto allocatedBytesBefore = currentAllocatedBytes();
         auto rt = RoutingTableHistory::makeNew(kNss,
                                                collUuid,
                                                shardKeyPattern,
@@ -320,6 +348,10 @@ auto BM_FullBuildOfChunkManager(benchmark::State& state, ShardSelectorFn selectS
                                                boost::none /* reshardingFields */,
                                                true,
                                                chunks);
+        const auto allocatedBytesAfter = currentAllocatedBytes();
+        if (allocatedBytesAfter > allocatedBytesBefore) {
+            routingTableBytes = allocatedBytesAfter - allocatedBytesBefore;
+        }
         benchmark::DoNotOptimize(
             CollectionMetadata(ChunkManager(getShardId(0),
                                             DatabaseVersion(UUID::gen(), Timestamp(1, 0)),
@@ -327,6 +359,12 @@ auto BM_FullBuildOfChunkManager(benchmark::State& state, ShardSelectorFn selectS
                                             boost::none),
                                getShardId(0)));
     }
+
+    // Memory footprint of a freshly built routing table, as seen by the allocator.
+    state.counters["routingTableBytes"] = routingTableBytes;
+    state.counters["bytesPerChunk"] = static_cast<double>(routingTableBytes) / nChunks;
+    state.counters["chunksBuilt"] =
+        benchmark::Counter(nChunks, benchmark::Counter::kIsIterationInvariantRate);
 }
 
 std::vector<BSONObj> makeKeys(int nChunks) {
@@ -234,46 +234,6 @@ CollectionRoutingInfoTargeter makeCollectionRoutingInfoTargeter(
                               boost::optional<ShardingIndexesCatalogCache>(boost::none)});
 }
 
-/**
- * Calculates the read and write distribution metrics for the collection 'collUuid' based on its
- * sampled queries.
- */
-void processSampledQueries(OperationContext* opCtx,
-                           ReadDistributionMetricsCalculator* readDistributionCalculator,
-                           WriteDistributionMetricsCalculator* writeDistributionCalculator,
-                           const UUID& collUuid) {
-    FindCommandRequest findRequest{NamespaceString::kConfigSampledQueriesNamespace};
-    findRequest.setFilter(BSON(SampledQueryDocument::kCollectionUuidFieldName << collUuid));
-
-    DBDirectClient client(opCtx);
-    auto cursor = client.find(std::move(findRequest));
-
-    while (cursor->more()) {
-        const auto obj = cursor->next().getOwned();
-        const auto doc = SampledQueryDocument::parse(
-            IDLParserContext(DocumentSourceAnalyzeShardKeyReadWriteDistribution::kStageName), obj);
-
-        switch (doc.getCmdName()) {
-            case SampledCommandNameEnum::kFind:
-            case SampledCommandNameEnum::kAggregate:
-            case SampledCommandNameEnum::kDistinct:
-            case SampledCommandNameEnum::kCount: {
-                readDistributionCalculator->addQuery(opCtx, doc);
-                break;
-            }
-            case SampledCommandNameEnum::kUpdate:
-            case SampledCommandNameEnum::kDelete:
-            case SampledCommandNameEnum::kFindAndModify:
-            case SampledCommandNameEnum::kBulkWrite: {
-                writeDistributionCalculator->addQuery(opCtx, doc);
-                break;
-            }
-            default:
-                MONGO_UNREACHABLE;
-        }
-    }
-}
-
 /**
  * Calculates the read and write distribution metrics for the collection 'collUuid' based on its
  * sampled diffs. Currently, this only involves calculating the number of shard key updates.
@@ -39,6 +39,7 @@
 #include "mongo/base/error_codes.h"
 #include "mongo/base/status.h"
 #include "mongo/client/read_preference.h"
+#include "mongo/db/admission/ticketholder_manager.h"
 #include "mongo/db/cancelable_operation_context.h"
 #include "mongo/db/feature_flag.h"
 #include "mongo/db/s/migration_batch_mock_inserter.h"
@@ -59,6 +60,19 @@
 #define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kSharding
 
 namespace mongo {
+namespace {
+
+// Returns whether local writers currently have to queue for a write ticket.
+bool writeTicketsExhausted(ServiceContext* serviceContext) {
+    auto ticketHolderManager = admission::TicketHolderManager::get(serviceContext);
+    if (!ticketHolderManager) {
+        return false;
+    }
+    auto writeTicketHolder = ticketHolderManager->getTicketHolder(MODE_IX);
+    return writeTicketHolder && writeTicketHolder->available() <= 0;
+}
+
+}  // namespace
 
 template <typename Inserter>
 void MigrationBatchFetcher<Inserter>::BufferSizeTracker::waitUntilSpaceAvailableAndAdd(
@@ -134,7 +148,9 @@ MigrationBatchFetcher<Inserter>::MigrationBatchFetcher(
       _writeConcern{writeConcern},
       _isParallelFetchingSupported{parallelFetchingSupported},
       _secondaryThrottleTicket(outerOpCtx->getServiceContext(), 1, false /* trackPeakUsed */),
-      _bufferSizeTracker(maxBufferedSizeBytesPerThread) {
+      _bufferSizeTracker(maxBufferedSizeBytesPerThread),
+      _concurrencyController(_chunkMigrationConcurrency,
+                             Milliseconds(chunkMigrationTargetInsertBatchLatencyMS.load())) {
     _inserterWorkers->startup();
 }
 
@@ -194,8 +210,12 @@ void MigrationBatchFetcher<Inserter>::_runFetcher() try {
 
     LOGV2_DEBUG(6718405, 0, "Chunk migration data fetch start", "migrationId"_attr = _migrationId);
     while (true) {
+        _concurrencyController.acquireFetchSlot(opCtx);
         Timer totalTimer;
-        BSONObj nextBatch = _fetchBatch(opCtx);
+        BSONObj nextBatch = [&] {
+            ON_BLOCK_EXIT([&] { _concurrencyController.releaseFetchSlot(); });
+            return _fetchBatch(opCtx);
+        }();
         assertNotAborted();
         if (_isEmptyBatch(nextBatch)) {
             LOGV2_DEBUG(6718404,
@@ -216,6 +236,7 @@ void MigrationBatchFetcher<Inserter>::_runFetcher() try {
                     "fetch"_attr = duration_cast<Milliseconds>(fetchTime));
 
         _bufferSizeTracker.waitUntilSpaceAvailableAndAdd(opCtx, batchSize);
+        _concurrencyController.acquireInsertSlot(opCtx);
 
         Inserter inserter{_outerOpCtx,
                           _innerOpCtx,
@@ -237,6 +258,11 @@ void MigrationBatchFetcher<Inserter>::_runFetcher() try {
                                     migrationId = _migrationId,
                                     inserter = std::move(inserter)](Status status) {
             ON_BLOCK_EXIT([&] { _bufferSizeTracker.remove(batchSize); });
+            ON_BLOCK_EXIT([&] {
+                _concurrencyController.releaseInsertSlot(
+                    duration_cast<Milliseconds>(insertTimer.elapsed()),
+                    writeTicketsExhausted(_outerOpCtx->getServiceContext()));
+            });
             inserter.run(status);
 
             const auto checkDivByZero = [](auto divisor, auto expression) {
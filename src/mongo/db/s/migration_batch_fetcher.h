@@ -40,6 +40,7 @@
 #include "mongo/db/repl/optime.h"
 #include "mongo/db/s/migration_batch_inserter.h"
 #include "mongo/db/s/migration_batch_mock_inserter.h"
+#include "mongo/db/s/migration_concurrency_controller.h"
 #include "mongo/db/s/migration_session_id.h"
 #include "mongo/db/service_context.h"
 #include "mongo/db/shard_id.h"
@@ -117,6 +118,11 @@ public:
         return _inserterWorkers->getStats();
     }
 
+    // Get the current limit on concurrent fetches and insert batches.
+    int getConcurrencyLimit() const {
+        return _concurrencyController.getLimit();
+    }
+
 private:
     /**
      * Keeps track of memory usage and makes sure it won't exceed the limit.
@@ -183,6 +189,10 @@ private:
 
     BufferSizeTracker _bufferSizeTracker;
 
+    // Adapts how many of the fetcher and inserter threads are busy at once, up to
+    // _chunkMigrationConcurrency.
+    MigrationConcurrencyController _concurrencyController;
+
     // Given session id and namespace, create migrateCloneRequest.
     // Only should be created once for the lifetime of the object.
     BSONObj _createMigrateCloneRequest() const {
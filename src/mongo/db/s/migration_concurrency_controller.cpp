@@ -0,0 +1,111 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+
+#include "mongo/db/s/migration_concurrency_controller.h"
+
+#include <algorithm>
+#include <mutex>
+
+#include "mongo/logv2/log.h"
+#include "mongo/util/assert_util.h"
+#include "mongo/util/scopeguard.h"
+
+#define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kShardingMigration
+
+namespace mongo {
+
+MigrationConcurrencyController::MigrationConcurrencyController(
+    int maxConcurrency, Milliseconds targetInsertBatchLatency)
+    : _maxConcurrency(maxConcurrency),
+      _targetInsertBatchLatency(targetInsertBatchLatency),
+      _limit(maxConcurrency) {
+    invariant(_maxConcurrency > 0);
+}
+
+void MigrationConcurrencyController::_acquireSlot(OperationContext* opCtx, int* numActive) {
+    stdx::unique_lock lk(_mutex);
+    opCtx->waitForConditionOrInterrupt(
+        _slotAvailable, lk, [this, numActive] { return *numActive < _limit; });
+    ++*numActive;
+}
+
+void MigrationConcurrencyController::acquireFetchSlot(OperationContext* opCtx) {
+    _acquireSlot(opCtx, &_numActiveFetches);
+}
+
+void MigrationConcurrencyController::releaseFetchSlot() {
+    stdx::lock_guard lk(_mutex);
+    invariant(_numActiveFetches > 0);
+    --_numActiveFetches;
+    _slotAvailable.notify_all();
+}
+
+void MigrationConcurrencyController::acquireInsertSlot(OperationContext* opCtx) {
+    _acquireSlot(opCtx, &_numActiveInserts);
+}
+
+void MigrationConcurrencyController::releaseInsertSlot(Milliseconds insertBatchLatency,
+                                                       bool writeTicketsExhausted) {
+    stdx::lock_guard lk(_mutex);
+    invariant(_numActiveInserts > 0);
+    --_numActiveInserts;
+    ON_BLOCK_EXIT([&] { _slotAvailable.notify_all(); });
+
+    if (_targetInsertBatchLatency <= Milliseconds(0)) {
+        return;
+    }
+
+    _overloadedInWindow |= writeTicketsExhausted || insertBatchLatency > _targetInsertBatchLatency;
+    if (++_numInsertsInWindow < _limit) {
+        return;
+    }
+
+    const auto newLimit =
+        _overloadedInWindow ? std::max(1, _limit / 2) : std::min(_maxConcurrency, _limit + 1);
+    if (newLimit != _limit) {
+        LOGV2_DEBUG(9156629,
+                    2,
+                    "Adjusting chunk migration recipient concurrency",
+                    "previousLimit"_attr = _limit,
+                    "newLimit"_attr = newLimit,
+                    "overloaded"_attr = _overloadedInWindow);
+        _limit = newLimit;
+    }
+
+    _numInsertsInWindow = 0;
+    _overloadedInWindow = false;
+}
+
+int MigrationConcurrencyController::getLimit() const {
+    stdx::lock_guard lk(_mutex);
+    return _limit;
+}
+
+}  // namespace mongo
@@ -0,0 +1,94 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+
+#pragma once
+
+#include "mongo/db/operation_context.h"
+#include "mongo/platform/mutex.h"
+#include "mongo/stdx/condition_variable.h"
+#include "mongo/util/duration.h"
+
+namespace mongo {
+
+/**
+ * Scales the number of _migrateClone fetches and insert batches that a chunk migration recipient
+ * runs concurrently, using how long its insert batches take and whether local writers are out of
+ * write tickets as feedback.
+ *
+ * The concurrency limit follows additive-increase/multiplicative-decrease and is adjusted once per
+ * window of 'limit' completed insert batches: if any batch in the window was slower than the target
+ * latency or finished while no write tickets were available, the limit is halved, otherwise it
+ * grows by one. The limit starts at and never exceeds the configured maximum, and never drops
+ * below one. Without a target latency the limit stays at the maximum.
+ */
+class MigrationConcurrencyController {
+public:
+    MigrationConcurrencyController(int maxConcurrency, Milliseconds targetInsertBatchLatency);
+
+    /**
+     * Blocks until fewer than 'limit' fetches are running, then counts the caller as one of them.
+     */
+    void acquireFetchSlot(OperationContext* opCtx);
+    void releaseFetchSlot();
+
+    /**
+     * Blocks until fewer than 'limit' insert batches are scheduled or running, then counts the
+     * caller's batch as one of them.
+     */
+    void acquireInsertSlot(OperationContext* opCtx);
+
+    /**
+     * Releases the slot of an insert batch which took 'insertBatchLatency' to apply, and feeds the
+     * observation back into the concurrency limit.
+     */
+    void releaseInsertSlot(Milliseconds insertBatchLatency, bool writeTicketsExhausted);
+
+    int getLimit() const;
+
+private:
+    void _acquireSlot(OperationContext* opCtx, int* numActive);
+
+    mutable Mutex _mutex = MONGO_MAKE_LATCH("MigrationConcurrencyController::_mutex");
+    stdx::condition_variable _slotAvailable;
+
+    const int _maxConcurrency;
+    const Milliseconds _targetInsertBatchLatency;
+
+    int _limit;
+    int _numActiveFetches{0};
+    int _numActiveInserts{0};
+
+    // Insert batches completed since the limit was last adjusted, and whether any of them showed
+    // the recipient to be overloaded.
+    int _numInsertsInWindow{0};
+    bool _overloadedInWindow{false};
+};
+
+}  // namespace mongo
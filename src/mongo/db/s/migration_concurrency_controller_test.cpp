@@ -0,0 +1,130 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+
+#include "mongo/db/s/migration_concurrency_controller.h"
+
+#include "mongo/db/service_context_test_fixture.h"
+#include "mongo/unittest/assert.h"
+#include "mongo/unittest/framework.h"
+
+namespace mongo {
+namespace {
+
+class MigrationConcurrencyControllerTest : public ServiceContextTest {
+protected:
+    // Runs 'numBatches' insert batches one after the other, each taking 'latency' to apply.
+    void completeInsertBatches(MigrationConcurrencyController& controller,
+                               int numBatches,
+                               Milliseconds latency,
+                               bool writeTicketsExhausted = false) {
+        for (int i = 0; i < numBatches; ++i) {
+            controller.acquireInsertSlot(_opCtx.get());
+            controller.releaseInsertSlot(latency, writeTicketsExhausted);
+        }
+    }
+
+    ServiceContext::UniqueOperationContext _opCtx = makeOperationContext();
+};
+
+TEST_F(MigrationConcurrencyControllerTest, LimitStaysAtMaximumWithoutTargetLatency) {
+    MigrationConcurrencyController controller(8, Milliseconds(0));
+    completeInsertBatches(controller, 20, Milliseconds(1000), true /* writeTicketsExhausted */);
+    ASSERT_EQ(8, controller.getLimit());
+}
+
+TEST_F(MigrationConcurrencyControllerTest, SlowInsertBatchesHalveLimitDownToOne) {
+    MigrationConcurrencyController controller(8, Milliseconds(10));
+    ASSERT_EQ(8, controller.getLimit());
+
+    // The limit is only adjusted once a full window of 'limit' batches has completed.
+    completeInsertBatches(controller, 7, Milliseconds(20));
+    ASSERT_EQ(8, controller.getLimit());
+    completeInsertBatches(controller, 1, Milliseconds(20));
+    ASSERT_EQ(4, controller.getLimit());
+
+    completeInsertBatches(controller, 4, Milliseconds(20));
+    ASSERT_EQ(2, controller.getLimit());
+    completeInsertBatches(controller, 2, Milliseconds(20));
+    ASSERT_EQ(1, controller.getLimit());
+    completeInsertBatches(controller, 1, Milliseconds(20));
+    ASSERT_EQ(1, controller.getLimit());
+}
+
+TEST_F(MigrationConcurrencyControllerTest, FastInsertBatchesGrowLimitBackToMaximum) {
+    MigrationConcurrencyController controller(4, Milliseconds(10));
+    completeInsertBatches(controller, 4, Milliseconds(20));
+    completeInsertBatches(controller, 2, Milliseconds(20));
+    ASSERT_EQ(1, controller.getLimit());
+
+    completeInsertBatches(controller, 1, Milliseconds(5));
+    ASSERT_EQ(2, controller.getLimit());
+    completeInsertBatches(controller, 2, Milliseconds(5));
+    ASSERT_EQ(3, controller.getLimit());
+    completeInsertBatches(controller, 3, Milliseconds(5));
+    ASSERT_EQ(4, controller.getLimit());
+    completeInsertBatches(controller, 8, Milliseconds(5));
+    ASSERT_EQ(4, controller.getLimit());
+}
+
+TEST_F(MigrationConcurrencyControllerTest, OneSlowBatchInWindowHalvesLimit) {
+    MigrationConcurrencyController controller(4, Milliseconds(10));
+    completeInsertBatches(controller, 3, Milliseconds(5));
+    completeInsertBatches(controller, 1, Milliseconds(20));
+    ASSERT_EQ(2, controller.getLimit());
+}
+
+TEST_F(MigrationConcurrencyControllerTest, ExhaustedWriteTicketsHalveLimit) {
+    MigrationConcurrencyController controller(4, Milliseconds(10));
+    completeInsertBatches(controller, 4, Milliseconds(5), true /* writeTicketsExhausted */);
+    ASSERT_EQ(2, controller.getLimit());
+}
+
+TEST_F(MigrationConcurrencyControllerTest, AcquireBlocksWhileLimitIsReached) {
+    MigrationConcurrencyController controller(2, Milliseconds(10));
+    completeInsertBatches(controller, 2, Milliseconds(20));
+    ASSERT_EQ(1, controller.getLimit());
+
+    controller.acquireFetchSlot(_opCtx.get());
+    controller.acquireInsertSlot(_opCtx.get());
+
+    _opCtx->setDeadlineAfterNowBy(Milliseconds(10), ErrorCodes::ExceededTimeLimit);
+    ASSERT_THROWS_CODE(controller.acquireFetchSlot(_opCtx.get()),
+                       DBException,
+                       ErrorCodes::ExceededTimeLimit);
+    ASSERT_THROWS_CODE(controller.acquireInsertSlot(_opCtx.get()),
+                       DBException,
+                       ErrorCodes::ExceededTimeLimit);
+
+    controller.releaseFetchSlot();
+    controller.releaseInsertSlot(Milliseconds(5), false /* writeTicketsExhausted */);
+}
+
+}  // namespace
+}  // namespace mongo
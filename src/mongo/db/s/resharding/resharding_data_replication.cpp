@@ -212,6 +212,33 @@ std::shared_ptr<executor::TaskExecutor> ReshardingDataReplication::_makeCollecti
     return executor;
 }
 
+std::shared_ptr<executor::TaskExecutor> ReshardingDataReplication::_makeOplogApplierExecutor(
+    size_t numDonors) {
+    ThreadPool::Limits threadPoolLimits;
+    // The writer threads are shared by the oplog appliers for all donor shards so an applier with
+    // a backlog can use the threads left idle by the others. Each applier also transiently uses 1
+    // thread for retrieving its next batch and waiting on its writers.
+    threadPoolLimits.maxThreads = numDonors + resharding::gReshardingOplogApplierMaxThreadCount;
+    ThreadPool::Options threadPoolOptions(std::move(threadPoolLimits));
+
+    auto prefix = "ReshardingOplogApplier"_sd;
+    threadPoolOptions.threadNamePrefix = prefix + "-";
+    threadPoolOptions.poolName = prefix + "ThreadPool";
+    threadPoolOptions.onCreateThread = [](const std::string& threadName) {
+        Client::initThread(threadName.c_str(),
+                           getGlobalServiceContext()->getService(ClusterRole::ShardServer));
+        auto* client = Client::getCurrent();
+        AuthorizationSession::get(*client)->grantInternalAuthorization(client);
+    };
+
+    auto executor = std::make_shared<executor::ThreadPoolTaskExecutor>(
+        std::make_unique<ThreadPool>(std::move(threadPoolOptions)),
+        executor::makeNetworkInterface(prefix + "Network"));
+
+    executor->startup();
+    return executor;
+}
+
 std::vector<std::unique_ptr<ReshardingOplogApplier>> ReshardingDataReplication::_makeOplogAppliers(
     OperationContext* opCtx,
     ReshardingApplierMetricsMap* applierMetricsMap,
@@ -295,12 +322,18 @@ std::unique_ptr<ReshardingDataReplicationInterface> ReshardingDataReplication::m
                                             stashCollections,
                                             oplogFetchers);
 
+    std::shared_ptr<executor::TaskExecutor> oplogApplierExecutor;
+    if (resharding::gReshardingOplogApplierMaxThreadCount > 0) {
+        oplogApplierExecutor = _makeOplogApplierExecutor(donorShards.size());
+    }
+
     return std::make_unique<ReshardingDataReplication>(std::move(collectionCloner),
                                                        std::move(txnCloners),
                                                        std::move(oplogFetchers),
                                                        std::move(oplogFetcherExecutor),
                                                        std::move(oplogAppliers),
                                                        std::move(collectionClonerExecutor),
+                                                       std::move(oplogApplierExecutor),
                                                        TrustedInitTag{});
 }
 
@@ -311,13 +344,15 @@ ReshardingDataReplication::ReshardingDataReplication(
     std::shared_ptr<executor::TaskExecutor> oplogFetcherExecutor,
     std::vector<std::unique_ptr<ReshardingOplogApplier>> oplogAppliers,
     std::shared_ptr<executor::TaskExecutor> collectionClonerExecutor,
+    std::shared_ptr<executor::TaskExecutor> oplogApplierExecutor,
     TrustedInitTag)
     : _collectionCloner{std::move(collectionCloner)},
       _txnCloners{std::move(txnCloners)},
       _oplogFetchers{std::move(oplogFetchers)},
       _oplogFetcherExecutor{std::move(oplogFetcherExecutor)},
       _oplogAppliers{std::move(oplogAppliers)},
-      _collectionClonerExecutor{std::move(collectionClonerExecutor)} {}
+      _collectionClonerExecutor{std::move(collectionClonerExecutor)},
+      _oplogApplierExecutor{std::move(oplogApplierExecutor)} {}
 
 void ReshardingDataReplication::startOplogApplication() {
     ensureFulfilledPromise(_startOplogApplication);
@@ -458,6 +493,10 @@ std::vector<SharedSemiFuture<void>> ReshardingDataReplication::_runOplogAppliers
     std::vector<SharedSemiFuture<void>> oplogApplierFutures;
     oplogApplierFutures.reserve(_oplogAppliers.size());
 
+    if (_oplogApplierExecutor) {
+        executor = _oplogApplierExecutor;
+    }
+
     for (const auto& applier : _oplogAppliers) {
         // We must wait for the RecipientStateMachine to transition to kApplying before starting to
         // apply any oplog entries.
@@ -482,6 +521,9 @@ void ReshardingDataReplication::shutdown() {
     if (_collectionClonerExecutor) {
         _collectionClonerExecutor->shutdown();
     }
+    if (_oplogApplierExecutor) {
+        _oplogApplierExecutor->shutdown();
+    }
 }
 
 void ReshardingDataReplication::join() {
@@ -489,6 +531,9 @@ void ReshardingDataReplication::join() {
     if (_collectionClonerExecutor) {
         _collectionClonerExecutor->join();
     }
+    if (_oplogApplierExecutor) {
+        _oplogApplierExecutor->join();
+    }
 }
 
 std::vector<NamespaceString> ReshardingDataReplication::ensureStashCollectionsExist(
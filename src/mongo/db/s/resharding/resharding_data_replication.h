@@ -175,6 +175,7 @@ public:
                               std::shared_ptr<executor::TaskExecutor> oplogFetcherExecutor,
                               std::vector<std::unique_ptr<ReshardingOplogApplier>> oplogAppliers,
                               std::shared_ptr<executor::TaskExecutor> collectionClonerExecutor,
+                              std::shared_ptr<executor::TaskExecutor> oplogApplierExecutor,
                               TrustedInitTag);
 
     SemiFuture<void> runUntilStrictlyConsistent(
@@ -243,6 +244,8 @@ private:
 
     static std::shared_ptr<executor::TaskExecutor> _makeCollectionClonerExecutor(size_t numDonors);
 
+    static std::shared_ptr<executor::TaskExecutor> _makeOplogApplierExecutor(size_t numDonors);
+
     SharedSemiFuture<void> _runCollectionCloner(
         std::shared_ptr<executor::TaskExecutor> executor,
         std::shared_ptr<executor::TaskExecutor> cleanupExecutor,
@@ -280,6 +283,10 @@ private:
 
     const std::shared_ptr<executor::TaskExecutor> _collectionClonerExecutor;
 
+    // _oplogApplierExecutor is left as nullptr when reshardingOplogApplierMaxThreadCount is 0, in
+    // which case the oplog appliers run on the executor passed to runUntilStrictlyConsistent().
+    const std::shared_ptr<executor::TaskExecutor> _oplogApplierExecutor;
+
     // Promise fulfilled by startOplogApplication() to signal that oplog application can begin.
     SharedPromise<void> _startOplogApplication;
 
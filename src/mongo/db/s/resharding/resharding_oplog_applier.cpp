@@ -295,6 +295,7 @@ void ReshardingOplogApplier::_clearAppliedOpsAndStoreProgress(OperationContext*
         WriteConcerns::kLocalWriteConcern);
 
     _env->applierMetrics()->onOplogEntriesApplied(_currentBatchToApply.size());
+    _env->applierMetrics()->onOplogBatchApplied(lastOplog.getWallClockTime());
 
     _currentBatchToApply.clear();
     _currentDerivedOpsForCrudWriters.clear();
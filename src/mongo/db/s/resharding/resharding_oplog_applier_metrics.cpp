@@ -29,6 +29,8 @@
 
 #include "mongo/db/s/resharding/resharding_oplog_applier_metrics.h"
 
+#include <algorithm>
+
 #include <boost/optional/optional.hpp>
 
 namespace mongo {
@@ -77,6 +79,10 @@ void ReshardingOplogApplierMetrics::onWriteToStashCollections() {
     _metrics->onWriteToStashedCollections();
 }
 
+void ReshardingOplogApplierMetrics::onOplogBatchApplied(Date_t lastAppliedWallTime) {
+    _lastAppliedWallTimeMillis.store(lastAppliedWallTime.toMillisSinceEpoch());
+}
+
 int64_t ReshardingOplogApplierMetrics::getInsertsApplied() const {
     return _insertsApplied.load();
 }
@@ -97,4 +103,14 @@ int64_t ReshardingOplogApplierMetrics::getWritesToStashCollections() const {
     return _writesToStashCollections.load();
 }
 
+boost::optional<Milliseconds> ReshardingOplogApplierMetrics::getOplogApplicationLag(
+    Date_t now) const {
+    auto lastAppliedWallTimeMillis = _lastAppliedWallTimeMillis.load();
+    if (lastAppliedWallTimeMillis == 0) {
+        return boost::none;
+    }
+    return std::max(Milliseconds{0},
+                    now - Date_t::fromMillisSinceEpoch(lastAppliedWallTimeMillis));
+}
+
 }  // namespace mongo
@@ -37,6 +37,7 @@
 #include "mongo/db/s/resharding/resharding_oplog_applier_progress_gen.h"
 #include "mongo/platform/atomic_word.h"
 #include "mongo/util/duration.h"
+#include "mongo/util/time_support.h"
 
 namespace mongo {
 
@@ -57,12 +58,25 @@ public:
     void onOplogEntriesApplied(int64_t numEntries);
     void onWriteToStashCollections();
 
+    /**
+     * Records the donor's wall clock time for the last oplog entry in a batch which has been
+     * applied and had its progress stored.
+     */
+    void onOplogBatchApplied(Date_t lastAppliedWallTime);
+
     int64_t getInsertsApplied() const;
     int64_t getUpdatesApplied() const;
     int64_t getDeletesApplied() const;
     int64_t getOplogEntriesApplied() const;
     int64_t getWritesToStashCollections() const;
 
+    /**
+     * Returns how far oplog application for this donor trails 'now', measured against the donor's
+     * wall clock time for the last applied oplog entry. Returns boost::none until a batch has been
+     * applied.
+     */
+    boost::optional<Milliseconds> getOplogApplicationLag(Date_t now) const;
+
 private:
     ReshardingMetrics* _metrics;
     AtomicWord<int64_t> _insertsApplied{0};
@@ -70,6 +84,7 @@ private:
     AtomicWord<int64_t> _deletesApplied{0};
     AtomicWord<int64_t> _oplogEntriesApplied{0};
     AtomicWord<int64_t> _writesToStashCollections{0};
+    AtomicWord<long long> _lastAppliedWallTimeMillis{0};
 };
 
 }  // namespace mongo
@@ -167,5 +167,23 @@ TEST_F(ReshardingOplogApplierMetricsTest, ApplierDeleteProgressIncrementsIdepend
     ASSERT_EQ(report.getIntField("deletesApplied"), 1);
 }
 
+TEST_F(ReshardingOplogApplierMetricsTest, OplogApplicationLagTracksLastAppliedWallTime) {
+    auto metrics = createInstanceMetrics();
+    ReshardingOplogApplierMetrics applierMetrics(metrics.get(), boost::none);
+
+    auto now = getClockSource()->now();
+    ASSERT_FALSE(applierMetrics.getOplogApplicationLag(now));
+
+    applierMetrics.onOplogBatchApplied(now - Milliseconds(500));
+    ASSERT_EQ(*applierMetrics.getOplogApplicationLag(now), Milliseconds(500));
+
+    applierMetrics.onOplogBatchApplied(now - Milliseconds(20));
+    ASSERT_EQ(*applierMetrics.getOplogApplicationLag(now), Milliseconds(20));
+
+    // A donor whose wall clock runs ahead of the recipient's is not reported as negative lag.
+    applierMetrics.onOplogBatchApplied(now + Milliseconds(100));
+    ASSERT_EQ(*applierMetrics.getOplogApplicationLag(now), Milliseconds(0));
+}
+
 }  // namespace
 }  // namespace mongo
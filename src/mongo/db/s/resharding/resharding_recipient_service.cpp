@@ -636,7 +636,22 @@ boost::optional<BSONObj> ReshardingRecipientService::RecipientStateMachine::repo
     if (state == RecipientStateEnum::kBuildingIndex) {
         _fetchBuildIndexMetrics();
     }
-    return _metrics->reportForCurrentOp();
+
+    BSONObjBuilder bob;
+    bob.appendElements(_metrics->reportForCurrentOp());
+    {
+        // Report the oplog application lag for each donor separately so a single donor holding up
+        // the critical section can be told apart from the recipient falling behind all of them.
+        auto now = _serviceContext->getFastClockSource()->now();
+        BSONObjBuilder lagBuilder(bob.subobjStart("oplogApplicationLagMillisPerDonor"));
+        stdx::lock_guard lk(_mutex);
+        for (const auto& [shardId, applierMetrics] : _applierMetricsMap) {
+            if (auto lag = applierMetrics->getOplogApplicationLag(now)) {
+                lagBuilder.append(shardId.toString(), durationCount<Milliseconds>(*lag));
+            }
+        }
+    }
+    return bob.obj();
 }
 
 void ReshardingRecipientService::RecipientStateMachine::onReshardingFieldsChanges(
@@ -800,16 +815,19 @@ ReshardingRecipientService::RecipientStateMachine::_makeDataReplication(Operatio
         _externalState->getTrackedCollectionRoutingInfo(opCtx, _metadata.getSourceNss());
 
     // The metrics map can already be pre-populated if it was recovered from disk.
-    if (_applierMetricsMap.empty()) {
-        for (const auto& donor : _donorShards) {
-            _applierMetricsMap.emplace(
-                donor.getShardId(),
-                std::make_unique<ReshardingOplogApplierMetrics>(_metrics.get(), boost::none));
+    {
+        stdx::lock_guard lk(_mutex);
+        if (_applierMetricsMap.empty()) {
+            for (const auto& donor : _donorShards) {
+                _applierMetricsMap.emplace(
+                    donor.getShardId(),
+                    std::make_unique<ReshardingOplogApplierMetrics>(_metrics.get(), boost::none));
+            }
+        } else {
+            invariant(_applierMetricsMap.size() == _donorShards.size(),
+                      str::stream() << "applier metrics map size: " << _applierMetricsMap.size()
+                                    << " != donor shards count: " << _donorShards.size());
         }
-    } else {
-        invariant(_applierMetricsMap.size() == _donorShards.size(),
-                  str::stream() << "applier metrics map size: " << _applierMetricsMap.size()
-                                << " != donor shards count: " << _donorShards.size());
     }
 
     return _dataReplicationFactory(opCtx,
@@ -1526,6 +1544,7 @@ void ReshardingRecipientService::RecipientStateMachine::_restoreMetrics(
 
     // Restore stats here where interrupts will never occur, this is to ensure we will only update
     // the metrics only once.
+    stdx::unique_lock lk(_mutex);
     for (const auto& shardIdDocPair : progressDocList) {
         const auto& shardId = shardIdDocPair.first;
         const auto& progressDoc = shardIdDocPair.second;
@@ -1543,6 +1562,7 @@ void ReshardingRecipientService::RecipientStateMachine::_restoreMetrics(
             std::make_unique<ReshardingOplogApplierMetrics>(_metrics.get(), progressDoc);
         _applierMetricsMap.emplace(shardId, std::move(applierMetrics));
     }
+    lk.unlock();
 
     _metrics->restoreExternallyTrackedRecipientFields(externalMetrics);
 }
@@ -336,6 +336,7 @@ private:
     ServiceContext* _serviceContext;
 
     std::unique_ptr<ReshardingMetrics> _metrics;
+    // Modified under _mutex because reportForCurrentOp() reads it from other threads.
     ReshardingApplierMetricsMap _applierMetricsMap;
 
     // The in-memory representation of the immutable portion of the document in
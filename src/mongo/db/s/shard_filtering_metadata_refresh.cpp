@@ -34,11 +34,13 @@
 #include <boost/optional.hpp>
 #include <boost/smart_ptr.hpp>
 #include <boost/smart_ptr/intrusive_ptr.hpp>
+#include <algorithm>
 #include <fmt/format.h>
 #include <memory>
 #include <string>
 #include <tuple>
 #include <utility>
+#include <vector>
 
 #include <boost/optional/optional.hpp>
 
@@ -50,8 +52,10 @@
 #include "mongo/db/concurrency/d_concurrency.h"
 #include "mongo/db/concurrency/lock_manager_defs.h"
 #include "mongo/db/curop.h"
+#include "mongo/db/dbdirectclient.h"
 #include "mongo/db/database_name.h"
 #include "mongo/db/operation_context.h"
+#include "mongo/db/query/find_command.h"
 #include "mongo/db/repl/member_state.h"
 #include "mongo/db/repl/replication_coordinator.h"
 #include "mongo/db/s/collection_sharding_runtime.h"
@@ -62,6 +66,8 @@
 #include "mongo/db/s/operation_sharding_state.h"
 #include "mongo/db/s/resharding/resharding_donor_recipient_common.h"
 #include "mongo/db/s/sharding_migration_critical_section.h"
+#include "mongo/db/s/sharding_runtime_d_params_gen.h"
+#include "mongo/db/s/type_shard_collection.h"
 #include "mongo/db/service_context.h"
 #include "mongo/db/tenant_id.h"
 #include "mongo/db/transaction_resources.h"
@@ -772,4 +778,78 @@ Status onDbVersionMismatchNoExcept(OperationContext* opCtx,
     }
 }
 
+void preloadFilteringMetadataAsync(OperationContext* opCtx) {
+    const auto timeoutMS = filteringMetadataPreloadOnStepUpTimeoutMS.load();
+    if (timeoutMS <= 0) {
+        return;
+    }
+
+    struct PreloadState {
+        std::vector<NamespaceString> namespaces;
+        AtomicWord<size_t> nextIndex{0};
+        Date_t deadline;
+    };
+    auto state = std::make_shared<PreloadState>();
+    state->deadline =
+        opCtx->getServiceContext()->getFastClockSource()->now() + Milliseconds(timeoutMS);
+
+    try {
+        DBDirectClient client(opCtx);
+        FindCommandRequest findRequest{NamespaceString::kShardConfigCollectionsNamespace};
+        auto cursor = client.find(std::move(findRequest));
+        while (cursor && cursor->more()) {
+            state->namespaces.push_back(ShardCollectionType(cursor->nextSafe()).getNss());
+        }
+    } catch (const DBException& ex) {
+        LOGV2_WARNING(9156655,
+                      "Failed to read the persisted routing metadata cache, not preloading "
+                      "filtering metadata",
+                      "error"_attr = redact(ex));
+        return;
+    }
+
+    const size_t numWorkers =
+        std::min(state->namespaces.size(),
+                 static_cast<size_t>(filteringMetadataPreloadOnStepUpConcurrency.load()));
+    LOGV2_DEBUG(9156656,
+                1,
+                "Preloading filtering metadata",
+                "numCollections"_attr = state->namespaces.size(),
+                "concurrency"_attr = numWorkers,
+                "deadline"_attr = state->deadline);
+
+    for (size_t i = 0; i < numWorkers; ++i) {
+        ExecutorFuture<void>(Grid::get(opCtx)->getExecutorPool()->getFixedExecutor())
+            .then([svcCtx = opCtx->getServiceContext(), state] {
+                ThreadClient tc("FilteringMetadataPreload",
+                                svcCtx->getService(ClusterRole::ShardServer));
+                auto opCtx = tc->makeOperationContext();
+                opCtx->setDeadlineByDate(state->deadline, ErrorCodes::ExceededTimeLimit);
+
+                while (true) {
+                    const auto index = state->nextIndex.fetchAndAdd(1);
+                    if (index >= state->namespaces.size()) {
+                        return;
+                    }
+
+                    // A collection that is accessed meanwhile simply joins the refresh which is
+                    // already in progress, or finds its metadata already installed. A failure to
+                    // refresh one collection doesn't stop the others, unless we ran out of time.
+                    onCollectionPlacementVersionMismatchNoExcept(
+                        opCtx.get(), state->namespaces[index], boost::none /* chunkVersion */)
+                        .ignore();
+                    opCtx->checkForInterrupt();
+                }
+            })
+            .getAsync([](const Status& status) {
+                if (!status.isOK()) {
+                    LOGV2_DEBUG(9156657,
+                                1,
+                                "Stopped preloading filtering metadata",
+                                "error"_attr = redact(status));
+                }
+            });
+    }
+}
+
 }  // namespace mongo
@@ -99,4 +99,14 @@ Status onDbVersionMismatchNoExcept(OperationContext* opCtx,
                                    const DatabaseName& dbName,
                                    boost::optional<DatabaseVersion> clientDbVersion) noexcept;
 
+/**
+ * Meant to be called on step-up. Schedules background refreshes of the filtering metadata of every
+ * collection with an entry in this shard's persisted routing metadata cache
+ * (config.cache.collections). Without this, the first operation on each collection has to wait
+ * for that collection's refresh. At most 'filteringMetadataPreloadOnStepUpConcurrency'
+ * collections are refreshed at a time. Refreshes that have not finished within
+ * 'filteringMetadataPreloadOnStepUpTimeoutMS' are abandoned. Does nothing if that timeout is 0.
+ */
+void preloadFilteringMetadataAsync(OperationContext* opCtx);
+
 }  // namespace mongo
@@ -47,9 +47,13 @@
 #include "mongo/db/db_raii.h"
 #include "mongo/db/namespace_string.h"
 #include "mongo/db/operation_context.h"
+#include "mongo/db/s/analyze_shard_key_read_write_distribution.h"
 #include "mongo/db/s/balancer_stats_registry.h"
 #include "mongo/db/service_context.h"
+#include "mongo/logv2/log.h"
 #include "mongo/rpc/op_msg.h"
+#include "mongo/s/chunk_manager.h"
+#include "mongo/s/collection_routing_info_targeter.h"
 #include "mongo/s/request_types/get_stats_for_balancing_gen.h"
 #include "mongo/s/sharding_state.h"
 #include "mongo/util/assert_util.h"
@@ -106,7 +110,10 @@ public:
             for (const auto& nsWithOptUUID : request().getCollections()) {
                 const auto collDataSizeScaled = static_cast<long long>(
                     _getCollDataSizeBytes(opCtx, nsWithOptUUID) / scaleFactor);
-                collStats.emplace_back(nsWithOptUUID.getNs(), collDataSizeScaled);
+                auto& stats = collStats.emplace_back(nsWithOptUUID.getNs(), collDataSizeScaled);
+                if (request().getIncludeSampledLoad()) {
+                    stats.setSampledLoadByRange(_getSampledLoadByRange(opCtx, nsWithOptUUID));
+                }
             }
             return {std::move(collStats)};
         }
@@ -150,6 +157,61 @@ public:
             return avgObjSizeBytes * (numRecords - numOrphanDocs);
         }
 
+        /**
+         * Returns the number of sampled queries stored on this shard that targeted each range this
+         * shard owns, according to its current routing table for the collection. Returns
+         * boost::none if the collection isn't sharded or the load could not be computed, so that a
+         * failure only degrades the balancer to data size balancing for that collection.
+         */
+        boost::optional<std::vector<RangeLoadForBalancing>> _getSampledLoadByRange(
+            OperationContext* opCtx, const NamespaceWithOptionalUUID& nsWithOptUUID) const {
+            try {
+                CollectionRoutingInfoTargeter targeter(opCtx, nsWithOptUUID.getNs());
+                const auto& cm = targeter.getRoutingInfo().cm;
+                if (!cm.isSharded()) {
+                    return boost::none;
+                }
+                if (auto wantedCollUUID = nsWithOptUUID.getUUID()) {
+                    if (*wantedCollUUID != cm.getUUID()) {
+                        return boost::none;
+                    }
+                }
+
+                analyze_shard_key::ReadDistributionMetricsCalculator readCalculator(targeter);
+                analyze_shard_key::WriteDistributionMetricsCalculator writeCalculator(targeter);
+                analyze_shard_key::processSampledQueries(
+                    opCtx, &readCalculator, &writeCalculator, cm.getUUID());
+
+                const auto myShardId = ShardingState::get(opCtx)->shardId();
+                const auto& numReadsByRange = readCalculator.getNumByRange();
+                const auto& numWritesByRange = writeCalculator.getNumByRange();
+
+                std::vector<RangeLoadForBalancing> loadByRange;
+                cm.forEachChunk([&](const auto& chunk) {
+                    if (chunk.getShardId() != myShardId) {
+                        return true;
+                    }
+                    const auto numQueries = numReadsByRange.at(chunk.getRange()) +
+                        numWritesByRange.at(chunk.getRange());
+                    if (numQueries > 0) {
+                        loadByRange.emplace_back(chunk.getMin(), chunk.getMax(), numQueries);
+                    }
+                    return true;
+                });
+                return loadByRange;
+            } catch (const DBException& ex) {
+                if (ErrorCodes::isInterruption(ex.code())) {
+                    throw;
+                }
+                LOGV2_DEBUG(9156630,
+                            1,
+                            "Failed to compute the sampled load for balancing",
+                            logAttrs(nsWithOptUUID.getNs()),
+                            "error"_attr = redact(ex));
+                return boost::none;
+            }
+        }
+
         NamespaceString ns() const override {
             return NamespaceString(request().getDbName());
         }
@@ -2400,6 +2400,9 @@ void HandleRequest::completeOperation(DbResponse& response) {
             durationCount<Microseconds>(currentOp.elapsedTimeExcludingPauses()),
             currentOp.getReadWriteType());
 
+    if (auto command = currentOp.getCommand())
+        command->recordLatency(currentOp.elapsedTimeExcludingPauses());
+
     if (shouldProfile) {
         // Performance profiling is on
         if (shard_role_details::getLocker(opCtx)->isReadLocked()) {
@@ -168,7 +168,7 @@ size_t LogicalSessionCacheImpl::size() {
 
 void LogicalSessionCacheImpl::_periodicRefresh(Client* client) {
     try {
-        _refresh(client);
+        _refresh(client, true /* spreadWrites */);
     } catch (const DBException& ex) {
         LOGV2(20710,
               "Failed to refresh session cache, will try again at the next refresh interval",
@@ -251,7 +251,7 @@ Status LogicalSessionCacheImpl::_reap(Client* client) {
     return Status::OK();
 }
 
-void LogicalSessionCacheImpl::_refresh(Client* client) {
+void LogicalSessionCacheImpl::_refresh(Client* client, bool spreadWrites) {
     // get or make an opCtx
     boost::optional<ServiceContext::UniqueOperationContext> uniqueCtx;
     auto* const opCtx = [&client, &uniqueCtx] {
@@ -344,8 +344,32 @@ void LogicalSessionCacheImpl::_refresh(Client* client) {
         activeSessionRecords.insert(it.second);
     }
 
-    // Refresh the active sessions in the sessions collection.
-    _sessionsColl->refreshSessions(opCtx, activeSessionRecords);
+    // Refresh the active sessions in the sessions collection. When spreading the writes, send them
+    // one batch at a time with a pause in between, so that the sessions collection sees a steady
+    // trickle of updates rather than a burst at every refresh interval.
+    const auto spreadMillis = spreadWrites
+        ? std::min(logicalSessionRefreshSpreadMillis.load(), logicalSessionRefreshMillis / 2)
+        : 0;
+    constexpr auto kBatchSize = SessionsCollection::kMaxBatchSize;
+    if (spreadMillis > 0 && activeSessionRecords.size() > kBatchSize) {
+        const auto numBatches = (activeSessionRecords.size() + kBatchSize - 1) / kBatchSize;
+        const Milliseconds pause(spreadMillis / static_cast<long long>(numBatches));
+
+        LogicalSessionRecordSet batch;
+        for (const auto& record : activeSessionRecords) {
+            batch.insert(record);
+            if (batch.size() == kBatchSize) {
+                _sessionsColl->refreshSessions(opCtx, batch);
+                batch.clear();
+                opCtx->sleepFor(pause);
+            }
+        }
+        if (!batch.empty()) {
+            _sessionsColl->refreshSessions(opCtx, batch);
+        }
+    } else {
+        _sessionsColl->refreshSessions(opCtx, activeSessionRecords);
+    }
     activeSessionsBackSwapper.dismiss();
     {
         stdx::lock_guard<Latch> lk(_mutex);
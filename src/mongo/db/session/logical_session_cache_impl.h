@@ -107,7 +107,12 @@ public:
 
 private:
     void _periodicRefresh(Client* client);
-    void _refresh(Client* client);
+    /**
+     * Writes the active sessions to the sessions collection and ends the explicitly ended ones. If
+     * 'spreadWrites' is true, the writes of active sessions are paced over
+     * 'logicalSessionRefreshSpreadMillis' instead of being sent back to back.
+     */
+    void _refresh(Client* client, bool spreadWrites = false);
 
     void _periodicReap(Client* client);
     Status _reap(Client* client);
@@ -55,14 +55,6 @@
 namespace mongo {
 namespace {
 
-// This batch size is chosen to ensure that we don't form requests larger than the 16mb limit.
-// Especially for refreshes, the updates we send include the full user name (user@db), and user
-// names can be quite large (we enforce a max 10k limit for usernames used with sessions).
-//
-// At 1000 elements, a 16mb payload gives us a budget of 16000 bytes per user, which we should
-// comfortably be able to stay under, even with 10k user names.
-constexpr size_t kMaxBatchSize = 1000;
-
 // Used to refresh or remove items from the session collection with write
 // concern majority
 const WriteConcernOptions kMajorityWriteConcern{WriteConcernOptions::kMajority,
@@ -114,7 +106,7 @@ void runBulkGeneric(TFactory makeT, AddLineFn addLine, SendFn sendBatch, const C
     for (const auto& item : items) {
         addLine(*thing, item);
 
-        if (++i >= kMaxBatchSize) {
+        if (++i >= SessionsCollection::kMaxBatchSize) {
             sendLocalBatch();
 
             setupBatch();
@@ -157,6 +149,7 @@ void runBulkCmd(StringData label,
 }  // namespace
 
 constexpr StringData SessionsCollection::kSessionsTTLIndex;
+constexpr std::size_t SessionsCollection::kMaxBatchSize;
 
 SessionsCollection::SessionsCollection() = default;
 
@@ -29,6 +29,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <functional>
 #include <vector>
 
@@ -53,6 +54,16 @@ class SessionsCollection {
 public:
     static constexpr StringData kSessionsTTLIndex = "lsidTTLIndex"_sd;
 
+    // The maximum number of sessions written to the sessions collection by a single command.
+    //
+    // This batch size is chosen to ensure that we don't form requests larger than the 16mb limit.
+    // Especially for refreshes, the updates we send include the full user name (user@db), and user
+    // names can be quite large (we enforce a max 10k limit for usernames used with sessions).
+    //
+    // At 1000 elements, a 16mb payload gives us a budget of 16000 bytes per user, which we should
+    // comfortably be able to stay under, even with 10k user names.
+    static constexpr std::size_t kMaxBatchSize = 1000;
+
     virtual ~SessionsCollection();
 
     /**
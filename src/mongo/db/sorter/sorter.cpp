@@ -50,6 +50,7 @@
 
 #include <algorithm>
 #include <cerrno>
+#include <concepts>
 #include <cstdint>
 #include <cstdlib>
 #include <cstring>
@@ -60,6 +61,7 @@
 #include <iterator>
 #include <limits>
 #include <memory>
+#include <numeric>
 #include <queue>
 #include <snappy.h>
 #include <string>
@@ -76,6 +78,7 @@
 #include "mongo/base/data_range.h"
 #include "mongo/base/error_codes.h"
 #include "mongo/base/status.h"
+#include "mongo/base/string_data.h"
 #include "mongo/bson/util/builder.h"
 #include "mongo/bson/util/builder_fwd.h"
 #include "mongo/config.h"  // IWYU pragma: keep
@@ -83,14 +86,19 @@
 #include "mongo/db/server_options.h"
 #include "mongo/db/service_context.h"
 #include "mongo/db/sorter/sorter_checksum_calculator.h"
+#include "mongo/db/sorter/sorter_compression.h"
 #include "mongo/db/sorter/sorter_gen.h"
 #include "mongo/db/sorter/sorter_stats.h"
+#include "mongo/db/sorter/sorter_worker_pool.h"
 #include "mongo/db/storage/encryption_hooks.h"
 #include "mongo/db/storage/storage_parameters_gen.h"
+#include "mongo/idl/idl_parser.h"
 #include "mongo/logv2/log.h"
 #include "mongo/logv2/log_attr.h"
 #include "mongo/logv2/log_component.h"
 #include "mongo/platform/atomic_word.h"
+#include "mongo/platform/mutex.h"
+#include "mongo/stdx/condition_variable.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/bufreader.h"
 #include "mongo/util/destructor_guard.h"
@@ -132,6 +140,14 @@ EncryptionHooks* getEncryptionHooksIfEnabled() {
 
 constexpr std::size_t kSortedFileBufferSize = 64 * 1024;
 
+/**
+ * Returns the memory that an iterator over a spilled range buffers. When reading ahead, it also
+ * holds the next block while the current one is consumed.
+ */
+std::size_t spilledRangeBufferSize(bool readAhead) {
+    return readAhead ? 2 * kSortedFileBufferSize : kSortedFileBufferSize;
+}
+
 }  // namespace
 
 namespace sorter {
@@ -282,13 +298,15 @@ public:
                  const Settings& settings,
                  const boost::optional<DatabaseName>& dbName,
                  const size_t checksum,
-                 const SorterChecksumVersion checksumVersion)
+                 const SorterChecksumVersion checksumVersion,
+                 const SorterCompressor compressor = SorterCompressor::kSnappy)
         : _settings(settings),
           _file(std::move(file)),
           _fileStartOffset(fileStartOffset),
           _fileCurrentOffset(fileStartOffset),
           _fileEndOffset(fileEndOffset),
           _dbName(dbName),
+          _compressor(compressor),
           _afterReadChecksumCalculator(checksumVersion),
           _originalChecksum(checksum) {}
 
@@ -362,6 +380,9 @@ public:
         if (_afterReadChecksumCalculator.version() != SorterChecksumVersion::v1) {
             range.setChecksumVersion(_afterReadChecksumCalculator.version());
         }
+        if (_compressor != SorterCompressor::kSnappy) {
+            range.setCompressor(_compressor);
+        }
         return range;
     }
 
@@ -388,18 +409,15 @@ private:
      */
     void _fillBufferFromDisk() {
         int32_t rawSize;
-        _read(&rawSize, sizeof(rawSize));
-        if (_done)
+        if (!_readRawBlock(&rawSize)) {
+            _done = true;
             return;
+        }
 
         // negative size means compressed
         const bool compressed = rawSize < 0;
         int32_t blockSize = std::abs(rawSize);
 
-        _buffer.reset(new char[blockSize]);
-        _read(_buffer.get(), blockSize);
-        uassert(16816, "file too short?", !_done);
-
         if (auto encryptionHooks = getEncryptionHooksIfEnabled()) {
             std::unique_ptr<char[]> out(new char[blockSize]);
             size_t outLen;
@@ -422,17 +440,22 @@ private:
             return;
         }
 
-        dassert(snappy::IsValidCompressedBuffer(_buffer.get(), blockSize));
-
         size_t uncompressedSize;
-        uassert(17061,
-                "couldn't get uncompressed length",
-                snappy::GetUncompressedLength(_buffer.get(), blockSize, &uncompressedSize));
+        std::unique_ptr<char[]> decompressionBuffer;
+        if (_compressor == SorterCompressor::kZstd) {
+            decompressionBuffer = zstdUncompress(_buffer.get(), blockSize, &uncompressedSize);
+        } else {
+            dassert(snappy::IsValidCompressedBuffer(_buffer.get(), blockSize));
+
+            uassert(17061,
+                    "couldn't get uncompressed length",
+                    snappy::GetUncompressedLength(_buffer.get(), blockSize, &uncompressedSize));
 
-        std::unique_ptr<char[]> decompressionBuffer(new char[uncompressedSize]);
-        uassert(17062,
-                "decompression failed",
-                snappy::RawUncompress(_buffer.get(), blockSize, decompressionBuffer.get()));
+            decompressionBuffer.reset(new char[uncompressedSize]);
+            uassert(17062,
+                    "decompression failed",
+                    snappy::RawUncompress(_buffer.get(), blockSize, decompressionBuffer.get()));
+        }
 
         // hold on to decompressed data and throw out compressed data at block exit
         _buffer.swap(decompressionBuffer);
@@ -440,20 +463,120 @@ private:
     }
 
     /**
-     * Attempts to read data from disk. Sets _done to true when file offset reaches _fileEndOffset.
+     * A block of the range read from disk as is, with its size header.
      */
-    void _read(void* out, size_t size) {
-        if (_fileCurrentOffset == _fileEndOffset) {
-            _done = true;
-            return;
+    struct RawBlock {
+        int32_t rawSize = 0;
+        std::unique_ptr<char[]> data;
+    };
+
+    /**
+     * The read of the block following the one being consumed, running on a read-ahead thread.
+     */
+    struct ReadAhead {
+        Mutex mutex = MONGO_MAKE_LATCH("FileIterator::ReadAhead::mutex");
+        stdx::condition_variable cv;
+        bool ready = false;
+
+        // Set once 'ready'. No block means that the range had no more data.
+        boost::optional<RawBlock> block;
+        std::streamoff nextOffset = 0;
+        Status status = Status::OK();
+    };
+
+    /**
+     * Reads the block starting at '*offset' into 'out', and advances '*offset' past it. Returns
+     * false if '*offset' is already at 'endOffset'.
+     */
+    static bool _readRawBlockAt(typename Sorter<Key, Value>::File& file,
+                                std::streamoff* offset,
+                                std::streamoff endOffset,
+                                RawBlock* out) {
+        auto read = [&](void* dest, size_t size) {
+            if (*offset == endOffset) {
+                return false;
+            }
+
+            invariant(*offset < endOffset,
+                      str::stream() << "Current file offset (" << *offset
+                                    << ") greater than end offset (" << endOffset << ")");
+
+            file.read(*offset, size, dest);
+            *offset += size;
+            return true;
+        };
+
+        if (!read(&out->rawSize, sizeof(out->rawSize))) {
+            return false;
         }
 
-        invariant(_fileCurrentOffset < _fileEndOffset,
-                  str::stream() << "Current file offset (" << _fileCurrentOffset
-                                << ") greater than end offset (" << _fileEndOffset << ")");
+        int32_t blockSize = std::abs(out->rawSize);
+        out->data.reset(new char[blockSize]);
+        uassert(16816, "file too short?", read(out->data.get(), blockSize));
+        return true;
+    }
+
+    /**
+     * Places the next raw block of the range in _buffer, either from the pending read-ahead or by
+     * reading it now, and then starts reading ahead the block after it. Returns false if the range
+     * has no more data.
+     */
+    bool _readRawBlock(int32_t* rawSize) {
+        boost::optional<RawBlock> block;
+        if (auto readAhead = std::exchange(_readAhead, nullptr)) {
+            stdx::unique_lock<Latch> lk(readAhead->mutex);
+            readAhead->cv.wait(lk, [&] { return readAhead->ready; });
+            uassertStatusOK(readAhead->status);
+            _fileCurrentOffset = readAhead->nextOffset;
+            block = std::move(readAhead->block);
+        } else {
+            RawBlock syncBlock;
+            if (_readRawBlockAt(*_file, &_fileCurrentOffset, _fileEndOffset, &syncBlock)) {
+                block = std::move(syncBlock);
+            }
+        }
 
-        _file->read(_fileCurrentOffset, size, out);
-        _fileCurrentOffset += size;
+        if (!block) {
+            return false;
+        }
+
+        *rawSize = block->rawSize;
+        _buffer = std::move(block->data);
+
+        if (_fileCurrentOffset != _fileEndOffset && _readAheadEnabled) {
+            _startReadAhead();
+        }
+        return true;
+    }
+
+    /**
+     * Starts reading the block at _fileCurrentOffset on a read-ahead thread. Double buffers the
+     * range: the block is read while the caller consumes the current one.
+     */
+    void _startReadAhead() {
+        auto readAhead = std::make_shared<ReadAhead>();
+        _readAhead = readAhead;
+        sorter::scheduleSorterTask(
+            [readAhead, file = _file, offset = _fileCurrentOffset, endOffset = _fileEndOffset] {
+                boost::optional<RawBlock> block;
+                std::streamoff nextOffset = offset;
+                Status status = Status::OK();
+                try {
+                    RawBlock readBlock;
+                    if (_readRawBlockAt(*file, &nextOffset, endOffset, &readBlock)) {
+                        block = std::move(readBlock);
+                    }
+                } catch (const DBException& ex) {
+                    status = ex.toStatus();
+                }
+
+                stdx::lock_guard<Latch> lk(readAhead->mutex);
+                readAhead->block = std::move(block);
+                readAhead->nextOffset = nextOffset;
+                readAhead->status = std::move(status);
+                readAhead->ready = true;
+                readAhead->cv.notify_one();
+            });
     }
 
     const Settings _settings;
@@ -461,12 +584,21 @@ private:
 
     std::unique_ptr<char[]> _buffer;
     std::unique_ptr<BufReader> _bufferReader;
+
+    // Whether the next block is read ahead. Fixed for the lifetime of the iterator, as the sorter
+    // decides how many ranges to merge at once from the memory each of them buffers.
+    const bool _readAheadEnabled = gSorterAsyncReadAhead.load();
+
+    // The read of the next block, if one is in flight or done but not yet consumed.
+    std::shared_ptr<ReadAhead> _readAhead;
+
     std::shared_ptr<typename Sorter<Key, Value>::File>
         _file;                          // File containing the sorted data range.
     std::streamoff _fileStartOffset;    // File offset at which the sorted data range starts.
     std::streamoff _fileCurrentOffset;  // File offset at which we are currently reading from.
     std::streamoff _fileEndOffset;      // File offset at which the sorted data range ends.
     boost::optional<DatabaseName> _dbName;
+    SorterCompressor _compressor;  // Codec the compressed blocks of the range were written with.
 
     // Points to the beginning of a serialized key in the key-value pair currently being read, and
     // used for computing the checksum value. This is set to nullptr after reading each key-value
@@ -702,8 +834,10 @@ protected:
      * reduce the spills to that number if necessary by merging them iteratively.
      */
     void _mergeSpillsToRespectMemoryLimits() {
-        auto numTargetedSpills = std::max(this->_opts.maxMemoryUsageBytes / kSortedFileBufferSize,
-                                          static_cast<std::size_t>(2));
+        auto numTargetedSpills =
+            std::max(this->_opts.maxMemoryUsageBytes /
+                         spilledRangeBufferSize(gSorterAsyncReadAhead.load()),
+                     static_cast<std::size_t>(2));
         if (this->_iters.size() > numTargetedSpills) {
             this->_mergeSpills(numTargetedSpills);
         }
@@ -829,7 +963,8 @@ public:
                                this->_settings,
                                this->_opts.dbName,
                                range.getChecksum(),
-                               range.getChecksumVersion().value_or(SorterChecksumVersion::v1));
+                               range.getChecksumVersion().value_or(SorterChecksumVersion::v1),
+                               range.getCompressor().value_or(SorterCompressor::kSnappy));
                        });
         this->_stats.setSpilledRanges(this->_iters.size());
     }
@@ -914,9 +1049,63 @@ private:
         const Comparator& _comp;
     };
 
+    /**
+     * Sorts '_data' by memcmp on normalized encodings of the keys, if the comparator can produce
+     * them for every key. Returns false, leaving '_data' untouched, otherwise.
+     */
+    bool sortByNormalizedKeys() {
+        if constexpr (requires(const Comparator& comp, const Key& key, std::string* out) {
+                          { comp.appendNormalizedKey(key, out) } -> std::same_as<bool>;
+                      }) {
+            // Encode every key once, back to back in a single buffer.
+            std::string encodedKeys;
+            std::vector<size_t> offsets;
+            offsets.reserve(_data.size() + 1);
+            for (const auto& data : _data) {
+                offsets.push_back(encodedKeys.size());
+                if (!this->_comp.appendNormalizedKey(data.first, &encodedKeys)) {
+                    return false;
+                }
+            }
+            offsets.push_back(encodedKeys.size());
+
+            auto encodedKey = [&](size_t i) {
+                return StringData(encodedKeys.data() + offsets[i], offsets[i + 1] - offsets[i]);
+            };
+            std::vector<size_t> order(_data.size());
+            std::iota(order.begin(), order.end(), 0);
+            std::sort(order.begin(), order.end(), [&](size_t lhs, size_t rhs) {
+                return encodedKey(lhs) < encodedKey(rhs);
+            });
+
+            // Apply the permutation in place, one cycle at a time, so that '_data[i]' becomes the
+            // element which was at 'order[i]'.
+            for (size_t i = 0; i < order.size(); ++i) {
+                if (order[i] == i) {
+                    continue;
+                }
+                Data displaced = std::move(_data[i]);
+                size_t j = i;
+                while (order[j] != i) {
+                    const size_t next = order[j];
+                    _data[j] = std::move(_data[next]);
+                    order[j] = j;
+                    j = next;
+                }
+                _data[j] = std::move(displaced);
+                order[j] = j;
+            }
+            return true;
+        } else {
+            return false;
+        }
+    }
+
     void sort() {
-        STLComparator less(this->_comp);
-        std::sort(_data.begin(), _data.end(), less);
+        if (_data.size() < 2 || !sortByNormalizedKeys()) {
+            STLComparator less(this->_comp);
+            std::sort(_data.begin(), _data.end(), less);
+        }
         this->_stats.incrementNumSorted(_data.size());
         auto& memPool = this->_memPool;
         if (memPool) {
@@ -1086,7 +1275,7 @@ public:
         STLComparator less(this->_comp);
 
         if (_data.size() < this->_opts.limit) {
-            if (_haveCutoff && this->_comp(key, _cutoff.first) >= 0)
+            if (_haveCutoff && compareToThreshold(key, _cutoff.first) >= 0)
                 return;
 
             // Invoking dataProducer could invalidate key if it uses move semantics,
@@ -1096,8 +1285,10 @@ public:
             auto memUsage = keyVal.first.memUsageForSorter() + keyVal.second.memUsageForSorter();
             this->_stats.incrementMemUsage(memUsage);
 
-            if (_data.size() == this->_opts.limit)
+            if (_data.size() == this->_opts.limit) {
                 std::make_heap(_data.begin(), _data.end(), less);
+                refreshThresholdEncoding();
+            }
 
             if (this->_stats.memUsage() > this->_opts.maxMemoryUsageBytes)
                 spill();
@@ -1107,7 +1298,7 @@ public:
 
         invariant(_data.size() == this->_opts.limit);
 
-        if (this->_comp(key, _data.front().first) >= 0)
+        if (compareToThreshold(key, _data.front().first) >= 0)
             return;  // not good enough
 
         // Remove the old worst pair and insert the contender, adjusting _memUsed
@@ -1125,6 +1316,7 @@ public:
         this->_stats.incrementMemUsage(_data.back().second.memUsageForSorter());
 
         std::push_heap(_data.begin(), _data.end(), less);
+        refreshThresholdEncoding();
 
         if (this->_stats.memUsage() > this->_opts.maxMemoryUsageBytes)
             spill();
@@ -1189,6 +1381,54 @@ private:
         const Comparator& _comp;
     };
 
+    /**
+     * Appends the normalized encoding of 'key' to 'out' if the comparator can produce one, such
+     * that memcmp on two encodings orders them the same way as the comparator. Returns false
+     * otherwise.
+     */
+    bool appendNormalizedKey(const Key& key, std::string* out) const {
+        if constexpr (requires(const Comparator& comp, const Key& k, std::string* o) {
+                          { comp.appendNormalizedKey(k, o) } -> std::same_as<bool>;
+                      }) {
+            return this->_comp.appendNormalizedKey(key, out);
+        } else {
+            return false;
+        }
+    }
+
+    /**
+     * Re-encodes the key that incoming keys must beat to be kept: the top of the heap once '_data'
+     * is full, and '_cutoff' otherwise. Must be called whenever that key changes.
+     */
+    void refreshThresholdEncoding() {
+        _haveThresholdEncoding = false;
+        const Key* threshold = nullptr;
+        if (_data.size() == this->_opts.limit) {
+            threshold = &_data.front().first;
+        } else if (_haveCutoff) {
+            threshold = &_cutoff.first;
+        } else {
+            return;
+        }
+        _thresholdEncoding.clear();
+        _haveThresholdEncoding = appendNormalizedKey(*threshold, &_thresholdEncoding);
+    }
+
+    /**
+     * Compares 'key' against 'threshold', which must be the key last passed through
+     * refreshThresholdEncoding(). Most candidates of a top-k sort are rejected here, so when both
+     * sides have a normalized encoding a single memcmp replaces the full comparator.
+     */
+    int compareToThreshold(const Key& key, const Key& threshold) {
+        if (_haveThresholdEncoding) {
+            _candidateEncoding.clear();
+            if (appendNormalizedKey(key, &_candidateEncoding)) {
+                return StringData(_candidateEncoding).compare(StringData(_thresholdEncoding));
+            }
+        }
+        return this->_comp(key, threshold);
+    }
+
     void sort() {
         STLComparator less(this->_comp);
 
@@ -1312,6 +1552,9 @@ private:
         Iterator* iteratorPtr = writer.done();
         this->_iters.push_back(std::shared_ptr<Iterator>(iteratorPtr));
 
+        // '_data' is no longer a full heap, so '_cutoff' is the threshold from now on.
+        refreshThresholdEncoding();
+
         this->_stats.resetMemUsage();
         this->_stats.incrementSpilledRanges();
     }
@@ -1329,6 +1572,12 @@ private:
     size_t _worstCount;   // Number of docs better or equal to _worstSeen kept so far.
     Data _lastMedian;     // Median of a batch. Reset when _medianCount >= _opts.limit.
     size_t _medianCount;  // Number of docs better or equal to _lastMedian kept so far.
+
+    // Normalized encoding of the threshold key, see refreshThresholdEncoding(). The candidate
+    // buffer is reused across add() calls to avoid an allocation per key.
+    bool _haveThresholdEncoding = false;
+    std::string _thresholdEncoding;
+    std::string _candidateEncoding;
 };
 
 }  // namespace sorter
@@ -1434,6 +1683,8 @@ Sorter<Key, Value>::File::~File() {
 
 template <typename Key, typename Value>
 void Sorter<Key, Value>::File::read(std::streamoff offset, std::streamsize size, void* out) {
+    stdx::lock_guard<Latch> lk(_readMutex);
+
     if (!_file.is_open()) {
         _open();
     }
@@ -1548,6 +1799,7 @@ SortedFileWriter<Key, Value>::SortedFileWriter(
       _file(std::move(file)),
       _checksumCalculator(_getSorterChecksumVersion()),
       _fileStartOffset(_file->currentOffset()),
+      _compressor(_getSorterCompressor()),
       _opts(opts) {
     // This should be checked by consumers, but if we get here don't allow writes.
     uassert(16946,
@@ -1596,7 +1848,7 @@ void SortedFileWriter<Key, Value>::writeChunk() {
     }
 
     std::string compressed;
-    snappy::Compress(outBuffer, size, &compressed);
+    _compress(outBuffer, size, &compressed);
     invariant(compressed.size() <= size_t(std::numeric_limits<int32_t>::max()));
 
     const bool shouldCompress = compressed.size() < (size_t(_buffer.len()) / 10 * 9);
@@ -1641,7 +1893,8 @@ SortIteratorInterface<Key, Value>* SortedFileWriter<Key, Value>::done() {
                                                 _settings,
                                                 _opts.dbName,
                                                 _checksumCalculator.checksum(),
-                                                _checksumCalculator.version());
+                                                _checksumCalculator.version(),
+                                                _compressor);
 }
 
 template <typename Key, typename Value>
@@ -1653,10 +1906,18 @@ SortedFileWriter<Key, Value>::createFileIteratorForResume(
     const Settings& settings,
     const boost::optional<DatabaseName>& dbName,
     const size_t checksum,
-    const SorterChecksumVersion checksumVersion) {
-
-    return std::shared_ptr<SortIteratorInterface<Key, Value>>(new sorter::FileIterator<Key, Value>(
-        file, fileStartOffset, fileEndOffset, settings, dbName, checksum, checksumVersion));
+    const SorterChecksumVersion checksumVersion,
+    const SorterCompressor compressor) {
+
+    return std::shared_ptr<SortIteratorInterface<Key, Value>>(
+        new sorter::FileIterator<Key, Value>(file,
+                                             fileStartOffset,
+                                             fileEndOffset,
+                                             settings,
+                                             dbName,
+                                             checksum,
+                                             checksumVersion,
+                                             compressor));
 }
 
 template <typename Key, typename Value>
@@ -1671,6 +1932,28 @@ SorterChecksumVersion SortedFileWriter<Key, Value>::_getSorterChecksumVersion()
     return SorterChecksumVersion::v1;
 }
 
+template <typename Key, typename Value>
+SorterCompressor SortedFileWriter<Key, Value>::_getSorterCompressor() const {
+    // Like for the checksum version, the FCV may still be uninitialized during initial sync.
+    if (!gFeatureFlagSorterSpillCompressor.isEnabledUseLatestFCVWhenUninitialized(
+            serverGlobalParams.featureCompatibility.acquireFCVSnapshot())) {
+        return SorterCompressor::kSnappy;
+    }
+    return SorterCompressor_parse(IDLParserContext("sorterSpillCompressor"),
+                                  gSorterSpillCompressor.get());
+}
+
+template <typename Key, typename Value>
+void SortedFileWriter<Key, Value>::_compress(const char* data,
+                                             size_t size,
+                                             std::string* out) const {
+    if (_compressor == SorterCompressor::kZstd) {
+        sorter::zstdCompress(data, size, out);
+        return;
+    }
+    snappy::Compress(data, size, out);
+}
+
 template <typename Key, typename Value, typename Comparator, typename BoundMaker>
 BoundedSorter<Key, Value, Comparator, BoundMaker>::BoundedSorter(const SortOptions& opts,
                                                                  Comparator comp,
@@ -1682,6 +1965,8 @@ BoundedSorter<Key, Value, Comparator, BoundMaker>::BoundedSorter(const SortOptio
       _checkInput(checkInput),
       _opts(opts),
       _heap(Greater{&compare}),
+      _windowSize(gBoundedSorterParallelWindowSize.load()),
+      _nextCutSize(_windowSize),
       _file(opts.extSortAllowed ? std::make_shared<typename Sorter<Key, Value>::File>(
                                       opts.tempDir + "/" + nextFileName(), opts.sorterFileStats)
                                 : nullptr) {}
@@ -1701,14 +1986,87 @@ void BoundedSorter<Key, Value, Comparator, BoundMaker>::add(Key key, Value value
         _min = newMin;
 
     auto memUsage = key.memUsageForSorter() + value.memUsageForSorter();
-    _heap.emplace(std::move(key), std::move(value));
-
     this->_stats.incrementMemUsage(memUsage);
     this->_stats.incrementBytesSorted(memUsage);
+
+    if (_windowSize > 0) {
+        _pending.emplace_back(std::move(key), std::move(value));
+        if (this->_stats.memUsage() > _opts.maxMemoryUsageBytes) {
+            _leaveParallelMode();
+            _spill();
+        } else if (_pending.size() >= _nextCutSize) {
+            _cutWindow(false /* all */);
+        }
+        return;
+    }
+
+    _heap.emplace(std::move(key), std::move(value));
     if (this->_stats.memUsage() > _opts.maxMemoryUsageBytes)
         _spill();
 }
 
+template <typename Key, typename Value, typename Comparator, typename BoundMaker>
+void BoundedSorter<Key, Value, Comparator, BoundMaker>::_cutWindow(bool all) {
+    auto window = std::make_shared<Window>();
+    auto end = all ? _pending.end()
+                   : std::partition(_pending.begin(), _pending.end(), [&](const KV& kv) {
+                         return compare(kv.first, *_min) < 0;
+                     });
+    window->data.assign(std::make_move_iterator(_pending.begin()), std::make_move_iterator(end));
+    _pending.erase(_pending.begin(), end);
+
+    // Wait for another '_windowSize' elements before looking at the ones left behind again.
+    _nextCutSize = _pending.size() + _windowSize;
+    if (window->data.empty()) {
+        return;
+    }
+
+    _windows.push_back(window);
+    sorter::scheduleSorterTask([window, compare = compare] {
+        Status status = Status::OK();
+        try {
+            std::sort(window->data.begin(), window->data.end(), [&](const KV& lhs, const KV& rhs) {
+                return compare(lhs.first, rhs.first) < 0;
+            });
+        } catch (const DBException& ex) {
+            status = ex.toStatus();
+        }
+
+        stdx::lock_guard<Latch> lk(window->mutex);
+        window->status = std::move(status);
+        window->sorted = true;
+        window->cv.notify_all();
+    });
+}
+
+template <typename Key, typename Value, typename Comparator, typename BoundMaker>
+void BoundedSorter<Key, Value, Comparator, BoundMaker>::_leaveParallelMode() {
+    for (auto& window : _windows) {
+        window->waitUntilSorted();
+        for (size_t i = _windowPos; i < window->data.size(); ++i) {
+            _heap.push(std::move(window->data[i]));
+        }
+        _windowPos = 0;
+    }
+    _windows.clear();
+
+    for (auto& kv : _pending) {
+        _heap.push(std::move(kv));
+    }
+    _pending.clear();
+    _windowSize = 0;
+}
+
+template <typename Key, typename Value, typename Comparator, typename BoundMaker>
+void BoundedSorter<Key, Value, Comparator, BoundMaker>::_releaseMemUsage(const KV& kv) {
+    auto memUsage = kv.first.memUsageForSorter() + kv.second.memUsageForSorter();
+    if (static_cast<int64_t>(memUsage) > static_cast<int64_t>(this->_stats.memUsage())) {
+        this->_stats.resetMemUsage();
+    } else {
+        this->_stats.decrementMemUsage(memUsage);
+    }
+}
+
 template <typename Key, typename Value, typename Comparator, typename BoundMaker>
 void BoundedSorter<Key, Value, Comparator, BoundMaker>::restart() {
     tassert(
@@ -1721,6 +2079,13 @@ void BoundedSorter<Key, Value, Comparator, BoundMaker>::restart() {
     _heap = decltype(_heap){Greater{&compare}};
     this->_stats.resetMemUsage();
 
+    // A window still being sorted keeps its data alive until its worker is done with it.
+    _windows.clear();
+    _windowPos = 0;
+    _pending.clear();
+    _windowSize = gBoundedSorterParallelWindowSize.load();
+    _nextCutSize = _windowSize;
+
     _done = false;
     _min.reset();
 
@@ -1744,6 +2109,15 @@ BoundedSorter<Key, Value, Comparator, BoundMaker>::getState() const {
         return State::kDone;
     }
 
+    if (_windowSize > 0) {
+        // Everything pending was cut into a window by done(). Before that, let the caller keep
+        // adding input while the front window is being sorted.
+        if (_windows.empty()) {
+            return _done ? State::kDone : State::kWait;
+        }
+        return _done || _windows.front()->isSorted() ? State::kReady : State::kWait;
+    }
+
     if (_done) {
         // No more input will arrive, so we're never in state kWait.
         return _heap.empty() && !_spillIter ? State::kDone : State::kReady;
@@ -1771,16 +2145,25 @@ std::pair<Key, Value> BoundedSorter<Key, Value, Comparator, BoundMaker>::next()
     dassert(getState() == State::kReady);
     std::pair<Key, Value> result;
 
+    if (_windowSize > 0) {
+        auto& window = *_windows.front();
+        if (_windowPos == 0) {
+            window.waitUntilSorted();
+        }
+        result = std::move(window.data[_windowPos++]);
+        if (_windowPos == window.data.size()) {
+            _windows.pop_front();
+            _windowPos = 0;
+        }
+        _releaseMemUsage(result);
+        this->_stats.incrementNumSorted();
+        return result;
+    }
+
     auto pullFromHeap = [this, &result]() {
         result = std::move(_heap.top());
         _heap.pop();
-
-        auto memUsage = result.first.memUsageForSorter() + result.second.memUsageForSorter();
-        if (static_cast<int64_t>(memUsage) > static_cast<int64_t>(this->_stats.memUsage())) {
-            this->_stats.resetMemUsage();
-        } else {
-            this->_stats.decrementMemUsage(memUsage);
-        }
+        _releaseMemUsage(result);
     };
 
     auto pullFromSpilled = [this, &result]() {
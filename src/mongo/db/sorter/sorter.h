@@ -56,6 +56,8 @@
 #include "mongo/db/sorter/sorter_stats.h"
 #include "mongo/logv2/log_attr.h"
 #include "mongo/platform/atomic_word.h"
+#include "mongo/platform/mutex.h"
+#include "mongo/stdx/condition_variable.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/bufreader.h"
 #include "mongo/util/shared_buffer_fragment.h"
@@ -350,7 +352,8 @@ public:
 
         /**
          * Reads the requested data from the file. Cannot write more to the file once this has been
-         * called.
+         * called. Safe to call concurrently, e.g. from the threads reading ahead for iterators over
+         * ranges of this file.
          */
         void read(std::streamoff offset, std::streamsize size, void* out);
 
@@ -384,6 +387,9 @@ public:
 
         // If set, this points to an external metrics holder for tracking file open/close activity.
         SorterFileStats* _stats;
+
+        // Serializes reads, which share the position of '_file'.
+        Mutex _readMutex = MONGO_MAKE_LATCH("Sorter::File::_readMutex");
     };
 
     explicit Sorter(const SortOptions& opts);
@@ -556,6 +562,9 @@ public:
     void done() override {
         invariant(!_done);
         _done = true;
+        if (_windowSize > 0) {
+            _cutWindow(true /* all */);
+        }
     }
 
     void restart() override;
@@ -588,16 +597,60 @@ public:
 
 private:
     using SpillIterator = SortIteratorInterface<Key, Value>;
+    using KV = std::pair<Key, Value>;
+
+    /**
+     * A batch of input sorted on a worker thread. Every element of a window is below the bound at
+     * the time the window was cut, and every later input is not, so windows are returned one after
+     * the other without merging.
+     */
+    struct Window {
+        Mutex mutex = MONGO_MAKE_LATCH("BoundedSorter::Window::mutex");
+        stdx::condition_variable cv;
+        bool sorted = false;
+        Status status = Status::OK();
+        std::vector<KV> data;
+
+        bool isSorted() {
+            stdx::lock_guard<Latch> lk(mutex);
+            return sorted;
+        }
+
+        // Blocks until the worker is done and rethrows any error it hit.
+        void waitUntilSorted() {
+            stdx::unique_lock<Latch> lk(mutex);
+            cv.wait(lk, [&] { return sorted; });
+            uassertStatusOK(status);
+        }
+    };
 
     void _spill();
 
+    // Moves the pending elements below the bound, or all of them if 'all' is true, into a new
+    // Window and schedules its sort.
+    void _cutWindow(bool all);
+
+    // Moves everything buffered for windows back into '_heap' and disables windows until
+    // restart(), so that the sorter can spill.
+    void _leaveParallelMode();
+
+    void _releaseMemUsage(const KV& kv);
+
     bool _checkInput;
 
     const SortOptions _opts;
 
-    using KV = std::pair<Key, Value>;
     std::priority_queue<KV, std::vector<KV>, Greater> _heap;
 
+    // Parallel mode, enabled by 'boundedSorterParallelWindowSize': input goes to '_pending' instead
+    // of '_heap', and is returned from '_windows'. '_windowPos' is the next element of the front
+    // window to return.
+    size_t _windowSize;
+    size_t _nextCutSize;
+    std::vector<KV> _pending;
+    std::deque<std::shared_ptr<Window>> _windows;
+    size_t _windowPos = 0;
+
     std::shared_ptr<typename Sorter<Key, Value>::File> _file;
     std::shared_ptr<SpillIterator> _spillIter;
 
@@ -650,11 +703,25 @@ public:
         const Settings& settings,
         const boost::optional<DatabaseName>& dbName,
         size_t checksum,
-        SorterChecksumVersion checksumVersion);
+        SorterChecksumVersion checksumVersion,
+        SorterCompressor compressor = SorterCompressor::kSnappy);
 
 private:
     SorterChecksumVersion _getSorterChecksumVersion() const;
 
+    /**
+     * Returns the codec to compress the blocks with. Only ranges written with snappy can be read
+     * by binaries from before the compressor was recorded on the range, so other codecs are only
+     * used once the FCV allows it.
+     */
+    SorterCompressor _getSorterCompressor() const;
+
+    /**
+     * Compresses the 'size' bytes at 'data' into 'out' with the codec this writer was created
+     * with.
+     */
+    void _compress(const char* data, size_t size, std::string* out) const;
+
     const Settings _settings;
     std::shared_ptr<typename Sorter<Key, Value>::File> _file;
     BufBuilder _buffer;
@@ -667,6 +734,10 @@ private:
     // be given to the Iterator in done().
     std::streamoff _fileStartOffset;
 
+    // The codec used for every block of this range, chosen by 'sorterSpillCompressor' when the
+    // writer is created.
+    SorterCompressor _compressor;
+
     SortOptions _opts;
 };
 }  // namespace mongo
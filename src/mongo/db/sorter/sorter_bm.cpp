@@ -0,0 +1,318 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "mongo/db/record_id.h"
+#include "mongo/db/sorter/sorter.h"
+#include "mongo/db/sorter/sorter_stats.h"
+#include "mongo/db/storage/key_string.h"
+#include "mongo/platform/atomic_word.h"
+#include "mongo/platform/random.h"
+#include "mongo/unittest/temp_dir.h"
+
+namespace mongo {
+namespace {
+/**
+ * Generates a new file name on each call using a static, atomic and monotonically increasing
+ * number. See the comment on nextFileName() in sorter_test.cpp.
+ */
+std::string nextFileName() {
+    static AtomicWord<unsigned> sorterBenchmarkFileCounter;
+    return "extsort-sorter-bm." + std::to_string(sorterBenchmarkFileCounter.fetchAndAdd(1));
+}
+}  // namespace
+}  // namespace mongo
+
+#include "mongo/db/sorter/sorter.cpp"
+
+namespace mongo {
+namespace {
+
+// The number of keys fed to each sorter per benchmark iteration.
+constexpr size_t kNumKeys = 100 * 1000;
+
+// The maximum distance between the position of a key in the input to the BoundedSorter and its
+// position in the output.
+constexpr long long kBoundedSorterJitter = 100;
+
+using Key = key_string::Value;
+
+/**
+ * Matches the comparison index builds use for their external sorter.
+ */
+struct KeyComparator {
+    int operator()(const Key& lhs, const Key& rhs) const {
+        return lhs.compare(rhs);
+    }
+};
+
+/**
+ * The BoundedSorter needs a value from which to compute the bound of a key, just like the time
+ * field of a document in a $_internalBoundedSort.
+ */
+struct TimeValue {
+    struct SorterDeserializeSettings {};  // unused
+
+    void serializeForSorter(BufBuilder& buf) const {
+        buf.appendNum(time);
+    }
+    static TimeValue deserializeForSorter(BufReader& buf, const SorterDeserializeSettings&) {
+        return {buf.read<LittleEndian<long long>>()};
+    }
+    int memUsageForSorter() const {
+        return sizeof(TimeValue);
+    }
+    TimeValue getOwned() const {
+        return *this;
+    }
+    void makeOwned() {}
+
+    long long time;
+};
+
+/**
+ * Builds a key which sorts before every key whose time is at least 'time - kBoundedSorterJitter'.
+ */
+struct TimeBoundMaker {
+    Key operator()(const Key&, const TimeValue& value) const {
+        key_string::Builder kb(key_string::Version::kLatestVersion);
+        kb.appendNumberLong(value.time - kBoundedSorterJitter);
+        return kb.getValueCopy();
+    }
+    Document serialize(const SerializationOptions& opts = {}) const {
+        MONGO_UNREACHABLE;
+    }
+};
+
+using KeySorter = Sorter<Key, NullValue>;
+using TimeSorter = BoundedSorter<Key, TimeValue, KeyComparator, TimeBoundMaker>;
+
+/**
+ * Builds index keys of the shape an index build sorts: a string of 'keyWidth' bytes followed by
+ * the RecordId of the document. When 'time' is given, it is prepended to the key.
+ */
+Key makeKey(const std::string& str, long long recordId, boost::optional<long long> time) {
+    key_string::Builder kb(key_string::Version::kLatestVersion);
+    if (time) {
+        kb.appendNumberLong(*time);
+    }
+    kb.appendString(str);
+    kb.appendRecordId(RecordId(recordId));
+    return kb.getValueCopy();
+}
+
+std::string makeString(PseudoRandom& random, size_t keyWidth) {
+    std::string str(keyWidth, 'a');
+    for (auto&& c : str) {
+        c += random.nextInt32(26);
+    }
+    return str;
+}
+
+class SorterBenchmark : public benchmark::Fixture {
+public:
+    SorterBenchmark() : _random(kSeed) {}
+
+    // Keys in random order, for the sorters which do not expect any particular input order.
+    std::vector<Key> makeShuffledKeys(size_t keyWidth) {
+        std::vector<Key> keys;
+        keys.reserve(kNumKeys);
+        for (size_t i = 0; i < kNumKeys; ++i) {
+            keys.push_back(makeKey(makeString(_random, keyWidth), i, boost::none));
+        }
+        return keys;
+    }
+
+    // Keys ordered by time with each key displaced by up to 'kBoundedSorterJitter' positions, for
+    // the BoundedSorter.
+    std::vector<std::pair<Key, TimeValue>> makeAlmostSortedKeys(size_t keyWidth) {
+        std::vector<std::pair<Key, TimeValue>> keys;
+        keys.reserve(kNumKeys);
+        for (size_t i = 0; i < kNumKeys; ++i) {
+            long long time = i + _random.nextInt64(kBoundedSorterJitter);
+            keys.emplace_back(makeKey(makeString(_random, keyWidth), i, time), TimeValue{time});
+        }
+        return keys;
+    }
+
+    SortOptions makeOptions(size_t maxMemoryUsageBytes) {
+        return SortOptions()
+            .TempDir(_tempDir.path())
+            .ExtSortAllowed()
+            .MaxMemoryUsageBytes(maxMemoryUsageBytes)
+            .FileStats(&_fileStats);
+    }
+
+    void runSorter(const std::vector<Key>& keys,
+                   const SortOptions& opts,
+                   benchmark::State& state) {
+        size_t spilledRanges = 0;
+        for (auto keepRunning : state) {
+            std::unique_ptr<KeySorter> sorter(KeySorter::make(opts, KeyComparator{}));
+            for (auto&& key : keys) {
+                sorter->add(key, {});
+            }
+            std::unique_ptr<KeySorter::Iterator> it(sorter->done());
+            while (it->more()) {
+                benchmark::DoNotOptimize(it->next());
+            }
+            spilledRanges = sorter->stats().spilledRanges();
+        }
+        state.counters["spilledRanges"] = spilledRanges;
+        state.SetItemsProcessed(state.iterations() * keys.size());
+    }
+
+    SorterFileStats* fileStats() {
+        return &_fileStats;
+    }
+
+    const unittest::TempDir& tempDir() const {
+        return _tempDir;
+    }
+
+private:
+    static constexpr int32_t kSeed = 1;
+
+    PseudoRandom _random;
+    unittest::TempDir _tempDir{"sorter_bm"};
+    SorterFileStats _fileStats{nullptr /* sorterTracker */};
+};
+
+// Arguments: key width in bytes, memory limit in KB.
+BENCHMARK_DEFINE_F(SorterBenchmark, BM_NoLimitSorter)(benchmark::State& state) {
+    auto keys = makeShuffledKeys(state.range(0));
+    runSorter(keys, makeOptions(state.range(1) * 1024), state);
+}
+
+// Arguments: key width in bytes, memory limit in KB, limit.
+BENCHMARK_DEFINE_F(SorterBenchmark, BM_TopKSorter)(benchmark::State& state) {
+    auto keys = makeShuffledKeys(state.range(0));
+    runSorter(keys, makeOptions(state.range(1) * 1024).Limit(state.range(2)), state);
+}
+
+// Arguments: key width in bytes, number of spilled ranges to merge.
+BENCHMARK_DEFINE_F(SorterBenchmark, BM_MergeIterator)(benchmark::State& state) {
+    auto keys = makeShuffledKeys(state.range(0));
+    const size_t numRanges = state.range(1);
+
+    // Deal the keys out to the ranges, each of which is written to the spill file in order.
+    std::vector<std::vector<Key>> ranges(numRanges);
+    for (size_t i = 0; i < keys.size(); ++i) {
+        ranges[i % numRanges].push_back(keys[i]);
+    }
+    for (auto&& range : ranges) {
+        std::sort(range.begin(), range.end(), [](const Key& lhs, const Key& rhs) {
+            return lhs.compare(rhs) < 0;
+        });
+    }
+
+    auto opts = makeOptions(SortOptions::DefaultMaxMemoryUsageBytes);
+    for (auto keepRunning : state) {
+        state.PauseTiming();
+        auto file =
+            std::make_shared<KeySorter::File>(tempDir().path() + "/" + nextFileName(), fileStats());
+        std::vector<std::shared_ptr<KeySorter::Iterator>> iters;
+        for (auto&& range : ranges) {
+            SortedFileWriter<Key, NullValue> writer(opts, file);
+            for (auto&& key : range) {
+                writer.addAlreadySorted(key, {});
+            }
+            iters.emplace_back(writer.done());
+        }
+        state.ResumeTiming();
+
+        std::unique_ptr<KeySorter::Iterator> it(
+            KeySorter::Iterator::merge(iters, opts, KeyComparator{}));
+        while (it->more()) {
+            benchmark::DoNotOptimize(it->next());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+// Arguments: key width in bytes, memory limit in KB.
+BENCHMARK_DEFINE_F(SorterBenchmark, BM_BoundedSorter)(benchmark::State& state) {
+    auto keys = makeAlmostSortedKeys(state.range(0));
+    auto opts = makeOptions(state.range(1) * 1024);
+
+    size_t spilledRanges = 0;
+    for (auto keepRunning : state) {
+        TimeSorter sorter(opts, KeyComparator{}, TimeBoundMaker{});
+        for (auto&& [key, value] : keys) {
+            sorter.add(key, value);
+            while (sorter.getState() == TimeSorter::State::kReady) {
+                benchmark::DoNotOptimize(sorter.next());
+            }
+        }
+        sorter.done();
+        while (sorter.getState() == TimeSorter::State::kReady) {
+            benchmark::DoNotOptimize(sorter.next());
+        }
+        spilledRanges = sorter.stats().spilledRanges();
+    }
+    state.counters["spilledRanges"] = spilledRanges;
+    state.SetItemsProcessed(state.iterations() * keys.size());
+}
+
+// The memory limits are chosen so that the sorters either do not spill, or spill a handful or a few
+// hundred ranges.
+BENCHMARK_REGISTER_F(SorterBenchmark, BM_NoLimitSorter)
+    ->ArgNames({"keyWidth", "memKB"})
+    ->ArgsProduct({{16, 64, 512}, {256, 4 * 1024, 256 * 1024}})
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_REGISTER_F(SorterBenchmark, BM_TopKSorter)
+    ->ArgNames({"keyWidth", "memKB", "limit"})
+    ->ArgsProduct({{16, 64, 512}, {256, 256 * 1024}, {10, 10 * 1000}})
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_REGISTER_F(SorterBenchmark, BM_MergeIterator)
+    ->ArgNames({"keyWidth", "ranges"})
+    ->ArgsProduct({{16, 64, 512}, {2, 16, 128, 1024}})
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_REGISTER_F(SorterBenchmark, BM_BoundedSorter)
+    ->ArgNames({"keyWidth", "memKB"})
+    ->ArgsProduct({{16, 64, 512}, {4, 256 * 1024}})
+    ->Unit(benchmark::kMillisecond);
+
+}  // namespace
+}  // namespace mongo
+
+MONGO_CREATE_SORTER(mongo::key_string::Value, mongo::NullValue, mongo::KeyComparator);
+template class ::mongo::BoundedSorter<::mongo::key_string::Value,
+                                      ::mongo::TimeValue,
+                                      ::mongo::KeyComparator,
+                                      ::mongo::TimeBoundMaker>;
@@ -0,0 +1,75 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/db/sorter/sorter_compression.h"
+
+#include <zstd.h>
+
+#include "mongo/base/error_codes.h"
+#include "mongo/db/sorter/sorter_gen.h"
+#include "mongo/idl/idl_parser.h"
+#include "mongo/util/assert_util.h"
+#include "mongo/util/str.h"
+
+namespace mongo::sorter {
+
+Status validateSpillCompressor(const std::string& value, const boost::optional<TenantId>&) {
+    try {
+        SorterCompressor_parse(IDLParserContext("sorterSpillCompressor"), value);
+    } catch (const DBException& ex) {
+        return ex.toStatus();
+    }
+    return Status::OK();
+}
+
+void zstdCompress(const char* data, size_t size, std::string* out) {
+    out->resize(ZSTD_compressBound(size));
+    size_t ret = ZSTD_compress(out->data(), out->size(), data, size, ZSTD_CLEVEL_DEFAULT);
+    uassert(9156611,
+            str::stream() << "Failed to compress spilled data: " << ZSTD_getErrorName(ret),
+            !ZSTD_isError(ret));
+    out->resize(ret);
+}
+
+std::unique_ptr<char[]> zstdUncompress(const char* data, size_t size, size_t* uncompressedSize) {
+    auto contentSize = ZSTD_getFrameContentSize(data, size);
+    uassert(9156612,
+            "couldn't get uncompressed length",
+            contentSize != ZSTD_CONTENTSIZE_UNKNOWN && contentSize != ZSTD_CONTENTSIZE_ERROR);
+
+    std::unique_ptr<char[]> out(new char[contentSize]);
+    size_t ret = ZSTD_decompress(out.get(), contentSize, data, size);
+    uassert(9156613,
+            str::stream() << "decompression failed: " << ZSTD_getErrorName(ret),
+            !ZSTD_isError(ret) && ret == contentSize);
+    *uncompressedSize = ret;
+    return out;
+}
+
+}  // namespace mongo::sorter
@@ -0,0 +1,57 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <boost/optional/optional.hpp>
+#include <cstddef>
+#include <memory>
+#include <string>
+
+#include "mongo/base/status.h"
+#include "mongo/db/tenant_id.h"
+
+namespace mongo::sorter {
+
+/**
+ * Validator for the 'sorterSpillCompressor' server parameter.
+ */
+Status validateSpillCompressor(const std::string& value, const boost::optional<TenantId>&);
+
+/**
+ * Compresses the 'size' bytes at 'data' as a single zstd frame and stores the result in 'out'.
+ */
+void zstdCompress(const char* data, size_t size, std::string* out);
+
+/**
+ * Decompresses a block written by zstdCompress(). Throws if the block is corrupt.
+ */
+std::unique_ptr<char[]> zstdUncompress(const char* data, size_t size, size_t* uncompressedSize);
+
+}  // namespace mongo::sorter
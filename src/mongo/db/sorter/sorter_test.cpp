@@ -44,6 +44,7 @@
 #include "mongo/config.h"  // IWYU pragma: keep
 #include "mongo/db/pipeline/skip_and_limit.h"
 #include "mongo/db/sorter/sorter.h"
+#include "mongo/idl/server_parameter_test_util.h"
 #include "mongo/logv2/log.h"
 #include "mongo/platform/random.h"
 #include "mongo/stdx/thread.h"  // IWYU pragma: keep
@@ -975,6 +976,31 @@ class LotsOfDataWithLimit : public LotsOfDataLittleMemory<Random> {
     }
     enum { MEM_LIMIT = 32 * 1024 };
 };
+
+/**
+ * Same as LotsOfDataLittleMemory, but with spilled ranges prefetched on the background read-ahead
+ * pool. The output must be identical to the synchronous path.
+ */
+template <bool Random = true>
+class LotsOfDataWithReadAhead : public LotsOfDataLittleMemory<Random> {
+    typedef LotsOfDataLittleMemory<Random> Parent;
+
+    // Every range buffers two blocks, so fewer ranges are merged at once within the memory limit.
+    size_t correctNumRanges() const override {
+        return std::max(static_cast<std::size_t>(Parent::MEM_LIMIT / spilledRangeBufferSize(true)),
+                        static_cast<std::size_t>(2));
+    }
+
+    RAIIServerParameterControllerForTest _readAhead{"sorterAsyncReadAhead", true};
+};
+
+/**
+ * Same as LotsOfDataLittleMemory, but with spilled blocks compressed with zstd.
+ */
+template <bool Random = true>
+class LotsOfDataWithZstd : public LotsOfDataLittleMemory<Random> {
+    RAIIServerParameterControllerForTest _compressor{"sorterSpillCompressor", "zstd"};
+};
 }  // namespace SorterTests
 
 class SorterSuite : public unittest::OldStyleSuiteSpecification {
@@ -993,6 +1019,10 @@ public:
         add<SorterTests::Dupes>();
         add<SorterTests::LotsOfDataLittleMemory</*random=*/false>>();
         add<SorterTests::LotsOfDataLittleMemory</*random=*/true>>();
+        add<SorterTests::LotsOfDataWithReadAhead</*random=*/false>>();
+        add<SorterTests::LotsOfDataWithReadAhead</*random=*/true>>();
+        add<SorterTests::LotsOfDataWithZstd</*random=*/false>>();
+        add<SorterTests::LotsOfDataWithZstd</*random=*/true>>();
         add<SorterTests::LotsOfDataWithLimit<1, /*random=*/false>>();     // limit=1 is special case
         add<SorterTests::LotsOfDataWithLimit<1, /*random=*/true>>();      // limit=1 is special case
         add<SorterTests::LotsOfDataWithLimit<100, /*random=*/false>>();   // fits in mem
@@ -1197,6 +1227,73 @@ TEST_F(SorterMakeFromExistingRangesTest, RoundTrip) {
     }
 }
 
+TEST_F(SorterMakeFromExistingRangesTest, RoundTripZstd) {
+    unittest::TempDir tempDir(_agent.getSuiteName() + "_" + _agent.getTestName());
+    SorterTracker sorterTracker;
+
+    auto opts = SortOptions()
+                    .ExtSortAllowed()
+                    .TempDir(tempDir.path())
+                    .MaxMemoryUsageBytes(sizeof(IWSorter::Data))
+                    .Tracker(&sorterTracker);
+
+    IWSorter::PersistedState state;
+    {
+        RAIIServerParameterControllerForTest compressor("sorterSpillCompressor", "zstd");
+        auto sorterBeforeShutdown =
+            std::unique_ptr<IWSorter>(IWSorter::make(opts, IWComparator(ASC)));
+        for (int i = 0; i < 100; ++i) {
+            sorterBeforeShutdown->add(i % 10, i);
+        }
+        state = sorterBeforeShutdown->persistDataForShutdown();
+        ASSERT_FALSE(state.ranges.empty());
+        for (const auto& range : state.ranges) {
+            ASSERT(range.getCompressor() == SorterCompressor::kZstd);
+        }
+    }
+
+    // The codec is taken from the persisted ranges, not from the current parameter value.
+    auto sorter = std::unique_ptr<IWSorter>(
+        IWSorter::makeFromExistingRanges(state.fileName, state.ranges, opts, IWComparator(ASC)));
+    auto iter = std::unique_ptr<IWIterator>(sorter->done());
+    iter->openSource();
+    int numRead = 0;
+    int last = 0;
+    while (iter->more()) {
+        auto pair = iter->next();
+        ASSERT_LTE(last, pair.first);
+        last = pair.first;
+        ++numRead;
+    }
+    ASSERT_EQ(100, numRead);
+    iter->closeSource();
+}
+
+TEST_F(SorterMakeFromExistingRangesTest, ZstdNotRecordedUntilFeatureFlagEnabled) {
+    unittest::TempDir tempDir(_agent.getSuiteName() + "_" + _agent.getTestName());
+    SorterTracker sorterTracker;
+
+    auto opts = SortOptions()
+                    .ExtSortAllowed()
+                    .TempDir(tempDir.path())
+                    .MaxMemoryUsageBytes(sizeof(IWSorter::Data))
+                    .Tracker(&sorterTracker);
+
+    RAIIServerParameterControllerForTest featureFlag("featureFlagSorterSpillCompressor", false);
+    RAIIServerParameterControllerForTest compressor("sorterSpillCompressor", "zstd");
+    auto sorter = std::unique_ptr<IWSorter>(IWSorter::make(opts, IWComparator(ASC)));
+    for (int i = 0; i < 100; ++i) {
+        sorter->add(i % 10, i);
+    }
+
+    // Older binaries cannot read the compressor field, so the ranges are written with snappy.
+    auto state = sorter->persistDataForShutdown();
+    ASSERT_FALSE(state.ranges.empty());
+    for (const auto& range : state.ranges) {
+        ASSERT_FALSE(range.getCompressor());
+    }
+}
+
 TEST_F(SorterMakeFromExistingRangesTest, NextWithDeferredValues) {
     unittest::TempDir tempDir(_agent.getSuiteName() + "_" + _agent.getTestName());
     auto opts = SortOptions().ExtSortAllowed().TempDir(tempDir.path());
@@ -1508,6 +1605,46 @@ TEST_F(BoundedSorterTest, SpillAlmostSorted) {
     ASSERT_EQ(sorter->stats().spilledRanges(), 2);
 }
 
+TEST_F(BoundedSorterTest, ParallelWindowsAlmostSorted) {
+    RAIIServerParameterControllerForTest windowSize("boundedSorterParallelWindowSize", 16);
+    sorter = makeAsc({});
+
+    // Every element is at most 5 away from its sorted position, within the bound of 10.
+    std::vector<Doc> input;
+    for (int i = 0; i < 1000; i += 6) {
+        for (int j : {5, 2, 0, 4, 1, 3}) {
+            input.push_back({i + j});
+        }
+    }
+    auto output = sort(input);
+    assertSorted(output);
+
+    // A restarted sorter takes new windows independently of the old ones.
+    sorter->restart();
+    output = sort({{3}, {1}, {2}});
+    assertSorted(output);
+}
+
+TEST_F(BoundedSorterTest, ParallelWindowsSpill) {
+    RAIIServerParameterControllerForTest windowSize("boundedSorterParallelWindowSize", 4);
+    SorterTracker sorterTracker;
+    auto options = SortOptions()
+                       .ExtSortAllowed()
+                       .TempDir("unused_temp_dir")
+                       .MaxMemoryUsageBytes(64)
+                       .Tracker(&sorterTracker);
+    sorter = makeAsc(options);
+
+    // Exceeding the memory limit moves the windows back into the heap, which then spills.
+    std::vector<Doc> input;
+    for (int i = 0; i < 100; ++i) {
+        input.push_back({i % 2 ? i - 1 : i + 1});
+    }
+    auto output = sort(input);
+    assertSorted(output);
+    ASSERT_GT(sorter->stats().spilledRanges(), 0);
+}
+
 TEST_F(BoundedSorterTest, SpillWrongInput) {
     auto options =
         SortOptions().ExtSortAllowed().TempDir("unused_temp_dir").MaxMemoryUsageBytes(16);
@@ -0,0 +1,71 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/db/sorter/sorter_worker_pool.h"
+
+#include <utility>
+
+#include "mongo/base/status.h"
+#include "mongo/db/sorter/sorter_gen.h"
+#include "mongo/util/concurrency/thread_pool.h"
+#include "mongo/util/duration.h"
+#include "mongo/util/static_immortal.h"
+
+namespace mongo::sorter {
+namespace {
+
+ThreadPool::Options makeWorkerPoolOptions() {
+    ThreadPool::Options options;
+    options.poolName = "SorterWorker";
+    options.threadNamePrefix = "SorterWorker-";
+    options.minThreads = 0;
+    options.maxThreads = gSorterWorkerMaxThreads;
+    options.maxIdleThreadAge = Seconds{30};
+    return options;
+}
+
+ThreadPool& getWorkerPool() {
+    // Never destroyed, since sorters with background work may outlive the static destructors.
+    static StaticImmortal<ThreadPool> pool{makeWorkerPoolOptions()};
+    [[maybe_unused]] static const bool started = [] {
+        pool->startup();
+        return true;
+    }();
+    return *pool;
+}
+
+}  // namespace
+
+void scheduleSorterTask(unique_function<void()> task) {
+    // The task runs with a non-OK status, on this thread, if the pool is shutting down. Running it
+    // inline is still correct, only slower.
+    getWorkerPool().schedule([task = std::move(task)](Status) mutable { task(); });
+}
+
+}  // namespace mongo::sorter
@@ -0,0 +1,114 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/db/stats/latency_percentile_histogram.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "mongo/platform/bits.h"
+#include "mongo/util/assert_util.h"
+
+namespace mongo {
+
+size_t LatencyPercentileHistogram::bucketIndex(uint64_t micros) {
+    if (micros < kSubBuckets)
+        return micros;
+    int magnitude = 63 - countLeadingZerosNonZero64(micros);
+    if (magnitude > kMaxMagnitude)
+        return kNumBuckets - 1;
+    size_t subBucket = (micros >> (magnitude - kSubBucketBits)) & (kSubBuckets - 1);
+    return (magnitude - kSubBucketBits + 1) * kSubBuckets + subBucket;
+}
+
+uint64_t LatencyPercentileHistogram::bucketLowerBound(size_t index) {
+    if (index < kSubBuckets)
+        return index;
+    uint64_t subBucket = index % kSubBuckets;
+    return (kSubBuckets + subBucket) << (index / kSubBuckets - 1);
+}
+
+void LatencyPercentileHistogram::record(Microseconds latency) {
+    long long micros = std::max(durationCount<Microseconds>(latency), 0LL);
+    _buckets[bucketIndex(micros)].fetchAndAddRelaxed(1);
+    _count.fetchAndAddRelaxed(1);
+    _sumMicros.fetchAndAddRelaxed(micros);
+
+    long long prevMax = _maxMicros.loadRelaxed();
+    while (micros > prevMax && !_maxMicros.compareAndSwap(&prevMax, micros)) {
+    }
+}
+
+LatencyPercentileHistogram::Snapshot LatencyPercentileHistogram::_snapshot() const {
+    // Take the total from the buckets themselves so that ranks stay consistent with the bucket
+    // walk even while other threads are recording.
+    Snapshot snapshot;
+    for (size_t i = 0; i < kNumBuckets; ++i) {
+        snapshot.buckets[i] = _buckets[i].loadRelaxed();
+        snapshot.total += snapshot.buckets[i];
+    }
+    snapshot.maxMicros = _maxMicros.loadRelaxed();
+    return snapshot;
+}
+
+Microseconds LatencyPercentileHistogram::_percentile(const Snapshot& snapshot, double q) {
+    invariant(q >= 0.0 && q <= 1.0);
+    if (snapshot.total == 0)
+        return Microseconds{0};
+
+    long long rank = std::max(static_cast<long long>(std::ceil(q * snapshot.total)), 1LL);
+    long long seen = 0;
+    for (size_t i = 0; i < kNumBuckets; ++i) {
+        seen += snapshot.buckets[i];
+        if (seen >= rank) {
+            long long upper =
+                i + 1 < kNumBuckets ? bucketLowerBound(i + 1) - 1 : snapshot.maxMicros;
+            return Microseconds{std::min(upper, snapshot.maxMicros)};
+        }
+    }
+    return Microseconds{snapshot.maxMicros};
+}
+
+Microseconds LatencyPercentileHistogram::percentile(double q) const {
+    return _percentile(_snapshot(), q);
+}
+
+void LatencyPercentileHistogram::append(BSONObjBuilder& bob) const {
+    auto snapshot = _snapshot();
+    bob.append("count", count());
+    bob.append("totalMicros", _sumMicros.loadRelaxed());
+    for (auto&& [name, q] : {std::pair{"p50", 0.5},
+                             std::pair{"p90", 0.9},
+                             std::pair{"p99", 0.99},
+                             std::pair{"p999", 0.999}})
+        bob.append(name, durationCount<Microseconds>(_percentile(snapshot, q)));
+    bob.append("maxMicros", snapshot.maxMicros);
+}
+
+}  // namespace mongo
@@ -0,0 +1,119 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/db/commands/server_status_metric.h"
+#include "mongo/platform/atomic_word.h"
+#include "mongo/util/duration.h"
+
+namespace mongo {
+
+/**
+ * A fixed-size, log-linear latency histogram in the style of HdrHistogram. Every power of two is
+ * split into eight equal-width sub-buckets, which bounds the relative error of any reported
+ * percentile to 12.5% while keeping the whole histogram at a few kilobytes.
+ *
+ * Recording is lock-free and only touches a handful of atomic counters, so it is cheap enough to
+ * be done on every command completion. Readers take a point-in-time walk over the buckets and may
+ * observe samples that are only partially recorded; the reported values are approximate.
+ */
+class LatencyPercentileHistogram {
+public:
+    static constexpr int kSubBucketBits = 3;
+    static constexpr int kSubBuckets = 1 << kSubBucketBits;
+
+    // Latencies are bucketed up to 2^kMaxMagnitude microseconds (about twelve days). Anything
+    // slower is accounted for in the last bucket.
+    static constexpr int kMaxMagnitude = 40;
+    static constexpr size_t kNumBuckets = (kMaxMagnitude - kSubBucketBits + 2) * kSubBuckets;
+
+    void record(Microseconds latency);
+
+    /**
+     * Returns the estimated latency at quantile 'q', which must be in [0, 1]. The estimate is the
+     * upper bound of the bucket holding the sample of that rank, capped at the largest recorded
+     * latency. Returns zero if nothing has been recorded.
+     */
+    Microseconds percentile(double q) const;
+
+    long long count() const {
+        return _count.loadRelaxed();
+    }
+
+    /**
+     * Appends {count, totalMicros, p50, p90, p99, p999, maxMicros} to 'bob'. The percentiles are
+     * reported in microseconds and are all computed from a single pass over the buckets.
+     */
+    void append(BSONObjBuilder& bob) const;
+
+    static size_t bucketIndex(uint64_t micros);
+    static uint64_t bucketLowerBound(size_t index);
+
+private:
+    struct Snapshot {
+        std::array<long long, kNumBuckets> buckets;
+        long long total = 0;
+        long long maxMicros = 0;
+    };
+
+    Snapshot _snapshot() const;
+    static Microseconds _percentile(const Snapshot& snapshot, double q);
+
+    std::array<AtomicWord<long long>, kNumBuckets> _buckets{};
+    AtomicWord<long long> _count{0};
+    AtomicWord<long long> _sumMicros{0};
+    AtomicWord<long long> _maxMicros{0};
+};
+
+template <>
+struct ServerStatusMetricPolicySelection<LatencyPercentileHistogram> {
+    class Policy {
+    public:
+        auto& value() {
+            return _v;
+        }
+
+        void appendTo(BSONObjBuilder& bob, StringData leafName) const {
+            BSONObjBuilder sub{bob.subobjStart(leafName)};
+            _v.append(sub);
+        }
+
+    private:
+        LatencyPercentileHistogram _v;
+    };
+    using type = Policy;
+};
+
+}  // namespace mongo
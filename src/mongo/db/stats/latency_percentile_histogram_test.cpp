@@ -0,0 +1,108 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+#include "mongo/bson/bsonobj.h"
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/db/stats/latency_percentile_histogram.h"
+#include "mongo/unittest/assert.h"
+#include "mongo/unittest/framework.h"
+#include "mongo/util/duration.h"
+
+namespace mongo {
+namespace {
+
+using Hist = LatencyPercentileHistogram;
+
+TEST(LatencyPercentileHistogram, BucketBoundsAreContiguous) {
+    ASSERT_EQ(Hist::bucketLowerBound(0), 0U);
+    for (size_t i = 0; i + 1 < Hist::kNumBuckets; ++i) {
+        uint64_t lower = Hist::bucketLowerBound(i);
+        uint64_t next = Hist::bucketLowerBound(i + 1);
+        ASSERT_LT(lower, next);
+        ASSERT_EQ(Hist::bucketIndex(lower), i);
+        ASSERT_EQ(Hist::bucketIndex(next - 1), i);
+    }
+}
+
+TEST(LatencyPercentileHistogram, LargeLatenciesGoToLastBucket) {
+    ASSERT_EQ(Hist::bucketIndex(uint64_t{1} << 50), Hist::kNumBuckets - 1);
+    ASSERT_EQ(Hist::bucketIndex(~uint64_t{0}), Hist::kNumBuckets - 1);
+
+    Hist hist;
+    hist.record(Microseconds{1LL << 50});
+    ASSERT_EQ(hist.percentile(0.5), Microseconds{1LL << 50});
+}
+
+TEST(LatencyPercentileHistogram, EmptyHistogramReportsZeros) {
+    Hist hist;
+    BSONObjBuilder bob;
+    hist.append(bob);
+    ASSERT_BSONOBJ_EQ(bob.obj(),
+                      BSON("count" << 0LL << "totalMicros" << 0LL << "p50" << 0LL << "p90" << 0LL
+                                   << "p99" << 0LL << "p999" << 0LL << "maxMicros" << 0LL));
+}
+
+TEST(LatencyPercentileHistogram, PercentilesReportBucketUpperBound) {
+    Hist hist;
+    for (long long i = 1; i <= 1000; ++i)
+        hist.record(Microseconds{i});
+
+    // 500 falls in [480, 511], 900 in [896, 959] and 990 in [960, 1023], which is capped at the
+    // largest latency recorded.
+    ASSERT_EQ(hist.percentile(0.5), Microseconds{511});
+    ASSERT_EQ(hist.percentile(0.9), Microseconds{959});
+    ASSERT_EQ(hist.percentile(0.99), Microseconds{1000});
+    ASSERT_EQ(hist.percentile(0.0), Microseconds{1});
+    ASSERT_EQ(hist.percentile(1.0), Microseconds{1000});
+
+    BSONObjBuilder bob;
+    hist.append(bob);
+    auto obj = bob.obj();
+    ASSERT_EQ(obj["count"].Long(), 1000);
+    ASSERT_EQ(obj["totalMicros"].Long(), 500500);
+    ASSERT_EQ(obj["p50"].Long(), 511);
+    ASSERT_EQ(obj["p999"].Long(), 1000);
+    ASSERT_EQ(obj["maxMicros"].Long(), 1000);
+}
+
+TEST(LatencyPercentileHistogram, SmallLatenciesAreExact) {
+    Hist hist;
+    for (int i = 0; i < 99; ++i)
+        hist.record(Microseconds{3});
+    hist.record(Microseconds{7});
+    ASSERT_EQ(hist.percentile(0.5), Microseconds{3});
+    ASSERT_EQ(hist.percentile(0.9), Microseconds{3});
+    ASSERT_EQ(hist.percentile(0.999), Microseconds{7});
+}
+
+}  // namespace
+}  // namespace mongo
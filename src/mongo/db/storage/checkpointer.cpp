@@ -29,6 +29,7 @@
 
 
 // IWYU pragma: no_include "cxxabi.h"
+#include <algorithm>
 #include <chrono>
 #include <cstdint>
 #include <mutex>
@@ -37,15 +38,19 @@
 #include "mongo/base/string_data.h"
 #include "mongo/bson/timestamp.h"
 #include "mongo/db/client.h"
+#include "mongo/db/commands/server_status.h"
 #include "mongo/db/operation_context.h"
 #include "mongo/db/service_context.h"
 #include "mongo/db/storage/checkpointer.h"
+#include "mongo/db/storage/kv/kv_engine.h"
 #include "mongo/db/storage/storage_engine.h"
 #include "mongo/db/storage/storage_options.h"
+#include "mongo/db/storage/storage_parameters_gen.h"
 #include "mongo/logv2/log.h"
 #include "mongo/logv2/log_attr.h"
 #include "mongo/logv2/log_component.h"
 #include "mongo/platform/atomic_proxy.h"
+#include "mongo/util/assert_util.h"
 #include "mongo/util/assert_util_core.h"
 #include "mongo/util/concurrency/idle_thread_block.h"
 #include "mongo/util/decorable.h"
@@ -64,6 +69,26 @@ const auto getCheckpointer = ServiceContext::declareDecoration<std::unique_ptr<C
 
 MONGO_FAIL_POINT_DEFINE(pauseCheckpointThread);
 
+class CheckpointerServerStatusSection : public ServerStatusSection {
+public:
+    using ServerStatusSection::ServerStatusSection;
+
+    bool includeByDefault() const override {
+        return true;
+    }
+
+    BSONObj generateSection(OperationContext* opCtx,
+                            const BSONElement& configElement) const override {
+        BSONObjBuilder builder;
+        if (auto checkpointer = Checkpointer::get(opCtx)) {
+            checkpointer->appendStats(&builder);
+        }
+        return builder.obj();
+    }
+};
+auto checkpointerSection =
+    *ServerStatusSectionBuilder<CheckpointerServerStatusSection>("checkpointer").forShard();
+
 }  // namespace
 
 Checkpointer* Checkpointer::get(ServiceContext* serviceCtx) {
@@ -92,31 +117,45 @@ void Checkpointer::run() {
         tc.get()->setSystemOperationUnkillableByStepdown(lk);
     }
 
+    {
+        stdx::lock_guard<Latch> lock(_mutex);
+        _lastCheckpointEnd = Date_t::now();
+    }
+
     while (true) {
         auto opCtx = tc->makeOperationContext();
+        auto engine = opCtx->getServiceContext()->getStorageEngine()->getEngine();
 
         {
             stdx::unique_lock<Latch> lock(_mutex);
             MONGO_IDLE_THREAD_BLOCK;
 
-            // Wait for 'storageGlobalParams.syncdelay' seconds; or until either shutdown is
-            // signaled or a checkpoint is triggered.
-            LOGV2_DEBUG(7702900,
-                        1,
-                        "Checkpoint thread sleeping",
-                        "duration"_attr = static_cast<std::int64_t>(storageGlobalParams.syncdelay));
-            _sleepCV.wait_for(
-                lock,
-                stdx::chrono::seconds(static_cast<std::int64_t>(storageGlobalParams.syncdelay)),
-                [&] { return _shuttingDown || _triggerCheckpoint; });
-
-            // If the syncdelay is set to 0, that means we should skip checkpointing. However,
-            // syncdelay is adjustable by a runtime server parameter, so we need to wake up to check
-            // periodically. The wakeup to check period is arbitrary.
-            while (storageGlobalParams.syncdelay == 0 && !_shuttingDown && !_triggerCheckpoint) {
-                _sleepCV.wait_for(lock, stdx::chrono::seconds(static_cast<std::int64_t>(3)), [&] {
-                    return _shuttingDown || _triggerCheckpoint;
-                });
+            if (gCheckpointAdaptiveScheduling.load()) {
+                _waitForAdaptiveCheckpoint(lock, engine);
+            } else {
+                // Wait for 'storageGlobalParams.syncdelay' seconds; or until either shutdown is
+                // signaled or a checkpoint is triggered.
+                LOGV2_DEBUG(
+                    7702900,
+                    1,
+                    "Checkpoint thread sleeping",
+                    "duration"_attr = static_cast<std::int64_t>(storageGlobalParams.syncdelay));
+                _sleepCV.wait_for(
+                    lock,
+                    stdx::chrono::seconds(static_cast<std::int64_t>(storageGlobalParams.syncdelay)),
+                    [&] { return _shuttingDown || _triggerCheckpoint; });
+
+                // If the syncdelay is set to 0, that means we should skip checkpointing. However,
+                // syncdelay is adjustable by a runtime server parameter, so we need to wake up to
+                // check periodically. The wakeup to check period is arbitrary.
+                while (storageGlobalParams.syncdelay == 0 && !_shuttingDown &&
+                       !_triggerCheckpoint) {
+                    _sleepCV.wait_for(
+                        lock, stdx::chrono::seconds(static_cast<std::int64_t>(3)), [&] {
+                            return _shuttingDown || _triggerCheckpoint;
+                        });
+                }
+                _lastTrigger = Trigger::kScheduled;
             }
 
             if (_shuttingDown) {
@@ -129,23 +168,130 @@ void Checkpointer::run() {
                 return;
             }
 
+            if (_triggerCheckpoint) {
+                _lastTrigger = Trigger::kRequested;
+            }
+
             // Clear the trigger so we do not immediately checkpoint again after this.
             _triggerCheckpoint = false;
         }
 
         pauseCheckpointThread.pauseWhileSet();
 
+        // Sample the dirty cache ratio before checkpointing so an idle period can be detected
+        // and the next checkpoint backed off.
+        const auto dirtyRatioAtStart =
+            gCheckpointAdaptiveScheduling.load() ? engine->getCacheDirtyRatio() : boost::none;
+
         const Date_t startTime = Date_t::now();
         opCtx->getServiceContext()->getStorageEngine()->checkpoint();
 
-        const auto secondsElapsed = durationCount<Seconds>(Date_t::now() - startTime);
+        const auto duration = Date_t::now() - startTime;
+        const auto secondsElapsed = durationCount<Seconds>(duration);
         if (secondsElapsed >= 30) {
             LOGV2_DEBUG(22308,
                         1,
                         "Checkpoint was slow to complete",
                         "secondsElapsed"_attr = secondsElapsed);
         }
+
+        _onCheckpointFinished(duration, dirtyRatioAtStart);
+    }
+}
+
+void Checkpointer::_waitForAdaptiveCheckpoint(stdx::unique_lock<Latch>& lock, KVEngine* engine) {
+    while (!_shuttingDown && !_triggerCheckpoint) {
+        // A syncdelay of 0 disables checkpointing altogether, in adaptive mode as well.
+        const auto syncdelay = static_cast<std::int64_t>(storageGlobalParams.syncdelay);
+        if (syncdelay > 0) {
+            const auto sinceLast = Date_t::now() - _lastCheckpointEnd;
+            if (sinceLast >= Seconds(syncdelay * _idleBackoffFactor)) {
+                _lastTrigger = Trigger::kScheduled;
+                return;
+            }
+
+            // Checkpoint early once enough dirty data has accumulated, but never more often than
+            // the configured minimum interval or twice the recent checkpoint duration, so that
+            // back-to-back checkpoints cannot starve application writes.
+            const auto minInterval = std::max(
+                Milliseconds(Seconds(gCheckpointAdaptiveMinIntervalSecs.load())),
+                _averageCheckpointDuration * 2);
+            if (sinceLast >= minInterval) {
+                lock.unlock();
+                auto dirtyRatio = engine->getCacheDirtyRatio();
+                lock.lock();
+
+                _lastDirtyRatio = dirtyRatio;
+                if (dirtyRatio &&
+                    *dirtyRatio >= gCheckpointAdaptiveDirtyCacheTriggerRatio.load()) {
+                    LOGV2_DEBUG(9156619,
+                                1,
+                                "Triggering an early checkpoint due to dirty cache",
+                                "dirtyRatio"_attr = *dirtyRatio,
+                                "sinceLastCheckpoint"_attr = sinceLast);
+                    ++_numEarlyCheckpoints;
+                    _lastTrigger = Trigger::kDirtyCache;
+                    return;
+                }
+            }
+        }
+
+        _sleepCV.wait_for(lock, stdx::chrono::seconds(static_cast<std::int64_t>(1)), [&] {
+            return _shuttingDown || _triggerCheckpoint;
+        });
+    }
+}
+
+void Checkpointer::_onCheckpointFinished(Milliseconds duration,
+                                         boost::optional<double> dirtyRatioAtStart) {
+    stdx::lock_guard<Latch> lock(_mutex);
+    _averageCheckpointDuration = _averageCheckpointDuration == Milliseconds(0)
+        ? duration
+        : (_averageCheckpointDuration * 3 + duration) / 4;
+    _lastCheckpointEnd = Date_t::now();
+    ++_numCheckpoints;
+
+    // When a checkpoint found almost nothing to write, stretch out the next scheduled interval.
+    // Any meaningful amount of dirty data resets the back-off.
+    const double idleRatio = gCheckpointAdaptiveDirtyCacheTriggerRatio.load() / 10;
+    if (dirtyRatioAtStart && *dirtyRatioAtStart < idleRatio) {
+        const int maxFactor = gCheckpointAdaptiveMaxIdleBackoffFactor.load();
+        if (_idleBackoffFactor < maxFactor) {
+            _idleBackoffFactor = std::min(_idleBackoffFactor * 2, maxFactor);
+            ++_numIdleBackoffs;
+        }
+    } else {
+        _idleBackoffFactor = 1;
+    }
+}
+
+StringData Checkpointer::_triggerToString(Trigger trigger) {
+    switch (trigger) {
+        case Trigger::kNone:
+            return "none"_sd;
+        case Trigger::kScheduled:
+            return "scheduled"_sd;
+        case Trigger::kRequested:
+            return "requested"_sd;
+        case Trigger::kDirtyCache:
+            return "dirtyCache"_sd;
+    }
+    MONGO_UNREACHABLE;
+}
+
+void Checkpointer::appendStats(BSONObjBuilder* builder) {
+    stdx::lock_guard<Latch> lock(_mutex);
+    builder->append("mode", gCheckpointAdaptiveScheduling.load() ? "adaptive" : "fixed");
+    builder->append("lastTrigger", _triggerToString(_lastTrigger));
+    if (_lastDirtyRatio) {
+        builder->append("lastDirtyCacheRatio", *_lastDirtyRatio);
     }
+    builder->append("averageDurationMillis",
+                    durationCount<Milliseconds>(_averageCheckpointDuration));
+    builder->append("idleBackoffFactor", _idleBackoffFactor);
+    builder->append("numCheckpoints", _numCheckpoints);
+    builder->append("earlyCheckpoints", _numEarlyCheckpoints);
+    builder->append("idleBackoffs", _numIdleBackoffs);
 }
 
 void Checkpointer::triggerFirstStableCheckpoint(Timestamp prevStable,
@@ -29,13 +29,18 @@
 
 #pragma once
 
+#include <boost/optional/optional.hpp>
 #include <memory>
 #include <string>
 
 #include "mongo/base/status.h"
+#include "mongo/base/string_data.h"
+#include "mongo/bson/bsonobjbuilder.h"
 #include "mongo/platform/mutex.h"
 #include "mongo/stdx/condition_variable.h"
 #include "mongo/util/background.h"
+#include "mongo/util/duration.h"
+#include "mongo/util/time_support.h"
 
 namespace mongo {
 
@@ -90,7 +95,31 @@ public:
      */
     void shutdown(const Status& reason);
 
+    /**
+     * Appends the scheduling state of the checkpoint thread, reported in serverStatus.
+     */
+    void appendStats(BSONObjBuilder* builder);
+
 private:
+    // What started the most recent checkpoint.
+    enum class Trigger { kNone, kScheduled, kRequested, kDirtyCache };
+
+    static StringData _triggerToString(Trigger trigger);
+
+    /**
+     * Waits until the next checkpoint is due, shutdown is signaled or a checkpoint is triggered,
+     * when adaptive scheduling is enabled. Polls the dirty cache ratio of 'engine' once a second so
+     * that a checkpoint can start ahead of the syncdelay schedule. Must be called with '_mutex'
+     * held through 'lock'.
+     */
+    void _waitForAdaptiveCheckpoint(stdx::unique_lock<Latch>& lock, KVEngine* engine);
+
+    /**
+     * Records the duration of a finished checkpoint and updates the idle back-off from the dirty
+     * cache ratio sampled before it started.
+     */
+    void _onCheckpointFinished(Milliseconds duration, boost::optional<double> dirtyRatioAtStart);
+
     // Protects the state below.
     Mutex _mutex = MONGO_MAKE_LATCH("Checkpointer::_mutex");
 
@@ -107,6 +136,16 @@ private:
 
     // This flag allows the checkpoint thread to wake up early when _sleepCV is signaled.
     bool _triggerCheckpoint;
+
+    // State used by adaptive checkpoint scheduling, see _waitForAdaptiveCheckpoint().
+    Date_t _lastCheckpointEnd;
+    Milliseconds _averageCheckpointDuration{0};
+    int _idleBackoffFactor = 1;
+    boost::optional<double> _lastDirtyRatio;
+    Trigger _lastTrigger = Trigger::kNone;
+    long long _numCheckpoints = 0;
+    long long _numEarlyCheckpoints = 0;
+    long long _numIdleBackoffs = 0;
 };
 
 }  // namespace mongo
@@ -61,6 +61,7 @@ namespace {
 static constexpr StringData kEmptyCollectionString = "emptyCollection"_sd;
 static constexpr StringData kScanningString = "scanning"_sd;
 static constexpr StringData kSamplingString = "sampling"_sd;
+static constexpr StringData kPersistedString = "persisted"_sd;
 }  // namespace
 
 StringData CollectionTruncateMarkers::toString(
@@ -72,6 +73,8 @@ StringData CollectionTruncateMarkers::toString(
             return kScanningString;
         case CollectionTruncateMarkers::MarkersCreationMethod::Sampling:
             return kSamplingString;
+        case CollectionTruncateMarkers::MarkersCreationMethod::Persisted:
+            return kPersistedString;
         default:
             MONGO_UNREACHABLE;
     }
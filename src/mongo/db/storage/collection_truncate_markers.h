@@ -134,8 +134,9 @@ public:
                                                         Date_t wallTime,
                                                         int64_t countInserted);
 
-    // The method used for creating the initial set of markers.
-    enum class MarkersCreationMethod { EmptyCollection, Scanning, Sampling };
+    // The method used for creating the initial set of markers. 'Persisted' markers were reloaded
+    // from a copy saved at an earlier checkpoint or shutdown.
+    enum class MarkersCreationMethod { EmptyCollection, Scanning, Sampling, Persisted };
 
     static StringData toString(MarkersCreationMethod creationMethod);
 
@@ -2861,12 +2861,20 @@ RecordId decodeRecordIdLong(BufReader* reader) {
         8434401,
         fmt::format("Encoded RecordId size is too big. bufSize: {}, ridSize: {}", bufSize, ridSize),
         bufSize >= ridSize);
-    unsigned offset = 1;
-    for (; offset < numExtraBytes + 1; offset++) {
-        repr = (repr << 8) | firstBytePtr[offset];
+    if (numExtraBytes > 0 && bufSize >= 1 + sizeof(uint64_t)) {
+        // The extra bytes are big-endian, so when there is room for a full word after the first
+        // byte, load it at once and keep only its top 'numExtraBytes' bytes. This is the common
+        // case when the RecordId is followed by more data, or is large enough to need most bytes.
+        const uint64_t word = ConstDataView(reinterpret_cast<const char*>(firstBytePtr) + 1)
+                                  .read<BigEndian<uint64_t>>();
+        repr = (repr << (8 * numExtraBytes)) | (word >> (64 - 8 * numExtraBytes));
+    } else {
+        for (unsigned offset = 1; offset < numExtraBytes + 1; offset++) {
+            repr = (repr << 8) | firstBytePtr[offset];
+        }
     }
 
-    const unsigned char lastByte = firstBytePtr[offset];
+    const unsigned char lastByte = firstBytePtr[numExtraBytes + 1];
     keyStringAssert(8273000,
                     fmt::format("Number of extra bytes for RecordId is not encoded correctly. Low "
                                 "3 bits of lastByte: {}, high 3 bits of firstByte: {}",
@@ -2940,31 +2948,6 @@ int32_t sizeWithoutRecordIdStrAtEnd(const void* bufferRaw, size_t bufSize, Recor
     return bufSize - ridSize - numSegments;
 }
 
-int compare(const char* leftBuf, const char* rightBuf, size_t leftSize, size_t rightSize) {
-    // memcmp has undefined behavior if either leftBuf or rightBuf is a null pointer.
-    if (MONGO_unlikely(leftSize == 0))
-        return rightSize == 0 ? 0 : -1;
-    else if (MONGO_unlikely(rightSize == 0))
-        return 1;
-
-    int min = std::min(leftSize, rightSize);
-
-    int cmp = memcmp(leftBuf, rightBuf, min);
-
-    if (cmp) {
-        if (cmp < 0)
-            return -1;
-        return 1;
-    }
-
-    // keys match
-
-    if (leftSize == rightSize)
-        return 0;
-
-    return leftSize < rightSize ? -1 : 1;
-}
-
 int Value::compareWithTypeBits(const Value& other) const {
     return key_string::compare(
         getBuffer(), other.getBuffer(), _buffer.size(), other._buffer.size());
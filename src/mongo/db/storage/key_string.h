@@ -32,6 +32,7 @@
 #include <absl/hash/hash.h>
 #include <boost/container/flat_set.hpp>
 #include <boost/optional/optional.hpp>
+#include <algorithm>
 #include <cstdint>
 #include <cstring>
 #include <functional>
@@ -57,6 +58,7 @@
 #include "mongo/bson/util/builder_fwd.h"
 #include "mongo/db/record_id.h"
 #include "mongo/db/storage/key_format.h"
+#include "mongo/platform/compiler.h"
 #include "mongo/platform/decimal128.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/bufreader.h"
@@ -1159,7 +1161,27 @@ int32_t sizeWithoutDiscriminatorAtEnd(const void* bufferRaw, size_t bufSize);
  */
 RecordId decodeRecordIdLong(BufReader* reader);
 
-int compare(const char* leftBuf, const char* rightBuf, size_t leftSize, size_t rightSize);
+/**
+ * Compares two KeyString buffers bytewise, returning -1, 0 or 1. This is on the path of every index
+ * seek, index build merge and sort comparison, so it is defined inline to let callers skip the call
+ * and fold the result normalization into their own branch.
+ */
+inline int compare(const char* leftBuf, const char* rightBuf, size_t leftSize, size_t rightSize) {
+    const size_t min = std::min(leftSize, rightSize);
+
+    // memcmp has undefined behavior if either leftBuf or rightBuf is a null pointer, which is only
+    // possible for an empty buffer.
+    if (MONGO_likely(min > 0)) {
+        if (const int cmp = memcmp(leftBuf, rightBuf, min)) {
+            return cmp < 0 ? -1 : 1;
+        }
+    }
+
+    // keys match up to the shorter length
+    if (leftSize == rightSize)
+        return 0;
+    return leftSize < rightSize ? -1 : 1;
+}
 
 /**
  * Read one KeyString component from the given 'reader' and 'typeBits' inputs and stream it to the
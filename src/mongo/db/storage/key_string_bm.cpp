@@ -30,6 +30,7 @@
 
 #include <benchmark/benchmark.h>
 #include <cstring>
+#include <limits>
 #include <random>
 #include <string>
 #include <vector>
@@ -217,6 +218,42 @@ void BM_KeyStringStackBuilderCopy(benchmark::State& state, BsonValueType bsonTyp
     state.SetItemsProcessed(state.iterations() * kSampleSize);
 }
 
+void BM_KeyStringCompare(benchmark::State& state, BsonValueType bsonType) {
+    // The KeyString version does not matter for this test.
+    const auto version = key_string::Version::V1;
+    const BsonsAndKeyStrings bsonsAndKeyStrings = generateBsonsAndKeyStrings(bsonType, version);
+
+    for (auto _ : state) {
+        benchmark::ClobberMemory();
+        for (size_t i = 0; i + 1 < kSampleSize; i++) {
+            benchmark::DoNotOptimize(
+                key_string::compare(bsonsAndKeyStrings.keystrings[i].get(),
+                                    bsonsAndKeyStrings.keystrings[i + 1].get(),
+                                    bsonsAndKeyStrings.keystringLens[i],
+                                    bsonsAndKeyStrings.keystringLens[i + 1]));
+        }
+    }
+    state.SetBytesProcessed(state.iterations() * bsonsAndKeyStrings.keystringSize);
+    state.SetItemsProcessed(state.iterations() * (kSampleSize - 1));
+}
+
+void BM_KeyStringRecordIdLongDecode(benchmark::State& state, const int64_t repr) {
+    // Two RecordIds back to back, like a unique index key followed by its RecordId. The first one
+    // is decoded with bytes to spare after it, the second one at the very end of the buffer.
+    key_string::Builder ks(key_string::Version::V1);
+    ks.appendRecordId(RecordId(repr));
+    ks.appendRecordId(RecordId(repr));
+    auto ksBuf = ks.getBuffer();
+    auto ksSize = ks.getSize();
+    for (auto _ : state) {
+        benchmark::ClobberMemory();
+        BufReader reader(ksBuf, ksSize);
+        benchmark::DoNotOptimize(key_string::decodeRecordIdLong(&reader));
+        benchmark::DoNotOptimize(key_string::decodeRecordIdLong(&reader));
+    }
+    state.SetItemsProcessed(state.iterations() * 2);
+}
+
 void BM_KeyStringRecordIdStrAppend(benchmark::State& state, const size_t size) {
     const auto buf = std::string(size, 'a');
     auto rid = RecordId(buf.c_str(), size);
@@ -275,6 +312,16 @@ BENCHMARK_CAPTURE(BM_KeyStringToBSON, V1_String, key_string::Version::V1, STRING
 BENCHMARK_CAPTURE(BM_KeyStringToBSON, V0_Array, key_string::Version::V0, ARRAY);
 BENCHMARK_CAPTURE(BM_KeyStringToBSON, V1_Array, key_string::Version::V1, ARRAY);
 
+BENCHMARK_CAPTURE(BM_KeyStringCompare, Int, INT);
+BENCHMARK_CAPTURE(BM_KeyStringCompare, Double, DOUBLE);
+BENCHMARK_CAPTURE(BM_KeyStringCompare, Decimal, DECIMAL);
+BENCHMARK_CAPTURE(BM_KeyStringCompare, String, STRING);
+BENCHMARK_CAPTURE(BM_KeyStringCompare, Array, ARRAY);
+
+BENCHMARK_CAPTURE(BM_KeyStringRecordIdLongDecode, Small, 1);
+BENCHMARK_CAPTURE(BM_KeyStringRecordIdLongDecode, Medium, 0xDEADBEEF);
+BENCHMARK_CAPTURE(BM_KeyStringRecordIdLongDecode, Large, std::numeric_limits<int64_t>::max());
+
 BENCHMARK_CAPTURE(BM_KeyStringRecordIdStrAppend, 16B, 16);
 BENCHMARK_CAPTURE(BM_KeyStringRecordIdStrAppend, 512B, 512);
 BENCHMARK_CAPTURE(BM_KeyStringRecordIdStrAppend, 1kB, 1024);
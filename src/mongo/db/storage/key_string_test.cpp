@@ -1788,6 +1788,21 @@ TEST_F(KeyStringBuilderTest, RecordIds) {
     }
 }
 
+TEST(KeyStringCompareTest, RawBuffers) {
+    ASSERT_EQ(key_string::compare(nullptr, nullptr, 0, 0), 0);
+    ASSERT_EQ(key_string::compare(nullptr, "a", 0, 1), -1);
+    ASSERT_EQ(key_string::compare("a", nullptr, 1, 0), 1);
+
+    ASSERT_EQ(key_string::compare("abc", "abc", 3, 3), 0);
+    ASSERT_EQ(key_string::compare("ab", "abc", 2, 3), -1);
+    ASSERT_EQ(key_string::compare("abc", "ab", 3, 2), 1);
+    ASSERT_EQ(key_string::compare("abd", "abc", 3, 3), 1);
+
+    // Bytes compare as unsigned, and the result is normalized regardless of the byte distance.
+    ASSERT_EQ(key_string::compare("\x01", "\xff", 1, 1), -1);
+    ASSERT_EQ(key_string::compare("\xff", "\x01", 1, 1), 1);
+}
+
 TEST_F(KeyStringBuilderTest, KeyWithLotsOfTypeBits) {
     BSONObj obj;
     {
@@ -29,6 +29,7 @@
 
 #pragma once
 
+#include <boost/optional/optional.hpp>
 #include <memory>
 #include <string>
 #include <vector>
@@ -488,6 +489,14 @@ public:
         return 0;
     }
 
+    /**
+     * Returns the fraction of the cache currently occupied by dirty data, or boost::none if the
+     * engine does not track it.
+     */
+    virtual boost::optional<double> getCacheDirtyRatio() const {
+        return boost::none;
+    }
+
     /**
      * Returns the input storage engine options, sanitized to remove options that may not apply to
      * this node, such as encryption. Might be called for both collection and index options. See
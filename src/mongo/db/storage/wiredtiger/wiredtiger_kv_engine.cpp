@@ -771,6 +771,9 @@ void WiredTigerKVEngine::cleanShutdown() {
         return;
     }
 
+    // Must run before halting the oplog manager, which forgets the oplog record store.
+    _persistOplogTruncateMarkers();
+
     // these must be the last things we do before _conn->close();
     haltOplogManager(/*oplogRecordStore=*/nullptr, /*shuttingDown=*/true);
     if (_sessionSweeper) {
@@ -2037,6 +2040,9 @@ void WiredTigerKVEngine::_checkpoint(WT_SESSION* session) try {
     // more threads checkpoint at the same time.
     stdx::lock_guard lk(_checkpointMutex);
 
+    // Write the oplog truncate markers first so that this checkpoint includes them.
+    _persistOplogTruncateMarkers();
+
     const Timestamp stableTimestamp = getStableTimestamp();
     const Timestamp initialDataTimestamp = getInitialDataTimestamp();
 
@@ -2708,6 +2714,13 @@ void WiredTigerKVEngine::startOplogManager(OperationContext* opCtx,
     _oplogRecordStore = oplogRecordStore;
 }
 
+void WiredTigerKVEngine::_persistOplogTruncateMarkers() {
+    stdx::lock_guard<Latch> lock(_oplogManagerMutex);
+    if (_oplogRecordStore) {
+        _oplogRecordStore->persistOplogTruncateMarkers();
+    }
+}
+
 void WiredTigerKVEngine::haltOplogManager(WiredTigerRecordStore* oplogRecordStore,
                                           bool shuttingDown) {
     stdx::unique_lock<Latch> lock(_oplogManagerMutex);
@@ -2785,6 +2798,18 @@ size_t WiredTigerKVEngine::getCacheSizeMB() const {
     return _cacheSizeMB;
 }
 
+boost::optional<double> WiredTigerKVEngine::getCacheDirtyRatio() const {
+    WiredTigerSession session(_conn);
+    auto dirtyBytes = WiredTigerUtil::getStatisticsValue(
+        session.getSession(), "statistics:", "", WT_STAT_CONN_CACHE_BYTES_DIRTY);
+    auto maxBytes = WiredTigerUtil::getStatisticsValue(
+        session.getSession(), "statistics:", "", WT_STAT_CONN_CACHE_BYTES_MAX);
+    if (!dirtyBytes.isOK() || !maxBytes.isOK() || maxBytes.getValue() <= 0) {
+        return boost::none;
+    }
+    return static_cast<double>(dirtyBytes.getValue()) / maxBytes.getValue();
+}
+
 BSONObj WiredTigerKVEngine::getSanitizedStorageOptionsForSecondaryReplication(
     const BSONObj& options) const {
 
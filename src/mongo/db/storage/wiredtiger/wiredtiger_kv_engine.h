@@ -503,6 +503,8 @@ public:
 
     size_t getCacheSizeMB() const override;
 
+    boost::optional<double> getCacheDirtyRatio() const override;
+
     // TODO SERVER-81069: Remove this since it's intrinsically tied to encryption options only.
     BSONObj getSanitizedStorageOptionsForSecondaryReplication(
         const BSONObj& options) const override;
@@ -578,6 +580,11 @@ private:
 
     void _checkpoint(WT_SESSION* session);
 
+    /**
+     * Persists the truncate markers of the current oplog record store, if any.
+     */
+    void _persistOplogTruncateMarkers();
+
     void _checkpoint(WT_SESSION* session, bool useTimestamp);
 
     /**
@@ -35,7 +35,10 @@
 #include <memory>
 #include <mutex>
 #include <string>
+#include <utility>
 
+#include "mongo/base/error_codes.h"
+#include "mongo/base/status.h"
 #include "mongo/db/client.h"
 #include "mongo/db/record_id.h"
 #include "mongo/db/repl/replication_coordinator.h"
@@ -120,6 +123,7 @@ void WiredTigerOplogManager::haltVisibilityThread() {
         return;
     }
 
+    std::multimap<uint64_t, Promise<void>> waiters;
     {
         stdx::lock_guard<Latch> lk(_oplogVisibilityStateMutex);
 
@@ -131,6 +135,13 @@ void WiredTigerOplogManager::haltVisibilityThread() {
 
         _isRunning.store(false);
         _shuttingDown = true;
+        waiters = std::exchange(_oplogVisibilityWaiters, {});
+    }
+
+    // Nothing will advance oplog visibility any more, so release everyone still waiting.
+    for (auto& [ts, promise] : waiters) {
+        promise.setError(
+            Status(ErrorCodes::InterruptedAtShutdown, "Oplog visibility thread is shutting down"));
     }
 
     if (_oplogVisibilityThread.joinable()) {
@@ -171,19 +182,9 @@ void WiredTigerOplogManager::waitForAllEarlierOplogWritesToBeVisible(
     // Close transaction before we wait.
     shard_role_details::getRecoveryUnit(opCtx)->abandonSnapshot();
 
-    stdx::unique_lock<Latch> lk(_oplogVisibilityStateMutex);
-
-    // Prevent any scheduled oplog visibility updates from being delayed for batching and blocking
-    // this wait excessively.
-    ++_opsWaitingForOplogVisibilityUpdate;
-    invariant(_opsWaitingForOplogVisibilityUpdate > 0);
-    ScopeGuard exitGuard([&] { --_opsWaitingForOplogVisibilityUpdate; });
+    auto visible = [&] {
+        stdx::lock_guard<Latch> lk(_oplogVisibilityStateMutex);
 
-    // Out of order writes to the oplog always call triggerOplogVisibilityUpdate() on commit to
-    // prompt the OplogVisibilityThread to run and update the oplog visibility. We simply need to
-    // wait until all of the writes behind and including 'waitingFor' commit so there are no oplog
-    // holes.
-    opCtx->waitForConditionOrInterrupt(_oplogEntriesBecameVisibleCV, lk, [&] {
         auto newLatestVisibleTimestamp = getOplogReadTimestamp();
         if (newLatestVisibleTimestamp < currentLatestVisibleTimestamp) {
             LOGV2_DEBUG(22370,
@@ -195,20 +196,53 @@ void WiredTigerOplogManager::waitForAllEarlierOplogWritesToBeVisible(
                         "previouslyFoundLatestVisibleOplogEntryTimestamp"_attr =
                             Timestamp(currentLatestVisibleTimestamp));
             // We cannot wait for a write that no longer exists, so we are finished.
-            return true;
+            return Future<void>::makeReady();
         }
-        currentLatestVisibleTimestamp = newLatestVisibleTimestamp;
-        RecordId newLatestVisible = RecordId(currentLatestVisibleTimestamp);
-        if (newLatestVisible < waitingFor) {
+
+        // Out of order writes to the oplog always call triggerOplogVisibilityUpdate() on commit to
+        // prompt the OplogVisibilityThread to run and update the oplog visibility. We simply need
+        // to wait until all of the writes behind and including 'waitingFor' commit so there are no
+        // oplog holes. Registering the waiter also prevents any scheduled oplog visibility update
+        // from being delayed for batching and blocking this wait excessively.
+        if (RecordId(newLatestVisibleTimestamp) < waitingFor) {
             LOGV2_DEBUG(22371,
                         2,
                         "Operation is waiting for an entry to become visible in the oplog.",
                         "awaitedOplogEntryTimestamp"_attr = Timestamp(waitingFor.getLong()),
                         "currentLatestVisibleOplogEntryTimestamp"_attr =
-                            Timestamp(currentLatestVisibleTimestamp));
+                            Timestamp(newLatestVisibleTimestamp));
         }
-        return newLatestVisible >= waitingFor;
-    });
+        return _registerWaiter(lk, static_cast<uint64_t>(waitingFor.getLong()));
+    }();
+
+    // The future is also ready if visibility later goes backwards, as then the write we are
+    // waiting for may no longer exist.
+    std::move(visible).get(opCtx);
+}
+
+Future<void> WiredTigerOplogManager::onOplogVisible(Timestamp ts) {
+    stdx::lock_guard<Latch> lk(_oplogVisibilityStateMutex);
+    return _registerWaiter(lk, ts.asULL());
+}
+
+Future<void> WiredTigerOplogManager::_registerWaiter(WithLock, uint64_t ts) {
+    if (ts <= getOplogReadTimestamp()) {
+        return Future<void>::makeReady();
+    }
+    if (_shuttingDown) {
+        return Future<void>::makeReady(
+            Status(ErrorCodes::InterruptedAtShutdown, "Oplog visibility thread is shutting down"));
+    }
+
+    auto [promise, future] = makePromiseFuture<void>();
+    _oplogVisibilityWaiters.emplace(ts, std::move(promise));
+    return std::move(future);
+}
+
+void WiredTigerOplogManager::_fulfillWaiters(std::vector<Promise<void>> waiters) {
+    for (auto& promise : waiters) {
+        promise.emplaceValue();
+    }
 }
 
 void WiredTigerOplogManager::_updateOplogVisibilityLoop(WiredTigerSessionCache* sessionCache,
@@ -240,7 +274,7 @@ void WiredTigerOplogManager::_updateOplogVisibilityLoop(WiredTigerSessionCache*
             auto deadline = now + Milliseconds(kDelayMillis);
 
             auto wakeUpEarlyForWaitersPredicate = [&] {
-                return _shuttingDown || _opsWaitingForOplogVisibilityUpdate ||
+                return _shuttingDown || !_oplogVisibilityWaiters.empty() ||
                     oplogRecordStore->haveCappedWaiters();
             };
 
@@ -283,12 +317,15 @@ void WiredTigerOplogManager::_updateOplogVisibilityLoop(WiredTigerSessionCache*
         }
 
         // Publish the new timestamp value. Avoid going backward.
+        std::vector<Promise<void>> nowVisible;
         auto currentVisibleTimestamp = getOplogReadTimestamp();
         if (newTimestamp > currentVisibleTimestamp) {
-            _setOplogReadTimestamp(lk, newTimestamp);
+            nowVisible = _setOplogReadTimestamp(lk, newTimestamp);
         }
         lk.unlock();
 
+        _fulfillWaiters(std::move(nowVisible));
+
         // Wake up any awaitData cursors and tell them more data might be visible now.
         //
         // We normally notify waiters on capped collection inserts/updates, but oplog entries will
@@ -303,17 +340,33 @@ std::uint64_t WiredTigerOplogManager::getOplogReadTimestamp() const {
 }
 
 void WiredTigerOplogManager::setOplogReadTimestamp(Timestamp ts) {
-    stdx::lock_guard<Latch> lk(_oplogVisibilityStateMutex);
-    _setOplogReadTimestamp(lk, ts.asULL());
+    std::vector<Promise<void>> nowVisible;
+    {
+        stdx::lock_guard<Latch> lk(_oplogVisibilityStateMutex);
+        nowVisible = _setOplogReadTimestamp(lk, ts.asULL());
+    }
+    _fulfillWaiters(std::move(nowVisible));
 }
 
-void WiredTigerOplogManager::_setOplogReadTimestamp(WithLock, uint64_t newTimestamp) {
+std::vector<Promise<void>> WiredTigerOplogManager::_setOplogReadTimestamp(WithLock,
+                                                                          uint64_t newTimestamp) {
+    const auto previousTimestamp = _oplogReadTimestamp.load();
     _oplogReadTimestamp.store(newTimestamp);
-    _oplogEntriesBecameVisibleCV.notify_all();
     LOGV2_DEBUG(22374,
                 2,
                 "Updating the oplogReadTimestamp.",
                 "newOplogReadTimestamp"_attr = Timestamp(newTimestamp));
+
+    // Only release the waiters whose timestamp is now visible. If visibility went backwards, a
+    // rollback likely removed the entries being waited for, so release everyone.
+    auto end = newTimestamp < previousTimestamp ? _oplogVisibilityWaiters.end()
+                                                : _oplogVisibilityWaiters.upper_bound(newTimestamp);
+    std::vector<Promise<void>> nowVisible;
+    for (auto it = _oplogVisibilityWaiters.begin(); it != end; ++it) {
+        nowVisible.push_back(std::move(it->second));
+    }
+    _oplogVisibilityWaiters.erase(_oplogVisibilityWaiters.begin(), end);
+    return nowVisible;
 }
 
 }  // namespace mongo
@@ -30,6 +30,8 @@
 #pragma once
 
 #include <cstdint>
+#include <map>
+#include <vector>
 
 #include "mongo/bson/timestamp.h"
 #include "mongo/db/operation_context.h"
@@ -40,6 +42,7 @@
 #include "mongo/stdx/condition_variable.h"
 #include "mongo/stdx/thread.h"
 #include "mongo/util/concurrency/with_lock.h"
+#include "mongo/util/future.h"
 
 namespace mongo {
 
@@ -91,6 +94,17 @@ public:
     void waitForAllEarlierOplogWritesToBeVisible(const WiredTigerRecordStore* oplogRecordStore,
                                                  OperationContext* opCtx);
 
+    /**
+     * Returns a future that becomes ready once the oplog read timestamp reaches 'ts', or as soon
+     * as the oplog read timestamp moves backwards, since a rollback may have removed the entry
+     * being waited for. The future is ready immediately if 'ts' is already visible, and is set to
+     * an InterruptedAtShutdown error if the visibility thread is halted first.
+     *
+     * Waiters are kept ordered by timestamp, so an update only completes the waiters it makes
+     * visible. Continuations run on the thread that advanced visibility, outside of any mutex.
+     */
+    Future<void> onOplogVisible(Timestamp ts);
+
     /**
      * The oplogReadTimestamp is the read timestamp used for forward cursor oplog reads to prevent
      * such readers from missing any entries in the oplog that may not yet have committed ('holes')
@@ -111,7 +125,18 @@ private:
     void _updateOplogVisibilityLoop(WiredTigerSessionCache* sessionCache,
                                     WiredTigerRecordStore* oplogRecordStore);
 
-    void _setOplogReadTimestamp(WithLock, uint64_t newTimestamp);
+    /**
+     * Publishes 'newTimestamp' and returns the promises of the waiters it releases, which the
+     * caller must fulfill after dropping '_oplogVisibilityStateMutex'.
+     */
+    std::vector<Promise<void>> _setOplogReadTimestamp(WithLock, uint64_t newTimestamp);
+
+    /**
+     * Returns a future for 'ts' becoming visible, registering a waiter unless it already is.
+     */
+    Future<void> _registerWaiter(WithLock, uint64_t ts);
+
+    static void _fulfillWaiters(std::vector<Promise<void>> waiters);
 
     AtomicWord<unsigned long long> _oplogReadTimestamp{0};
 
@@ -120,9 +145,6 @@ private:
     // Signaled to trigger the oplog visibility thread to run.
     mutable stdx::condition_variable _oplogVisibilityThreadCV;
 
-    // Signaled when oplog visibility has been updated.
-    mutable stdx::condition_variable _oplogEntriesBecameVisibleCV;
-
     // Protects the state below.
     mutable Mutex _oplogVisibilityStateMutex =
         MONGO_MAKE_LATCH("WiredTigerOplogManager::_oplogVisibilityStateMutex");
@@ -135,8 +157,8 @@ private:
     // update, per the _opsWaitingForOplogVisibility counter.
     bool _triggerOplogVisibilityUpdate = false;
 
-    // Incremented when a caller is waiting for more of the oplog to become visible, to avoid update
-    // delays for batching.
-    int64_t _opsWaitingForOplogVisibilityUpdate = 0;
+    // Callers waiting for more of the oplog to become visible, keyed by the timestamp they need.
+    // Any waiter also prevents update delays for batching.
+    std::multimap<uint64_t, Promise<void>> _oplogVisibilityWaiters;
 };
 }  // namespace mongo
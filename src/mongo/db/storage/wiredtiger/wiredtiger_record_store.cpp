@@ -49,6 +49,7 @@
 #include "mongo/base/error_codes.h"
 #include "mongo/base/static_assert.h"
 #include "mongo/bson/bsonelement.h"
+#include "mongo/bson/bsonobjbuilder.h"
 #include "mongo/bson/util/builder.h"
 #include "mongo/bson/util/builder_fwd.h"
 #include "mongo/db/catalog/collection_catalog.h"
@@ -200,6 +201,12 @@ void setKey(WT_CURSOR* cursor, const WiredTigerRecordStore::CursorKey* key) {
 }
 
 auto& boundRetries = *MetricBuilder<Counter64>("wiredTiger.recordStoreCursorBoundRetries");
+
+// Size storer key of the persisted oplog truncate markers. URIs always contain a ':' before any
+// '|', so this cannot collide with the size information of a table.
+std::string oplogTruncateMarkersMetadataKey(StringData uri) {
+    return str::stream() << "oplogTruncateMarkers|" << uri;
+}
 }  // namespace
 
 MONGO_FAIL_POINT_DEFINE(WTCompactRecordStoreEBUSY);
@@ -238,31 +245,188 @@ WiredTigerRecordStore::OplogTruncateMarkers::createOplogTruncateMarkers(Operatio
     // We need to read the whole oplog, override the recoveryUnit's oplogVisibleTimestamp.
     ScopedOplogVisibleTimestamp scopedOplogVisibleTimestamp(
         shard_role_details::getRecoveryUnit(opCtx), boost::none);
-    UnyieldableCollectionIterator iterator(opCtx, rs);
-    auto initialSetOfMarkers = CollectionTruncateMarkers::createFromCollectionIterator(
-        opCtx,
-        iterator,
-        ns,
-        minBytesPerTruncateMarker,
-        [](const Record& record) {
-            BSONObj obj = record.data.toBson();
-            auto wallTime = obj.hasField(repl::DurableOplogEntry::kWallClockTimeFieldName)
-                ? obj[repl::DurableOplogEntry::kWallClockTimeFieldName].Date()
-                : obj[repl::DurableOplogEntry::kTimestampFieldName].timestampTime();
-            return RecordIdAndWallTime(record.id, wallTime);
-        },
-        numTruncateMarkersToKeep);
+
+    auto getRecordIdAndWallTime = [](const Record& record) {
+        BSONObj obj = record.data.toBson();
+        auto wallTime = obj.hasField(repl::DurableOplogEntry::kWallClockTimeFieldName)
+            ? obj[repl::DurableOplogEntry::kWallClockTimeFieldName].Date()
+            : obj[repl::DurableOplogEntry::kTimestampFieldName].timestampTime();
+        return RecordIdAndWallTime(record.id, wallTime);
+    };
+
+    boost::optional<InitialSetOfMarkers> initialSetOfMarkers;
+    if (gPersistOplogTruncationPoints && rs->_sizeStorer) {
+        if (auto persisted =
+                rs->_sizeStorer->loadMetadata(oplogTruncateMarkersMetadataKey(rs->_uri))) {
+            initialSetOfMarkers = loadPersistedMarkers(
+                opCtx, rs, *persisted, minBytesPerTruncateMarker, getRecordIdAndWallTime);
+        }
+    }
+
+    if (!initialSetOfMarkers) {
+        UnyieldableCollectionIterator iterator(opCtx, rs);
+        initialSetOfMarkers =
+            CollectionTruncateMarkers::createFromCollectionIterator(opCtx,
+                                                                    iterator,
+                                                                    ns,
+                                                                    minBytesPerTruncateMarker,
+                                                                    getRecordIdAndWallTime,
+                                                                    numTruncateMarkersToKeep);
+    }
     LOGV2(22382,
           "WiredTiger record store oplog processing finished",
-          "duration"_attr = duration_cast<Milliseconds>(initialSetOfMarkers.timeTaken));
-    return std::make_shared<WiredTigerRecordStore::OplogTruncateMarkers>(
-        std::move(initialSetOfMarkers.markers),
-        initialSetOfMarkers.leftoverRecordsCount,
-        initialSetOfMarkers.leftoverRecordsBytes,
+          "duration"_attr = duration_cast<Milliseconds>(initialSetOfMarkers->timeTaken),
+          "method"_attr = CollectionTruncateMarkers::toString(initialSetOfMarkers->methodUsed));
+    auto oplogTruncateMarkers = std::make_shared<WiredTigerRecordStore::OplogTruncateMarkers>(
+        std::move(initialSetOfMarkers->markers),
+        initialSetOfMarkers->leftoverRecordsCount,
+        initialSetOfMarkers->leftoverRecordsBytes,
         minBytesPerTruncateMarker,
-        initialSetOfMarkers.timeTaken,
-        initialSetOfMarkers.methodUsed,
+        initialSetOfMarkers->timeTaken,
+        initialSetOfMarkers->methodUsed,
         rs);
+
+    // Whichever way the markers were built, they now account for the whole oplog.
+    if (auto lastRecord = rs->getCursor(opCtx, false /* reverse cursor */)->next()) {
+        stdx::lock_guard<Latch> lk(oplogTruncateMarkers->_highestRecordMutex);
+        oplogTruncateMarkers->_highestRecord = lastRecord->id;
+    }
+    return oplogTruncateMarkers;
+}
+
+boost::optional<CollectionTruncateMarkers::InitialSetOfMarkers>
+WiredTigerRecordStore::OplogTruncateMarkers::loadPersistedMarkers(
+    OperationContext* opCtx,
+    WiredTigerRecordStore* rs,
+    const BSONObj& persisted,
+    int64_t minBytesPerMarker,
+    const std::function<RecordIdAndWallTime(const Record&)>& getRecordIdAndWallTime) {
+    Timer timer;
+
+    RecordId highestRecord;
+    std::deque<Marker> markers;
+    int64_t currentRecords = 0;
+    int64_t currentBytes = 0;
+    try {
+        highestRecord = RecordId(persisted["highestRecord"].Long());
+        currentRecords = persisted["partialRecords"].Long();
+        currentBytes = persisted["partialBytes"].Long();
+        for (auto&& elem : persisted["markers"].Obj()) {
+            auto marker = elem.Obj();
+            markers.emplace_back(marker["records"].Long(),
+                                 marker["bytes"].Long(),
+                                 RecordId(marker["lastRecord"].Long()),
+                                 marker["wallTime"].Date());
+        }
+    } catch (const DBException& ex) {
+        LOGV2_WARNING(9156621,
+                      "Ignoring unreadable persisted oplog truncate markers",
+                      "error"_attr = ex.toStatus());
+        return boost::none;
+    }
+
+    auto ignore = [&](StringData reason) {
+        LOGV2(9156622,
+              "Not reusing the persisted oplog truncate markers",
+              "reason"_attr = reason,
+              "highestRecord"_attr = highestRecord);
+        return boost::none;
+    };
+
+    for (size_t i = 0; i < markers.size(); ++i) {
+        if (markers[i].lastRecord > highestRecord ||
+            (i > 0 && markers[i].lastRecord <= markers[i - 1].lastRecord)) {
+            return ignore("markers are out of order");
+        }
+    }
+
+    // The persisted markers are only valid for this oplog if the highest record they account for
+    // still exists. It does not after a crash lost the end of the oplog, or after a rollback or
+    // replication recovery truncated it.
+    auto cursor = rs->getCursor(opCtx, true /* forward cursor */);
+    if (!cursor->seekExact(highestRecord)) {
+        return ignore("highest accounted record no longer exists");
+    }
+
+    // The oldest markers may have been reclaimed after they were persisted.
+    auto firstRecord = rs->getCursor(opCtx, true /* forward cursor */)->next();
+    invariant(firstRecord);
+    while (!markers.empty() && markers.front().lastRecord < firstRecord->id) {
+        markers.pop_front();
+    }
+
+    // Account for the tail of the oplog written since the markers were persisted.
+    int64_t tailRecords = 0;
+    while (auto record = cursor->next()) {
+        ++tailRecords;
+        ++currentRecords;
+        currentBytes += record->data.size();
+        if (currentBytes >= minBytesPerMarker) {
+            auto [_, wallTime] = getRecordIdAndWallTime(*record);
+            markers.emplace_back(std::exchange(currentRecords, 0),
+                                 std::exchange(currentBytes, 0),
+                                 record->id,
+                                 wallTime);
+        }
+    }
+
+    LOGV2(9156623,
+          "Reusing the persisted oplog truncate markers",
+          "numMarkers"_attr = markers.size(),
+          "highestRecord"_attr = highestRecord,
+          "tailRecordsScanned"_attr = tailRecords);
+    return InitialSetOfMarkers{std::move(markers),
+                               currentRecords,
+                               currentBytes,
+                               Microseconds(timer.micros()),
+                               MarkersCreationMethod::Persisted};
+}
+
+void WiredTigerRecordStore::OplogTruncateMarkers::updateCurrentMarkerAfterInsertOnCommit(
+    OperationContext* opCtx,
+    int64_t bytesInserted,
+    const RecordId& highestInsertedRecordId,
+    Date_t wallTime,
+    int64_t countInserted) {
+    CollectionTruncateMarkers::updateCurrentMarkerAfterInsertOnCommit(
+        opCtx, bytesInserted, highestInsertedRecordId, wallTime, countInserted);
+    shard_role_details::getRecoveryUnit(opCtx)->onCommit(
+        [markers = std::static_pointer_cast<OplogTruncateMarkers>(shared_from_this()),
+         recordId = highestInsertedRecordId](OperationContext*, boost::optional<Timestamp>) {
+            stdx::lock_guard<Latch> lk(markers->_highestRecordMutex);
+            if (markers->_highestRecord < recordId) {
+                markers->_highestRecord = recordId;
+            }
+        });
+}
+
+BSONObj WiredTigerRecordStore::OplogTruncateMarkers::toPersistedBSON() {
+    RecordId highestRecord;
+    {
+        stdx::lock_guard<Latch> lk(_highestRecordMutex);
+        highestRecord = _highestRecord;
+    }
+    if (highestRecord.isNull()) {
+        return BSONObj();
+    }
+
+    BSONObjBuilder builder;
+    builder.append("highestRecord", highestRecord.getLong());
+    modifyMarkersWith([&](std::deque<CollectionTruncateMarkers::Marker>& markers) {
+        modifyPartialMarker([&](CollectionTruncateMarkers::PartialMarkerMetrics metrics) {
+            builder.append("partialRecords", metrics.currentRecords->load());
+            builder.append("partialBytes", metrics.currentBytes->load());
+        });
+        BSONArrayBuilder markersBuilder(builder.subarrayStart("markers"));
+        for (const auto& marker : markers) {
+            BSONObjBuilder markerBuilder(markersBuilder.subobjStart());
+            markerBuilder.append("records", marker.records);
+            markerBuilder.append("bytes", marker.bytes);
+            markerBuilder.append("lastRecord", marker.lastRecord.getLong());
+            markerBuilder.append("wallTime", marker.wallTime);
+        }
+    });
+    return builder.obj();
 }
 
 WiredTigerRecordStore::OplogTruncateMarkers::OplogTruncateMarkers(
@@ -277,8 +441,7 @@ WiredTigerRecordStore::OplogTruncateMarkers::OplogTruncateMarkers(
           std::move(markers), partialMarkerRecords, partialMarkerBytes, minBytesPerMarker),
       _rs(rs),
       _totalTimeProcessing(totalTimeSpentBuilding),
-      _processBySampling(creationMethod ==
-                         CollectionTruncateMarkers::MarkersCreationMethod::Sampling) {}
+      _creationMethod(creationMethod) {}
 
 bool WiredTigerRecordStore::OplogTruncateMarkers::isDead() {
     stdx::lock_guard<Latch> lk(_reclaimMutex);
@@ -301,6 +464,8 @@ void WiredTigerRecordStore::OplogTruncateMarkers::clearMarkersOnCommit(Operation
                     metrics.currentBytes->store(0);
                 });
             });
+            stdx::lock_guard<Latch> lk(_highestRecordMutex);
+            _highestRecord = RecordId();
         });
 }
 
@@ -333,12 +498,25 @@ void WiredTigerRecordStore::OplogTruncateMarkers::updateMarkersAfterCappedTrunca
             metrics.currentBytes->fetchAndAdd(bytesInMarkersToRemove - bytesRemoved);
         });
     });
+
+    // The highest accounted record was removed. Don't persist the markers until the next insert
+    // establishes a new one.
+    stdx::lock_guard<Latch> lk(_highestRecordMutex);
+    if (_highestRecord >= firstRemovedId) {
+        _highestRecord = RecordId();
+    }
 }
 
 void WiredTigerRecordStore::OplogTruncateMarkers::getOplogTruncateMarkersStats(
     BSONObjBuilder& builder) const {
     builder.append("totalTimeProcessingMicros", _totalTimeProcessing.count());
-    builder.append("processingMethod", _processBySampling ? "sampling" : "scanning");
+    StringData processingMethod = "scanning"_sd;
+    if (processedBySampling()) {
+        processingMethod = "sampling"_sd;
+    } else if (processedFromPersisted()) {
+        processingMethod = "persisted"_sd;
+    }
+    builder.append("processingMethod", processingMethod);
     if (auto oplogMinRetentionHours = storageGlobalParams.oplogMinRetentionHours.load()) {
         builder.append("oplogMinRetentionHours", oplogMinRetentionHours);
     }
@@ -793,6 +971,29 @@ void WiredTigerRecordStore::postConstructorInit(OperationContext* opCtx,
     }
 }
 
+void WiredTigerRecordStore::persistOplogTruncateMarkers() const {
+    if (!gPersistOplogTruncationPoints || !_sizeStorer) {
+        return;
+    }
+    std::shared_ptr<OplogTruncateMarkers> oplogTruncateMarkers = _oplogTruncateMarkers;
+    if (!oplogTruncateMarkers) {
+        return;
+    }
+
+    auto persisted = oplogTruncateMarkers->toPersistedBSON();
+    if (persisted.isEmpty()) {
+        return;
+    }
+
+    try {
+        _sizeStorer->storeMetadata(oplogTruncateMarkersMetadataKey(_uri), persisted);
+    } catch (const ExceptionFor<ErrorCodes::WriteConflict>&) {
+        // The markers are persisted again on the next checkpoint, and startup falls back to
+        // scanning or sampling the oplog when they are stale.
+        LOGV2_DEBUG(9156624, 1, "Skipped persisting the oplog truncate markers on write conflict");
+    }
+}
+
 void WiredTigerRecordStore::getOplogTruncateStats(BSONObjBuilder& builder) const {
     if (_oplogTruncateMarkers) {
         _oplogTruncateMarkers->getOplogTruncateMarkersStats(builder);
@@ -1901,8 +2102,8 @@ void WiredTigerRecordStore::_changeNumRecordsAndDataSize(OperationContext* opCtx
     }
 
     const auto updateAndStoreSizeInfo = [this](int64_t numRecordDiff, int64_t dataSizeDiff) {
-        _sizeInfo->numRecords.addAndFetch(numRecordDiff);
-        _sizeInfo->dataSize.addAndFetch(dataSizeDiff);
+        _sizeInfo->numRecords.add(numRecordDiff);
+        _sizeInfo->dataSize.add(dataSizeDiff);
 
         if (_sizeStorer)
             _sizeStorer->store(_uri, _sizeInfo);
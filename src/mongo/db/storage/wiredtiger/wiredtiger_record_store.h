@@ -273,6 +273,13 @@ public:
         _sizeStorer = ss;
     }
 
+    /**
+     * Saves the oplog truncate markers in the size storer table, so that the next startup can
+     * reuse them instead of scanning or sampling the whole oplog. Called on checkpoint and clean
+     * shutdown. No-op for record stores without truncate markers.
+     */
+    void persistOplogTruncateMarkers() const;
+
     /**
      * Sets the new number of records and flushes the size storer.
      */
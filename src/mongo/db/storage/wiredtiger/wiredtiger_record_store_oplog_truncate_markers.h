@@ -30,7 +30,10 @@
 #pragma once
 
 #include <boost/optional.hpp>
+#include <cstdint>
+#include <functional>
 
+#include "mongo/bson/bsonobj.h"
 #include "mongo/db/operation_context.h"
 #include "mongo/db/record_id.h"
 #include "mongo/db/storage/collection_truncate_markers.h"
@@ -85,12 +88,43 @@ public:
 
     static std::shared_ptr<WiredTigerRecordStore::OplogTruncateMarkers> createOplogTruncateMarkers(
         OperationContext* opCtx, WiredTigerRecordStore* rs, const NamespaceString& ns);
+
+    void updateCurrentMarkerAfterInsertOnCommit(OperationContext* opCtx,
+                                                int64_t bytesInserted,
+                                                const RecordId& highestInsertedRecordId,
+                                                Date_t wallTime,
+                                                int64_t countInserted) final;
+
+    /**
+     * Serializes the markers, the partial marker and the highest oplog record they account for, so
+     * that a later startup can reuse them through loadPersistedMarkers() instead of scanning or
+     * sampling the whole oplog. Returns an empty object if the highest accounted record is unknown,
+     * e.g. right after a truncation.
+     */
+    BSONObj toPersistedBSON();
+
+    /**
+     * Rebuilds the initial set of markers from 'persisted', then accounts for the oplog records
+     * written after the persisted highest record by scanning only that tail. Returns boost::none if
+     * 'persisted' does not match the current oplog, in which case the caller falls back to the
+     * regular scanning or sampling.
+     */
+    static boost::optional<InitialSetOfMarkers> loadPersistedMarkers(
+        OperationContext* opCtx,
+        WiredTigerRecordStore* rs,
+        const BSONObj& persisted,
+        int64_t minBytesPerMarker,
+        const std::function<RecordIdAndWallTime(const Record&)>& getRecordIdAndWallTime);
     //
     // The following methods are public only for use in tests.
     //
 
     bool processedBySampling() const {
-        return _processBySampling;
+        return _creationMethod == CollectionTruncateMarkers::MarkersCreationMethod::Sampling;
+    }
+
+    bool processedFromPersisted() const {
+        return _creationMethod == CollectionTruncateMarkers::MarkersCreationMethod::Persisted;
     }
 
 private:
@@ -111,7 +145,13 @@ private:
 
     Microseconds _totalTimeProcessing;  // Amount of time spent scanning and/or sampling the
                                         // oplog during start up, if any.
-    bool _processBySampling;            // Whether the oplog was sampled or scanned.
+    CollectionTruncateMarkers::MarkersCreationMethod
+        _creationMethod;  // How the initial markers were built.
+
+    // Highest oplog record accounted for by the markers and the partial marker, persisted
+    // alongside them. Null while unknown.
+    Mutex _highestRecordMutex = MONGO_MAKE_LATCH("OplogTruncateMarkers::_highestRecordMutex");
+    RecordId _highestRecord;
 };
 
 }  // namespace mongo
@@ -1039,6 +1039,70 @@ TEST(WiredTigerRecordStoreTest, OplogTruncateMarkers_NoMarkersGeneratedFromScann
     ASSERT_EQ(wtrs->numRecords(opCtx.get()), realNumRecords);
 }
 
+// Persisted oplog truncate markers are reused on startup as long as the highest record they
+// account for still exists, and only the records written after it are scanned.
+TEST(WiredTigerRecordStoreTest, OplogTruncateMarkers_ReloadPersisted) {
+    std::unique_ptr<RecordStoreHarnessHelper> harnessHelper = newRecordStoreHarnessHelper();
+    auto wtHarnessHelper = dynamic_cast<WiredTigerHarnessHelper*>(harnessHelper.get());
+    std::unique_ptr<RecordStore> rs(wtHarnessHelper->newOplogRecordStoreNoInit());
+
+    WiredTigerRecordStore* wtrs = static_cast<WiredTigerRecordStore*>(rs.get());
+
+    {
+        ServiceContext::UniqueOperationContext opCtx(harnessHelper->newOperationContext());
+        Lock::GlobalLock globalLock(opCtx.get(), MODE_X);
+        for (int i = 1; i <= 4; i++) {
+            ASSERT_EQ(insertBSONWithSize(opCtx.get(), rs.get(), Timestamp(i, 0), 100),
+                      RecordId(i, 0));
+        }
+    }
+
+    auto wtKvEngine = dynamic_cast<WiredTigerKVEngine*>(harnessHelper->getEngine());
+    wtKvEngine->getOplogManager()->setOplogReadTimestamp(Timestamp(4, 0));
+
+    ServiceContext::UniqueOperationContext opCtx(harnessHelper->newOperationContext());
+    Lock::GlobalLock globalLock(opCtx.get(), MODE_X);
+    wtrs->postConstructorInit(opCtx.get(), NamespaceString::kRsOplogNamespace);
+
+    auto oplogTruncateMarkers = wtrs->oplogTruncateMarkers();
+    ASSERT_FALSE(oplogTruncateMarkers->processedBySampling());
+    auto persisted = oplogTruncateMarkers->toPersistedBSON();
+    ASSERT_EQ(persisted["highestRecord"].Long(), RecordId(4, 0).getLong());
+
+    // Write a tail that the persisted markers do not account for.
+    ASSERT_EQ(insertBSONWithSize(opCtx.get(), rs.get(), Timestamp(5, 0), 100), RecordId(5, 0));
+    ASSERT_EQ(insertBSONWithSize(opCtx.get(), rs.get(), Timestamp(6, 0), 100), RecordId(6, 0));
+    wtKvEngine->getOplogManager()->setOplogReadTimestamp(Timestamp(6, 0));
+
+    auto getRecordIdAndWallTime = [](const Record& record) {
+        return CollectionTruncateMarkers::RecordIdAndWallTime(record.id, Date_t::now());
+    };
+    auto reloaded = WiredTigerRecordStore::OplogTruncateMarkers::loadPersistedMarkers(
+        opCtx.get(), wtrs, persisted, 250, getRecordIdAndWallTime);
+    ASSERT(reloaded);
+    ASSERT(reloaded->methodUsed == CollectionTruncateMarkers::MarkersCreationMethod::Persisted);
+
+    int64_t totalRecords = reloaded->leftoverRecordsCount;
+    for (const auto& marker : reloaded->markers) {
+        totalRecords += marker.records;
+    }
+    ASSERT_EQ(6, totalRecords);
+
+    // The 400 persisted partial bytes plus record 5 fill a marker, record 6 starts the next one.
+    ASSERT_FALSE(reloaded->markers.empty());
+    ASSERT_EQ(RecordId(5, 0), reloaded->markers.back().lastRecord);
+    ASSERT_EQ(1, reloaded->leftoverRecordsCount);
+    ASSERT_EQ(100, reloaded->leftoverRecordsBytes);
+
+    // Markers whose highest record no longer exists, e.g. after a rollback, are not reused.
+    auto stale = persisted.addFields(BSON("highestRecord" << RecordId(10, 0).getLong()));
+    ASSERT_FALSE(WiredTigerRecordStore::OplogTruncateMarkers::loadPersistedMarkers(
+        opCtx.get(), wtrs, stale, 250, getRecordIdAndWallTime));
+
+    ASSERT_FALSE(WiredTigerRecordStore::OplogTruncateMarkers::loadPersistedMarkers(
+        opCtx.get(), wtrs, BSON("markers" << 1), 250, getRecordIdAndWallTime));
+}
+
 // Ensure that if we sample and create duplicate oplog truncate markers, perform truncation
 // correctly, and with no crashing behavior. This scenario may be possible if the same record is
 // sampled multiple times during startup, which can be very likely if the size storer is very
@@ -1526,5 +1590,33 @@ TEST(WiredTigerRecordStoreTest, LargestRecordIdSeenIsCorrectWhenGivenRecordIds)
     ASSERT_EQ(5, rs->numRecords(ctx.get()));
 }
 
+// Oplog visibility waiters are only released once the timestamp they wait for becomes visible, or
+// when visibility moves backwards.
+TEST(WiredTigerRecordStoreTest, OplogVisibilityWaitersReleasedInOrder) {
+    WiredTigerOplogManager oplogManager;
+    oplogManager.setOplogReadTimestamp(Timestamp(1, 0));
+
+    ASSERT_TRUE(oplogManager.onOplogVisible(Timestamp(1, 0)).isReady());
+
+    auto visibleAt2 = oplogManager.onOplogVisible(Timestamp(2, 0));
+    auto visibleAt3 = oplogManager.onOplogVisible(Timestamp(3, 0));
+    auto visibleAt5 = oplogManager.onOplogVisible(Timestamp(5, 0));
+    ASSERT_FALSE(visibleAt2.isReady());
+    ASSERT_FALSE(visibleAt3.isReady());
+    ASSERT_FALSE(visibleAt5.isReady());
+
+    oplogManager.setOplogReadTimestamp(Timestamp(3, 0));
+    ASSERT_TRUE(visibleAt2.isReady());
+    ASSERT_TRUE(visibleAt3.isReady());
+    ASSERT_FALSE(visibleAt5.isReady());
+    ASSERT_OK(std::move(visibleAt2).getNoThrow());
+    ASSERT_OK(std::move(visibleAt3).getNoThrow());
+
+    // Going backwards, as on rollback, releases the remaining waiters.
+    oplogManager.setOplogReadTimestamp(Timestamp(2, 0));
+    ASSERT_TRUE(visibleAt5.isReady());
+    ASSERT_OK(std::move(visibleAt5).getNoThrow());
+}
+
 }  // namespace
 }  // namespace mongo
@@ -28,8 +28,10 @@
  */
 
 
+#include <algorithm>
 #include <cerrno>
 #include <cstdlib>
+#include <functional>
 #include <memory>
 #include <mutex>
 
@@ -37,8 +39,10 @@
 #include <boost/optional/optional.hpp>
 #include <wiredtiger.h>
 
+#include "mongo/base/counter.h"
 #include "mongo/base/error_codes.h"
 #include "mongo/base/status.h"
+#include "mongo/db/commands/server_status_metric.h"
 #include "mongo/db/global_settings.h"
 #include "mongo/db/repl/repl_settings.h"
 #include "mongo/db/storage/journal_listener.h"
@@ -50,9 +54,13 @@
 #include "mongo/logv2/log.h"
 #include "mongo/logv2/log_attr.h"
 #include "mongo/logv2/log_component.h"
+#include "mongo/stdx/thread.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/duration.h"
+#include "mongo/util/processinfo.h"
+#include "mongo/util/scopeguard.h"
 #include "mongo/util/str.h"
+#include "mongo/util/time_support.h"
 
 #define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kStorage
 
@@ -91,6 +99,11 @@ WiredTigerSession::~WiredTigerSession() {
 }
 
 namespace {
+// Dividing 'waits' by 'flushes' gives the average number of durable writes sharing a journal flush.
+auto& journalFlushWaits = *MetricBuilder<Counter64>("storage.journal.groupCommit.waits");
+auto& journalFlushes = *MetricBuilder<Counter64>("storage.journal.groupCommit.flushes");
+auto& journalFlushDelays = *MetricBuilder<Counter64>("storage.journal.groupCommit.delayedFlushes");
+
 void _openCursor(WT_SESSION* session,
                  const std::string& uri,
                  const char* config,
@@ -214,7 +227,10 @@ WiredTigerSessionCache::WiredTigerSessionCache(WiredTigerKVEngine* engine)
 WiredTigerSessionCache::WiredTigerSessionCache(WT_CONNECTION* conn,
                                                ClockSource* cs,
                                                WiredTigerKVEngine* engine)
-    : _conn(conn), _clockSource(cs), _engine(engine) {
+    : _conn(conn),
+      _clockSource(cs),
+      _engine(engine),
+      _shards(std::max(ProcessInfo::getNumLogicalCores(), 1u)) {
     uassertStatusOK(_compiledConfigurations.compileAll(_conn));
 }
 
@@ -289,6 +305,10 @@ void WiredTigerSessionCache::waitUntilDurable(OperationContext* opCtx,
 
     auto [journalListener, token] = _getJournalListenerWithToken(opCtx, useListener);
 
+    journalFlushWaits.increment();
+    _journalFlushWaiters.fetchAndAdd(1);
+    ON_BLOCK_EXIT([&] { _journalFlushWaiters.fetchAndSubtract(1); });
+
     uint32_t start = _lastSyncTime.load();
     // Do the remainder in a critical section that ensures only a single thread at a time
     // will attempt to synchronize.
@@ -306,7 +326,17 @@ void WiredTigerSessionCache::waitUntilDurable(OperationContext* opCtx,
 
         return;
     }
+
+    // When other threads are also waiting for durability, hold the flush back briefly so that more
+    // of them can share it. Threads arriving in the meantime read the sync time before it is
+    // bumped below and then wait on the mutex, so the flush covers them too.
+    if (auto delay = gWiredTigerJournalGroupCommitDelayMicros.load();
+        delay > 0 && _journalFlushWaiters.load() > 1) {
+        journalFlushDelays.increment();
+        sleepFor(Microseconds(delay));
+    }
     _lastSyncTime.store(current + 1);
+    journalFlushes.increment();
 
     // Nobody has synched yet, so we have to sync ourselves.
 
@@ -362,16 +392,26 @@ void WiredTigerSessionCache::notifyPreparedUnitOfWorkHasCommittedOrAborted() {
 }
 
 
+WiredTigerSessionCache::SessionCacheShard& WiredTigerSessionCache::_getHomeShard() {
+    return _shards[std::hash<stdx::thread::id>{}(stdx::this_thread::get_id()) % _shards.size()];
+}
+
 void WiredTigerSessionCache::closeAllCursors(const std::string& uri) {
-    stdx::lock_guard<Latch> lock(_cacheLock);
-    for (SessionCache::iterator i = _sessions.begin(); i != _sessions.end(); i++) {
-        (*i)->closeAllCursors(uri);
+    for (auto& shard : _shards) {
+        stdx::lock_guard<Latch> lock(shard.lock);
+        for (SessionCache::iterator i = shard.sessions.begin(); i != shard.sessions.end(); i++) {
+            (*i)->closeAllCursors(uri);
+        }
     }
 }
 
 size_t WiredTigerSessionCache::getIdleSessionsCount() {
-    stdx::lock_guard<Latch> lock(_cacheLock);
-    return _sessions.size();
+    size_t count = 0;
+    for (auto& shard : _shards) {
+        stdx::lock_guard<Latch> lock(shard.lock);
+        count += shard.sessions.size();
+    }
+    return count;
 }
 
 void WiredTigerSessionCache::closeExpiredIdleSessions(int64_t idleTimeMillis) {
@@ -383,19 +423,20 @@ void WiredTigerSessionCache::closeExpiredIdleSessions(int64_t idleTimeMillis) {
     auto cutoffTime = _clockSource->now() - Milliseconds(idleTimeMillis);
     SessionCache sessionsToClose;
 
-    {
-        stdx::lock_guard<Latch> lock(_cacheLock);
+    for (auto& shard : _shards) {
+        stdx::lock_guard<Latch> lock(shard.lock);
         // Discard all sessions that became idle before the cutoff time
-        for (auto it = _sessions.begin(); it != _sessions.end();) {
+        for (auto it = shard.sessions.begin(); it != shard.sessions.end();) {
             auto session = *it;
             invariant(session->getIdleExpireTime() != Date_t::min());
             if (session->getIdleExpireTime() < cutoffTime) {
-                it = _sessions.erase(it);
+                it = shard.sessions.erase(it);
                 sessionsToClose.push_back(session);
             } else {
                 ++it;
             }
         }
+        shard.idleCount.store(shard.sessions.size());
     }
 
     // Closing expired idle sessions is expensive, so do it outside of the cache mutex. This helps
@@ -410,9 +451,20 @@ void WiredTigerSessionCache::closeAll() {
     SessionCache swap;
 
     {
-        stdx::lock_guard<Latch> lock(_cacheLock);
+        // Hold every shard lock while bumping the epoch, so that no releaseSession() can observe
+        // the old epoch and cache its session after that shard has been emptied.
+        std::vector<stdx::unique_lock<Latch>> locks;
+        locks.reserve(_shards.size());
+        for (auto& shard : _shards) {
+            locks.emplace_back(shard.lock);
+        }
+
         _epoch.fetchAndAdd(1);
-        _sessions.swap(swap);
+        for (auto& shard : _shards) {
+            swap.insert(swap.end(), shard.sessions.begin(), shard.sessions.end());
+            shard.sessions.clear();
+            shard.idleCount.store(0);
+        }
     }
 
     for (SessionCache::iterator i = swap.begin(); i != swap.end(); i++) {
@@ -429,20 +481,29 @@ UniqueWiredTigerSession WiredTigerSessionCache::getSession() {
     // operations should be allowed to start.
     invariant(!(_shuttingDown.loadRelaxed() & kShuttingDownMask));
 
-    {
-        stdx::lock_guard<Latch> lock(_cacheLock);
-        if (!_sessions.empty()) {
+    // Start with this thread's own shard, then try to steal from the others before opening a new
+    // session.
+    const size_t homeIndex = &_getHomeShard() - _shards.data();
+    for (size_t i = 0; i < _shards.size(); ++i) {
+        auto& shard = _shards[(homeIndex + i) % _shards.size()];
+        if (i > 0 && shard.idleCount.loadRelaxed() == 0) {
+            continue;
+        }
+
+        stdx::lock_guard<Latch> lock(shard.lock);
+        if (!shard.sessions.empty()) {
             // Get the most recently used session so that if we discard sessions, we're
             // discarding older ones
-            WiredTigerSession* cachedSession = _sessions.back();
-            _sessions.pop_back();
+            WiredTigerSession* cachedSession = shard.sessions.back();
+            shard.sessions.pop_back();
+            shard.idleCount.store(shard.sessions.size());
             // Reset the idle time
             cachedSession->setIdleExpireTime(Date_t::min());
             return UniqueWiredTigerSession(cachedSession);
         }
     }
 
-    // Outside of the cache partition lock, but on release will be put back on the cache
+    // Outside of the cache shard locks, but on release will be put back on the cache
     return UniqueWiredTigerSession(new WiredTigerSession(_conn, this, _epoch.load()));
 }
 
@@ -488,10 +549,12 @@ void WiredTigerSessionCache::releaseSession(WiredTigerSession* session) {
     session->setIdleExpireTime(_clockSource->now());
 
     if (session->_getEpoch() == currentEpoch) {  // check outside of lock to reduce contention
-        stdx::lock_guard<Latch> lock(_cacheLock);
+        auto& shard = _getHomeShard();
+        stdx::lock_guard<Latch> lock(shard.lock);
         if (session->_getEpoch() == _epoch.load()) {  // recheck inside the lock for correctness
             returnedToCache = true;
-            _sessions.push_back(session);
+            shard.sessions.push_back(session);
+            shard.idleCount.store(shard.sessions.size());
         }
     } else
         invariant(session->_getEpoch() < currentEpoch);
@@ -44,6 +44,7 @@
 #include "mongo/platform/atomic_word.h"
 #include "mongo/platform/mutex.h"
 #include "mongo/stdx/condition_variable.h"
+#include "mongo/stdx/new.h"
 #include "mongo/util/clock_source.h"
 #include "mongo/util/time_support.h"
 #include "mongo/util/timer.h"
@@ -344,6 +345,13 @@ public:
      */
     void waitUntilDurable(OperationContext* opCtx, Fsync syncType, UseJournalListener useListener);
 
+    /**
+     * Returns how many journal flushes waitUntilDurable() has performed.
+     */
+    unsigned getJournalFlushCount_forTest() const {
+        return _lastSyncTime.load();
+    }
+
     /**
      * Waits until a prepared unit of work has ended (either been commited or aborted). This
      * should be used when encountering WT_PREPARE_CONFLICT errors. The caller is required to retry
@@ -411,17 +419,38 @@ private:
     AtomicWord<unsigned> _shuttingDown{0};
     static const uint32_t kShuttingDownMask = 1 << 31;
 
-    Mutex _cacheLock = MONGO_MAKE_LATCH("WiredTigerSessionCache::_cacheLock");
     typedef std::vector<WiredTigerSession*> SessionCache;
-    SessionCache _sessions;
 
-    // Bumped when all open sessions need to be closed
+    // Idle sessions are spread across one shard per logical core so that concurrent getSession()
+    // and releaseSession() calls rarely contend on the same latch. A thread prefers the shard its
+    // id hashes to and steals from the other shards when that one is empty.
+    struct alignas(stdx::hardware_destructive_interference_size) SessionCacheShard {
+        Mutex lock = MONGO_MAKE_LATCH("WiredTigerSessionCache::SessionCacheShard::lock");
+        SessionCache sessions;
+
+        // Mirrors sessions.size(), so that stealing can skip empty shards without locking them.
+        AtomicWord<size_t> idleCount{0};
+    };
+
+    /**
+     * Returns the shard the calling thread gets sessions from and returns them to.
+     */
+    SessionCacheShard& _getHomeShard();
+
+    std::vector<SessionCacheShard> _shards;
+
+    // Bumped when all open sessions need to be closed. Only modified while holding the lock of
+    // every shard, so holding any one shard's lock is enough to read a stable value.
     AtomicWord<unsigned long long> _epoch;  // atomic so we can check it outside of the lock
 
     // Counter and critical section mutex for waitUntilDurable
     AtomicWord<unsigned> _lastSyncTime;
     Mutex _lastSyncMutex = MONGO_MAKE_LATCH("WiredTigerSessionCache::_lastSyncMutex");
 
+    // Number of threads in waitUntilDurable waiting for a journal flush, used to tell whether a
+    // flush is worth delaying for group commit.
+    AtomicWord<int> _journalFlushWaiters{0};
+
     // Mutex and cond var for waiting on prepare commit or abort.
     Mutex _prepareCommittedOrAbortedMutex =
         MONGO_MAKE_LATCH("WiredTigerSessionCache::_prepareCommittedOrAbortedMutex");
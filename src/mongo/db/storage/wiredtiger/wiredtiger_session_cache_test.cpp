@@ -29,15 +29,20 @@
 
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include <wiredtiger.h>
 
 #include "mongo/base/string_data.h"
+#include "mongo/db/storage/wiredtiger/wiredtiger_parameters_gen.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_session_cache.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_util.h"
+#include "mongo/stdx/thread.h"
 #include "mongo/unittest/assert.h"
+#include "mongo/unittest/barrier.h"
 #include "mongo/unittest/framework.h"
 #include "mongo/unittest/temp_dir.h"
+#include "mongo/util/scopeguard.h"
 #include "mongo/util/system_clock_source.h"
 
 namespace mongo {
@@ -114,6 +119,72 @@ TEST(WiredTigerSessionCacheTest, CheckSessionCacheCleanup) {
     ASSERT_EQUALS(sessionCache->getIdleSessionsCount(), 0U);
 }
 
+TEST(WiredTigerSessionCacheTest, SessionsReleasedByOtherThreadsAreReused) {
+    WiredTigerSessionCacheHarnessHelper harnessHelper("");
+    WiredTigerSessionCache* sessionCache = harnessHelper.getSessionCache();
+
+    // Release sessions from several threads, which may land them in different shards.
+    std::vector<stdx::thread> threads;
+    for (int i = 0; i < 4; ++i) {
+        threads.emplace_back([&] { sessionCache->getSession(); });
+        threads.back().join();
+    }
+    ASSERT_EQUALS(sessionCache->getIdleSessionsCount(), 1U);
+
+    std::vector<UniqueWiredTigerSession> sessions;
+    for (int i = 0; i < 8; ++i) {
+        sessions.emplace_back(sessionCache->getSession());
+    }
+    ASSERT_EQUALS(sessionCache->getIdleSessionsCount(), 0U);
+
+    // Return them from separate threads, then check that this thread can still take every one of
+    // them back before any new session is opened.
+    for (auto& session : sessions) {
+        stdx::thread([&] { session.reset(); }).join();
+    }
+    ASSERT_EQUALS(sessionCache->getIdleSessionsCount(), 8U);
+    for (auto& session : sessions) {
+        session = sessionCache->getSession();
+    }
+    ASSERT_EQUALS(sessionCache->getIdleSessionsCount(), 0U);
+    sessions.clear();
+    ASSERT_EQUALS(sessionCache->getIdleSessionsCount(), 8U);
+
+    // closeAll() empties every shard, and sessions checked out before it are not cached again.
+    auto outstanding = sessionCache->getSession();
+    sessionCache->closeAll();
+    ASSERT_EQUALS(sessionCache->getIdleSessionsCount(), 0U);
+    outstanding.reset();
+    ASSERT_EQUALS(sessionCache->getIdleSessionsCount(), 0U);
+}
+
+TEST(WiredTigerSessionCacheTest, ConcurrentDurableWaitersShareDelayedJournalFlushes) {
+    WiredTigerSessionCacheHarnessHelper harnessHelper("log=(enabled)");
+    WiredTigerSessionCache* sessionCache = harnessHelper.getSessionCache();
+
+    const auto originalDelay = gWiredTigerJournalGroupCommitDelayMicros.load();
+    gWiredTigerJournalGroupCommitDelayMicros.store(50 * 1000);
+    ON_BLOCK_EXIT([&] { gWiredTigerJournalGroupCommitDelayMicros.store(originalDelay); });
+
+    const int kWaiters = 8;
+    unittest::Barrier barrier(kWaiters);
+    std::vector<stdx::thread> threads;
+    for (int i = 0; i < kWaiters; ++i) {
+        threads.emplace_back([&] {
+            barrier.countDownAndWait();
+            sessionCache->waitUntilDurable(nullptr,
+                                           WiredTigerSessionCache::Fsync::kJournal,
+                                           WiredTigerSessionCache::UseJournalListener::kSkip);
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    // Waiters that arrive while a flush is held back are covered by it.
+    ASSERT_LT(sessionCache->getJournalFlushCount_forTest(), static_cast<unsigned>(kWaiters));
+}
+
 TEST(WiredTigerSessionCacheTest, ReleaseCursorDuringShutdown) {
     WiredTigerSessionCacheHarnessHelper harnessHelper("");
     WiredTigerSessionCache* sessionCache = harnessHelper.getSessionCache();
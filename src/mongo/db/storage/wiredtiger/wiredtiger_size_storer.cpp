@@ -228,4 +228,50 @@ void WiredTigerSizeStorer::flush(bool syncToDisk) {
                 "WiredTigerSizeStorer::flush completed",
                 "duration"_attr = Microseconds{t.micros()});
 }
+
+void WiredTigerSizeStorer::storeMetadata(StringData key, const BSONObj& value) {
+    stdx::lock_guard<Latch> flushLock(_flushMutex);
+
+    WiredTigerSession session(_conn);
+    WT_CURSOR* cursor = session.getNewCursor(_storageUri, "overwrite=true");
+
+    // Like flush(), let the transaction time out rather than deadlock with cache eviction.
+    WiredTigerBeginTxnBlock txnOpen(&session, "operation_timeout_ms=10");
+
+    WiredTigerItem wtKey(key.rawData(), key.size());
+    cursor->set_key(cursor, wtKey.Get());
+    WiredTigerItem wtValue(value.objdata(), value.objsize());
+    cursor->set_value(cursor, wtValue.Get());
+    int ret = cursor->insert(cursor);
+    if (ret == WT_ROLLBACK) {
+        throwWriteConflictException("Size storer metadata write received a rollback.");
+    }
+    invariantWTOK(ret, cursor->session);
+
+    txnOpen.done();
+    invariantWTOK(session.getSession()->commit_transaction(session.getSession(), nullptr),
+                  session.getSession());
+    LOGV2_DEBUG(9156620,
+                2,
+                "WiredTigerSizeStorer::storeMetadata",
+                "key"_attr = key,
+                "size"_attr = value.objsize());
+}
+
+boost::optional<BSONObj> WiredTigerSizeStorer::loadMetadata(StringData key) const {
+    WiredTigerSession session{_conn};
+    auto cursor = session.getNewCursor(_storageUri);
+
+    WT_ITEM wtKey = {key.rawData(), key.size()};
+    cursor->set_key(cursor, &wtKey);
+    int ret = cursor->search(cursor);
+    if (ret == WT_NOTFOUND) {
+        return boost::none;
+    }
+    invariantWTOK(ret, cursor->session);
+
+    WT_ITEM value;
+    invariantWTOK(cursor->get_value(cursor, &value), cursor->session);
+    return BSONObj(reinterpret_cast<const char*>(value.data)).getOwned();
+}
 }  // namespace mongo
@@ -29,15 +29,21 @@
 
 #pragma once
 
+#include <array>
+#include <boost/optional/optional.hpp>
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <string>
 #include <wiredtiger.h>
 
 #include "mongo/base/string_data.h"
+#include "mongo/bson/bsonobj.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_session_cache.h"
 #include "mongo/platform/atomic_word.h"
 #include "mongo/platform/mutex.h"
+#include "mongo/stdx/new.h"
+#include "mongo/stdx/thread.h"
 #include "mongo/util/assert_util_core.h"
 #include "mongo/util/string_map.h"
 
@@ -53,6 +59,9 @@ namespace mongo {
  * in size updates to be lost, so size information is only approximate. Reads use the buffer for
  * pending stores, or otherwise read directly from the WiredTiger table using a dedicated session
  * and cursor.
+ *
+ * The same table also holds a few unbuffered metadata documents under keys that can never collide
+ * with a URI, such as the persisted oplog truncate markers. These are written and read as a whole.
  */
 class WiredTigerSizeStorer {
 public:
@@ -64,14 +73,62 @@ public:
      * SizeInfo.
      */
     struct SizeInfo {
+        /**
+         * A counter split into cache-line sized stripes, so that writers on different threads
+         * updating the same hot collection do not contend on one cache line. Each thread adds to
+         * the stripe its id hashes to, and reads sum all stripes. Reads are therefore only
+         * approximately current while updates are in flight, which is all that size information
+         * promises anyway.
+         */
+        class StripedCounter {
+        public:
+            StripedCounter() = default;
+            explicit StripedCounter(long long value) {
+                _stripes[0].value.store(value);
+            }
+
+            long long load() const {
+                long long sum = 0;
+                for (const auto& stripe : _stripes) {
+                    sum += stripe.value.load();
+                }
+                return sum;
+            }
+
+            /**
+             * Replaces the value of the counter. Additions racing with this call may be lost.
+             */
+            void store(long long value) {
+                for (size_t i = 1; i < kNumStripes; ++i) {
+                    _stripes[i].value.store(0);
+                }
+                _stripes[0].value.store(value);
+            }
+
+            void add(long long diff) {
+                const size_t slot =
+                    std::hash<stdx::thread::id>{}(stdx::this_thread::get_id()) % kNumStripes;
+                _stripes[slot].value.fetchAndAdd(diff);
+            }
+
+        private:
+            // Kept small because every collection and index has a SizeInfo.
+            static constexpr size_t kNumStripes = 4;
+
+            struct alignas(stdx::hardware_destructive_interference_size) Stripe {
+                AtomicWord<long long> value{0};
+            };
+            std::array<Stripe, kNumStripes> _stripes;
+        };
+
         SizeInfo() = default;
         SizeInfo(long long records, long long size) : numRecords(records), dataSize(size) {}
 
         ~SizeInfo() {
             invariant(!_dirty.load());
         }
-        AtomicWord<long long> numRecords;
-        AtomicWord<long long> dataSize;
+        StripedCounter numRecords;
+        StripedCounter dataSize;
 
     private:
         friend WiredTigerSizeStorer;
@@ -104,6 +161,17 @@ public:
      */
     void flush(bool syncToDisk);
 
+    /**
+     * Immediately writes 'value' under 'key', replacing any previous value. Throws a
+     * WriteConflictException if WiredTiger rolls back the write, such as under cache pressure.
+     */
+    void storeMetadata(StringData key, const BSONObj& value);
+
+    /**
+     * Returns an owned copy of the metadata document stored under 'key', if any.
+     */
+    boost::optional<BSONObj> loadMetadata(StringData key) const;
+
 private:
     WT_CONNECTION* _conn;
     const std::string _storageUri;
@@ -27,11 +27,15 @@
  *    it in the license file.
  */
 
+#include <vector>
 #include <wiredtiger.h>
 
+#include "mongo/bson/bsonmisc.h"
+#include "mongo/bson/bsonobjbuilder.h"
 #include "mongo/db/service_context_test_fixture.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_size_storer.h"
 #include "mongo/db/storage/wiredtiger/wiredtiger_util.h"
+#include "mongo/stdx/thread.h"
 #include "mongo/unittest/assert.h"
 #include "mongo/unittest/temp_dir.h"
 
@@ -150,6 +154,26 @@ TEST_F(WiredTigerSizeStorerTest, RemoveAfterFlush) {
     ASSERT_EQ(loaded->dataSize.load(), 0);
 }
 
+TEST_F(WiredTigerSizeStorerTest, StoreMetadata) {
+    auto sizeStorer1 = makeSizeStorer();
+    auto sizeStorer2 = makeSizeStorer();
+    StringData key{"metadata|uri1"};
+
+    ASSERT_FALSE(sizeStorer1.loadMetadata(key));
+
+    sizeStorer1.storeMetadata(key, BSON("a" << 1));
+    auto loaded = sizeStorer2.loadMetadata(key);
+    ASSERT(loaded);
+    ASSERT_BSONOBJ_EQ(*loaded, BSON("a" << 1));
+
+    // Metadata is written as a whole and does not interfere with size information.
+    sizeStorer1.storeMetadata(key, BSON("b" << 2));
+    ASSERT_BSONOBJ_EQ(*sizeStorer2.loadMetadata(key), BSON("b" << 2));
+    auto sizeInfo = sizeStorer2.load("uri1");
+    ASSERT_EQ(sizeInfo->numRecords.load(), 0);
+    ASSERT_EQ(sizeInfo->dataSize.load(), 0);
+}
+
 TEST_F(WiredTigerSizeStorerTest, RemoveNonexistent) {
     auto sizeStorer = makeSizeStorer();
     auto sizeInfo = std::make_shared<WiredTigerSizeStorer::SizeInfo>(1, 10);
@@ -180,5 +204,38 @@ TEST_F(WiredTigerSizeStorerTest, RemoveNonexistent) {
     ASSERT_EQ(loaded->dataSize.load(), sizeInfo->dataSize.load());
 }
 
+TEST_F(WiredTigerSizeStorerTest, ConcurrentUpdatesAreFlushed) {
+    auto sizeStorer = makeSizeStorer();
+    auto sizeInfo = std::make_shared<WiredTigerSizeStorer::SizeInfo>(5, 50);
+    StringData uri{"uri1"};
+
+    // Updates from several threads land in different stripes of the counters.
+    std::vector<stdx::thread> threads;
+    for (int i = 0; i < 8; ++i) {
+        threads.emplace_back([&] {
+            for (int j = 0; j < 100; ++j) {
+                sizeInfo->numRecords.add(1);
+                sizeInfo->dataSize.add(10);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    ASSERT_EQ(sizeInfo->numRecords.load(), 805);
+    ASSERT_EQ(sizeInfo->dataSize.load(), 8050);
+
+    sizeStorer.store(uri, sizeInfo);
+    sizeStorer.flush(false);
+
+    auto loaded = makeSizeStorer().load(uri);
+    ASSERT_EQ(loaded->numRecords.load(), 805);
+    ASSERT_EQ(loaded->dataSize.load(), 8050);
+
+    // Storing a value discards what was accumulated in every stripe.
+    sizeInfo->numRecords.store(3);
+    ASSERT_EQ(sizeInfo->numRecords.load(), 3);
+}
+
 }  // namespace
 }  // namespace mongo
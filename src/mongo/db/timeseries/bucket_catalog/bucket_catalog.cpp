@@ -53,6 +53,7 @@
 #include "mongo/db/timeseries/bucket_catalog/rollover.h"
 #include "mongo/db/timeseries/bucket_compression.h"
 #include "mongo/db/timeseries/timeseries_constants.h"
+#include "mongo/db/timeseries/timeseries_global_options.h"
 #include "mongo/platform/compiler.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/debug_util.h"
@@ -73,8 +74,6 @@ MONGO_FAIL_POINT_DEFINE(hangTimeseriesDirectModificationBeforeFinish);
 MONGO_FAIL_POINT_DEFINE(hangTimeseriesInsertBeforeReopeningBucket);
 MONGO_FAIL_POINT_DEFINE(runPostCommitDebugChecks);
 
-const std::size_t kDefaultNumberOfStripes = 32;
-
 /**
  * Prepares the batch for commit. Sets min/max appropriately, records the number of
  * documents that have previously been committed to the bucket, and renders the batch
@@ -180,7 +179,7 @@ Stripe::Stripe(TrackingContext& trackingContext)
               BucketHasher>(trackingContext)) {}
 
 BucketCatalog::BucketCatalog()
-    : BucketCatalog(kDefaultNumberOfStripes,
+    : BucketCatalog(getTimeseriesBucketCatalogNumberOfStripes(),
                     getTimeseriesIdleBucketExpiryMemoryUsageThresholdBytes) {}
 
 BucketCatalog::BucketCatalog(size_t numberOfStripes, std::function<uint64_t()> memoryUsageThreshold)
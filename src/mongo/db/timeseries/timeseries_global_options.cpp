@@ -27,6 +27,7 @@
  *    it in the license file.
  */
 
+#include <algorithm>
 #include <cstdint>
 
 #include "mongo/platform/atomic_word.h"
@@ -36,6 +37,7 @@ namespace mongo {
 
 AtomicWord<long long> gTimeseriesIdleBucketExpiryMemoryUsageThresholdBytes{-1};
 AtomicWord<long long> gTimeseriesSideBucketCatalogMemoryUsageThresholdBytes{104857600};  // 100MB
+int gTimeseriesBucketCatalogNumberOfStripes{0};
 
 uint64_t getTimeseriesIdleBucketExpiryMemoryUsageThresholdBytes() {
     long long userValue = gTimeseriesIdleBucketExpiryMemoryUsageThresholdBytes.load();
@@ -59,4 +61,18 @@ uint64_t getTimeseriesSideBucketCatalogMemoryUsageThresholdBytes() {
     return static_cast<uint64_t>(gTimeseriesSideBucketCatalogMemoryUsageThresholdBytes.load());
 }
 
+size_t getTimeseriesBucketCatalogNumberOfStripes() {
+    if (gTimeseriesBucketCatalogNumberOfStripes > 0) {
+        return static_cast<size_t>(gTimeseriesBucketCatalogNumberOfStripes);
+    }
+
+    // Keep roughly two stripes per core so that concurrent inserts on different series rarely
+    // contend on the same stripe mutex, without going below the historical default of 32.
+    constexpr size_t kMinStripes = 32;
+    constexpr size_t kMaxStripes = 512;
+    return std::clamp(static_cast<size_t>(ProcessInfo::getNumAvailableCores()) * 2,
+                      kMinStripes,
+                      kMaxStripes);
+}
+
 }  // namespace mongo
@@ -39,6 +39,10 @@ uint64_t getTimeseriesIdleBucketExpiryMemoryUsageThresholdBytes();
 
 extern AtomicWord<long long> gTimeseriesSideBucketCatalogMemoryUsageThresholdBytes;
 uint64_t getTimeseriesSideBucketCatalogMemoryUsageThresholdBytes();
+
+extern int gTimeseriesBucketCatalogNumberOfStripes;
+size_t getTimeseriesBucketCatalogNumberOfStripes();
+
 /**
  * Checks the time or the meta field doesn't contain embedded null bytes.
  */
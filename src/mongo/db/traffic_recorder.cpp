@@ -36,6 +36,7 @@
 #include <string>
 #include <tuple>
 #include <utility>
+#include <vector>
 
 #include <boost/filesystem/path.hpp>
 
@@ -58,6 +59,7 @@
 #include "mongo/db/service_context.h"
 #include "mongo/db/traffic_recorder.h"
 #include "mongo/db/traffic_recorder_gen.h"
+#include "mongo/platform/atomic_word.h"
 #include "mongo/stdx/thread.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/decorable.h"
@@ -88,6 +90,32 @@ MONGO_INITIALIZER(ShouldAlwaysRecordTraffic)(InitializerContext*) {
     shouldAlwaysRecordTraffic = true;
 }
 
+/**
+ * Caches the rendered description of a session. Every message recorded for a session carries the
+ * same description, so building it once per session keeps BSON construction and string formatting
+ * off the observe() path for all but the first message.
+ */
+class SessionDescription {
+public:
+    std::string get(const transport::Session& session) {
+        stdx::lock_guard<Latch> lk(_mutex);
+        if (_description.empty()) {
+            _description = session.toBSON().toString();
+        }
+        return _description;
+    }
+
+private:
+    Mutex _mutex = MONGO_MAKE_LATCH("SessionDescription::_mutex");
+    std::string _description;
+};
+
+const auto getSessionDescription = transport::Session::declareDecoration<SessionDescription>();
+
+// Size of the stream buffer used by the recording thread. A large buffer lets the thread hand
+// whole batches of small messages to the file in a few write calls.
+constexpr std::size_t kRecordingStreamBufferSize = 1024 * 1024;
+
 }  // namespace
 
 /**
@@ -119,8 +147,10 @@ public:
         _thread = stdx::thread([consumer = std::move(_pcqPipe.consumer), this] {
             try {
                 DataBuilder db;
-                std::fstream out(_path,
-                                 std::ios_base::binary | std::ios_base::trunc | std::ios_base::out);
+                std::vector<char> streamBuffer(kRecordingStreamBufferSize);
+                std::fstream out;
+                out.rdbuf()->pubsetbuf(streamBuffer.data(), streamBuffer.size());
+                out.open(_path, std::ios_base::binary | std::ios_base::trunc | std::ios_base::out);
 
                 while (true) {
                     std::deque<TrafficRecordingPacket> storage;
@@ -146,14 +176,9 @@ public:
                         auto size = db.size() + toWrite.size();
                         db.getCursor().write<LittleEndian<uint32_t>>(size);
 
-                        {
-                            stdx::lock_guard<Latch> lk(_mutex);
-                            _written += size;
-                        }
-
                         uassert(ErrorCodes::LogWriteFailed,
                                 "hit maximum log size",
-                                _written < _maxLogSize);
+                                _written.addAndFetch(size) < _maxLogSize);
 
                         out.write(db.getCursor().data(), db.size());
                         out.write(toWrite.buf(), toWrite.size());
@@ -178,7 +203,8 @@ public:
                     const uint64_t order,
                     const Message& message) {
         try {
-            _pcqPipe.producer.push({ts->id(), ts->toBSON().toString(), now, order, message});
+            _pcqPipe.producer.push(
+                {ts->id(), getSessionDescription(ts.get()).get(*ts), now, order, message});
             return true;
         } catch (const ExceptionFor<ErrorCodes::ProducerConsumerQueueProducerQueueDepthExceeded>&) {
             invariant(!shouldAlwaysRecordTraffic);
@@ -218,7 +244,7 @@ public:
     BSONObj getStats() {
         stdx::lock_guard<Latch> lk(_mutex);
         _trafficStats.setBufferedBytes(_pcqPipe.controller.getStats().queueDepth);
-        _trafficStats.setCurrentFileSize(_written);
+        _trafficStats.setCurrentFileSize(_written.load());
         return _trafficStats.toBSON();
     }
 
@@ -266,7 +292,8 @@ private:
     Mutex _mutex = MONGO_MAKE_LATCH("Recording::_mutex");
     bool _inShutdown = false;
     TrafficRecorderStats _trafficStats;
-    size_t _written = 0;
+    // Updated by the recording thread on every record, so it is kept outside of '_mutex'.
+    AtomicWord<size_t> _written{0};
     Status _result = Status::OK();
 };
 
@@ -368,6 +368,13 @@ auto& ttlPasses = *MetricBuilder<Counter64>{"ttl.passes"};
 auto& ttlSubPasses = *MetricBuilder<Counter64>{"ttl.subPasses"};
 auto& ttlDeletedDocuments = *MetricBuilder<Counter64>{"ttl.deletedDocuments"};
 
+// Per-pass throughput: the cumulative time spent in TTL passes, and the duration and number of
+// documents deleted by the most recently completed pass.
+auto& ttlPassTimeMillis = *MetricBuilder<Counter64>{"ttl.passTimeMillis"};
+auto& ttlLastPassTimeMillis = *MetricBuilder<Atomic64Metric>{"ttl.lastPass.timeMillis"};
+auto& ttlLastPassDeletedDocuments =
+    *MetricBuilder<Atomic64Metric>{"ttl.lastPass.deletedDocuments"};
+
 // Counts the subpasses over TTL collections where the deletes on a collection are increased from
 // 'low' to 'normal' priority.
 auto& ttlCollSubpassesIncreasedPriority =
@@ -485,8 +492,16 @@ void TTLMonitor::_doTTLPass(OperationContext* opCtx) {
 
     hangTTLMonitorBetweenPasses.pauseWhileSet(opCtx);
 
-    // Increment the metric after the TTL work has been finished.
-    ON_BLOCK_EXIT([&] { ttlPasses.increment(); });
+    // Increment the metrics after the TTL work has been finished.
+    Timer timer;
+    const auto deletedDocumentsBeforePass = ttlDeletedDocuments.get();
+    ON_BLOCK_EXIT([&] {
+        const auto elapsedMillis = timer.millis();
+        ttlPasses.increment();
+        ttlPassTimeMillis.increment(elapsedMillis);
+        ttlLastPassTimeMillis.set(elapsedMillis);
+        ttlLastPassDeletedDocuments.set(ttlDeletedDocuments.get() - deletedDocumentsBeforePass);
+    });
 
     // Tracks the number of consecutive subpasses that have failed to exhaust a collection of TTL
     // deletes. If a collection incurs 'ttlCollLowPrioritySubpassLimit', then all TTL deletes on the
@@ -66,8 +66,12 @@
 #include "mongo/db/pipeline/aggregate_command_gen.h"
 #include "mongo/db/pipeline/document_source.h"
 #include "mongo/db/pipeline/document_source_cursor.h"
+#include "mongo/db/pipeline/document_source_streaming_group.h"
 #include "mongo/db/pipeline/expression_context.h"
 #include "mongo/db/pipeline/expression_context_for_test.h"
+#include "mongo/db/pipeline/pipeline.h"
+#include "mongo/db/pipeline/pipeline_d.h"
+#include "mongo/db/query/collation/collator_interface_mock.h"
 #include "mongo/db/query/canonical_query.h"
 #include "mongo/db/query/explain_options.h"
 #include "mongo/db/query/find_command.h"
@@ -84,6 +88,7 @@
 #include "mongo/db/storage/storage_options.h"
 #include "mongo/db/transaction_resources.h"
 #include "mongo/dbtests/dbtests.h"  // IWYU pragma: keep
+#include "mongo/idl/server_parameter_test_util.h"
 #include "mongo/platform/mutex.h"
 #include "mongo/stdx/condition_variable.h"
 #include "mongo/unittest/assert.h"
@@ -530,5 +535,84 @@ TEST_F(DocumentSourceCursorTest, NormalCursorShouldErrorAfterBeingKilled) {
     ASSERT_THROWS_CODE(cursor->getNext().isEOF(), AssertionException, ErrorCodes::QueryPlanKilled);
 }
 
+class StreamingGroupOverSortedInputTest : public DocumentSourceCursorTest {
+protected:
+    /**
+     * Builds and attaches the query executor for a pipeline that sorts by 'a' and groups by
+     * 'groupId', and returns the pipeline.
+     */
+    std::unique_ptr<Pipeline, PipelineDeleter> buildPipeline(const std::string& groupId) {
+        auto pipeline = Pipeline::parse(
+            {BSON("$sort" << BSON("a" << 1)),
+             BSON("$group" << BSON("_id" << groupId << "n" << BSON("$sum" << 1)))},
+            ctx());
+        pipeline->optimizePipeline();
+
+        dbtests::WriteContextForTests writeCtx(opCtx(), nss.ns_forTest());
+        _coll = writeCtx.getCollection();
+        PipelineD::buildAndAttachInnerQueryExecutorToPipeline(
+            MultipleCollectionAccessor(_coll), nss, nullptr, pipeline.get());
+        return pipeline;
+    }
+
+    static bool groupIsStreaming(const Pipeline& pipeline) {
+        const auto& sources = pipeline.getSources();
+        ASSERT_EQ(sources.size(), 2U);
+        ASSERT(dynamic_cast<DocumentSourceCursor*>(sources.front().get()));
+        return dynamic_cast<DocumentSourceStreamingGroup*>(sources.back().get());
+    }
+
+    // The $group is only left in the pipeline for the rewrite when it is not lowered into SBE.
+    RAIIServerParameterControllerForTest _controller{"internalQueryFrameworkControl",
+                                                     "forceClassicEngine"};
+
+private:
+    CollectionPtr _coll;
+};
+
+TEST_F(StreamingGroupOverSortedInputTest, GroupByTheSortFieldStreams) {
+    ASSERT_OK(dbtests::createIndex(opCtx(), nss.ns_forTest(), BSON("a" << 1)));
+    for (int a : {2, 1, 3, 1}) {
+        client.insert(nss, BSON("a" << a));
+    }
+
+    auto pipeline = buildPipeline("$a");
+    ASSERT(groupIsStreaming(*pipeline));
+
+    ASSERT_DOCUMENT_EQ(*pipeline->getNext(), (Document{{"_id", 1}, {"n", 2}}));
+    ASSERT_DOCUMENT_EQ(*pipeline->getNext(), (Document{{"_id", 2}, {"n", 1}}));
+    ASSERT_DOCUMENT_EQ(*pipeline->getNext(), (Document{{"_id", 3}, {"n", 1}}));
+    ASSERT_FALSE(pipeline->getNext());
+}
+
+TEST_F(StreamingGroupOverSortedInputTest, GroupByAnotherFieldDoesNotStream) {
+    ASSERT_OK(dbtests::createIndex(opCtx(), nss.ns_forTest(), BSON("a" << 1)));
+    client.insert(nss, BSON("a" << 1 << "b" << 2));
+    client.insert(nss, BSON("a" << 2 << "b" << 1));
+
+    auto pipeline = buildPipeline("$b");
+    ASSERT_FALSE(groupIsStreaming(*pipeline));
+}
+
+TEST_F(StreamingGroupOverSortedInputTest, GroupOverMultikeyIndexDoesNotStream) {
+    ASSERT_OK(dbtests::createIndex(opCtx(), nss.ns_forTest(), BSON("a" << 1)));
+    client.insert(nss, BSON("a" << 1));
+    client.insert(nss, BSON("a" << BSON_ARRAY(0 << 2)));
+
+    auto pipeline = buildPipeline("$a");
+    ASSERT_FALSE(groupIsStreaming(*pipeline));
+}
+
+TEST_F(StreamingGroupOverSortedInputTest, GroupWithCollationDoesNotStream) {
+    ASSERT_OK(dbtests::createIndex(opCtx(), nss.ns_forTest(), BSON("a" << 1)));
+    client.insert(nss, BSON("a" << "x"));
+    client.insert(nss, BSON("a" << "y"));
+    ctx()->setCollator(
+        std::make_unique<CollatorInterfaceMock>(CollatorInterfaceMock::MockType::kReverseString));
+
+    auto pipeline = buildPipeline("$a");
+    ASSERT_FALSE(groupIsStreaming(*pipeline));
+}
+
 }  // namespace
 }  // namespace mongo
@@ -758,6 +758,25 @@ TEST(FromJsonTest, EscapedCharacters) {
     });
 }
 
+TEST(FromJsonTest, EscapesInLongStrings) {
+    // Strings are scanned a word at a time in both directions, so put each kind of character that
+    // needs escaping at every offset of a string spanning several words.
+    for (auto special : {"\"", "\\", "\n", "\x01", "\x7f", "\xc2\x80", "\xea\x80\x80"}) {
+        for (size_t offset = 0; offset < 20; ++offset) {
+            std::string str(20, 'x');
+            str.insert(offset, special);
+            BSONObj obj = B().append("a", str).obj();
+            assertEquals(str, obj, fromjson(tojson(obj, ExtendedCanonicalV2_0_0)), "canonical");
+            assertEquals(str, obj, fromjson(tojson(obj, ExtendedRelaxedV2_0_0)), "relaxed");
+        }
+    }
+
+    checkRejectionEach({
+        "{ \"a\" : \"xxxxxxxxxxxx\x1fxxxxxxxxxx\" }",
+        "{ \"a\" : \"xxxxxxxxxxxxxxxxxx",
+    });
+}
+
 TEST(FromJsonTest, FieldNameTest) {
     checkEquivalenceEach({
         {R"({ b1 : "b" })", B().append("b1", "b").obj()},    // NumbersInFieldName
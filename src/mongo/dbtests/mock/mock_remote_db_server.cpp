@@ -207,7 +207,9 @@ BSONObj MockRemoteDBServer::project(projection_executor::ProjectionExecutor* pro
 
 mongo::BSONArray MockRemoteDBServer::findImpl(InstanceID id,
                                               const NamespaceStringOrUUID& nsOrUuid,
-                                              BSONObj projection) {
+                                              BSONObj projection,
+                                              const BSONObj& min,
+                                              const BSONObj& max) {
     checkIfUp(id);
 
     if (_delayMilliSec > 0) {
@@ -225,8 +227,19 @@ mongo::BSONArray MockRemoteDBServer::findImpl(InstanceID id,
 
     auto ns = nsOrUuid.isUUID() ? _uuidToNs[nsOrUuid.uuid()] : nsOrUuid.nss().toString_forTest();
     const vector<BSONObj>& coll = _dataMgr[ns];
+    // Compares the fields of a document named by an index bound against that bound.
+    auto compareToBound = [](const BSONObj& doc, const BSONObj& bound) {
+        return doc.extractFields(bound, true /* fillWithNull */)
+            .woCompare(bound, BSONObj(), false /* considerFieldName */);
+    };
     BSONArrayBuilder result;
     for (vector<BSONObj>::const_iterator iter = coll.begin(); iter != coll.end(); ++iter) {
+        if (!min.isEmpty() && compareToBound(*iter, min) < 0) {
+            continue;
+        }
+        if (!max.isEmpty() && compareToBound(*iter, max) >= 0) {
+            continue;
+        }
         result.append(project(projectionExecutor.get(), *iter));
     }
 
@@ -235,7 +248,11 @@ mongo::BSONArray MockRemoteDBServer::findImpl(InstanceID id,
 
 mongo::BSONArray MockRemoteDBServer::find(MockRemoteDBServer::InstanceID id,
                                           const FindCommandRequest& findRequest) {
-    return findImpl(id, findRequest.getNamespaceOrUUID(), findRequest.getProjection());
+    return findImpl(id,
+                    findRequest.getNamespaceOrUUID(),
+                    findRequest.getProjection(),
+                    findRequest.getMin(),
+                    findRequest.getMax());
 }
 
 mongo::ConnectionString::ConnectionType MockRemoteDBServer::type() const {
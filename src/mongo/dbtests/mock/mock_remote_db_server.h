@@ -174,7 +174,9 @@ public:
     rpc::UniqueReply runCommand(InstanceID id, const OpMsgRequest& request);
 
     /**
-     * Finds documents from this mock server according to 'findRequest'.
+     * Finds documents from this mock server according to 'findRequest'. Only the projection and
+     * the 'min' and 'max' index bounds of the request are honored; documents are returned in the
+     * order they were inserted.
      */
     mongo::BSONArray find(InstanceID id, const FindCommandRequest& findRequest);
 
@@ -245,7 +247,9 @@ private:
      */
     mongo::BSONArray findImpl(InstanceID id,
                               const NamespaceStringOrUUID& nsOrUuid,
-                              BSONObj projection);
+                              BSONObj projection,
+                              const BSONObj& min,
+                              const BSONObj& max);
 
     typedef stdx::unordered_map<std::string, std::shared_ptr<CircularBSONIterator>> CmdToReplyObj;
     typedef stdx::unordered_map<std::string, std::vector<BSONObj>> MockDataMgr;
@@ -58,6 +58,7 @@
 #include "mongo/db/catalog/index_catalog.h"
 #include "mongo/db/client.h"
 #include "mongo/db/dbdirectclient.h"
+#include "mongo/db/exec/and_bitmap.h"
 #include "mongo/db/exec/and_hash.h"
 #include "mongo/db/exec/and_sorted.h"
 #include "mongo/db/exec/document_value/document.h"
@@ -935,6 +936,102 @@ public:
     }
 };
 
+//
+// Bitmap AND tests
+//
+
+// An AND with three children, intersected over bitmaps of RecordIds.
+class QueryStageAndBitmapThreeLeaf : public QueryStageAndBase {
+public:
+    void run() {
+        dbtests::WriteContextForTests ctx(&_opCtx, ns());
+        if (!ctx.getCollection()) {
+            WriteUnitOfWork wuow(&_opCtx);
+            ctx.db()->createCollection(&_opCtx, nss());
+            wuow.commit();
+        }
+
+        for (int i = 0; i < 50; ++i) {
+            insert(BSON("foo" << i << "bar" << i << "baz" << i));
+        }
+
+        addIndex(BSON("foo" << 1));
+        addIndex(BSON("bar" << 1));
+        addIndex(BSON("baz" << 1));
+        CollectionPtr coll = ctx.getCollection();
+
+        WorkingSet ws;
+        auto ab = std::make_unique<AndBitmapStage>(_expCtx.get(), &ws);
+
+        // Foo <= 20
+        auto params = makeIndexScanParams(&_opCtx, coll, getIndex(BSON("foo" << 1), coll));
+        params.bounds.startKey = BSON("" << 20);
+        params.direction = -1;
+        ab->addChild(std::make_unique<IndexScan>(_expCtx.get(), &coll, params, &ws, nullptr));
+
+        // Bar >= 10
+        params = makeIndexScanParams(&_opCtx, coll, getIndex(BSON("bar" << 1), coll));
+        params.bounds.startKey = BSON("" << 10);
+        ab->addChild(std::make_unique<IndexScan>(_expCtx.get(), &coll, params, &ws, nullptr));
+
+        // 5 <= baz <= 15
+        params = makeIndexScanParams(&_opCtx, coll, getIndex(BSON("baz" << 1), coll));
+        params.bounds.startKey = BSON("" << 5);
+        params.bounds.endKey = BSON("" << 15);
+        ab->addChild(std::make_unique<IndexScan>(_expCtx.get(), &coll, params, &ws, nullptr));
+
+        // foo == bar == baz, and foo<=20, bar>=10, 5<=baz<=15, so our values are:
+        // foo == 10, 11, 12, 13, 14, 15.
+        ASSERT_EQUALS(6, countResults(ab.get()));
+        ASSERT_EQUALS(STAGE_AND_BITMAP, ab->getStats()->stageType);
+
+        auto stats = static_cast<const AndHashStats*>(ab->getSpecificStats());
+        ASSERT_EQUALS(2U, stats->mapAfterChild.size());
+        ASSERT_EQUALS(21U, stats->mapAfterChild[0]);
+        ASSERT_EQUALS(11U, stats->mapAfterChild[1]);
+    }
+};
+
+// The bitmap AND outputs each RecordId of its last child at most once, and enforces its memory
+// limit.
+class QueryStageAndBitmapDedupAndMemoryLimit : public QueryStageAndBase {
+public:
+    void run() {
+        const BSONObj dataObj = fromjson("{'foo': 'bar'}");
+
+        auto makeChild = [&](WorkingSet* ws, const std::vector<int64_t>& recordIds) {
+            auto child = std::make_unique<MockStage>(_expCtx.get(), ws);
+            for (auto recordId : recordIds) {
+                WorkingSetID id = ws->allocate();
+                WorkingSetMember* wsm = ws->get(id);
+                wsm->recordId = RecordId(recordId);
+                wsm->doc = {SnapshotId(), Document{dataObj}};
+                ws->transitionToRecordIdAndObj(id);
+                child->enqueueAdvanced(id);
+            }
+            return child;
+        };
+
+        {
+            WorkingSet ws;
+            auto ab = std::make_unique<AndBitmapStage>(_expCtx.get(), &ws);
+            ab->addChild(makeChild(&ws, {1, 2, 3, int64_t{1} << 40}));
+            ab->addChild(makeChild(&ws, {3, 2, 2, 4, int64_t{1} << 40}));
+            ASSERT_EQUALS(3, countResults(ab.get()));
+        }
+
+        {
+            WorkingSet ws;
+            auto ab = std::make_unique<AndBitmapStage>(_expCtx.get(), &ws, 0U);
+            ab->addChild(makeChild(&ws, {1, 2, 3}));
+            ab->addChild(makeChild(&ws, {1, 2, 3}));
+            ASSERT_THROWS_CODE(countResults(ab.get()),
+                               DBException,
+                               ErrorCodes::QueryExceededMemoryLimitNoDiskUseAllowed);
+        }
+    }
+};
+
 //
 // Sorted AND tests
 //
@@ -1366,6 +1463,8 @@ public:
         add<QueryStageAndHashFirstChildFetched>();
         add<QueryStageAndHashSecondChildFetched>();
         add<QueryStageAndHashDeadChild>();
+        add<QueryStageAndBitmapThreeLeaf>();
+        add<QueryStageAndBitmapDedupAndMemoryLimit>();
         add<QueryStageAndSortedDeleteDuringYield>();
         add<QueryStageAndSortedThreeLeaf>();
         add<QueryStageAndSortedWithNothing>();
@@ -45,6 +45,7 @@
 #include "mongo/db/dbdirectclient.h"
 #include "mongo/db/exec/count_scan.h"
 #include "mongo/db/exec/plan_stage.h"
+#include "mongo/db/exec/plan_stats.h"
 #include "mongo/db/exec/working_set.h"
 #include "mongo/db/index/index_descriptor.h"
 #include "mongo/db/namespace_string.h"
@@ -627,6 +628,48 @@ public:
     }
 };
 
+//
+// Check that a count scan walks multiple disjoint intervals, including empty ones
+//
+class QueryStageCountScanMultipleIntervals : public CountBase {
+public:
+    void run() {
+        dbtests::WriteContextForTests ctx(&_opCtx, ns().ns_forTest());
+
+        // Insert some docs
+        for (int i = 0; i < 10; ++i) {
+            insert(BSON("a" << i));
+        }
+
+        // Add an index
+        addIndex(BSON("a" << 1));
+
+        const CollectionPtr coll = ctx.getCollection();
+
+        // Count a in {1, [3, 5), (7, 9], 20}
+        auto params = makeCountScanParams(&_opCtx, coll, getIndex(ctx.db(), BSON("a" << 1)));
+        params.startKey = BSON("" << 1);
+        params.startKeyInclusive = true;
+        params.endKey = BSON("" << 1);
+        params.endKeyInclusive = true;
+        params.additionalIntervals.push_back({BSON("" << 3), true, BSON("" << 5), false});
+        params.additionalIntervals.push_back({BSON("" << 7), false, BSON("" << 9), true});
+        params.additionalIntervals.push_back({BSON("" << 20), true, BSON("" << 20), true});
+
+        WorkingSet ws;
+        CountScan count(_expCtx.get(), &coll, params, &ws);
+
+        int numCounted = runCount(&count);
+        ASSERT_EQUALS(5, numCounted);
+
+        auto stats = count.getStats();
+        auto countStats = static_cast<const CountScanStats*>(stats->specific.get());
+        ASSERT_EQUALS(4U, countStats->numIntervals);
+        ASSERT_BSONOBJ_EQ(BSON("a" << 1), countStats->startKey);
+        ASSERT_BSONOBJ_EQ(BSON("a" << 20), countStats->endKey);
+    }
+};
+
 class All : public unittest::OldStyleSuiteSpecification {
 public:
     All() : OldStyleSuiteSpecification("query_stage_count_scan") {}
@@ -642,6 +685,7 @@ public:
         add<QueryStageCountScanDeleteDuringYield>();
         add<QueryStageCountScanInsertNewDocsDuringYield>();
         add<QueryStageCountScanUnusedKeys>();
+        add<QueryStageCountScanMultipleIntervals>();
     }
 };
 
@@ -47,6 +47,7 @@
 #include "mongo/db/dbdirectclient.h"
 #include "mongo/db/exec/distinct_scan.h"
 #include "mongo/db/exec/plan_stage.h"
+#include "mongo/db/exec/plan_stats.h"
 #include "mongo/db/exec/working_set.h"
 #include "mongo/db/index/index_descriptor.h"
 #include "mongo/db/namespace_string.h"
@@ -325,6 +326,64 @@ public:
     }
 };
 
+// Tests that a deduplicating distinct scan over a multikey index returns each document at most
+// once, while the documents it returns still hold every distinct value.
+class QueryStageDistinctMultiKeyDedup : public DistinctBase {
+public:
+    void run() {
+        insert(BSON("a" << BSON_ARRAY(1 << 2)));
+        insert(BSON("a" << BSON_ARRAY(2 << 3)));
+        insert(BSON("a" << BSON_ARRAY(3)));
+
+        addIndex(BSON("a" << 1));
+
+        AutoGetCollectionForReadCommand ctx(&_opCtx, nss);
+        const CollectionPtr& coll = ctx.getCollection();
+
+        std::vector<const IndexDescriptor*> indexes;
+        coll->getIndexCatalog()->findIndexesByKeyPattern(
+            &_opCtx, BSON("a" << 1), IndexCatalog::InclusionPolicy::kReady, &indexes);
+        ASSERT_EQ(indexes.size(), 1U);
+
+        DistinctParams params{&_opCtx, coll, indexes[0]};
+        ASSERT_TRUE(params.isMultiKey);
+        params.shouldDedup = true;
+        params.scanDirection = 1;
+        params.fieldNo = 0;
+        params.bounds.isSimpleRange = false;
+        OrderedIntervalList oil("a");
+        oil.intervals.push_back(IndexBoundsBuilder::allValues());
+        params.bounds.fields.push_back(oil);
+
+        WorkingSet ws;
+        DistinctScan distinct(_expCtx.get(), &coll, std::move(params), &ws);
+
+        // The first document is returned for 1 and dropped for 2, after which the scan skips to 3,
+        // which the second document is returned for.
+        std::set<RecordId> returned;
+        std::set<int> values;
+        WorkingSetID wsid;
+        PlanStage::StageState state;
+        while (PlanStage::IS_EOF != (state = distinct.work(&wsid))) {
+            if (PlanStage::ADVANCED == state) {
+                auto recordId = ws.get(wsid)->recordId;
+                ASSERT_TRUE(returned.insert(recordId).second);
+                for (auto&& elem : coll->docFor(&_opCtx, recordId).value()["a"].Array()) {
+                    values.insert(elem.numberInt());
+                }
+            }
+        }
+
+        ASSERT_EQUALS(2U, returned.size());
+        ASSERT_EQUALS((std::set<int>{1, 2, 3}), values);
+
+        auto stats = static_cast<const DistinctScanStats*>(distinct.getSpecificStats());
+        ASSERT_TRUE(stats->shouldDedup);
+        ASSERT_EQUALS(3U, stats->dupsTested);
+        ASSERT_EQUALS(1U, stats->dupsDropped);
+    }
+};
+
 // XXX: add a test case with bounds where skipping to the next key gets us a result that's not
 // valid w.r.t. our query.
 
@@ -335,6 +394,7 @@ public:
     void setupTests() override {
         add<QueryStageDistinctBasic>();
         add<QueryStageDistinctMultiKey>();
+        add<QueryStageDistinctMultiKeyDedup>();
         add<QueryStageDistinctCompoundIndex>();
     }
 };
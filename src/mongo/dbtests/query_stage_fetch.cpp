@@ -70,6 +70,7 @@
 #include "mongo/db/storage/snapshot.h"
 #include "mongo/db/storage/write_unit_of_work.h"
 #include "mongo/dbtests/dbtests.h"  // IWYU pragma: keep
+#include "mongo/idl/server_parameter_test_util.h"
 #include "mongo/unittest/assert.h"
 #include "mongo/unittest/framework.h"
 #include "mongo/util/assert_util.h"
@@ -250,6 +251,63 @@ public:
     }
 };
 
+//
+// Test that batched fetching returns results in the child's order and skips deleted records.
+//
+class FetchStageSortedBatches : public QueryStageFetchBase {
+public:
+    void run() {
+        RAIIServerParameterControllerForTest batchSize(
+            "internalQueryFetchStageSortedPrefetchBatchSize", 3);
+
+        dbtests::WriteContextForTests ctx(&_opCtx, ns());
+        Database* db = ctx.db();
+        CollectionPtr coll(
+            CollectionCatalog::get(&_opCtx)->lookupCollectionByNamespace(&_opCtx, nss()));
+        if (!coll) {
+            WriteUnitOfWork wuow(&_opCtx);
+            coll = CollectionPtr(db->createCollection(&_opCtx, nss()));
+            wuow.commit();
+        }
+
+        WorkingSet ws;
+
+        for (int i = 0; i < 5; ++i) {
+            insert(BSON("foo" << i));
+        }
+        std::set<RecordId> recordIds;
+        getRecordIds(&recordIds, coll);
+        ASSERT_EQUALS(size_t(5), recordIds.size());
+
+        // Queue the RecordIds in descending order, which is the opposite of the fetch order.
+        auto mockStage = std::make_unique<QueuedDataStage>(_expCtx.get(), &ws);
+        for (auto it = recordIds.rbegin(); it != recordIds.rend(); ++it) {
+            WorkingSetID id = ws.allocate();
+            WorkingSetMember* mockMember = ws.get(id);
+            mockMember->recordId = *it;
+            ws.transitionToRecordIdAndIdx(id);
+            mockStage->pushBack(id);
+        }
+
+        // Delete {foo: 3}, which belongs to the first batch.
+        remove(BSON("foo" << 3));
+
+        auto fetchStage =
+            std::make_unique<FetchStage>(_expCtx.get(), &ws, std::move(mockStage), nullptr, &coll);
+
+        std::vector<int> results;
+        WorkingSetID id = WorkingSet::INVALID_ID;
+        PlanStage::StageState state;
+        while ((state = fetchStage->work(&id)) != PlanStage::IS_EOF) {
+            if (state == PlanStage::ADVANCED) {
+                results.push_back(ws.get(id)->doc.value()["foo"].getInt());
+            }
+        }
+
+        ASSERT_EQUALS(std::vector<int>({4, 2, 1, 0}), results);
+    }
+};
+
 class All : public unittest::OldStyleSuiteSpecification {
 public:
     All() : OldStyleSuiteSpecification("query_stage_fetch") {}
@@ -257,6 +315,7 @@ public:
     void setupTests() override {
         add<FetchStageAlreadyFetched>();
         add<FetchStageFilter>();
+        add<FetchStageSortedBatches>();
     }
 };
 
@@ -53,6 +53,7 @@
 #include "mongo/db/curop.h"
 #include "mongo/db/db_raii.h"
 #include "mongo/db/dbdirectclient.h"
+#include "mongo/db/exec/batched_update_stage.h"
 #include "mongo/db/exec/collection_scan.h"
 #include "mongo/db/exec/collection_scan_common.h"
 #include "mongo/db/exec/document_value/document.h"
@@ -72,6 +73,7 @@
 #include "mongo/db/query/canonical_query.h"
 #include "mongo/db/query/find_command.h"
 #include "mongo/db/query/plan_executor.h"
+#include "mongo/db/query/query_knobs_gen.h"
 #include "mongo/db/record_id.h"
 #include "mongo/db/service_context.h"
 #include "mongo/db/shard_role.h"
@@ -111,6 +113,14 @@ public:
         _client.remove(nss, obj);
     }
 
+    void update(const BSONObj& filter, const BSONObj& updateSpec) {
+        _client.update(nss, filter, updateSpec);
+    }
+
+    BSONObj findOne(const BSONObj& filter) {
+        return _client.findOne(nss, filter);
+    }
+
     size_t count(const BSONObj& query) {
         return _client.count(nss, query, 0, 0, 0);
     }
@@ -587,6 +597,191 @@ public:
     }
 };
 
+/**
+ * Test that updates to large documents that can't be applied in place, and so are written to
+ * storage as damages computed from their delta, produce the same documents as whole-document
+ * writes.
+ */
+class QueryStageUpdateLargeDocumentFromDelta : public QueryStageUpdateBase {
+public:
+    void run() {
+        const std::string padding(internalUpdateDamagesMinDocumentSizeBytes.load(), 'x');
+        insert(BSON("_id" << 0 << "a" << 1 << "padding" << padding << "b" << BSON("c" << 1)));
+
+        // Grows the document, removes a field and changes a nested one.
+        update(BSON("_id" << 0),
+               fromjson("{$set: {a: 'a string', 'b.d': [1, 2]}, $inc: {'b.c': 1}, "
+                        "$unset: {missing: 1}}"));
+        ASSERT_BSONOBJ_EQ(BSON("_id" << 0 << "a"
+                                     << "a string"
+                                     << "padding" << padding << "b"
+                                     << BSON("c" << 2 << "d" << BSON_ARRAY(1 << 2))),
+                          findOne(BSON("_id" << 0)));
+
+        update(BSON("_id" << 0), fromjson("{$unset: {a: 1}, $set: {z: 1}}"));
+        ASSERT_BSONOBJ_EQ(BSON("_id" << 0 << "padding" << padding << "b"
+                                     << BSON("c" << 2 << "d" << BSON_ARRAY(1 << 2)) << "z" << 1),
+                          findOne(BSON("_id" << 0)));
+        ASSERT_EQUALS(1U, count(BSON("z" << 1)));
+    }
+};
+
+/**
+ * Base class for tests of a BATCHED_UPDATE stage running the multi-update {$inc: {bar: 1}} over a
+ * collection scan of the documents matching {foo: {$lt: 10}}.
+ */
+class QueryStageBatchedUpdateBase : public QueryStageUpdateBase {
+public:
+    static constexpr long long kTargetBatchDocs = 4;
+
+    QueryStageBatchedUpdateBase() : _driver(_expCtx) {
+        _request.setNamespaceString(nss);
+        _request.setMulti();
+        _request.setQuery(_query);
+        _request.setUpdateModification(
+            write_ops::UpdateModification::parseFromClassicUpdate(fromjson("{$inc: {bar: 1}}")));
+
+        const std::map<StringData, std::unique_ptr<ExpressionWithPlaceholder>> arrayFilters;
+        ASSERT_DOES_NOT_THROW(_driver.parse(
+            _request.getUpdateModification(), arrayFilters, boost::none, _request.isMulti()));
+        _cq = canonicalize(_query);
+    }
+
+    std::unique_ptr<BatchedUpdateStage> makeBatchedUpdateStage(CollectionAcquisition collection,
+                                                               WorkingSet* ws) {
+        UpdateStageParams updateParams(&_request, &_driver, &CurOp::get(_opCtx)->debug());
+        updateParams.canonicalQuery = _cq.get();
+
+        CollectionScanParams collScanParams;
+        collScanParams.direction = CollectionScanParams::FORWARD;
+        collScanParams.tailable = false;
+        auto cs = std::make_unique<CollectionScan>(
+            _expCtx.get(), collection, collScanParams, ws, _cq->getPrimaryMatchExpression());
+
+        // Only commit a batch based on its number of documents.
+        auto batchedUpdateParams = std::make_unique<BatchedUpdateStageParams>();
+        batchedUpdateParams->targetBatchDocs = kTargetBatchDocs;
+        batchedUpdateParams->targetBatchTimeMS = Milliseconds(0);
+        batchedUpdateParams->targetStagedDocBytes = 0;
+
+        return std::make_unique<BatchedUpdateStage>(_expCtx.get(),
+                                                    updateParams,
+                                                    std::move(batchedUpdateParams),
+                                                    ws,
+                                                    collection,
+                                                    cs.release());
+    }
+
+protected:
+    const BSONObj _query = fromjson("{foo: {$lt: 10}}");
+    UpdateRequest _request;
+    UpdateDriver _driver;
+    std::unique_ptr<CanonicalQuery> _cq;
+};
+
+/**
+ * Test that a batched update commits its updates a batch at a time, and updates every matching
+ * document once.
+ */
+class QueryStageBatchedUpdateCommitsInBatches : public QueryStageBatchedUpdateBase {
+public:
+    void run() {
+        for (int i = 0; i < 12; ++i) {
+            insert(BSON("_id" << i << "foo" << i));
+        }
+
+        {
+            const auto collection =
+                acquireCollection(&_opCtx,
+                                  CollectionAcquisitionRequest::fromOpCtx(
+                                      &_opCtx, nss, AcquisitionPrerequisites::kWrite),
+                                  MODE_IX);
+            ASSERT(collection.exists());
+
+            auto ws = std::make_unique<WorkingSet>();
+            auto updateStage = makeBatchedUpdateStage(collection, ws.get());
+            const UpdateStats* stats =
+                static_cast<const UpdateStats*>(updateStage->getSpecificStats());
+
+            // Nothing is written until a full batch has been staged.
+            while (stats->nModified == 0) {
+                WorkingSetID id = WorkingSet::INVALID_ID;
+                ASSERT_EQUALS(PlanStage::NEED_TIME, updateStage->work(&id));
+            }
+            ASSERT_EQUALS(static_cast<size_t>(kTargetBatchDocs), stats->nModified);
+            ASSERT_EQUALS(static_cast<size_t>(kTargetBatchDocs), stats->nMatched);
+
+            // Do the remaining updates. The last batch is committed at EOF.
+            while (!updateStage->isEOF()) {
+                WorkingSetID id = WorkingSet::INVALID_ID;
+                PlanStage::StageState state = updateStage->work(&id);
+                ASSERT(PlanStage::NEED_TIME == state || PlanStage::IS_EOF == state);
+            }
+            ASSERT_EQUALS(10U, stats->nModified);
+            ASSERT_EQUALS(10U, stats->nMatched);
+        }
+
+        ASSERT_EQUALS(10U, count(BSON("bar" << 1)));
+        ASSERT_EQUALS(2U, count(BSON("bar" << BSON("$exists" << false))));
+    }
+};
+
+/**
+ * Test that a batched update skips a staged document which is deleted before its batch commits.
+ */
+class QueryStageBatchedUpdateSkipDeletedDoc : public QueryStageBatchedUpdateBase {
+public:
+    void run() {
+        for (int i = 0; i < 10; ++i) {
+            insert(BSON("_id" << i << "foo" << i));
+        }
+
+        {
+            const auto collection =
+                acquireCollection(&_opCtx,
+                                  CollectionAcquisitionRequest::fromOpCtx(
+                                      &_opCtx, nss, AcquisitionPrerequisites::kWrite),
+                                  MODE_IX);
+            ASSERT(collection.exists());
+
+            std::vector<RecordId> recordIds;
+            getRecordIds(collection.getCollectionPtr(), CollectionScanParams::FORWARD, &recordIds);
+
+            auto ws = std::make_unique<WorkingSet>();
+            auto updateStage = makeBatchedUpdateStage(collection, ws.get());
+            const UpdateStats* stats =
+                static_cast<const UpdateStats*>(updateStage->getSpecificStats());
+
+            // Stage the first two documents without committing them.
+            for (int i = 0; i < 2; ++i) {
+                WorkingSetID id = WorkingSet::INVALID_ID;
+                ASSERT_EQUALS(PlanStage::NEED_TIME, updateStage->work(&id));
+            }
+            ASSERT_EQUALS(0U, stats->nModified);
+
+            // Remove the second, already staged, document.
+            static_cast<PlanStage*>(updateStage.get())->saveState();
+            BSONObj targetDoc =
+                collection.getCollectionPtr()->docFor(&_opCtx, recordIds[1]).value();
+            ASSERT(!targetDoc.isEmpty());
+            remove(targetDoc);
+            static_cast<PlanStage*>(updateStage.get())
+                ->restoreState(&collection.getCollectionPtr());
+
+            while (!updateStage->isEOF()) {
+                WorkingSetID id = WorkingSet::INVALID_ID;
+                PlanStage::StageState state = updateStage->work(&id);
+                ASSERT(PlanStage::NEED_TIME == state || PlanStage::IS_EOF == state);
+            }
+            ASSERT_EQUALS(9U, stats->nModified);
+            ASSERT_EQUALS(9U, stats->nMatched);
+        }
+
+        ASSERT_EQUALS(9U, count(BSON("bar" << 1)));
+        ASSERT_EQUALS(9U, count(BSONObj()));
+    }
+};
+
 class All : public unittest::OldStyleSuiteSpecification {
 public:
     All() : OldStyleSuiteSpecification("query_stage_update") {}
@@ -597,6 +792,9 @@ public:
         add<QueryStageUpdateSkipDeletedDoc>();
         add<QueryStageUpdateReturnOldDoc>();
         add<QueryStageUpdateReturnNewDoc>();
+        add<QueryStageUpdateLargeDocumentFromDelta>();
+        add<QueryStageBatchedUpdateCommitsInBatches>();
+        add<QueryStageBatchedUpdateSkipDeletedDoc>();
     }
 };
 
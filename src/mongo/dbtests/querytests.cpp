@@ -89,6 +89,7 @@
 #include "mongo/db/storage/write_unit_of_work.h"
 #include "mongo/db/tenant_id.h"
 #include "mongo/dbtests/dbtests.h"  // IWYU pragma: keep
+#include "mongo/idl/server_parameter_test_util.h"
 #include "mongo/rpc/get_status_from_command_result.h"
 #include "mongo/rpc/op_msg.h"
 #include "mongo/rpc/reply_interface.h"
@@ -864,6 +865,58 @@ private:
         "local.oplog.querytests.OplogScanGtTsExplain");
 };
 
+class DistinctExplainReportsDupsWhenDeduping : public ClientBase {
+public:
+    ~DistinctExplainReportsDupsWhenDeduping() {
+        _client.dropCollection(_nss);
+    }
+
+    void run() {
+        // The DISTINCT_SCAN stage explained here is the one of the classic engine.
+        RAIIServerParameterControllerForTest controller("internalQueryFrameworkControl",
+                                                        "forceClassicEngine");
+        ASSERT_OK(dbtests::createIndex(&_opCtx, _nss.ns_forTest(), BSON("a" << 1)));
+
+        insert(_nss, BSON("a" << 2));
+        insert(_nss, BSON("a" << 3));
+        auto distinctScan = explainDistinctScan();
+        ASSERT_FALSE(distinctScan.hasField("dupsTested")) << distinctScan;
+        ASSERT_FALSE(distinctScan.hasField("dupsDropped")) << distinctScan;
+
+        // Make the index multikey. The scan then returns the document holding [1, 4] for 1, and
+        // drops it when it is keyed again under 4.
+        insert(_nss, BSON("a" << BSON_ARRAY(1 << 4)));
+        distinctScan = explainDistinctScan();
+        ASSERT_EQUALS(4, distinctScan.getIntField("dupsTested")) << distinctScan;
+        ASSERT_EQUALS(1, distinctScan.getIntField("dupsDropped")) << distinctScan;
+    }
+
+private:
+    BSONObj explainDistinctScan() {
+        BSONObj explainCmdObj = BSON(
+            "explain" << BSON("distinct" << _nss.coll() << "key"
+                                         << "a"
+                                         << "query" << BSON("a" << GT << 0))
+                      << "verbosity"
+                      << "executionStats");
+
+        auto reply = _client.runCommand(OpMsgRequestBuilder::create(
+            auth::ValidatedTenancyScope::kNotRequired, _nss.dbName(), explainCmdObj));
+        BSONObj explainCmdReplyBody = reply->getCommandReply();
+        ASSERT_OK(getStatusFromCommandResult(explainCmdReplyBody));
+
+        BSONObj stage = explainCmdReplyBody["executionStats"]["executionStages"].Obj();
+        while (stage["stage"].str() != "DISTINCT_SCAN") {
+            ASSERT(stage.hasField("inputStage")) << explainCmdReplyBody;
+            stage = stage["inputStage"].Obj();
+        }
+        return stage.getOwned();
+    }
+
+    const NamespaceString _nss = NamespaceString::createNamespaceString_forTest(
+        "unittests.querytests.DistinctExplainReportsDupsWhenDeduping");
+};
+
 class BasicCount : public ClientBase {
 public:
     ~BasicCount() {
@@ -2053,6 +2106,7 @@ public:
         add<TailableQueryOnId>();
         add<OplogScanWithGtTimstampPred>();
         add<OplogScanGtTsExplain>();
+        add<DistinctExplainReportsDupsWhenDeduping>();
         add<ArrayId>();
         add<UnderscoreNs>();
         add<EmptyFieldSpec>();
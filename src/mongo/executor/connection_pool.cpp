@@ -49,6 +49,7 @@
 #include "mongo/bson/bsonobj.h"
 #include "mongo/db/service_context.h"
 #include "mongo/executor/connection_pool_stats.h"
+#include "mongo/executor/host_latency_tracker.h"
 #include "mongo/logv2/log.h"
 #include "mongo/logv2/log_attr.h"
 #include "mongo/logv2/log_component.h"
@@ -109,6 +110,14 @@ bool shouldInvariantOnPoolCorrectness() noexcept {
     return kDebugBuild;
 }
 
+/**
+ * Folds a new sample into an exponentially weighted moving average with a weight of 1/8, the same
+ * smoothing TCP uses for its round trip estimate.
+ */
+Microseconds updateMovingAverage(Microseconds average, Microseconds sample) {
+    return average + (sample - average) / 8;
+}
+
 }  // namespace
 
 namespace executor {
@@ -164,8 +173,15 @@ std::string ConnectionPool::ConnectionControls::toString() const {
 }
 
 std::string ConnectionPool::HostState::toString() const {
-    return "{{ requests: {}, ready: {}, pending: {}, active: {}, leased: {}, isExpired: {} }}"_format(
-        requests, ready, pending, active, leased, health.isExpired);
+    return "{{ requests: {}, ready: {}, pending: {}, active: {}, leased: {}, isExpired: {}, "
+           "waitTime: {}, usageTime: {} }}"_format(requests,
+                                                   ready,
+                                                   pending,
+                                                   active,
+                                                   leased,
+                                                   health.isExpired,
+                                                   connectionWaitTime.toString(),
+                                                   connectionUsageTime.toString());
 }
 
 /**
@@ -381,7 +397,27 @@ public:
      * reported in the connection pool stats.
      */
     void recordConnectionWaitTime(Date_t requestedAt) {
-        _connAcquisitionWaitTimeStats.increment(_parent->_factory->now() - requestedAt);
+        auto waitTime = _parent->_factory->now() - requestedAt;
+        _connAcquisitionWaitTimeStats.increment(waitTime);
+        _recentConnWaitTime = updateMovingAverage(_recentConnWaitTime, waitTime);
+    }
+
+    /**
+     * Returns the moving averages of recent connection wait and usage times.
+     */
+    Milliseconds recentConnectionWaitTime() const {
+        return duration_cast<Milliseconds>(_recentConnWaitTime);
+    }
+
+    Milliseconds recentConnectionUsageTime() const {
+        return duration_cast<Milliseconds>(_recentConnUsageTime);
+    }
+
+    /**
+     * Returns the targetConnections last handed to this pool by the controller.
+     */
+    size_t lastTargetConnections() const {
+        return _lastTargetConnections;
     }
 
     /**
@@ -536,6 +572,13 @@ private:
 
     ConnectionWaitTimeHistogram _connAcquisitionWaitTimeStats{};
 
+    // Moving averages fed to the controller through HostState. They are kept in microseconds so
+    // that short samples still move the average.
+    Microseconds _recentConnWaitTime{0};
+    Microseconds _recentConnUsageTime{0};
+
+    size_t _lastTargetConnections = 0;
+
     // Indicates connections associated with this HostAndPort should be kept open.
     bool _keepOpen = true;
 
@@ -740,6 +783,9 @@ void ConnectionPool::appendConnectionStats(ConnectionPoolStats* stats) const {
                                      pool->getTotalConnUsageTime()};
 
         hostStats.acquisitionWaitTimes = pool->connectionWaitTimeStats();
+        hostStats.targetConnections = pool->lastTargetConnections();
+        hostStats.recentConnWaitTime = pool->recentConnectionWaitTime();
+        hostStats.recentConnUsageTime = pool->recentConnectionUsageTime();
         stats->updateStatsForHost(_name, host, hostStats);
     }
 }
@@ -888,7 +934,10 @@ auto ConnectionPool::SpecificPool::makeHandle(ConnectionInterface* connection, b
 
         // Leased connections don't count towards the pool's total connection usage time.
         if (!isLeased) {
-            _totalConnUsageTime += _parent->_getFastClockSource()->now() - connUseStartedAt;
+            auto usageTime = _parent->_getFastClockSource()->now() - connUseStartedAt;
+            _totalConnUsageTime += usageTime;
+            _recentConnUsageTime = updateMovingAverage(_recentConnUsageTime, usageTime);
+            HostLatencyTracker::get().record(_hostAndPort, usageTime);
         }
 
         returnConnection(connection, isLeased);
@@ -1223,6 +1272,7 @@ void ConnectionPool::SpecificPool::spawnConnections() {
     }
 
     auto controls = _parent->_controller->getControls(_id);
+    _lastTargetConnections = controls.targetConnections;
     LOGV2_DEBUG(22575,
                 kDiagnosticLogLevel,
                 "Comparing connection state to controls",
@@ -1390,6 +1440,8 @@ void ConnectionPool::SpecificPool::updateController() {
         availableConnections(),
         inUseConnections(),
         leasedConnections(),
+        recentConnectionWaitTime(),
+        recentConnectionUsageTime(),
     };
     LOGV2_DEBUG(22578,
                 kDiagnosticLogLevel,
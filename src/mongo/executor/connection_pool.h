@@ -230,6 +230,11 @@ public:
         size_t active = 0;
         size_t leased = 0;
 
+        // Moving averages of how long recent requests waited for a connection and how long recent
+        // connections stayed checked out. The latter approximates the round trip of an operation.
+        Milliseconds connectionWaitTime{0};
+        Milliseconds connectionUsageTime{0};
+
         std::string toString() const;
     };
 
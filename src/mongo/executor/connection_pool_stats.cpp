@@ -80,6 +80,9 @@ ConnectionStatsPer& ConnectionStatsPer::operator+=(const ConnectionStatsPer& oth
     wasUsedOnce += other.wasUsedOnce;
     connUsageTime += other.connUsageTime;
     acquisitionWaitTimes += other.acquisitionWaitTimes;
+    targetConnections += other.targetConnections;
+    recentConnWaitTime = std::max(recentConnWaitTime, other.recentConnWaitTime);
+    recentConnUsageTime = std::max(recentConnUsageTime, other.recentConnUsageTime);
 
     return *this;
 }
@@ -151,6 +154,10 @@ void ConnectionPoolStats::appendToBSON(mongo::BSONObjBuilder& result, bool forFT
         if (strategy) {
             result.append("replicaSetMatchingStrategy", matchingStrategyToString(*strategy));
         }
+        if (targetQueueTime) {
+            result.appendNumber("targetQueueTimeMillis",
+                                durationCount<Milliseconds>(*targetQueueTime));
+        }
 
         BSONObjBuilder poolBuilder(result.subobjStart("pools"));
         for (const auto& [pool, stats] : statsByPool) {
@@ -173,6 +180,12 @@ void ConnectionPoolStats::appendToBSON(mongo::BSONObjBuilder& result, bool forFT
                 hostInfo.appendNumber("refreshing", static_cast<long long>(stats.refreshing));
                 hostInfo.appendNumber("refreshed", static_cast<long long>(stats.refreshed));
                 hostInfo.appendNumber("wasNeverUsed", static_cast<long long>(stats.wasNeverUsed));
+                hostInfo.appendNumber("targetConnections",
+                                      static_cast<long long>(stats.targetConnections));
+                hostInfo.appendNumber("recentConnWaitTimeMillis",
+                                      durationCount<Milliseconds>(stats.recentConnWaitTime));
+                hostInfo.appendNumber("recentConnUsageTimeMillis",
+                                      durationCount<Milliseconds>(stats.recentConnUsageTime));
                 appendHistogram(hostInfo, stats.acquisitionWaitTimes, kAcquisitionWaitTimesKey);
             }
         }
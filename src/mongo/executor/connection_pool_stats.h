@@ -86,6 +86,12 @@ struct ConnectionStatsPer {
     size_t wasUsedOnce = 0u;
     Milliseconds connUsageTime{0};
     ConnectionWaitTimeHistogram acquisitionWaitTimes{};
+
+    // The sizing decision last made by the pool's controller and the moving averages it was based
+    // on. Targets add up when aggregated, while the averages keep the worst value seen.
+    size_t targetConnections = 0u;
+    Milliseconds recentConnWaitTime{0};
+    Milliseconds recentConnUsageTime{0};
 };
 
 /**
@@ -109,6 +115,7 @@ struct ConnectionPoolStats {
     size_t totalWasUsedOnce = 0u;
     Milliseconds totalConnUsageTime{0};
     boost::optional<ShardingTaskExecutorPoolController::MatchingStrategy> strategy;
+    boost::optional<Milliseconds> targetQueueTime;
 
     ConnectionWaitTimeHistogram acquisitionWaitTimes{};
 
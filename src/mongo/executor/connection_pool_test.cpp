@@ -1974,6 +1974,30 @@ TEST_F(ConnectionPoolTest, TotalConnUseTimeIncreasedForCheckedOutConnection) {
     ASSERT_GREATER_THAN_OR_EQUALS(totalTimeUsageDelta, checkOutLength);
 }
 
+TEST_F(ConnectionPoolTest, RecentConnUsageTimeTracksCheckoutsAsMovingAverage) {
+    constexpr Milliseconds checkOutLength = Milliseconds(80);
+    auto pool = makePool();
+
+    auto startTimePoint = Date_t::now();
+    PoolImpl::setNow(startTimePoint);
+
+    ConnectionImpl::pushSetup(Status::OK());
+    pool->get_forTest(HostAndPort(),
+                      Milliseconds(5000),
+                      [&](StatusWith<ConnectionPool::ConnectionHandle> swConn) {
+                          PoolImpl::setNow(startTimePoint + checkOutLength);
+                          doneWith(swConn.getValue());
+                      });
+
+    ConnectionPoolStats stats;
+    pool->appendConnectionStats(&stats);
+
+    // A single sample moves the average an eighth of the way from zero.
+    const auto& hostStats = stats.statsByHost[HostAndPort()];
+    ASSERT_EQ(hostStats.recentConnUsageTime, checkOutLength / 8);
+    ASSERT_GREATER_THAN_OR_EQUALS(hostStats.targetConnections, 1u);
+}
+
 TEST_F(ConnectionPoolTest, OverlappingCheckoutsAdditivelyContributeToTotalUsageTime) {
     constexpr Milliseconds checkOutLength = Milliseconds(10);
     auto pool = makePool();
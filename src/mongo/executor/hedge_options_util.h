@@ -50,12 +50,15 @@ extern FailPoint hedgedReadsSendRequestsToTargetHostsInAlphabeticalOrder;
  *      (2) How many hedged operations should be sent, in *addition* to the non-hedged/authoriative
  *          request (`hedgeCount`)
  *      (3) The maxTimeMS each hedge should be executed with (`maxTimeMSForHedgedReads`)
+ *      (4) The latency percentile of the authoritative target after which hedges are sent, or 0
+ *          to send them immediately (`hedgeDelayPercentile`)
  *      clang-format on
  */
 struct HedgeOptions {
     bool isHedgeEnabled = false;
     size_t hedgeCount = 0;
     int maxTimeMSForHedgedReads = 0;
+    int hedgeDelayPercentile = 0;
 };
 
 /**
@@ -57,6 +57,7 @@
 #include "mongo/executor/async_rpc_util.h"
 #include "mongo/executor/hedge_options_util.h"
 #include "mongo/executor/hedging_metrics.h"
+#include "mongo/executor/host_latency_tracker.h"
 #include "mongo/executor/remote_command_response.h"
 #include "mongo/executor/task_executor.h"
 #include "mongo/idl/generic_args_with_types_gen.h"
@@ -65,6 +66,7 @@
 #include "mongo/logv2/log_component.h"
 #include "mongo/platform/atomic_word.h"
 #include "mongo/platform/compiler.h"
+#include "mongo/platform/mutex.h"
 #include "mongo/rpc/get_status_from_command_result.h"
 #include "mongo/s/mongos_server_parameters_gen.h"
 #include "mongo/util/assert_util.h"
@@ -133,6 +135,47 @@ void killOperations(ServiceContext* svcCtx,
     }
 }
 
+/**
+ * Orders 'targets' by the average latency the connection pools recently observed for them, so
+ * that the authoritative request goes to the host expected to complete first. Hosts without
+ * observations sort first so that they get a chance to be measured.
+ */
+inline void orderByExpectedLatency(std::vector<HostAndPort>& targets) {
+    auto& tracker = executor::HostLatencyTracker::get();
+    std::vector<std::pair<Microseconds, HostAndPort>> byLatency;
+    for (auto& target : targets) {
+        byLatency.emplace_back(tracker.getAverage(target).value_or(Microseconds{0}),
+                               std::move(target));
+    }
+    std::stable_sort(byLatency.begin(), byLatency.end(), [](auto&& a, auto&& b) {
+        return a.first < b.first;
+    });
+    for (size_t i = 0; i < targets.size(); ++i) {
+        targets[i] = std::move(byLatency[i].second);
+    }
+}
+
+/**
+ * Returns how long to wait for the authoritative request to 'target' before sending hedges, or
+ * boost::none if there is not enough latency history for 'target' and hedges should be sent
+ * right away.
+ */
+inline boost::optional<Milliseconds> getHedgeDelay(const HostAndPort& target, int percentile) {
+    auto latency = executor::HostLatencyTracker::get().getPercentile(target, percentile);
+    if (!latency)
+        return boost::none;
+    return duration_cast<Milliseconds>(*latency);
+}
+
+/**
+ * Shared by the delayed hedges of one sendHedgedCommand call and its completion. A delayed hedge
+ * is only sent while the call is outstanding, because the caller's opCtx may be gone after it.
+ */
+struct DelayedHedgeState {
+    Mutex mutex = MONGO_MAKE_LATCH("DelayedHedgeState::mutex");
+    bool done = false;
+};
+
 }  // namespace hedging_rpc_details
 
 /**
@@ -145,6 +188,10 @@ void killOperations(ServiceContext* svcCtx,
  * is false, then the function will not hedge, and instead will just target the first host in the
  * vector provided by resolve.
  *
+ * When the hedgingDelayPercentile server parameter is set, targets are ordered by their recent
+ * average latency and hedges are only sent if the authoritative request is still outstanding
+ * after that percentile of its target's recent latencies.
+ *
  * Accepts an optional UUID to be used as `clientOperationKey` for all remote requests.
  */
 template <typename CommandType>
@@ -166,6 +213,7 @@ SemiFuture<AsyncRPCResponse<typename CommandType::Reply>> sendHedgedCommand(
     // Set up cancellation token to cancel remaining hedged operations.
     CancellationSource hedgeCancellationToken{token};
     auto targetsAttempted = std::make_shared<std::vector<HostAndPort>>();
+    auto delayedHedges = std::make_shared<hedging_rpc_details::DelayedHedgeState>();
     auto proxyExec = std::make_shared<detail::ProxyingExecutor>(exec, baton);
     auto tryBody = [=, targeter = std::move(targeter)]() mutable {
         HedgeOptions opts = getHedgeOptions(CommandType::kCommandName, readPref);
@@ -202,6 +250,15 @@ SemiFuture<AsyncRPCResponse<typename CommandType::Reply>> sendHedgedCommand(
                     std::sort(targets.begin(), targets.end(), [](auto&& a, auto&& b) {
                         return compareByLowerHostThenPort(a, b);
                     });
+                } else if (opts.isHedgeEnabled && opts.hedgeDelayPercentile > 0) {
+                    hedging_rpc_details::orderByExpectedLatency(targets);
+                    *targetsAttempted = targets;
+                }
+
+                boost::optional<Milliseconds> hedgeDelay;
+                if (opts.hedgeCount > 0 && opts.hedgeDelayPercentile > 0 && targets.size() > 1) {
+                    hedgeDelay =
+                        hedging_rpc_details::getHedgeDelay(targets[0], opts.hedgeDelayPercentile);
                 }
 
                 const auto globalMaxTimeMSForHedgedReads = gMaxTimeMSForHedgedReads.load();
@@ -233,11 +290,34 @@ SemiFuture<AsyncRPCResponse<typename CommandType::Reply>> sendHedgedCommand(
                     }
 
                     options->baton = baton;
-                    requests.push_back(
-                        sendCommand(options, opCtx, std::move(t)).thenRunOn(proxyExec));
+                    if (i != 0 && hedgeDelay) {
+                        // Only hedge if the authoritative request turns out to be slower than its
+                        // target usually is.
+                        requests.push_back(
+                            exec->sleepFor(*hedgeDelay, hedgeCancellationToken.token())
+                                .then([=, t = std::move(t)]() mutable {
+                                    stdx::lock_guard lk(delayedHedges->mutex);
+                                    uassert(ErrorCodes::CallbackCanceled,
+                                            "Hedged command completed before the hedge was sent",
+                                            !delayedHedges->done);
+                                    if (i == 1) {
+                                        hm->incrementNumTotalHedgedOperations();
+                                    }
+                                    return sendCommand(options, opCtx, std::move(t));
+                                })
+                                .onError([](Status status) -> StatusWith<SingleResponse> {
+                                    if (status == ErrorCodes::RemoteCommandExecutionError)
+                                        return status;
+                                    return Status{AsyncRPCErrorInfo(status), status.reason()};
+                                })
+                                .thenRunOn(proxyExec));
+                    } else {
+                        requests.push_back(
+                            sendCommand(options, opCtx, std::move(t)).thenRunOn(proxyExec));
+                    }
                 }
 
-                if (opts.hedgeCount > 0) {
+                if (opts.hedgeCount > 0 && !hedgeDelay) {
                     hm->incrementNumTotalHedgedOperations();
                 }
 
@@ -311,8 +391,12 @@ SemiFuture<AsyncRPCResponse<typename CommandType::Reply>> sendHedgedCommand(
         // so that the API always returns RemoteCommandExecutionError. Additionally,
         // we need to make sure we cancel outstanding requests.
         .unsafeToInlineFuture()
-        .onCompletion([hedgeCancellationToken](
+        .onCompletion([hedgeCancellationToken, delayedHedges](
                           StatusWith<SingleResponse> result) mutable -> StatusWith<SingleResponse> {
+            {
+                stdx::lock_guard lk(delayedHedges->mutex);
+                delayedHedges->done = true;
+            }
             hedgeCancellationToken.cancel();
             if (!result.isOK()) {
                 auto status = result.getStatus();
@@ -59,11 +59,13 @@
 #include "mongo/db/query/cursor_response_gen.h"
 #include "mongo/db/query/find_command.h"
 #include "mongo/db/repl/hello_gen.h"
+#include "mongo/idl/server_parameter_test_util.h"
 #include "mongo/executor/async_rpc.h"
 #include "mongo/executor/async_rpc_targeter.h"
 #include "mongo/executor/async_rpc_test_fixture.h"
 #include "mongo/executor/hedged_async_rpc.h"
 #include "mongo/executor/hedging_metrics.h"
+#include "mongo/executor/host_latency_tracker.h"
 #include "mongo/executor/network_connection_hook.h"
 #include "mongo/executor/network_interface.h"
 #include "mongo/executor/network_interface_mock.h"
@@ -88,6 +90,7 @@
 namespace mongo {
 namespace async_rpc {
 namespace {
+using executor::HostLatencyTracker;
 using executor::RemoteCommandResponse;
 
 class HedgedAsyncRPCTest : public AsyncRPCTestFixture {
@@ -1032,6 +1035,73 @@ TEST_F(HedgedAsyncRPCTest, DynamicDelayBetweenRetries) {
     ASSERT_EQ(maxNumRetries, testPolicy->getNumRetriesPerformed());
 }
 
+/**
+ * Seeds the latency history the connection pools would normally record for 'host'.
+ */
+void recordLatencies(const HostAndPort& host, Milliseconds latency) {
+    for (size_t i = 0; i < HostLatencyTracker::kMinSamplesForPercentile; ++i) {
+        HostLatencyTracker::get().record(host, latency);
+    }
+}
+
+/**
+ * With hedgingDelayPercentile set, the authoritative request goes to the host with the lowest
+ * recent latency, and no hedge is sent if it answers within its usual latency.
+ */
+TEST_F(HedgedAsyncRPCTest, DelayedHedgeNotSentWhenAuthoritativeRespondsInTime) {
+    RAIIServerParameterControllerForTest delayPercentile{"hedgingDelayPercentile", 90};
+    HostLatencyTracker::get().clear();
+    recordLatencies(kTwoHosts[0], Milliseconds(50));
+    recordLatencies(kTwoHosts[1], Milliseconds(5));
+
+    auto resultFuture = sendHedgedCommandWithHosts(testFindCmd, kTwoHosts);
+
+    onCommand([&](const auto& request) {
+        ASSERT_EQ(request.target, kTwoHosts[1]);
+        ASSERT(!request.cmdObj["maxTimeMSOpOnly"]);
+        return CursorResponse(testNS, 0LL, {testFirstBatch})
+            .toBSON(CursorResponse::ResponseType::InitialResponse);
+    });
+
+    auto resCursor = resultFuture.get().response.getCursor();
+    ASSERT_BSONOBJ_EQ(resCursor->getFirstBatch()[0], testFirstBatch);
+    ASSERT_EQ(hm->getNumTotalHedgedOperations(), 0);
+    HostLatencyTracker::get().clear();
+}
+
+/**
+ * With hedgingDelayPercentile set, the hedge is sent once the authoritative request has been
+ * outstanding for the configured percentile of its host's recent latencies.
+ */
+TEST_F(HedgedAsyncRPCTest, DelayedHedgeSentOnceAuthoritativeIsSlow) {
+    RAIIServerParameterControllerForTest delayPercentile{"hedgingDelayPercentile", 50};
+    HostLatencyTracker::get().clear();
+    recordLatencies(kTwoHosts[0], Milliseconds(50));
+    recordLatencies(kTwoHosts[1], Milliseconds(5));
+
+    auto resultFuture = sendHedgedCommandWithHosts(testFindCmd, kTwoHosts);
+
+    auto network = getNetworkInterfaceMock();
+    network->enterNetwork();
+    auto authoritative = network->getNextReadyRequest();
+    ASSERT_EQ((*authoritative).getRequestOnAny().target[0], kTwoHosts[1]);
+
+    network->advanceTime(network->now() + Milliseconds(5));
+    auto hedged = network->getNextReadyRequest();
+    ASSERT_EQ((*hedged).getRequestOnAny().target[0], kTwoHosts[0]);
+    ASSERT((*hedged).getRequestOnAny().cmdObj["maxTimeMSOpOnly"]);
+
+    network->scheduleResponse(hedged, network->now(), testSuccessResponse);
+    network->runReadyNetworkOperations();
+    network->exitNetwork();
+
+    auto resCursor = resultFuture.get().response.getCursor();
+    ASSERT_BSONOBJ_EQ(resCursor->getFirstBatch()[0], testFirstBatch);
+    ASSERT_EQ(hm->getNumTotalHedgedOperations(), 1);
+    ASSERT_EQ(hm->getNumAdvantageouslyHedgedOperations(), 1);
+    HostLatencyTracker::get().clear();
+}
+
 namespace m = unittest::match;
 TEST_F(HedgedAsyncRPCTest, AttemptedTargetsPropogatedWithLocalErrors) {
     auto resultFuture = sendHedgedCommandWithHosts(testFindCmd, kTwoHosts);
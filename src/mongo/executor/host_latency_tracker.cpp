@@ -0,0 +1,87 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+
+#include "mongo/executor/host_latency_tracker.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "mongo/util/static_immortal.h"
+
+namespace mongo {
+namespace executor {
+
+HostLatencyTracker& HostLatencyTracker::get() {
+    static StaticImmortal<HostLatencyTracker> tracker;
+    return *tracker;
+}
+
+void HostLatencyTracker::record(const HostAndPort& host, Microseconds latency) {
+    stdx::lock_guard lk(_mutex);
+    auto& entry = _hosts[host];
+    // Same 1/8 weight as the connection pool's own moving averages, seeded by the first sample.
+    entry.average = entry.count ? entry.average + (latency - entry.average) / 8 : latency;
+    entry.window[entry.next] = latency;
+    entry.next = (entry.next + 1) % kWindowSize;
+    entry.count = std::min(entry.count + 1, kWindowSize);
+}
+
+boost::optional<Microseconds> HostLatencyTracker::getAverage(const HostAndPort& host) const {
+    stdx::lock_guard lk(_mutex);
+    auto it = _hosts.find(host);
+    if (it == _hosts.end())
+        return boost::none;
+    return it->second.average;
+}
+
+boost::optional<Microseconds> HostLatencyTracker::getPercentile(const HostAndPort& host,
+                                                                int percentile) const {
+    std::vector<Microseconds> samples;
+    {
+        stdx::lock_guard lk(_mutex);
+        auto it = _hosts.find(host);
+        if (it == _hosts.end() || it->second.count < kMinSamplesForPercentile)
+            return boost::none;
+        const auto& window = it->second.window;
+        samples.assign(window.begin(), window.begin() + it->second.count);
+    }
+
+    auto nth = samples.begin() + (samples.size() - 1) * std::clamp(percentile, 0, 100) / 100;
+    std::nth_element(samples.begin(), nth, samples.end());
+    return *nth;
+}
+
+void HostLatencyTracker::clear() {
+    stdx::lock_guard lk(_mutex);
+    _hosts.clear();
+}
+
+}  // namespace executor
+}  // namespace mongo
@@ -0,0 +1,98 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+
+#pragma once
+
+#include <array>
+#include <boost/optional/optional.hpp>
+#include <cstddef>
+
+#include "mongo/platform/mutex.h"
+#include "mongo/stdx/unordered_map.h"
+#include "mongo/util/duration.h"
+#include "mongo/util/net/hostandport.h"
+
+namespace mongo {
+namespace executor {
+
+/**
+ * Process-wide record of how long recent requests to each remote host took, as observed by the
+ * egress connection pools when connections are returned. It keeps an exponentially weighted
+ * moving average per host for least-latency target selection, and a window of the most recent
+ * samples from which tail percentiles are computed for hedging decisions.
+ */
+class HostLatencyTracker {
+    HostLatencyTracker(const HostLatencyTracker&) = delete;
+    HostLatencyTracker& operator=(const HostLatencyTracker&) = delete;
+
+public:
+    // Number of recent samples percentiles are computed over.
+    static constexpr size_t kWindowSize = 64;
+
+    // Percentiles are only reported once a host has this many samples.
+    static constexpr size_t kMinSamplesForPercentile = 8;
+
+    HostLatencyTracker() = default;
+
+    static HostLatencyTracker& get();
+
+    void record(const HostAndPort& host, Microseconds latency);
+
+    /**
+     * Returns the moving average latency of 'host', or boost::none if nothing has been recorded
+     * for it.
+     */
+    boost::optional<Microseconds> getAverage(const HostAndPort& host) const;
+
+    /**
+     * Returns the given percentile, in [0, 100], of the recent latencies of 'host', or boost::none
+     * if there are too few samples for it to be meaningful.
+     */
+    boost::optional<Microseconds> getPercentile(const HostAndPort& host, int percentile) const;
+
+    /**
+     * Forgets all recorded latencies. Used by tests.
+     */
+    void clear();
+
+private:
+    struct HostLatency {
+        Microseconds average{0};
+        std::array<Microseconds, kWindowSize> window;
+        size_t count = 0;
+        size_t next = 0;
+    };
+
+    mutable Mutex _mutex = MONGO_MAKE_LATCH("HostLatencyTracker::_mutex");
+    stdx::unordered_map<HostAndPort, HostLatency> _hosts;
+};
+
+}  // namespace executor
+}  // namespace mongo
@@ -0,0 +1,86 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+
+#include "mongo/executor/host_latency_tracker.h"
+
+#include "mongo/unittest/assert.h"
+#include "mongo/unittest/framework.h"
+
+namespace mongo {
+namespace executor {
+namespace {
+
+const HostAndPort kHost("FakeHost1", 12345);
+
+TEST(HostLatencyTrackerTest, UnknownHostHasNoEstimates) {
+    HostLatencyTracker tracker;
+    ASSERT_FALSE(tracker.getAverage(kHost));
+    ASSERT_FALSE(tracker.getPercentile(kHost, 50));
+}
+
+TEST(HostLatencyTrackerTest, AverageIsSeededByFirstSampleAndSmoothed) {
+    HostLatencyTracker tracker;
+    tracker.record(kHost, Microseconds(800));
+    ASSERT_EQ(*tracker.getAverage(kHost), Microseconds(800));
+
+    tracker.record(kHost, Microseconds(1600));
+    ASSERT_EQ(*tracker.getAverage(kHost), Microseconds(900));
+}
+
+TEST(HostLatencyTrackerTest, PercentileNeedsMinimumSamples) {
+    HostLatencyTracker tracker;
+    for (size_t i = 1; i < HostLatencyTracker::kMinSamplesForPercentile; ++i) {
+        tracker.record(kHost, Microseconds(100));
+    }
+    ASSERT_FALSE(tracker.getPercentile(kHost, 50));
+
+    tracker.record(kHost, Microseconds(100));
+    ASSERT_EQ(*tracker.getPercentile(kHost, 50), Microseconds(100));
+}
+
+TEST(HostLatencyTrackerTest, PercentileCoversOnlyRecentWindow) {
+    HostLatencyTracker tracker;
+    for (size_t i = 0; i < HostLatencyTracker::kWindowSize; ++i) {
+        tracker.record(kHost, Microseconds(1000));
+    }
+    ASSERT_EQ(*tracker.getPercentile(kHost, 100), Microseconds(1000));
+
+    // A full window of faster samples pushes the old ones out entirely.
+    for (size_t i = 0; i < HostLatencyTracker::kWindowSize; ++i) {
+        tracker.record(kHost, Microseconds(i + 1));
+    }
+    ASSERT_EQ(*tracker.getPercentile(kHost, 0), Microseconds(1));
+    ASSERT_EQ(*tracker.getPercentile(kHost, 100), Microseconds(HostLatencyTracker::kWindowSize));
+    ASSERT_EQ(*tracker.getPercentile(kHost, 50), Microseconds(32));
+}
+
+}  // namespace
+}  // namespace executor
+}  // namespace mongo
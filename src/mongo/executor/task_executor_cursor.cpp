@@ -281,8 +281,9 @@ void TaskExecutorCursor::_scheduleGetMore(OperationContext* opCtx) {
     getMoreRequest.setBatchSize(_options.batchSize);
 
     if (_options.getMoreAugmentationWriter) {
-        // Prefetching must be disabled to use the augmenting functionality.
-        invariant(!_options.preFetchNextBatch);
+        // Prefetching must be disabled to use the augmenting functionality, unless the caller
+        // opted in to start pre-fetching after the first on-demand getMore.
+        invariant(!_options.preFetchNextBatch || _options.preFetchAfterFirstGetMore);
         BSONObjBuilder getMoreBob;
         getMoreRequest.serialize({}, &getMoreBob);
         _options.getMoreAugmentationWriter(getMoreBob);
@@ -298,6 +299,10 @@ void TaskExecutorCursor::_getNextBatch(OperationContext* opCtx) {
     if (!_cmdState) {
         invariant(!_options.preFetchNextBatch);
         _scheduleGetMore(opCtx);
+        if (_options.preFetchAfterFirstGetMore) {
+            // From now on, request each batch as soon as the previous one is received.
+            _options.preFetchNextBatch = true;
+        }
     }
 
     // There should be an in-flight request at this point, either sent asyncronously when we
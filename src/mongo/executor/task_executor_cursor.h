@@ -90,6 +90,10 @@ public:
         // If false, we will fetch the next batch when the current batch is exhausted and
         // 'getNext()' is invoked.
         bool preFetchNextBatch{true};
+        // Only meaningful when 'preFetchNextBatch' is false. If true, pre-fetching is switched on
+        // once a getMore has had to be issued on demand: the batches received so far were not
+        // enough, so more are likely to be needed and their round trips can be overlapped.
+        bool preFetchAfterFirstGetMore{false};
 
         // This function, if specified, may modify a getMore request to include additional
         // information.
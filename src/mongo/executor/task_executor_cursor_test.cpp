@@ -609,6 +609,60 @@ public:
         });
     }
 
+    /**
+     * Ensure that with 'preFetchAfterFirstGetMore', the first getMore is only sent on demand but
+     * every later one is sent as soon as the previous batch is received.
+     */
+    void PreFetchAfterFirstGetMoreTest() {
+        const auto findCmd = BSON("find"
+                                  << "test"
+                                  << "batchSize" << 2);
+        CursorId cursorId = 1;
+
+        RemoteCommandRequest rcr(HostAndPort("localhost"),
+                                 DatabaseName::createDatabaseName_forTest(boost::none, "test"),
+                                 findCmd,
+                                 opCtx.get());
+
+        TaskExecutorCursor tec = makeTec(rcr, [] {
+            TaskExecutorCursor::Options opts;
+            opts.batchSize = 2;
+            opts.preFetchAfterFirstGetMore = true;
+            return opts;
+        }());
+
+        scheduleSuccessfulCursorResponse("firstBatch", 1, 2, cursorId);
+
+        ASSERT_EQUALS(tec.getNext(opCtx.get()).value()["x"].Int(), 1);
+        ASSERT_EQUALS(tec.getNext(opCtx.get()).value()["x"].Int(), 2);
+
+        // Nothing is fetched before the first batch has been exhausted.
+        ASSERT_FALSE(hasReadyRequests());
+
+        // This sends the first getMore on demand.
+        ASSERT_THROWS_CODE(opCtx->runWithDeadline(Date_t::now() + Milliseconds(100),
+                                                  ErrorCodes::ExceededTimeLimit,
+                                                  [&] { tec.getNext(opCtx.get()); }),
+                           DBException,
+                           ErrorCodes::ExceededTimeLimit);
+        scheduleSuccessfulCursorResponse("nextBatch", 3, 4, cursorId);
+
+        // Receiving the second batch sends the next getMore straight away.
+        ASSERT_EQUALS(tec.getNext(opCtx.get()).value()["x"].Int(), 3);
+        ASSERT_TRUE(hasReadyRequests());
+
+        cursorId = 0;
+        scheduleSuccessfulCursorResponse("nextBatch", 5, 6, cursorId);
+
+        ASSERT_EQUALS(tec.getNext(opCtx.get()).value()["x"].Int(), 4);
+        ASSERT_EQUALS(tec.getNext(opCtx.get()).value()["x"].Int(), 5);
+        ASSERT_EQUALS(tec.getNext(opCtx.get()).value()["x"].Int(), 6);
+
+        // We don't issue extra getmores after returning a 0 cursor id.
+        ASSERT_FALSE(hasReadyRequests());
+        ASSERT_FALSE(tec.getNext(opCtx.get()));
+    }
+
     ServiceContext::UniqueServiceContext serviceCtx = ServiceContext::make();
     ServiceContext::UniqueClient client;
     ServiceContext::UniqueOperationContext opCtx;
@@ -1028,6 +1082,10 @@ TEST_F(NoPrefetchPinnedTaskExecutorCursorTestFixture, NoPrefetchWithPinning) {
     NoPrefetchGetMore();
 }
 
+TEST_F(NoPrefetchTaskExecutorCursorTestFixture, PreFetchAfterFirstGetMore) {
+    PreFetchAfterFirstGetMoreTest();
+}
+
 }  // namespace
 }  // namespace executor
 }  // namespace mongo
@@ -42,12 +42,14 @@
 #include <boost/move/utility_core.hpp>
 #include <boost/smart_ptr/make_shared_object.hpp>
 #include <boost/smart_ptr/shared_ptr.hpp>
+#include <deque>
 #include <exception>
 #include <fmt/format.h>
 #include <fstream>  // IWYU pragma: keep
 #include <iostream>
 #include <utility>
 
+#include <boost/log/attributes/value_extraction.hpp>
 #include <boost/log/core/record_view.hpp>
 // IWYU pragma: no_include "boost/system/detail/errc.hpp"
 // IWYU pragma: no_include "boost/system/detail/error_code.hpp"
@@ -55,12 +57,17 @@
 #include "mongo/base/error_codes.h"
 #include "mongo/base/status_with.h"
 #include "mongo/logv2/attribute_storage.h"
+#include "mongo/logv2/attributes.h"
 #include "mongo/logv2/json_formatter.h"
 #include "mongo/logv2/log_component.h"
 #include "mongo/logv2/log_severity.h"
 #include "mongo/logv2/log_tag.h"
 #include "mongo/logv2/log_truncation.h"
 #include "mongo/logv2/shared_access_fstream.h"  // IWYU pragma: keep
+#include "mongo/platform/atomic_word.h"
+#include "mongo/stdx/condition_variable.h"
+#include "mongo/stdx/mutex.h"
+#include "mongo/stdx/thread.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/concurrency/thread_name.h"
 #include "mongo/util/exit_code.h"
@@ -98,18 +105,112 @@ StatusWith<boost::shared_ptr<stream_t>> openFile(const std::string& filename, bo
 }  // namespace
 
 struct FileRotateSink::Impl {
+    struct AsyncWriter {
+        AsyncWriter(size_t maxBufferedBytes, bool dropWhenFull)
+            : maxBufferedBytes(maxBufferedBytes), dropWhenFull(dropWhenFull) {}
+
+        const size_t maxBufferedBytes;
+        const bool dropWhenFull;
+
+        // Guards everything below except the counters. Producers only hold it long enough to
+        // queue a record; the writer thread releases it while it writes a batch.
+        stdx::mutex mutex;  // NOLINT(mongo-mutex-check)
+        stdx::condition_variable recordsQueued;
+        stdx::condition_variable spaceFreed;
+        std::deque<std::string> queue;
+        size_t bufferedBytes = 0;
+        bool writing = false;
+        bool shutdown = false;
+        stdx::thread thread;
+
+        AtomicWord<long long> written{0};
+        AtomicWord<long long> dropped{0};
+        AtomicWord<long long> waitedForSpace{0};
+    };
+
     Impl(LogTimestampFormat tsFormat) : timestampFormat(tsFormat) {}
+
+    void abortIfAnyFileFailed();
+
     StringMap<boost::shared_ptr<stream_t>> files;
     LogTimestampFormat timestampFormat;
+
+    // Serializes writes to and rotation of 'files' between the logging threads and the async
+    // writer thread.
+    stdx::mutex writeMutex;  // NOLINT(mongo-mutex-check)
+    std::unique_ptr<AsyncWriter> async;
 };
 
+void FileRotateSink::Impl::abortIfAnyFileFailed() {
+    auto isFailed = [](const auto& file) {
+        return file.second->fail();
+    };
+    if (std::none_of(files.begin(), files.end(), isFailed))
+        return;
+
+    try {
+        auto failedBegin = boost::make_filter_iterator(isFailed, files.begin(), files.end());
+        auto failedEnd = boost::make_filter_iterator(isFailed, files.end(), files.end());
+
+        auto getFilename = [](const auto& file) -> const auto& {
+            return file.first;
+        };
+        auto begin = boost::make_transform_iterator(failedBegin, getFilename);
+        auto end = boost::make_transform_iterator(failedEnd, getFilename);
+        auto sequence = logv2::seqLog(begin, end);
+
+        DynamicAttributes attrs;
+        attrs.add("files", sequence);
+
+        fmt::memory_buffer buffer;
+        JSONFormatter(nullptr, timestampFormat)
+            .format(buffer,
+                    LogSeverity::Severe(),
+                    LogComponent::kControl,
+                    Date_t::now(),
+                    4522200,
+                    getLogService(),
+                    getThreadName(),
+                    "Writing to log file failed, aborting application",
+                    TypeErasedAttributeStorage(attrs),
+                    LogTag::kNone,
+                    std::string() /* tenantID */,
+                    LogTruncation::Disabled);
+        // Commented out log line below to get validation of the log id with the errorcodes
+        // linter LOGV2(4522200, "Writing to log file failed, aborting application");
+        std::cerr << StringData(buffer.data(), buffer.size()) << std::endl;
+    } catch (const std::exception& ex) {
+        std::cerr << "Caught std::exception of type " << demangleName(typeid(ex)) << ": "
+                  << ex.what() << std::endl;
+    } catch (const boost::exception& ex) {
+        std::cerr << "Caught boost::exception of type " << demangleName(typeid(ex)) << ": "
+                  << boost::diagnostic_information(ex) << std::endl;
+    } catch (...) {
+        std::cerr << "Caught unidentified exception" << std::endl;
+    }
+
+    printStackTrace(std::cerr);
+    quickExitWithoutLogging(ExitCode::fail);
+}
+
 FileRotateSink::FileRotateSink(LogTimestampFormat timestampFormat)
     : _impl(std::make_unique<Impl>(timestampFormat)) {}
-FileRotateSink::~FileRotateSink() {}
+
+FileRotateSink::~FileRotateSink() {
+    if (auto& async = _impl->async) {
+        {
+            stdx::lock_guard lk(async->mutex);
+            async->shutdown = true;
+        }
+        async->recordsQueued.notify_one();
+        async->thread.join();
+    }
+}
 
 Status FileRotateSink::addFile(const std::string& filename, bool append) {
     auto statusWithFile = openFile(filename, append);
     if (statusWithFile.isOK()) {
+        stdx::lock_guard lk(_impl->writeMutex);
         add_stream(statusWithFile.getValue());
         _impl->files[filename] = statusWithFile.getValue();
     }
@@ -117,6 +218,7 @@ Status FileRotateSink::addFile(const std::string& filename, bool append) {
     return statusWithFile.getStatus().withContext("Can't initialize rotatable log file");
 }
 void FileRotateSink::removeFile(const std::string& filename) {
+    stdx::lock_guard lk(_impl->writeMutex);
     auto it = _impl->files.find(filename);
     if (it != _impl->files.cend()) {
         remove_stream(it->second);
@@ -127,6 +229,9 @@ void FileRotateSink::removeFile(const std::string& filename) {
 Status FileRotateSink::rotate(bool rename,
                               StringData renameSuffix,
                               std::function<void(Status)> onMinorError) {
+    // Records logged before the rotation belong in the file being rotated out.
+    drainAsyncWriter();
+    stdx::lock_guard lk(_impl->writeMutex);
     for (auto& file : _impl->files) {
         const std::string& filename = file.first;
         if (rename) {
@@ -188,56 +293,110 @@ Status FileRotateSink::rotate(bool rename,
 
 void FileRotateSink::consume(const boost::log::record_view& rec,
                              const string_type& formatted_string) {
-    auto isFailed = [](const auto& file) {
-        return file.second->fail();
-    };
+    if (_impl->async) {
+        if (boost::log::extract<LogSeverity>(attributes::severity(), rec).get() <
+            LogSeverity::Severe()) {
+            _enqueue(formatted_string);
+            return;
+        }
+        drainAsyncWriter();
+    }
+
+    stdx::lock_guard lk(_impl->writeMutex);
     boost::log::sinks::text_ostream_backend::consume(rec, formatted_string);
-    if (std::any_of(_impl->files.begin(), _impl->files.end(), isFailed)) {
-        try {
-            auto failedBegin =
-                boost::make_filter_iterator(isFailed, _impl->files.begin(), _impl->files.end());
-            auto failedEnd =
-                boost::make_filter_iterator(isFailed, _impl->files.end(), _impl->files.end());
-
-            auto getFilename = [](const auto& file) -> const auto& {
-                return file.first;
-            };
-            auto begin = boost::make_transform_iterator(failedBegin, getFilename);
-            auto end = boost::make_transform_iterator(failedEnd, getFilename);
-            auto sequence = logv2::seqLog(begin, end);
-
-            DynamicAttributes attrs;
-            attrs.add("files", sequence);
-
-            fmt::memory_buffer buffer;
-            JSONFormatter(nullptr, _impl->timestampFormat)
-                .format(buffer,
-                        LogSeverity::Severe(),
-                        LogComponent::kControl,
-                        Date_t::now(),
-                        4522200,
-                        getLogService(),
-                        getThreadName(),
-                        "Writing to log file failed, aborting application",
-                        TypeErasedAttributeStorage(attrs),
-                        LogTag::kNone,
-                        std::string() /* tenantID */,
-                        LogTruncation::Disabled);
-            // Commented out log line below to get validation of the log id with the errorcodes
-            // linter LOGV2(4522200, "Writing to log file failed, aborting application");
-            std::cerr << StringData(buffer.data(), buffer.size()) << std::endl;
-        } catch (const std::exception& ex) {
-            std::cerr << "Caught std::exception of type " << demangleName(typeid(ex)) << ": "
-                      << ex.what() << std::endl;
-        } catch (const boost::exception& ex) {
-            std::cerr << "Caught boost::exception of type " << demangleName(typeid(ex)) << ": "
-                      << boost::diagnostic_information(ex) << std::endl;
-        } catch (...) {
-            std::cerr << "Caught unidentified exception" << std::endl;
+    _impl->abortIfAnyFileFailed();
+}
+
+void FileRotateSink::startAsyncWriter(size_t maxBufferedBytes, bool dropWhenFull) {
+    invariant(!_impl->async);
+    _impl->async = std::make_unique<Impl::AsyncWriter>(maxBufferedBytes, dropWhenFull);
+    _impl->async->thread = stdx::thread([this] { _asyncWriterLoop(); });
+}
+
+void FileRotateSink::drainAsyncWriter() {
+    auto& async = _impl->async;
+    if (!async)
+        return;
+    stdx::unique_lock lk(async->mutex);
+    async->spaceFreed.wait(lk, [&] { return async->queue.empty() && !async->writing; });
+}
+
+stdx::unique_lock<stdx::mutex> FileRotateSink::lockFiles_forTest() {
+    return stdx::unique_lock(_impl->writeMutex);
+}
+
+boost::optional<FileRotateSink::AsyncWriterStats> FileRotateSink::asyncWriterStats() const {
+    auto& async = _impl->async;
+    if (!async)
+        return boost::none;
+    AsyncWriterStats stats;
+    {
+        stdx::lock_guard lk(async->mutex);
+        stats.bufferedBytes = async->bufferedBytes;
+    }
+    stats.written = async->written.load();
+    stats.dropped = async->dropped.load();
+    stats.waitedForSpace = async->waitedForSpace.load();
+    return stats;
+}
+
+void FileRotateSink::_enqueue(const string_type& formatted_string) {
+    auto& async = *_impl->async;
+    auto fits = [&] {
+        // A record larger than the whole buffer is still accepted once the queue is empty.
+        return async.queue.empty() ||
+            async.bufferedBytes + formatted_string.size() <= async.maxBufferedBytes;
+    };
+
+    stdx::unique_lock lk(async.mutex);
+    if (!fits()) {
+        if (async.dropWhenFull) {
+            async.dropped.fetchAndAdd(1);
+            return;
+        }
+        async.waitedForSpace.fetchAndAdd(1);
+        async.spaceFreed.wait(lk, fits);
+    }
+    async.queue.push_back(formatted_string);
+    async.bufferedBytes += formatted_string.size();
+    lk.unlock();
+    async.recordsQueued.notify_one();
+}
+
+void FileRotateSink::_asyncWriterLoop() {
+    setThreadName("logWriter");
+
+    auto& async = *_impl->async;
+    std::deque<std::string> batch;
+    stdx::unique_lock lk(async.mutex);
+    while (true) {
+        async.recordsQueued.wait(lk, [&] { return async.shutdown || !async.queue.empty(); });
+        if (async.queue.empty())
+            return;
+
+        batch.swap(async.queue);
+        async.bufferedBytes = 0;
+        async.writing = true;
+        lk.unlock();
+        async.spaceFreed.notify_all();
+
+        {
+            stdx::lock_guard writeLk(_impl->writeMutex);
+            for (auto&& [_, file] : _impl->files) {
+                for (const auto& record : batch) {
+                    file->write(record.data(), record.size());
+                    file->put('\n');
+                }
+                file->flush();
+            }
+            _impl->abortIfAnyFileFailed();
         }
+        async.written.fetchAndAdd(batch.size());
+        batch.clear();
 
-        printStackTrace(std::cerr);
-        quickExitWithoutLogging(ExitCode::fail);
+        lk.lock();
+        async.writing = false;
+        async.spaceFreed.notify_all();
     }
 }
 
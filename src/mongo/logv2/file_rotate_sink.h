@@ -30,6 +30,8 @@
 #pragma once
 
 #include <boost/log/sinks/text_ostream_backend.hpp>
+#include <boost/optional/optional.hpp>
+#include <cstddef>
 #include <functional>
 #include <memory>
 #include <string>
@@ -39,6 +41,7 @@
 #include "mongo/base/status.h"
 #include "mongo/base/string_data.h"
 #include "mongo/logv2/log_format.h"
+#include "mongo/stdx/mutex.h"
 
 namespace mongo::logv2 {
 // boost::log backend sink to provide MongoDB style file rotation.
@@ -56,7 +59,46 @@ public:
 
     void consume(const boost::log::record_view& rec, const string_type& formatted_string);
 
+    struct AsyncWriterStats {
+        long long bufferedBytes = 0;
+        long long written = 0;
+        long long dropped = 0;
+        long long waitedForSpace = 0;
+    };
+
+    /**
+     * Moves writing to the log files off the logging threads. Formatted records are queued, up to
+     * 'maxBufferedBytes' in total, and a dedicated thread writes them out in batches with a single
+     * flush per batch. When the queue is full the record is dropped if 'dropWhenFull' is set,
+     * otherwise the logging thread waits for the writer to make room.
+     *
+     * Severe records drain the queue and are then written synchronously, so that whatever is
+     * logged before a fatal assertion reaches the file.
+     */
+    void startAsyncWriter(size_t maxBufferedBytes, bool dropWhenFull);
+
+    /**
+     * Blocks until every record queued so far has been written. Does nothing if the async writer
+     * was not started. Does not require the backend lock.
+     */
+    void drainAsyncWriter();
+
+    /**
+     * Returns the async writer counters, or none if the async writer was not started.
+     */
+    boost::optional<AsyncWriterStats> asyncWriterStats() const;
+
+    /**
+     * Keeps the async writer from writing to the files while the returned lock is held. Records
+     * logged meanwhile stay queued, or are dropped once the queue is full.
+     */
+    stdx::unique_lock<stdx::mutex> lockFiles_forTest();
+
 private:
+    void _asyncWriterLoop();
+    void _enqueue(const string_type& formatted_string);
+
+
     struct Impl;
     std::unique_ptr<Impl> _impl;
 };
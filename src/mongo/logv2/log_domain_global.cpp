@@ -113,6 +113,9 @@ struct LogDomainGlobal::Impl {
     ConfigurationOptions _config;
     boost::shared_ptr<boost::log::sinks::unlocked_sink<ConsoleBackend>> _consoleSink;
     boost::shared_ptr<boost::log::sinks::unlocked_sink<RotatableFileBackend>> _rotatableFileSink;
+    // Only set when the file backend uses an async writer. Kept outside the composite backend so
+    // that it can be drained without taking the backend lock.
+    boost::shared_ptr<FileRotateSink> _asyncFileSink;
     boost::shared_ptr<boost::log::sinks::unlocked_sink<BacktraceBackend>> _backtraceSink;
 #ifndef _WIN32
     boost::shared_ptr<boost::log::sinks::unlocked_sink<SyslogBackend>> _syslogSink;
@@ -189,9 +192,16 @@ Status LogDomainGlobal::Impl::configure(LogDomainGlobal::ConfigurationOptions co
     }
 #endif
 
+    // Drain the outgoing file sink before it is replaced or removed.
+    if (_asyncFileSink) {
+        _asyncFileSink->drainAsyncWriter();
+        _asyncFileSink.reset();
+    }
+
     if (options.fileEnabled) {
+        auto fileSink = boost::make_shared<FileRotateSink>(options.timestampFormat);
         auto backend = boost::make_shared<RotatableFileBackend>(
-            boost::make_shared<FileRotateSink>(options.timestampFormat),
+            fileSink,
             boost::make_shared<RamLogSink>(RamLog::get("global")),
             boost::make_shared<RamLogSink>(RamLog::get("startupWarnings")),
             boost::make_shared<UserAssertSink>());
@@ -204,6 +214,12 @@ Status LogDomainGlobal::Impl::configure(LogDomainGlobal::ConfigurationOptions co
         backend->setFilter<2>(
             TaggedSeverityFilter(_parent, {LogTag::kStartupWarnings}, LogSeverity::Log()));
 
+        if (options.fileAsyncBufferSizeBytes > 0) {
+            fileSink->startAsyncWriter(options.fileAsyncBufferSizeBytes,
+                                       options.fileAsyncDropWhenFull);
+            _asyncFileSink = std::move(fileSink);
+        }
+
         _rotatableFileSink =
             boost::make_shared<boost::log::sinks::unlocked_sink<RotatableFileBackend>>(backend);
         _rotatableFileSink->set_filter(ComponentSettingsFilter(_parent, _settings));
@@ -350,6 +366,17 @@ Status LogDomainGlobal::rotate(bool rename,
     return _impl->rotate(rename, renameSuffix, onMinorError);
 }
 
+void LogDomainGlobal::flushAsyncFileWrites() {
+    if (auto& sink = _impl->_asyncFileSink)
+        sink->drainAsyncWriter();
+}
+
+boost::optional<FileRotateSink::AsyncWriterStats> LogDomainGlobal::asyncFileWriterStats() const {
+    if (auto& sink = _impl->_asyncFileSink)
+        return sink->asyncWriterStats();
+    return boost::none;
+}
+
 LogComponentSettings& LogDomainGlobal::settings() {
     return _impl->_settings;
 }
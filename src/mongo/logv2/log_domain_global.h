@@ -29,6 +29,8 @@
 
 #pragma once
 
+#include <boost/optional/optional.hpp>
+#include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <memory>
@@ -37,6 +39,7 @@
 #include "mongo/base/status.h"
 #include "mongo/base/string_data.h"
 #include "mongo/logv2/constants.h"
+#include "mongo/logv2/file_rotate_sink.h"
 #include "mongo/logv2/log_component_settings.h"
 #include "mongo/logv2/log_domain.h"
 #include "mongo/logv2/log_domain_internal.h"
@@ -62,6 +65,13 @@ public:
         LogFormat format{LogFormat::kDefault};
         const AtomicWord<int32_t>* maxAttributeSizeKB = nullptr;
 
+        // When non-zero, records for the log file are written by a dedicated thread and up to
+        // this many bytes of formatted records may be queued for it.
+        size_t fileAsyncBufferSizeBytes{0};
+        // Whether records are dropped, rather than the logging thread waiting, when the async
+        // writer's queue is full.
+        bool fileAsyncDropWhenFull{false};
+
         std::string backtraceFilePath;
 
         void makeDisabled();
@@ -77,6 +87,17 @@ public:
 
     const ConfigurationOptions& config() const;
 
+    /**
+     * Blocks until all records queued for the async log file writer have been written. Safe to call
+     * when the async writer is not enabled.
+     */
+    void flushAsyncFileWrites();
+
+    /**
+     * Returns the counters of the async log file writer, or none if it is not enabled.
+     */
+    boost::optional<FileRotateSink::AsyncWriterStats> asyncFileWriterStats() const;
+
     LogComponentSettings& settings();
 
 private:
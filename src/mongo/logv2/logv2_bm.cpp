@@ -116,6 +116,32 @@ private:
     bool _shouldInit;
 };
 
+// RAII style helper class that points the global log domain at a file. The benchmark argument is
+// the async writer's buffer size in bytes, with zero meaning synchronous writes.
+class ScopedFileLogV2Bench {
+public:
+    ScopedFileLogV2Bench(benchmark::State& state) {
+        _shouldInit = state.thread_index == 0;
+        if (_shouldInit) {
+            logv2::LogDomainGlobal::ConfigurationOptions config;
+            config.consoleEnabled = false;
+            config.fileEnabled = true;
+            config.filePath = "/dev/null";
+            config.fileAsyncBufferSizeBytes = state.range(0);
+            auto& domain = logv2::LogManager::global().getGlobalDomainInternal();
+            invariant(domain.configure(config).isOK());
+        }
+    }
+
+    ~ScopedFileLogV2Bench() {
+        if (_shouldInit)
+            invariant(logv2::LogManager::global().getGlobalDomainInternal().configure({}).isOK());
+    }
+
+private:
+    bool _shouldInit;
+};
+
 // "Expensive" way to create a string.
 std::string createLongString() {
     return std::string(1000, 'a') + std::string(1000, 'b') + std::string(1000, 'c') +
@@ -169,6 +195,13 @@ void BM_EnabledLogV2ManySmallArg(benchmark::State& state) {
     }
 }
 
+void BM_FileLogV2(benchmark::State& state) {
+    ScopedFileLogV2Bench init(state);
+
+    for (auto _ : state)
+        LOGV2(9156654, "file log {}", "str"_attr = "a relatively short attribute"_sd);
+}
+
 void ThreadCounts(benchmark::internal::Benchmark* b) {
     int tc[] = {1, 2, 4, 8};
     for (int t : tc)
@@ -180,6 +213,7 @@ BENCHMARK(BM_NoopLogV2Arg)->Apply(ThreadCounts);
 BENCHMARK(BM_EnabledLogV2)->Apply(ThreadCounts);
 BENCHMARK(BM_EnabledLogV2ExpensiveArg)->Apply(ThreadCounts);
 BENCHMARK(BM_EnabledLogV2ManySmallArg)->Apply(ThreadCounts);
+BENCHMARK(BM_FileLogV2)->Arg(0)->Arg(1 << 20)->Apply(ThreadCounts);
 
 }  // namespace
 }  // namespace mongo
@@ -101,6 +101,7 @@
 #include "mongo/logv2/component_settings_filter.h"
 #include "mongo/logv2/composite_backend.h"
 #include "mongo/logv2/constants.h"
+#include "mongo/logv2/file_rotate_sink.h"
 #include "mongo/logv2/json_formatter.h"
 #include "mongo/logv2/log.h"
 #include "mongo/logv2/log_attr.h"
@@ -2272,6 +2273,124 @@ TEST_F(LogV2Test, FileLogging) {
     ASSERT(before_rotation == after_rotation);
 }
 
+class AsyncFileLoggingTest : public LogV2Test {
+public:
+    AsyncFileLoggingTest() {
+        ASSERT_OK(backend->addFile(fileName, false));
+        backend->auto_flush(true);
+    }
+
+    void startAsyncWriter(size_t maxBufferedBytes, bool dropWhenFull) {
+        backend->startAsyncWriter(maxBufferedBytes, dropWhenFull);
+        sink = wrapInSynchronousSink(backend);
+        applyDefaultFilterToSink(sink);
+        sink->set_formatter(PlainFormatter());
+        attachSink(sink);
+    }
+
+    static std::vector<std::string> readFile(const std::string& filename) {
+        std::vector<std::string> lines;
+        std::ifstream file(filename);
+        for (std::string line; std::getline(file, line, '\n');)
+            lines.push_back(std::move(line));
+        return lines;
+    }
+
+    static std::vector<std::string> makeRecords(int count) {
+        std::vector<std::string> records;
+        for (int i = 0; i < count; ++i) {
+            records.push_back(fmt::format("record {}", i));
+        }
+        return records;
+    }
+
+    unittest::TempDir dir{"logv2_async"};
+    std::string fileName = dir.path() + "/file.log";
+    boost::shared_ptr<FileRotateSink> backend =
+        boost::make_shared<FileRotateSink>(LogTimestampFormat::kISO8601UTC);
+    boost::shared_ptr<boost::log::sinks::synchronous_sink<FileRotateSink>> sink;
+};
+
+TEST_F(AsyncFileLoggingTest, RecordsAreWrittenInOrder) {
+    startAsyncWriter(1024 * 1024, false /* dropWhenFull */);
+    constexpr int kNumRecords = 100;
+    for (int i = 0; i < kNumRecords; ++i) {
+        LOGV2(9156661, "record {i}", "i"_attr = i);
+    }
+
+    backend->drainAsyncWriter();
+    ASSERT(readFile(fileName) == makeRecords(kNumRecords));
+    ASSERT_EQ(kNumRecords, backend->asyncWriterStats()->written);
+}
+
+TEST_F(AsyncFileLoggingTest, SevereRecordDrainsTheQueue) {
+    startAsyncWriter(1024 * 1024, false /* dropWhenFull */);
+    {
+        // Nothing is written while the files are locked.
+        auto lk = backend->lockFiles_forTest();
+        for (int i = 0; i < 3; ++i) {
+            LOGV2(9156662, "record {i}", "i"_attr = i);
+        }
+    }
+
+    // The severe record is only written once the queued records are, and before it returns.
+    LOGV2_FATAL_CONTINUE(9156663, "severe");
+    auto expected = makeRecords(3);
+    expected.push_back("severe");
+    ASSERT(readFile(fileName) == expected);
+}
+
+TEST_F(AsyncFileLoggingTest, RecordsAreDroppedWhenTheQueueIsFull) {
+    // The queue holds a single record.
+    startAsyncWriter(makeRecords(1).front().size(), true /* dropWhenFull */);
+    constexpr int kNumRecords = 4;
+    {
+        // While the files are locked, the writer can take at most one record off the queue.
+        auto lk = backend->lockFiles_forTest();
+        for (int i = 0; i < kNumRecords; ++i) {
+            LOGV2(9156664, "record {i}", "i"_attr = i);
+        }
+    }
+
+    backend->drainAsyncWriter();
+    auto stats = *backend->asyncWriterStats();
+    ASSERT_GTE(stats.dropped, kNumRecords - 2);
+    ASSERT_EQ(kNumRecords, stats.written + stats.dropped);
+    ASSERT_EQ(0, stats.waitedForSpace);
+    ASSERT_EQ(static_cast<size_t>(stats.written), readFile(fileName).size());
+    ASSERT_EQ("record 0", readFile(fileName).front());
+}
+
+TEST_F(AsyncFileLoggingTest, RotationDrainsTheQueue) {
+    startAsyncWriter(1024 * 1024, false /* dropWhenFull */);
+    {
+        auto lk = backend->lockFiles_forTest();
+        for (int i = 0; i < 3; ++i) {
+            LOGV2(9156665, "record {i}", "i"_attr = i);
+        }
+    }
+
+    ASSERT_OK(backend->rotate(true /* rename */, ".rotated", nullptr));
+    ASSERT(readFile(fileName + ".rotated") == makeRecords(3));
+    ASSERT(readFile(fileName).empty());
+}
+
+TEST_F(AsyncFileLoggingTest, ShutdownWritesQueuedRecords) {
+    startAsyncWriter(1024 * 1024, false /* dropWhenFull */);
+    {
+        auto lk = backend->lockFiles_forTest();
+        for (int i = 0; i < 3; ++i) {
+            LOGV2(9156666, "record {i}", "i"_attr = i);
+        }
+    }
+
+    // Destroying the sink stops the writer once it has written every queued record.
+    popSink();
+    sink.reset();
+    backend.reset();
+    ASSERT(readFile(fileName) == makeRecords(3));
+}
+
 TEST_F(LogV2Test, UserAssert) {
     std::vector<std::string> lines;
     auto sink = wrapInSynchronousSink(wrapInCompositeBackend(
@@ -36,6 +36,7 @@
 #include "mongo/rpc/legacy_request.h"
 #include "mongo/rpc/message.h"
 #include "mongo/rpc/op_msg_rpc_impls.h"
+#include "mongo/rpc/reply_buffer_cache.h"
 #include "mongo/rpc/reply_builder_interface.h"
 #include "mongo/rpc/reply_interface.h"
 #include "mongo/util/assert_util.h"
@@ -74,7 +75,7 @@ OpMsgRequest opMsgRequestFromAnyProtocol(const Message& unownedMessage, Client*
 std::unique_ptr<ReplyBuilderInterface> makeReplyBuilder(Protocol protocol) {
     switch (protocol) {
         case Protocol::kOpMsg:
-            return std::make_unique<OpMsgReplyBuilder>();
+            return std::make_unique<OpMsgReplyBuilder>(takeReplyBuffer());
         case Protocol::kOpQuery:
             return std::make_unique<LegacyReplyBuilder>();
     }
@@ -59,7 +59,8 @@ std::unique_ptr<ReplyInterface> makeReply(const Message* unownedMessage);
 OpMsgRequest opMsgRequestFromAnyProtocol(const Message& unownedMessage, Client* client = nullptr);
 
 /**
- * Returns the appropriate concrete ReplyBuilder.
+ * Returns the appropriate concrete ReplyBuilder. OP_MSG builders start from a buffer recycled by
+ * recycleReplyBuffer() when the current thread has one cached.
  */
 std::unique_ptr<ReplyBuilderInterface> makeReplyBuilder(Protocol protocol);
 
@@ -141,7 +141,8 @@ struct OpMsg {
     static OpMsg parse(const Message& message, Client* client = nullptr);
 
     /**
-     * Parses and returns an OpMsg containing owned BSON.
+     * Parses and returns an OpMsg containing owned BSON. The body and every document sequence
+     * share ownership of the message's buffer rather than copying out of it.
      */
     static OpMsg parseOwned(const Message& message, Client* client = nullptr) {
         auto msg = parse(message, client);
@@ -245,6 +246,14 @@ public:
         skipHeaderAndFlags();
     }
 
+    /**
+     * Builds into 'buf' instead of a freshly allocated buffer, for example one recycled from a
+     * message that has already been sent. 'buf' must not be shared.
+     */
+    explicit OpMsgBuilder(SharedBuffer buf) : _buf(std::move(buf)) {
+        skipHeaderAndFlags();
+    }
+
     /**
      * See the documentation for DocSequenceBuilder below.
      */
@@ -53,6 +53,13 @@ private:
 
 class OpMsgReplyBuilder final : public rpc::ReplyBuilderInterface {
 public:
+    OpMsgReplyBuilder() = default;
+
+    /**
+     * Builds the reply into 'buf', typically one obtained from takeReplyBuffer().
+     */
+    explicit OpMsgReplyBuilder(SharedBuffer buf) : _builder(std::move(buf)) {}
+
     ReplyBuilderInterface& setRawCommandReply(const BSONObj& reply) override {
         _builder.beginBody().appendElements(reply);
         return *this;
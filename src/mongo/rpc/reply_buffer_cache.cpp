@@ -0,0 +1,107 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+
+#include "mongo/rpc/reply_buffer_cache.h"
+
+#include <array>
+
+#include "mongo/bson/util/builder.h"
+#include "mongo/platform/bits.h"
+#include "mongo/rpc/reply_buffer_cache_gen.h"
+
+namespace mongo {
+namespace rpc {
+namespace {
+
+// One slot per power of two, which covers every capacity a message buffer can have.
+constexpr size_t kNumSizeClasses = 64;
+
+struct ReplyBufferCache {
+    std::array<SharedBuffer, kNumSizeClasses> buffers;
+    size_t cachedBytes = 0;
+
+    void clear() {
+        buffers = {};
+        cachedBytes = 0;
+    }
+};
+
+thread_local ReplyBufferCache replyBufferCache;
+
+size_t sizeClass(size_t capacity) {
+    return 63 - countLeadingZeros64(capacity);
+}
+
+}  // namespace
+
+SharedBuffer takeReplyBuffer() {
+    auto& cache = replyBufferCache;
+    if (gReplyBufferCacheMaxBytesPerThread.load() <= 0) {
+        // The cache may have been disabled at runtime; don't hold on to what it kept.
+        if (cache.cachedBytes)
+            cache.clear();
+    } else if (cache.cachedBytes) {
+        for (auto it = cache.buffers.rbegin(); it != cache.buffers.rend(); ++it) {
+            if (*it) {
+                cache.cachedBytes -= it->capacity();
+                return std::move(*it);
+            }
+        }
+    }
+    return SharedBuffer::allocate(BufBuilder::kDefaultInitSizeBytes);
+}
+
+void recycleReplyBuffer(Message msg) {
+    const auto limit = gReplyBufferCacheMaxBytesPerThread.load();
+    if (limit <= 0 || msg.empty())
+        return;
+
+    auto buf = msg.sharedBuffer();
+    msg.reset();
+    // Something else, such as the traffic recorder, still holds a reference to this message.
+    if (buf.isShared())
+        return;
+
+    auto& cache = replyBufferCache;
+    const auto capacity = buf.capacity();
+    auto& slot = cache.buffers[sizeClass(capacity)];
+    if (slot || cache.cachedBytes + capacity > static_cast<size_t>(limit))
+        return;
+
+    cache.cachedBytes += capacity;
+    slot = std::move(buf);
+}
+
+size_t cachedReplyBufferBytes() {
+    return replyBufferCache.cachedBytes;
+}
+
+}  // namespace rpc
+}  // namespace mongo
@@ -0,0 +1,68 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+
+#pragma once
+
+#include "mongo/rpc/message.h"
+#include "mongo/util/shared_buffer.h"
+
+namespace mongo {
+namespace rpc {
+
+/**
+ * A per-thread cache of buffers from replies that have already been sent, so that the next reply
+ * built on the same thread can start from a buffer that is already large enough instead of
+ * growing a fresh one by doubling. This matters for workloads that return the same large batch
+ * sizes over and over, such as getMore-heavy cursors.
+ *
+ * Buffers are kept one per power-of-two size class, and the total cached per thread is bounded
+ * by the replyBufferCacheMaxBytesPerThread server parameter. A limit of 0 disables the cache.
+ */
+
+/**
+ * Returns an unshared buffer to build a reply into. This is the largest cached buffer if there is
+ * one, and a freshly allocated default-sized buffer otherwise.
+ */
+SharedBuffer takeReplyBuffer();
+
+/**
+ * Offers the buffer of a message that has been handed to the network back to the current
+ * thread's cache. Buffers that are still referenced elsewhere, or that would push the cache over
+ * its limit, are simply released.
+ */
+void recycleReplyBuffer(Message msg);
+
+/**
+ * Returns the number of bytes cached by the current thread. Used by tests.
+ */
+size_t cachedReplyBufferBytes();
+
+}  // namespace rpc
+}  // namespace mongo
@@ -42,12 +42,14 @@
 #include "mongo/bson/json.h"
 #include "mongo/bson/oid.h"
 #include "mongo/bson/timestamp.h"
+#include "mongo/idl/server_parameter_test_util.h"
 #include "mongo/rpc/get_status_from_command_result.h"
 #include "mongo/rpc/legacy_reply.h"
 #include "mongo/rpc/legacy_reply_builder.h"
 #include "mongo/rpc/message.h"
 #include "mongo/rpc/op_msg.h"
 #include "mongo/rpc/op_msg_rpc_impls.h"
+#include "mongo/rpc/reply_buffer_cache.h"
 #include "mongo/rpc/reply_builder_interface.h"
 #include "mongo/stdx/type_traits.h"
 #include "mongo/unittest/assert.h"
@@ -198,6 +200,36 @@ TEST(OpMsgReplyBuilder, MessageOverBSONSizeLimit) {
     ASSERT_THROWS_CODE(r.done(), DBException, ErrorCodes::BSONObjectTooLarge);
 }
 
+TEST(OpMsgReplyBuilder, RecyclesSentReplyBuffers) {
+    RAIIServerParameterControllerForTest cacheLimit{"replyBufferCacheMaxBytesPerThread",
+                                                    4 * 1024 * 1024};
+    const std::string bigStr(1024 * 1024, 'a');
+
+    auto buildReply = [&](SharedBuffer buf) {
+        rpc::OpMsgReplyBuilder r(std::move(buf));
+        r.getBodyBuilder().append("field", bigStr);
+        return r.done();
+    };
+
+    auto msg = buildReply(rpc::takeReplyBuffer());
+    const auto capacity = msg.sharedBuffer().capacity();
+    const auto* data = msg.buf();
+    rpc::recycleReplyBuffer(std::move(msg));
+    ASSERT_EQ(rpc::cachedReplyBufferBytes(), capacity);
+
+    // The next reply starts from the same buffer rather than regrowing a new one.
+    auto recycled = rpc::takeReplyBuffer();
+    ASSERT_EQ(rpc::cachedReplyBufferBytes(), 0);
+    ASSERT_EQ(recycled.get(), data);
+    ASSERT_EQ(recycled.capacity(), capacity);
+
+    // A buffer that is still referenced elsewhere is not cached.
+    auto again = buildReply(std::move(recycled));
+    auto stillReferenced = again.sharedBuffer();
+    rpc::recycleReplyBuffer(std::move(again));
+    ASSERT_EQ(rpc::cachedReplyBufferBytes(), 0);
+}
+
 template <typename T>
 void testRoundTrip(rpc::ReplyBuilderInterface& replyBuilder, bool unifiedBodyAndMetadata) {
     auto metadata = buildMetadata();
@@ -94,7 +94,6 @@ AsyncRequestsSender::AsyncRequestsSender(OperationContext* opCtx,
     // Initialize command metadata to handle the read preference.
     _metadataObj = readPreference.toContainingBSON();
 
-    _remotes.reserve(requests.size());
     for (const auto& request : requests) {
         // Kick off requests immediately.
         auto designatedHostIter = designatedHostsMap.find(request.shardId);
@@ -102,8 +101,12 @@ AsyncRequestsSender::AsyncRequestsSender(OperationContext* opCtx,
             ? designatedHostIter->second
             : HostAndPort();
         _remotes
-            .emplace_back(
-                this, request.shardId, request.cmdObj, std::move(designatedHost), request.shard)
+            .emplace_back(this,
+                          _remotes.size(),
+                          request.shardId,
+                          request.cmdObj,
+                          std::move(designatedHost),
+                          request.shard)
             .executeRequest();
     }
 
@@ -192,6 +195,19 @@ void AsyncRequestsSender::stopRetrying() noexcept {
     _stopRetrying = true;
 }
 
+void AsyncRequestsSender::addRequest(const AsyncRequestsSender::Request& request) {
+    ++_remotesLeft;
+    auto& remote = _remotes.emplace_back(
+        this, _remotes.size(), request.shardId, request.cmdObj, HostAndPort(), request.shard);
+
+    if (!_interruptStatus.isOK()) {
+        _responseQueue.push(std::move(remote).makeFailedResponse(_interruptStatus));
+        return;
+    }
+
+    remote.executeRequest();
+}
+
 bool AsyncRequestsSender::done() noexcept {
     return !_remotesLeft;
 }
@@ -215,11 +231,13 @@ Status AsyncRequestsSender::Response::getEffectiveStatus(
 }
 
 AsyncRequestsSender::RemoteData::RemoteData(AsyncRequestsSender* ars,
+                                            size_t requestIndex,
                                             ShardId shardId,
                                             BSONObj cmdObj,
                                             HostAndPort designatedHostAndPort,
                                             std::shared_ptr<Shard> shard)
     : _ars(ars),
+      _requestIndex(requestIndex),
       _shardId(std::move(shardId)),
       _cmdObj(std::move(cmdObj)),
       _designatedHostAndPort(std::move(designatedHostAndPort)),
@@ -245,11 +263,15 @@ void AsyncRequestsSender::RemoteData::executeRequest() {
         .getAsync([this](StatusWith<RemoteCommandOnAnyCallbackArgs> rcr) {
             _done = true;
             if (rcr.isOK()) {
-                _ars->_responseQueue.push(
-                    {std::move(_shardId), rcr.getValue().response, std::move(_shardHostAndPort)});
+                _ars->_responseQueue.push({std::move(_shardId),
+                                           rcr.getValue().response,
+                                           std::move(_shardHostAndPort),
+                                           _requestIndex});
             } else {
-                _ars->_responseQueue.push(
-                    {std::move(_shardId), rcr.getStatus(), std::move(_shardHostAndPort)});
+                _ars->_responseQueue.push({std::move(_shardId),
+                                           rcr.getStatus(),
+                                           std::move(_shardHostAndPort),
+                                           _requestIndex});
             }
         });
 }
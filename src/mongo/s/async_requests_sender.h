@@ -33,6 +33,7 @@
 #include <boost/optional.hpp>
 #include <boost/optional/optional.hpp>
 #include <cstddef>
+#include <deque>
 #include <memory>
 #include <string>
 #include <utility>
@@ -139,6 +140,10 @@ public:
         // found or no shard hosts matching the readPreference could be found.
         boost::optional<HostAndPort> shardHostAndPort;
 
+        // The position of the request which produced this response, in the order the requests were
+        // passed to the constructor and then to addRequest().
+        size_t requestIndex = 0;
+
         /**
          * Returns the effective status of the response sent by the server.
          */
@@ -188,6 +193,17 @@ public:
      */
     void stopRetrying() noexcept;
 
+    /**
+     * Schedules an additional request on this ARS. The response for it is returned from next()
+     * like the responses for the requests passed to the constructor, and carries the next unused
+     * requestIndex. This allows callers to keep a pipeline of requests in flight, issuing a new one
+     * as soon as an earlier one has returned.
+     *
+     * If the ARS has already been interrupted, the request is not sent and its response carries the
+     * interruption status.
+     */
+    void addRequest(const AsyncRequestsSender::Request& request);
+
 private:
     /**
      * We instantiate one of these per remote host.
@@ -201,6 +217,7 @@ private:
          * Creates a new uninitialized remote state with a command to send.
          */
         RemoteData(AsyncRequestsSender* ars,
+                   size_t requestIndex,
                    ShardId shardId,
                    BSONObj cmdObj,
                    HostAndPort designatedHost,
@@ -228,7 +245,10 @@ private:
          * Extracts a failed response from the remote, given an interruption status.
          */
         Response makeFailedResponse(Status status) && {
-            return {std::move(_shardId), std::move(status), std::move(_shardHostAndPort)};
+            return {std::move(_shardId),
+                    std::move(status),
+                    std::move(_shardHostAndPort),
+                    _requestIndex};
         }
 
         /**
@@ -274,6 +294,9 @@ private:
 
         AsyncRequestsSender* const _ars;
 
+        // The position of this remote's request among all the requests sent by the ARS.
+        const size_t _requestIndex;
+
         // ShardId of the shard to which the command will be sent.
         ShardId _shardId;
 
@@ -309,8 +332,9 @@ private:
     // The policy to use when deciding whether to retry on an error.
     Shard::RetryPolicy _retryPolicy;
 
-    // Data tracking the state of our communication with each of the remote nodes.
-    std::vector<RemoteData> _remotes;
+    // Data tracking the state of our communication with each of the remote nodes. This is a deque
+    // so that requests added by addRequest() don't move the remotes whose callbacks are pending.
+    std::deque<RemoteData> _remotes;
 
     // Number of remotes we haven't returned final results from.
     size_t _remotesLeft;
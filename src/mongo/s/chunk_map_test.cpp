@@ -284,6 +284,46 @@ TEST_F(ChunkMapTest, UpdateMapNotLeaveSmallVectors) {
 }
 
 
+/*
+ * Check that an incremental update only rebuilds the chunk vectors containing the changed chunks
+ * and shares every other vector with the original map.
+ */
+TEST_F(ChunkMapTest, UpdateMapSharesUnaffectedVectors) {
+    const ChunkVersion initialVersion{{collEpoch(), collTimestamp()}, {1, 0}};
+    auto chunkVector = toChunkInfoPtrVector(
+        genChunkVector(uuid(), genRandomSplitPoints(100), initialVersion, 1 /*numShards*/));
+
+    const auto chunkBucketSize = 10;
+    const auto initialChunkMap =
+        ChunkMap(collEpoch(), collTimestamp(), chunkBucketSize).createMerged(chunkVector);
+    const auto& initialVectorMap = initialChunkMap.getChunkVectorMap();
+    ASSERT_GT(initialVectorMap.size(), 2);
+
+    auto movedVersion = initialChunkMap.getVersion();
+    movedVersion.incMajor();
+    const auto& movedChunk = chunkVector[chunkVector.size() / 2];
+    const auto chunkMap = initialChunkMap.createMerged({std::make_shared<ChunkInfo>(
+        ChunkType{uuid(), movedChunk->getRange(), movedVersion, ShardId("otherShard")})});
+
+    size_t numSharedVectors = 0;
+    for (const auto& [maxKeyString, chunkVectorPtr] : chunkMap.getChunkVectorMap()) {
+        auto initialIt = initialVectorMap.find(maxKeyString);
+        if (initialIt != initialVectorMap.end() && initialIt->second == chunkVectorPtr) {
+            ++numSharedVectors;
+        }
+    }
+
+    // At most the vector holding the moved chunk and one neighbour it may be merged with are
+    // rebuilt.
+    ASSERT_GTE(numSharedVectors, initialVectorMap.size() - 2);
+    ASSERT_EQ(chunkMap.size(), initialChunkMap.size());
+    ASSERT_EQ(chunkMap.findIntersectingChunk(movedChunk->getMin())->getShardId(),
+              ShardId("otherShard"));
+
+    // The original map must be left untouched for concurrent readers
+    validateChunkMap(initialChunkMap, chunkVector);
+}
+
 /*
  * Check that updating a ChunkMap with chunks that have mismatching timestamp fails.
  */
@@ -30,6 +30,7 @@
 #include "mongo/s/collection_routing_info_targeter.h"
 
 #include "mongo/s/transaction_router.h"
+#include <algorithm>
 #include <fmt/format.h>
 #include <memory>
 #include <string>
@@ -413,36 +414,91 @@ ShardEndpoint CollectionRoutingInfoTargeter::targetInsert(OperationContext* opCt
     }
 
     // Collection is sharded
-    const BSONObj shardKey = [&]() {
-        const auto& shardKeyPattern = _cri.cm.getShardKeyPattern();
+    const BSONObj shardKey = _extractShardKeyForInsert(doc);
+
+    // Target the shard key
+    return uassertStatusOK(_targetShardKey(shardKey, CollationSpec::kSimpleSpec, chunkRanges));
+}
+
+std::vector<StatusWith<ShardEndpoint>> CollectionRoutingInfoTargeter::targetInserts(
+    OperationContext* opCtx, const std::vector<BSONObj>& docs) const {
+    if (!_cri.cm.isSharded()) {
+        return std::vector<StatusWith<ShardEndpoint>>(docs.size(),
+                                                      targetUnshardedCollection(_nss, _cri));
+    }
+
+    std::vector<StatusWith<ShardEndpoint>> endpoints(
+        docs.size(), Status(ErrorCodes::InternalError, "Document was not targeted"));
+
+    struct KeyToTarget {
+        std::string keyString;
         BSONObj shardKey;
-        if (shardKeyPattern.hasId()) {
-            uassert(ErrorCodes::InvalidIdField,
-                    "Document is missing _id field, which is part of the shard key pattern",
-                    doc.hasField("_id"));
+        size_t docIndex;
+    };
+    std::vector<KeyToTarget> keys;
+    keys.reserve(docs.size());
+    for (size_t docIndex = 0; docIndex < docs.size(); ++docIndex) {
+        try {
+            auto shardKey = _extractShardKeyForInsert(docs[docIndex]);
+            keys.push_back({ShardKeyPattern::toKeyString(shardKey), std::move(shardKey), docIndex});
+        } catch (const DBException& ex) {
+            endpoints[docIndex] = ex.toStatus();
         }
-        if (_isRequestOnTimeseriesViewNamespace) {
-            auto tsFields = _cri.cm.getTimeseriesFields();
-            tassert(5743701, "Missing timeseriesFields on buckets collection", tsFields);
-            shardKey = extractBucketsShardKeyFromTimeseriesDoc(
-                doc, shardKeyPattern, tsFields->getTimeseriesOptions());
-        } else {
-            shardKey = shardKeyPattern.extractShardKeyFromDoc(doc);
+    }
+
+    // Visit the keys in routing table order. Consecutive keys usually fall into the same chunk,
+    // which can then be reused without another lookup.
+    std::sort(keys.begin(), keys.end(), [](const KeyToTarget& lhs, const KeyToTarget& rhs) {
+        return lhs.keyString < rhs.keyString;
+    });
+
+    boost::optional<Chunk> chunk;
+    boost::optional<ShardEndpoint> chunkEndpoint;
+    for (const auto& key : keys) {
+        if (!chunk || !chunk->containsKey(key.shardKey)) {
+            chunk.reset();
+            chunkEndpoint.reset();
+            try {
+                chunk.emplace(_cri.cm.findIntersectingChunk(key.shardKey,
+                                                            CollationSpec::kSimpleSpec));
+            } catch (const DBException& ex) {
+                endpoints[key.docIndex] = ex.toStatus();
+                continue;
+            }
+            chunkEndpoint.emplace(
+                chunk->getShardId(), _cri.getShardVersion(chunk->getShardId()), boost::none);
         }
+        endpoints[key.docIndex] = *chunkEndpoint;
+    }
 
-        // The shard key would only be empty after extraction if we encountered an error case, such
-        // as the shard key possessing an array value or array descendants. If the shard key
-        // presented to the targeter was empty, we would emplace the missing fields, and the
-        // extracted key here would *not* be empty.
-        uassert(ErrorCodes::ShardKeyNotFound,
-                "Shard key cannot contain array values or array descendants.",
-                !shardKey.isEmpty());
-        return shardKey;
-    }();
+    return endpoints;
+}
 
+BSONObj CollectionRoutingInfoTargeter::_extractShardKeyForInsert(const BSONObj& doc) const {
+    const auto& shardKeyPattern = _cri.cm.getShardKeyPattern();
+    BSONObj shardKey;
+    if (shardKeyPattern.hasId()) {
+        uassert(ErrorCodes::InvalidIdField,
+                "Document is missing _id field, which is part of the shard key pattern",
+                doc.hasField("_id"));
+    }
+    if (_isRequestOnTimeseriesViewNamespace) {
+        auto tsFields = _cri.cm.getTimeseriesFields();
+        tassert(5743701, "Missing timeseriesFields on buckets collection", tsFields);
+        shardKey = extractBucketsShardKeyFromTimeseriesDoc(
+            doc, shardKeyPattern, tsFields->getTimeseriesOptions());
+    } else {
+        shardKey = shardKeyPattern.extractShardKeyFromDoc(doc);
+    }
 
-    // Target the shard key
-    return uassertStatusOK(_targetShardKey(shardKey, CollationSpec::kSimpleSpec, chunkRanges));
+    // The shard key would only be empty after extraction if we encountered an error case, such
+    // as the shard key possessing an array value or array descendants. If the shard key
+    // presented to the targeter was empty, we would emplace the missing fields, and the
+    // extracted key here would *not* be empty.
+    uassert(ErrorCodes::ShardKeyNotFound,
+            "Shard key cannot contain array values or array descendants.",
+            !shardKey.isEmpty());
+    return shardKey;
 }
 
 bool isUpdateOneWithIdWithoutShardKeyEnabled(OperationContext* opCtx) {
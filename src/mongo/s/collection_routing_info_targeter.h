@@ -100,6 +100,14 @@ public:
                                const BSONObj& doc,
                                std::set<ChunkRange>* chunkRange = nullptr) const override;
 
+    /**
+     * Extracts the shard keys of all the documents in one pass, sorts them and resolves their
+     * owning chunks in that order, so that a routing table lookup is only made when a key falls
+     * outside of the chunk which owned the previous one.
+     */
+    std::vector<StatusWith<ShardEndpoint>> targetInserts(
+        OperationContext* opCtx, const std::vector<BSONObj>& docs) const override;
+
     /**
      * Attempts to target an update request by shard key and returns a vector of shards to target.
      *
@@ -241,6 +249,12 @@ private:
     StatusWith<std::vector<ShardEndpoint>> _targetQuery(const CanonicalQuery& query,
                                                         std::set<ChunkRange>* chunkRanges) const;
 
+    /**
+     * Returns the shard key of the document to insert 'doc', with any hashed field hashed. Throws
+     * if the document does not contain a valid shard key.
+     */
+    BSONObj _extractShardKeyForInsert(const BSONObj& doc) const;
+
     /**
      * Returns a ShardEndpoint for an exact shard key query.
      *
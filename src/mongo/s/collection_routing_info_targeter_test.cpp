@@ -1028,6 +1028,33 @@ TEST_F(CollectionRoutingInfoTargeterTest, TestRoutingWithout_id) {
                        ErrorCodes::InvalidIdField);
 }
 
+TEST_F(CollectionRoutingInfoTargeterTest, TargetInsertsMatchesTargetInsertForEachDocument) {
+    std::vector<BSONObj> splitPoints = {
+        BSON("a" << BSONNULL), BSON("a" << -100), BSON("a" << 0), BSON("a" << 100)};
+    const auto targeter = prepare(BSON("a" << 1), splitPoints);
+
+    const std::vector<BSONObj> docs = {BSON("a" << 150),
+                                       BSON("a" << -5),
+                                       BSON("a" << BSON_ARRAY(1 << 2)),
+                                       BSON("a" << 3),
+                                       BSON("b" << 1),
+                                       BSON("a" << -500),
+                                       BSON("a" << 100),
+                                       BSON("a" << 4)};
+    const auto endpoints = targeter.targetInserts(operationContext(), docs);
+    ASSERT_EQ(docs.size(), endpoints.size());
+
+    for (size_t i = 0; i < docs.size(); ++i) {
+        if (docs[i]["a"].type() == BSONType::Array) {
+            ASSERT_EQ(ErrorCodes::ShardKeyNotFound, endpoints[i].getStatus());
+            continue;
+        }
+        ASSERT_OK(endpoints[i].getStatus());
+        ASSERT_EQ(targeter.targetInsert(operationContext(), docs[i]).shardName,
+                  endpoints[i].getValue().shardName);
+    }
+}
+
 /**
  * Fixture that populates the CatalogCache with 'kNss' as an unsharded collection not tracked on the
  * configsvr, or a non-existent collection.
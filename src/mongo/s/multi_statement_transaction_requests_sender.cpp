@@ -136,4 +136,11 @@ void MultiStatementTransactionRequestsSender::stopRetrying() {
     _ars->stopRetrying();
 }
 
+void MultiStatementTransactionRequestsSender::addRequest(
+    const AsyncRequestsSender::Request& request) {
+    // The transaction, if any, was already begun or continued when the initial requests were sent.
+    auto newRequests = attachTxnDetails(_opCtx, {request}, false);
+    _ars->addRequest(newRequests.front());
+}
+
 }  // namespace mongo
@@ -69,6 +69,12 @@ public:
 
     void stopRetrying();
 
+    /**
+     * Attaches the transaction fields to 'request', if needed, and schedules it on the underlying
+     * ARS. See AsyncRequestsSender::addRequest().
+     */
+    void addRequest(const AsyncRequestsSender::Request& request);
+
 private:
     OperationContext* _opCtx;
     std::unique_ptr<AsyncRequestsSender> _ars;
@@ -31,9 +31,11 @@
 
 #include <vector>
 
+#include "mongo/base/status_with.h"
 #include "mongo/s/chunk_manager.h"
 #include "mongo/s/stale_exception.h"
 #include "mongo/s/write_ops/batched_command_request.h"
+#include "mongo/util/assert_util.h"
 
 namespace mongo {
 
@@ -82,6 +84,25 @@ public:
                                        const BSONObj& doc,
                                        std::set<ChunkRange>* chunkRanges = nullptr) const = 0;
 
+    /**
+     * Targets a batch of documents to insert, returning for each document, in input order, either
+     * its ShardEndpoint or the error targetInsert() would have thrown for it. Implementations may
+     * override this to share the routing table lookups across the whole batch.
+     */
+    virtual std::vector<StatusWith<ShardEndpoint>> targetInserts(
+        OperationContext* opCtx, const std::vector<BSONObj>& docs) const {
+        std::vector<StatusWith<ShardEndpoint>> endpoints;
+        endpoints.reserve(docs.size());
+        for (const auto& doc : docs) {
+            try {
+                endpoints.emplace_back(targetInsert(opCtx, doc));
+            } catch (const DBException& ex) {
+                endpoints.emplace_back(ex.toStatus());
+            }
+        }
+        return endpoints;
+    }
+
     /**
      * Returns a vector of ShardEndpoints for a potentially multi-shard update or throws
      * ShardKeyNotFound if 'updateOp' misses a shard key, but the type of update requires it.
@@ -43,6 +43,7 @@
 #include "mongo/bson/bsonobjbuilder.h"
 #include "mongo/bson/bsontypes.h"
 #include "mongo/bson/simple_bsonobj_comparator.h"
+#include "mongo/db/storage/key_string.h"
 #include "mongo/db/pipeline/change_stream_constants.h"
 #include "mongo/db/pipeline/change_stream_invalidation_info.h"
 #include "mongo/db/query/cursor_response.h"
@@ -126,6 +127,13 @@ AsyncResultsMerger::AsyncResultsMerger(OperationContext* opCtx,
         invariant(_params.getSessionId());
     }
 
+    if (const auto& sort = _params.getSort(); sort &&
+        internalQueryARMUseKeyStringSortedMerge.load() &&
+        static_cast<size_t>(sort->nFields()) <= Ordering::kMaxCompoundIndexKeys) {
+        _useKeyStringMerge = true;
+        _sortKeyOrdering = Ordering::make(*sort);
+    }
+
     size_t remoteIndex = 0;
     for (const auto& remote : _params.getRemotes()) {
         _remotes.emplace_back(remote.getHostAndPort(),
@@ -243,6 +251,9 @@ void AsyncResultsMerger::addNewShardCursors(std::vector<RemoteCursor>&& newCurso
                               remote.getCursorResponse().getPartialResultsReturned());
         _addBatchToBuffer(lk, newIndex, remote.getCursorResponse());
     }
+    // The loser tree has a leaf per remote, so it must be rebuilt even if the new remotes had no
+    // results to add to it yet.
+    _loserTreeNeedsRebuild = true;
 }
 
 bool AsyncResultsMerger::partialResultsReturned() const {
@@ -329,12 +340,12 @@ bool AsyncResultsMerger::_readySorted(WithLock lk) {
 }
 
 bool AsyncResultsMerger::_readySortedTailable(WithLock lk) {
-    if (_mergeQueue.empty()) {
+    auto smallestRemote = _peekSortedRemote(lk);
+    if (!smallestRemote) {
         return false;
     }
 
-    auto smallestRemote = _mergeQueue.top();
-    auto smallestResult = _remotes[smallestRemote].docBuffer.front();
+    auto smallestResult = _remotes[*smallestRemote].docBuffer.front();
     auto keyWeWantToReturn =
         extractSortKey(*smallestResult.getResult(), _params.getCompareWholeSortKey());
     // We should always have a minPromisedSortKey from every shard in the sorted tailable case.
@@ -377,28 +388,20 @@ StatusWith<ClusterQueryResult> AsyncResultsMerger::nextReady() {
     return _params.getSort() ? _nextReadySorted(lk) : _nextReadyUnsorted(lk);
 }
 
-ClusterQueryResult AsyncResultsMerger::_nextReadySorted(WithLock) {
+ClusterQueryResult AsyncResultsMerger::_nextReadySorted(WithLock lk) {
     // Tailable non-awaitData cursors cannot have a sort.
     invariant(_tailableMode != TailableModeEnum::kTailable);
 
-    if (_mergeQueue.empty()) {
+    auto peekedRemote = _peekSortedRemote(lk);
+    if (!peekedRemote) {
         return {};
     }
 
-    size_t smallestRemote = _mergeQueue.top();
-    _mergeQueue.pop();
-
+    const size_t smallestRemote = *peekedRemote;
     invariant(!_remotes[smallestRemote].docBuffer.empty());
     invariant(_remotes[smallestRemote].status.isOK());
 
-    ClusterQueryResult front = _remotes[smallestRemote].docBuffer.front();
-    _remotes[smallestRemote].docBuffer.pop();
-
-    // Re-populate the merging queue with the next result from 'smallestRemote', if it has a
-    // next result.
-    if (!_remotes[smallestRemote].docBuffer.empty()) {
-        _mergeQueue.push(smallestRemote);
-    }
+    ClusterQueryResult front = _popSortedRemoteFront(lk, smallestRemote);
 
     // For sorted tailable awaitData cursors, update the high water mark to the document's sort key.
     if (_tailableMode == TailableModeEnum::kTailableAndAwaitData) {
@@ -411,6 +414,99 @@ ClusterQueryResult AsyncResultsMerger::_nextReadySorted(WithLock) {
     return front;
 }
 
+boost::optional<size_t> AsyncResultsMerger::_peekSortedRemote(WithLock lk) {
+    if (!_useKeyStringMerge) {
+        return _mergeQueue.empty() ? boost::optional<size_t>{} : _mergeQueue.top();
+    }
+
+    if (_loserTreeNeedsRebuild) {
+        _rebuildLoserTree(lk);
+    }
+    if (_remotes.empty() || !_remotes[_loserTree[0]].hasNext()) {
+        return boost::none;
+    }
+    return _loserTree[0];
+}
+
+ClusterQueryResult AsyncResultsMerger::_popSortedRemoteFront(WithLock, size_t remoteIndex) {
+    auto& remote = _remotes[remoteIndex];
+
+    if (!_useKeyStringMerge) {
+        _mergeQueue.pop();
+
+        ClusterQueryResult front = remote.docBuffer.front();
+        remote.docBuffer.pop();
+
+        // Re-populate the merging queue with the next result from 'remoteIndex', if it has a
+        // next result.
+        if (!remote.docBuffer.empty()) {
+            _mergeQueue.push(remoteIndex);
+        }
+        return front;
+    }
+
+    invariant(!_loserTreeNeedsRebuild);
+    invariant(_loserTree[0] == remoteIndex);
+
+    ClusterQueryResult front = remote.docBuffer.front();
+    remote.docBuffer.pop();
+    remote.sortKeyBuffer.pop();
+
+    // Only the winner's key changed, so replaying the matches on the path from its leaf to the
+    // root restores the tree. If the remote ran out of buffered results it now loses every match.
+    size_t winner = remoteIndex;
+    for (size_t node = (_remotes.size() + remoteIndex) / 2; node > 0; node /= 2) {
+        if (_winsLoserTreeMatch(_loserTree[node], winner)) {
+            std::swap(_loserTree[node], winner);
+        }
+    }
+    _loserTree[0] = winner;
+    return front;
+}
+
+void AsyncResultsMerger::_addSortedRemote(WithLock, size_t remoteIndex) {
+    if (!_useKeyStringMerge) {
+        _mergeQueue.push(remoteIndex);
+        return;
+    }
+    _loserTreeNeedsRebuild = true;
+}
+
+bool AsyncResultsMerger::_winsLoserTreeMatch(size_t lhs, size_t rhs) const {
+    const auto& left = _remotes[lhs].sortKeyBuffer;
+    const auto& right = _remotes[rhs].sortKeyBuffer;
+    if (left.empty() || right.empty()) {
+        return !left.empty() || (right.empty() && lhs < rhs);
+    }
+
+    const int cmp = left.front().compare(right.front());
+    return cmp < 0 || (cmp == 0 && lhs < rhs);
+}
+
+void AsyncResultsMerger::_rebuildLoserTree(WithLock) {
+    const size_t numRemotes = _remotes.size();
+    _loserTree.assign(std::max(numRemotes, size_t{1}), 0);
+    _loserTreeNeedsRebuild = false;
+    if (numRemotes <= 1) {
+        return;
+    }
+
+    // Play the tournament bottom-up, keeping the winner of each internal node in 'winners' so the
+    // parent can play it. Leaf nodes are numbered [numRemotes, 2 * numRemotes).
+    std::vector<size_t> winners(2 * numRemotes);
+    for (size_t remoteIndex = 0; remoteIndex < numRemotes; ++remoteIndex) {
+        winners[numRemotes + remoteIndex] = remoteIndex;
+    }
+    for (size_t node = numRemotes - 1; node > 0; --node) {
+        const size_t left = winners[2 * node];
+        const size_t right = winners[2 * node + 1];
+        const bool leftWins = _winsLoserTreeMatch(left, right);
+        winners[node] = leftWins ? left : right;
+        _loserTree[node] = leftWins ? right : left;
+    }
+    _loserTree[0] = winners[1];
+}
+
 ClusterQueryResult AsyncResultsMerger::_nextReadyUnsorted(WithLock) {
     size_t remotesAttempted = 0;
     while (remotesAttempted < _remotes.size()) {
@@ -512,6 +608,32 @@ Status AsyncResultsMerger::scheduleGetMores() {
     return _scheduleGetMores(lk);
 }
 
+void AsyncResultsMerger::prefetchNextBatches() {
+    stdx::lock_guard<Latch> lk(_mutex);
+    invariant(_opCtx, "Cannot prefetch without an OperationContext");
+
+    if (_lifecycleState != kAlive || _tailableMode != TailableModeEnum::kNormal ||
+        !_opCtx->checkForInterruptNoAssert().isOK()) {
+        return;
+    }
+
+    for (const auto& remote : _remotes) {
+        if (!remote.status.isOK() || remote.invalidated) {
+            return;
+        }
+    }
+
+    for (size_t i = 0; i < _remotes.size(); ++i) {
+        auto& remote = _remotes[i];
+        if (!remote.hasNext() && !remote.exhausted() && !remote.cbHandle.isValid()) {
+            // A failure to schedule is surfaced when the client next asks for results.
+            if (!_askForNextBatch(lk, i).isOK()) {
+                return;
+            }
+        }
+    }
+}
+
 Status AsyncResultsMerger::_scheduleGetMores(WithLock lk) {
     // Before scheduling more work, check whether the cursor has been invalidated.
     _assertNotInvalidated(lk);
@@ -767,6 +889,9 @@ void AsyncResultsMerger::_cleanUpFailedBatch(WithLock lk, Status status, size_t
         remote.partialResultsReturned = (remote.status != ErrorCodes::ExchangePassthrough);
         std::queue<ClusterQueryResult> emptyBuffer;
         std::swap(remote.docBuffer, emptyBuffer);
+        std::queue<key_string::Value> emptySortKeyBuffer;
+        std::swap(remote.sortKeyBuffer, emptySortKeyBuffer);
+        _loserTreeNeedsRebuild = true;
         remote.status = Status::OK();
         remote.cursorId = 0;
     }
@@ -844,6 +969,15 @@ bool AsyncResultsMerger::_addBatchToBuffer(WithLock lk,
             }
         }
 
+        if (_useKeyStringMerge) {
+            // Encode the sort key once here so that merging only needs to compare bytes.
+            key_string::Builder sortKeyBuilder(
+                key_string::Version::kLatestVersion,
+                extractSortKey(obj, _params.getCompareWholeSortKey()),
+                _sortKeyOrdering);
+            remote.sortKeyBuffer.push(sortKeyBuilder.getValueCopy());
+        }
+
         ClusterQueryResult result(obj, remote.shardId);
         remote.docBuffer.push(result);
         ++remote.fetchedCount;
@@ -852,7 +986,7 @@ bool AsyncResultsMerger::_addBatchToBuffer(WithLock lk,
     // If we're doing a sorted merge, then we have to make sure to put this remote onto the merge
     // queue.
     if (_params.getSort() && !response.getBatch().empty()) {
-        _mergeQueue.push(remoteIndex);
+        _addSortedRemote(lk, remoteIndex);
     }
     return true;
 }
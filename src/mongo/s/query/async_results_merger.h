@@ -44,6 +44,7 @@
 #include "mongo/base/status_with.h"
 #include "mongo/base/string_data.h"
 #include "mongo/bson/bsonobj.h"
+#include "mongo/bson/ordering.h"
 #include "mongo/db/cursor_id.h"
 #include "mongo/db/namespace_string.h"
 #include "mongo/db/operation_context.h"
@@ -51,6 +52,7 @@
 #include "mongo/db/query/query_stats/data_bearing_node_metrics.h"
 #include "mongo/db/query/tailable_mode_gen.h"
 #include "mongo/db/shard_id.h"
+#include "mongo/db/storage/key_string.h"
 #include "mongo/executor/task_executor.h"
 #include "mongo/platform/mutex.h"
 #include "mongo/s/query/async_results_merger_params_gen.h"
@@ -221,6 +223,17 @@ public:
      */
     Status scheduleGetMores();
 
+    /**
+     * Speculatively schedules a getMore on each remote whose buffer is empty, so that the next
+     * batch is already on its way once the caller detaches and the client asks for more results.
+     * Does nothing for tailable cursors, if any remote has failed or has been invalidated, or if
+     * the attached operation has been interrupted; those cases are left to the next call to
+     * nextEvent(). Errors from scheduling the requests are recorded like those of any getMore.
+     *
+     * It is illegal to call this method if the ARM is not attached to an OperationContext.
+     */
+    void prefetchNextBatches();
+
     /**
      * Adds the specified shard cursors to the set of cursors to be merged.  The results from the
      * new cursors will be returned as normal through nextReady().
@@ -337,6 +350,10 @@ private:
         // The buffer of results that have been retrieved but not yet returned to the caller.
         std::queue<ClusterQueryResult> docBuffer;
 
+        // The KeyString encodings of the sort keys of the results in 'docBuffer', in the same
+        // order. Only populated when the merger compares KeyString sort keys.
+        std::queue<key_string::Value> sortKeyBuffer;
+
         // Is valid if there is currently a pending request to this remote.
         executor::TaskExecutor::CallbackHandle cbHandle;
 
@@ -425,6 +442,42 @@ private:
     ClusterQueryResult _nextReadySorted(WithLock);
     ClusterQueryResult _nextReadyUnsorted(WithLock);
 
+    //
+    // Helpers for the sorted merge. These dispatch to either '_mergeQueue' or '_loserTree'
+    // depending on '_useKeyStringMerge'.
+    //
+
+    /**
+     * Returns the index of the remote holding the next result in sort order, or boost::none if no
+     * remote has buffered results.
+     */
+    boost::optional<size_t> _peekSortedRemote(WithLock);
+
+    /**
+     * Removes and returns the front result buffered on 'remoteIndex', which must be the remote
+     * returned by the last call to _peekSortedRemote(), and restores the merge order.
+     */
+    ClusterQueryResult _popSortedRemoteFront(WithLock, size_t remoteIndex);
+
+    /**
+     * Records that a new batch was buffered for 'remoteIndex'.
+     */
+    void _addSortedRemote(WithLock, size_t remoteIndex);
+
+    /**
+     * Returns true if the front result buffered on remote 'lhs' wins a match against the front
+     * result of remote 'rhs' in the loser tree. A remote without buffered results loses against
+     * every remote that has some; ties go to the lower remote index.
+     */
+    bool _winsLoserTreeMatch(size_t lhs, size_t rhs) const;
+
+    /**
+     * Replays every match of the loser tree. Needed when a remote which previously had no
+     * buffered results receives a batch, since that can change the outcome of matches outside the
+     * current winner's path.
+     */
+    void _rebuildLoserTree(WithLock);
+
     using CbData = executor::TaskExecutor::RemoteCommandCallbackArgs;
     using CbResponse = executor::TaskExecutor::ResponseStatus;
 
@@ -536,6 +589,24 @@ private:
     // next document to return, according to the sort order. Used only if there is a sort.
     std::priority_queue<size_t, std::vector<size_t>, MergingComparator> _mergeQueue;
 
+    // Set if the sort keys of buffered results are converted to KeyStrings once, when the batch
+    // arrives, and merged with '_loserTree' instead of '_mergeQueue'. This replaces the BSON sort
+    // key comparisons made on every pop with memcmp-style comparisons, and bounds the number of
+    // comparisons per returned result to log2 of the number of remotes.
+    bool _useKeyStringMerge = false;
+
+    // The ordering used to encode sort keys as KeyStrings. Only meaningful if '_useKeyStringMerge'.
+    Ordering _sortKeyOrdering = Ordering::make(BSONObj());
+
+    // Loser tree over the indexes in '_remotes'. Entry 0 holds the overall winner, that is the
+    // remote with the smallest next sort key. Entry i, for i in [1, _remotes.size()), holds the
+    // loser of the match played at internal node i, whose children are nodes 2i and 2i + 1; leaf
+    // nodes are numbered _remotes.size() + remoteIndex. Only used if '_useKeyStringMerge'.
+    std::vector<size_t> _loserTree;
+
+    // Set when the loser tree must be fully rebuilt before its winner can be used.
+    bool _loserTreeNeedsRebuild = true;
+
     // The index into '_remotes' for the remote from which we are currently retrieving results.
     // Used only if there is *not* a sort.
     size_t _gettingFromRemote = 0;
@@ -58,6 +58,7 @@
 #include "mongo/executor/network_test_env.h"
 #include "mongo/executor/remote_command_request.h"
 #include "mongo/executor/task_executor.h"
+#include "mongo/idl/server_parameter_test_util.h"
 #include "mongo/s/catalog/type_shard.h"
 #include "mongo/s/client/shard_registry.h"
 #include "mongo/s/query/async_results_merger.h"
@@ -468,6 +469,138 @@ TEST_F(AsyncResultsMergerTest, CompoundSortKey) {
     ASSERT_TRUE(unittest::assertGet(arm->nextReady()).isEOF());
 }
 
+TEST_F(AsyncResultsMergerTest, CompoundSortKeyWithKeyStringMerge) {
+    RAIIServerParameterControllerForTest keyStringMerge("internalQueryARMUseKeyStringSortedMerge",
+                                                        true);
+    BSONObj findCmd = fromjson("{find: 'testcoll', sort: {a: -1, b: 1}}");
+    std::vector<RemoteCursor> cursors;
+    cursors.push_back(
+        makeRemoteCursor(kTestShardIds[0], kTestShardHosts[0], CursorResponse(kTestNss, 5, {})));
+    cursors.push_back(
+        makeRemoteCursor(kTestShardIds[1], kTestShardHosts[1], CursorResponse(kTestNss, 6, {})));
+    cursors.push_back(
+        makeRemoteCursor(kTestShardIds[2], kTestShardHosts[2], CursorResponse(kTestNss, 7, {})));
+    auto arm = makeARMFromExistingCursors(std::move(cursors), findCmd);
+
+    // Schedule requests.
+    ASSERT_FALSE(arm->ready());
+    auto readyEvent = unittest::assertGet(arm->nextEvent());
+    ASSERT_FALSE(arm->ready());
+
+    // Deliver responses mixing value types, which must be ordered as in a BSON comparison.
+    std::vector<CursorResponse> responses;
+    std::vector<BSONObj> batch1 = {fromjson("{$sortKey: ['a', 9]}"),
+                                   fromjson("{$sortKey: [4, 20]}")};
+    responses.emplace_back(kTestNss, CursorId(0), batch1);
+    std::vector<BSONObj> batch2 = {fromjson("{$sortKey: [10, 11]}"),
+                                   fromjson("{$sortKey: [4, 4]}"),
+                                   fromjson("{$sortKey: [null, 1]}")};
+    responses.emplace_back(kTestNss, CursorId(0), batch2);
+    std::vector<BSONObj> batch3 = {fromjson("{$sortKey: [10, 12]}"),
+                                   fromjson("{$sortKey: [4.5, 9]}")};
+    responses.emplace_back(kTestNss, CursorId(0), batch3);
+    scheduleNetworkResponses(std::move(responses));
+    executor()->waitForEvent(readyEvent);
+
+    // ARM returns all results in sorted order.
+    ASSERT_TRUE(arm->ready());
+    ASSERT_TRUE(arm->remotesExhausted());
+    for (auto&& expected : {"{$sortKey: ['a', 9]}",
+                            "{$sortKey: [10, 11]}",
+                            "{$sortKey: [10, 12]}",
+                            "{$sortKey: [4.5, 9]}",
+                            "{$sortKey: [4, 4]}",
+                            "{$sortKey: [4, 20]}",
+                            "{$sortKey: [null, 1]}"}) {
+        ASSERT_TRUE(arm->ready());
+        ASSERT_BSONOBJ_EQ(fromjson(expected), *unittest::assertGet(arm->nextReady()).getResult());
+    }
+
+    // After returning all the buffered results, the ARM returns EOF immediately because all shards
+    // cursors were exhausted.
+    ASSERT_TRUE(arm->ready());
+    ASSERT_TRUE(unittest::assertGet(arm->nextReady()).isEOF());
+}
+
+TEST_F(AsyncResultsMergerTest, KeyStringMergeAfterAddingShardWithEmptyFirstBatch) {
+    RAIIServerParameterControllerForTest keyStringMerge("internalQueryARMUseKeyStringSortedMerge",
+                                                        true);
+    BSONObj findCmd = fromjson("{find: 'testcoll', sort: {_id: 1}}");
+    std::vector<RemoteCursor> cursors;
+    cursors.push_back(
+        makeRemoteCursor(kTestShardIds[0], kTestShardHosts[0], CursorResponse(kTestNss, 5, {})));
+    cursors.push_back(
+        makeRemoteCursor(kTestShardIds[1], kTestShardHosts[1], CursorResponse(kTestNss, 6, {})));
+    auto arm = makeARMFromExistingCursors(std::move(cursors), findCmd);
+
+    ASSERT_FALSE(arm->ready());
+    auto readyEvent = unittest::assertGet(arm->nextEvent());
+    ASSERT_FALSE(arm->ready());
+
+    std::vector<CursorResponse> responses;
+    std::vector<BSONObj> batch1 = {fromjson("{_id: 1, $sortKey: [1]}"),
+                                   fromjson("{_id: 4, $sortKey: [4]}")};
+    responses.emplace_back(kTestNss, CursorId(5), batch1);
+    std::vector<BSONObj> batch2 = {fromjson("{_id: 2, $sortKey: [2]}")};
+    responses.emplace_back(kTestNss, CursorId(6), batch2);
+    scheduleNetworkResponses(std::move(responses));
+    executor()->waitForEvent(readyEvent);
+
+    // Returning the first result builds the loser tree over the two remotes.
+    ASSERT_TRUE(arm->ready());
+    ASSERT_BSONOBJ_EQ(fromjson("{_id: 1, $sortKey: [1]}"),
+                      *unittest::assertGet(arm->nextReady()).getResult());
+
+    // Add a shard whose first batch is empty. Its getMore returns no results either, so nothing is
+    // added to the tree before the next result is returned.
+    std::vector<RemoteCursor> newCursors;
+    newCursors.push_back(
+        makeRemoteCursor(kTestShardIds[2], kTestShardHosts[2], CursorResponse(kTestNss, 7, {})));
+    arm->addNewShardCursors(std::move(newCursors));
+    ASSERT_FALSE(arm->ready());
+    readyEvent = unittest::assertGet(arm->nextEvent());
+    responses.clear();
+    responses.emplace_back(kTestNss, CursorId(0), std::vector<BSONObj>{});
+    scheduleNetworkResponses(std::move(responses));
+    executor()->waitForEvent(readyEvent);
+
+    ASSERT_TRUE(arm->ready());
+    ASSERT_BSONOBJ_EQ(fromjson("{_id: 2, $sortKey: [2]}"),
+                      *unittest::assertGet(arm->nextReady()).getResult());
+
+    // The second shard returns its last batch.
+    ASSERT_FALSE(arm->ready());
+    readyEvent = unittest::assertGet(arm->nextEvent());
+    responses.clear();
+    std::vector<BSONObj> batch3 = {fromjson("{_id: 3, $sortKey: [3]}")};
+    responses.emplace_back(kTestNss, CursorId(0), batch3);
+    scheduleNetworkResponses(std::move(responses));
+    executor()->waitForEvent(readyEvent);
+
+    ASSERT_TRUE(arm->ready());
+    ASSERT_BSONOBJ_EQ(fromjson("{_id: 3, $sortKey: [3]}"),
+                      *unittest::assertGet(arm->nextReady()).getResult());
+    ASSERT_TRUE(arm->ready());
+    ASSERT_BSONOBJ_EQ(fromjson("{_id: 4, $sortKey: [4]}"),
+                      *unittest::assertGet(arm->nextReady()).getResult());
+
+    // The first shard returns its last batch.
+    ASSERT_FALSE(arm->ready());
+    readyEvent = unittest::assertGet(arm->nextEvent());
+    responses.clear();
+    std::vector<BSONObj> batch4 = {fromjson("{_id: 5, $sortKey: [5]}")};
+    responses.emplace_back(kTestNss, CursorId(0), batch4);
+    scheduleNetworkResponses(std::move(responses));
+    executor()->waitForEvent(readyEvent);
+
+    ASSERT_TRUE(arm->ready());
+    ASSERT_TRUE(arm->remotesExhausted());
+    ASSERT_BSONOBJ_EQ(fromjson("{_id: 5, $sortKey: [5]}"),
+                      *unittest::assertGet(arm->nextReady()).getResult());
+    ASSERT_TRUE(arm->ready());
+    ASSERT_TRUE(unittest::assertGet(arm->nextReady()).isEOF());
+}
+
 TEST_F(AsyncResultsMergerTest, SortedButNoSortKey) {
     BSONObj findCmd = fromjson("{find: 'testcoll', sort: {a: -1, b: 1}}");
     std::vector<RemoteCursor> cursors;
@@ -2204,6 +2337,52 @@ TEST_F(AsyncResultsMergerTest, ShouldNotScheduleGetMoresWithoutAnOperationContex
     killFuture.wait();
 }
 
+TEST_F(AsyncResultsMergerTest, PrefetchNextBatchesSchedulesGetMoresForEmptyRemotes) {
+    std::vector<RemoteCursor> cursors;
+    cursors.push_back(makeRemoteCursor(
+        kTestShardIds[0], kTestShardHosts[0], CursorResponse(kTestNss, 5, {fromjson("{_id: 1}")})));
+    cursors.push_back(
+        makeRemoteCursor(kTestShardIds[1], kTestShardHosts[1], CursorResponse(kTestNss, 6, {})));
+    auto arm = makeARMFromExistingCursors(std::move(cursors));
+
+    // Only the remote without buffered results is asked for its next batch.
+    arm->prefetchNextBatches();
+    ASSERT_TRUE(networkHasReadyRequests());
+    {
+        std::vector<CursorResponse> responses;
+        std::vector<BSONObj> batch = {fromjson("{_id: 2}")};
+        responses.emplace_back(kTestNss, CursorId(0), batch);
+        scheduleNetworkResponses(std::move(responses));
+    }
+    ASSERT_FALSE(networkHasReadyRequests());
+
+    // Prefetching again does not issue a request for a remote which still has buffered results.
+    arm->prefetchNextBatches();
+    ASSERT_FALSE(networkHasReadyRequests());
+
+    ASSERT_TRUE(arm->ready());
+    ASSERT_BSONOBJ_EQ(fromjson("{_id: 1}"), *unittest::assertGet(arm->nextReady()).getResult());
+    ASSERT_TRUE(arm->ready());
+    ASSERT_BSONOBJ_EQ(fromjson("{_id: 2}"), *unittest::assertGet(arm->nextReady()).getResult());
+
+    auto killFuture = arm->kill(operationContext());
+    killFuture.wait();
+}
+
+TEST_F(AsyncResultsMergerTest, PrefetchNextBatchesDoesNothingForTailableCursors) {
+    BSONObj findCmd = fromjson("{find: 'testcoll', tailable: true}");
+    std::vector<RemoteCursor> cursors;
+    cursors.push_back(
+        makeRemoteCursor(kTestShardIds[0], kTestShardHosts[0], CursorResponse(kTestNss, 123, {})));
+    auto arm = makeARMFromExistingCursors(std::move(cursors), findCmd);
+
+    arm->prefetchNextBatches();
+    ASSERT_FALSE(networkHasReadyRequests());
+
+    auto killFuture = arm->kill(operationContext());
+    killFuture.wait();
+}
+
 TEST_F(AsyncResultsMergerTest, IncludeQueryStatsMetricsIncludedInGetMore) {
     auto runGetMore = [this](bool requestParams) {
         BSONObj findCmd = fromjson("{find: 'testcoll', sort: {_id: 1}}");
@@ -80,6 +80,10 @@ public:
         _arm.detachFromOperationContext();
     }
 
+    void prefetchNextBatches() {
+        _arm.prefetchNextBatches();
+    }
+
     bool remotesExhausted() const {
         return _arm.remotesExhausted();
     }
@@ -43,6 +43,7 @@
 #include "mongo/db/query/tailable_mode_gen.h"
 #include "mongo/db/service_context.h"
 #include "mongo/s/query/async_results_merger.h"
+#include "mongo/s/query/cluster_query_knobs_gen.h"
 #include "mongo/s/query/router_stage_limit.h"
 #include "mongo/s/query/router_stage_merge.h"
 #include "mongo/s/query/router_stage_remove_metadata_fields.h"
@@ -170,6 +171,13 @@ void ClusterClientCursorImpl::reattachToOperationContext(OperationContext* opCtx
 }
 
 void ClusterClientCursorImpl::detachFromOperationContext() {
+    // The cursor is detached once a batch has been returned to the client. Ask the shards for the
+    // next batch now rather than when the client's getMore arrives. Cursors of a transaction are
+    // left alone, since their getMores must run as part of the transaction's next statement.
+    if (internalQueryRouterPrefetchNextBatch.load() && !isTailable() && !getTxnNumber() &&
+        _opCtx) {
+        _root->prefetchNextBatch();
+    }
     _opCtx = nullptr;
     _root->detachFromOperationContext();
 }
@@ -43,6 +43,7 @@
 #include "mongo/db/namespace_string.h"
 #include "mongo/db/service_context.h"
 #include "mongo/db/service_context_test_fixture.h"
+#include "mongo/idl/server_parameter_test_util.h"
 #include "mongo/s/query/cluster_client_cursor_impl.h"
 #include "mongo/s/query/router_stage_mock.h"
 #include "mongo/unittest/assert.h"
@@ -380,6 +381,46 @@ TEST_F(ClusterClientCursorImplTest, ShouldStoreLSIDIfSetOnOpCtx) {
     }
 }
 
+TEST_F(ClusterClientCursorImplTest, PrefetchesNextBatchOnDetach) {
+    RAIIServerParameterControllerForTest prefetch("internalQueryRouterPrefetchNextBatch", true);
+    auto mockStage = std::make_unique<RouterStageMock>(_opCtx.get());
+    auto mockStagePtr = mockStage.get();
+
+    ClusterClientCursorImpl cursor(
+        _opCtx.get(),
+        std::move(mockStage),
+        ClusterClientCursorParams(NamespaceString::createNamespaceString_forTest("unused"),
+                                  APIParameters(),
+                                  boost::none /* ReadPreferenceSetting */,
+                                  boost::none /* repl::ReadConcernArgs */,
+                                  OperationSessionInfoFromClient()),
+        boost::none);
+
+    cursor.detachFromOperationContext();
+    ASSERT_EQ(1, mockStagePtr->getPrefetchCount());
+}
+
+TEST_F(ClusterClientCursorImplTest, DoesNotPrefetchNextBatchInTransaction) {
+    RAIIServerParameterControllerForTest prefetch("internalQueryRouterPrefetchNextBatch", true);
+    auto mockStage = std::make_unique<RouterStageMock>(_opCtx.get());
+    auto mockStagePtr = mockStage.get();
+
+    const auto lsid = makeLogicalSessionIdForTest();
+    const TxnNumber txnNumber = 5;
+    ClusterClientCursorImpl cursor(
+        _opCtx.get(),
+        std::move(mockStage),
+        ClusterClientCursorParams(NamespaceString::createNamespaceString_forTest("unused"),
+                                  APIParameters(),
+                                  boost::none /* ReadPreferenceSetting */,
+                                  boost::none /* repl::ReadConcernArgs */,
+                                  OperationSessionInfoFromClient{lsid, txnNumber}),
+        lsid);
+
+    cursor.detachFromOperationContext();
+    ASSERT_EQ(0, mockStagePtr->getPrefetchCount());
+}
+
 TEST_F(ClusterClientCursorImplTest, ShouldStoreAPIParameters) {
     auto mockStage = std::make_unique<RouterStageMock>(_opCtx.get());
 
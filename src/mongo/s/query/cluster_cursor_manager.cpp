@@ -159,13 +159,15 @@ ClusterCursorManager::ClusterCursorManager(ClockSource* clockSource)
 }
 
 ClusterCursorManager::~ClusterCursorManager() {
-    invariant(_cursorEntryMap.empty());
+    for (auto&& partition : _partitions) {
+        invariant(partition->cursorEntryMap.empty());
+    }
 }
 
 void ClusterCursorManager::shutdown(OperationContext* opCtx) {
     {
-        stdx::lock_guard<Latch> lk(_mutex);
-        _inShutdown = true;
+        stdx::lock_guard<Latch> lk(_registrationMutex);
+        _inShutdown.store(true);
     }
     killAllCursors(opCtx);
 }
@@ -180,10 +182,10 @@ StatusWith<CursorId> ClusterCursorManager::registerCursor(
     // Read the clock out of the lock.
     const auto now = _clockSource->now();
 
-    stdx::unique_lock<Latch> lk(_mutex);
+    stdx::unique_lock<Latch> registrationLk(_registrationMutex);
 
-    if (_inShutdown) {
-        lk.unlock();
+    if (_inShutdown.load()) {
+        registrationLk.unlock();
         cursor->kill(opCtx);
         return Status(ErrorCodes::ShutdownInProgress,
                       "Cannot register new cursors as we are in the process of shutting down");
@@ -193,19 +195,28 @@ StatusWith<CursorId> ClusterCursorManager::registerCursor(
     cursor->setLeftoverMaxTimeMicros(opCtx->getRemainingMaxTimeMicros());
 
     auto cursorId = generic_cursor::allocateCursorId(
-        [&](CursorId cursorId) -> bool { return _cursorEntryMap.count(cursorId) == 0; },
+        [&](CursorId cursorId) -> bool {
+            // It is safe to release the partition latch before inserting the cursor, as only
+            // registration adds cursors and we still hold '_registrationMutex'.
+            auto& partition = _getPartition(cursorId);
+            stdx::lock_guard<Latch> lk(partition.mutex);
+            return partition.cursorEntryMap.count(cursorId) == 0;
+        },
         _pseudoRandom);
 
-    // Create a new CursorEntry and register it in the CursorEntryContainer's map.
-    auto emplaceResult = _cursorEntryMap.emplace(cursorId,
-                                                 CursorEntry(std::move(cursor),
-                                                             cursorType,
-                                                             cursorLifetime,
-                                                             now,
-                                                             authenticatedUser,
-                                                             opCtx->getClient()->getUUID(),
-                                                             opCtx->getOperationKey(),
-                                                             nss));
+    // Create a new CursorEntry and register it in its partition's map.
+    auto& partition = _getPartition(cursorId);
+    stdx::lock_guard<Latch> lk(partition.mutex);
+    auto emplaceResult =
+        partition.cursorEntryMap.emplace(cursorId,
+                                         CursorEntry(std::move(cursor),
+                                                     cursorType,
+                                                     cursorLifetime,
+                                                     now,
+                                                     authenticatedUser,
+                                                     opCtx->getClient()->getUUID(),
+                                                     opCtx->getOperationKey(),
+                                                     nss));
     invariant(emplaceResult.second);
 
     return cursorId;
@@ -217,13 +228,13 @@ StatusWith<ClusterCursorManager::PinnedCursor> ClusterCursorManager::checkOutCur
     AuthzCheckFn authChecker,
     AuthCheck checkSessionAuth) {
 
-    stdx::lock_guard<Latch> lk(_mutex);
-
-    if (_inShutdown) {
+    if (_inShutdown.load()) {
         return Status(ErrorCodes::ShutdownInProgress,
                       "Cannot check out cursor as we are in the process of shutting down");
     }
 
+    stdx::lock_guard<Latch> lk(_getPartition(cursorId).mutex);
+
     CursorEntry* entry = _getEntry(lk, cursorId);
     if (!entry) {
         return cursorNotFoundStatus(cursorId);
@@ -280,7 +291,7 @@ void ClusterCursorManager::checkInCursor(std::unique_ptr<ClusterClientCursor> cu
     cursor->detachFromOperationContext();
     cursor->setLastUseDate(now);
 
-    stdx::unique_lock<Latch> lk(_mutex);
+    stdx::unique_lock<Latch> lk(_getPartition(cursorId).mutex);
 
     CursorEntry* entry = _getEntry(lk, cursorId);
     invariant(entry);
@@ -304,7 +315,7 @@ void ClusterCursorManager::checkInCursor(std::unique_ptr<ClusterClientCursor> cu
 Status ClusterCursorManager::checkAuthForKillCursors(OperationContext* opCtx,
                                                      CursorId cursorId,
                                                      AuthzCheckFn authChecker) {
-    stdx::lock_guard<Latch> lk(_mutex);
+    stdx::lock_guard<Latch> lk(_getPartition(cursorId).mutex);
     auto entry = _getEntry(lk, cursorId);
 
     if (!entry) {
@@ -330,7 +341,7 @@ void ClusterCursorManager::killOperationUsingCursor(WithLock, CursorEntry* entry
 Status ClusterCursorManager::killCursor(OperationContext* opCtx, CursorId cursorId) {
     invariant(opCtx);
 
-    stdx::unique_lock<Latch> lk(_mutex);
+    stdx::unique_lock<Latch> lk(_getPartition(cursorId).mutex);
 
     CursorEntry* entry = _getEntry(lk, cursorId);
     if (!entry) {
@@ -387,8 +398,7 @@ std::size_t ClusterCursorManager::killMortalCursorsInactiveSince(OperationContex
             return res;
         });
 
-    stdx::lock_guard<Latch> lk(_mutex);
-    _cursorsTimedOut += cursorsKilled;
+    _cursorsTimedOut.fetchAndAdd(cursorsKilled);
 
     return cursorsKilled;
 }
@@ -400,38 +410,43 @@ void ClusterCursorManager::killAllCursors(OperationContext* opCtx) {
 std::size_t ClusterCursorManager::killCursorsSatisfying(
     OperationContext* opCtx, const std::function<bool(CursorId, const CursorEntry&)>& pred) {
     invariant(opCtx);
-    stdx::unique_lock<Latch> lk(_mutex);
     std::size_t nKilled = 0;
 
+    // Lock and inspect one partition at a time in order to avoid stalling pins of cursors in the
+    // other partitions. Cursors registered while iterating may not be considered.
     std::vector<ClusterClientCursorGuard> cursorsToDestroy;
-    auto cursorIdEntryIt = _cursorEntryMap.begin();
-    while (cursorIdEntryIt != _cursorEntryMap.end()) {
-        auto cursorId = cursorIdEntryIt->first;
-        auto& entry = cursorIdEntryIt->second;
-
-        if (!pred(cursorId, entry)) {
-            ++cursorIdEntryIt;
-            continue;
-        }
+    for (auto&& partition : _partitions) {
+        stdx::lock_guard<Latch> lk(partition->mutex);
+        auto& cursorEntryMap = partition->cursorEntryMap;
+
+        auto cursorIdEntryIt = cursorEntryMap.begin();
+        while (cursorIdEntryIt != cursorEntryMap.end()) {
+            auto cursorId = cursorIdEntryIt->first;
+            auto& entry = cursorIdEntryIt->second;
+
+            if (!pred(cursorId, entry)) {
+                ++cursorIdEntryIt;
+                continue;
+            }
 
-        ++nKilled;
+            ++nKilled;
 
-        if (entry.getOperationUsingCursor()) {
-            // Mark the OperationContext using the cursor as killed, and move on.
-            killOperationUsingCursor(lk, &entry);
-            ++cursorIdEntryIt;
-            continue;
-        }
+            if (entry.getOperationUsingCursor()) {
+                // Mark the OperationContext using the cursor as killed, and move on.
+                killOperationUsingCursor(lk, &entry);
+                ++cursorIdEntryIt;
+                continue;
+            }
 
-        cursorsToDestroy.push_back(entry.releaseCursor(opCtx));
+            cursorsToDestroy.push_back(entry.releaseCursor(opCtx));
 
-        // Destroy the entry and set the iterator to the next element.
-        _cursorEntryMap.erase(cursorIdEntryIt++);
+            // Destroy the entry and set the iterator to the next element.
+            cursorEntryMap.erase(cursorIdEntryIt++);
+        }
     }
 
     // Ensure cursors are killed outside the lock, as killing may require waiting for callbacks to
     // finish.
-    lk.unlock();
 
     for (auto&& cursorGuard : cursorsToDestroy) {
         invariant(cursorGuard);
@@ -442,45 +457,48 @@ std::size_t ClusterCursorManager::killCursorsSatisfying(
 }
 
 size_t ClusterCursorManager::cursorsTimedOut() const {
-    stdx::lock_guard<Latch> lk(_mutex);
-    return _cursorsTimedOut;
+    return _cursorsTimedOut.load();
 }
 
 auto ClusterCursorManager::getOpenCursorStats() const -> OpenCursorStats {
     OpenCursorStats stats{};
-    stdx::lock_guard lk(_mutex);
-    for (auto&& [cursorId, entry] : _cursorEntryMap) {
-        if (entry.isKillPending())
-            continue;
-        if (entry.getOperationUsingCursor())
-            ++stats.pinned;
-        switch (entry.getCursorType()) {
-            case CursorType::SingleTarget:
-                ++stats.singleTarget;
-                break;
-            case CursorType::MultiTarget:
-                ++stats.multiTarget;
-                break;
-            case CursorType::QueuedData:
-                ++stats.queuedData;
-                break;
+    for (auto&& partition : _partitions) {
+        stdx::lock_guard lk(partition->mutex);
+        for (auto&& [cursorId, entry] : partition->cursorEntryMap) {
+            if (entry.isKillPending())
+                continue;
+            if (entry.getOperationUsingCursor())
+                ++stats.pinned;
+            switch (entry.getCursorType()) {
+                case CursorType::SingleTarget:
+                    ++stats.singleTarget;
+                    break;
+                case CursorType::MultiTarget:
+                    ++stats.multiTarget;
+                    break;
+                case CursorType::QueuedData:
+                    ++stats.queuedData;
+                    break;
+            }
         }
     }
     return stats;
 }
 
 void ClusterCursorManager::appendActiveSessions(LogicalSessionIdSet* lsids) const {
-    stdx::lock_guard<Latch> lk(_mutex);
+    for (auto&& partition : _partitions) {
+        stdx::lock_guard<Latch> lk(partition->mutex);
 
-    for (auto&& [cursorId, entry] : _cursorEntryMap) {
-        if (entry.isKillPending()) {
-            // Don't include sessions for killed cursors.
-            continue;
-        }
+        for (auto&& [cursorId, entry] : partition->cursorEntryMap) {
+            if (entry.isKillPending()) {
+                // Don't include sessions for killed cursors.
+                continue;
+            }
 
-        auto lsid = entry.getLsid();
-        if (lsid) {
-            lsids->insert(*lsid);
+            auto lsid = entry.getLsid();
+            if (lsid) {
+                lsids->insert(*lsid);
+            }
         }
     }
 }
@@ -507,24 +525,26 @@ std::vector<GenericCursor> ClusterCursorManager::getIdleCursors(
     const OperationContext* opCtx, MongoProcessInterface::CurrentOpUserMode userMode) const {
     std::vector<GenericCursor> cursors;
 
-    stdx::lock_guard<Latch> lk(_mutex);
-
     AuthorizationSession* ctxAuth = AuthorizationSession::get(opCtx->getClient());
 
-    for (auto&& [cursorId, entry] : _cursorEntryMap) {
-        // If auth is enabled, and userMode is allUsers, check if the current user has
-        // permission to see this cursor.
-        if (ctxAuth->getAuthorizationManager().isAuthEnabled() &&
-            userMode == MongoProcessInterface::CurrentOpUserMode::kExcludeOthers &&
-            !ctxAuth->isCoauthorizedWith(entry.getAuthenticatedUser())) {
-            continue;
-        }
-        if (entry.isKillPending() || entry.getOperationUsingCursor()) {
-            // Don't include sessions for killed or pinned cursors.
-            continue;
-        }
+    for (auto&& partition : _partitions) {
+        stdx::lock_guard<Latch> lk(partition->mutex);
+
+        for (auto&& [cursorId, entry] : partition->cursorEntryMap) {
+            // If auth is enabled, and userMode is allUsers, check if the current user has
+            // permission to see this cursor.
+            if (ctxAuth->getAuthorizationManager().isAuthEnabled() &&
+                userMode == MongoProcessInterface::CurrentOpUserMode::kExcludeOthers &&
+                !ctxAuth->isCoauthorizedWith(entry.getAuthenticatedUser())) {
+                continue;
+            }
+            if (entry.isKillPending() || entry.getOperationUsingCursor()) {
+                // Don't include sessions for killed or pinned cursors.
+                continue;
+            }
 
-        cursors.emplace_back(entry.cursorToGenericCursor(cursorId, entry.getNamespace()));
+            cursors.emplace_back(entry.cursorToGenericCursor(cursorId, entry.getNamespace()));
+        }
     }
 
 
@@ -546,19 +566,21 @@ std::pair<Status, int> ClusterCursorManager::killCursorsWithMatchingSessions(
 
 stdx::unordered_set<CursorId> ClusterCursorManager::getCursorsForSession(
     LogicalSessionId lsid) const {
-    stdx::lock_guard<Latch> lk(_mutex);
-
     stdx::unordered_set<CursorId> cursorIds;
 
-    for (auto&& [cursorId, entry] : _cursorEntryMap) {
-        if (entry.isKillPending()) {
-            // Don't include sessions for killed cursors.
-            continue;
-        }
+    for (auto&& partition : _partitions) {
+        stdx::lock_guard<Latch> lk(partition->mutex);
 
-        auto cursorLsid = entry.getLsid();
-        if (lsid == cursorLsid) {
-            cursorIds.insert(cursorId);
+        for (auto&& [cursorId, entry] : partition->cursorEntryMap) {
+            if (entry.isKillPending()) {
+                // Don't include sessions for killed cursors.
+                continue;
+            }
+
+            auto cursorLsid = entry.getLsid();
+            if (lsid == cursorLsid) {
+                cursorIds.insert(cursorId);
+            }
         }
     }
 
@@ -566,8 +588,9 @@ stdx::unordered_set<CursorId> ClusterCursorManager::getCursorsForSession(
 }
 
 auto ClusterCursorManager::_getEntry(WithLock, CursorId cursorId) -> CursorEntry* {
-    auto entryMapIt = _cursorEntryMap.find(cursorId);
-    if (entryMapIt == _cursorEntryMap.end()) {
+    auto& cursorEntryMap = _getPartition(cursorId).cursorEntryMap;
+    auto entryMapIt = cursorEntryMap.find(cursorId);
+    if (entryMapIt == cursorEntryMap.end()) {
         return nullptr;
     }
 
@@ -590,7 +613,7 @@ StatusWith<ClusterClientCursorGuard> ClusterCursorManager::_detachCursor(WithLoc
     ClusterClientCursorGuard cursor = entry->releaseCursor(opCtx);
 
     // Destroy the entry.
-    size_t eraseResult = _cursorEntryMap.erase(cursorId);
+    size_t eraseResult = _getPartition(cursorId).cursorEntryMap.erase(cursorId);
     invariant(1 == eraseResult);
 
     return std::move(cursor);
@@ -30,6 +30,7 @@
 #pragma once
 
 #include <boost/move/utility_core.hpp>
+#include <array>
 #include <boost/optional/optional.hpp>
 #include <cstddef>
 #include <cstdint>
@@ -55,6 +56,7 @@
 #include "mongo/db/session/logical_session_id.h"
 #include "mongo/db/session/logical_session_id_gen.h"
 #include "mongo/db/session/session_killer.h"
+#include "mongo/platform/atomic_word.h"
 #include "mongo/platform/mutex.h"
 #include "mongo/platform/random.h"
 #include "mongo/s/query/cluster_client_cursor.h"
@@ -62,6 +64,7 @@
 #include "mongo/s/query/cluster_client_cursor_params.h"
 #include "mongo/stdx/unordered_map.h"
 #include "mongo/stdx/unordered_set.h"
+#include "mongo/util/aligned.h"
 #include "mongo/util/assert_util_core.h"
 #include "mongo/util/clock_source.h"
 #include "mongo/util/concurrency/with_lock.h"
@@ -89,6 +92,10 @@ class StatusWith;
  * The manager supports killing of registered cursors, either through the PinnedCursor object or
  * with the kill*() suite of methods.
  *
+ * Cursors are partitioned by id, and each partition is protected by its own latch, so that pinning
+ * and unpinning cursors only contends with operations on cursors of the same partition. Methods
+ * which inspect all cursors lock and inspect one partition at a time.
+ *
  * No public methods throw exceptions, and all public methods are thread-safe.
  */
 class ClusterCursorManager {
@@ -538,6 +545,20 @@ public:
 private:
     using CursorEntryMap = stdx::unordered_map<CursorId, CursorEntry>;
 
+    static constexpr std::size_t kNumPartitions = 16;
+
+    /**
+     * The cursors whose ids map to one partition, along with the latch protecting them.
+     */
+    struct Partition {
+        mutable Mutex mutex = MONGO_MAKE_LATCH("ClusterCursorManager::Partition::mutex");
+        CursorEntryMap cursorEntryMap;
+    };
+
+    Partition& _getPartition(CursorId cursorId) {
+        return *_partitions[static_cast<uint64_t>(cursorId) % kNumPartitions];
+    }
+
     /**
      * Transfers ownership of the given pinned cursor back to the manager, and moves the cursor to
      * the 'idle' state.
@@ -554,7 +575,7 @@ private:
                        CursorState cursorState);
 
     /**
-     * Will detach a cursor, release the lock and then call kill() on it.
+     * Will detach a cursor, release the partition lock and then call kill() on it.
      */
     void detachAndKillCursor(stdx::unique_lock<Latch> lk,
                              OperationContext* opCtx,
@@ -564,7 +585,7 @@ private:
      * Returns a pointer to the CursorEntry for the given cursor.  If the given cursor is not
      * registered, returns null.
      *
-     * Not thread-safe.
+     * Not thread-safe. The caller must hold the latch of the cursor's partition.
      */
     CursorEntry* _getEntry(WithLock, CursorId cursorId);
 
@@ -580,7 +601,7 @@ private:
      * If the given cursor is pinned, returns an error Status with code CursorInUse.  If the given
      * cursor is not registered, returns an error Status with code CursorNotFound.
      *
-     * Not thread-safe.
+     * Not thread-safe. The caller must hold the latch of the cursor's partition.
      */
     StatusWith<ClusterClientCursorGuard> _detachCursor(WithLock,
                                                        OperationContext* opCtx,
@@ -595,19 +616,22 @@ private:
     // concurrently accessed by multiple threads.
     ClockSource* _clockSource;
 
-    // Synchronizes access to all private state variables below.
-    mutable Mutex _mutex = MONGO_MAKE_LATCH("ClusterCursorManager::_mutex");
+    // Serializes cursor registration with itself and with shutdown. Protects '_pseudoRandom', and
+    // is acquired before any partition latch when both are needed.
+    Mutex _registrationMutex = MONGO_MAKE_LATCH("ClusterCursorManager::_registrationMutex");
 
-    bool _inShutdown{false};
+    // Written under '_registrationMutex', but may be read without it.
+    AtomicWord<bool> _inShutdown{false};
 
     // Randomness source.  Used for cursor id generation.
     const int64_t _randomSeed;
     PseudoRandom _pseudoRandom;
 
-    // Map from CursorId to CursorEntry.
-    CursorEntryMap _cursorEntryMap;
+    // Map from CursorId to CursorEntry, partitioned by CursorId. A thread may hold at most one
+    // partition latch at a time.
+    std::array<CacheExclusive<Partition>, kNumPartitions> _partitions;
 
-    size_t _cursorsTimedOut = 0;
+    AtomicWord<std::size_t> _cursorsTimedOut{0};
 };
 
 /**
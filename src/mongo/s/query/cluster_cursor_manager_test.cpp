@@ -246,6 +246,42 @@ TEST_F(ClusterCursorManagerTest, CheckOutCursorMultipleCursors) {
     }
 }
 
+// Test that many cursors, which are spread over the manager's partitions, can be pinned at the same
+// time and returned independently.
+TEST_F(ClusterCursorManagerTest, CheckOutManyCursorsAtOnce) {
+    const int numCursors = 100;
+    std::vector<CursorId> cursorIds(numCursors);
+    for (int i = 0; i < numCursors; ++i) {
+        cursorIds[i] =
+            assertGet(getManager()->registerCursor(getOperationContext(),
+                                                   allocateMockCursor(),
+                                                   nss,
+                                                   ClusterCursorManager::CursorType::SingleTarget,
+                                                   ClusterCursorManager::CursorLifetime::Mortal,
+                                                   boost::none));
+    }
+
+    std::vector<ClusterCursorManager::PinnedCursor> pinnedCursors;
+    for (int i = 0; i < numCursors; ++i) {
+        pinnedCursors.push_back(assertGet(
+            getManager()->checkOutCursor(cursorIds[i], getOperationContext(), successAuthChecker)));
+    }
+    ASSERT_EQ(static_cast<size_t>(numCursors), getManager()->getOpenCursorStats().pinned);
+
+    for (int i = 0; i < numCursors; i += 2) {
+        pinnedCursors[i].returnCursor(ClusterCursorManager::CursorState::NotExhausted);
+    }
+    ASSERT_EQ(static_cast<size_t>(numCursors / 2), getManager()->getOpenCursorStats().pinned);
+
+    for (int i = 1; i < numCursors; i += 2) {
+        pinnedCursors[i].returnCursor(ClusterCursorManager::CursorState::Exhausted);
+        ASSERT(isMockCursorKilled(i));
+    }
+    auto stats = getManager()->getOpenCursorStats();
+    ASSERT_EQ(0U, stats.pinned);
+    ASSERT_EQ(static_cast<size_t>(numCursors / 2), stats.singleTarget);
+}
+
 // Test that checking out a pinned cursor returns an error with code ErrorCodes::CursorInUse.
 TEST_F(ClusterCursorManagerTest, CheckOutCursorPinned) {
     auto cursorId =
@@ -162,6 +162,17 @@ public:
         doDetachFromOperationContext();
     }
 
+    /**
+     * Starts fetching the next batch of results from the remote hosts, if that is possible without
+     * blocking, so that it is ready by the time next() is called again. Must be called while
+     * attached to an OperationContext. Default implementation forwards to the stage's child.
+     */
+    virtual void prefetchNextBatch() {
+        if (_child) {
+            _child->prefetchNextBatch();
+        }
+    }
+
     /**
      * Returns a pointer to the current OperationContext, or nullptr if there is no context.
      */
@@ -76,6 +76,10 @@ public:
         return _resultsMerger.getNumRemotes();
     }
 
+    void prefetchNextBatch() final {
+        _resultsMerger.prefetchNextBatches();
+    }
+
     BSONObj getPostBatchResumeToken() final {
         return _resultsMerger.getHighWaterMark();
     }
@@ -74,6 +74,10 @@ bool RouterStageMock::remotesExhausted() {
     return _remotesExhausted;
 }
 
+void RouterStageMock::prefetchNextBatch() {
+    ++_prefetchCount;
+}
+
 Status RouterStageMock::doSetAwaitDataTimeout(Milliseconds awaitDataTimeout) {
     _awaitDataTimeout = awaitDataTimeout;
     return Status::OK();
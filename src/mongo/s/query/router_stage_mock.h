@@ -57,6 +57,8 @@ public:
 
     bool remotesExhausted() final;
 
+    void prefetchNextBatch() final;
+
     /**
      * Queues a BSONObj to be returned.
      */
@@ -83,6 +85,13 @@ public:
      */
     StatusWith<Milliseconds> getAwaitDataTimeout();
 
+    /**
+     * Returns how many times the next batch was prefetched.
+     */
+    int getPrefetchCount() const {
+        return _prefetchCount;
+    }
+
 protected:
     Status doSetAwaitDataTimeout(Milliseconds awaitDataTimeout) final;
 
@@ -90,6 +99,7 @@ private:
     std::queue<StatusWith<ClusterQueryResult>> _resultsQueue;
     bool _remotesExhausted = false;
     boost::optional<Milliseconds> _awaitDataTimeout;
+    int _prefetchCount = 0;
 };
 
 }  // namespace mongo
@@ -196,6 +196,9 @@ void HandleRequest::onSuccess(const DbResponse& dbResponse) {
             opCtx,
             durationCount<Microseconds>(currentOp->elapsedTimeExcludingPauses()),
             currentOp->getReadWriteType());
+
+    if (auto command = currentOp->getCommand())
+        command->recordLatency(currentOp->elapsedTimeExcludingPauses());
 }
 
 Future<DbResponse> HandleRequest::run() {
@@ -27,9 +27,11 @@
  *    it in the license file.
  */
 
+#include <algorithm>
 #include <map>
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include <absl/container/node_hash_set.h>
 #include <boost/move/utility_core.hpp>
@@ -78,6 +80,35 @@ BSONObj lsidQuery(const LogicalSessionId& lsid) {
     return BSON(LogicalSessionRecord::kIdFieldName << lsid.toBSON());
 }
 
+/**
+ * Flattens the sessions grouped by owning shard so that each batch of
+ * SessionsCollection::kMaxBatchSize sessions holds an equal share of every shard's sessions.
+ * cluster::write() sends the parts of a batch which target different shards concurrently, so this
+ * writes to all the shards in parallel rather than to one shard after the other.
+ */
+template <typename T>
+std::vector<T> interleaveByOwningShard(std::map<ShardId, std::vector<T>>& sessionsByOwningShard,
+                                       size_t numSessions) {
+    std::vector<T> sessions;
+    if (sessionsByOwningShard.empty()) {
+        return sessions;
+    }
+    sessions.reserve(numSessions);
+
+    const size_t sliceSize =
+        std::max(size_t(1), SessionsCollection::kMaxBatchSize / sessionsByOwningShard.size());
+    for (size_t offset = 0; sessions.size() < numSessions; offset += sliceSize) {
+        for (auto& [shardId, shardSessions] : sessionsByOwningShard) {
+            const auto sliceEnd = std::min(offset + sliceSize, shardSessions.size());
+            for (size_t i = offset; i < sliceEnd; ++i) {
+                sessions.emplace_back(std::move(shardSessions[i]));
+            }
+        }
+    }
+
+    return sessions;
+}
+
 }  // namespace
 
 std::vector<LogicalSessionId> SessionsCollectionSharded::_groupSessionIdsByOwningShard(
@@ -90,20 +121,14 @@ std::vector<LogicalSessionId> SessionsCollectionSharded::_groupSessionIdsByOwnin
                           << " is not sharded",
             cm.isSharded());
 
-    std::multimap<ShardId, LogicalSessionId> sessionIdsByOwningShard;
+    std::map<ShardId, std::vector<LogicalSessionId>> sessionIdsByOwningShard;
     for (const auto& session : sessions) {
-        sessionIdsByOwningShard.emplace(
-            cm.findIntersectingChunkWithSimpleCollation(session.getId().toBSON()).getShardId(),
-            session);
-    }
-
-    std::vector<LogicalSessionId> sessionIdsGroupedByShard;
-    sessionIdsGroupedByShard.reserve(sessions.size());
-    for (auto& session : sessionIdsByOwningShard) {
-        sessionIdsGroupedByShard.emplace_back(std::move(session.second));
+        sessionIdsByOwningShard
+            [cm.findIntersectingChunkWithSimpleCollation(session.getId().toBSON()).getShardId()]
+                .emplace_back(session);
     }
 
-    return sessionIdsGroupedByShard;
+    return interleaveByOwningShard(sessionIdsByOwningShard, sessions.size());
 }
 
 std::vector<LogicalSessionRecord> SessionsCollectionSharded::_groupSessionRecordsByOwningShard(
@@ -116,20 +141,14 @@ std::vector<LogicalSessionRecord> SessionsCollectionSharded::_groupSessionRecord
                           << " is not sharded",
             cm.isSharded());
 
-    std::multimap<ShardId, LogicalSessionRecord> sessionsByOwningShard;
+    std::map<ShardId, std::vector<LogicalSessionRecord>> sessionsByOwningShard;
     for (const auto& session : sessions) {
-        sessionsByOwningShard.emplace(
-            cm.findIntersectingChunkWithSimpleCollation(session.getId().toBSON()).getShardId(),
-            session);
-    }
-
-    std::vector<LogicalSessionRecord> sessionRecordsGroupedByShard;
-    sessionRecordsGroupedByShard.reserve(sessions.size());
-    for (auto& session : sessionsByOwningShard) {
-        sessionRecordsGroupedByShard.emplace_back(std::move(session.second));
+        sessionsByOwningShard
+            [cm.findIntersectingChunkWithSimpleCollation(session.getId().toBSON()).getShardId()]
+                .emplace_back(session);
     }
 
-    return sessionRecordsGroupedByShard;
+    return interleaveByOwningShard(sessionsByOwningShard, sessions.size());
 }
 
 void SessionsCollectionSharded::setupSessionsCollection(OperationContext* opCtx) {
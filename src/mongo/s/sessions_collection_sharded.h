@@ -75,6 +75,9 @@ private:
      * The reason it is 'best effort' is because it makes no attempt at checking whether the routing
      * table is up-to-date and just picks up whatever was most recently fetched from the config
      * server, which could be stale.
+     *
+     * The groups are interleaved so that each batch written to the sessions collection contains a
+     * share of every shard's sessions, which lets cluster::write() update the shards in parallel.
      */
     std::vector<LogicalSessionId> _groupSessionIdsByOwningShard(
         OperationContext* opCtx, const LogicalSessionIdSet& sessions);
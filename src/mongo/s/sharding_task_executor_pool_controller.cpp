@@ -73,6 +73,29 @@ bool isConfigServer(const ShardRegistry* sr, const HostAndPort& peer) {
     return sr && sr->isConfigServer(peer);
 }
 
+/**
+ * Sizes a pool so that queued requests wait about targetQueueTime for a connection. Each
+ * connection frees up roughly every connectionUsageTime, so ceil(requests * usage / target) extra
+ * connections drain the queue in time. Once requests already wait longer than the target, every
+ * queued request gets a connection as it would without latency-driven sizing. Growth is capped to
+ * doubling the open connections per update so a latency spike doesn't turn into a connection storm.
+ */
+size_t getLatencyDrivenTarget(const executor::ConnectionPool::HostState& stats,
+                              Milliseconds targetQueueTime,
+                              size_t maxConnecting) {
+    const size_t inUse = stats.active + stats.leased;
+    size_t wanted = inUse + stats.requests;
+    if (stats.requests > 0 && stats.connectionWaitTime <= targetQueueTime) {
+        const auto usage = static_cast<size_t>(stats.connectionUsageTime.count());
+        const auto budget = static_cast<size_t>(targetQueueTime.count());
+        const auto needed = (stats.requests * usage + budget - 1) / budget;
+        wanted = inUse + std::clamp<size_t>(needed, 1, stats.requests);
+    }
+
+    const size_t open = stats.ready + stats.pending + inUse;
+    return std::min(wanted, std::max(2 * open, open + maxConnecting));
+}
+
 }  // namespace
 
 Status ShardingTaskExecutorPoolController::validateHostTimeout(const int& hostTimeoutMS,
@@ -263,7 +286,21 @@ auto ShardingTaskExecutorPoolController::updateHost(PoolId id, const HostState&
                 "maxConns"_attr = maxConns);
 
     // Update the target for just the pool first
-    poolData.target = stats.requests + stats.active + stats.leased;
+    const auto targetQueueTime = Milliseconds{gParameters.targetQueueTimeMS.load()};
+    if (targetQueueTime > Milliseconds{0}) {
+        poolData.target =
+            getLatencyDrivenTarget(stats, targetQueueTime, gParameters.maxConnecting.load());
+        LOGV2_DEBUG(9156634,
+                    5,
+                    "Sized connection pool from observed latencies",
+                    "host"_attr = poolData.host,
+                    "connectionWaitTime"_attr = stats.connectionWaitTime,
+                    "connectionUsageTime"_attr = stats.connectionUsageTime,
+                    "targetQueueTime"_attr = targetQueueTime,
+                    "target"_attr = poolData.target);
+    } else {
+        poolData.target = stats.requests + stats.active + stats.leased;
+    }
 
     if (poolData.target < minConns) {
         poolData.target = minConns;
@@ -361,6 +398,9 @@ Milliseconds ShardingTaskExecutorPoolController::toRefreshTimeout() const {
 void ShardingTaskExecutorPoolController::updateConnectionPoolStats(
     executor::ConnectionPoolStats* cps) const {
     cps->strategy = gParameters.matchingStrategy.load();
+    if (auto targetQueueTimeMS = gParameters.targetQueueTimeMS.load(); targetQueueTimeMS > 0) {
+        cps->targetQueueTime = Milliseconds{targetQueueTimeMS};
+    }
 }
 
 }  // namespace mongo
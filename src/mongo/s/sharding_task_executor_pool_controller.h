@@ -75,6 +75,10 @@ class ShardRegistry;
  * When the MatchingStrategy is kMatchBusiestNode, it operates like kMatchPrimaryNode, but any pool
  * can be responsible for increasing the targetConnections of each member of its set.
  *
+ * When targetQueueTimeMS is set, the targetConnections for each pool is derived from how long its
+ * requests wait for a connection and how long its connections stay checked out, rather than from
+ * the raw number of requests, and growth is limited to doubling the open connections per update.
+ *
  * Note that, in essence, there are three outside elements that can mutate the state of this class:
  * * The ReplicaSetChangeNotifier can notify the listener which updates the host groups
  * * The ServerParameters can update the Parameters which will used in the next update
@@ -121,6 +125,8 @@ public:
 
         AtomicWord<int> minConnectionsForConfigServers;
         AtomicWord<int> maxConnectionsForConfigServers;
+
+        AtomicWord<int> targetQueueTimeMS;
     };
 
     static inline Parameters gParameters;
@@ -34,6 +34,7 @@
 #include <boost/move/utility_core.hpp>
 #include <boost/none.hpp>
 #include <cstddef>
+#include <deque>
 #include <memory>
 #include <string>
 #include <utility>
@@ -72,6 +73,7 @@
 #include "mongo/s/client/num_hosts_targeted_metrics.h"
 #include "mongo/s/client/shard.h"
 #include "mongo/s/grid.h"
+#include "mongo/s/mongod_and_mongos_server_parameters_gen.h"
 #include "mongo/s/multi_statement_transaction_requests_sender.h"
 #include "mongo/s/request_types/cluster_commands_without_shard_key_gen.h"
 #include "mongo/s/stale_exception.h"
@@ -81,6 +83,7 @@
 #include "mongo/s/write_ops/coordinate_multi_update_util.h"
 #include "mongo/s/write_ops/write_op.h"
 #include "mongo/s/write_ops/write_without_shard_key_util.h"
+#include "mongo/stdx/unordered_map.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/exit.h"
 #include "mongo/util/str.h"
@@ -156,6 +159,36 @@ bool hasTransientTransactionError(const BatchedCommandResponse& response) {
 // applies when no writes are occurring and metadata is not changing on reload.
 const int kMaxRoundsWithoutProgress(5);
 
+// Helper to build the command object sending a child batch to its shard.
+BSONObj buildShardBatchCommand(
+    OperationContext* opCtx,
+    NSTargeter& targeter,
+    const TargetedWriteBatch& batch,
+    BatchWriteOp& batchOp,
+    boost::optional<bool> allowShardKeyUpdatesWithoutFullShardKeyInQuery) {
+    const auto shardBatchRequest(
+        batchOp.buildBatchRequest(batch, targeter, allowShardKeyUpdatesWithoutFullShardKeyInQuery));
+
+    BSONObjBuilder requestBuilder;
+    shardBatchRequest.serialize(&requestBuilder);
+    if (!TransactionRouter::get(opCtx)) {
+        requestBuilder.append(WriteConcernOptions::kWriteConcernField,
+                              opCtx->getWriteConcern().toBSON());
+    }
+
+    logical_session_id_helpers::serializeLsidAndTxnNumber(opCtx, &requestBuilder);
+
+    auto request = requestBuilder.obj();
+
+    LOGV2_DEBUG(22905,
+                4,
+                "Sending write batch",
+                "shardId"_attr = batch.getShardId(),
+                "request"_attr = redact(request));
+
+    return request;
+}
+
 // Helper to parse all of the childBatches and construct the proper requests to send using the
 // AsyncRequestSender.
 std::vector<AsyncRequestsSender::Request> constructARSRequestsToSend(
@@ -182,27 +215,8 @@ std::vector<AsyncRequestsSender::Request> constructARSRequestsToSend(
 
         stats->noteTargetedShard(targetShardId);
 
-        const auto request = [&] {
-            const auto shardBatchRequest(batchOp.buildBatchRequest(
-                *nextBatch, targeter, allowShardKeyUpdatesWithoutFullShardKeyInQuery));
-
-            BSONObjBuilder requestBuilder;
-            shardBatchRequest.serialize(&requestBuilder);
-            if (!TransactionRouter::get(opCtx)) {
-                requestBuilder.append(WriteConcernOptions::kWriteConcernField,
-                                      opCtx->getWriteConcern().toBSON());
-            }
-
-            logical_session_id_helpers::serializeLsidAndTxnNumber(opCtx, &requestBuilder);
-
-            return requestBuilder.obj();
-        }();
-
-        LOGV2_DEBUG(22905,
-                    4,
-                    "Sending write batch",
-                    "shardId"_attr = targetShardId,
-                    "request"_attr = redact(request));
+        const auto request = buildShardBatchCommand(
+            opCtx, targeter, *nextBatch, batchOp, allowShardKeyUpdatesWithoutFullShardKeyInQuery);
 
         requests.emplace_back(targetShardId, request);
 
@@ -426,6 +440,146 @@ void executeChildBatches(OperationContext* opCtx,
     }
 }
 
+// Returns the number of child batches which may be in flight to each shard at once when executing
+// 'clientRequest' with executeChildBatchesPipelined(), or 0 if the request must be executed in
+// rounds. Pipelining is limited to unordered inserts outside of transactions: each insert targets
+// exactly one shard, so the writes of a batch which cannot be sent yet can be returned to the ready
+// state without affecting the batches already sent to the other shards.
+int getMaxInFlightBatchesPerShard(OperationContext* opCtx,
+                                  const BatchedCommandRequest& clientRequest) {
+    if (clientRequest.getBatchType() != BatchedCommandRequest::BatchType_Insert ||
+        clientRequest.getWriteCommandRequestBase().getOrdered() || TransactionRouter::get(opCtx)) {
+        return 0;
+    }
+    return gUnorderedInsertMaxInFlightBatchesPerShard.load();
+}
+
+// Streaming variant of executeChildBatches(). Rather than waiting for every child batch of the
+// round to return, the remaining ready writes are retargeted each time a batch returns and each
+// shard with fewer than 'maxInFlightPerShard' batches outstanding is sent its next batch at once.
+// Streaming stops at the first response which is not a complete success; the batches still in
+// flight are then drained and the remaining writes are left to the next round, which handles
+// errors and targeter refreshes exactly as it does for executeChildBatches().
+void executeChildBatchesPipelined(OperationContext* opCtx,
+                                  NSTargeter& targeter,
+                                  const BatchedCommandRequest& clientRequest,
+                                  TargetedBatchMap& childBatches,
+                                  BatchWriteExecStats* stats,
+                                  BatchWriteOp& batchOp,
+                                  bool recordTargetErrors,
+                                  int maxInFlightPerShard,
+                                  bool& abortBatch) {
+    // Batches out on the network, keyed by the ARS request index of the request which sent them.
+    stdx::unordered_map<size_t, std::unique_ptr<TargetedWriteBatch>> pendingBatches;
+    stdx::unordered_map<ShardId, int> numInFlightPerShard;
+    size_t nextRequestIndex = 0;
+
+    auto makeRequest = [&](std::unique_ptr<TargetedWriteBatch> batch) {
+        const auto shardId = batch->getShardId();
+        stats->noteTargetedShard(shardId);
+
+        AsyncRequestsSender::Request request(
+            shardId, buildShardBatchCommand(opCtx, targeter, *batch, batchOp, boost::none));
+
+        ++numInFlightPerShard[shardId];
+        pendingBatches.emplace(nextRequestIndex++, std::move(batch));
+        return request;
+    };
+
+    std::vector<AsyncRequestsSender::Request> requests;
+    for (auto&& childBatch : childBatches) {
+        requests.push_back(makeRequest(std::move(childBatch.second)));
+    }
+
+    MultiStatementTransactionRequestsSender ars(
+        opCtx,
+        Grid::get(opCtx)->getExecutorPool()->getArbitraryExecutor(),
+        clientRequest.getNS().dbName(),
+        requests,
+        kPrimaryOnlyReadPreference,
+        opCtx->getTxnNumber() ? Shard::RetryPolicy::kIdempotent : Shard::RetryPolicy::kNoRetry);
+
+    // Targets the ready writes and sends the batches of the shards which still have room in their
+    // pipeline. Returns false if targeting failed, in which case the next round reports the error.
+    auto sendReadyBatches = [&] {
+        TargetedBatchMap readyBatches;
+        if (!batchOp.targetBatch(targeter, recordTargetErrors, &readyBatches).isOK()) {
+            return false;
+        }
+
+        for (auto&& [shardId, readyBatch] : readyBatches) {
+            if (numInFlightPerShard[shardId] >= maxInFlightPerShard) {
+                // Return the writes so they are targeted again when one of the shard's batches
+                // comes back.
+                for (auto&& write : readyBatch->getWrites()) {
+                    batchOp.getWriteOp(write->writeOpRef.first).resetWriteToReady();
+                }
+                continue;
+            }
+            ars.addRequest(makeRequest(std::move(readyBatch)));
+        }
+        return true;
+    };
+
+    bool streaming = sendReadyBatches();
+
+    // The batches and their responses must outlive the handling of deferred responses below.
+    std::vector<std::unique_ptr<TargetedWriteBatch>> completedBatches;
+    std::deque<BatchedCommandResponse> batchResponses;
+    while (!ars.done()) {
+        // Block until a response is available.
+        auto response = ars.next();
+        auto pendingIt = pendingBatches.find(response.requestIndex);
+        dassert(pendingIt != pendingBatches.end());
+        TargetedWriteBatch* batch = pendingIt->second.get();
+        completedBatches.push_back(std::move(pendingIt->second));
+        pendingBatches.erase(pendingIt);
+        --numInFlightPerShard[batch->getShardId()];
+
+        const auto shardInfo = response.shardHostAndPort ? response.shardHostAndPort->toString()
+                                                         : batch->getShardId();
+
+        Status responseStatus = response.swResponse.getStatus();
+        batchResponses.emplace_back();
+        if (responseStatus.isOK()) {
+            std::string errMsg;
+            if (!batchResponses.back().parseBSON(response.swResponse.getValue().data, &errMsg)) {
+                responseStatus = {ErrorCodes::FailedToParse, errMsg};
+            }
+        }
+
+        if (responseStatus.isOK()) {
+            if ((abortBatch = processResponseFromRemote(opCtx,
+                                                        targeter,
+                                                        shardInfo,
+                                                        batchResponses.back(),
+                                                        batchOp,
+                                                        batch,
+                                                        stats))) {
+                break;
+            }
+            streaming = streaming && batchResponses.back().toStatus().isOK();
+        } else {
+            // The ARS failed to retrieve the response due to some sort of local failure.
+            if ((abortBatch = processErrorResponseFromLocal(opCtx,
+                                                            batchOp,
+                                                            batch,
+                                                            responseStatus,
+                                                            shardInfo,
+                                                            response.shardHostAndPort))) {
+                break;
+            }
+            streaming = false;
+        }
+
+        if (streaming) {
+            streaming = sendReadyBatches();
+        }
+    }
+    batchOp.handleDeferredResponses(targeter.hasStaleShardResponse());
+    batchOp.handleDeferredWriteConcernErrors();
+}
+
 // Only processes one write response from the child batches. Currently this is used for the two
 // phase protocol of the singleton writes without shard key and time-series retryable updates.
 void processResponseForOnlyFirstBatch(OperationContext* opCtx,
@@ -791,8 +945,23 @@ void BatchWriteExec::executeBatch(OperationContext* opCtx,
                 break;
             }
         } else {
-            if (statusWithWriteType.getValue() == WriteType::Ordinary ||
-                statusWithWriteType.getValue() == WriteType::WithoutShardKeyWithId) {
+            const int maxInFlightBatchesPerShard =
+                getMaxInFlightBatchesPerShard(opCtx, clientRequest);
+            if (statusWithWriteType.getValue() == WriteType::Ordinary &&
+                maxInFlightBatchesPerShard > 0) {
+                // Streams the child batches to the shards, retargeting the remaining writes as
+                // batches return.
+                executeChildBatchesPipelined(opCtx,
+                                             targeter,
+                                             clientRequest,
+                                             childBatches,
+                                             stats,
+                                             batchOp,
+                                             recordTargetErrors,
+                                             maxInFlightBatchesPerShard,
+                                             abortBatch);
+            } else if (statusWithWriteType.getValue() == WriteType::Ordinary ||
+                       statusWithWriteType.getValue() == WriteType::WithoutShardKeyWithId) {
                 // Tries to execute all of the child batches. If there are any transaction errors,
                 // 'abortBatch' will be set.
                 executeChildBatches(
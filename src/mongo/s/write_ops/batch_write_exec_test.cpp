@@ -35,6 +35,7 @@
 #include <boost/none.hpp>
 #include <boost/optional/optional.hpp>
 // IWYU pragma: no_include "cxxabi.h"
+#include <algorithm>
 #include <cstddef>
 #include <iterator>
 #include <memory>
@@ -793,6 +794,117 @@ TEST_F(BatchWriteExecTest, MultiOpLargeUnorderedWithStaleShardVersionError) {
     future.default_timed_get();
 }
 
+TEST_F(BatchWriteExecTest, MultiOpLargeUnorderedPipelinesBatchesToShard) {
+    RAIIServerParameterControllerForTest maxInFlightBatches{
+        "unorderedInsertMaxInFlightBatchesPerShard", 2};
+    const int kNumDocsToInsert = 100'000;
+
+    std::vector<BSONObj> docsToInsert;
+    docsToInsert.reserve(kNumDocsToInsert);
+    for (int i = 0; i < kNumDocsToInsert; i++) {
+        docsToInsert.push_back(BSON("_id" << i));
+    }
+
+    BatchedCommandRequest request([&] {
+        write_ops::InsertCommandRequest insertOp(nss);
+        insertOp.setWriteCommandRequestBase([] {
+            write_ops::WriteCommandRequestBase writeCommandBase;
+            writeCommandBase.setOrdered(false);
+            return writeCommandBase;
+        }());
+        insertOp.setDocuments(docsToInsert);
+        return insertOp;
+    }());
+
+    auto future = launchAsync([&] {
+        BatchedCommandResponse response;
+        BatchWriteExecStats stats;
+        BatchWriteExec::executeBatch(
+            operationContext(), singleShardNSTargeter, request, &response, &stats);
+
+        ASSERT(response.getOk());
+        ASSERT_EQ(kNumDocsToInsert, response.getN());
+        // Both batches were in flight to the shard in the same round.
+        ASSERT_EQ(1, stats.numRounds);
+    });
+
+    // The two batches are sent without waiting for each other, so they may arrive in any order.
+    std::vector<size_t> batchSizes;
+    for (int i = 0; i < 2; i++) {
+        onCommandForPoolExecutor([&](const executor::RemoteCommandRequest& request) {
+            const auto opMsgRequest = static_cast<OpMsgRequest>(request);
+            const auto actualBatchedInsert(BatchedCommandRequest::parseInsert(opMsgRequest));
+            batchSizes.push_back(actualBatchedInsert.getInsertRequest().getDocuments().size());
+
+            BatchedCommandResponse response;
+            response.setStatus(Status::OK());
+            response.setN(batchSizes.back());
+            return response.toBSON();
+        });
+    }
+    std::sort(batchSizes.begin(), batchSizes.end());
+    ASSERT_EQ(std::vector<size_t>({kNumDocsToInsert - 60133, 60133}), batchSizes);
+
+    future.default_timed_get();
+}
+
+TEST_F(BatchWriteExecTest, MultiOpLargeUnorderedPipelinedWithStaleShardVersionError) {
+    RAIIServerParameterControllerForTest maxInFlightBatches{
+        "unorderedInsertMaxInFlightBatchesPerShard", 2};
+    const int kNumDocsToInsert = 100'000;
+
+    std::vector<BSONObj> docsToInsert;
+    docsToInsert.reserve(kNumDocsToInsert);
+    for (int i = 0; i < kNumDocsToInsert; i++) {
+        docsToInsert.push_back(BSON("_id" << i));
+    }
+
+    BatchedCommandRequest request([&] {
+        write_ops::InsertCommandRequest insertOp(nss);
+        insertOp.setWriteCommandRequestBase([] {
+            write_ops::WriteCommandRequestBase writeCommandBase;
+            writeCommandBase.setOrdered(false);
+            return writeCommandBase;
+        }());
+        insertOp.setDocuments(docsToInsert);
+        return insertOp;
+    }());
+
+    auto future = launchAsync([&] {
+        BatchedCommandResponse response;
+        BatchWriteExecStats stats;
+        BatchWriteExec::executeBatch(
+            operationContext(), singleShardNSTargeter, request, &response, &stats);
+
+        ASSERT(response.getOk());
+        ASSERT_EQ(kNumDocsToInsert, response.getN());
+        // The stale batch is retried in a second round, after the targeter refresh.
+        ASSERT_EQ(2, stats.numRounds);
+    });
+
+    // The two batches are sent without waiting for each other, so they may arrive in any order.
+    // The first one fails with a stale shard version error and the second one succeeds.
+    const std::vector<BSONObj> firstBatch(docsToInsert.begin(), docsToInsert.begin() + 60133);
+    for (int i = 0; i < 2; i++) {
+        onCommandForPoolExecutor([&](const executor::RemoteCommandRequest& request) {
+            const auto opMsgRequest = static_cast<OpMsgRequest>(request);
+            const auto actualBatchedInsert(BatchedCommandRequest::parseInsert(opMsgRequest));
+            const auto& inserted = actualBatchedInsert.getInsertRequest().getDocuments();
+            if (inserted.size() == firstBatch.size()) {
+                return expectInsertsReturnStaleVersionErrorsBase(nss, firstBatch, request);
+            }
+
+            BatchedCommandResponse response;
+            response.setStatus(Status::OK());
+            response.setN(inserted.size());
+            return response.toBSON();
+        });
+    }
+    expectInsertsReturnSuccess(firstBatch);
+
+    future.default_timed_get();
+}
+
 TEST_F(BatchWriteExecTest, StaleShardVersionReturnedFromBatchWithSingleMultiWrite) {
     BatchedCommandRequest request([&] {
         write_ops::UpdateCommandRequest updateOp(nss);
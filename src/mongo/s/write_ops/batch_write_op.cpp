@@ -167,6 +167,50 @@ void trackErrors(const ShardEndpoint& endpoint,
     }
 }
 
+/**
+ * If all the ready write ops are inserts, targets them up front with one targetInserts() call per
+ * targeter, so that the targeter can share its routing table lookups across the whole batch.
+ * Returns the result for each write op, indexed like 'writeOps', or an empty vector if the ops were
+ * not targeted up front. Batches mixing inserts with other writes are not targeted up front,
+ * because their targeting rounds can stop early and the remaining results would be discarded.
+ */
+std::vector<boost::optional<StatusWith<ShardEndpoint>>> targetReadyInserts(
+    OperationContext* opCtx, const std::vector<WriteOp>& writeOps, GetTargeterFn getTargeterFn) {
+    std::map<const NSTargeter*, std::vector<size_t>> opIndexesByTargeter;
+    size_t numReadyInserts = 0;
+    for (size_t opIndex = 0; opIndex < writeOps.size(); ++opIndex) {
+        const auto& writeOp = writeOps[opIndex];
+        if (writeOp.getWriteState() != WriteOpState_Ready) {
+            continue;
+        }
+        if (writeOp.getWriteItem().getOpType() != BatchedCommandRequest::BatchType_Insert) {
+            return {};
+        }
+        opIndexesByTargeter[&getTargeterFn(writeOp)].push_back(opIndex);
+        ++numReadyInserts;
+    }
+
+    if (numReadyInserts < 2) {
+        return {};
+    }
+
+    std::vector<boost::optional<StatusWith<ShardEndpoint>>> endpoints(writeOps.size());
+    for (const auto& [targeter, opIndexes] : opIndexesByTargeter) {
+        std::vector<BSONObj> docs;
+        docs.reserve(opIndexes.size());
+        for (auto opIndex : opIndexes) {
+            docs.push_back(writeOps[opIndex].getWriteItem().getDocument());
+        }
+
+        auto targeted = targeter->targetInserts(opCtx, docs);
+        invariant(targeted.size() == opIndexes.size());
+        for (size_t i = 0; i < opIndexes.size(); ++i) {
+            endpoints[opIndexes[i]] = std::move(targeted[i]);
+        }
+    }
+    return endpoints;
+}
+
 int getEncryptionInformationSize(const BatchedCommandRequest& req) {
     if (!req.getWriteCommandRequestBase().getEncryptionInformation()) {
         return 0;
@@ -320,6 +364,12 @@ StatusWith<WriteType> targetWriteOps(OperationContext* opCtx,
     std::map<NamespaceString, std::set<const ShardEndpoint*, EndpointComp>> nsEndpointMap;
     std::map<NamespaceString, std::set<ShardId>> nsShardIdMap;
 
+    // Ordered batches stop targeting at the first write which goes to a different shard, so only
+    // unordered batches are worth targeting up front.
+    const auto insertEndpoints =
+        ordered ? std::vector<boost::optional<StatusWith<ShardEndpoint>>>{}
+                : targetReadyInserts(opCtx, writeOps, getTargeterFn);
+
     for (auto& writeOp : writeOps) {
         bool useTwoPhaseWriteProtocol = false;
         bool isNonTargetedWriteWithoutShardKeyWithExactId = false;
@@ -339,11 +389,20 @@ StatusWith<WriteType> targetWriteOps(OperationContext* opCtx,
         std::vector<std::unique_ptr<TargetedWrite>> writes;
         auto targetStatus = [&] {
             try {
+                const ShardEndpoint* insertEndpoint = nullptr;
+                if (!insertEndpoints.empty()) {
+                    const auto& targeted = insertEndpoints[&writeOp - writeOps.data()];
+                    if (targeted) {
+                        uassertStatusOK(targeted->getStatus());
+                        insertEndpoint = &targeted->getValue();
+                    }
+                }
                 writeOp.targetWrites(opCtx,
                                      targeter,
                                      &writes,
                                      &useTwoPhaseWriteProtocol,
-                                     &isNonTargetedWriteWithoutShardKeyWithExactId);
+                                     &isNonTargetedWriteWithoutShardKeyWithExactId,
+                                     insertEndpoint);
                 return Status::OK();
             } catch (const DBException& ex) {
                 return ex.toStatus();
@@ -160,10 +160,14 @@ void WriteOp::targetWrites(OperationContext* opCtx,
                            const NSTargeter& targeter,
                            std::vector<std::unique_ptr<TargetedWrite>>* targetedWrites,
                            bool* useTwoPhaseWriteProtocol,
-                           bool* isNonTargetedWriteWithoutShardKeyWithExactId) {
+                           bool* isNonTargetedWriteWithoutShardKeyWithExactId,
+                           const ShardEndpoint* insertEndpoint) {
     invariant(_childOps.empty());
     auto endpoints = [&] {
         if (_itemRef.getOpType() == BatchedCommandRequest::BatchType_Insert) {
+            if (insertEndpoint) {
+                return std::vector{*insertEndpoint};
+            }
             return std::vector{targeter.targetInsert(opCtx, _itemRef.getDocument())};
         } else if (_itemRef.getOpType() == BatchedCommandRequest::BatchType_Update) {
             return targeter.targetUpdate(opCtx,
@@ -186,12 +186,16 @@ public:
      *
      * The ShardTargeter determines the ShardEndpoints to send child writes to, but is not
      * modified by this operation.
+     *
+     * If this is an insert which was already targeted as part of a batch, 'insertEndpoint' is the
+     * endpoint it was resolved to and the targeter is not consulted again.
      */
     void targetWrites(OperationContext* opCtx,
                       const NSTargeter& targeter,
                       std::vector<std::unique_ptr<TargetedWrite>>* targetedWrites,
                       bool* useTwoPhaseWriteProtocol = nullptr,
-                      bool* isNonTargetedWriteWithoutShardKeyWithExactId = nullptr);
+                      bool* isNonTargetedWriteWithoutShardKeyWithExactId = nullptr,
+                      const ShardEndpoint* insertEndpoint = nullptr);
 
     /**
      * Returns the number of child writes that were last targeted.
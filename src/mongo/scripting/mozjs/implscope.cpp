@@ -50,8 +50,10 @@
 #include <js/Realm.h>
 #include <js/RootingAPI.h>
 #include <js/SourceText.h>
+#include <js/Transcoding.h>
 #include <js/TypeDecls.h>
 #include <js/Value.h>
+#include <js/experimental/JSStencil.h>
 #include <js/friend/ErrorMessages.h>
 #include <jsapi.h>
 #include <jscustomallocator.h>
@@ -63,6 +65,7 @@
 #include <iostream>
 #include <memory>
 #include <mutex>
+#include <vector>
 
 #include "mongo/base/error_codes.h"
 #include "mongo/bson/bsontypes.h"
@@ -78,10 +81,12 @@
 #include "mongo/logv2/log_truncation.h"
 #include "mongo/logv2/redaction.h"
 #include "mongo/platform/decimal128.h"
+#include "mongo/platform/atomic_word.h"
 #include "mongo/platform/mutex.h"
 #include "mongo/platform/stack_locator.h"
 #include "mongo/scripting/deadline_monitor.h"
 #include "mongo/scripting/jsexception.h"
+#include "mongo/scripting/mozjs/engine_gen.h"
 #include "mongo/scripting/mozjs/exception.h"
 #include "mongo/scripting/mozjs/implscope.h"
 #include "mongo/scripting/mozjs/jsstringwrapper.h"
@@ -89,6 +94,8 @@
 #include "mongo/scripting/mozjs/valuereader.h"
 #include "mongo/scripting/mozjs/valuewriter.h"
 #include "mongo/util/assert_util.h"
+#include "mongo/util/lru_cache.h"
+#include "mongo/util/static_immortal.h"
 #include "mongo/util/str.h"
 
 #define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kQuery
@@ -144,6 +151,112 @@ bool gFirstRuntimeCreated = false;
 bool closeToMaxMemory() {
     return mongo::sm::get_total_bytes() > (kInterruptGCThreshold * mongo::sm::get_max_bytes());
 }
+
+/**
+ * An LRU cache of compiled JavaScript functions shared by all scopes in the process, so that the
+ * same $where, $function or $accumulator code is not parsed again by every scope which runs it.
+ *
+ * Stencils can only be instantiated on the runtime which compiled them, so entries hold the XDR
+ * encoding of the stencil instead. The encoding is copied out of the SpiderMonkey allocator, whose
+ * accounting is per-thread, and decoded stencils borrow from it, so the buffer must outlive them.
+ */
+class CompiledFunctionCache {
+public:
+    explicit CompiledFunctionCache(size_t size) : _cache(size) {}
+
+    static CompiledFunctionCache* get() {
+        return _instance().get();
+    }
+
+    /**
+     * Replaces the cache with an empty one holding up to 'size' functions, or disables it if
+     * 'size' is 0. Must not be called while any scope may be creating a function.
+     */
+    static void reset(size_t size) {
+        _instance() = size > 0 ? std::make_unique<CompiledFunctionCache>(size) : nullptr;
+    }
+
+    /**
+     * Returns the number of functions which were instantiated from a cached stencil instead of
+     * being compiled.
+     */
+    size_t hits() const {
+        return _hits.load();
+    }
+
+    /**
+     * Evaluates the function expression built by 'makeCode' from 'raw' into 'fun', reusing the
+     * stencil cached for 'raw' if there is one. Returns false with an exception pending on 'cx'
+     * on failure, like JS::Evaluate().
+     */
+    template <typename MakeCode>
+    bool evaluate(JSContext* cx,
+                  const JS::CompileOptions& co,
+                  StringData raw,
+                  MakeCode&& makeCode,
+                  JS::MutableHandleValue fun) {
+        std::string key = raw.toString();
+        std::shared_ptr<const std::vector<uint8_t>> encoded;
+        {
+            stdx::lock_guard<Latch> lk(_mutex);
+            if (auto it = _cache.promote(key); it != _cache.end()) {
+                encoded = it->second;
+            }
+        }
+
+        RefPtr<JS::Stencil> stencil;
+        if (encoded &&
+            JS::DecodeStencil(
+                cx, co, JS::TranscodeRange(encoded->data(), encoded->size()), stencil) !=
+                JS::TranscodeResult::Ok) {
+            // A stale or unreadable entry is not fatal, the code is compiled again below.
+            JS_ClearPendingException(cx);
+            stencil = nullptr;
+        } else if (stencil) {
+            _hits.fetchAndAdd(1);
+        }
+
+        if (!stencil) {
+            std::string code = makeCode();
+            JS::SourceText<mozilla::Utf8Unit> srcBuf;
+            if (!srcBuf.init(cx, code.c_str(), code.length(), JS::SourceOwnership::Borrowed)) {
+                return false;
+            }
+
+            stencil = JS::CompileGlobalScriptToStencil(cx, co, srcBuf);
+            if (!stencil) {
+                return false;
+            }
+
+            JS::TranscodeBuffer buffer;
+            if (JS::EncodeStencil(cx, co, stencil, buffer) == JS::TranscodeResult::Ok) {
+                auto entry = std::make_shared<const std::vector<uint8_t>>(buffer.begin(),
+                                                                          buffer.end());
+                stdx::lock_guard<Latch> lk(_mutex);
+                _cache.add(key, std::move(entry));
+            } else {
+                // Functions which cannot be encoded are simply not cached.
+                JS_ClearPendingException(cx);
+            }
+        }
+
+        JS::RootedScript script(cx, JS::InstantiateGlobalStencil(cx, co, stencil));
+        return script && JS_ExecuteScript(cx, script, fun);
+    }
+
+private:
+    static std::unique_ptr<CompiledFunctionCache>& _instance() {
+        static StaticImmortal<std::unique_ptr<CompiledFunctionCache>> instance{
+            gJSCompiledFunctionCacheSize > 0
+                ? std::make_unique<CompiledFunctionCache>(gJSCompiledFunctionCacheSize)
+                : nullptr};
+        return *instance;
+    }
+
+    Mutex _mutex = MONGO_MAKE_LATCH("CompiledFunctionCache::_mutex");
+    LRUCache<std::string, std::shared_ptr<const std::vector<uint8_t>>> _cache;
+    AtomicWord<size_t> _hits{0};
+};
 }  // namespace
 
 thread_local MozJSImplScope::ASANHandles* currentASANHandles = nullptr;
@@ -679,18 +792,38 @@ void MozJSImplScope::newFunction(StringData raw, JS::MutableHandleValue out) {
     _runSafely([&] { _MozJSCreateFunction(raw, std::move(out)); });
 }
 
-void MozJSImplScope::_MozJSCreateFunction(StringData raw, JS::MutableHandleValue fun) {
-    std::string code = str::stream()
-        << "(" << parseJSFunctionOrExpression(_context, StringData(raw)) << ")";
+void MozJSImplScope::resetCompiledFunctionCache_forTest(size_t size) {
+    CompiledFunctionCache::reset(size);
+}
+
+size_t MozJSImplScope::getCompiledFunctionCacheHits_forTest() {
+    auto cache = CompiledFunctionCache::get();
+    return cache ? cache->hits() : 0;
+}
 
+void MozJSImplScope::_MozJSCreateFunction(StringData raw, JS::MutableHandleValue fun) {
     JS::CompileOptions co(_context);
     setCompileOptions(&co);
 
-    JS::SourceText<mozilla::Utf8Unit> srcBuf;
+    if (auto cache = CompiledFunctionCache::get()) {
+        _checkErrorState(cache->evaluate(
+            _context,
+            co,
+            raw,
+            [&]() -> std::string {
+                return str::stream() << "(" << parseJSFunctionOrExpression(_context, raw) << ")";
+            },
+            fun));
+    } else {
+        std::string code = str::stream()
+            << "(" << parseJSFunctionOrExpression(_context, StringData(raw)) << ")";
 
-    _checkErrorState(
-        srcBuf.init(_context, code.c_str(), code.length(), JS::SourceOwnership::Borrowed) &&
-        JS::Evaluate(_context, co, srcBuf, fun));
+        JS::SourceText<mozilla::Utf8Unit> srcBuf;
+
+        _checkErrorState(
+            srcBuf.init(_context, code.c_str(), code.length(), JS::SourceOwnership::Borrowed) &&
+            JS::Evaluate(_context, co, srcBuf, fun));
+    }
     uassert(10232, "not a function", fun.isObject() && js::IsFunctionObject(fun.toObjectOrNull()));
 }
 
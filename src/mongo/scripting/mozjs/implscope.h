@@ -370,6 +370,17 @@ public:
 
     bool requiresOwnedObjects() const;
 
+    /**
+     * Replaces the process-wide cache of compiled functions shared by all scopes with an empty one
+     * holding up to 'size' functions, or disables it if 'size' is 0.
+     */
+    static void resetCompiledFunctionCache_forTest(size_t size);
+
+    /**
+     * Returns the number of functions the process-wide cache has provided without compiling them.
+     */
+    static size_t getCompiledFunctionCacheHits_forTest();
+
     JS::HandleId getInternedStringId(InternedString name) {
         return _internedStrings.getInternedString(name);
     }
@@ -0,0 +1,120 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include <memory>
+#include <vector>
+
+#include "mongo/bson/bsonmisc.h"
+#include "mongo/bson/bsonobj.h"
+#include "mongo/scripting/engine.h"
+#include "mongo/scripting/mozjs/implscope.h"
+#include "mongo/unittest/assert.h"
+#include "mongo/unittest/framework.h"
+
+namespace mongo {
+namespace mozjs {
+namespace {
+
+class CompiledFunctionCacheTest : public unittest::Test {
+protected:
+    void setUp() override {
+        ScriptEngine::setup(ExecutionEnvironment::TestRunner);
+        MozJSImplScope::resetCompiledFunctionCache_forTest(16);
+    }
+
+    void tearDown() override {
+        MozJSImplScope::resetCompiledFunctionCache_forTest(0);
+    }
+
+    /**
+     * Invokes 'code' with the single argument 'x' in a new scope, so that the function is not
+     * found in the functions the scope has already created, and returns the number it returns.
+     */
+    static double invokeInNewScope(const char* code, double x) {
+        std::unique_ptr<Scope> scope(getGlobalScriptEngine()->newScope());
+        BSONObj args = BSON("x" << x);
+        scope->invoke(code, &args, nullptr);
+        return scope->getNumber("__returnValue");
+    }
+};
+
+TEST_F(CompiledFunctionCacheTest, SameFunctionInAnotherScopeIsACacheHit) {
+    const auto code = "function(x) { return x + 1; }";
+
+    ASSERT_EQ(invokeInNewScope(code, 1), 2);
+    ASSERT_EQ(MozJSImplScope::getCompiledFunctionCacheHits_forTest(), 0U);
+
+    ASSERT_EQ(invokeInNewScope(code, 2), 3);
+    ASSERT_EQ(MozJSImplScope::getCompiledFunctionCacheHits_forTest(), 1U);
+
+    ASSERT_EQ(invokeInNewScope(code, 3), 4);
+    ASSERT_EQ(MozJSImplScope::getCompiledFunctionCacheHits_forTest(), 2U);
+}
+
+TEST_F(CompiledFunctionCacheTest, DifferentFunctionsDoNotCollide) {
+    const auto plusOne = "function(x) { return x + 1; }";
+    const auto timesTwo = "function(x) { return x * 2; }";
+    const auto timesTwoReformatted = "function(x) { return x *  2; }";
+
+    ASSERT_EQ(invokeInNewScope(plusOne, 5), 6);
+    ASSERT_EQ(invokeInNewScope(timesTwo, 5), 10);
+    ASSERT_EQ(invokeInNewScope(timesTwoReformatted, 6), 12);
+    ASSERT_EQ(MozJSImplScope::getCompiledFunctionCacheHits_forTest(), 0U);
+
+    ASSERT_EQ(invokeInNewScope(timesTwo, 7), 14);
+    ASSERT_EQ(invokeInNewScope(plusOne, 7), 8);
+    ASSERT_EQ(MozJSImplScope::getCompiledFunctionCacheHits_forTest(), 2U);
+}
+
+TEST_F(CompiledFunctionCacheTest, CachedFunctionsReturnTheSameResultsAsCompiledOnes) {
+    const char* codes[] = {
+        "function(x) { return x + 1; }",
+        "function(x) { var total = 0; for (var i = 0; i <= x; ++i) { total += i; } return total; }",
+        "function(x) { return [x, x * x].reduce(function(a, b) { return a + b; }); }",
+        "function(x) { return Math.max(x, 10); }",
+    };
+
+    MozJSImplScope::resetCompiledFunctionCache_forTest(0);
+    std::vector<double> uncached;
+    for (auto code : codes) {
+        uncached.push_back(invokeInNewScope(code, 4));
+    }
+
+    MozJSImplScope::resetCompiledFunctionCache_forTest(16);
+    for (int round = 0; round < 2; ++round) {
+        for (size_t i = 0; i < uncached.size(); ++i) {
+            ASSERT_EQ(invokeInNewScope(codes[i], 4), uncached[i]);
+        }
+    }
+    ASSERT_EQ(MozJSImplScope::getCompiledFunctionCacheHits_forTest(), uncached.size());
+}
+
+}  // namespace
+}  // namespace mozjs
+}  // namespace mongo
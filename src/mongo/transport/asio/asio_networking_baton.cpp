@@ -35,13 +35,18 @@
 #include "mongo/base/checked_cast.h"
 #include "mongo/base/error_codes.h"
 #include "mongo/base/status.h"
+#include "mongo/bson/bsonobjbuilder.h"
 #include "mongo/db/operation_context.h"
 #include "mongo/logv2/log.h"
 #include "mongo/platform/compiler_gcc.h"
+#include "mongo/platform/pause.h"
+#include "mongo/transport/transport_options_gen.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/errno_util.h"
 #include "mongo/util/fail_point.h"
+#include "mongo/util/scopeguard.h"
 #include "mongo/util/time_support.h"
+#include "mongo/util/timer.h"
 
 #define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kNetwork
 
@@ -52,6 +57,57 @@ namespace {
 
 MONGO_FAIL_POINT_DEFINE(blockAsioNetworkingBatonBeforePoll);
 
+struct BusyPollStats {
+    // Waits that spun before blocking.
+    AtomicWord<long long> spins;
+    // Spins that saw an event, so the thread never blocked.
+    AtomicWord<long long> hits;
+    // Spins that ran out their window and went on to block.
+    AtomicWord<long long> sleeps;
+    // Waits that blocked right away because the maximum number of batons were already spinning.
+    AtomicWord<long long> overBudget;
+};
+
+BusyPollStats busyPollStats;
+AtomicWord<int> activeBusyPollers;
+
+/**
+ * Spins on a non-blocking `::poll` of 'pollSet' for up to asioNetworkingBatonBusyPollMicros,
+ * bounded by 'timeout' (in milliseconds, -1 for none). Returns the number of ready events, or 0 if
+ * the caller should go on to block, in which case 'timeout' is reduced by the time spent spinning.
+ */
+int busyPoll(std::vector<::pollfd>& pollSet, int& timeout) {
+    const auto window = gAsioNetworkingBatonBusyPollMicros.load();
+    if (window <= 0)
+        return 0;
+
+    if (activeBusyPollers.fetchAndAdd(1) >= gAsioNetworkingBatonMaxBusyPollers.load()) {
+        activeBusyPollers.fetchAndSubtract(1);
+        busyPollStats.overBudget.fetchAndAdd(1);
+        return 0;
+    }
+    ON_BLOCK_EXIT([] { activeBusyPollers.fetchAndSubtract(1); });
+    busyPollStats.spins.fetchAndAdd(1);
+
+    const long long spinMicros = timeout < 0 ? window : std::min<long long>(window, timeout * 1000);
+    Timer timer;
+    do {
+        int events = ::poll(pollSet.data(), pollSet.size(), 0);
+        if (events > 0) {
+            busyPollStats.hits.fetchAndAdd(1);
+            return events;
+        }
+        if (events < 0)
+            break;  // Let the blocking poll surface the error.
+        MONGO_YIELD_CORE_FOR_SMT();
+    } while (timer.micros() < spinMicros);
+
+    busyPollStats.sleeps.fetchAndAdd(1);
+    if (timeout > 0)
+        timeout = std::max(0, timeout - timer.millis());
+    return 0;
+}
+
 Status getDetachedError() {
     return {ErrorCodes::ShutdownInProgress, "Baton detached"};
 }
@@ -451,6 +507,14 @@ void AsioNetworkingBaton::_safeExecute(stdx::unique_lock<Mutex> lk, AsioNetworki
     }
 }
 
+void AsioNetworkingBaton::appendBusyPollStats(BSONObjBuilder* bob) {
+    BSONObjBuilder sub(bob->subobjStart("batonBusyPoll"));
+    sub.append("spins", busyPollStats.spins.load());
+    sub.append("hits", busyPollStats.hits.load());
+    sub.append("sleeps", busyPollStats.sleeps.load());
+    sub.append("overBudget", busyPollStats.overBudget.load());
+}
+
 std::pair<std::list<Promise<void>>, std::list<Promise<void>>> AsioNetworkingBaton::_poll(
     stdx::unique_lock<Mutex>& lk, ClockSource* clkSource) {
     const auto now = clkSource->now();
@@ -534,6 +598,13 @@ std::pair<std::list<Promise<void>>, std::list<Promise<void>>> AsioNetworkingBato
                 : deadline ? Milliseconds(*deadline - now).count()
                            : -1;
 
+            // A single session is the shape of a targeted remote command, where the reply is likely
+            // to arrive soon enough that spinning beats the wakeup of a blocking poll.
+            if (timeout != 0 && _sessions.size() == 1) {
+                if (int events = busyPoll(_pollSet, timeout))
+                    return events;
+            }
+
             int events = ::poll(_pollSet.data(), _pollSet.size(), timeout);
             if (events < 0) {
                 auto ec = lastSystemError();
@@ -36,6 +36,7 @@
 
 #include <poll.h>
 
+#include "mongo/bson/bsonobjbuilder.h"
 #include "mongo/platform/atomic_word.h"
 #include "mongo/platform/mutex.h"
 #include "mongo/platform/waitable_atomic.h"
@@ -106,6 +107,12 @@ public:
         return _tl;
     }
 
+    /**
+     * Appends the process-wide counters of the busy-poll window that precedes blocking polls, see
+     * asioNetworkingBatonBusyPollMicros.
+     */
+    static void appendBusyPollStats(BSONObjBuilder* bob);
+
 private:
     struct Timer {
         size_t id;  // Stores the unique identifier for the timer, provided by `ReactorTimer`.
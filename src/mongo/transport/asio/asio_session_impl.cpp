@@ -39,6 +39,7 @@
 #include "mongo/transport/asio/asio_utils.h"
 #include "mongo/transport/proxy_protocol_header_parser.h"
 #include "mongo/transport/session_util.h"
+#include "mongo/transport/transport_options_gen.h"
 #include "mongo/util/assert_util.h"
 #include "mongo/util/future_util.h"
 #include "mongo/util/net/socket_utils.h"
@@ -188,6 +189,9 @@ Future<Message> CommonAsioSession::asyncSourceMessage(const BatonHandle& baton)
 
 Status CommonAsioSession::waitForData() noexcept try {
     ensureSync();
+    if (hasReadAheadBytes()) {
+        return Status::OK();
+    }
     asio::error_code ec;
     getSocket().wait(asio::ip::tcp::socket::wait_read, ec);
     return errorCodeToStatus(ec, "waitForData");
@@ -197,6 +201,9 @@ Status CommonAsioSession::waitForData() noexcept try {
 
 Future<void> CommonAsioSession::asyncWaitForData() noexcept try {
     ensureAsync();
+    if (hasReadAheadBytes()) {
+        return Future<void>::makeReady();
+    }
     return getSocket().async_wait(asio::ip::tcp::socket::wait_read, UseFuture{});
 } catch (const DBException& ex) {
     return ex.toStatus();
@@ -304,6 +311,7 @@ Status CommonAsioSession::buildSSLSocket(const HostAndPort& target) {
 Future<void> CommonAsioSession::handshakeSSLForEgress(const HostAndPort& target,
                                                       const ReactorHandle& reactor) {
     invariant(_sslSocket, "SSL Socket expected to be built");
+    getSSLManager()->prepareEgressHandshake(_sslSocket->native_handle(), target);
     auto doHandshake = [&] {
         if (_blockingMode == sync) {
             std::error_code ec;
@@ -376,6 +384,15 @@ void SyncAsioSession::ensureAsync() {
     invariant(false, "Attempted to use SyncAsioSession in async mode.");
 }
 
+Future<void> SyncAsioSession::asyncWaitForData() noexcept try {
+    if (hasReadAheadBytes()) {
+        return Future<void>::makeReady();
+    }
+    return getSocket().async_wait(asio::ip::tcp::socket::wait_read, UseFuture{});
+} catch (const DBException& ex) {
+    return ex.toStatus();
+}
+
 auto CommonAsioSession::getSocket() -> GenericSocket& {
 #ifdef MONGO_CONFIG_SSL
     if (_sslSocket) {
@@ -434,7 +451,10 @@ Future<Message> CommonAsioSession::sourceMessageImpl(const BatonHandle& baton) {
     auto headerBuffer = SharedBuffer::allocate(kHeaderSize);
     auto ptr = headerBuffer.get();
     _asyncOpState.start();
-    return read(asio::buffer(ptr, kHeaderSize), baton)
+    if (!hasReadAheadBytes()) {
+        fillReadAheadBuffer();
+    }
+    return readWithReadAhead(ptr, kHeaderSize, baton)
         .then([headerBuffer = std::move(headerBuffer), this, baton]() mutable {
             if (checkForHTTPRequest(asio::buffer(headerBuffer.get(), kHeaderSize))) {
                 return sendHTTPResponse(baton);
@@ -467,7 +487,7 @@ Future<Message> CommonAsioSession::sourceMessageImpl(const BatonHandle& baton) {
             memcpy(buffer.get(), headerBuffer.get(), kHeaderSize);
 
             MsgData::View msgView(buffer.get());
-            return read(asio::buffer(msgView.data(), msgView.dataLen()), baton)
+            return readWithReadAhead(msgView.data(), msgView.dataLen(), baton)
                 .then([this, buffer = std::move(buffer), msgLen]() mutable {
                     if (_isIngressSession) {
                         networkCounter.hitPhysicalIn(msgLen);
@@ -507,6 +527,48 @@ Future<void> CommonAsioSession::read(const MutableBufferSequence& buffers,
     return opportunisticRead(_socket, buffers, baton);
 }
 
+Future<void> CommonAsioSession::readWithReadAhead(char* data,
+                                                  size_t len,
+                                                  const BatonHandle& baton) {
+    const auto buffered = std::min(len, _readAheadEnd - _readAheadBegin);
+    if (buffered > 0) {
+        memcpy(data, _readAheadBuffer.get() + _readAheadBegin, buffered);
+        _readAheadBegin += buffered;
+    }
+    if (buffered == len) {
+        return Future<void>::makeReady();
+    }
+    return read(asio::buffer(data + buffered, len - buffered), baton);
+}
+
+void CommonAsioSession::fillReadAheadBuffer() {
+    const auto bufferSize = static_cast<size_t>(gAsioReadAheadBufferSizeBytes);
+    if (bufferSize == 0) {
+        return;
+    }
+#ifdef MONGO_CONFIG_SSL
+    if (_sslSocket || !_ranHandshake) {
+        return;
+    }
+#endif
+    // A read that times out here would be retried by the regular read path, doubling the timeout.
+    if (_blockingMode == sync && _socketTimeout) {
+        return;
+    }
+    if (!_readAheadBuffer) {
+        _readAheadBuffer = std::make_unique<char[]>(bufferSize);
+    }
+
+    std::error_code ec;
+    size_t size;
+    do {
+        size = _socket.read_some(asio::buffer(_readAheadBuffer.get(), bufferSize), ec);
+    } while (ec == asio::error::interrupted);  // retry syscall EINTR
+
+    _readAheadBegin = 0;
+    _readAheadEnd = ec ? 0 : size;
+}
+
 template <typename ConstBufferSequence>
 Future<void> CommonAsioSession::write(const ConstBufferSequence& buffers,
                                       const BatonHandle& baton) {
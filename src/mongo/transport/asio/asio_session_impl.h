@@ -30,6 +30,7 @@
 #pragma once
 
 #include <asio.hpp>
+#include <memory>
 #include <utility>
 
 #include "mongo/config.h"
@@ -188,6 +189,23 @@ protected:
     template <typename MutableBufferSequence>
     Future<void> read(const MutableBufferSequence& buffers, const BatonHandle& baton = nullptr);
 
+    /**
+     * Reads len bytes into data, taking them from the read-ahead buffer first and only going to
+     * the socket for whatever it cannot provide.
+     */
+    Future<void> readWithReadAhead(char* data, size_t len, const BatonHandle& baton);
+
+    /**
+     * Reads whatever the socket already holds into the empty read-ahead buffer with one syscall.
+     * Only plain-text sessions that are past the SSL handshake check read ahead, and any error is
+     * left for the regular read path to report.
+     */
+    void fillReadAheadBuffer();
+
+    bool hasReadAheadBytes() const {
+        return _readAheadBegin < _readAheadEnd;
+    }
+
     template <typename ConstBufferSequence>
     Future<void> write(const ConstBufferSequence& buffers, const BatonHandle& baton = nullptr);
 
@@ -294,6 +312,12 @@ protected:
 
     AsyncOperationState _asyncOpState;
 
+    // Bytes read from the socket past the end of the last sourced message. They are consumed
+    // before the socket is read again.
+    std::unique_ptr<char[]> _readAheadBuffer;
+    size_t _readAheadBegin = 0;
+    size_t _readAheadEnd = 0;
+
     /**
      * Strictly orders the start and cancellation of asynchronous operations:
      * - Holding the mutex while starting asynchronous operations (e.g., adding the session to the
@@ -348,6 +372,12 @@ public:
         end();
     }
 
+    /**
+     * Waiting for readability doesn't depend on the socket's blocking mode, so a sync session may
+     * park on its reactor between requests and still source them synchronously.
+     */
+    Future<void> asyncWaitForData() noexcept override;
+
 protected:
     void ensureSync() override;
     void ensureAsync() override;
@@ -32,6 +32,7 @@
 #include "mongo/db/commands/server_status.h"
 #include "mongo/transport/hello_metrics.h"
 #include "mongo/transport/service_executor.h"
+#include "mongo/transport/service_executor_gen.h"
 #include "mongo/transport/service_executor_reserved.h"
 #include "mongo/transport/session.h"
 #include "mongo/transport/transport_layer_manager.h"
@@ -77,7 +78,9 @@ void AsioSessionManager::configureServiceExecutorContext(Client* client,
     // TODO SERVER-77921: use the return value of `Session::isFromRouterPort()` to choose an
     // instance of `ServiceEntryPoint`.
     auto seCtx = std::make_unique<ServiceExecutorContext>();
-    seCtx->setThreadModel(ServiceExecutorContext::kSynchronous);
+    seCtx->setThreadModel(gInitialServiceExecutorUseDedicatedThread
+                              ? ServiceExecutorContext::kSynchronous
+                              : ServiceExecutorContext::kBorrowed);
     seCtx->setCanUseReserved(isPrivilegedSession);
     stdx::lock_guard lk(*client);
     ServiceExecutorContext::set(client, std::move(seCtx));
@@ -97,10 +100,8 @@ void AsioSessionManager::appendStats(BSONObjBuilder* bob) const {
 
     appendInt("active", getActiveOperations());
 
-    // Historically, this number may have differed from "current" since
-    // some sessions would have used the non-threaded ServiceExecutorFixed.
-    // Currently all sessions are threaded, so this number is redundant.
-    appendInt("threaded", sessionCount);
+    // Sessions on the ServiceExecutorFixed share its worker threads, so they aren't threaded.
+    appendInt("threaded", gInitialServiceExecutorUseDedicatedThread ? sessionCount : 0);
     if (!serverGlobalParams.maxConnsOverride.empty()) {
         appendInt("limitExempt", serviceExecutorStats.limitExempt.load());
     }
@@ -1149,6 +1149,9 @@ std::vector<std::pair<SockAddr, int>> AsioTransportLayer::getListenerSocketBackl
 
 void AsioTransportLayer::appendStatsForServerStatus(BSONObjBuilder* bob) const {
     bob->append("listenerProcessingTime", _listenerProcessingTime.load().toBSON());
+#ifdef __linux__
+    AsioNetworkingBaton::appendBusyPollStats(bob);
+#endif
 }
 
 void AsioTransportLayer::appendStatsForFTDC(BSONObjBuilder& bob) const {
@@ -32,6 +32,7 @@
 #include <exception>
 #include <fstream>
 #include <queue>
+#include <string>
 #include <system_error>
 #include <utility>
 #include <vector>
@@ -51,6 +52,9 @@
 #include "mongo/platform/basic.h"
 #include "mongo/rpc/op_msg.h"
 #include "mongo/stdx/thread.h"
+#ifdef __linux__
+#include "mongo/transport/asio/asio_networking_baton.h"
+#endif
 #include "mongo/transport/asio/asio_session.h"
 #include "mongo/transport/asio/asio_tcp_fast_open.h"
 #include "mongo/transport/baton.h"
@@ -458,6 +462,44 @@ TEST(AsioTransportLayer, SourceSyncTimeoutSucceeds) {
     ASSERT_OK(received.get().getStatus());
 }
 
+/** Messages that arrive together are all sourced intact when the session reads ahead. */
+TEST(AsioTransportLayer, SourceBackToBackMessagesWithReadAhead) {
+    RAIIServerParameterControllerForTest readAhead{"asioReadAheadBufferSizeBytes", 16 * 1024};
+    constexpr int kNumMessages = 3;
+    TestFixture tf;
+    test::BlockingQueue<StatusWith<Message>> received;
+    tf.sessionManager().setOnStartSession([&](test::SessionThread& st) {
+        st.schedule([&](auto& session) {
+            for (int i = 0; i < kNumMessages; ++i) {
+                received.push(session.sourceMessage());
+            }
+        });
+    });
+
+    std::string payload;
+    std::vector<std::string> sent;
+    for (int i = 0; i < kNumMessages; ++i) {
+        OpMsgBuilder builder;
+        builder.setBody(BSON("ping" << 1 << "seq" << i));
+        Message msg = builder.finish();
+        msg.header().setResponseToMsgId(0);
+        msg.header().setId(i);
+        sent.emplace_back(msg.buf(), msg.size());
+        payload += sent.back();
+    }
+
+    SyncClient conn(tf.tla().listenerPort());
+    auto ec = conn.write(payload.data(), payload.size());
+    ASSERT_FALSE(ec) << errorMessage(ec);
+
+    for (int i = 0; i < kNumMessages; ++i) {
+        auto swMsg = received.pop();
+        ASSERT_OK(swMsg.getStatus());
+        const auto& msg = swMsg.getValue();
+        ASSERT_EQ(std::string(msg.buf(), msg.size()), sent[i]);
+    }
+}
+
 /** Switching from timeouts to no timeouts must reset the timeout to unlimited. */
 TEST(AsioTransportLayer, SwitchTimeoutModes) {
     TestFixture tf;
@@ -1396,6 +1438,33 @@ TEST_F(IngressAsioNetworkingBatonTest, NotifyBeforePollNoSessions) {
     ASSERT_EQ(state, Waitable::TimeoutState::Timeout);
 }
 
+BSONObj busyPollStats() {
+    BSONObjBuilder bob;
+    AsioNetworkingBaton::appendBusyPollStats(&bob);
+    return bob.obj()["batonBusyPoll"].Obj().getOwned();
+}
+
+TEST_F(IngressAsioNetworkingBatonTest, BusyPollSpinsBeforeBlocking) {
+    // With a busy-poll window configured, a baton waiting on a single session spins before it
+    // blocks in `::poll`. Nothing arrives on the session here, so the spin ends in a sleep.
+    RAIIServerParameterControllerForTest busyPoll{"asioNetworkingBatonBusyPollMicros", 200};
+    auto opCtx = client().makeOperationContext();
+    auto baton = opCtx->getBaton()->networking();
+    auto clkSource = getServiceContext()->getPreciseClockSource();
+    auto session = client().session();
+
+    baton->addSession(*session, NetworkingBaton::Type::In).getAsync([](Status) {});
+
+    const auto before = busyPollStats();
+    auto state = baton->run_until(clkSource, clkSource->now() + Milliseconds(5));
+    ASSERT_EQ(state, Waitable::TimeoutState::Timeout);
+
+    const auto after = busyPollStats();
+    ASSERT_GTE(after["spins"].numberLong(), before["spins"].numberLong() + 1);
+    ASSERT_GTE(after["sleeps"].numberLong(), before["sleeps"].numberLong() + 1);
+    ASSERT_EQ(after["hits"].numberLong(), before["hits"].numberLong());
+}
+
 void blockIfBatonPolls(Client& client,
                        std::function<void(const BatonHandle&, Notification<void>&)> modifyBaton) {
     Notification<void> notification;
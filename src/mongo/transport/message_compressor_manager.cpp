@@ -48,6 +48,7 @@
 #include "mongo/logv2/log_component.h"
 #include "mongo/rpc/message.h"
 #include "mongo/transport/message_compressor_manager.h"
+#include "mongo/transport/message_compressor_manager_gen.h"
 #include "mongo/transport/message_compressor_registry.h"
 #include "mongo/transport/session.h"
 #include "mongo/util/assert_util_core.h"
@@ -89,6 +90,16 @@ struct CompressionHeader {
 
 const transport::Session::Decoration<MessageCompressorManager> getForSession =
     transport::Session::declareDecoration<MessageCompressorManager>();
+
+// Compressed bytes a connection must have produced before its observed ratio is acted upon.
+constexpr int64_t kSkipRatioMinimumSampleBytes = 64 * 1024;
+
+// Once the observed history exceeds this many input bytes it is halved, so a connection whose
+// payloads become compressible again is noticed within a few probes.
+constexpr int64_t kSkipRatioHistoryBytes = 4 * kSkipRatioMinimumSampleBytes;
+
+// While skipping on ratio, every this many messages is still compressed to refresh the ratio.
+constexpr int kSkipRatioProbeInterval = 16;
 }  // namespace
 
 MessageCompressorManager::MessageCompressorManager()
@@ -110,6 +121,15 @@ StatusWith<Message> MessageCompressorManager::compressMessage(
         return {msg};
     }
 
+    if (!_shouldCompress(msg.dataSize())) {
+        LOGV2_DEBUG(9156638,
+                    3,
+                    "Sending message uncompressed because compression is unlikely to pay off",
+                    "compressor"_attr = compressor->getName(),
+                    "dataSize"_attr = msg.dataSize());
+        return {msg};
+    }
+
     LOGV2_DEBUG(22925, 3, "Compressing message", "compressor"_attr = compressor->getName());
 
     auto inputHeader = msg.header();
@@ -147,10 +167,42 @@ StatusWith<Message> MessageCompressorManager::compressMessage(
 
     auto realCompressedSize = sws.getValue();
     outMessage.setLen(realCompressedSize + CompressionHeader::size() + MsgData::MsgDataHeaderSize);
+    _recordCompression(input.length(), realCompressedSize + CompressionHeader::size());
 
     return {Message(outputMessageBuffer)};
 }
 
+bool MessageCompressorManager::_shouldCompress(int dataSize) {
+    if (dataSize < gMessageCompressionMinimumSizeBytes.load()) {
+        return false;
+    }
+
+    const auto skipRatio = gMessageCompressionSkipRatio.load();
+    if (skipRatio <= 0 || _observedBytesIn < kSkipRatioMinimumSampleBytes) {
+        return true;
+    }
+
+    if (static_cast<double>(_observedBytesOut) / _observedBytesIn <= skipRatio) {
+        _skippedSinceProbe = 0;
+        return true;
+    }
+
+    if (++_skippedSinceProbe < kSkipRatioProbeInterval) {
+        return false;
+    }
+    _skippedSinceProbe = 0;
+    return true;
+}
+
+void MessageCompressorManager::_recordCompression(int64_t bytesIn, int64_t bytesOut) {
+    _observedBytesIn += bytesIn;
+    _observedBytesOut += bytesOut;
+    if (_observedBytesIn > kSkipRatioHistoryBytes) {
+        _observedBytesIn /= 2;
+        _observedBytesOut /= 2;
+    }
+}
+
 StatusWith<Message> MessageCompressorManager::decompressMessage(const Message& msg,
                                                                 MessageCompressorId* compressorId) {
     auto inputHeader = msg.header();
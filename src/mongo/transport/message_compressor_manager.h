@@ -101,7 +101,10 @@ public:
      * parameter value for compressorId from a call to decompressMessage.
      *
      * If _negotiated is empty (meaning compression was not negotiated or is not supported), then
-     * it will return a ref-count bumped copy of the input message.
+     * it will return a ref-count bumped copy of the input message. The same happens when the
+     * message is below messageCompressionMinimumSizeBytes, or when messages on this connection
+     * have been compressing worse than messageCompressionSkipRatio allows; peers accept
+     * uncompressed messages regardless of what was negotiated.
      *
      * If an error occurs in the compressor, it will return a Status error.
      */
@@ -133,8 +136,24 @@ public:
     static MessageCompressorManager& forSession(const std::shared_ptr<transport::Session>& session);
 
 private:
+    /*
+     * Decides whether a message whose body is 'dataSize' bytes is worth compressing, based on the
+     * size threshold and the ratio observed for earlier messages managed by this object.
+     */
+    bool _shouldCompress(int dataSize);
+
+    void _recordCompression(int64_t bytesIn, int64_t bytesOut);
+
     std::vector<MessageCompressorBase*> _negotiated;
     MessageCompressorRegistry* _registry;
+
+    // Bytes fed into and produced by compressMessage on this connection, decayed so that the
+    // ratio follows changes in the payloads.
+    int64_t _observedBytesIn = 0;
+    int64_t _observedBytesOut = 0;
+
+    // Messages sent uncompressed because of a poor ratio since the last probe.
+    int _skippedSinceProbe = 0;
 };
 
 }  // namespace mongo
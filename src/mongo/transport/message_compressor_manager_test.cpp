@@ -50,6 +50,7 @@
 #include "mongo/bson/bsonmisc.h"
 #include "mongo/bson/bsonobjbuilder.h"
 #include "mongo/bson/bsontypes.h"
+#include "mongo/idl/server_parameter_test_util.h"
 #include "mongo/rpc/message.h"
 #include "mongo/transport/message_compressor_manager.h"
 #include "mongo/transport/message_compressor_noop.h"
@@ -189,8 +190,7 @@ void checkOverflow(std::unique_ptr<MessageCompressorBase> compressor) {
         compressor->decompressData(tooSmallRange, DataRange(scratch.data(), scratch.size())));
 }
 
-Message buildMessage() {
-    const auto data = std::string{"Hello, world!"};
+Message buildMessage(const std::string& data = "Hello, world!") {
     const auto bufferSize = MsgData::MsgDataHeaderSize + data.size();
     auto buf = SharedBuffer::allocate(bufferSize);
     MsgData::View testView(buf.get());
@@ -445,5 +445,44 @@ TEST(MessageCompressorManager, RuntMessage) {
     ASSERT_NOT_OK(status);
 }
 
+MessageCompressorManager buildNegotiatedNoopManager(MessageCompressorRegistry* registry) {
+    MessageCompressorManager mgr(registry);
+    BSONObjBuilder negotiatorOut;
+    std::vector<StringData> negotiator({"noop"_sd});
+    mgr.serverNegotiate(negotiator, &negotiatorOut);
+    checkNegotiationResult(negotiatorOut.done(), {"noop"});
+    return mgr;
+}
+
+TEST(MessageCompressorManager, SmallMessagesAreNotCompressed) {
+    RAIIServerParameterControllerForTest minSize{"messageCompressionMinimumSizeBytes", 1024};
+    auto registry = buildRegistry();
+    auto mgr = buildNegotiatedNoopManager(&registry);
+
+    auto small = assertOk(mgr.compressMessage(buildMessage()));
+    ASSERT_EQ(small.operation(), dbQuery);
+
+    auto large = assertOk(mgr.compressMessage(buildMessage(std::string(2048, 'x'))));
+    ASSERT_EQ(large.operation(), dbCompressed);
+}
+
+TEST(MessageCompressorManager, PoorRatioSkipsCompressionWithPeriodicProbe) {
+    RAIIServerParameterControllerForTest skipRatio{"messageCompressionSkipRatio", 0.5};
+    auto registry = buildRegistry();
+    auto mgr = buildNegotiatedNoopManager(&registry);
+    const auto msg = buildMessage(std::string(8 * 1024, 'x'));
+
+    // The noop compressor never shrinks its input, so once 64KB have been observed the manager
+    // stops compressing, except for one probe message in every 16.
+    for (int i = 0; i < 8; ++i) {
+        ASSERT_EQ(assertOk(mgr.compressMessage(msg)).operation(), dbCompressed);
+    }
+    for (int i = 0; i < 15; ++i) {
+        ASSERT_EQ(assertOk(mgr.compressMessage(msg)).operation(), dbQuery);
+    }
+    ASSERT_EQ(assertOk(mgr.compressMessage(msg)).operation(), dbCompressed);
+    ASSERT_EQ(assertOk(mgr.compressMessage(msg)).operation(), dbQuery);
+}
+
 }  // namespace
 }  // namespace mongo
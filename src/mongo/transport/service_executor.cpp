@@ -39,6 +39,7 @@
 #include "mongo/stdx/thread.h"
 #include "mongo/transport/service_entry_point.h"
 #include "mongo/transport/service_executor.h"
+#include "mongo/transport/service_executor_fixed.h"
 #include "mongo/transport/service_executor_reserved.h"
 #include "mongo/transport/service_executor_synchronous.h"
 #include "mongo/transport/session_manager.h"
@@ -99,6 +100,7 @@ void forEachServiceExecutor(ServiceContext* svcCtx, const Func& func) {
     call(std::type_identity<ServiceExecutorSynchronous>{});
     call(std::type_identity<ServiceExecutorReserved>{});
     call(std::type_identity<ServiceExecutorInline>{});
+    call(std::type_identity<ServiceExecutorFixed>{});
 }
 
 }  // namespace
@@ -175,6 +177,12 @@ ServiceExecutor* ServiceExecutorContext::getServiceExecutor() {
     switch (_threadModel) {
         case ThreadModel::kInline:
             return ServiceExecutorInline::get(_client->getServiceContext());
+        case ThreadModel::kBorrowed:
+            if (auto exec = ServiceExecutorFixed::get(_client->getServiceContext());
+                exec && !(_canUseReserved && shouldUseReserved(_client))) {
+                return exec;
+            }
+            [[fallthrough]];
         case ThreadModel::kSynchronous: {
             if (_canUseReserved && !_hasUsedSynchronous && shouldUseReserved(_client)) {
                 if (auto exec = ServiceExecutorReserved::get(_client->getServiceContext())) {
@@ -106,6 +106,15 @@ public:
     /** Yield if this executor controls more threads than we have cores. */
     void yieldIfAppropriate() const;
 
+    /**
+     * Returns whether a client keeps the thread it was scheduled on until it is done. Executors
+     * that share threads between clients return false, and expect each scheduled task to return
+     * rather than block waiting on the client's next request.
+     */
+    virtual bool usesDedicatedThreads() const {
+        return true;
+    }
+
     /**
      * Returns the class name of this service executor.
      * Used in logging and exception messaging.
@@ -120,9 +129,12 @@ class ServiceExecutorContext {
 public:
     // Roughly a 1:1 mapping to the ServiceExecutor type which will be used.
     // ThreadModel::kSynchronous + canUseReserved may result in ServiceExecutorReserved.
+    // ThreadModel::kBorrowed uses ServiceExecutorFixed, or ServiceExecutorSynchronous if that
+    // executor was not configured.
     enum class ThreadModel {
         kSynchronous,
         kInline,
+        kBorrowed,
     };
 
     // Manually hoist these enum values into the class to aid callsite usage.
@@ -130,6 +142,7 @@ public:
     // `using enum ThreadModel;`
     static constexpr inline auto kSynchronous = ThreadModel::kSynchronous;
     static constexpr inline auto kInline = ThreadModel::kInline;
+    static constexpr inline auto kBorrowed = ThreadModel::kBorrowed;
 
     /**
      * Get a pointer to the ServiceExecutorContext for a given client.
@@ -0,0 +1,293 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+
+#include "mongo/transport/service_executor_fixed.h"
+
+#include <algorithm>
+#include <mutex>
+#include <utility>
+
+#include "mongo/base/error_codes.h"
+#include "mongo/base/string_data.h"
+#include "mongo/logv2/log.h"
+#include "mongo/logv2/log_attr.h"
+#include "mongo/logv2/log_component.h"
+#include "mongo/transport/service_executor_gen.h"
+#include "mongo/transport/service_executor_utils.h"
+#include "mongo/util/assert_util.h"
+#include "mongo/util/concurrency/thread_name.h"
+#include "mongo/util/decorable.h"
+#include "mongo/util/future.h"
+#include "mongo/util/scopeguard.h"
+
+#define MONGO_LOGV2_DEFAULT_COMPONENT ::mongo::logv2::LogComponent::kExecutor
+
+
+namespace mongo::transport {
+namespace {
+
+constexpr auto kExecutorName = "fixed"_sd;
+
+constexpr auto kThreadsRunning = "threadsRunning"_sd;
+constexpr auto kThreadsBorrowed = "threadsBorrowed"_sd;
+constexpr auto kClientsInTotal = "clientsInTotal"_sd;
+constexpr auto kClientsRunning = "clientsRunning"_sd;
+constexpr auto kClientsWaiting = "clientsWaitingForData"_sd;
+
+const auto getServiceExecutorFixed =
+    ServiceContext::declareDecoration<std::unique_ptr<ServiceExecutorFixed>>();
+
+const auto serviceExecutorFixedRegisterer = ServiceContext::ConstructorActionRegisterer{
+    "ServiceExecutorFixed", [](ServiceContext* ctx) {
+        if (gInitialServiceExecutorUseDedicatedThread) {
+            return;
+        }
+
+        getServiceExecutorFixed(ctx) =
+            std::make_unique<ServiceExecutorFixed>(fixedServiceExecutorThreadLimit);
+    }};
+}  // namespace
+
+ServiceExecutorFixed::ServiceExecutorFixed(size_t threadLimit) : _threadLimit(threadLimit) {}
+
+ServiceExecutorFixed* ServiceExecutorFixed::get(ServiceContext* ctx) {
+    // The ServiceExecutorFixed is absent unless clients are configured to not use dedicated
+    // threads, so nullptr is okay.
+    return getServiceExecutorFixed(ctx).get();
+}
+
+void ServiceExecutorFixed::start() {
+    stdx::lock_guard lk(_mutex);
+    _stillRunning.store(true);
+}
+
+Status ServiceExecutorFixed::shutdown(Milliseconds timeout) {
+    LOGV2_DEBUG(9156635, 3, "Shutting down fixed executor");
+
+    stdx::unique_lock lk(_mutex);
+    _stillRunning.store(false);
+    _threadWakeup.notify_all();
+
+    for (auto& reactor : _reactors) {
+        reactor->stop();
+    }
+    auto reactorThreads = std::exchange(_reactorThreads, {});
+    lk.unlock();
+    for (auto& thread : reactorThreads) {
+        thread.join();
+    }
+    lk.lock();
+
+    bool result = _shutdownCondition.wait_for(
+        lk, timeout.toSystemDuration(), [this]() { return _numRunningThreads.load() == 0; });
+
+    return result
+        ? Status::OK()
+        : Status(ErrorCodes::Error::ExceededTimeLimit,
+                 "fixed executor couldn't shutdown all worker threads within time limit.");
+}
+
+void ServiceExecutorFixed::_startWorker(WithLock) {
+    ++_numWorkers;
+    _numRunningThreads.fetchAndAdd(1);
+    auto status = launchServiceWorkerThread([this] {
+        stdx::unique_lock lk(_mutex);
+        while (_stillRunning.load()) {
+            ++_numIdleWorkers;
+            _threadWakeup.wait(lk, [&] { return !_stillRunning.load() || !_readyTasks.empty(); });
+            --_numIdleWorkers;
+
+            if (!_stillRunning.load()) {
+                break;
+            }
+
+            auto task = std::move(_readyTasks.front());
+            _readyTasks.pop_front();
+            lk.unlock();
+            task(Status::OK());
+            lk.lock();
+        }
+
+        --_numWorkers;
+        _numRunningThreads.fetchAndSubtract(1);
+        _shutdownCondition.notify_all();
+    });
+
+    if (!status.isOK()) {
+        --_numWorkers;
+        _numRunningThreads.fetchAndSubtract(1);
+        LOGV2_WARNING(9156636, "Could not start new fixed worker thread", "error"_attr = status);
+    }
+}
+
+void ServiceExecutorFixed::_schedule(Task task) {
+    if (!_stillRunning.load()) {
+        task(Status(ErrorCodes::ShutdownInProgress, "Executor is not running"));
+        return;
+    }
+
+    stdx::unique_lock lk(_mutex);
+    _readyTasks.push_back(std::move(task));
+    if (_numIdleWorkers >= _readyTasks.size()) {
+        _threadWakeup.notify_one();
+        return;
+    }
+
+    if (_numWorkers < _threadLimit) {
+        _startWorker(lk);
+        return;
+    }
+
+    // Every worker is busy, most likely blocked inside an operation. Borrow a thread for the task
+    // rather than make it queue behind them. The task stays queued until the thread takes it, so
+    // the next free worker runs it if the thread can't be started.
+    _numRunningThreads.fetchAndAdd(1);
+    _numBorrowedThreads.fetchAndAdd(1);
+    lk.unlock();
+
+    auto status = launchServiceWorkerThread([this] {
+        stdx::unique_lock lk(_mutex);
+        ScopeGuard threadGuard([&] {
+            _numBorrowedThreads.fetchAndSubtract(1);
+            _numRunningThreads.fetchAndSubtract(1);
+            _shutdownCondition.notify_all();
+        });
+
+        if (!_stillRunning.load() || _readyTasks.empty()) {
+            return;
+        }
+
+        auto task = std::move(_readyTasks.front());
+        _readyTasks.pop_front();
+        lk.unlock();
+        task(Status::OK());
+        lk.lock();
+    });
+
+    if (!status.isOK()) {
+        lk.lock();
+        _numBorrowedThreads.fetchAndSubtract(1);
+        _numRunningThreads.fetchAndSubtract(1);
+        LOGV2_WARNING(
+            9156637, "Could not borrow a thread for the fixed executor", "error"_attr = status);
+    }
+}
+
+void ServiceExecutorFixed::_ensureReactorIsRunning(const ReactorHandle& reactor) {
+    stdx::lock_guard lk(_mutex);
+    if (!_stillRunning.load() ||
+        std::find(_reactors.begin(), _reactors.end(), reactor) != _reactors.end()) {
+        return;
+    }
+
+    _reactors.push_back(reactor);
+    _reactorThreads.emplace_back([reactor] {
+        setThreadName("ServiceExecutorFixedReactor");
+        reactor->run();
+    });
+}
+
+/**
+ * Parks the session on the reactor until it has data to read, then queues the task onto the
+ * worker pool. Errors are handed to the pool as well so client work never runs on the reactor.
+ */
+void ServiceExecutorFixed::_runOnDataAvailable(const std::shared_ptr<Session>& session, Task task) {
+    invariant(session);
+    if (!_stillRunning.load()) {
+        task(Status(ErrorCodes::ShutdownInProgress, "Executor is not running"));
+        return;
+    }
+
+    if (auto tl = session->getTransportLayer()) {
+        _ensureReactorIsRunning(tl->getReactor(TransportLayer::kIngress));
+    }
+
+    _numWaitingForData.fetchAndAdd(1);
+    session->asyncWaitForData().getAsync(
+        [this, session, task = std::move(task)](Status status) mutable {
+            _numWaitingForData.fetchAndSubtract(1);
+            _schedule(
+                [status = std::move(status), task = std::move(task)](Status scheduled) mutable {
+                    task(scheduled.isOK() ? std::move(status) : std::move(scheduled));
+                });
+        });
+}
+
+void ServiceExecutorFixed::appendStats(BSONObjBuilder* bob) const {
+    struct Statlet {
+        int threads;
+        int borrowed;
+        int running;
+        int waiting;
+    };
+
+    auto statlet = [&] {
+        stdx::lock_guard lk(_mutex);
+        auto threads = _numRunningThreads.loadRelaxed();
+        auto borrowed = _numBorrowedThreads.loadRelaxed();
+        auto running = threads - _numIdleWorkers;
+        auto waiting = _numWaitingForData.loadRelaxed();
+        return Statlet{static_cast<int>(threads),
+                       static_cast<int>(borrowed),
+                       static_cast<int>(running),
+                       static_cast<int>(waiting)};
+    }();
+
+    BSONObjBuilder subbob = bob->subobjStart(kExecutorName);
+    subbob.append(kThreadsRunning, statlet.threads);
+    subbob.append(kThreadsBorrowed, statlet.borrowed);
+    subbob.append(kClientsInTotal, statlet.running + statlet.waiting);
+    subbob.append(kClientsRunning, statlet.running);
+    subbob.append(kClientsWaiting, statlet.waiting);
+}
+
+auto ServiceExecutorFixed::makeTaskRunner() -> std::unique_ptr<TaskRunner> {
+    iassert(ErrorCodes::ShutdownInProgress, "Executor is not running", _stillRunning.load());
+
+    /** Schedules on this. */
+    class ForwardingTaskRunner : public TaskRunner {
+    public:
+        explicit ForwardingTaskRunner(ServiceExecutorFixed* e) : _e{e} {}
+
+        void schedule(Task task) override {
+            _e->_schedule(std::move(task));
+        }
+
+        void runOnDataAvailable(std::shared_ptr<Session> session, Task task) override {
+            _e->_runOnDataAvailable(std::move(session), std::move(task));
+        }
+
+    private:
+        ServiceExecutorFixed* _e;
+    };
+    return std::make_unique<ForwardingTaskRunner>(this);
+}
+
+}  // namespace mongo::transport
@@ -0,0 +1,121 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <vector>
+
+#include "mongo/base/status.h"
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/db/service_context.h"
+#include "mongo/platform/atomic_word.h"
+#include "mongo/platform/mutex.h"
+#include "mongo/stdx/condition_variable.h"
+#include "mongo/stdx/thread.h"
+#include "mongo/transport/service_executor.h"
+#include "mongo/transport/session.h"
+#include "mongo/transport/transport_layer.h"
+#include "mongo/util/concurrency/with_lock.h"
+#include "mongo/util/duration.h"
+
+namespace mongo::transport {
+
+/**
+ * The fixed service executor runs every client on a bounded pool of worker threads instead of
+ * giving each one a dedicated thread.
+ *
+ * Between requests, a session is parked on the ingress reactor of its transport layer, which this
+ * executor drives from a thread of its own. Once the session has data to read, the next iteration
+ * of its workflow is queued for the worker pool. Workers are started on demand up to
+ * fixedServiceExecutorThreadLimit. If every worker is busy at that point, most likely blocked
+ * inside operations, the task borrows a thread of its own for the one iteration rather than queue
+ * behind them.
+ */
+class ServiceExecutorFixed final : public ServiceExecutor {
+public:
+    explicit ServiceExecutorFixed(size_t threadLimit);
+
+    /** Returns nullptr unless clients are configured to not use dedicated threads. */
+    static ServiceExecutorFixed* get(ServiceContext* ctx);
+
+    void start() override;
+    Status shutdown(Milliseconds timeout) override;
+
+    size_t getRunningThreads() const override {
+        return _numRunningThreads.loadRelaxed();
+    }
+
+    void appendStats(BSONObjBuilder* bob) const override;
+
+    std::unique_ptr<TaskRunner> makeTaskRunner() override;
+
+    bool usesDedicatedThreads() const override {
+        return false;
+    }
+
+    StringData getName() const override {
+        return "ServiceExecutorFixed"_sd;
+    }
+
+private:
+    void _startWorker(WithLock);
+
+    void _schedule(Task task);
+
+    void _runOnDataAvailable(const std::shared_ptr<Session>& session, Task task);
+
+    /** Makes sure a thread is running the reactor, so that sessions can wait on it. */
+    void _ensureReactorIsRunning(const ReactorHandle& reactor);
+
+    AtomicWord<bool> _stillRunning{false};
+
+    mutable Mutex _mutex = MONGO_MAKE_LATCH("ServiceExecutorFixed::_mutex");
+    stdx::condition_variable _threadWakeup;
+    stdx::condition_variable _shutdownCondition;
+
+    std::deque<Task> _readyTasks;
+
+    // Counts both pool workers and borrowed threads.
+    AtomicWord<size_t> _numRunningThreads{0};
+    AtomicWord<size_t> _numBorrowedThreads{0};
+    AtomicWord<size_t> _numWaitingForData{0};
+    size_t _numWorkers{0};
+    size_t _numIdleWorkers{0};
+
+    std::vector<ReactorHandle> _reactors;
+    std::vector<stdx::thread> _reactorThreads;
+
+    const size_t _threadLimit;
+};
+
+}  // namespace mongo::transport
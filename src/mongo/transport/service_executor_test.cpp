@@ -57,6 +57,7 @@
 #include "mongo/stdx/thread.h"
 #include "mongo/transport/mock_session.h"
 #include "mongo/transport/service_executor.h"
+#include "mongo/transport/service_executor_fixed.h"
 #include "mongo/transport/service_executor_synchronous.h"
 #include "mongo/transport/transport_layer.h"
 #include "mongo/transport/transport_layer_mock.h"
@@ -165,6 +166,11 @@ public:
     ServiceExecutorSynchronous executor;
 };
 
+class ServiceExecutorFixedTest : public unittest::Test {
+public:
+    ServiceExecutorFixed executor{1};
+};
+
 TEST_F(ServiceExecutorInlineTest, MakeTaskRunnerFailsBeforeStartup) {
     ASSERT_THROWS(executor.makeTaskRunner(), DBException);
 }
@@ -173,6 +179,10 @@ TEST_F(ServiceExecutorSynchronousTest, MakeTaskRunnerFailsBeforeStartup) {
     ASSERT_THROWS(executor.makeTaskRunner(), DBException);
 }
 
+TEST_F(ServiceExecutorFixedTest, MakeTaskRunnerFailsBeforeStartup) {
+    ASSERT_THROWS(executor.makeTaskRunner(), DBException);
+}
+
 // Schedule a task and ensure it has been executed.
 stdx::thread::id doBasicTaskRunTest(ServiceExecutor* executor) {
     boost::optional<stdx::thread::id> taskid;
@@ -203,6 +213,13 @@ TEST_F(ServiceExecutorInlineTest, BasicTaskRuns) {
     ASSERT(callerid == taskid);
 }
 
+TEST_F(ServiceExecutorFixedTest, BasicTaskRuns) {
+    auto callerid = stdx::this_thread::get_id();
+    auto taskid = doBasicTaskRunTest(&executor);
+    // Task runs on a worker thread.
+    ASSERT(callerid != taskid);
+}
+
 /** Implements a threadsafe 1-shot pause and resume. */
 class Breakpoint {
 public:
@@ -252,6 +269,29 @@ TEST_F(ServiceExecutorSynchronousTest, SpawnsWorkerThread) {
     ASSERT_THAT(**events, m::ElementsAre(m::Eq("caller"), m::Eq("task")));
 }
 
+// With its only worker blocked, the fixed executor must borrow a thread for the next task rather
+// than leave it queued behind the blocked one.
+TEST_F(ServiceExecutorFixedTest, BorrowsThreadWhenWorkersAreBusy) {
+    executor.start();
+    auto runner = executor.makeTaskRunner();
+
+    Breakpoint bp;
+    PromiseAndFuture<void> blocked;
+    runner->schedule([&](Status st) {
+        bp.pause();
+        blocked.promise.setFrom(st);
+    });
+    bp.await();
+
+    PromiseAndFuture<void> borrowed;
+    runner->schedule([&](Status st) { borrowed.promise.setFrom(st); });
+    ASSERT_DOES_NOT_THROW(borrowed.future.get());
+
+    bp.resume();
+    ASSERT_DOES_NOT_THROW(blocked.future.get());
+    ASSERT_OK(executor.shutdown(kShutdownTime));
+}
+
 // Ensure that tasks queued during the running of a task are executed
 // in the order they are enqueued.
 void doTestTaskQueueing(ServiceExecutor* executor) {
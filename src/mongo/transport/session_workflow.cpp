@@ -69,6 +69,7 @@
 #include "mongo/platform/compiler.h"
 #include "mongo/rpc/message.h"
 #include "mongo/rpc/op_msg.h"
+#include "mongo/rpc/reply_buffer_cache.h"
 #include "mongo/transport/ingress_handshake_metrics.h"
 #include "mongo/transport/message_compressor_base.h"
 #include "mongo/transport/message_compressor_manager.h"
@@ -483,6 +484,13 @@ private:
 
     void _scheduleIteration();
 
+    /**
+     * Schedules a single iteration for executors that don't give the session a dedicated thread.
+     * Unless an exhaust response already provided the next request, the session waits for data
+     * without holding a thread, and the iteration schedules its successor once it's done.
+     */
+    void _scheduleSharedThreadIteration();
+
     Future<void> _doOneIteration();
 
     /** Returns a Future for the next WorkItem. */
@@ -690,7 +698,9 @@ void SessionWorkflow::Impl::_sendResponse() {
                 }
             }
         });
-        uassertStatusOK(session()->sinkMessage(_work->consumeOut()));
+        auto out = _work->consumeOut();
+        uassertStatusOK(session()->sinkMessage(out));
+        rpc::recycleReplyBuffer(std::move(out));
     } catch (const DBException& ex) {
         LOGV2(22989,
               "Error sending response to client. Ending connection from remote",
@@ -795,6 +805,11 @@ Future<void> SessionWorkflow::Impl::_doOneIteration() {
 
 void SessionWorkflow::Impl::_scheduleIteration() try {
     _work = nullptr;
+    if (!executor()->usesDedicatedThreads()) {
+        _scheduleSharedThreadIteration();
+        return;
+    }
+
     taskRunner()->schedule(_captureContext([&](Status status) {
         if (MONGO_unlikely(!status.isOK())) {
             _cleanupSession(status);
@@ -802,7 +817,7 @@ void SessionWorkflow::Impl::_scheduleIteration() try {
         }
 
         try {
-            // All available service executors use dedicated threads, so it's okay to
+            // This service executor uses dedicated threads, so it's okay to
             // run eager futures in an ordinary loop to bypass scheduler overhead.
             while (true) {
                 _doOneIteration().get();
@@ -821,6 +836,30 @@ void SessionWorkflow::Impl::_scheduleIteration() try {
     _onLoopError(error);
 }
 
+void SessionWorkflow::Impl::_scheduleSharedThreadIteration() {
+    auto iteration = _captureContext([&](Status status) {
+        if (MONGO_unlikely(!status.isOK())) {
+            _cleanupSession(status);
+            return;
+        }
+
+        try {
+            _doOneIteration().get();
+            _work = nullptr;
+        } catch (const DBException& ex) {
+            _onLoopError(ex.toStatus());
+            return;
+        }
+        _scheduleIteration();
+    });
+
+    if (_nextWork) {
+        taskRunner()->schedule(std::move(iteration));
+    } else {
+        taskRunner()->runOnDataAvailable(session(), std::move(iteration));
+    }
+}
+
 void SessionWorkflow::Impl::terminate() {
     if (_isTerminated.swap(true))
         return;
@@ -44,13 +44,15 @@ AdmissionContext::AdmissionContext(const AdmissionContext& other)
     : _admissions(other._admissions.load()),
       _priority(other._priority.load()),
       _totalTimeQueuedMicros(other._totalTimeQueuedMicros.load()),
-      _startQueueingTime(other._startQueueingTime.load()) {}
+      _startQueueingTime(other._startQueueingTime.load()),
+      _queueGroup(other._queueGroup) {}
 
 AdmissionContext& AdmissionContext::operator=(const AdmissionContext& other) {
     _admissions.store(other._admissions.load());
     _priority.store(other._priority.load());
     _totalTimeQueuedMicros.store(other._totalTimeQueuedMicros.load());
     _startQueueingTime.store(other._startQueueingTime.load());
+    _queueGroup = other._queueGroup;
     return *this;
 }
 
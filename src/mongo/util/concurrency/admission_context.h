@@ -29,6 +29,7 @@
 #pragma once
 
 #include <boost/optional.hpp>
+#include <string>
 
 #include "mongo/base/string_data.h"
 #include "mongo/util/duration.h"
@@ -88,6 +89,20 @@ public:
 
     Priority getPriority() const;
 
+    /**
+     * Returns the key of the group this context queues under when admitted through a
+     * FairQueueTicketHolder. The empty string denotes the default group.
+     *
+     * Only accessed by the thread running the operation.
+     */
+    const std::string& getQueueGroup() const {
+        return _queueGroup;
+    }
+
+    void setQueueGroup(std::string queueGroup) {
+        _queueGroup = std::move(queueGroup);
+    }
+
 protected:
     friend class ScopedAdmissionPriorityBase;
     friend class TicketHolder;
@@ -103,6 +118,8 @@ protected:
     Atomic<Priority> _priority{Priority::kNormal};
     Atomic<int64_t> _totalTimeQueuedMicros;
     Atomic<TickSource::Tick> _startQueueingTime{kNotQueueing};
+
+    std::string _queueGroup;
 };
 
 /**
@@ -0,0 +1,225 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/util/concurrency/fair_queue_ticketholder.h"
+
+#include <algorithm>
+
+#include "mongo/util/assert_util_core.h"
+#include "mongo/util/interruptible.h"
+
+namespace mongo {
+
+FairQueueTicketHolder::FairQueueTicketHolder(ServiceContext* serviceContext,
+                                             int numTickets,
+                                             bool trackPeakUsed)
+    : TicketHolder(serviceContext, numTickets, trackPeakUsed), _tickets(numTickets) {}
+
+int32_t FairQueueTicketHolder::available() const {
+    return _tickets.load();
+}
+
+int64_t FairQueueTicketHolder::numFinishedProcessing() const {
+    return _stats.totalFinishedProcessing.load();
+}
+
+void FairQueueTicketHolder::setWeights(StringMap<int32_t> weights) {
+    stdx::lock_guard<Latch> lk(_mutex);
+    _weights = std::move(weights);
+    for (auto& [name, group] : _groups) {
+        group.weight = _weightFor(lk, name);
+    }
+}
+
+int32_t FairQueueTicketHolder::_weightFor(WithLock, StringData name) const {
+    auto it = _weights.find(name);
+    if (it == _weights.end()) {
+        return kDefaultWeight;
+    }
+    invariant(it->second > 0);
+    return it->second;
+}
+
+FairQueueTicketHolder::Group& FairQueueTicketHolder::_getGroup(WithLock lk,
+                                                               const std::string& name) {
+    if (auto it = _groups.find(name); it != _groups.end()) {
+        return it->second;
+    }
+    if (_groups.size() >= kMaxGroups) {
+        return _overflowGroup;
+    }
+
+    auto& group = _groups[name];
+    group.weight = _weightFor(lk, name);
+    return group;
+}
+
+bool FairQueueTicketHolder::_tryTake() {
+    int32_t available = _tickets.load();
+    while (available > 0) {
+        if (_tickets.compareAndSwap(&available, available - 1)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+boost::optional<Ticket> FairQueueTicketHolder::_tryAcquireImpl(AdmissionContext* admCtx) {
+    // Leave the released tickets to the queued operations, which are served in fair order.
+    if (_numQueued.load() > 0 || !_tryTake()) {
+        return boost::none;
+    }
+    return Ticket{this, admCtx};
+}
+
+void FairQueueTicketHolder::_dispatch(WithLock) {
+    while (_numQueued.load() > 0 && _tryTake()) {
+        Group* next = nullptr;
+        auto consider = [&](Group& group) {
+            if (!group.waiters.empty() && (!next || group.virtualTime < next->virtualTime)) {
+                next = &group;
+            }
+        };
+        for (auto& [_, group] : _groups) {
+            consider(group);
+        }
+        consider(_overflowGroup);
+        invariant(next);
+
+        Waiter* waiter = next->waiters.front();
+        next->waiters.pop_front();
+        _numQueued.fetchAndSubtract(1);
+
+        _virtualTime = next->virtualTime;
+        next->virtualTime += 1.0 / next->weight;
+        ++next->totalAdmitted;
+
+        waiter->granted = true;
+        waiter->cv.notify_one();
+    }
+}
+
+boost::optional<Ticket> FairQueueTicketHolder::_waitForTicketUntilImpl(
+    Interruptible& interruptible, AdmissionContext* admCtx, Date_t until) {
+    stdx::unique_lock<Latch> lk(_mutex);
+    Group& group = _getGroup(lk, admCtx->getQueueGroup());
+    if (group.waiters.empty()) {
+        // A group that was idle doesn't get to spend the share it didn't use.
+        group.virtualTime = std::max(group.virtualTime, _virtualTime);
+    }
+
+    Waiter waiter;
+    group.waiters.push_back(&waiter);
+    ++group.totalAddedQueue;
+
+    // Queueing before dispatching pairs with the release path, which returns its ticket before
+    // checking for queued operations. Either this dispatch sees the returned ticket, or the
+    // releasing thread sees this waiter and dispatches the ticket itself.
+    _numQueued.fetchAndAdd(1);
+    _dispatch(lk);
+
+    auto tickSource = _serviceContext->getTickSource();
+    const auto startWaitTime = tickSource->getTicks();
+    auto finishWaiting = [&](bool admitted) {
+        group.totalTimeQueuedMicros +=
+            tickSource->ticksTo<Microseconds>(tickSource->getTicks() - startWaitTime).count();
+        if (admitted) {
+            return;
+        }
+        ++group.totalCanceled;
+        if (waiter.granted) {
+            // The ticket was handed over while this operation was giving up, pass it on.
+            _tickets.fetchAndAdd(1);
+            _dispatch(lk);
+            return;
+        }
+        auto it = std::find(group.waiters.begin(), group.waiters.end(), &waiter);
+        invariant(it != group.waiters.end());
+        group.waiters.erase(it);
+        _numQueued.fetchAndSubtract(1);
+    };
+
+    bool granted = false;
+    try {
+        granted = interruptible.waitForConditionOrInterruptUntil(
+            waiter.cv, lk, until, [&] { return waiter.granted; });
+    } catch (const DBException&) {
+        finishWaiting(false);
+        throw;
+    }
+
+    finishWaiting(granted);
+    if (!granted) {
+        return boost::none;
+    }
+
+    lk.unlock();
+    return Ticket{this, admCtx};
+}
+
+void FairQueueTicketHolder::_releaseToTicketPoolImpl(AdmissionContext* admCtx) noexcept {
+    _tickets.fetchAndAdd(1);
+    if (_numQueued.load() > 0) {
+        stdx::lock_guard<Latch> lk(_mutex);
+        _dispatch(lk);
+    }
+}
+
+void FairQueueTicketHolder::_appendGroupStats(BSONObjBuilder& b, const Group& group) {
+    b.append("weight", group.weight);
+    b.append("queueLength", static_cast<long long>(group.waiters.size()));
+    b.append("addedToQueue", group.totalAddedQueue);
+    b.append("admittedFromQueue", group.totalAdmitted);
+    b.append("canceled", group.totalCanceled);
+    b.append("totalTimeQueuedMicros", group.totalTimeQueuedMicros);
+}
+
+void FairQueueTicketHolder::_appendImplStats(BSONObjBuilder& b) const {
+    {
+        BSONObjBuilder bb(b.subobjStart("normalPriority"));
+        _appendCommonQueueImplStats(bb, _stats);
+        bb.done();
+    }
+
+    stdx::lock_guard<Latch> lk(_mutex);
+    BSONObjBuilder fairQueue(b.subobjStart("fairQueue"));
+    {
+        BSONObjBuilder groups(fairQueue.subobjStart("groups"));
+        for (const auto& [name, group] : _groups) {
+            BSONObjBuilder bb(groups.subobjStart(name));
+            _appendGroupStats(bb, group);
+        }
+    }
+    {
+        BSONObjBuilder bb(fairQueue.subobjStart("overflow"));
+        _appendGroupStats(bb, _overflowGroup);
+    }
+}
+
+}  // namespace mongo
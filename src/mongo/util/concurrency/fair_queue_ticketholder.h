@@ -0,0 +1,156 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <boost/optional/optional.hpp>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <string>
+
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/db/service_context.h"
+#include "mongo/platform/atomic_word.h"
+#include "mongo/platform/mutex.h"
+#include "mongo/stdx/condition_variable.h"
+#include "mongo/util/concurrency/admission_context.h"
+#include "mongo/util/concurrency/ticketholder.h"
+#include "mongo/util/concurrency/with_lock.h"
+#include "mongo/util/string_map.h"
+
+namespace mongo {
+
+/**
+ * A TicketHolder that shares its tickets between groups of operations using weighted fair queuing.
+ *
+ * The group of an operation is the queue group of its AdmissionContext. As long as nobody is
+ * queued, tickets are taken from a single atomic counter like in the SemaphoreTicketHolder. Once
+ * tickets run out, operations wait in a FIFO queue per group, and each released ticket is handed
+ * to the head of the backlogged group with the smallest virtual time. Admitting an operation
+ * advances the virtual time of its group by the inverse of the group's weight, so under contention
+ * each group is admitted in proportion to its weight, and a group flooding the queue cannot starve
+ * the others.
+ *
+ * At most 'kMaxGroups' distinct groups are tracked. Operations of any further group share a single
+ * overflow group with the default weight.
+ */
+class FairQueueTicketHolder final : public TicketHolder {
+public:
+    static constexpr size_t kMaxGroups = 128;
+    static constexpr int32_t kDefaultWeight = 1;
+
+    explicit FairQueueTicketHolder(ServiceContext* serviceContext,
+                                   int numTickets,
+                                   bool trackPeakUsed);
+
+    int32_t available() const final;
+
+    int64_t queued() const final {
+        auto removed = _stats.totalRemovedQueue.loadRelaxed();
+        auto added = _stats.totalAddedQueue.loadRelaxed();
+        return std::max(added - removed, (int64_t)0);
+    };
+
+    int64_t numFinishedProcessing() const final;
+
+    /**
+     * Replaces the weights of the groups. Groups without an entry get 'kDefaultWeight'. Weights
+     * must be positive.
+     */
+    void setWeights(StringMap<int32_t> weights);
+
+private:
+    struct Waiter {
+        stdx::condition_variable cv;
+        bool granted = false;
+    };
+
+    struct Group {
+        int32_t weight = kDefaultWeight;
+        double virtualTime = 0;
+        std::deque<Waiter*> waiters;
+
+        int64_t totalAddedQueue = 0;
+        int64_t totalAdmitted = 0;
+        int64_t totalCanceled = 0;
+        int64_t totalTimeQueuedMicros = 0;
+    };
+
+    boost::optional<Ticket> _waitForTicketUntilImpl(Interruptible& interruptible,
+                                                    AdmissionContext* admCtx,
+                                                    Date_t until) final;
+
+    boost::optional<Ticket> _tryAcquireImpl(AdmissionContext* admCtx) final;
+    void _releaseToTicketPoolImpl(AdmissionContext* admCtx) noexcept final;
+
+    void _appendImplStats(BSONObjBuilder& b) const final;
+
+    QueueStats& _getQueueStatsToUse(AdmissionContext::Priority priority) noexcept final {
+        return _stats;
+    }
+
+    /**
+     * Takes a ticket from the pool if it has any. Returns whether a ticket was taken.
+     */
+    bool _tryTake();
+
+    /**
+     * Returns the group to queue an operation of 'name' under, creating it if needed.
+     */
+    Group& _getGroup(WithLock, const std::string& name);
+
+    /**
+     * Hands the available tickets to the queued waiters, in weighted fair order.
+     */
+    void _dispatch(WithLock);
+
+    int32_t _weightFor(WithLock, StringData name) const;
+
+    static void _appendGroupStats(BSONObjBuilder& b, const Group& group);
+
+    AtomicWord<int32_t> _tickets;
+
+    // Number of waiters in all the groups' queues. While non-zero, tickets are only given out in
+    // fair order by '_dispatch', so that new arrivals don't overtake the queued operations.
+    AtomicWord<int32_t> _numQueued;
+
+    mutable Mutex _mutex = MONGO_MAKE_LATCH("FairQueueTicketHolder::_mutex");
+    std::map<std::string, Group, std::less<>> _groups;
+    Group _overflowGroup;
+    StringMap<int32_t> _weights;
+
+    // Virtual time of the last admitted waiter. Groups that become backlogged start from here, so
+    // that idle periods don't turn into credit to be spent later.
+    double _virtualTime = 0;
+
+    QueueStats _stats;
+};
+
+}  // namespace mongo
@@ -0,0 +1,137 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/util/concurrency/fair_queue_ticketholder.h"
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "mongo/platform/mutex.h"
+#include "mongo/stdx/thread.h"
+#include "mongo/unittest/framework.h"
+#include "mongo/util/concurrency/ticketholder_test_fixture.h"
+#include "mongo/util/duration.h"
+#include "mongo/util/tick_source_mock.h"
+
+namespace {
+using namespace mongo;
+
+class FairQueueTicketHolderTest : public TicketHolderTestFixture {};
+
+TEST_F(FairQueueTicketHolderTest, BasicTimeoutFairQueue) {
+    ServiceContext serviceContext;
+    serviceContext.setTickSource(std::make_unique<TickSourceMock<Microseconds>>());
+    basicTimeout(_opCtx.get(),
+                 std::make_unique<FairQueueTicketHolder>(
+                     &serviceContext, 1, false /* trackPeakUsed */));
+}
+
+TEST_F(FairQueueTicketHolderTest, ResizeStatsFairQueue) {
+    ServiceContext serviceContext;
+    serviceContext.setTickSource(std::make_unique<TickSourceMock<Microseconds>>());
+    auto tickSource = dynamic_cast<TickSourceMock<Microseconds>*>(serviceContext.getTickSource());
+
+    resizeTest(_opCtx.get(),
+               std::make_unique<FairQueueTicketHolder>(
+                   &serviceContext, 1, false /* trackPeakUsed */),
+               tickSource);
+}
+
+TEST_F(FairQueueTicketHolderTest, Interruption) {
+    ServiceContext serviceContext;
+    serviceContext.setTickSource(std::make_unique<TickSourceMock<Microseconds>>());
+    interruptTest(_opCtx.get(),
+                  std::make_unique<FairQueueTicketHolder>(
+                      &serviceContext, 1, false /* trackPeakUsed */));
+}
+
+TEST_F(FairQueueTicketHolderTest, AdmitsGroupsInProportionToTheirWeights) {
+    ServiceContext serviceContext;
+    serviceContext.setTickSource(std::make_unique<TickSourceMock<Microseconds>>());
+    FairQueueTicketHolder holder(&serviceContext, 1, false /* trackPeakUsed */);
+    holder.setWeights({{"heavy", 3}});
+
+    MockAdmissionContext admCtx{};
+    boost::optional<Ticket> ticket = holder.tryAcquire(&admCtx);
+    ASSERT_TRUE(ticket);
+
+    // Queue six operations of each group behind the only ticket, then let them through one at a
+    // time and record the order in which the groups get admitted.
+    constexpr int kPerGroup = 6;
+    Mutex mutex = MONGO_MAKE_LATCH("FairQueueTicketHolderTest::mutex");
+    std::vector<std::string> admitted;
+    std::vector<stdx::thread> threads;
+    for (const auto& group : {"heavy", "light"}) {
+        for (int i = 0; i < kPerGroup; ++i) {
+            threads.emplace_back([&, group = std::string{group}] {
+                MockAdmissionContext waiterAdmCtx{};
+                waiterAdmCtx.setQueueGroup(group);
+                auto waiterTicket = holder.waitForTicketUntil(
+                    *Interruptible::notInterruptible(), &waiterAdmCtx, Date_t::max());
+                ASSERT_TRUE(waiterTicket);
+                stdx::lock_guard<Latch> lk(mutex);
+                admitted.push_back(group);
+            });
+        }
+    }
+    auto queueLength = [&](StringData group) {
+        BSONObjBuilder bob;
+        holder.appendStats(bob);
+        return bob.obj()
+            .getObjectField("fairQueue")
+            .getObjectField("groups")
+            .getObjectField(group)
+            .getIntField("queueLength");
+    };
+    while (queueLength("heavy") + queueLength("light") < 2 * kPerGroup) {
+    }
+
+    ticket.reset();
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    ASSERT_EQ(admitted.size(), 2 * kPerGroup);
+
+    // While both groups are backlogged, the heavy group gets three tickets for every ticket of the
+    // light group.
+    auto heavyInFirstFour = std::count(admitted.begin(), admitted.begin() + 4, "heavy");
+    ASSERT_EQ(heavyInFirstFour, 3);
+
+    BSONObjBuilder bob;
+    holder.appendStats(bob);
+    auto stats = bob.obj();
+    auto groups = stats.getObjectField("fairQueue").getObjectField("groups");
+    ASSERT_EQ(groups.getObjectField("heavy").getIntField("weight"), 3);
+    ASSERT_EQ(groups.getObjectField("heavy").getIntField("admittedFromQueue"), kPerGroup);
+    ASSERT_EQ(groups.getObjectField("light").getIntField("weight"), 1);
+    ASSERT_EQ(groups.getObjectField("light").getIntField("queueLength"), 0);
+}
+
+}  // namespace
@@ -29,7 +29,9 @@
 
 #include "mongo/util/concurrency/semaphore_ticketholder.h"
 
+#include <cstdint>
 #include <memory>
+#include <numeric>
 
 #include "mongo/unittest/framework.h"
 #include "mongo/util/concurrency/ticketholder_test_fixture.h"
@@ -90,4 +92,35 @@ TEST_F(SemaphoreTicketHolderTest, PriorityBookkeeping) {
         });
 }
 
+TEST_F(SemaphoreTicketHolderTest, ProcessingLatencyOnlyTrackedWhenEnabled) {
+    ServiceContext serviceContext;
+    serviceContext.setTickSource(std::make_unique<TickSourceMock<Microseconds>>());
+    auto tickSource = dynamic_cast<TickSourceMock<Microseconds>*>(serviceContext.getTickSource());
+    SemaphoreTicketHolder holder(&serviceContext, 1, false /* trackPeakUsed */);
+
+    auto holdTicket = [&](Microseconds duration) {
+        MockAdmissionContext admCtx{};
+        auto ticket = holder.tryAcquire(&admCtx);
+        ASSERT_TRUE(ticket);
+        tickSource->advance(duration);
+    };
+    auto totalCount = [&] {
+        auto counts = holder.getProcessingLatencyCounts();
+        return std::accumulate(counts.begin(), counts.end(), int64_t{0});
+    };
+
+    holdTicket(Microseconds{100});
+    ASSERT_EQ(totalCount(), 0);
+
+    holder.setTrackProcessingLatency(true);
+    holdTicket(Microseconds{100});
+    ASSERT_EQ(totalCount(), 1);
+    // 100us falls in the bucket below the 128us partition.
+    ASSERT_EQ(holder.getProcessingLatencyCounts()[1], 1);
+
+    holder.setTrackProcessingLatency(false);
+    holdTicket(Microseconds{100});
+    ASSERT_EQ(totalCount(), 1);
+}
+
 }  // namespace
@@ -0,0 +1,198 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/util/concurrency/sharded_ticketholder.h"
+
+#include <algorithm>
+#include <random>
+
+#include "mongo/platform/random.h"
+#include "mongo/util/assert_util_core.h"
+#include "mongo/util/interruptible.h"
+#include "mongo/util/scopeguard.h"
+
+namespace mongo {
+namespace {
+
+// Threads are spread over the shards in the order in which they first use a ShardedTicketHolder,
+// and keep the same home shard for their whole lifetime.
+AtomicWord<uint32_t> nextHomeShard{0};
+
+}  // namespace
+
+ShardedTicketHolder::ShardedTicketHolder(ServiceContext* serviceContext,
+                                         int numTickets,
+                                         int numShards,
+                                         bool trackPeakUsed)
+    : TicketHolder(serviceContext, numTickets, trackPeakUsed),
+      _numShards(std::max(numShards, 1)),
+      _shards(std::make_unique<Shard[]>(_numShards)) {
+    invariant(numTickets >= 0);
+    const size_t tickets = numTickets;
+    for (size_t i = 0; i < _numShards; ++i) {
+        _shards[i].tickets.store(tickets / _numShards + (i < tickets % _numShards ? 1 : 0));
+    }
+}
+
+int64_t ShardedTicketHolder::numFinishedProcessing() const {
+    return _stats.totalFinishedProcessing.load();
+}
+
+void ShardedTicketHolder::_appendImplStats(BSONObjBuilder& b) const {
+    {
+        BSONObjBuilder bb(b.subobjStart("normalPriority"));
+        _appendCommonQueueImplStats(bb, _stats);
+        bb.done();
+    }
+    b.append("shards", static_cast<long long>(_numShards));
+    b.append("stolen", _totalStolen.loadRelaxed());
+    b.append("handedOver", _totalHandedOver.loadRelaxed());
+}
+
+size_t ShardedTicketHolder::_homeShard() const {
+    static thread_local uint32_t homeShard = nextHomeShard.fetchAndAdd(1);
+    return homeShard % _numShards;
+}
+
+bool ShardedTicketHolder::_tryTakeFrom(Shard& shard) {
+    uint32_t available = shard.tickets.load();
+    while (available > 0) {
+        if (shard.tickets.compareAndSwap(&available, available - 1)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool ShardedTicketHolder::_tryTake(size_t homeShard) {
+    if (_tryTakeFrom(_shards[homeShard])) {
+        return true;
+    }
+
+    for (size_t i = 1; i < _numShards; ++i) {
+        if (_tryTakeFrom(_shards[(homeShard + i) % _numShards])) {
+            _totalStolen.fetchAndAddRelaxed(1);
+            return true;
+        }
+    }
+    return false;
+}
+
+boost::optional<Ticket> ShardedTicketHolder::_tryAcquireImpl(AdmissionContext* admCtx) {
+    if (_tryTake(_homeShard())) {
+        return Ticket{this, admCtx};
+    }
+    return boost::none;
+}
+
+boost::optional<Ticket> ShardedTicketHolder::_waitForTicketUntilImpl(Interruptible& interruptible,
+                                                                     AdmissionContext* admCtx,
+                                                                     Date_t until) {
+    auto nextDeadline = [&]() {
+        // Same jitter as the SemaphoreTicketHolder, to avoid waking all the waiters of a shard at
+        // the same time when checking for interrupts.
+        static int32_t baseIntervalMs = 500;
+        static double jitterFactor = 0.2;
+        static thread_local XorShift128 urbg(SecureRandom().nextInt64());
+        int32_t offset = std::uniform_int_distribution<int32_t>(
+            -jitterFactor * baseIntervalMs, baseIntervalMs * jitterFactor)(urbg);
+        return std::min(until, Date_t::now() + Milliseconds{baseIntervalMs + offset});
+    };
+
+    const size_t homeShard = _homeShard();
+    Shard& shard = _shards[homeShard];
+
+    // Registering as a waiter before looking at the shards again pairs with the release path,
+    // which returns its ticket before checking for waiters. Either this thread sees the returned
+    // ticket, or the releasing thread sees this waiter and hands the ticket over to its shard.
+    shard.waiters.fetchAndAdd(1);
+    _totalWaiters.fetchAndAdd(1);
+    ON_BLOCK_EXIT([&] {
+        _totalWaiters.fetchAndSubtract(1);
+        shard.waiters.fetchAndSubtract(1);
+    });
+
+    Date_t deadline = nextDeadline();
+    while (true) {
+        if (_tryTake(homeShard)) {
+            Ticket ticket{this, admCtx};
+            interruptible.checkForInterrupt();
+            return std::move(ticket);
+        }
+
+        if (!shard.tickets.waitUntil(0, deadline)) {
+            if (deadline == until) {
+                return boost::none;
+            }
+
+            deadline = nextDeadline();
+            interruptible.checkForInterrupt();
+        }
+    }
+}
+
+void ShardedTicketHolder::_releaseToTicketPoolImpl(AdmissionContext* admCtx) noexcept {
+    const size_t homeShard = _homeShard();
+    Shard& shard = _shards[homeShard];
+    shard.tickets.fetchAndAdd(1);
+
+    if (shard.waiters.load() > 0) {
+        shard.tickets.notifyOne();
+        return;
+    }
+    if (_totalWaiters.load() == 0) {
+        return;
+    }
+
+    // Waiters only block on their own shard, so move the ticket over to a shard with waiters unless
+    // somebody already picked it up.
+    for (size_t i = 1; i < _numShards; ++i) {
+        Shard& other = _shards[(homeShard + i) % _numShards];
+        if (other.waiters.load() == 0) {
+            continue;
+        }
+        if (!_tryTakeFrom(shard)) {
+            return;
+        }
+        other.tickets.fetchAndAdd(1);
+        other.tickets.notifyOne();
+        _totalHandedOver.fetchAndAddRelaxed(1);
+        return;
+    }
+}
+
+int32_t ShardedTicketHolder::available() const {
+    int32_t available = 0;
+    for (size_t i = 0; i < _numShards; ++i) {
+        available += _shards[i].tickets.load();
+    }
+    return available;
+}
+
+}  // namespace mongo
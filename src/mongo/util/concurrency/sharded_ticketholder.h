@@ -0,0 +1,125 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#pragma once
+
+#include <boost/optional/optional.hpp>
+#include <cstdint>
+#include <memory>
+
+#include "mongo/bson/bsonobjbuilder.h"
+#include "mongo/db/service_context.h"
+#include "mongo/platform/atomic_word.h"
+#include "mongo/platform/waitable_atomic.h"
+#include "mongo/stdx/new.h"
+#include "mongo/util/concurrency/admission_context.h"
+#include "mongo/util/concurrency/ticketholder.h"
+
+namespace mongo {
+
+/**
+ * A semaphore-style TicketHolder whose tickets are split across several independent pools, so that
+ * threads acquiring and releasing tickets on different cores don't contend on a single counter.
+ *
+ * Each thread is assigned a home shard the first time it touches any ShardedTicketHolder. Tickets
+ * are acquired from the home shard first and stolen from the other shards when it is exhausted.
+ * Released tickets go back to the home shard, unless there are waiters queued on other shards, in
+ * which case the ticket is handed over to one of them.
+ */
+class ShardedTicketHolder final : public TicketHolder {
+public:
+    explicit ShardedTicketHolder(ServiceContext* serviceContext,
+                                 int numTickets,
+                                 int numShards,
+                                 bool trackPeakUsed);
+
+    int32_t available() const final;
+
+    int64_t queued() const final {
+        auto removed = _stats.totalRemovedQueue.loadRelaxed();
+        auto added = _stats.totalAddedQueue.loadRelaxed();
+        return std::max(added - removed, (int64_t)0);
+    };
+
+    int64_t numFinishedProcessing() const final;
+
+    size_t numShards() const {
+        return _numShards;
+    }
+
+private:
+    struct alignas(stdx::hardware_destructive_interference_size) Shard {
+        BasicWaitableAtomic<uint32_t> tickets;
+
+        // Number of threads blocked waiting for 'tickets' to become non-zero.
+        AtomicWord<int32_t> waiters;
+    };
+
+    boost::optional<Ticket> _waitForTicketUntilImpl(Interruptible& interruptible,
+                                                    AdmissionContext* admCtx,
+                                                    Date_t until) final;
+
+    boost::optional<Ticket> _tryAcquireImpl(AdmissionContext* admCtx) final;
+    void _releaseToTicketPoolImpl(AdmissionContext* admCtx) noexcept final;
+
+    void _appendImplStats(BSONObjBuilder& b) const final;
+
+    QueueStats& _getQueueStatsToUse(AdmissionContext::Priority priority) noexcept final {
+        return _stats;
+    }
+
+    /**
+     * Returns the index of the calling thread's home shard.
+     */
+    size_t _homeShard() const;
+
+    /**
+     * Takes a ticket from the given shard if it has any. Returns whether a ticket was taken.
+     */
+    static bool _tryTakeFrom(Shard& shard);
+
+    /**
+     * Takes a ticket from the home shard, or from any other shard if the home shard is exhausted.
+     */
+    bool _tryTake(size_t homeShard);
+
+    const size_t _numShards;
+    std::unique_ptr<Shard[]> _shards;
+
+    // Sum of the 'waiters' of all the shards, so that releases can skip the scan of the other
+    // shards in the common case where nobody is waiting.
+    AtomicWord<int32_t> _totalWaiters;
+
+    AtomicWord<int64_t> _totalStolen;
+    AtomicWord<int64_t> _totalHandedOver;
+
+    QueueStats _stats;
+};
+
+}  // namespace mongo
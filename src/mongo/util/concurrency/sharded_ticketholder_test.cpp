@@ -0,0 +1,123 @@
+/**
+ *    Copyright (C) 2024-present MongoDB, Inc.
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the Server Side Public License, version 1,
+ *    as published by MongoDB, Inc.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    Server Side Public License for more details.
+ *
+ *    You should have received a copy of the Server Side Public License
+ *    along with this program. If not, see
+ *    <http://www.mongodb.com/licensing/server-side-public-license>.
+ *
+ *    As a special exception, the copyright holders give permission to link the
+ *    code of portions of this program with the OpenSSL library under certain
+ *    conditions as described in each individual source file and distribute
+ *    linked combinations including the program with the OpenSSL library. You
+ *    must comply with the Server Side Public License in all respects for
+ *    all of the code used other than as permitted herein. If you modify file(s)
+ *    with this exception, you may extend this exception to your version of the
+ *    file(s), but you are not obligated to do so. If you do not wish to do so,
+ *    delete this exception statement from your version. If you delete this
+ *    exception statement from all source files in the program, then also delete
+ *    it in the license file.
+ */
+
+#include "mongo/util/concurrency/sharded_ticketholder.h"
+
+#include <memory>
+
+#include "mongo/stdx/thread.h"
+#include "mongo/unittest/framework.h"
+#include "mongo/util/concurrency/ticketholder_test_fixture.h"
+#include "mongo/util/duration.h"
+#include "mongo/util/tick_source_mock.h"
+
+namespace {
+using namespace mongo;
+
+class ShardedTicketHolderTest : public TicketHolderTestFixture {};
+
+TEST_F(ShardedTicketHolderTest, BasicTimeoutSharded) {
+    ServiceContext serviceContext;
+    serviceContext.setTickSource(std::make_unique<TickSourceMock<Microseconds>>());
+    basicTimeout(_opCtx.get(),
+                 std::make_unique<ShardedTicketHolder>(
+                     &serviceContext, 1, 4 /* numShards */, false /* trackPeakUsed */));
+}
+
+TEST_F(ShardedTicketHolderTest, ResizeStatsSharded) {
+    ServiceContext serviceContext;
+    serviceContext.setTickSource(std::make_unique<TickSourceMock<Microseconds>>());
+    auto tickSource = dynamic_cast<TickSourceMock<Microseconds>*>(serviceContext.getTickSource());
+
+    resizeTest(_opCtx.get(),
+               std::make_unique<ShardedTicketHolder>(
+                   &serviceContext, 1, 4 /* numShards */, false /* trackPeakUsed */),
+               tickSource);
+}
+
+TEST_F(ShardedTicketHolderTest, Interruption) {
+    ServiceContext serviceContext;
+    serviceContext.setTickSource(std::make_unique<TickSourceMock<Microseconds>>());
+    interruptTest(_opCtx.get(),
+                  std::make_unique<ShardedTicketHolder>(
+                      &serviceContext, 1, 4 /* numShards */, false /* trackPeakUsed */));
+}
+
+TEST_F(ShardedTicketHolderTest, StealsFromOtherShards) {
+    ServiceContext serviceContext;
+    serviceContext.setTickSource(std::make_unique<TickSourceMock<Microseconds>>());
+    ShardedTicketHolder holder(&serviceContext, 8, 4 /* numShards */, false /* trackPeakUsed */);
+    ASSERT_EQ(holder.available(), 8);
+
+    // A single thread can drain every shard, not only its home shard.
+    MockAdmissionContext admCtx{};
+    std::vector<Ticket> tickets;
+    for (int i = 0; i < 8; ++i) {
+        auto ticket = holder.tryAcquire(&admCtx);
+        ASSERT_TRUE(ticket);
+        tickets.push_back(std::move(*ticket));
+    }
+    ASSERT_FALSE(holder.tryAcquire(&admCtx));
+    ASSERT_EQ(holder.used(), 8);
+
+    BSONObjBuilder bob;
+    holder.appendStats(bob);
+    ASSERT_EQ(bob.obj().getIntField("stolen"), 6);
+
+    tickets.clear();
+    ASSERT_EQ(holder.available(), 8);
+}
+
+TEST_F(ShardedTicketHolderTest, ReleaseWakesWaiterOnAnotherShard) {
+    ServiceContext serviceContext;
+    serviceContext.setTickSource(std::make_unique<TickSourceMock<Microseconds>>());
+    ShardedTicketHolder holder(&serviceContext, 1, 4 /* numShards */, false /* trackPeakUsed */);
+
+    MockAdmissionContext admCtx{};
+    boost::optional<Ticket> ticket = holder.tryAcquire(&admCtx);
+    ASSERT_TRUE(ticket);
+
+    // The waiter is assigned the next home shard, so the ticket released by this thread has to
+    // be handed over to the waiter's shard.
+    auto waiter = stdx::thread([&]() {
+        MockAdmissionContext waiterAdmCtx{};
+        auto waiterTicket = holder.waitForTicketUntil(
+            *Interruptible::notInterruptible(), &waiterAdmCtx, Date_t::max());
+        ASSERT_TRUE(waiterTicket);
+    });
+
+    while (!holder.queued()) {
+    }
+
+    ticket.reset();
+    waiter.join();
+    ASSERT_EQ(holder.available(), 1);
+}
+
+}  // namespace
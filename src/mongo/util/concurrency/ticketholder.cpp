@@ -51,6 +51,22 @@ void TicketHolder::_updateQueueStatsOnRelease(TicketHolder::QueueStats& queueSta
     auto delta =
         tickSource->ticksTo<Microseconds>(tickSource->getTicks() - ticket._acquisitionTime);
     queueStats.totalTimeProcessingMicros.fetchAndAddRelaxed(delta.count());
+    if (_trackProcessingLatency.loadRelaxed()) {
+        _processingLatency.increment(delta.count());
+    }
+}
+
+const std::vector<int64_t>& TicketHolder::processingLatencyPartitions() {
+    // Powers of two from 64us to roughly 4s, which is fine-grained enough to tell the latency
+    // percentiles apart while keeping the cost of recording a release to a short binary search.
+    static const auto partitions = [] {
+        std::vector<int64_t> partitions;
+        for (int64_t bound = 64; bound <= 4 * 1024 * 1024; bound *= 2) {
+            partitions.push_back(bound);
+        }
+        return partitions;
+    }();
+    return partitions;
 }
 
 void TicketHolder::_updateQueueStatsOnTicketAcquisition(AdmissionContext* admCtx,
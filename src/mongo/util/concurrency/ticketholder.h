@@ -31,6 +31,7 @@
 #include <boost/move/utility_core.hpp>
 #include <boost/optional/optional.hpp>
 #include <cstdint>
+#include <vector>
 
 #include "mongo/bson/bsonobjbuilder.h"
 #include "mongo/db/service_context.h"
@@ -38,6 +39,7 @@
 #include "mongo/platform/mutex.h"
 #include "mongo/util/assert_util_core.h"
 #include "mongo/util/concurrency/admission_context.h"
+#include "mongo/util/histogram.h"
 #include "mongo/util/tick_source.h"
 #include "mongo/util/time_support.h"
 
@@ -133,6 +135,29 @@ public:
      */
     virtual int64_t numFinishedProcessing() const = 0;
 
+    /**
+     * Cumulative number of released tickets, bucketed by how long they were held. Bucket 'i' counts
+     * the tickets held for less than 'processingLatencyPartitions()[i]' microseconds, and the last
+     * bucket the ones held for longer than the last partition. Only the tickets released while
+     * 'setTrackProcessingLatency(true)' was in effect are counted.
+     */
+    virtual std::vector<int64_t> getProcessingLatencyCounts() const {
+        return _processingLatency.getCounts();
+    }
+
+    /**
+     * The bucket boundaries, in microseconds, of 'getProcessingLatencyCounts()'.
+     */
+    static const std::vector<int64_t>& processingLatencyPartitions();
+
+    /**
+     * Enables or disables recording the released tickets in 'getProcessingLatencyCounts()'. This is
+     * off by default, as every release then writes to a histogram shared by all threads.
+     */
+    void setTrackProcessingLatency(bool track) {
+        _trackProcessingLatency.store(track);
+    }
+
     /**
      * Statistics for queueing mechanisms in the TicketHolder implementations. The term "Queue" is a
      * loose abstraction for the way in which operations are queued when there are no available
@@ -183,6 +208,9 @@ private:
         MONGO_MAKE_LATCH(HierarchicalAcquisitionLevel(2), "TicketHolder::_resizeMutex");
     QueueStats _exemptQueueStats;
 
+    AtomicWord<bool> _trackProcessingLatency{false};
+    Histogram<int64_t> _processingLatency{processingLatencyPartitions()};
+
 protected:
     /**
      * Appends the standard statistics stored in QueueStats to BSONObjBuilder b;
@@ -233,6 +261,16 @@ public:
         _numFinishedProcessing = numFinishedProcessing;
     }
 
+    std::vector<int64_t> getProcessingLatencyCounts() const override {
+        return _processingLatencyCounts.empty()
+            ? std::vector<int64_t>(processingLatencyPartitions().size() + 1)
+            : _processingLatencyCounts;
+    }
+
+    void setProcessingLatencyCounts(std::vector<int64_t> counts) {
+        _processingLatencyCounts = std::move(counts);
+    }
+
 private:
     void _releaseToTicketPoolImpl(AdmissionContext* admCtx) noexcept override;
 
@@ -250,6 +288,7 @@ private:
 
     int32_t _available = 0;
     int32_t _numFinishedProcessing = 0;
+    std::vector<int64_t> _processingLatencyCounts;
 };
 
 /**
@@ -259,7 +298,9 @@ private:
 class Ticket {
     friend class TicketHolder;
     friend class SemaphoreTicketHolder;
+    friend class FairQueueTicketHolder;
     friend class PriorityTicketHolder;
+    friend class ShardedTicketHolder;
     friend class MockTicketHolder;
 
 public:
@@ -41,6 +41,7 @@
 #include "mongo/util/concurrency/admission_context.h"
 #include "mongo/util/concurrency/priority_ticketholder.h"
 #include "mongo/util/concurrency/semaphore_ticketholder.h"
+#include "mongo/util/concurrency/sharded_ticketholder.h"
 #include "mongo/util/concurrency/ticketholder.h"
 #include "mongo/util/duration.h"
 #include "mongo/util/latency_distribution.h"
@@ -55,6 +56,7 @@ static int kTickets = 32;
 static int kThreadMin = 16;
 static int kThreadMax = 1024;
 static int kLowPriorityAdmissionBypassThreshold = 100;
+static int kTicketShards = 8;
 
 // For a given benchmark, specifies the AdmissionContext::Priority of ticket admissions
 enum class AdmissionsPriority {
@@ -78,6 +80,9 @@ public:
                                                               kTickets,
                                                               kLowPriorityAdmissionBypassThreshold,
                                                               true /* track peakUsed */);
+        } else if constexpr (std::is_same_v<ShardedTicketHolder, TicketHolderImpl>) {
+            ticketHolder = std::make_unique<TicketHolderImpl>(
+                serviceContext, kTickets, kTicketShards, true /* track peakUsed */);
         } else {
             ticketHolder = std::make_unique<TicketHolderImpl>(
                 serviceContext, kTickets, true /* track peakUsed */);
@@ -201,6 +206,14 @@ BENCHMARK_TEMPLATE(BM_acquireAndRelease, SemaphoreTicketHolder, AdmissionsPriori
     ->Threads(128)
     ->Threads(kThreadMax);
 
+// Comparable with the SemaphoreTicketHolder benchmark above, the difference being the contention
+// on the single ticket counter.
+BENCHMARK_TEMPLATE(BM_acquireAndRelease, ShardedTicketHolder, AdmissionsPriority::kNormal)
+    ->Threads(kThreadMin)
+    ->Threads(kTickets)
+    ->Threads(128)
+    ->Threads(kThreadMax);
+
 // TODO SERVER-72616: Remove ifdefs once PriorityTicketHolder is available cross-platform.
 #ifdef __linux__
 
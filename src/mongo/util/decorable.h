@@ -61,8 +61,10 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
 #include <boost/optional.hpp>
 #include <cstdint>
+#include <cstring>
 #include <fmt/format.h>
 #include <iostream>
 #include <memory>
@@ -278,6 +280,69 @@ private:
     ptrdiff_t _offset = decorable_detail::getRegistry<DecoratedType>()[_registryPosition].offset;
 };
 
+/**
+ * Per-thread cache of the decoration blocks released by the Decorables of type D.
+ *
+ * Many Decorables are short-lived, like the OperationContext made for every request or the
+ * RecoveryUnit::Snapshot made for every storage transaction. Reusing their blocks saves a heap
+ * allocation and deallocation for each of them. The decorations themselves are still constructed
+ * and destroyed along with their owner, in a block zeroed just like a newly allocated one.
+ */
+template <typename D>
+class BlockCache {
+public:
+    static std::unique_ptr<unsigned char[]> take(size_t size) {
+        if (auto cache = _get(); cache && cache->count > 0 && cache->size == size) {
+            auto block = std::move(cache->blocks[--cache->count]);
+            std::memset(block.get(), 0, size);
+            return block;
+        }
+        return std::make_unique<unsigned char[]>(size);
+    }
+
+    static void give(std::unique_ptr<unsigned char[]> block, size_t size) noexcept {
+        auto cache = _get();
+        if (!cache) {
+            return;
+        }
+        if (cache->size != size) {
+            // Decorations were declared after the cached blocks were allocated.
+            for (auto& cached : cache->blocks) {
+                cached.reset();
+            }
+            cache->count = 0;
+            cache->size = size;
+        }
+        if (cache->count < kCapacity) {
+            cache->blocks[cache->count++] = std::move(block);
+        }
+    }
+
+private:
+    static constexpr size_t kCapacity = 4;
+
+    struct Cache {
+        ~Cache() {
+            _destroyed = true;
+        }
+
+        size_t size = 0;
+        size_t count = 0;
+        std::array<std::unique_ptr<unsigned char[]>, kCapacity> blocks;
+    };
+
+    static Cache* _get() noexcept {
+        // Decorables destroyed on an exiting thread after its cache just free their blocks.
+        if (_destroyed) {
+            return nullptr;
+        }
+        static thread_local Cache cache;
+        return &cache;
+    }
+
+    static inline thread_local bool _destroyed = false;
+};
+
 template <typename D>
 class DecorationBuffer {
 public:
@@ -318,6 +383,7 @@ public:
 
     ~DecorationBuffer() {
         _tearDownParts(_reg().size());
+        BlockCache<DecoratedType>::give(std::move(_dataOwnership), _size);
     }
 
     /** Only basic (not strong) exception safety for this copy-assign. */
@@ -375,9 +441,10 @@ private:
     }
 
     std::unique_ptr<unsigned char[]> _makeData() {
-        return std::make_unique<unsigned char[]>(_reg().bufferSize());
+        return BlockCache<DecoratedType>::take(_size);
     }
 
+    size_t _size{_reg().bufferSize()};
     std::unique_ptr<unsigned char[]> _dataOwnership{_makeData()};
     unsigned char* _data{_dataOwnership.get()};
 };
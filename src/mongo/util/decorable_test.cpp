@@ -126,6 +126,29 @@ TEST_F(DecorableTest, SimpleDecoration) {
     ASSERT_EQ(stats.destructed, 4);
 }
 
+TEST_F(DecorableTest, RecycledBlockIsReinitialized) {
+    struct X : Decorable<X> {};
+    static auto da = X::declareDecoration<A>();
+    static auto di = X::declareDecoration<int>();
+
+    const void* block;
+    {
+        X x;
+        x[da].value = 1;
+        x[di] = 2;
+        block = &x[di];
+    }
+    ASSERT_EQ(stats.destructed, 1);
+
+    // The block released by the first instance is handed to the next one on the same thread, with
+    // its decorations constructed again from zeroed memory.
+    X x;
+    ASSERT_EQ(&x[di], block);
+    ASSERT_EQ(stats.constructed, 2);
+    ASSERT_EQ(x[da].value, 0);
+    ASSERT_EQ(x[di], 0);
+}
+
 TEST_F(DecorableTest, ThrowingConstructor) {
     struct Thrower {
         Thrower() {
@@ -38,6 +38,8 @@
 #include "mongo/logv2/log.h"
 #include "mongo/logv2/log_attr.h"
 #include "mongo/logv2/log_component.h"
+#include "mongo/logv2/log_domain_global.h"
+#include "mongo/logv2/log_manager.h"
 #include "mongo/platform/atomic_word.h"
 #include "mongo/platform/mutex.h"
 #include "mongo/stdx/condition_variable.h"
@@ -77,6 +79,7 @@ void runRegisteredShutdownTasks(decltype(shutdownTasks) tasks,
 MONGO_COMPILER_NORETURN void logAndQuickExit_inlock() {
     ExitCode code = shutdownExitCode.value();
     LOGV2(23138, "Shutting down", "exitCode"_attr = code);
+    logv2::LogManager::global().getGlobalDomainInternal().flushAsyncFileWrites();
     quickExit(code);
 }
 
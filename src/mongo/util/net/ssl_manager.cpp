@@ -279,6 +279,8 @@ std::pair<std::string, RFC4514Parser::ValueTerminator> RFC4514Parser::extractVal
 }
 
 const auto getTLSVersionCounts = ServiceContext::declareDecoration<TLSVersionCounts>();
+const auto getTLSSessionResumptionCounts =
+    ServiceContext::declareDecoration<TLSSessionResumptionCounts>();
 
 constexpr StringData kOID_DC = "0.9.2342.19200300.100.1.25"_sd;
 constexpr StringData kOID_O = "2.5.4.10"_sd;
@@ -628,6 +630,10 @@ TLSVersionCounts& TLSVersionCounts::get(ServiceContext* serviceContext) {
     return getTLSVersionCounts(serviceContext);
 }
 
+TLSSessionResumptionCounts& TLSSessionResumptionCounts::get(ServiceContext* serviceContext) {
+    return getTLSSessionResumptionCounts(serviceContext);
+}
+
 MONGO_INITIALIZER_WITH_PREREQUISITES(SSLManagerLogger, ("SSLManager"))
 (InitializerContext*) {
     if (!isSSLServer || (sslGlobalParams.sslMode.load() != SSLParams::SSLMode_disabled)) {
@@ -1310,6 +1316,15 @@ std::string escapeRfc2253(StringData str) {
     return ret;
 }
 
+void recordTLSSessionResumption(bool isServer, bool resumed) {
+    auto& counts = TLSSessionResumptionCounts::get(getGlobalServiceContext());
+    if (isServer) {
+        (resumed ? counts.ingressResumed : counts.ingressFull).addAndFetch(1);
+    } else {
+        (resumed ? counts.egressResumed : counts.egressFull).addAndFetch(1);
+    }
+}
+
 void recordTLSVersion(TLSVersion version, const HostAndPort& hostForLogging) {
     StringData versionString;
     auto& counts = mongo::TLSVersionCounts::get(getGlobalServiceContext());
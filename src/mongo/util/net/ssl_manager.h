@@ -170,6 +170,19 @@ struct TLSVersionCounts {
     static TLSVersionCounts& get(ServiceContext* serviceContext);
 };
 
+/**
+ * Counts of TLS handshakes which resumed a previously negotiated session, versus those which
+ * performed a full handshake, for each connection direction.
+ */
+struct TLSSessionResumptionCounts {
+    AtomicWord<long long> ingressResumed;
+    AtomicWord<long long> ingressFull;
+    AtomicWord<long long> egressResumed;
+    AtomicWord<long long> egressFull;
+
+    static TLSSessionResumptionCounts& get(ServiceContext* serviceContext);
+};
+
 struct CertInformationToLog {
     SSLX509Name subject;
     SSLX509Name issuer;
@@ -340,6 +353,13 @@ public:
                                                                 const HostAndPort& hostForLogging,
                                                                 const ExecutorPtr& reactor) = 0;
 
+    /**
+     * Prepares an egress connection to 'target' before its handshake starts, offering a session
+     * previously negotiated with the same host for resumption when one is cached. No-op for
+     * SChannel and SecureTransport.
+     */
+    virtual void prepareEgressHandshake(SSLConnectionType ssl, const HostAndPort& target) {}
+
     /**
      * No-op function for SChannel and SecureTransport. Attaches stapled OCSP response to the
      * SSL_CTX obect.
@@ -473,6 +493,11 @@ StatusWith<TLSVersion> mapTLSVersion(SSLConnectionType conn);
  */
 void recordTLSVersion(TLSVersion version, const HostAndPort& hostForLogging);
 
+/**
+ * Record whether a completed handshake resumed a previous TLS session.
+ */
+void recordTLSSessionResumption(bool isServer, bool resumed);
+
 /**
  * Emit a warning() explaining that a client certificate is about to expire.
  */
@@ -58,6 +58,7 @@
 #include "mongo/util/debug_util.h"
 #include "mongo/util/exit.h"
 #include "mongo/util/fail_point.h"
+#include "mongo/util/lru_cache.h"
 #include "mongo/util/net/cidr.h"
 #include "mongo/util/net/dh_openssl.h"
 #include "mongo/util/net/ocsp/ocsp_manager.h"
@@ -285,6 +286,10 @@ inline int X509_NAME_ENTRY_set(const X509_NAME_ENTRY* ne) {
     return ne->set;
 }
 
+inline int SSL_SESSION_up_ref(SSL_SESSION* session) {
+    return CRYPTO_add(&session->references, 1, CRYPTO_LOCK_SSL_SESSION) > 1;
+}
+
 inline void X509_OBJECT_free(X509_OBJECT* a) {
     X509_OBJECT_free_contents(a);
     OPENSSL_free(a);
@@ -475,8 +480,80 @@ public:
 using UniqueSSLContext =
     std::unique_ptr<SSL_CTX, OpenSSLDeleter<decltype(::SSL_CTX_free), ::SSL_CTX_free>>;
 using UniqueSSL = std::unique_ptr<SSL, OpenSSLDeleter<decltype(::SSL_free), ::SSL_free>>;
+using UniqueSSLSession =
+    std::unique_ptr<SSL_SESSION, OpenSSLDeleter<decltype(::SSL_SESSION_free), ::SSL_SESSION_free>>;
 static const int BUFFER_SIZE = 8 * 1024;
 
+/**
+ * Bounded cache of the TLS sessions negotiated through an egress SSL_CTX, keyed by the remote
+ * host, so that later connections to the same host can offer the session for resumption instead
+ * of performing a full handshake. The cache is owned by the SSL_CTX it serves, which means that
+ * sessions never outlive the certificates and CAs they were negotiated with.
+ */
+class EgressSessionCache {
+public:
+    explicit EgressSessionCache(std::size_t capacity) : _sessions(capacity) {}
+
+    /**
+     * Returns a new reference to the session most recently negotiated with 'target', if any.
+     */
+    UniqueSSLSession get(const std::string& target) {
+        stdx::lock_guard<Latch> lk(_mutex);
+        auto it = _sessions.find(target);
+        if (it == _sessions.end()) {
+            return nullptr;
+        }
+        SSL_SESSION_up_ref(it->second.get());
+        return UniqueSSLSession(it->second.get());
+    }
+
+    void put(const std::string& target, UniqueSSLSession session) {
+        stdx::lock_guard<Latch> lk(_mutex);
+        _sessions.add(target, std::move(session));
+    }
+
+private:
+    Mutex _mutex = MONGO_MAKE_LATCH("EgressSessionCache::_mutex");
+    LRUCache<std::string, UniqueSSLSession> _sessions;
+};
+
+// ex_data slot on an egress SSL_CTX holding its EgressSessionCache.
+int egressSessionCacheIndex() {
+    static const int index = SSL_CTX_get_ex_new_index(
+        0, nullptr, nullptr, nullptr, [](void*, void* ptr, CRYPTO_EX_DATA*, int, long, void*) {
+            delete static_cast<EgressSessionCache*>(ptr);
+        });
+    return index;
+}
+
+// ex_data slot on an egress SSL holding the cache key of the host it connects to.
+int egressSessionTargetIndex() {
+    static const int index = SSL_get_ex_new_index(
+        0, nullptr, nullptr, nullptr, [](void*, void* ptr, CRYPTO_EX_DATA*, int, long, void*) {
+            delete static_cast<std::string*>(ptr);
+        });
+    return index;
+}
+
+EgressSessionCache* getEgressSessionCache(SSL_CTX* context) {
+    return static_cast<EgressSessionCache*>(
+        SSL_CTX_get_ex_data(context, egressSessionCacheIndex()));
+}
+
+/**
+ * Invoked by OpenSSL whenever a client connection receives a new session (for TLS 1.3, a new
+ * ticket). Returning 1 tells OpenSSL that we have taken ownership of the session reference.
+ */
+int egressNewSessionCallback(SSL* ssl, SSL_SESSION* session) {
+    auto cache = getEgressSessionCache(SSL_get_SSL_CTX(ssl));
+    auto target = static_cast<std::string*>(SSL_get_ex_data(ssl, egressSessionTargetIndex()));
+    if (!cache || !target) {
+        return 0;
+    }
+    cache->put(*target, UniqueSSLSession(session));
+    return 1;
+}
+
 using UniqueOpenSSLStringStack =
     std::unique_ptr<STACK_OF(OPENSSL_STRING),
                     OpenSSLDeleter<decltype(X509_email_free), ::X509_email_free>>;
@@ -1318,6 +1395,8 @@ public:
 
     bool isTransient() const final;
 
+    void prepareEgressHandshake(SSL* conn, const HostAndPort& target) final;
+
     std::string getTargetedClusterConnectionString() const final;
 
     int SSL_read(SSLConnectionInterface* conn, void* buf, int num) final;
@@ -2531,6 +2610,18 @@ Status SSLManagerOpenSSL::initSSLContext(SSL_CTX* context,
                                     << getSSLErrorMessage(ERR_get_error()));
     }
 
+    // Servers cache sessions and issue tickets by default. Clients only resume a session when one
+    // is offered before the handshake, so egress contexts keep their own cache of them.
+    if (direction == ConnectionDirection::kOutgoing && tlsEgressSessionCacheSize > 0) {
+        delete getEgressSessionCache(context);
+        ::SSL_CTX_set_ex_data(context,
+                              egressSessionCacheIndex(),
+                              new EgressSessionCache(tlsEgressSessionCacheSize));
+        ::SSL_CTX_set_session_cache_mode(
+            context, SSL_SESS_CACHE_CLIENT | SSL_SESS_CACHE_NO_INTERNAL_STORE);
+        ::SSL_CTX_sess_set_new_cb(context, egressNewSessionCallback);
+    }
+
     // We should accept all SNI extensions advertised by clients
     if (1 != SSL_CTX_set_tlsext_servername_callback(context, &SSLManagerOpenSSL::servername_cb)) {
         return Status(ErrorCodes::InvalidSSLConfiguration,
@@ -2656,6 +2747,20 @@ Status SSLManagerOpenSSL::initSSLContext(SSL_CTX* context,
     return Status::OK();
 }
 
+void SSLManagerOpenSSL::prepareEgressHandshake(SSL* conn, const HostAndPort& target) {
+    auto cache = getEgressSessionCache(SSL_get_SSL_CTX(conn));
+    if (!cache) {
+        return;
+    }
+
+    auto key = target.toString();
+    if (auto session = cache->get(key)) {
+        // SSL_set_session takes its own reference to the session.
+        ::SSL_set_session(conn, session.get());
+    }
+    ::SSL_set_ex_data(conn, egressSessionTargetIndex(), new std::string(std::move(key)));
+}
+
 void SSLManagerOpenSSL::registerOwnedBySSLContext(
     std::weak_ptr<const SSLConnectionContext> ownedByContext) {
     _ownedByContext = ownedByContext;
@@ -3255,6 +3360,7 @@ Future<SSLPeerInfo> SSLManagerOpenSSL::parseAndValidatePeerCertificate(
     }
 
     recordTLSVersion(tlsVersionStatus.getValue(), hostForLogging);
+    recordTLSSessionResumption(SSL_is_server(conn), SSL_session_reused(conn));
 
     UniqueX509 peerCert(SSL_get_peer_certificate(conn));
 
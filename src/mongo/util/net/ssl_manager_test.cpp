@@ -33,6 +33,7 @@
 #include "mongo/config.h"
 #include "mongo/platform/basic.h"
 
+#include "mongo/idl/server_parameter_test_util.h"
 #include "mongo/transport/asio/asio_transport_layer.h"
 #include "mongo/transport/session_manager.h"
 #include "mongo/transport/transport_layer_manager.h"
@@ -686,6 +687,65 @@ TEST(SSLManager, IgnoreInitServerSideContextFromMemory) {
         egress->native_handle(), params, SSLManagerInterface::ConnectionDirection::kOutgoing));
 }
 
+TEST(SSLManager, EgressSessionCacheResumesSessions) {
+    RAIIServerParameterControllerForTest cacheSize("tlsEgressSessionCacheSize", 8);
+
+    SSLParams params;
+    params.sslMode.store(::mongo::sslGlobalParams.SSLMode_requireSSL);
+    params.sslPEMKeyFile = "jstests/libs/server.pem";
+    params.sslCAFile = "jstests/libs/ca.pem";
+    params.sslClusterFile = "jstests/libs/client.pem";
+
+    std::shared_ptr<SSLManagerInterface> manager =
+        SSLManagerInterface::create(params, true /* isSSLServer */);
+
+    asio::ssl::context ingress(asio::ssl::context::sslv23);
+    asio::ssl::context egress(asio::ssl::context::sslv23);
+    uassertStatusOK(manager->initSSLContext(
+        ingress.native_handle(), params, SSLManagerInterface::ConnectionDirection::kIncoming));
+    uassertStatusOK(manager->initSSLContext(
+        egress.native_handle(), params, SSLManagerInterface::ConnectionDirection::kOutgoing));
+
+    // Runs a handshake over an in-memory BIO pair and reports whether the client resumed.
+    auto handshake = [&](const HostAndPort& target) {
+        std::unique_ptr<SSL, decltype(&::SSL_free)> server(SSL_new(ingress.native_handle()),
+                                                           ::SSL_free);
+        std::unique_ptr<SSL, decltype(&::SSL_free)> client(SSL_new(egress.native_handle()),
+                                                           ::SSL_free);
+        BIO* serverBio;
+        BIO* clientBio;
+        ASSERT_EQ(1, BIO_new_bio_pair(&serverBio, 0, &clientBio, 0));
+        SSL_set_bio(server.get(), serverBio, serverBio);
+        SSL_set_bio(client.get(), clientBio, clientBio);
+        SSL_set_accept_state(server.get());
+        SSL_set_connect_state(client.get());
+
+        manager->prepareEgressHandshake(client.get(), target);
+        for (int i = 0; i < 10; ++i) {
+            if (SSL_is_init_finished(client.get()) && SSL_is_init_finished(server.get())) {
+                break;
+            }
+            SSL_do_handshake(client.get());
+            SSL_do_handshake(server.get());
+        }
+        ASSERT_TRUE(SSL_is_init_finished(client.get()));
+        ASSERT_TRUE(SSL_is_init_finished(server.get()));
+
+        // Let the client consume any session tickets sent after the handshake completed.
+        char byte;
+        ASSERT_LTE(SSL_read(client.get(), &byte, 1), 0);
+        return SSL_session_reused(client.get()) == 1;
+    };
+
+    const HostAndPort first("first.example.com", 27017);
+    const HostAndPort second("second.example.com", 27017);
+    ASSERT_FALSE(handshake(first));
+    ASSERT_TRUE(handshake(first));
+    // Sessions are only offered to the host they were negotiated with.
+    ASSERT_FALSE(handshake(second));
+    ASSERT_TRUE(handshake(second));
+}
+
 TEST(SSLManager, TransientSSLParams) {
     SSLParams params;
     params.sslMode.store(::mongo::sslGlobalParams.SSLMode_requireSSL);
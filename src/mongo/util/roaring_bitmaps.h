@@ -68,6 +68,49 @@ public:
             : false;
     }
 
+    /**
+     * Remove the value from the bitmaps. Returns true if the value was present, false otherwise.
+     */
+    bool removeChecked(uint64_t value) {
+        auto it = _roarings.find(highBytes(value));
+        if (it == _roarings.end() || !it->second.removeChecked(lowBytes(value))) {
+            return false;
+        }
+        if (it->second.isEmpty()) {
+            _roarings.erase(it);
+        }
+        return true;
+    }
+
+    /**
+     * Return true if the set contains no values.
+     */
+    bool empty() const {
+        return _roarings.empty();
+    }
+
+    /**
+     * Return the number of values in the set.
+     */
+    uint64_t cardinality() const {
+        uint64_t result = 0;
+        for (auto&& [_, roaring] : _roarings) {
+            result += roaring.cardinality();
+        }
+        return result;
+    }
+
+    /**
+     * Return the approximate number of bytes used by the bitmaps.
+     */
+    size_t getSizeInBytes() const {
+        size_t result = 0;
+        for (auto&& [_, roaring] : _roarings) {
+            result += sizeof(uint32_t) + sizeof(roaring::Roaring) + roaring.getSizeInBytes();
+        }
+        return result;
+    }
+
 private:
     static constexpr uint32_t highBytes(const uint64_t in) {
         return uint32_t(in >> 32);
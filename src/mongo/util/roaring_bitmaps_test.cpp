@@ -101,4 +101,28 @@ TEST(RoaringBitmapTest, Roaring64BTreeAdd) {
         ASSERT_TRUE(roaring64.contains(i));
     }
 }
+
+TEST(RoaringBitmapTest, Roaring64BTreeRemoveChecked) {
+    Roaring64BTree roaring64;
+    ASSERT_TRUE(roaring64.empty());
+    ASSERT_FALSE(roaring64.removeChecked(1));
+
+    // Values are spread over several 32-bit buckets.
+    const uint64_t highValue = (uint64_t{1} << 40) + 7;
+    roaring64.add(1);
+    roaring64.add(2);
+    roaring64.add(highValue);
+    ASSERT_EQ(3U, roaring64.cardinality());
+    ASSERT_GT(roaring64.getSizeInBytes(), 0U);
+
+    ASSERT_TRUE(roaring64.removeChecked(highValue));
+    ASSERT_FALSE(roaring64.removeChecked(highValue));
+    ASSERT_FALSE(roaring64.contains(highValue));
+    ASSERT_EQ(2U, roaring64.cardinality());
+
+    ASSERT_TRUE(roaring64.removeChecked(1));
+    ASSERT_TRUE(roaring64.removeChecked(2));
+    ASSERT_TRUE(roaring64.empty());
+    ASSERT_EQ(0U, roaring64.cardinality());
+}
 }  // namespace mongo
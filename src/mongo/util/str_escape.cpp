@@ -31,7 +31,9 @@
 
 #include <algorithm>
 #include <array>
+#include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <iterator>
 #include <type_traits>
 #include <utility>
@@ -46,10 +48,6 @@ namespace mongo::str {
 namespace {
 constexpr char kHexChar[] = "0123456789abcdef";
 
-struct NoopBuffer {
-    void append(const char* begin, const char* end) {}
-};
-
 // Appends the bytes in the range [begin, end) to the output buffer,
 // which can either be a fmt::memory_buffer, or a std::string.
 template <typename Buffer, typename Iterator>
@@ -57,6 +55,22 @@ void appendBuffer(Buffer& buffer, Iterator begin, Iterator end) {
     buffer.append(begin, end);
 }
 
+// Returns true if none of the 8 bytes at 'p' is a control character, DEL, a double quote, a
+// backslash or part of a multi-byte UTF-8 sequence. None of the escapers below modify such bytes,
+// so words of them can be skipped without looking at each byte.
+bool isPlainAsciiWord(const char* p) {
+    constexpr uint64_t kOnes = 0x0101010101010101ULL;
+    constexpr uint64_t kHighBits = 0x8080808080808080ULL;
+    auto hasZeroByte = [](uint64_t x) {
+        return (x - kOnes) & ~x & kHighBits;
+    };
+    uint64_t word;
+    std::memcpy(&word, p, sizeof(word));
+    uint64_t special = ((word - kOnes * 0x20) & ~word) | word | (word + kOnes);
+    return !(special & kHighBits) && !hasZeroByte(word ^ (kOnes * '"')) &&
+        !hasZeroByte(word ^ (kOnes * '\\'));
+}
+
 // 'singleHandler' Function to write a valid single byte UTF-8 sequence with desired escaping.
 // 'invalidByteHandler' Function to write a byte of invalid UTF-8 encoding
 // 'twoEscaper' Function to write a valid two byte UTF-8 sequence with desired escaping, for C1
@@ -153,6 +167,11 @@ void escape(Buffer& buffer,
 
 
     while (it != inLast) {
+        if (inLast - it >= static_cast<std::ptrdiff_t>(sizeof(uint64_t)) && isPlainAsciiWord(it)) {
+            it += sizeof(uint64_t);
+            continue;
+        }
+
         uint8_t c = *it;
         bool bit7 = (c >> 7) & 1;
         if (MONGO_likely(!bit7)) {
@@ -515,29 +534,46 @@ std::string escapeForJSON(StringData str, size_t maxLength, size_t* wouldWrite)
 }
 
 bool validUTF8(StringData str) {
-    // No-op buffer and handlers, defined to re-use escape method logic.
-    NoopBuffer buffer;
-    auto singleByteHandler = [](const auto& writer, uint8_t unescaped) {
-    };
-    auto twoByteEscaper = [](const auto& writer, uint8_t first, uint8_t second) {
-    };
+    // Accepts exactly the sequences escape() treats as valid: a lead byte announcing a 1 to 4 byte
+    // sequence followed by that many continuation bytes. Most strings are ASCII, so runs of it are
+    // skipped a word at a time.
+    constexpr uint64_t kHighBits = 0x8080808080808080ULL;
+    auto it = reinterpret_cast<const uint8_t*>(str.data());
+    const auto last = it + str.size();
+    while (it != last) {
+        if (static_cast<size_t>(last - it) >= sizeof(uint64_t)) {
+            uint64_t word;
+            std::memcpy(&word, it, sizeof(word));
+            if (!(word & kHighBits)) {
+                it += sizeof(word);
+                continue;
+            }
+        }
 
-    // Throws an exception when an invalid UTF8 character is detected.
-    auto invalidByteHandler = [](const auto& writer, uint8_t) {
-        uasserted(ErrorCodes::BadValue, "Invalid UTF-8 Character");
-    };
+        uint8_t c = *it;
+        int len;
+        if (MONGO_likely(c < 0x80)) {
+            len = 1;
+        } else if ((c >> 5) == 0b110) {
+            len = 2;
+        } else if ((c >> 4) == 0b1110) {
+            len = 3;
+        } else if ((c >> 3) == 0b11110) {
+            len = 4;
+        } else {
+            return false;
+        }
 
-    try {
-        escape(buffer,
-               str,
-               std::move(singleByteHandler),
-               std::move(invalidByteHandler),
-               std::move(twoByteEscaper),
-               std::string::npos,
-               nullptr);
-        return true;
-    } catch (const ExceptionFor<ErrorCodes::BadValue>&) {
-        return false;
+        if (MONGO_unlikely(last - it < len)) {
+            return false;
+        }
+        for (int i = 1; i < len; ++i) {
+            if ((it[i] >> 6) != 0b10) {
+                return false;
+            }
+        }
+        it += len;
     }
+    return true;
 }
 }  // namespace mongo::str
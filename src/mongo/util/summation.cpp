@@ -88,4 +88,32 @@ long long DoubleDoubleSummation::getLong() const {
     sum += llround((_sum - sum) + _addend);
     return sum;
 }
+
+Decimal128 DecimalSummation::getDecimal() const {
+    if (!_isScaled)
+        return _total;
+
+    uint128_t magnitude = _coefficient < 0 ? -static_cast<uint128_t>(_coefficient)
+                                           : static_cast<uint128_t>(_coefficient);
+    return Decimal128(_coefficient < 0 ? 1 : 0,
+                      _biasedExponent,
+                      absl::Uint128High64(magnitude),
+                      absl::Uint128Low64(magnitude));
+}
+
+void DecimalSummation::_addGeneral(const Decimal128& x) {
+    Decimal128 total = getDecimal().add(x);
+    if (total.isNaN() || total.isInfinite() || (total.isZero() && total.isNegative())) {
+        _isScaled = false;
+        _total = total;
+        return;
+    }
+
+    // The rounded result is finite, so pick up the scaled representation again from it.
+    _biasedExponent = total.getBiasedExponent();
+    _coefficient = static_cast<int128_t>(
+        absl::MakeUint128(total.getCoefficientHigh(), total.getCoefficientLow()));
+    if (total.isNegative())
+        _coefficient = -_coefficient;
+}
 }  // namespace mongo
@@ -34,6 +34,7 @@
 #include <utility>
 
 #include "mongo/platform/decimal128.h"
+#include "mongo/platform/int128.h"
 #include "mongo/util/assert_util.h"
 
 namespace mongo {
@@ -164,4 +165,54 @@ private:
     constexpr DoubleDoubleSummation(double sum, double addend) noexcept
         : _sum(sum), _addend(addend), _special(sum) {}
 };
+
+/**
+ * Class to sum a series of Decimal128 values, producing exactly the result of adding each of them
+ * in turn with Decimal128::add. While the addends share the exponent of the running total, which
+ * is the common case for fixed-point amounts, the total is kept as a signed 128-bit coefficient
+ * and each add is a plain integer add rather than a call into the BID library. Any other addend,
+ * or one that would carry the coefficient past 34 digits, goes through Decimal128::add instead.
+ */
+class DecimalSummation {
+public:
+    DecimalSummation() = default;
+
+    /**
+     * Adds x to the sum.
+     */
+    void add(const Decimal128& x) {
+        if (_isScaled && x.getBiasedExponent() == _biasedExponent) {
+            // A non-canonical coefficient reads as zero here, just as BID treats it.
+            int128_t coefficient = static_cast<int128_t>(
+                absl::MakeUint128(x.getCoefficientHigh(), x.getCoefficientLow()));
+            int128_t sum = (x.getValue().high64 >> 63) ? _coefficient - coefficient
+                                                       : _coefficient + coefficient;
+            if (sum <= kMaxCoefficient && sum >= -kMaxCoefficient) {
+                _coefficient = sum;
+                return;
+            }
+        }
+        _addGeneral(x);
+    }
+
+    /**
+     * Returns the accumulated sum.
+     */
+    Decimal128 getDecimal() const;
+
+private:
+    // The largest coefficient representable in a Decimal128, 10^34 - 1.
+    static constexpr int128_t kMaxCoefficient =
+        absl::MakeInt128(0x1ed09bead87c0, 0x378d8e63ffffffff);
+
+    void _addGeneral(const Decimal128& x);
+
+    // While '_isScaled' is true, the sum is '_coefficient' * 10^('_biasedExponent' - bias).
+    // Otherwise the sum is held in '_total', which happens once it is a NaN, an infinity or a
+    // negative zero.
+    bool _isScaled = true;
+    std::uint32_t _biasedExponent = Decimal128::kExponentBias;
+    int128_t _coefficient = 0;
+    Decimal128 _total;
+};
 }  // namespace mongo
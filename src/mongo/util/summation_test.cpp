@@ -31,6 +31,7 @@
 #include <cstdint>
 #include <cstdlib>
 #include <limits>
+#include <string>
 #include <vector>
 
 #include "mongo/base/string_data.h"
@@ -233,4 +234,46 @@ TEST(Summation, ConvertNaNToDecimal) {
     ASSERT_TRUE(sum.getDecimal().isNaN());
     ASSERT_FALSE(sum.getDecimal().isInfinite());
 }
+
+TEST(Summation, DecimalSummationMatchesSequentialAdd) {
+    std::vector<std::string> decimalValues = {
+        "12.34",
+        "-0.55",
+        "100.00",
+        "1E+3",
+        "-0",
+        "0.001",
+        "9999999999999999999999999999999.999",
+        "9999999999999999999999999999999.999",
+        "-1234.5678",
+        "1E-6000",
+        "-9999999999999999999999999999999999E+10",
+        "Infinity",
+        "12.34",
+        "-Infinity",
+        "7",
+    };
+
+    DecimalSummation sum;
+    Decimal128 straightSum;
+    for (const auto& str : decimalValues) {
+        Decimal128 x(str);
+        sum.add(x);
+        straightSum = straightSum.add(x);
+
+        // Compare the encodings so that the exponent and the sign of zero are checked too.
+        ASSERT_EQUALS(sum.getDecimal().getValue().high64, straightSum.getValue().high64) << str;
+        ASSERT_EQUALS(sum.getDecimal().getValue().low64, straightSum.getValue().low64) << str;
+    }
+    ASSERT_TRUE(sum.getDecimal().isNaN());
+}
+
+TEST(Summation, DecimalSummationCancelsToPositiveZero) {
+    DecimalSummation sum;
+    sum.add(Decimal128("-2.50"));
+    sum.add(Decimal128("2.50"));
+    ASSERT_TRUE(sum.getDecimal().isZero());
+    ASSERT_FALSE(sum.getDecimal().isNegative());
+    ASSERT_EQUALS(sum.getDecimal().getBiasedExponent(), Decimal128("0.00").getBiasedExponent());
+}
 }  // namespace mongo